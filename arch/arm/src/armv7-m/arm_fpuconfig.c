@@ -58,6 +58,29 @@ void arm_fpuconfig(void)
 {
   uint32_t regval;
 
+#ifdef CONFIG_ARCH_LAZYFPU
+  /* Keep CONTROL.FPCA clear so that tasks start without an FP context.
+   * The first FP instruction that a task executes will set FPCA (via
+   * FPCCR.ASPEN) and only from that point on will the extended context
+   * frame with the FP registers be stacked for that task.  Tasks that
+   * never touch the FPU keep the basic frame and pay nothing for the
+   * FP context on interrupts and context switches.
+   */
+
+  regval = getcontrol();
+  regval &= ~CONTROL_FPCA;
+  setcontrol(regval);
+
+  /* Set FPCCR.ASPEN so that the hardware manages FPCA automatically and
+   * FPCCR.LSPEN so that stacking of the volatile FP registers on
+   * exception entry is deferred until an FP instruction is actually
+   * executed in the handler.
+   */
+
+  regval = getreg32(NVIC_FPCCR);
+  regval |= (NVIC_FPCCR_ASPEN | NVIC_FPCCR_LSPEN);
+  putreg32(regval, NVIC_FPCCR);
+#else
   /* Set CONTROL.FPCA so that we always get the extended context frame
    * with the volatile FP registers stacked above the basic context.
    */
@@ -74,6 +97,7 @@ void arm_fpuconfig(void)
   regval = getreg32(NVIC_FPCCR);
   regval &= ~(NVIC_FPCCR_ASPEN | NVIC_FPCCR_LSPEN);
   putreg32(regval, NVIC_FPCCR);
+#endif
 
   /* Enable full access to CP10 and CP11 */
 
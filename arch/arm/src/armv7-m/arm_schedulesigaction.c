@@ -134,8 +134,9 @@ void up_schedule_sigaction(struct tcb_s *tcb)
 #endif
       tcb->xcp.regs[REG_XPSR]       = ARMV7M_XPSR_T;
 #ifdef CONFIG_BUILD_PROTECTED
-      tcb->xcp.regs[REG_LR]         = EXC_RETURN_THREAD;
-      tcb->xcp.regs[REG_EXC_RETURN] = EXC_RETURN_THREAD;
+      tcb->xcp.regs[REG_EXC_RETURN] =
+        EXC_RETURN_TODISPATCH(tcb->xcp.regs[REG_EXC_RETURN]);
+      tcb->xcp.regs[REG_LR]         = tcb->xcp.regs[REG_EXC_RETURN];
       tcb->xcp.regs[REG_CONTROL]    = getcontrol() & ~CONTROL_NPRIV;
 #endif
     }
@@ -273,7 +273,7 @@ int arm_svcall(int irq, void *context, void *arg)
            */
 
           regs[REG_PC]         = (uint32_t)USERSPACE->task_startup & ~1;
-          regs[REG_EXC_RETURN] = EXC_RETURN_THREAD;
+          regs[REG_EXC_RETURN] = EXC_RETURN_TODISPATCH(regs[REG_EXC_RETURN]);
 
           /* Return unprivileged mode */
 
@@ -311,7 +311,7 @@ int arm_svcall(int irq, void *context, void *arg)
            */
 
           regs[REG_PC]         = (uint32_t)regs[REG_R1] & ~1;  /* startup */
-          regs[REG_EXC_RETURN] = EXC_RETURN_THREAD;
+          regs[REG_EXC_RETURN] = EXC_RETURN_TODISPATCH(regs[REG_EXC_RETURN]);
 
           /* Return unprivileged mode */
 
@@ -356,7 +356,7 @@ int arm_svcall(int irq, void *context, void *arg)
            */
 
           regs[REG_PC]         = (uint32_t)USERSPACE->signal_handler & ~1;
-          regs[REG_EXC_RETURN] = EXC_RETURN_THREAD;
+          regs[REG_EXC_RETURN] = EXC_RETURN_TODISPATCH(regs[REG_EXC_RETURN]);
 
           /* Return unprivileged mode */
 
@@ -393,7 +393,7 @@ int arm_svcall(int irq, void *context, void *arg)
           DEBUGASSERT(rtcb->xcp.sigreturn != 0);
 
           regs[REG_PC]         = rtcb->xcp.sigreturn & ~1;
-          regs[REG_EXC_RETURN] = EXC_RETURN_THREAD;
+          regs[REG_EXC_RETURN] = EXC_RETURN_TODISPATCH(regs[REG_EXC_RETURN]);
 
           /* Return privileged mode */
 
@@ -432,7 +432,7 @@ int arm_svcall(int irq, void *context, void *arg)
           rtcb->xcp.nsyscalls  = index + 1;
 
           regs[REG_PC]         = (uint32_t)dispatch_syscall & ~1;
-          regs[REG_EXC_RETURN] = EXC_RETURN_THREAD;
+          regs[REG_EXC_RETURN] = EXC_RETURN_TODISPATCH(regs[REG_EXC_RETURN]);
 
           /* Return privileged mode */
 
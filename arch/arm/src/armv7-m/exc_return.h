@@ -78,7 +78,16 @@
 #define EXC_RETURN_HANDLER       0xfffffff1
 
 #ifdef CONFIG_ARCH_FPU
-#  define EXC_RETURN_FPU         0
+#  ifdef CONFIG_ARCH_LAZYFPU
+/* With lazy FPU state management, new contexts start with the standard
+ * frame; FPCCR.ASPEN activates the FP context when (and if) the task
+ * executes its first FP instruction.
+ */
+
+#    define EXC_RETURN_FPU       EXC_RETURN_STD_CONTEXT
+#  else
+#    define EXC_RETURN_FPU       0
+#  endif
 #else
 #  define EXC_RETURN_FPU         EXC_RETURN_STD_CONTEXT
 #endif
@@ -99,6 +108,23 @@
 #define EXC_RETURN_THREAD        (EXC_RETURN_BASE | EXC_RETURN_FPU | \
                                   EXC_RETURN_THREAD_MODE | EXC_RETURN_STACK)
 
+/* EXC_RETURN_TODISPATCH: The EXC_RETURN value to use when an existing
+ * exception context is redirected to a new thread mode target (syscall
+ * dispatch, signal trampolines).  With lazy FPU state management the
+ * hardware already stacked the frame of the live context in either the
+ * standard or the extended format, so the frame format bit of that
+ * context must be preserved; otherwise the exception return would
+ * unstack the wrong frame size.
+ */
+
+#ifdef CONFIG_ARCH_LAZYFPU
+#  define EXC_RETURN_TODISPATCH(cur) \
+     (((cur) & EXC_RETURN_STD_CONTEXT) | \
+      (EXC_RETURN_THREAD & ~EXC_RETURN_STD_CONTEXT))
+#else
+#  define EXC_RETURN_TODISPATCH(cur) EXC_RETURN_THREAD
+#endif
+
 /****************************************************************************
  * Inline Functions
  ****************************************************************************/
@@ -326,6 +326,9 @@ static bool stm32l4serial_dmaiflowrestart(struct stm32l4_serial_s *priv);
 #endif
 static void stm32l4serial_dmarxint(struct uart_dev_s *dev, bool enable);
 static bool stm32l4serial_dmarxavailable(struct uart_dev_s *dev);
+#if CONFIG_SERIAL_RXDMA_TIMEOUT > 0
+static void stm32l4serial_dmarxpoll(struct uart_dev_s *dev);
+#endif
 
 static void stm32l4serial_dmarxcallback(DMA_HANDLE handle, uint8_t status,
                                         void *arg);
@@ -376,6 +379,9 @@ static const struct uart_ops_s g_uart_dma_ops =
   .receive        = stm32l4serial_dmareceive,
   .rxint          = stm32l4serial_dmarxint,
   .rxavailable    = stm32l4serial_dmarxavailable,
+#if CONFIG_SERIAL_RXDMA_TIMEOUT > 0
+  .dmarxpoll      = stm32l4serial_dmarxpoll,
+#endif
 #ifdef CONFIG_SERIAL_IFLOWCONTROL
   .rxflowcontrol  = stm32l4serial_rxflowcontrol,
 #endif
@@ -2845,6 +2851,27 @@ static bool stm32l4serial_txready(struct uart_dev_s *dev)
            USART_ISR_TXE) != 0);
 }
 
+/****************************************************************************
+ * Name: stm32l4serial_dmarxpoll
+ *
+ * Description:
+ *   Called periodically by the serial upper half to flush bytes held in a
+ *   partially filled RX DMA buffer.
+ *
+ ****************************************************************************/
+
+#if defined(SERIAL_HAVE_RXDMA) && CONFIG_SERIAL_RXDMA_TIMEOUT > 0
+static void stm32l4serial_dmarxpoll(struct uart_dev_s *dev)
+{
+  struct stm32l4_serial_s *priv = (struct stm32l4_serial_s *)dev->priv;
+
+  if (priv->rxdma != NULL)
+    {
+      stm32l4serial_dmarxcallback(priv->rxdma, 0, priv);
+    }
+}
+#endif
+
 /****************************************************************************
  * Name: stm32l4serial_dmarxcallback
  *
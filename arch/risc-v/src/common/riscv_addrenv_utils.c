@@ -135,13 +135,17 @@ uintptr_t riscv_get_pgtable(arch_addrenv_t *addrenv, uintptr_t vaddr)
 int riscv_map_pages(arch_addrenv_t *addrenv, uintptr_t *pages,
                     unsigned int npages, uintptr_t vaddr, int prot)
 {
+  uintptr_t first = vaddr;
   uintptr_t ptlast;
   uintptr_t ptlevel;
   uintptr_t paddr;
 
   ptlevel =  RV_MMU_PT_LEVELS;
 
-  /* Add the references to pages[] into the caller's address environment */
+  /* Add the references to pages[] into the caller's address environment.
+   * All of the entries are written first and the TLB shootdown is issued
+   * once for the whole range rather than once per page.
+   */
 
   for (; npages > 0; npages--)
     {
@@ -156,7 +160,7 @@ int riscv_map_pages(arch_addrenv_t *addrenv, uintptr_t *pages,
       /* Then add the reference */
 
       paddr = *pages++;
-      mmu_ln_setentry(ptlevel, ptlast, paddr, vaddr, prot);
+      mmu_ln_setentry_noflush(ptlevel, ptlast, paddr, vaddr, prot);
       vaddr += MM_PGSIZE;
     }
 
@@ -164,6 +168,19 @@ int riscv_map_pages(arch_addrenv_t *addrenv, uintptr_t *pages,
 
   __DMB();
 
+  /* A single page is invalidated by address; a larger range is cheaper
+   * to handle with one full invalidation than with one fence per page.
+   */
+
+  if (vaddr - first == MM_PGSIZE)
+    {
+      mmu_invalidate_tlb_by_vaddr(first);
+    }
+  else
+    {
+      mmu_invalidate_tlbs();
+    }
+
   return OK;
 }
 
@@ -188,6 +205,7 @@ int riscv_map_pages(arch_addrenv_t *addrenv, uintptr_t *pages,
 int riscv_unmap_pages(arch_addrenv_t *addrenv, uintptr_t vaddr,
                       unsigned int npages)
 {
+  uintptr_t first = vaddr;
   uintptr_t ptlast;
   uintptr_t ptprev;
   uintptr_t ptlevel;
@@ -202,7 +220,10 @@ int riscv_unmap_pages(arch_addrenv_t *addrenv, uintptr_t vaddr,
       return -EFAULT;
     }
 
-  /* Remove the references from the caller's address environment */
+  /* Remove the references from the caller's address environment.  As in
+   * riscv_map_pages(), the entries are all wiped before one combined TLB
+   * shootdown is issued for the range.
+   */
 
   for (; npages > 0; npages--)
     {
@@ -217,7 +238,7 @@ int riscv_unmap_pages(arch_addrenv_t *addrenv, uintptr_t vaddr,
 
       /* Then wipe the reference */
 
-      mmu_ln_clear(ptlevel + 1, ptlast, vaddr);
+      mmu_ln_clear_noflush(ptlevel + 1, ptlast, vaddr);
       vaddr += MM_PGSIZE;
     }
 
@@ -225,6 +246,19 @@ int riscv_unmap_pages(arch_addrenv_t *addrenv, uintptr_t vaddr,
 
   __DMB();
 
+  /* A single page is invalidated by address; a larger range is cheaper
+   * to handle with one full invalidation than with one fence per page.
+   */
+
+  if (vaddr - first == MM_PGSIZE)
+    {
+      mmu_invalidate_tlb_by_vaddr(first);
+    }
+  else
+    {
+      mmu_invalidate_tlbs();
+    }
+
   return OK;
 }
 
@@ -59,8 +59,9 @@ static const size_t g_pgt_sizes[] =
  * Public Functions
  ****************************************************************************/
 
-void mmu_ln_setentry(uint32_t ptlevel, uintptr_t lnvaddr, uintptr_t paddr,
-                     uintptr_t vaddr, uint64_t mmuflags)
+void mmu_ln_setentry_noflush(uint32_t ptlevel, uintptr_t lnvaddr,
+                             uintptr_t paddr, uintptr_t vaddr,
+                             uint64_t mmuflags)
 {
   uintptr_t *lntable = (uintptr_t *)lnvaddr;
   uint32_t   index;
@@ -99,6 +100,12 @@ void mmu_ln_setentry(uint32_t ptlevel, uintptr_t lnvaddr, uintptr_t paddr,
   /* Save it */
 
   lntable[index] = (paddr | mmuflags);
+}
+
+void mmu_ln_setentry(uint32_t ptlevel, uintptr_t lnvaddr, uintptr_t paddr,
+                     uintptr_t vaddr, uint64_t mmuflags)
+{
+  mmu_ln_setentry_noflush(ptlevel, lnvaddr, paddr, vaddr, mmuflags);
 
   /* Update with memory by flushing the cache(s) */
 
@@ -118,8 +125,8 @@ uintptr_t mmu_ln_getentry(uint32_t ptlevel, uintptr_t lnvaddr,
   return lntable[index];
 }
 
-void mmu_ln_restore(uint32_t ptlevel, uintptr_t lnvaddr, uintptr_t vaddr,
-                    uintptr_t entry)
+void mmu_ln_restore_noflush(uint32_t ptlevel, uintptr_t lnvaddr,
+                            uintptr_t vaddr, uintptr_t entry)
 {
   uintptr_t *lntable = (uintptr_t *)lnvaddr;
   uint32_t  index;
@@ -129,6 +136,12 @@ void mmu_ln_restore(uint32_t ptlevel, uintptr_t lnvaddr, uintptr_t vaddr,
   index = (vaddr >> RV_MMU_VADDR_SHIFT(ptlevel)) & RV_MMU_VPN_MASK;
 
   lntable[index] = entry;
+}
+
+void mmu_ln_restore(uint32_t ptlevel, uintptr_t lnvaddr, uintptr_t vaddr,
+                    uintptr_t entry)
+{
+  mmu_ln_restore_noflush(ptlevel, lnvaddr, vaddr, entry);
 
   /* Update with memory by flushing the cache(s) */
 
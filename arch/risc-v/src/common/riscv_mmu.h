@@ -406,6 +406,24 @@ static inline uintptr_t mmu_get_satp_pgbase(void)
 void mmu_ln_setentry(uint32_t ptlevel, uintptr_t lnvaddr, uintptr_t paddr,
                      uintptr_t vaddr, uint64_t mmuflags);
 
+/****************************************************************************
+ * Name: mmu_ln_setentry_noflush
+ *
+ * Description:
+ *   Set a level n translation table entry without issuing the TLB
+ *   invalidation for it.  Intended for batched mapping operations where
+ *   the caller issues one combined TLB flush after all entries have been
+ *   written.
+ *
+ * Input Parameters:
+ *   As for mmu_ln_setentry.
+ *
+ ****************************************************************************/
+
+void mmu_ln_setentry_noflush(uint32_t ptlevel, uintptr_t lnvaddr,
+                             uintptr_t paddr, uintptr_t vaddr,
+                             uint64_t mmuflags);
+
 /****************************************************************************
  * Name: mmu_ln_getentry
  *
@@ -445,6 +463,23 @@ uintptr_t mmu_ln_getentry(uint32_t ptlevel, uintptr_t lnvaddr,
 void mmu_ln_restore(uint32_t ptlevel, uintptr_t lnvaddr, uintptr_t vaddr,
                     uintptr_t entry);
 
+/****************************************************************************
+ * Name: mmu_ln_restore_noflush
+ *
+ * Description:
+ *   Restore a level n translation table entry without issuing the TLB
+ *   invalidation for it.  Intended for batched unmapping operations where
+ *   the caller issues one combined TLB flush after all entries have been
+ *   written.
+ *
+ * Input Parameters:
+ *   As for mmu_ln_restore.
+ *
+ ****************************************************************************/
+
+void mmu_ln_restore_noflush(uint32_t ptlevel, uintptr_t lnvaddr,
+                            uintptr_t vaddr, uintptr_t entry);
+
 /****************************************************************************
  * Name: mmu_ln_clear
  *
@@ -464,6 +499,18 @@ void mmu_ln_restore(uint32_t ptlevel, uintptr_t lnvaddr, uintptr_t vaddr,
 #define mmu_ln_clear(ptlevel, lnvaddr, vaddr) \
   mmu_ln_restore(ptlevel, lnvaddr, vaddr, 0)
 
+/****************************************************************************
+ * Name: mmu_ln_clear_noflush
+ *
+ * Description:
+ *   Unmap a level n translation table entry without issuing the TLB
+ *   invalidation for it.  See mmu_ln_restore_noflush.
+ *
+ ****************************************************************************/
+
+#define mmu_ln_clear_noflush(ptlevel, lnvaddr, vaddr) \
+  mmu_ln_restore_noflush(ptlevel, lnvaddr, vaddr, 0)
+
 /****************************************************************************
  * Name: mmu_ln_map_region
  *
@@ -79,6 +79,6 @@ void up_perf_convert(unsigned long elapsed, struct timespec *ts)
 
   ts->tv_sec = elapsed / g_cycle_frequency;
   elapsed -= ts->tv_sec * g_cycle_frequency;
-  ts->tv_nsec = elapsed * (NSEC_PER_SEC / g_cycle_frequency);
+  ts->tv_nsec = NSEC_PER_SEC * (uint64_t)elapsed / g_cycle_frequency;
 }
 #endif
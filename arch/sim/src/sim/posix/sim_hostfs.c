@@ -26,6 +26,7 @@
 #include <sys/stat.h>
 #include <sys/statvfs.h>
 #include <sys/ioctl.h>
+#include <sys/mman.h>
 
 #include <dirent.h>
 #include <stdio.h>
@@ -399,6 +400,33 @@ int host_ftruncate(int fd, nuttx_off_t length)
   return ret;
 }
 
+/****************************************************************************
+ * Name: host_mmap
+ ****************************************************************************/
+
+void *host_mmap(int fd, nuttx_size_t length)
+{
+  /* Map the file read-only; NULL reports failure to the caller */
+
+  void *ret = mmap(NULL, length, PROT_READ, MAP_SHARED, fd, 0);
+  return ret == MAP_FAILED ? NULL : ret;
+}
+
+/****************************************************************************
+ * Name: host_munmap
+ ****************************************************************************/
+
+int host_munmap(void *addr, nuttx_size_t length)
+{
+  int ret = munmap(addr, length);
+  if (ret < 0)
+    {
+      ret = -errno;
+    }
+
+  return ret;
+}
+
 /****************************************************************************
  * Name: host_opendir
  ****************************************************************************/
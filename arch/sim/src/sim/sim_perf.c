@@ -0,0 +1,81 @@
+/****************************************************************************
+ * arch/sim/src/sim/sim_perf.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+#include <nuttx/clock.h>
+
+#include <stdint.h>
+#include <time.h>
+
+#include "sim_internal.h"
+
+#ifdef CONFIG_ARCH_PERF_EVENTS
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: up_perf_init
+ ****************************************************************************/
+
+void up_perf_init(void *arg)
+{
+}
+
+/****************************************************************************
+ * Name: up_perf_gettime
+ *
+ * Description:
+ *   Return the host monotonic clock in nanoseconds.  Unlike the tick
+ *   counter this is not quantized to the simulated timer interval, so
+ *   short intervals such as interrupt handler execution times can be
+ *   measured meaningfully on the simulator.
+ *
+ ****************************************************************************/
+
+unsigned long up_perf_gettime(void)
+{
+  return (unsigned long)host_gettime(false);
+}
+
+/****************************************************************************
+ * Name: up_perf_getfreq
+ ****************************************************************************/
+
+unsigned long up_perf_getfreq(void)
+{
+  return NSEC_PER_SEC;
+}
+
+/****************************************************************************
+ * Name: up_perf_convert
+ ****************************************************************************/
+
+void up_perf_convert(unsigned long elapsed, struct timespec *ts)
+{
+  ts->tv_sec  = elapsed / NSEC_PER_SEC;
+  ts->tv_nsec = elapsed % NSEC_PER_SEC;
+}
+#endif
@@ -287,6 +287,26 @@ int host_ftruncate(int fd, nuttx_off_t length)
   return -ENOSYS;
 }
 
+/****************************************************************************
+ * Name: host_mmap
+ ****************************************************************************/
+
+void *host_mmap(int fd, nuttx_size_t length)
+{
+  /* Not supported; the caller falls back to host_read() */
+
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: host_munmap
+ ****************************************************************************/
+
+int host_munmap(void *addr, nuttx_size_t length)
+{
+  return -ENOSYS;
+}
+
 /****************************************************************************
  * Name: host_opendir
  ****************************************************************************/
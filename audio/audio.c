@@ -581,6 +581,79 @@ static int audio_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
         }
         break;
 
+      /* AUDIOIOC_ENQUEUEFILE - Read a file extent directly into an audio
+       * buffer and enqueue it for playback ("audio sendfile").  The file
+       * data is read straight into the sample area of the buffer, so no
+       * intermediate application copy is made.
+       *
+       *   ioctl argument:  pointer to an audio_file_desc_s structure
+       */
+
+      case AUDIOIOC_ENQUEUEFILE:
+        {
+          FAR struct audio_file_desc_s *filedesc;
+          FAR struct ap_buffer_s *apb;
+          FAR struct file *srcfile;
+          ssize_t nread;
+
+          audinfo("AUDIOIOC_ENQUEUEFILE\n");
+
+          DEBUGASSERT(lower->ops->enqueuebuffer != NULL);
+
+          filedesc = (FAR struct audio_file_desc_s *)arg;
+          apb      = filedesc->buffer;
+
+          if (apb == NULL || filedesc->numbytes > apb->nmaxbytes)
+            {
+              ret = -EINVAL;
+              break;
+            }
+
+          ret = fs_getfilep(filedesc->fd, &srcfile);
+          if (ret < 0)
+            {
+              break;
+            }
+
+          if (filedesc->offset >= 0)
+            {
+              nread = file_pread(srcfile, apb->samp, filedesc->numbytes,
+                                 filedesc->offset);
+            }
+          else
+            {
+              nread = file_read(srcfile, apb->samp, filedesc->numbytes);
+            }
+
+          fs_putfilep(srcfile);
+
+          if (nread < 0)
+            {
+              ret = (int)nread;
+              break;
+            }
+
+          /* A short read means that the end of the file was reached; mark
+           * the buffer as the last one in the stream as an application
+           * doing the read itself would.
+           */
+
+          apb->nbytes  = nread;
+          apb->curbyte = 0;
+          apb->flags   = 0;
+          if ((apb_samp_t)nread < filedesc->numbytes)
+            {
+              apb->flags |= AUDIO_APB_FINAL;
+            }
+
+#ifdef CONFIG_AUDIO_MULTI_SESSION
+          apb->session = filedesc->session;
+#endif
+
+          ret = lower->ops->enqueuebuffer(lower, apb);
+        }
+        break;
+
       /* AUDIOIOC_REGISTERMQ - Register a client Message Queue
        *
        * TODO:  This needs to have multi session support.
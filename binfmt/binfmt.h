@@ -78,6 +78,55 @@ int binfmt_dumpmodule(FAR const struct binary_s *bin);
 #  define binfmt_dumpmodule(bin)
 #endif
 
+/****************************************************************************
+ * Name: binfmt_cache_find
+ *
+ * Description:
+ *   Look up a resident, idle image of the binary at 'filename'.  On a hit
+ *   the pristine data segment is restored, the slot is marked busy, and
+ *   the cached binary_s is returned ready for exec_module().
+ *
+ * Returned Value:
+ *   The cached binary on a hit; NULL if the binary is not cached or an
+ *   instance of it is still running.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_BINFMT_CACHE
+FAR struct binary_s *binfmt_cache_find(FAR const char *filename);
+#endif
+
+/****************************************************************************
+ * Name: binfmt_cache_add
+ *
+ * Description:
+ *   Offer a freshly loaded binary to the cache.  On any failure the binary
+ *   is simply not cached and its lifetime is unchanged.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_BINFMT_CACHE
+void binfmt_cache_add(FAR const char *filename, FAR struct binary_s *bin);
+#endif
+
+/****************************************************************************
+ * Name: binfmt_cache_release
+ *
+ * Description:
+ *   Mark the cache slot holding 'bin' idle so that the image can be reused
+ *   by the next spawn.  Called when an instance exits or fails to start.
+ *
+ * Returned Value:
+ *   True if the binary is cached.  The caller must then NOT unload or free
+ *   it; the cache owns it now.  False if the binary is not cached and the
+ *   caller remains responsible for it.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_BINFMT_CACHE
+bool binfmt_cache_release(FAR struct binary_s *bin);
+#endif
+
 /****************************************************************************
  * Name: binfmt_copyargv
  *
@@ -0,0 +1,252 @@
+/****************************************************************************
+ * binfmt/binfmt_cache.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <string.h>
+#include <debug.h>
+
+#include <nuttx/kmalloc.h>
+#include <nuttx/mutex.h>
+#include <nuttx/binfmt/binfmt.h>
+
+#include "binfmt.h"
+
+#ifdef CONFIG_BINFMT_CACHE
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* One resident binary image.  A slot is empty if filename is NULL.  While
+ * an instance of the binary is running the slot is busy and cannot be
+ * reused or evicted; when the instance exits the image stays resident and
+ * the next spawn only has to restore the pristine data segment.
+ */
+
+struct binfmt_cache_s
+{
+  FAR char *filename;        /* The path the binary was loaded from */
+  FAR struct binary_s *bin;  /* The loaded, relocated module */
+  FAR void *datasnap;        /* Pristine copy of the data/bss segment */
+  bool busy;                 /* True: An instance is currently running */
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct binfmt_cache_s g_bincache[CONFIG_BINFMT_CACHE_COUNT];
+static mutex_t g_bincache_lock = NXMUTEX_INITIALIZER;
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: binfmt_cache_find
+ *
+ * Description:
+ *   Look up a resident, idle image of the binary at 'filename'.  On a hit
+ *   the pristine data segment is restored, the slot is marked busy, and
+ *   the cached binary_s is returned ready for exec_module().
+ *
+ * Returned Value:
+ *   The cached binary on a hit; NULL if the binary is not cached or an
+ *   instance of it is still running.
+ *
+ ****************************************************************************/
+
+FAR struct binary_s *binfmt_cache_find(FAR const char *filename)
+{
+  FAR struct binfmt_cache_s *entry;
+  FAR struct binary_s *bin = NULL;
+  int i;
+
+  nxmutex_lock(&g_bincache_lock);
+  for (i = 0; i < CONFIG_BINFMT_CACHE_COUNT; i++)
+    {
+      entry = &g_bincache[i];
+      if (entry->filename != NULL && !entry->busy &&
+          strcmp(entry->filename, filename) == 0)
+        {
+          /* Re-instantiate the data segment from the pristine copy taken
+           * at load time.  This also re-zeroes .bss.
+           */
+
+          if (entry->bin->datalen > 0)
+            {
+              memcpy(entry->bin->dataptr, entry->datasnap,
+                     entry->bin->datalen);
+            }
+
+          entry->busy = true;
+          bin = entry->bin;
+          binfo("Reusing cached image of %s\n", filename);
+          break;
+        }
+    }
+
+  nxmutex_unlock(&g_bincache_lock);
+  return bin;
+}
+
+/****************************************************************************
+ * Name: binfmt_cache_add
+ *
+ * Description:
+ *   Offer a freshly loaded binary to the cache.  A pristine copy of the
+ *   data segment is taken so that later spawns can re-instantiate it.  On
+ *   any failure (loader did not mark the image cachable, no free slot, no
+ *   memory for the snapshot) the binary is simply not cached and its
+ *   lifetime is unchanged.
+ *
+ ****************************************************************************/
+
+void binfmt_cache_add(FAR const char *filename, FAR struct binary_s *bin)
+{
+  FAR struct binfmt_cache_s *entry = NULL;
+  FAR void *datasnap = NULL;
+  FAR char *name;
+  int i;
+
+  if (!bin->cachable)
+    {
+      return;
+    }
+
+  nxmutex_lock(&g_bincache_lock);
+
+  /* Find a free slot, checking for a duplicate of this path on the way.
+   * A duplicate can exist if the binary was spawned again while a cached
+   * instance was still running.
+   */
+
+  for (i = 0; i < CONFIG_BINFMT_CACHE_COUNT; i++)
+    {
+      if (g_bincache[i].filename == NULL)
+        {
+          if (entry == NULL)
+            {
+              entry = &g_bincache[i];
+            }
+        }
+      else if (strcmp(g_bincache[i].filename, filename) == 0)
+        {
+          goto out_with_lock;
+        }
+    }
+
+  /* No free slot?  Evict an idle image to make room */
+
+  if (entry == NULL)
+    {
+      for (i = 0; i < CONFIG_BINFMT_CACHE_COUNT; i++)
+        {
+          if (!g_bincache[i].busy)
+            {
+              entry = &g_bincache[i];
+              unload_module(entry->bin);
+              kmm_free(entry->bin);
+              kmm_free(entry->datasnap);
+              kmm_free(entry->filename);
+              entry->filename = NULL;
+              break;
+            }
+        }
+
+      if (entry == NULL)
+        {
+          goto out_with_lock;
+        }
+    }
+
+  /* Snapshot the pristine data segment */
+
+  if (bin->datalen > 0)
+    {
+      datasnap = kmm_malloc(bin->datalen);
+      if (datasnap == NULL)
+        {
+          goto out_with_lock;
+        }
+
+      memcpy(datasnap, bin->dataptr, bin->datalen);
+    }
+
+  name = kmm_malloc(strlen(filename) + 1);
+  if (name == NULL)
+    {
+      kmm_free(datasnap);
+      goto out_with_lock;
+    }
+
+  strcpy(name, filename);
+
+  entry->filename = name;
+  entry->bin      = bin;
+  entry->datasnap = datasnap;
+  entry->busy     = true;
+
+out_with_lock:
+  nxmutex_unlock(&g_bincache_lock);
+}
+
+/****************************************************************************
+ * Name: binfmt_cache_release
+ *
+ * Description:
+ *   Mark the cache slot holding 'bin' idle so that the image can be reused
+ *   by the next spawn.  Called when an instance exits or fails to start.
+ *
+ * Returned Value:
+ *   True if the binary is cached.  The caller must then NOT unload or free
+ *   it; the cache owns it now.  False if the binary is not cached and the
+ *   caller remains responsible for it.
+ *
+ ****************************************************************************/
+
+bool binfmt_cache_release(FAR struct binary_s *bin)
+{
+  bool cached = false;
+  int i;
+
+  nxmutex_lock(&g_bincache_lock);
+  for (i = 0; i < CONFIG_BINFMT_CACHE_COUNT; i++)
+    {
+      if (g_bincache[i].filename != NULL && g_bincache[i].bin == bin)
+        {
+          g_bincache[i].busy = false;
+          cached = true;
+          break;
+        }
+    }
+
+  nxmutex_unlock(&g_bincache_lock);
+  return cached;
+}
+
+#endif /* CONFIG_BINFMT_CACHE */
@@ -85,23 +85,37 @@ static int exec_internal(FAR const char *filename,
   int pid;
   int ret;
 
-  /* Allocate the load information */
+#ifdef CONFIG_BINFMT_CACHE
+  /* Reuse a resident image of this binary if one is idle in the cache */
 
-  bin = kmm_zalloc(sizeof(struct binary_s));
-  if (!bin)
+  bin = binfmt_cache_find(filename);
+  if (bin == NULL)
+#endif
     {
-      berr("ERROR: Failed to allocate binary_s\n");
-      ret = -ENOMEM;
-      goto errout;
-    }
+      /* Allocate the load information */
 
-  /* Load the module into memory */
+      bin = kmm_zalloc(sizeof(struct binary_s));
+      if (!bin)
+        {
+          berr("ERROR: Failed to allocate binary_s\n");
+          ret = -ENOMEM;
+          goto errout;
+        }
 
-  ret = load_module(bin, filename, exports, nexports);
-  if (ret < 0)
-    {
-      berr("ERROR: Failed to load program '%s': %d\n", filename, ret);
-      goto errout_with_bin;
+      /* Load the module into memory */
+
+      ret = load_module(bin, filename, exports, nexports);
+      if (ret < 0)
+        {
+          berr("ERROR: Failed to load program '%s': %d\n", filename, ret);
+          goto errout_with_bin;
+        }
+
+#ifdef CONFIG_BINFMT_CACHE
+      /* Keep the relocated image resident for later spawns */
+
+      binfmt_cache_add(filename, bin);
+#endif
     }
 
   /* Update the spawn attribute */
@@ -172,6 +186,18 @@ static int exec_internal(FAR const char *filename,
 errout_with_lock:
   sched_unlock();
   leave_critical_section(flags);
+
+#ifdef CONFIG_BINFMT_CACHE
+  /* If the image is cached, it stays resident for the next spawn attempt
+   * and must not be unloaded or freed here.
+   */
+
+  if (binfmt_cache_release(bin))
+    {
+      goto errout;
+    }
+#endif
+
   unload_module(bin);
 errout_with_bin:
   kmm_free(bin);
@@ -66,6 +66,17 @@ int binfmt_exit(FAR struct binary_s *bin)
 
   DEBUGASSERT(bin != NULL);
 
+#ifdef CONFIG_BINFMT_CACHE
+  /* If the image is cached, keep it resident for the next spawn instead
+   * of unloading it.  The cache now owns the binary.
+   */
+
+  if (binfmt_cache_release(bin))
+    {
+      return OK;
+    }
+#endif
+
   /* Unload the module */
 
   ret = unload_module(bin);
@@ -335,6 +335,16 @@ static int elf_loadbinary(FAR struct binary_s *binp,
 
   binp->alloc[0] = (FAR void *)loadinfo.textalloc;
   binp->alloc[1] = (FAR void *)loadinfo.dataalloc;
+
+#  ifdef CONFIG_BINFMT_CACHE
+  /* A relocated ET_REL image may be kept resident and re-spawned by
+   * restoring the data segment; record where it is.
+   */
+
+  binp->dataptr  = (FAR void *)loadinfo.dataalloc;
+  binp->datalen  = loadinfo.datasize;
+  binp->cachable = (loadinfo.ehdr.e_type == ET_REL);
+#  endif
 #  ifdef CONFIG_BINFMT_CONSTRUCTORS
   binp->alloc[2] = loadinfo.ctoralloc;
   binp->alloc[3] = loadinfo.dtoralloc;
@@ -148,6 +148,35 @@ int elf_findsymtab(FAR struct elf_loadinfo_s *loadinfo);
 int elf_readsym(FAR struct elf_loadinfo_s *loadinfo, int index,
                 FAR Elf_Sym *sym);
 
+/****************************************************************************
+ * Name: elf_loadsymtab
+ *
+ * Description:
+ *   Read the entire symbol table and its string table into memory with two
+ *   bulk reads so that binding does not perform one small read per symbol
+ *   and per name.  On failure, elf_readsym() and elf_symname() fall back
+ *   to reading from the file.  elf_findsymtab() must have been called
+ *   first.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_ELF_SYMTAB_BUFFERED
+void elf_loadsymtab(FAR struct elf_loadinfo_s *loadinfo);
+#endif
+
+/****************************************************************************
+ * Name: elf_freesymtab
+ *
+ * Description:
+ *   Release the buffered symbol and string tables allocated by
+ *   elf_loadsymtab().
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_ELF_SYMTAB_BUFFERED
+void elf_freesymtab(FAR struct elf_loadinfo_s *loadinfo);
+#endif
+
 /****************************************************************************
  * Name: elf_symvalue
  *
@@ -605,6 +605,12 @@ int elf_bind(FAR struct elf_loadinfo_s *loadinfo,
     }
 #endif
 
+#ifdef CONFIG_ELF_SYMTAB_BUFFERED
+  /* Buffer the symbol and string tables to avoid per-symbol file reads */
+
+  elf_loadsymtab(loadinfo);
+#endif
+
   /* Process relocations in every allocated section */
 
   for (i = 1; i < loadinfo->ehdr.e_shnum; i++)
@@ -697,6 +703,10 @@ int elf_bind(FAR struct elf_loadinfo_s *loadinfo,
     }
 #  endif
 
+#endif
+
+#ifdef CONFIG_ELF_SYMTAB_BUFFERED
+  elf_freesymtab(loadinfo);
 #endif
 
   return ret;
@@ -40,6 +40,7 @@
 #include <nuttx/arch.h>
 #include <nuttx/addrenv.h>
 #include <nuttx/elf.h>
+#include <nuttx/fs/ioctl.h>
 #include <nuttx/binfmt/elf.h>
 
 #include "libelf.h"
@@ -127,6 +128,55 @@ static int elf_section_alloc(FAR struct elf_loadinfo_s *loadinfo,
 }
 #endif
 
+#ifdef CONFIG_ELF_XIP
+/****************************************************************************
+ * Name: elf_section_xip
+ *
+ * Description:
+ *   Check if a section can be executed directly from the file image:  The
+ *   file must reside on directly addressable storage, the section must be
+ *   read-only with file backing, it must fall on its required alignment
+ *   within the image, and no relocations may patch it after loading.
+ *
+ * Returned Value:
+ *   True if the section can be used in place without copying.
+ *
+ ****************************************************************************/
+
+static bool elf_section_xip(FAR struct elf_loadinfo_s *loadinfo, int idx)
+{
+  FAR Elf_Shdr *shdr = &loadinfo->shdr[idx];
+  uintptr_t addr;
+  int i;
+
+  if (loadinfo->xipbase == 0 ||
+      (shdr->sh_flags & SHF_WRITE) != 0 ||
+      shdr->sh_type == SHT_NOBITS)
+    {
+      return false;
+    }
+
+  addr = loadinfo->xipbase + shdr->sh_offset;
+  if (shdr->sh_addralign > 1 && (addr % shdr->sh_addralign) != 0)
+    {
+      return false;
+    }
+
+  for (i = 0; i < loadinfo->ehdr.e_shnum; i++)
+    {
+      FAR Elf_Shdr *rel = &loadinfo->shdr[i];
+
+      if ((rel->sh_type == SHT_REL || rel->sh_type == SHT_RELA) &&
+          rel->sh_info == idx && rel->sh_size > 0)
+        {
+          return false;
+        }
+    }
+
+  return true;
+}
+#endif
+
 /****************************************************************************
  * Name: elf_elfsize
  *
@@ -157,6 +207,15 @@ static void elf_elfsize(FAR struct elf_loadinfo_s *loadinfo)
 
       if ((shdr->sh_flags & SHF_ALLOC) != 0)
         {
+#ifdef CONFIG_ELF_XIP
+          /* Sections used in place need no allocation at all */
+
+          if (elf_section_xip(loadinfo, i))
+            {
+              continue;
+            }
+#endif
+
           /* SHF_WRITE indicates that the section address space is write-
            * able
            */
@@ -307,6 +366,17 @@ static inline int elf_loadfile(FAR struct elf_loadinfo_s *loadinfo)
           continue;
         }
 
+#ifdef CONFIG_ELF_XIP
+      /* Execute/read the section directly from the file image */
+
+      if (elf_section_xip(loadinfo, i))
+        {
+          shdr->sh_addr = loadinfo->xipbase + shdr->sh_offset;
+          binfo("%d. %08lx (XIP)\n", i, (unsigned long)shdr->sh_addr);
+          continue;
+        }
+#endif
+
       if (*pptr == NULL)
         {
           if (shdr->sh_type != SHT_NOBITS)
@@ -457,6 +527,20 @@ int elf_load(FAR struct elf_loadinfo_s *loadinfo)
       goto errout_with_buffers;
     }
 
+#ifdef CONFIG_ELF_XIP
+  /* If the file resides on directly addressable storage, read-only
+   * sections can be used in place rather than copied.  File systems
+   * whose file data is not stably addressable fail the ioctl and
+   * everything takes the copying path.
+   */
+
+  if (file_ioctl(&loadinfo->file, FIOC_XIPBASE,
+                 (unsigned long)&loadinfo->xipbase) < 0)
+    {
+      loadinfo->xipbase = 0;
+    }
+#endif
+
   /* Determine total size to allocate */
 
   elf_elfsize(loadinfo);
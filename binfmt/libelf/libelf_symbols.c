@@ -33,6 +33,7 @@
 #include <debug.h>
 
 #include <nuttx/binfmt/elf.h>
+#include <nuttx/kmalloc.h>
 #include <nuttx/symtab.h>
 
 #include "libelf.h"
@@ -93,6 +94,46 @@ static int elf_symname(FAR struct elf_loadinfo_s *loadinfo,
       return ret;
     }
 
+#ifdef CONFIG_ELF_SYMTAB_BUFFERED
+  if (loadinfo->strtab != NULL)
+    {
+      /* The whole string table is in memory.  Just copy the name into the
+       * I/O buffer.
+       */
+
+      FAR const char *name;
+      size_t namelen;
+
+      if (sym->st_name >= loadinfo->strtablen)
+        {
+          berr("Symbol name offset out of range\n");
+          return -EINVAL;
+        }
+
+      name    = &loadinfo->strtab[sym->st_name];
+      namelen = strnlen(name, loadinfo->strtablen - sym->st_name);
+      if (namelen >= loadinfo->strtablen - sym->st_name)
+        {
+          berr("Unterminated symbol name\n");
+          return -EINVAL;
+        }
+
+      if (loadinfo->buflen < namelen + 1)
+        {
+          ret = elf_reallocbuffer(loadinfo,
+                                  namelen + 1 - loadinfo->buflen);
+          if (ret < 0)
+            {
+              berr("elf_reallocbuffer failed: %d\n", ret);
+              return ret;
+            }
+        }
+
+      memcpy(loadinfo->iobuffer, name, namelen + 1);
+      return OK;
+    }
+#endif
+
   offset = loadinfo->shdr[loadinfo->strtabidx].sh_offset + sym->st_name;
 
   /* Loop until we get the entire symbol name into memory */
@@ -224,6 +265,16 @@ int elf_readsym(FAR struct elf_loadinfo_s *loadinfo, int index,
       return -EINVAL;
     }
 
+#ifdef CONFIG_ELF_SYMTAB_BUFFERED
+  /* Use the buffered symbol table if it was successfully read */
+
+  if (loadinfo->symtab != NULL)
+    {
+      memcpy(sym, &loadinfo->symtab[index], sizeof(Elf_Sym));
+      return OK;
+    }
+#endif
+
   /* Get the file offset to the symbol table entry */
 
   offset = symtab->sh_offset + sizeof(Elf_Sym) * index;
@@ -233,6 +284,82 @@ int elf_readsym(FAR struct elf_loadinfo_s *loadinfo, int index,
   return elf_read(loadinfo, (FAR uint8_t *)sym, sizeof(Elf_Sym), offset);
 }
 
+#ifdef CONFIG_ELF_SYMTAB_BUFFERED
+/****************************************************************************
+ * Name: elf_loadsymtab
+ *
+ * Description:
+ *   Read the entire symbol table and its string table into memory with two
+ *   bulk reads so that binding does not perform one small read per symbol
+ *   and per name.  A failure only logs a warning:  If either table cannot
+ *   be buffered, elf_readsym() and elf_symname() fall back to reading from
+ *   the file.  elf_findsymtab() must have been called first.
+ *
+ ****************************************************************************/
+
+void elf_loadsymtab(FAR struct elf_loadinfo_s *loadinfo)
+{
+  FAR Elf_Shdr *symtab = &loadinfo->shdr[loadinfo->symtabidx];
+  FAR Elf_Shdr *strtab = &loadinfo->shdr[loadinfo->strtabidx];
+  int ret;
+
+  loadinfo->symtab = kmm_malloc(symtab->sh_size);
+  if (loadinfo->symtab != NULL)
+    {
+      ret = elf_read(loadinfo, (FAR uint8_t *)loadinfo->symtab,
+                     symtab->sh_size, symtab->sh_offset);
+      if (ret < 0)
+        {
+          bwarn("Failed to buffer symbol table: %d\n", ret);
+          kmm_free(loadinfo->symtab);
+          loadinfo->symtab = NULL;
+        }
+    }
+
+  loadinfo->strtab = kmm_malloc(strtab->sh_size);
+  if (loadinfo->strtab != NULL)
+    {
+      ret = elf_read(loadinfo, (FAR uint8_t *)loadinfo->strtab,
+                     strtab->sh_size, strtab->sh_offset);
+      if (ret < 0)
+        {
+          bwarn("Failed to buffer string table: %d\n", ret);
+          kmm_free(loadinfo->strtab);
+          loadinfo->strtab = NULL;
+        }
+      else
+        {
+          loadinfo->strtablen = strtab->sh_size;
+        }
+    }
+}
+
+/****************************************************************************
+ * Name: elf_freesymtab
+ *
+ * Description:
+ *   Release the buffered symbol and string tables allocated by
+ *   elf_loadsymtab().
+ *
+ ****************************************************************************/
+
+void elf_freesymtab(FAR struct elf_loadinfo_s *loadinfo)
+{
+  if (loadinfo->symtab != NULL)
+    {
+      kmm_free(loadinfo->symtab);
+      loadinfo->symtab = NULL;
+    }
+
+  if (loadinfo->strtab != NULL)
+    {
+      kmm_free(loadinfo->strtab);
+      loadinfo->strtab = NULL;
+      loadinfo->strtablen = 0;
+    }
+}
+#endif /* CONFIG_ELF_SYMTAB_BUFFERED */
+
 /****************************************************************************
  * Name: elf_symvalue
  *
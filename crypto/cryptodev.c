@@ -366,6 +366,37 @@ bail:
 
         error = cryptodev_op(cse, cop);
         break;
+      case CIOCCRYPTM:
+        {
+          FAR struct crypt_mop *mop = (FAR struct crypt_mop *)arg;
+          size_t n;
+
+          /* Perform the batched operations back to back.  The session is
+           * looked up per operation, so a single batch may mix sessions.
+           */
+
+          for (n = 0; n < mop->count; n++)
+            {
+              cop = &mop->ops[n];
+              cse = csefind(fcr, cop->ses);
+              if (cse == NULL)
+                {
+                  error = -EINVAL;
+                  break;
+                }
+
+              error = cryptodev_op(cse, cop);
+              if (error != 0)
+                {
+                  break;
+                }
+            }
+
+          /* Tell the caller how many operations completed */
+
+          mop->count = n;
+        }
+        break;
       case CIOCKEY:
         error = cryptodev_key(fcr, (FAR struct crypt_kop *)arg);
         break;
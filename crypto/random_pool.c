@@ -32,6 +32,8 @@
 #include <assert.h>
 #include <errno.h>
 
+#include <nuttx/arch.h>
+#include <nuttx/irq.h>
 #include <nuttx/random.h>
 #include <nuttx/board.h>
 #include <nuttx/clock.h>
@@ -82,6 +84,19 @@ enum
   MAX_SEED_NEW_ENTROPY_WORDS = 1024
 };
 
+#ifdef CONFIG_CRYPTO_RANDOM_POOL_PERCPU
+/* A small per-CPU cache of output from the main generator.  Bytes are
+ * consumed from the end of buf and wiped as they are handed out.
+ */
+
+struct fast_pool_s
+{
+  uint8_t buf[CONFIG_CRYPTO_RANDOM_POOL_PERCPU_SIZE];
+  size_t avail;    /* Unconsumed bytes at the end of buf */
+  clock_t reseed;  /* Time of the last refill */
+};
+#endif
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -102,6 +117,10 @@ static struct rng_s g_rng =
 static struct entropy_pool_s entropy_pool;
 #endif
 
+#ifdef CONFIG_CRYPTO_RANDOM_POOL_PERCPU
+static struct fast_pool_s g_fast_pool[CONFIG_SMP_NCPUS];
+#endif
+
 /* Polynomial from paper "The Linux Pseudorandom Number Generator Revisited"
  * x^POOL_SIZE + x^104 + x^76 + x^51 + x^25 + x + 1
  */
@@ -357,6 +376,68 @@ static void rng_buf_internal(FAR uint8_t *bytes, size_t nbytes)
     }
 }
 
+#ifdef CONFIG_CRYPTO_RANDOM_POOL_PERCPU
+/****************************************************************************
+ * Name: rng_fast_buf
+ *
+ * Description:
+ *   Serve a small request from the per-CPU fast pool.  In the steady state
+ *   this only disables local interrupts (the pool is private to the CPU),
+ *   so concurrent readers on different CPUs do not contend on the global
+ *   RNG lock.  The pool is refilled from the locked main generator when it
+ *   runs empty or when the reseed interval has expired.
+ *
+ * Input Parameters:
+ *   bytes  - Buffer for returned random bytes
+ *   nbytes - Number of bytes requested, at most the fast pool size
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+static void rng_fast_buf(FAR uint8_t *bytes, size_t nbytes)
+{
+  uint8_t tmp[CONFIG_CRYPTO_RANDOM_POOL_PERCPU_SIZE];
+  FAR struct fast_pool_s *fp;
+  irqstate_t flags;
+
+  flags = up_irq_save();
+  fp = &g_fast_pool[up_cpu_index()];
+
+  if (fp->avail < nbytes || clock_systime_ticks() - fp->reseed >
+      SEC2TICK(CONFIG_CRYPTO_RANDOM_POOL_PERCPU_INTERVAL))
+    {
+      /* The refill must take the RNG lock and so cannot run with
+       * interrupts disabled.  Generate into a stack buffer, then
+       * re-resolve the CPU (we may have migrated) and install it.
+       */
+
+      up_irq_restore(flags);
+
+      nxmutex_lock(&g_rng.rd_lock);
+      rng_buf_internal(tmp, sizeof(tmp));
+      nxmutex_unlock(&g_rng.rd_lock);
+
+      flags = up_irq_save();
+      fp = &g_fast_pool[up_cpu_index()];
+      memcpy(fp->buf, tmp, sizeof(fp->buf));
+      fp->avail = sizeof(fp->buf);
+      fp->reseed = clock_systime_ticks();
+      explicit_bzero(tmp, sizeof(tmp));
+    }
+
+  /* Hand out bytes from the end of the pool and wipe them so that a
+   * later compromise of the pool cannot reveal past outputs.
+   */
+
+  fp->avail -= nbytes;
+  memcpy(bytes, &fp->buf[fp->avail], nbytes);
+  explicit_bzero(&fp->buf[fp->avail], nbytes);
+  up_irq_restore(flags);
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -529,6 +610,14 @@ void up_randompool_initialize(void)
 
 void arc4random_buf(FAR void *bytes, size_t nbytes)
 {
+#ifdef CONFIG_CRYPTO_RANDOM_POOL_PERCPU
+  if (nbytes <= CONFIG_CRYPTO_RANDOM_POOL_PERCPU_SIZE)
+    {
+      rng_fast_buf(bytes, nbytes);
+      return;
+    }
+#endif
+
   nxmutex_lock(&g_rng.rd_lock);
   rng_buf_internal(bytes, nbytes);
   nxmutex_unlock(&g_rng.rd_lock);
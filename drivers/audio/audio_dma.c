@@ -396,13 +396,12 @@ static int audio_dma_allocbuffer(struct audio_lowerhalf_s *dev,
   /* Populate the buffer contents */
 
   apb->i.channels = 2;
-  apb->crefs      = 1;
   apb->nmaxbytes  = audio_dma->buffer_size;
   apb->samp = audio_dma->alloc_addr +
               audio_dma->alloc_index *
               audio_dma->buffer_size;
   audio_dma->alloc_index++;
-  nxmutex_init(&apb->lock);
+  atomic_store(&apb->crefs, 1);
 
   return sizeof(struct audio_buf_desc_s);
 }
@@ -415,7 +414,6 @@ static int audio_dma_freebuffer(struct audio_lowerhalf_s *dev,
 
   apb = bufdesc->u.buffer;
   audio_dma->alloc_index--;
-  nxmutex_destroy(&apb->lock);
   kumm_free(apb);
 
   if (audio_dma->alloc_index == 0)
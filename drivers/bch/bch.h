@@ -49,13 +49,18 @@ struct bchlib_s
   FAR struct inode *inode; /* I-node of the block driver */
   uint32_t sectsize;       /* The size of one sector on the device */
   size_t nsectors;         /* Number of sectors supported by the device */
-  size_t sector;           /* The current sector in the buffer */
+  size_t sector;           /* The first sector in the buffer */
+  size_t nextsector;       /* Next sector of a sequential read stream */
   mutex_t lock;            /* For atomic accesses to this structure */
+  uint16_t bufsectors;     /* The size of the buffer in sectors */
+  uint16_t nbuffered;      /* Number of valid sectors in the buffer */
+  uint16_t dirtystart;     /* Index of the first dirty buffered sector */
+  uint16_t dirtyend;       /* Index of the last dirty sector, plus one */
   uint8_t refs;            /* Number of references */
   bool dirty;              /* true: Data has been written to the buffer */
   bool readonly;           /* true: Only read operations are supported */
   bool unlinked;           /* true: The driver has been unlinked */
-  FAR uint8_t *buffer;     /* One sector buffer */
+  FAR uint8_t *buffer;     /* Buffer of bufsectors sectors */
 
 #if defined(CONFIG_BCH_ENCRYPTION)
   uint8_t key[CONFIG_BCH_ENCRYPTION_KEY_SIZE];  /* Encryption key */
@@ -60,29 +60,38 @@ static void bch_xor(uint32_t *R, uint32_t *A, uint32_t *B)
  ****************************************************************************/
 
 #if defined(CONFIG_BCH_ENCRYPTION)
-static int bch_cypher(FAR struct bchlib_s *bch, int encrypt)
+static int bch_cypher(FAR struct bchlib_s *bch, int encrypt,
+                      size_t start, size_t nsectors)
 {
   int blocks = bch->sectsize / 16;
-  FAR uint32_t *buffer = (FAR uint32_t *)bch->buffer;
-  int i;
+  size_t s;
 
-  for (i = 0; i < blocks; i++, buffer += 16 / sizeof(uint32_t) )
+  for (s = start; s < start + nsectors; s++)
     {
-      uint32_t T[4];
-      uint32_t X[4] =
-      {
-        bch->sector, 0, 0, i
-      };
+      FAR uint32_t *buffer =
+        (FAR uint32_t *)&bch->buffer[s * bch->sectsize];
+      int i;
 
-      aes_cypher(X, X, 16, NULL, bch->key, CONFIG_BCH_ENCRYPTION_KEY_SIZE,
-                 AES_MODE_ECB, CYPHER_ENCRYPT);
-
-      /* Xor-Encrypt-Xor */
-
-      bch_xor(T, X, buffer);
-      aes_cypher(T, T, 16, NULL, bch->key, CONFIG_BCH_ENCRYPTION_KEY_SIZE,
-                 AES_MODE_ECB, encrypt);
-      bch_xor(buffer, X, T);
+      for (i = 0; i < blocks; i++, buffer += 16 / sizeof(uint32_t) )
+        {
+          uint32_t T[4];
+          uint32_t X[4] =
+          {
+            bch->sector + s, 0, 0, i
+          };
+
+          aes_cypher(X, X, 16, NULL, bch->key,
+                     CONFIG_BCH_ENCRYPTION_KEY_SIZE,
+                     AES_MODE_ECB, CYPHER_ENCRYPT);
+
+          /* Xor-Encrypt-Xor */
+
+          bch_xor(T, X, buffer);
+          aes_cypher(T, T, 16, NULL, bch->key,
+                     CONFIG_BCH_ENCRYPTION_KEY_SIZE,
+                     AES_MODE_ECB, encrypt);
+          bch_xor(buffer, X, T);
+        }
     }
 
   return OK;
@@ -107,25 +116,30 @@ static int bch_cypher(FAR struct bchlib_s *bch, int encrypt)
 int bchlib_flushsector(FAR struct bchlib_s *bch, bool discard)
 {
   FAR struct inode *inode;
+  size_t nsectors;
   ssize_t ret = OK;
 
-  /* Check if the sector has been modified and is out of synch with the
-   * media.
+  /* Check if any buffered sector has been modified and is out of synch
+   * with the media.
    */
 
   if (bch->dirty && bch->buffer != NULL)
     {
-      inode = bch->inode;
+      inode    = bch->inode;
+      nsectors = bch->dirtyend - bch->dirtystart;
 
 #if defined(CONFIG_BCH_ENCRYPTION)
       /* Encrypt data as necessary */
 
-      bch_cypher(bch, CYPHER_ENCRYPT);
+      bch_cypher(bch, CYPHER_ENCRYPT, bch->dirtystart, nsectors);
 #endif
 
-      /* Write the sector to the media */
+      /* Write all of the dirty sectors to the media in one transfer */
 
-      ret = inode->u.i_bops->write(inode, bch->buffer, bch->sector, 1);
+      ret = inode->u.i_bops->write(inode,
+                                   &bch->buffer[bch->dirtystart *
+                                                bch->sectsize],
+                                   bch->sector + bch->dirtystart, nsectors);
       if (ret < 0)
         {
           ferr("Write failed: %zd\n", ret);
@@ -137,17 +151,20 @@ int bchlib_flushsector(FAR struct bchlib_s *bch, bool discard)
        * TODO: Add configuration switch for extra sector buffer
        */
 
-      bch_cypher(bch, CYPHER_DECRYPT);
+      bch_cypher(bch, CYPHER_DECRYPT, bch->dirtystart, nsectors);
 #endif
 
-      /* The sector is now in sync with the media */
+      /* The buffer is now in sync with the media */
 
-      bch->dirty = false;
+      bch->dirty      = false;
+      bch->dirtystart = 0;
+      bch->dirtyend   = 0;
     }
 
   if (discard)
     {
-      bch->sector = (size_t)-1;
+      bch->sector    = (size_t)-1;
+      bch->nbuffered = 0;
     }
 
   return (int)ret;
@@ -157,7 +174,8 @@ int bchlib_flushsector(FAR struct bchlib_s *bch, bool discard)
  * Name: bchlib_readsector
  *
  * Description:
- *   Read the current sector contents into buffer
+ *   Assure that the requested sector is in the sector buffer, reading
+ *   ahead additional sectors if the access appears to be sequential.
  *
  * Assumptions:
  *   Caller must assume mutual exclusion
@@ -167,14 +185,16 @@ int bchlib_flushsector(FAR struct bchlib_s *bch, bool discard)
 int bchlib_readsector(FAR struct bchlib_s *bch, size_t sector)
 {
   FAR struct inode *inode;
+  size_t nsectors;
   ssize_t ret = OK;
 
   if (bch->buffer == NULL)
     {
 #if CONFIG_BCH_BUFFER_ALIGNMENT != 0
-      bch->buffer = kmm_memalign(CONFIG_BCH_BUFFER_ALIGNMENT, bch->sectsize);
+      bch->buffer = kmm_memalign(CONFIG_BCH_BUFFER_ALIGNMENT,
+                                 (size_t)bch->bufsectors * bch->sectsize);
 #else
-      bch->buffer = kmm_malloc(bch->sectsize);
+      bch->buffer = kmm_malloc((size_t)bch->bufsectors * bch->sectsize);
 #endif
       if (bch->buffer == NULL)
         {
@@ -183,7 +203,7 @@ int bchlib_readsector(FAR struct bchlib_s *bch, size_t sector)
         }
     }
 
-  if (bch->sector != sector)
+  if (sector < bch->sector || sector >= bch->sector + bch->nbuffered)
     {
       inode = bch->inode;
 
@@ -194,16 +214,32 @@ int bchlib_readsector(FAR struct bchlib_s *bch, size_t sector)
           return (int)ret;
         }
 
-      ret = inode->u.i_bops->read(inode, bch->buffer, sector, 1);
+      /* If this miss continues a sequential stream, then read ahead up to
+       * a full buffer of sectors in a single transfer.
+       */
+
+      nsectors = 1;
+      if (bch->bufsectors > 1 && sector == bch->nextsector)
+        {
+          nsectors = bch->bufsectors;
+          if (sector + nsectors > bch->nsectors)
+            {
+              nsectors = bch->nsectors - sector;
+            }
+        }
+
+      ret = inode->u.i_bops->read(inode, bch->buffer, sector, nsectors);
       if (ret < 0)
         {
           ferr("Read failed: %zd\n", ret);
           return (int)ret;
         }
 
-      bch->sector = sector;
+      bch->sector     = sector;
+      bch->nbuffered  = nsectors;
+      bch->nextsector = sector + nsectors;
 #if defined(CONFIG_BCH_ENCRYPTION)
-      bch_cypher(bch, CYPHER_DECRYPT);
+      bch_cypher(bch, CYPHER_DECRYPT, 0, nsectors);
 #endif
     }
 
@@ -118,7 +118,10 @@ ssize_t bchlib_read(FAR void *handle, FAR char *buffer, off_t offset,
           nbytes = len;
         }
 
-      memcpy(buffer, &bch->buffer[sectoffset], nbytes);
+      memcpy(buffer,
+             &bch->buffer[(sector - bch->sector) * bch->sectsize +
+                          sectoffset],
+             nbytes);
 
       /* Adjust pointers and counts */
 
@@ -146,6 +149,21 @@ ssize_t bchlib_read(FAR void *handle, FAR char *buffer, off_t offset,
           nsectors = bch->nsectors - sector;
         }
 
+      /* If buffered sectors within the read range are dirty, flush them
+       * to the media first so that the direct read returns current data.
+       */
+
+      if (bch->dirty && sector < bch->sector + bch->nbuffered &&
+          bch->sector < sector + nsectors)
+        {
+          ret = bchlib_flushsector(bch, false);
+          if (ret < 0)
+            {
+              ferr("ERROR: Flush failed: %d\n", ret);
+              return ret;
+            }
+        }
+
       ret = bch->inode->u.i_bops->read(bch->inode, (FAR uint8_t *)buffer,
                                        sector, nsectors);
       if (ret < 0)
@@ -183,7 +201,8 @@ ssize_t bchlib_read(FAR void *handle, FAR char *buffer, off_t offset,
 
       /* Copy the head end of the sector to the user buffer */
 
-      memcpy(buffer, bch->buffer, len);
+      memcpy(buffer,
+             &bch->buffer[(sector - bch->sector) * bch->sectsize], len);
 
       /* Adjust counts */
 
@@ -110,6 +110,19 @@ int bchlib_setup(FAR const char *blkdev, bool readonly, FAR void **handle)
   bch->sectsize = geo.geo_sectorsize;
   bch->sector   = (size_t)-1;
   bch->readonly = readonly;
+
+  /* Size the sector buffer, limited by the size of the device */
+
+  bch->bufsectors = CONFIG_BCH_BUFFER_SECTORS;
+  if (bch->bufsectors > bch->nsectors)
+    {
+      bch->bufsectors = bch->nsectors;
+    }
+
+  if (bch->bufsectors < 1)
+    {
+      bch->bufsectors = 1;
+    }
   *handle = bch;
   return OK;
 
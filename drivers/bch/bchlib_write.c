@@ -37,6 +37,43 @@
 
 #include "bch.h"
 
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: bchlib_marksector
+ *
+ * Description:
+ *   Mark one buffered sector dirty, extending the range of dirty buffered
+ *   sectors that will be flushed to the media in a single transfer.
+ *
+ ****************************************************************************/
+
+static void bchlib_marksector(FAR struct bchlib_s *bch, size_t sector)
+{
+  uint16_t index = sector - bch->sector;
+
+  if (!bch->dirty)
+    {
+      bch->dirty      = true;
+      bch->dirtystart = index;
+      bch->dirtyend   = index + 1;
+    }
+  else
+    {
+      if (index < bch->dirtystart)
+        {
+          bch->dirtystart = index;
+        }
+
+      if (index + 1 > bch->dirtyend)
+        {
+          bch->dirtyend = index + 1;
+        }
+    }
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -102,8 +139,10 @@ ssize_t bchlib_write(FAR void *handle, FAR const char *buffer, off_t offset,
           nbytes = len;
         }
 
-      memcpy(&bch->buffer[sectoffset], buffer, nbytes);
-      bch->dirty = true;
+      memcpy(&bch->buffer[(sector - bch->sector) * bch->sectsize +
+                          sectoffset],
+             buffer, nbytes);
+      bchlib_marksector(bch, sector);
 
       /* Adjust pointers and counts */
 
@@ -131,9 +170,11 @@ ssize_t bchlib_write(FAR void *handle, FAR const char *buffer, off_t offset,
           nsectors = bch->nsectors - sector;
         }
 
-      /* Flush the dirty sector to keep the sector sequence */
+      /* Flush any dirty sectors to keep the sector sequence, discarding
+       * the buffer contents if they will be overwritten by this write.
+       */
 
-      ret = bchlib_flushsector(bch, sector <= bch->sector &&
+      ret = bchlib_flushsector(bch, sector < bch->sector + bch->nbuffered &&
                                bch->sector < (sector + nsectors));
       if (ret < 0)
         {
@@ -180,8 +221,9 @@ ssize_t bchlib_write(FAR void *handle, FAR const char *buffer, off_t offset,
 
       /* Copy the head end of the sector from the user buffer */
 
-      memcpy(bch->buffer, buffer, len);
-      bch->dirty = true;
+      memcpy(&bch->buffer[(sector - bch->sector) * bch->sectsize],
+             buffer, len);
+      bchlib_marksector(bch, sector);
 
       /* Adjust counts */
 
@@ -0,0 +1,289 @@
+/****************************************************************************
+ * drivers/dma/dmapool.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <nuttx/cache.h>
+#include <nuttx/kmalloc.h>
+#include <nuttx/mm/gran.h>
+#include <nuttx/dma/dmapool.h>
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* The state of one DMA buffer pool.  The structure is opaque to clients. */
+
+struct dma_pool_s
+{
+  GRAN_HANDLE gran; /* The granule allocator managing the region */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: dma_maintain_sg
+ *
+ * Description:
+ *   Perform clean or invalidate cache maintenance over a scatter list.
+ *   Each segment is first extended to cache line boundaries; segments
+ *   whose extended ranges overlap or abut are then merged so that each
+ *   affected cache line is maintained exactly once.
+ *
+ ****************************************************************************/
+
+static void dma_maintain_sg(FAR const struct dma_sg_s *sg,
+                            unsigned int nsg, bool invalidate)
+{
+  size_t linesize = up_get_dcache_linesize();
+  uintptr_t start = 0;
+  uintptr_t end = 0;
+  unsigned int i;
+
+  for (i = 0; i < nsg; i++)
+    {
+      uintptr_t segstart = (uintptr_t)sg[i].buffer;
+      uintptr_t segend = segstart + sg[i].length;
+
+      if (sg[i].length == 0)
+        {
+          continue;
+        }
+
+      /* Extend the segment to cache line boundaries. */
+
+      if (linesize > 0)
+        {
+          segstart &= ~((uintptr_t)linesize - 1);
+          segend = (segend + linesize - 1) & ~((uintptr_t)linesize - 1);
+        }
+
+      /* Merge with the accumulated range if the two overlap or abut. */
+
+      if (end != 0 && segstart <= end && segend >= start)
+        {
+          if (segstart < start)
+            {
+              start = segstart;
+            }
+
+          if (segend > end)
+            {
+              end = segend;
+            }
+
+          continue;
+        }
+
+      /* Disjoint segment:  Maintain the accumulated range and start a
+       * new one.
+       */
+
+      if (end != 0)
+        {
+          if (invalidate)
+            {
+              up_invalidate_dcache(start, end);
+            }
+          else
+            {
+              up_clean_dcache(start, end);
+            }
+        }
+
+      start = segstart;
+      end = segend;
+    }
+
+  if (end != 0)
+    {
+      if (invalidate)
+        {
+          up_invalidate_dcache(start, end);
+        }
+      else
+        {
+          up_clean_dcache(start, end);
+        }
+    }
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: dma_pool_initialize
+ *
+ * Description:
+ *   Create a DMA buffer pool over a board-provided memory region.  The
+ *   region would normally be mapped uncached or write-through by the
+ *   board logic; the pool itself only manages the allocations.  The
+ *   requested granule size is rounded up to a power of two and to the
+ *   data cache line size, so every allocation is cache-line aligned and
+ *   padded and cache maintenance on one buffer can never touch a line
+ *   shared with another.
+ *
+ * Input Parameters:
+ *   heapstart - Start of the DMA-safe memory region
+ *   heapsize  - Size of the DMA-safe memory region in bytes
+ *   gransize  - Requested allocation granule size in bytes
+ *
+ * Returned Value:
+ *   A reference to the pool on success; NULL on failure.
+ *
+ ****************************************************************************/
+
+FAR struct dma_pool_s *dma_pool_initialize(FAR void *heapstart,
+                                           size_t heapsize,
+                                           size_t gransize)
+{
+  FAR struct dma_pool_s *pool;
+  size_t linesize = up_get_dcache_linesize();
+  uint8_t log2gran;
+
+  DEBUGASSERT(heapstart != NULL && heapsize > 0 && gransize > 0);
+
+  /* The granule must cover at least one cache line so that allocations
+   * never share a line.
+   */
+
+  if (gransize < linesize)
+    {
+      gransize = linesize;
+    }
+
+  /* Round the granule size up to a power of two. */
+
+  for (log2gran = 0; ((size_t)1 << log2gran) < gransize; log2gran++)
+    {
+    }
+
+  pool = kmm_zalloc(sizeof(struct dma_pool_s));
+  if (pool == NULL)
+    {
+      return NULL;
+    }
+
+  /* Allocations are aligned to the granule size. */
+
+  pool->gran = gran_initialize(heapstart, heapsize, log2gran, log2gran);
+  if (pool->gran == NULL)
+    {
+      kmm_free(pool);
+      return NULL;
+    }
+
+  return pool;
+}
+
+/****************************************************************************
+ * Name: dma_pool_alloc
+ *
+ * Description:
+ *   Allocate a DMA-safe buffer from the pool.
+ *
+ * Input Parameters:
+ *   pool - The pool to allocate from
+ *   size - Size of the buffer in bytes
+ *
+ * Returned Value:
+ *   A reference to the buffer on success; NULL if the pool is exhausted.
+ *
+ ****************************************************************************/
+
+FAR void *dma_pool_alloc(FAR struct dma_pool_s *pool, size_t size)
+{
+  DEBUGASSERT(pool != NULL && size > 0);
+
+  return gran_alloc(pool->gran, size);
+}
+
+/****************************************************************************
+ * Name: dma_pool_free
+ *
+ * Description:
+ *   Return a buffer to the pool.
+ *
+ * Input Parameters:
+ *   pool   - The pool that the buffer was allocated from
+ *   memory - The buffer previously returned by dma_pool_alloc()
+ *   size   - Size of the buffer in bytes, as passed to dma_pool_alloc()
+ *
+ ****************************************************************************/
+
+void dma_pool_free(FAR struct dma_pool_s *pool, FAR void *memory,
+                   size_t size)
+{
+  DEBUGASSERT(pool != NULL && memory != NULL && size > 0);
+
+  gran_free(pool->gran, memory, size);
+}
+
+/****************************************************************************
+ * Name: dma_clean_sg
+ *
+ * Description:
+ *   Clean the data cache over a scatter list before a memory-to-device
+ *   transfer.  Segments that share or abut cache lines are merged so
+ *   that each affected line is cleaned exactly once, instead of issuing
+ *   one cache operation per (possibly tiny) segment.
+ *
+ * Input Parameters:
+ *   sg  - The scatter list
+ *   nsg - Number of entries in the scatter list
+ *
+ ****************************************************************************/
+
+void dma_clean_sg(FAR const struct dma_sg_s *sg, unsigned int nsg)
+{
+  dma_maintain_sg(sg, nsg, false);
+}
+
+/****************************************************************************
+ * Name: dma_invalidate_sg
+ *
+ * Description:
+ *   Invalidate the data cache over a scatter list before/after a
+ *   device-to-memory transfer.  Segments that share or abut cache lines
+ *   are merged so that each affected line is invalidated exactly once.
+ *
+ * Input Parameters:
+ *   sg  - The scatter list
+ *   nsg - Number of entries in the scatter list
+ *
+ ****************************************************************************/
+
+void dma_invalidate_sg(FAR const struct dma_sg_s *sg, unsigned int nsg)
+{
+  dma_maintain_sg(sg, nsg, true);
+}
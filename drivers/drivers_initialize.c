@@ -134,6 +134,10 @@ void drivers_initialize(void)
   devzero_register();   /* Standard /dev/zero */
 #endif
 
+#ifdef CONFIG_DEV_KBENCH
+  kbench_register();   /* Kernel microbenchmarks on /dev/kbench */
+#endif
+
 #ifdef CONFIG_DEV_MEM
   devmem_register();
 #endif
@@ -0,0 +1,249 @@
+/****************************************************************************
+ * drivers/i2c/i2c_async.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <assert.h>
+#include <errno.h>
+
+#include <nuttx/irq.h>
+#include <nuttx/kmalloc.h>
+#include <nuttx/queue.h>
+#include <nuttx/wqueue.h>
+#include <nuttx/i2c/i2c_master.h>
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* The state of one asynchronous transfer queue.  The structure is opaque
+ * to clients.
+ */
+
+struct i2c_async_s
+{
+  FAR struct i2c_master_s *i2c; /* The underlying (synchronous) bus */
+  struct work_s work;           /* Drains the queue of requests */
+  sq_queue_t pending;           /* Queued requests in FIFO order */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: i2c_async_worker
+ *
+ * Description:
+ *   Perform all queued transfers in FIFO order on the low priority work
+ *   queue, invoking the completion callback of each request after the bus
+ *   transaction has finished.
+ *
+ ****************************************************************************/
+
+static void i2c_async_worker(FAR void *arg)
+{
+  FAR struct i2c_async_s *async = arg;
+  FAR struct i2c_async_req_s *req;
+  irqstate_t flags;
+
+  for (; ; )
+    {
+      flags = enter_critical_section();
+      req = (FAR struct i2c_async_req_s *)sq_remfirst(&async->pending);
+      leave_critical_section(flags);
+
+      if (req == NULL)
+        {
+          break;
+        }
+
+      /* Perform the transfer with the queue unlocked so that further
+       * requests may be queued in the meantime.
+       */
+
+      req->result = I2C_TRANSFER(async->i2c, req->msgv, req->msgc);
+
+      /* Notify the client.  The callback may re-queue, reuse or free the
+       * request.
+       */
+
+      if (req->callback != NULL)
+        {
+          req->callback(req);
+        }
+    }
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: i2c_async_initialize
+ *
+ * Description:
+ *   Create an asynchronous transfer queue on top of an I2C bus.  Requests
+ *   queued with i2c_async_transfer() are performed in FIFO order on the
+ *   low priority work queue using the normal, synchronous I2C_TRANSFER
+ *   interface of the bus.
+ *
+ * Input Parameters:
+ *   i2c - An instance of the lower half I2C driver
+ *
+ * Returned Value:
+ *   A reference to the transfer queue on success; NULL on allocation
+ *   failure.
+ *
+ ****************************************************************************/
+
+FAR struct i2c_async_s *i2c_async_initialize(FAR struct i2c_master_s *i2c)
+{
+  FAR struct i2c_async_s *async;
+
+  DEBUGASSERT(i2c != NULL);
+
+  async = kmm_zalloc(sizeof(struct i2c_async_s));
+  if (async != NULL)
+    {
+      async->i2c = i2c;
+      sq_init(&async->pending);
+    }
+
+  return async;
+}
+
+/****************************************************************************
+ * Name: i2c_async_uninitialize
+ *
+ * Description:
+ *   Destroy an asynchronous transfer queue.  The queue must be idle:  All
+ *   queued requests must have completed (or been cancelled) before this
+ *   function is called.
+ *
+ * Input Parameters:
+ *   async - The transfer queue to destroy
+ *
+ ****************************************************************************/
+
+void i2c_async_uninitialize(FAR struct i2c_async_s *async)
+{
+  DEBUGASSERT(async != NULL && sq_peek(&async->pending) == NULL &&
+              work_available(&async->work));
+
+  kmm_free(async);
+}
+
+/****************************************************************************
+ * Name: i2c_async_transfer
+ *
+ * Description:
+ *   Queue a sequence of I2C transfers for asynchronous completion.  The
+ *   function returns immediately; when the bus transaction has finished,
+ *   req->result holds the result of I2C_TRANSFER and the completion
+ *   callback of the request is invoked from the low priority work queue.
+ *
+ *   The request structure, the message array and the message buffers are
+ *   provided by the caller and must remain valid until the callback has
+ *   been invoked.
+ *
+ * Input Parameters:
+ *   async - The transfer queue
+ *   req   - The request to queue
+ *
+ * Returned Value:
+ *   Zero (OK) if the request was queued; a negated errno value on failure.
+ *   Failure to queue does not invoke the callback.
+ *
+ ****************************************************************************/
+
+int i2c_async_transfer(FAR struct i2c_async_s *async,
+                       FAR struct i2c_async_req_s *req)
+{
+  irqstate_t flags;
+  int ret = OK;
+
+  DEBUGASSERT(async != NULL && req != NULL &&
+              req->msgv != NULL && req->msgc > 0);
+
+  flags = enter_critical_section();
+  sq_addlast(&req->node, &async->pending);
+
+  /* Kick the worker unless it is already draining the queue. */
+
+  if (work_available(&async->work))
+    {
+      ret = work_queue(LPWORK, &async->work, i2c_async_worker, async, 0);
+      if (ret < 0)
+        {
+          sq_rem(&req->node, &async->pending);
+        }
+    }
+
+  leave_critical_section(flags);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: i2c_async_cancel
+ *
+ * Description:
+ *   Remove a request from the transfer queue before it has been started.
+ *   The completion callback of a cancelled request is not invoked.
+ *
+ * Input Parameters:
+ *   async - The transfer queue
+ *   req   - The request to cancel
+ *
+ * Returned Value:
+ *   Zero (OK) if the request was still queued and has been removed;
+ *   -ENOENT if the request is not in the queue (it may have completed
+ *   already or be in progress on the bus).
+ *
+ ****************************************************************************/
+
+int i2c_async_cancel(FAR struct i2c_async_s *async,
+                     FAR struct i2c_async_req_s *req)
+{
+  FAR sq_entry_t *entry;
+  irqstate_t flags;
+  int ret = -ENOENT;
+
+  DEBUGASSERT(async != NULL && req != NULL);
+
+  flags = enter_critical_section();
+  for (entry = sq_peek(&async->pending); entry != NULL;
+       entry = sq_next(entry))
+    {
+      if (entry == &req->node)
+        {
+          sq_rem(entry, &async->pending);
+          ret = OK;
+          break;
+        }
+    }
+
+  leave_critical_section(flags);
+  return ret;
+}
@@ -155,7 +155,7 @@ static void i2schar_rxcallback(FAR struct i2s_dev_s *dev,
    * now.
    */
 
-  i2sinfo("Freeing apb=%p crefs=%d\n", apb, apb->crefs);
+  i2sinfo("Freeing apb=%p crefs=%d\n", apb, atomic_load(&apb->crefs));
   apb_free(apb);
 }
 
@@ -192,7 +192,7 @@ static void i2schar_txcallback(FAR struct i2s_dev_s *dev,
    * now.
    */
 
-  i2sinfo("Freeing apb=%p crefs=%d\n", apb, apb->crefs);
+  i2sinfo("Freeing apb=%p crefs=%d\n", apb, atomic_load(&apb->crefs));
   apb_free(apb);
 }
 
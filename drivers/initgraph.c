@@ -0,0 +1,352 @@
+/****************************************************************************
+ * drivers/initgraph.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <debug.h>
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <nuttx/drivers/initgraph.h>
+#include <nuttx/kmalloc.h>
+#include <nuttx/mutex.h>
+#include <nuttx/semaphore.h>
+#include <nuttx/wqueue.h>
+
+#ifdef CONFIG_DRIVERS_INITGRAPH
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Life cycle of one step */
+
+#define INITGRAPH_PENDING  0    /* Waiting for its dependencies */
+#define INITGRAPH_QUEUED   1    /* Queued or running on the work queue */
+#define INITGRAPH_DONE     2    /* Initialization succeeded */
+#define INITGRAPH_FAILED   3    /* Initialization returned a failure */
+#define INITGRAPH_SKIPPED  4    /* Not run; a dependency did not succeed */
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct initgraph_runner_s;
+
+/* Per-step runtime state */
+
+struct initgraph_node_s
+{
+  struct work_s                  work;   /* Work queue entry */
+  FAR struct initgraph_runner_s *runner; /* Back link to the runner */
+  unsigned int                   index;  /* Index into the step table */
+  uint8_t                        state;  /* See INITGRAPH_* definitions */
+  int                            result; /* Result of the init function */
+};
+
+/* State shared by one initgraph_run() invocation */
+
+struct initgraph_runner_s
+{
+  FAR const struct initgraph_step_s *steps;
+  FAR struct initgraph_node_s       *nodes;
+  size_t                             nsteps;
+  mutex_t                            lock;   /* Protects the node states */
+  sem_t                              done;   /* Counts finished steps */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: initgraph_lookup
+ *
+ * Description:
+ *   Map a dependency name to its index in the step table.  Returns the
+ *   index, or a negated errno value if no step has that name.
+ *
+ ****************************************************************************/
+
+static int initgraph_lookup(FAR struct initgraph_runner_s *runner,
+                            FAR const char *name)
+{
+  size_t i;
+
+  for (i = 0; i < runner->nsteps; i++)
+    {
+      if (strcmp(runner->steps[i].name, name) == 0)
+        {
+          return (int)i;
+        }
+    }
+
+  return -EINVAL;
+}
+
+/****************************************************************************
+ * Name: initgraph_depstate
+ *
+ * Description:
+ *   Classify the dependencies of a pending step.
+ *
+ * Returned Value:
+ *   INITGRAPH_DONE    - All dependencies completed successfully and the
+ *                       step may run.
+ *   INITGRAPH_PENDING - At least one dependency has not finished yet.
+ *   INITGRAPH_FAILED  - A dependency failed, was skipped, or does not
+ *                       exist; the step can never run.
+ *
+ ****************************************************************************/
+
+static uint8_t initgraph_depstate(FAR struct initgraph_runner_s *runner,
+                                  unsigned int index)
+{
+  FAR const char * const *dep = runner->steps[index].deps;
+  uint8_t state = INITGRAPH_DONE;
+
+  if (dep == NULL)
+    {
+      return INITGRAPH_DONE;
+    }
+
+  for (; *dep != NULL; dep++)
+    {
+      int di = initgraph_lookup(runner, *dep);
+
+      if (di < 0)
+        {
+          _err("ERROR: Step %s depends on undefined step %s\n",
+               runner->steps[index].name, *dep);
+          return INITGRAPH_FAILED;
+        }
+
+      switch (runner->nodes[di].state)
+        {
+          case INITGRAPH_DONE:
+            break;
+
+          case INITGRAPH_FAILED:
+          case INITGRAPH_SKIPPED:
+            return INITGRAPH_FAILED;
+
+          default:
+            state = INITGRAPH_PENDING;
+            break;
+        }
+    }
+
+  return state;
+}
+
+/****************************************************************************
+ * Name: initgraph_worker
+ *
+ * Description:
+ *   Run one step's init function on the low-priority work queue and
+ *   report its completion to the runner.
+ *
+ ****************************************************************************/
+
+static void initgraph_worker(FAR void *arg)
+{
+  FAR struct initgraph_node_s *node = arg;
+  FAR struct initgraph_runner_s *runner = node->runner;
+  int ret;
+
+  ret = runner->steps[node->index].init();
+
+  nxmutex_lock(&runner->lock);
+  node->result = ret;
+  node->state  = ret < 0 ? INITGRAPH_FAILED : INITGRAPH_DONE;
+  nxmutex_unlock(&runner->lock);
+
+  if (ret < 0)
+    {
+      _err("ERROR: Step %s failed: %d\n", runner->steps[node->index].name,
+           ret);
+    }
+
+  nxsem_post(&runner->done);
+}
+
+/****************************************************************************
+ * Name: initgraph_schedule
+ *
+ * Description:
+ *   Queue every pending step whose dependencies are satisfied and resolve
+ *   steps whose dependencies can no longer be satisfied.  Called with the
+ *   runner lock held.
+ *
+ * Returned Value:
+ *   The number of steps resolved in this pass:  Queued to the work queue
+ *   or marked skipped.
+ *
+ ****************************************************************************/
+
+static size_t initgraph_schedule(FAR struct initgraph_runner_s *runner)
+{
+  size_t resolved = 0;
+  size_t i;
+
+  for (i = 0; i < runner->nsteps; i++)
+    {
+      FAR struct initgraph_node_s *node = &runner->nodes[i];
+
+      if (node->state != INITGRAPH_PENDING)
+        {
+          continue;
+        }
+
+      switch (initgraph_depstate(runner, i))
+        {
+          case INITGRAPH_DONE:
+            node->state = INITGRAPH_QUEUED;
+            work_queue(LPWORK, &node->work, initgraph_worker, node, 0);
+            resolved++;
+            break;
+
+          case INITGRAPH_FAILED:
+            _err("ERROR: Skipping step %s; a dependency did not succeed\n",
+                 runner->steps[i].name);
+            node->state  = INITGRAPH_SKIPPED;
+            node->result = -ENODEV;
+            nxsem_post(&runner->done);
+            resolved++;
+            break;
+
+          default:
+            break;
+        }
+    }
+
+  return resolved;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: initgraph_run
+ *
+ * Description:
+ *   Execute a set of initialization steps, honoring the declared
+ *   dependencies and running independent steps concurrently on the
+ *   low-priority work queue.  See include/nuttx/drivers/initgraph.h.
+ *
+ ****************************************************************************/
+
+int initgraph_run(FAR const struct initgraph_step_s *steps, size_t nsteps)
+{
+  struct initgraph_runner_s runner;
+  size_t outstanding = 0;
+  size_t finished = 0;
+  int ret = OK;
+  size_t i;
+
+  if (steps == NULL || nsteps == 0)
+    {
+      return OK;
+    }
+
+  runner.steps  = steps;
+  runner.nsteps = nsteps;
+  runner.nodes  = kmm_zalloc(nsteps * sizeof(struct initgraph_node_s));
+  if (runner.nodes == NULL)
+    {
+      return -ENOMEM;
+    }
+
+  for (i = 0; i < nsteps; i++)
+    {
+      runner.nodes[i].runner = &runner;
+      runner.nodes[i].index  = i;
+    }
+
+  nxmutex_init(&runner.lock);
+  nxsem_init(&runner.done, 0, 0);
+
+  /* Queue everything that is initially runnable, then queue more steps as
+   * their dependencies complete.
+   */
+
+  nxmutex_lock(&runner.lock);
+  outstanding = initgraph_schedule(&runner);
+  nxmutex_unlock(&runner.lock);
+
+  while (finished < nsteps)
+    {
+      if (outstanding == 0)
+        {
+          /* Nothing is running and nothing became runnable:  The
+           * remaining steps form a dependency cycle.
+           */
+
+          nxmutex_lock(&runner.lock);
+          for (i = 0; i < nsteps; i++)
+            {
+              if (runner.nodes[i].state == INITGRAPH_PENDING)
+                {
+                  _err("ERROR: Step %s is part of a dependency cycle\n",
+                       steps[i].name);
+                  runner.nodes[i].state  = INITGRAPH_SKIPPED;
+                  runner.nodes[i].result = -EINVAL;
+                  finished++;
+                }
+            }
+
+          nxmutex_unlock(&runner.lock);
+          break;
+        }
+
+      nxsem_wait_uninterruptible(&runner.done);
+      finished++;
+      outstanding--;
+
+      nxmutex_lock(&runner.lock);
+      outstanding += initgraph_schedule(&runner);
+      nxmutex_unlock(&runner.lock);
+    }
+
+  /* Report the result of the first step that did not succeed */
+
+  for (i = 0; i < nsteps; i++)
+    {
+      if (runner.nodes[i].state != INITGRAPH_DONE &&
+          runner.nodes[i].result < 0)
+        {
+          ret = runner.nodes[i].result;
+          break;
+        }
+    }
+
+  nxsem_destroy(&runner.done);
+  nxmutex_destroy(&runner.lock);
+  kmm_free(runner.nodes);
+  return ret;
+}
+
+#endif /* CONFIG_DRIVERS_INITGRAPH */
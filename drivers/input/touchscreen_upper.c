@@ -51,6 +51,11 @@ struct touch_openpriv_s
   FAR struct pollfd *fds;     /* Polling structure of waiting thread */
   sem_t              waitsem; /* Used to wait for the availability of data */
   mutex_t            lock;    /* Manages exclusive access to this structure */
+#ifdef CONFIG_INPUT_TOUCHSCREEN_COMPRESSION
+  FAR struct touch_sample_s *pending; /* Coalesced move sample, newest wins */
+  size_t             pendsize;        /* Allocated size of pending */
+  bool               pendvalid;       /* True: pending holds a sample */
+#endif
 };
 
 /* This structure is for touchscreen upper half driver */
@@ -79,6 +84,9 @@ static int     touch_ioctl(FAR struct file *filep, int cmd,
 static int     touch_poll(FAR struct file *filep, FAR struct pollfd *fds,
                           bool setup);
 
+#ifdef CONFIG_INPUT_TOUCHSCREEN_COMPRESSION
+static bool    touch_is_movesample(FAR const struct touch_sample_s *sample);
+#endif
 static void    touch_event_notify(FAR struct touch_openpriv_s  *openpriv,
                                   FAR const struct touch_sample_s *sample);
 
@@ -129,9 +137,23 @@ static int touch_open(FAR struct file *filep)
       return ret;
     }
 
+#ifdef CONFIG_INPUT_TOUCHSCREEN_COMPRESSION
+  openpriv->pendsize = SIZEOF_TOUCH_SAMPLE_S(lower->maxpoint);
+  openpriv->pending  = kmm_malloc(openpriv->pendsize);
+  if (openpriv->pending == NULL)
+    {
+      circbuf_uninit(&openpriv->circbuf);
+      kmm_free(openpriv);
+      return -ENOMEM;
+    }
+#endif
+
   ret = nxmutex_lock(&upper->lock);
   if (ret < 0)
     {
+#ifdef CONFIG_INPUT_TOUCHSCREEN_COMPRESSION
+      kmm_free(openpriv->pending);
+#endif
       circbuf_uninit(&openpriv->circbuf);
       kmm_free(openpriv);
       return ret;
@@ -176,6 +198,9 @@ static int touch_close(FAR struct file *filep)
   circbuf_uninit(&openpriv->circbuf);
   nxsem_destroy(&openpriv->waitsem);
   nxmutex_destroy(&openpriv->lock);
+#ifdef CONFIG_INPUT_TOUCHSCREEN_COMPRESSION
+  kmm_free(openpriv->pending);
+#endif
   kmm_free(openpriv);
 
   nxmutex_unlock(&upper->lock);
@@ -222,7 +247,11 @@ static ssize_t touch_read(FAR struct file *filep, FAR char *buffer,
       return ret;
     }
 
-  while (circbuf_is_empty(&openpriv->circbuf))
+  while (circbuf_is_empty(&openpriv->circbuf)
+#ifdef CONFIG_INPUT_TOUCHSCREEN_COMPRESSION
+         && !openpriv->pendvalid
+#endif
+        )
     {
       if (filep->f_oflags & O_NONBLOCK)
         {
@@ -246,6 +275,23 @@ static ssize_t touch_read(FAR struct file *filep, FAR char *buffer,
         }
     }
 
+#ifdef CONFIG_INPUT_TOUCHSCREEN_COMPRESSION
+  /* Move the coalesced move sample into the ring once it fits again so
+   * that it is consumed in order, after the already queued samples.
+   */
+
+  if (openpriv->pendvalid)
+    {
+      size_t pendlen = SIZEOF_TOUCH_SAMPLE_S(openpriv->pending->npoints);
+
+      if (circbuf_space(&openpriv->circbuf) >= pendlen)
+        {
+          circbuf_write(&openpriv->circbuf, openpriv->pending, pendlen);
+          openpriv->pendvalid = false;
+        }
+    }
+#endif
+
   ret = circbuf_read(&openpriv->circbuf, buffer, len);
 
 out:
@@ -354,6 +400,13 @@ static int touch_poll(FAR struct file *filep, FAR struct pollfd *fds,
           eventset |= POLLIN;
         }
 
+#ifdef CONFIG_INPUT_TOUCHSCREEN_COMPRESSION
+      if (openpriv->pendvalid)
+        {
+          eventset |= POLLIN;
+        }
+#endif
+
       poll_notify(&fds, 1, eventset);
     }
   else if (fds->priv)
@@ -367,6 +420,33 @@ errout:
   return ret;
 }
 
+#ifdef CONFIG_INPUT_TOUCHSCREEN_COMPRESSION
+/****************************************************************************
+ * Name: touch_is_movesample
+ *
+ * Description:
+ *   Return true if every contact in the sample only reports movement.
+ *   Such samples may be coalesced without losing down/up edges.
+ *
+ ****************************************************************************/
+
+static bool touch_is_movesample(FAR const struct touch_sample_s *sample)
+{
+  int i;
+
+  for (i = 0; i < sample->npoints; i++)
+    {
+      if ((sample->point[i].flags & (TOUCH_DOWN | TOUCH_UP)) != 0 ||
+          (sample->point[i].flags & TOUCH_MOVE) == 0)
+        {
+          return false;
+        }
+    }
+
+  return sample->npoints > 0;
+}
+#endif
+
 /****************************************************************************
  * Name: touch_event_notify
  ****************************************************************************/
@@ -374,11 +454,42 @@ errout:
 static void touch_event_notify(FAR struct touch_openpriv_s  *openpriv,
                                FAR const struct touch_sample_s *sample)
 {
+  size_t size = SIZEOF_TOUCH_SAMPLE_S(sample->npoints);
   int semcount;
 
   nxmutex_lock(&openpriv->lock);
-  circbuf_overwrite(&openpriv->circbuf, sample,
-                    SIZEOF_TOUCH_SAMPLE_S(sample->npoints));
+
+#ifdef CONFIG_INPUT_TOUCHSCREEN_COMPRESSION
+  if (touch_is_movesample(sample) && size <= openpriv->pendsize &&
+      circbuf_space(&openpriv->circbuf) < size)
+    {
+      /* The consumer lags behind and this sample only reports motion:
+       * coalesce it with any previously held move sample instead of
+       * pushing the oldest queued sample (possibly a down/up edge) out
+       * of the ring.
+       */
+
+      memcpy(openpriv->pending, sample, size);
+      openpriv->pendvalid = true;
+    }
+  else
+    {
+      /* The held move sample must be delivered before this one to keep
+       * the event order.
+       */
+
+      if (openpriv->pendvalid)
+        {
+          circbuf_overwrite(&openpriv->circbuf, openpriv->pending,
+                        SIZEOF_TOUCH_SAMPLE_S(openpriv->pending->npoints));
+          openpriv->pendvalid = false;
+        }
+
+      circbuf_overwrite(&openpriv->circbuf, sample, size);
+    }
+#else
+  circbuf_overwrite(&openpriv->circbuf, sample, size);
+#endif
 
   nxsem_get_value(&openpriv->waitsem, &semcount);
   if (semcount < 1)
@@ -200,7 +200,8 @@ static void st7735_setarea(FAR struct st7735_dev_s *dev,
                            uint16_t x1, uint16_t y1);
 static void st7735_bpp(FAR struct st7735_dev_s *dev, int bpp);
 static void st7735_wrram(FAR struct st7735_dev_s *dev,
-                         FAR const uint16_t *buff, size_t size);
+                         FAR const uint16_t *buff, size_t size, size_t skip,
+                         size_t count);
 static void st7735_rdram(FAR struct st7735_dev_s *dev,
                          FAR uint16_t *buff, size_t size);
 static void st7735_fill(FAR struct st7735_dev_s *dev, uint16_t color);
@@ -210,6 +211,10 @@ static void st7735_fill(FAR struct st7735_dev_s *dev, uint16_t color);
 static int st7735_putrun(FAR struct lcd_dev_s *dev,
                          fb_coord_t row, fb_coord_t col,
                          FAR const uint8_t *buffer, size_t npixels);
+static int st7735_putarea(FAR struct lcd_dev_s *dev,
+                          fb_coord_t row_start, fb_coord_t row_end,
+                          fb_coord_t col_start, fb_coord_t col_end,
+                          FAR const uint8_t *buffer, fb_coord_t stride);
 #ifndef CONFIG_LCD_NOGETRUN
 static int st7735_getrun(FAR struct lcd_dev_s *dev,
                          fb_coord_t row, fb_coord_t col,
@@ -473,17 +478,26 @@ static void st7735_bpp(FAR struct st7735_dev_s *dev, int bpp)
  * Name: st7735_wrram
  *
  * Description:
- *   Write to the driver's RAM.
+ *   Write to the driver's RAM. It is possible to write multiples of size
+ *   while skipping some values.
  *
  ****************************************************************************/
 
 static void st7735_wrram(FAR struct st7735_dev_s *dev,
-                         FAR const uint16_t *buff, size_t size)
+                         FAR const uint16_t *buff, size_t size, size_t skip,
+                         size_t count)
 {
+  size_t i;
+
   st7735_sendcmd(dev, ST7735_RAMWR);
 
   st7735_select(dev->spi, ST7735_BYTESPP * 8);
-  SPI_SNDBLOCK(dev->spi, buff, size);
+
+  for (i = 0; i < count; i++)
+    {
+      SPI_SNDBLOCK(dev->spi, buff + i * (size + skip), size);
+    }
+
   st7735_deselect(dev->spi);
 }
 
@@ -556,7 +570,73 @@ static int st7735_putrun(FAR struct lcd_dev_s *dev,
   DEBUGASSERT(buffer && ((uintptr_t)buffer & 1) == 0);
 
   st7735_setarea(priv, col, row, col + npixels - 1, row);
-  st7735_wrram(priv, src, npixels);
+  st7735_wrram(priv, src, npixels, 0, 1);
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name:  st7735_putarea
+ *
+ * Description:
+ *   This method can be used to write a partial area to the LCD:
+ *
+ *   dev       - The lcd device
+ *   row_start - Starting row to write to (range: 0 <= row < yres)
+ *   row_end   - Ending row to write to (range: row_start <= row < yres)
+ *   col_start - Starting column to write to (range: 0 <= col <= xres)
+ *   col_end   - Ending column to write to
+ *               (range: col_start <= col_end < xres)
+ *   buffer    - The buffer containing the area to be written to the LCD
+ *   stride    - Length of a line in bytes. This parameter may be necessary
+ *               to allow the LCD driver to calculate the offset for partial
+ *               writes when the buffer needs to be splited for row-by-row
+ *               writing.
+ *
+ ****************************************************************************/
+
+static int st7735_putarea(FAR struct lcd_dev_s *dev,
+                          fb_coord_t row_start, fb_coord_t row_end,
+                          fb_coord_t col_start, fb_coord_t col_end,
+                          FAR const uint8_t *buffer, fb_coord_t stride)
+{
+  FAR struct st7735_dev_s *priv = (FAR struct st7735_dev_s *)dev;
+  FAR const uint16_t *src = (FAR const uint16_t *)buffer;
+  size_t cols = col_end - col_start + 1;
+  size_t rows = row_end - row_start + 1;
+  size_t row_size = cols * ST7735_BYTESPP;
+
+  ginfo("row_start: %d row_end: %d col_start: %d col_end: %d\n",
+         row_start, row_end, col_start, col_end);
+
+  DEBUGASSERT(buffer && ((uintptr_t)buffer & 1) == 0);
+
+  /* Set the address window once for the whole dirty rectangle, then
+   * stream the pixel data in a single RAMWR sequence.
+   */
+
+  st7735_setarea(priv, col_start, row_start, col_end, row_end);
+
+  /* If the stride is the same of the row, a single SPI transfer is enough.
+   * That is always true for lcddev. For framebuffer, that indicates a full
+   * screen or full row update.
+   */
+
+  if (stride == row_size)
+    {
+      /* simpler case, we can just send the whole buffer */
+
+      ginfo("Using full screen/full row mode\n");
+      st7735_wrram(priv, src, rows * cols, 0, 1);
+    }
+  else
+    {
+      /* We have to go row by row */
+
+      ginfo("Falling-back to row by row mode\n");
+      st7735_wrram(priv, src, cols,
+                   (stride - row_size) / ST7735_BYTESPP, rows);
+    }
 
   return OK;
 }
@@ -633,6 +713,7 @@ static int st7735_getplaneinfo(FAR struct lcd_dev_s *dev,
   lcdinfo("planeno: %d bpp: %d\n", planeno, ST7735_BPP);
 
   pinfo->putrun = st7735_putrun;                  /* Put a run into LCD memory */
+  pinfo->putarea = st7735_putarea;                /* Put an area into LCD memory */
 #ifndef CONFIG_LCD_NOGETRUN
   pinfo->getrun = st7735_getrun;                  /* Get a run from LCD memory */
 #endif
@@ -45,6 +45,8 @@
 #include <nuttx/fs/fs.h>
 #include <nuttx/fs/loop.h>
 #include <nuttx/mutex.h>
+#include <nuttx/semaphore.h>
+#include <nuttx/wqueue.h>
 
 /****************************************************************************
  * Pre-processor Definitions
@@ -52,6 +54,15 @@
 
 #define MAX_OPENCNT     (255)                  /* Limit of uint8_t */
 
+#ifdef CONFIG_DEV_LOOP_ASYNC
+/* State of the staging buffer used for deferred backing file transfers */
+
+#define LOOP_XFR_IDLE       0   /* Buffer contents are invalid */
+#define LOOP_XFR_CACHED     1   /* Buffer holds read-ahead sector data */
+#define LOOP_XFR_RDPENDING  2   /* A read into the buffer is in progress */
+#define LOOP_XFR_WRPENDING  3   /* A write from the buffer is in progress */
+#endif
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -65,12 +76,32 @@ struct loop_struct_s
   uint8_t      opencnt;      /* Count of open references to the loop device */
   bool         writeenabled; /* true: can write to device */
   struct file  devfile;      /* File struct of char device/file */
+
+#ifdef CONFIG_DEV_LOOP_ASYNC
+  struct work_s work;        /* Deferred transfer work item */
+  sem_t         done;        /* Signals completion of a deferred transfer */
+  FAR uint8_t  *xfrbuf;      /* Staging buffer (NULL: async disabled) */
+  blkcnt_t      xfrstart;    /* First sector of the staged transfer */
+  uint32_t      xfrcount;    /* Number of sectors staged */
+  ssize_t       xfrresult;   /* Result of the completed transfer */
+  uint8_t       xfrstate;    /* See LOOP_XFR_* definitions */
+#endif
 };
 
 /****************************************************************************
  * Private Function Prototypes
  ****************************************************************************/
 
+static ssize_t loop_read_raw(FAR struct loop_struct_s *dev,
+                             FAR unsigned char *buffer,
+                             blkcnt_t start_sector, unsigned int nsectors);
+static ssize_t loop_write_raw(FAR struct loop_struct_s *dev,
+                              FAR const unsigned char *buffer,
+                              blkcnt_t start_sector, unsigned int nsectors);
+#ifdef CONFIG_DEV_LOOP_ASYNC
+static void    loop_async_worker(FAR void *arg);
+static ssize_t loop_async_flush(FAR struct loop_struct_s *dev);
+#endif
 static int     loop_open(FAR struct inode *inode);
 static int     loop_close(FAR struct inode *inode);
 static ssize_t loop_read(FAR struct inode *inode, FAR unsigned char *buffer,
@@ -98,6 +129,171 @@ static const struct block_operations g_bops =
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: loop_read_raw
+ *
+ * Description:  Read sectors from the backing file through the VFS
+ *
+ ****************************************************************************/
+
+static ssize_t loop_read_raw(FAR struct loop_struct_s *dev,
+                             FAR unsigned char *buffer,
+                             blkcnt_t start_sector, unsigned int nsectors)
+{
+  ssize_t nbytesread;
+  off_t offset;
+  off_t ret;
+
+  /* Calculate the offset to read the sectors and seek to the position */
+
+  offset = start_sector * dev->sectsize + dev->offset;
+  ret = file_seek(&dev->devfile, offset, SEEK_SET);
+  if (ret < 0)
+    {
+      ferr("ERROR: Seek failed for offset=%d: %d\n", (int)offset, (int)ret);
+      return -EIO;
+    }
+
+  /* Then read the requested number of sectors from that position */
+
+  do
+    {
+      nbytesread = file_read(&dev->devfile, buffer,
+                             nsectors * dev->sectsize);
+      if (nbytesread < 0 && nbytesread != -EINTR)
+        {
+          ferr("ERROR: Read failed: %zd\n", nbytesread);
+          return (int)nbytesread;
+        }
+    }
+  while (nbytesread < 0);
+
+  /* Return the number of sectors read */
+
+  return nbytesread / dev->sectsize;
+}
+
+/****************************************************************************
+ * Name: loop_write_raw
+ *
+ * Description:  Write sectors to the backing file through the VFS
+ *
+ ****************************************************************************/
+
+static ssize_t loop_write_raw(FAR struct loop_struct_s *dev,
+                              FAR const unsigned char *buffer,
+                              blkcnt_t start_sector, unsigned int nsectors)
+{
+  ssize_t nbyteswritten;
+  off_t offset;
+  off_t ret;
+
+  /* Calculate the offset to write the sectors and seek to the position */
+
+  offset = start_sector * dev->sectsize + dev->offset;
+  ret = file_seek(&dev->devfile, offset, SEEK_SET);
+  if (ret < 0)
+    {
+      ferr("ERROR: Seek failed for offset=%d: %d\n", (int)offset, (int)ret);
+    }
+
+  /* Then write the requested number of sectors to that position */
+
+  do
+    {
+      nbyteswritten = file_write(&dev->devfile, buffer,
+                                 nsectors * dev->sectsize);
+      if (nbyteswritten < 0 && nbyteswritten != -EINTR)
+        {
+          ferr("ERROR: file_write failed: %zd\n", nbyteswritten);
+          return nbyteswritten;
+        }
+    }
+  while (nbyteswritten < 0);
+
+  /* Return the number of sectors written */
+
+  return nbyteswritten / dev->sectsize;
+}
+
+#ifdef CONFIG_DEV_LOOP_ASYNC
+/****************************************************************************
+ * Name: loop_async_worker
+ *
+ * Description:
+ *   Complete the staged transfer on the low priority work queue.  The
+ *   staging fields are stable here because all foreground operations wait
+ *   for the pending transfer before touching them.
+ *
+ ****************************************************************************/
+
+static void loop_async_worker(FAR void *arg)
+{
+  FAR struct loop_struct_s *dev = (FAR struct loop_struct_s *)arg;
+
+  if (dev->xfrstate == LOOP_XFR_WRPENDING)
+    {
+      dev->xfrresult = loop_write_raw(dev, dev->xfrbuf, dev->xfrstart,
+                                      dev->xfrcount);
+    }
+  else
+    {
+      dev->xfrresult = loop_read_raw(dev, dev->xfrbuf, dev->xfrstart,
+                                     dev->xfrcount);
+    }
+
+  nxsem_post(&dev->done);
+}
+
+/****************************************************************************
+ * Name: loop_async_flush
+ *
+ * Description:
+ *   Wait for any pending deferred transfer to complete.  Called with the
+ *   device locked.
+ *
+ * Returned Value:
+ *   OK on success.  The error from a completed write-behind is surfaced
+ *   here, on the first operation after the failure.
+ *
+ ****************************************************************************/
+
+static ssize_t loop_async_flush(FAR struct loop_struct_s *dev)
+{
+  ssize_t result = OK;
+  int ret;
+
+  if (dev->xfrstate == LOOP_XFR_RDPENDING ||
+      dev->xfrstate == LOOP_XFR_WRPENDING)
+    {
+      ret = nxsem_wait_uninterruptible(&dev->done);
+      if (ret < 0)
+        {
+          return ret;
+        }
+
+      if (dev->xfrstate == LOOP_XFR_WRPENDING)
+        {
+          if (dev->xfrresult < 0)
+            {
+              result = dev->xfrresult;
+            }
+
+          dev->xfrstate = LOOP_XFR_IDLE;
+        }
+      else
+        {
+          /* The buffer caches the read sectors only if all were read */
+
+          dev->xfrstate = dev->xfrresult == (ssize_t)dev->xfrcount ?
+                          LOOP_XFR_CACHED : LOOP_XFR_IDLE;
+        }
+    }
+
+  return result;
+}
+#endif /* CONFIG_DEV_LOOP_ASYNC */
+
 /****************************************************************************
  * Name: loop_open
  *
@@ -183,9 +379,7 @@ static ssize_t loop_read(FAR struct inode *inode, FAR unsigned char *buffer,
                          blkcnt_t start_sector, unsigned int nsectors)
 {
   FAR struct loop_struct_s *dev;
-  ssize_t nbytesread;
-  off_t offset;
-  off_t ret;
+  ssize_t nread;
 
   DEBUGASSERT(inode->i_private);
   dev = inode->i_private;
@@ -196,33 +390,74 @@ static ssize_t loop_read(FAR struct inode *inode, FAR unsigned char *buffer,
       return -EIO;
     }
 
-  /* Calculate the offset to read the sectors and seek to the position */
-
-  offset = start_sector * dev->sectsize + dev->offset;
-  ret = file_seek(&dev->devfile, offset, SEEK_SET);
-  if (ret < 0)
+#ifdef CONFIG_DEV_LOOP_ASYNC
+  if (dev->xfrbuf != NULL)
     {
-      ferr("ERROR: Seek failed for offset=%d: %d\n", (int)offset, (int)ret);
-      return -EIO;
-    }
+      blkcnt_t next;
+      uint32_t count;
+      ssize_t ret;
 
-  /* Then read the requested number of sectors from that position */
+      ret = nxmutex_lock(&dev->lock);
+      if (ret < 0)
+        {
+          return ret;
+        }
 
-  do
-    {
-      nbytesread = file_read(&dev->devfile, buffer,
-                             nsectors * dev->sectsize);
-      if (nbytesread < 0 && nbytesread != -EINTR)
+      /* Wait for any deferred transfer; this also surfaces the error of a
+       * failed write-behind before more data is accepted.
+       */
+
+      ret = loop_async_flush(dev);
+      if (ret < 0)
         {
-          ferr("ERROR: Read failed: %zd\n", nbytesread);
-          return (int)nbytesread;
+          nxmutex_unlock(&dev->lock);
+          return ret;
         }
-    }
-  while (nbytesread < 0);
 
-  /* Return the number of sectors read */
+      /* Satisfy the read from the read-ahead buffer when possible */
 
-  return nbytesread / dev->sectsize;
+      if (dev->xfrstate == LOOP_XFR_CACHED &&
+          start_sector >= dev->xfrstart &&
+          start_sector + nsectors <= dev->xfrstart + dev->xfrcount)
+        {
+          memcpy(buffer,
+                 dev->xfrbuf + (start_sector - dev->xfrstart) *
+                               dev->sectsize,
+                 nsectors * dev->sectsize);
+          nread = nsectors;
+        }
+      else
+        {
+          nread = loop_read_raw(dev, buffer, start_sector, nsectors);
+        }
+
+      /* Queue a read-ahead of the sectors that follow this transfer */
+
+      next  = start_sector + nsectors;
+      count = dev->nsectors - next > CONFIG_DEV_LOOP_ASYNC_NSECTORS ?
+              CONFIG_DEV_LOOP_ASYNC_NSECTORS : dev->nsectors - next;
+
+      if (nread > 0 && next < dev->nsectors &&
+          (dev->xfrstate != LOOP_XFR_CACHED || dev->xfrstart != next))
+        {
+          dev->xfrstart = next;
+          dev->xfrcount = count;
+          dev->xfrstate = LOOP_XFR_RDPENDING;
+
+          if (work_queue(LPWORK, &dev->work, loop_async_worker,
+                         dev, 0) < 0)
+            {
+              dev->xfrstate = LOOP_XFR_IDLE;
+            }
+        }
+
+      nxmutex_unlock(&dev->lock);
+      return nread;
+    }
+#endif
+
+  nread = loop_read_raw(dev, buffer, start_sector, nsectors);
+  return nread;
 }
 
 /****************************************************************************
@@ -237,39 +472,65 @@ static ssize_t loop_write(FAR struct inode *inode,
                           blkcnt_t start_sector, unsigned int nsectors)
 {
   FAR struct loop_struct_s *dev;
-  ssize_t nbyteswritten;
-  off_t offset;
-  off_t ret;
 
   DEBUGASSERT(inode->i_private);
   dev = inode->i_private;
 
-  /* Calculate the offset to write the sectors and seek to the position */
-
-  offset = start_sector * dev->sectsize + dev->offset;
-  ret = file_seek(&dev->devfile, offset, SEEK_SET);
-  if (ret < 0)
+#ifdef CONFIG_DEV_LOOP_ASYNC
+  if (dev->xfrbuf != NULL)
     {
-      ferr("ERROR: Seek failed for offset=%d: %d\n", (int)offset, (int)ret);
-    }
+      ssize_t ret;
 
-  /* Then write the requested number of sectors to that position */
+      ret = nxmutex_lock(&dev->lock);
+      if (ret < 0)
+        {
+          return ret;
+        }
 
-  do
-    {
-      nbyteswritten = file_write(&dev->devfile, buffer,
-                                 nsectors * dev->sectsize);
-      if (nbyteswritten < 0 && nbyteswritten != -EINTR)
+      /* Wait for any deferred transfer; this also surfaces the error of a
+       * failed write-behind before more data is accepted.
+       */
+
+      ret = loop_async_flush(dev);
+      if (ret < 0)
         {
-          ferr("ERROR: file_write failed: %zd\n", nbyteswritten);
-          return nbyteswritten;
+          nxmutex_unlock(&dev->lock);
+          return ret;
         }
-    }
-  while (nbyteswritten < 0);
 
-  /* Return the number of sectors written */
+      if (nsectors <= CONFIG_DEV_LOOP_ASYNC_NSECTORS)
+        {
+          /* Stage the sector data and complete the write in the
+           * background.  This also invalidates any read-ahead data in
+           * the buffer, keeping subsequent reads coherent.
+           */
+
+          memcpy(dev->xfrbuf, buffer, nsectors * dev->sectsize);
+          dev->xfrstart = start_sector;
+          dev->xfrcount = nsectors;
+          dev->xfrstate = LOOP_XFR_WRPENDING;
+
+          if (work_queue(LPWORK, &dev->work, loop_async_worker,
+                         dev, 0) == OK)
+            {
+              nxmutex_unlock(&dev->lock);
+              return nsectors;
+            }
+        }
 
-  return nbyteswritten / dev->sectsize;
+      /* The transfer is too large for the staging buffer (or could not be
+       * queued).  Invalidate any read-ahead data overlapping the write and
+       * forward it synchronously.
+       */
+
+      dev->xfrstate = LOOP_XFR_IDLE;
+      ret = loop_write_raw(dev, buffer, start_sector, nsectors);
+      nxmutex_unlock(&dev->lock);
+      return ret;
+    }
+#endif
+
+  return loop_write_raw(dev, buffer, start_sector, nsectors);
 }
 
 /****************************************************************************
@@ -363,6 +624,15 @@ int losetup(FAR const char *devname, FAR const char *filename,
   dev->sectsize  = sectsize;
   dev->offset    = offset;
 
+#ifdef CONFIG_DEV_LOOP_ASYNC
+  /* Allocate the staging buffer for deferred transfers.  On failure the
+   * device still works; all transfers are simply forwarded synchronously.
+   */
+
+  nxsem_init(&dev->done, 0, 0);
+  dev->xfrbuf = kmm_malloc(CONFIG_DEV_LOOP_ASYNC_NSECTORS * sectsize);
+#endif
+
   /* Open the file. */
 
   /* First try to open the device R/W access (unless we are asked
@@ -406,6 +676,14 @@ errout_with_file:
   file_close(&dev->devfile);
 
 errout_with_dev:
+#ifdef CONFIG_DEV_LOOP_ASYNC
+  if (dev->xfrbuf != NULL)
+    {
+      kmm_free(dev->xfrbuf);
+    }
+
+  nxsem_destroy(&dev->done);
+#endif
   nxmutex_destroy(&dev->lock);
   kmm_free(dev);
   return ret;
@@ -463,6 +741,21 @@ int loteardown(FAR const char *devname)
 
   ret = unregister_blockdriver(devname);
 
+#ifdef CONFIG_DEV_LOOP_ASYNC
+  /* Wait for any deferred transfer before closing the backing file */
+
+  nxmutex_lock(&dev->lock);
+  loop_async_flush(dev);
+  nxmutex_unlock(&dev->lock);
+
+  if (dev->xfrbuf != NULL)
+    {
+      kmm_free(dev->xfrbuf);
+    }
+
+  nxsem_destroy(&dev->done);
+#endif
+
   /* Release the device structure */
 
   if (dev->devfile.f_inode != NULL)
@@ -0,0 +1,372 @@
+/****************************************************************************
+ * drivers/misc/kbench.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+#include <nuttx/clock.h>
+#include <nuttx/fs/fs.h>
+#include <nuttx/kmalloc.h>
+#include <nuttx/kthread.h>
+#include <nuttx/mqueue.h>
+#include <nuttx/mutex.h>
+#include <nuttx/semaphore.h>
+#include <nuttx/drivers/drivers.h>
+
+#ifdef CONFIG_MM_IOB
+#  include <nuttx/mm/iob.h>
+#endif
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Number of iterations of each benchmarked operation.  Large enough to
+ * amortize the timestamp overhead, small enough to finish quickly even on
+ * slow parts.
+ */
+
+#define KBENCH_ITERATIONS  1000
+
+/* Size of the formatted result buffer held per open file */
+
+#define KBENCH_BUFSIZE     1024
+
+/* Priority of the ping-pong partner thread.  It must be higher than any
+ * plausible caller so that each semaphore post immediately switches to it.
+ */
+
+#define KBENCH_PONG_PRIO   (SCHED_PRIORITY_MAX - 1)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* Per-open state:  The benchmark suite runs once on the first read and the
+ * formatted results are then streamed from this buffer.
+ */
+
+struct kbench_state_s
+{
+  bool   done;                  /* True: suite has been run */
+  size_t len;                   /* Length of formatted results */
+  char   buf[KBENCH_BUFSIZE];   /* Formatted results */
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+static int     kbench_open(FAR struct file *filep);
+static int     kbench_close(FAR struct file *filep);
+static ssize_t kbench_read(FAR struct file *filep, FAR char *buffer,
+                           size_t buflen);
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const struct file_operations g_kbench_fops =
+{
+  kbench_open,   /* open */
+  kbench_close,  /* close */
+  kbench_read,   /* read */
+};
+
+/* Ping-pong semaphores shared with the partner thread.  A single suite run
+ * at a time is enforced by g_kbench_lock.
+ */
+
+static mutex_t g_kbench_lock = NXMUTEX_INITIALIZER;
+static sem_t g_kbench_ping;
+static sem_t g_kbench_pong;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: kbench_emit
+ *
+ * Description:
+ *   Append one result line in the machine-readable form
+ *   "name,iterations,total,per_op" where total and per_op are in perf
+ *   timer ticks.
+ *
+ ****************************************************************************/
+
+static void kbench_emit(FAR struct kbench_state_s *state,
+                        FAR const char *name, unsigned long elapsed)
+{
+  state->len += snprintf(state->buf + state->len,
+                         sizeof(state->buf) - state->len,
+                         "%s,%u,%lu,%lu\n", name, KBENCH_ITERATIONS,
+                         elapsed, elapsed / KBENCH_ITERATIONS);
+}
+
+/****************************************************************************
+ * Name: kbench_pong_thread
+ *
+ * Description:
+ *   Partner of the context switch benchmark.  Runs at high priority and
+ *   echoes each post of the ping semaphore back on the pong semaphore,
+ *   forcing two context switches per round trip.
+ *
+ ****************************************************************************/
+
+static int kbench_pong_thread(int argc, FAR char *argv[])
+{
+  int i;
+
+  for (i = 0; i < KBENCH_ITERATIONS; i++)
+    {
+      nxsem_wait_uninterruptible(&g_kbench_ping);
+      nxsem_post(&g_kbench_pong);
+    }
+
+  return 0;
+}
+
+/****************************************************************************
+ * Name: kbench_run
+ *
+ * Description:
+ *   Run the benchmark suite and format the results into the state buffer.
+ *
+ ****************************************************************************/
+
+static void kbench_run(FAR struct kbench_state_s *state)
+{
+  unsigned long start;
+  struct file mq;
+  sem_t sem;
+  mutex_t mutex;
+  FAR void *mem;
+  char msg[32];
+  int pid;
+  int ret;
+  int i;
+
+  state->len = 0;
+  state->len += snprintf(state->buf, sizeof(state->buf),
+                         "name,iterations,total,per_op\nfreq,1,%lu,%lu\n",
+                         perf_getfreq(), perf_getfreq());
+
+  /* Context switch:  Semaphore ping-pong against a higher priority thread.
+   * Each iteration is one round trip, i.e. two context switches.
+   */
+
+  nxsem_init(&g_kbench_ping, 0, 0);
+  nxsem_init(&g_kbench_pong, 0, 0);
+
+  pid = kthread_create("kbench", KBENCH_PONG_PRIO,
+                       CONFIG_DEFAULT_TASK_STACKSIZE,
+                       kbench_pong_thread, NULL);
+  if (pid > 0)
+    {
+      start = perf_gettime();
+      for (i = 0; i < KBENCH_ITERATIONS; i++)
+        {
+          nxsem_post(&g_kbench_ping);
+          nxsem_wait_uninterruptible(&g_kbench_pong);
+        }
+
+      kbench_emit(state, "ctxswitch2", perf_gettime() - start);
+    }
+
+  nxsem_destroy(&g_kbench_ping);
+  nxsem_destroy(&g_kbench_pong);
+
+  /* Semaphore:  Uncontended post/wait pair on the caller's thread */
+
+  nxsem_init(&sem, 0, 0);
+
+  start = perf_gettime();
+  for (i = 0; i < KBENCH_ITERATIONS; i++)
+    {
+      nxsem_post(&sem);
+      nxsem_wait_uninterruptible(&sem);
+    }
+
+  kbench_emit(state, "sem", perf_gettime() - start);
+  nxsem_destroy(&sem);
+
+  /* Mutex:  Uncontended lock/unlock pair */
+
+  nxmutex_init(&mutex);
+
+  start = perf_gettime();
+  for (i = 0; i < KBENCH_ITERATIONS; i++)
+    {
+      nxmutex_lock(&mutex);
+      nxmutex_unlock(&mutex);
+    }
+
+  kbench_emit(state, "mutex", perf_gettime() - start);
+  nxmutex_destroy(&mutex);
+
+  /* Message queue:  Send/receive round trip through a depth-one queue.
+   * The receive never blocks because the message was just queued.
+   */
+
+  ret = file_mq_open(&mq, "kbench", O_RDWR | O_CREAT, 0666, NULL);
+  if (ret >= 0)
+    {
+      start = perf_gettime();
+      for (i = 0; i < KBENCH_ITERATIONS; i++)
+        {
+          file_mq_send(&mq, msg, sizeof(msg), 1);
+          file_mq_receive(&mq, msg, sizeof(msg), NULL);
+        }
+
+      kbench_emit(state, "mqueue", perf_gettime() - start);
+      file_mq_close(&mq);
+      file_mq_unlink("kbench");
+    }
+
+  /* Allocator:  Small kernel heap allocate/free pair */
+
+  start = perf_gettime();
+  for (i = 0; i < KBENCH_ITERATIONS; i++)
+    {
+      mem = kmm_malloc(64);
+      kmm_free(mem);
+    }
+
+  kbench_emit(state, "kmalloc", perf_gettime() - start);
+
+#ifdef CONFIG_MM_IOB
+  /* IOB:  Allocate/free pair from the I/O buffer pool */
+
+  start = perf_gettime();
+  for (i = 0; i < KBENCH_ITERATIONS; i++)
+    {
+      FAR struct iob_s *iob = iob_tryalloc(false);
+      if (iob != NULL)
+        {
+          iob_free(iob);
+        }
+    }
+
+  kbench_emit(state, "iob", perf_gettime() - start);
+#endif
+}
+
+/****************************************************************************
+ * Name: kbench_open
+ ****************************************************************************/
+
+static int kbench_open(FAR struct file *filep)
+{
+  FAR struct kbench_state_s *state;
+
+  state = kmm_zalloc(sizeof(struct kbench_state_s));
+  if (state == NULL)
+    {
+      return -ENOMEM;
+    }
+
+  filep->f_priv = state;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: kbench_close
+ ****************************************************************************/
+
+static int kbench_close(FAR struct file *filep)
+{
+  kmm_free(filep->f_priv);
+  return OK;
+}
+
+/****************************************************************************
+ * Name: kbench_read
+ ****************************************************************************/
+
+static ssize_t kbench_read(FAR struct file *filep, FAR char *buffer,
+                           size_t buflen)
+{
+  FAR struct kbench_state_s *state = filep->f_priv;
+  size_t remaining;
+  int ret;
+
+  if (!state->done)
+    {
+      ret = nxmutex_lock(&g_kbench_lock);
+      if (ret < 0)
+        {
+          return ret;
+        }
+
+      kbench_run(state);
+      nxmutex_unlock(&g_kbench_lock);
+      state->done = true;
+    }
+
+  if ((size_t)filep->f_pos >= state->len)
+    {
+      return 0;
+    }
+
+  remaining = state->len - filep->f_pos;
+  if (buflen > remaining)
+    {
+      buflen = remaining;
+    }
+
+  memcpy(buffer, state->buf + filep->f_pos, buflen);
+  filep->f_pos += buflen;
+  return buflen;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: kbench_register
+ *
+ * Description:
+ *   Register /dev/kbench.  Each read of the device runs the kernel
+ *   primitive benchmark suite once and returns the results as CSV lines
+ *   "name,iterations,total,per_op" with times in perf timer ticks.
+ *
+ * Input Parameters:
+ *   None
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void kbench_register(void)
+{
+  register_driver("/dev/kbench", &g_kbench_fops, 0444, NULL);
+}
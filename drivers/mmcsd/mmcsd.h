@@ -42,6 +42,19 @@
 #  undef CONFIG_MMCSD_DUMPALL
 #endif
 
+/* The DMA bounce buffer is only usable if the SDIO driver performs DMA and
+ * can check caller buffers for DMA suitability ahead of the transfer.
+ */
+
+#if !defined(CONFIG_SDIO_DMA) || !defined(CONFIG_ARCH_HAVE_SDIO_PREFLIGHT)
+#  undef CONFIG_MMCSD_DMA_BOUNCE_NSECTORS
+#endif
+
+#if defined(CONFIG_MMCSD_DMA_BOUNCE_NSECTORS) && \
+    CONFIG_MMCSD_DMA_BOUNCE_NSECTORS > 0
+#  define MMCSD_DMA_BOUNCE 1
+#endif
+
 /* Card type */
 
 #define MMCSD_CARDTYPE_UNKNOWN       0  /* Unknown card type */
@@ -103,6 +116,10 @@ struct mmcsd_state_s
 
   uint8_t  blockshift;             /* Log2 of blocksize */
   uint16_t blocksize;              /* Read block length (== block size) */
+
+#ifdef MMCSD_DMA_BOUNCE
+  FAR uint8_t *bounce;             /* DMA-able staging buffer (or NULL) */
+#endif
 };
 
 /****************************************************************************
@@ -176,6 +176,9 @@ static ssize_t mmcsd_readmultiple(FAR struct mmcsd_state_s *priv,
                                   FAR uint8_t *buffer, off_t startblock,
                                   size_t nblocks);
 #endif
+static ssize_t mmcsd_readblocks(FAR struct mmcsd_state_s *priv,
+                                FAR uint8_t *buffer, off_t startblock,
+                                size_t nblocks);
 static ssize_t mmcsd_writesingle(FAR struct mmcsd_state_s *priv,
                                  FAR const uint8_t *buffer,
                                  off_t startblock);
@@ -185,6 +188,12 @@ static ssize_t mmcsd_writemultiple(FAR struct mmcsd_state_s *priv,
                                    off_t startblock,
                                    size_t nblocks);
 #endif
+static ssize_t mmcsd_writeblocks(FAR struct mmcsd_state_s *priv,
+                                 FAR const uint8_t *buffer,
+                                 off_t startblock, size_t nblocks);
+#ifdef MMCSD_DMA_BOUNCE
+static int     mmcsd_allocbounce(FAR struct mmcsd_state_s *priv);
+#endif
 
 /* Block driver methods *****************************************************/
 
@@ -1750,6 +1759,30 @@ static ssize_t mmcsd_readmultiple(FAR struct mmcsd_state_s *priv,
 }
 #endif
 
+/****************************************************************************
+ * Name: mmcsd_readblocks
+ *
+ * Description:
+ *   Read 'nblocks' contiguous blocks, using the single block transfer
+ *   method if only one block is requested and the multiple block transfer
+ *   method otherwise.
+ *
+ ****************************************************************************/
+
+static ssize_t mmcsd_readblocks(FAR struct mmcsd_state_s *priv,
+                                FAR uint8_t *buffer, off_t startblock,
+                                size_t nblocks)
+{
+#if MMCSD_MULTIBLOCK_LIMIT != 1
+  if (nblocks > 1)
+    {
+      return mmcsd_readmultiple(priv, buffer, startblock, nblocks);
+    }
+#endif
+
+  return mmcsd_readsingle(priv, buffer, startblock);
+}
+
 /****************************************************************************
  * Name: mmcsd_writesingle
  *
@@ -2165,6 +2198,68 @@ static ssize_t mmcsd_writemultiple(FAR struct mmcsd_state_s *priv,
 }
 #endif
 
+/****************************************************************************
+ * Name: mmcsd_writeblocks
+ *
+ * Description:
+ *   Write 'nblocks' contiguous blocks, using the single block transfer
+ *   method if only one block is provided and the multiple block transfer
+ *   method otherwise.
+ *
+ ****************************************************************************/
+
+static ssize_t mmcsd_writeblocks(FAR struct mmcsd_state_s *priv,
+                                 FAR const uint8_t *buffer,
+                                 off_t startblock, size_t nblocks)
+{
+#if MMCSD_MULTIBLOCK_LIMIT != 1
+  if (nblocks > 1)
+    {
+      return mmcsd_writemultiple(priv, buffer, startblock, nblocks);
+    }
+#endif
+
+  return mmcsd_writesingle(priv, buffer, startblock);
+}
+
+/****************************************************************************
+ * Name: mmcsd_allocbounce
+ *
+ * Description:
+ *   Make sure that the DMA bounce buffer is allocated and usable for DMA.
+ *   The bounce buffer is allocated lazily on the first transfer from a
+ *   buffer that fails the SDIO DMA preflight check.
+ *
+ ****************************************************************************/
+
+#ifdef MMCSD_DMA_BOUNCE
+static int mmcsd_allocbounce(FAR struct mmcsd_state_s *priv)
+{
+  size_t nbytes = CONFIG_MMCSD_DMA_BOUNCE_NSECTORS << priv->blockshift;
+
+  if (priv->bounce == NULL)
+    {
+      /* Align the allocation to the block size.  That satisfies the DMA
+       * address constraints of any of the SDIO controllers.
+       */
+
+      priv->bounce = kmm_memalign(priv->blocksize, nbytes);
+      if (priv->bounce != NULL &&
+          SDIO_DMAPREFLIGHT(priv->dev, priv->bounce, nbytes) != OK)
+        {
+          /* The controller cannot perform DMA from the bounce buffer
+           * either; there is nothing more that we can do.
+           */
+
+          kmm_free(priv->bounce);
+          priv->bounce = NULL;
+        }
+    }
+
+  return priv->bounce != NULL ? OK : -ENOMEM;
+}
+#endif
+
 /****************************************************************************
  * Name: mmcsd_open
  *
@@ -2248,6 +2343,9 @@ static ssize_t mmcsd_read(FAR struct inode *inode, unsigned char *buffer,
   size_t endsector;
   ssize_t nread;
   ssize_t ret = nsectors;
+#ifdef MMCSD_DMA_BOUNCE
+  bool bounce = false;
+#endif
 
   DEBUGASSERT(inode->i_private);
   part = inode->i_private;
@@ -2264,33 +2362,54 @@ static ssize_t mmcsd_read(FAR struct inode *inode, unsigned char *buffer,
           return ret;
         }
 
+#ifdef MMCSD_DMA_BOUNCE
+      /* If the controller would refuse to perform DMA directly from the
+       * caller's buffer (typically because it is improperly aligned),
+       * stage the transfer through the aligned bounce buffer rather than
+       * failing the transfer.
+       */
+
+      if ((priv->caps & SDIO_CAPS_DMASUPPORTED) != 0 &&
+          SDIO_DMAPREFLIGHT(priv->dev, buffer,
+                            (size_t)nsectors << priv->blockshift) != OK)
+        {
+          bounce = (mmcsd_allocbounce(priv) == OK);
+        }
+#endif
+
       ret = nsectors;
       endsector = startsector + nsectors;
       for (sector = startsector; sector < endsector; sector += nread)
         {
-          /* Read this sector into the user buffer */
+          /* Read this chunk of sectors into the user buffer */
 
-#if MMCSD_MULTIBLOCK_LIMIT == 1
-          /* Read each block using only the single block transfer method */
-
-          nread = mmcsd_readsingle(priv, buffer, sector);
-#else
           nread = endsector - sector;
           if (nread > MMCSD_MULTIBLOCK_LIMIT)
             {
               nread = MMCSD_MULTIBLOCK_LIMIT;
             }
 
-          if (nread == 1)
+#ifdef MMCSD_DMA_BOUNCE
+          if (bounce)
             {
-              nread = mmcsd_readsingle(priv, buffer, sector);
+              if (nread > CONFIG_MMCSD_DMA_BOUNCE_NSECTORS)
+                {
+                  nread = CONFIG_MMCSD_DMA_BOUNCE_NSECTORS;
+                }
+
+              nread = mmcsd_readblocks(priv, priv->bounce, sector, nread);
+              if (nread > 0)
+                {
+                  memcpy(buffer, priv->bounce,
+                         (size_t)nread << priv->blockshift);
+                }
             }
           else
+#endif
             {
-              nread = mmcsd_readmultiple(priv, buffer, sector, nread);
+              nread = mmcsd_readblocks(priv, buffer, sector, nread);
             }
 
-#endif
           if (nread < 0)
             {
               ret = nread;
@@ -2329,6 +2448,9 @@ static ssize_t mmcsd_write(FAR struct inode *inode,
   size_t endsector;
   ssize_t nwrite;
   ssize_t ret = nsectors;
+#ifdef MMCSD_DMA_BOUNCE
+  bool bounce = false;
+#endif
 
   DEBUGASSERT(inode->i_private);
   part = inode->i_private;
@@ -2345,33 +2467,52 @@ static ssize_t mmcsd_write(FAR struct inode *inode,
           return ret;
         }
 
+#ifdef MMCSD_DMA_BOUNCE
+      /* If the controller would refuse to perform DMA directly from the
+       * caller's buffer (typically because it is improperly aligned),
+       * stage the transfer through the aligned bounce buffer rather than
+       * failing the transfer.
+       */
+
+      if ((priv->caps & SDIO_CAPS_DMASUPPORTED) != 0 &&
+          SDIO_DMAPREFLIGHT(priv->dev, buffer,
+                            (size_t)nsectors << priv->blockshift) != OK)
+        {
+          bounce = (mmcsd_allocbounce(priv) == OK);
+        }
+#endif
+
       ret = nsectors;
       endsector = startsector + nsectors;
       for (sector = startsector; sector < endsector; sector += nwrite)
         {
-          /* Write this sector into the user buffer */
-
-#if MMCSD_MULTIBLOCK_LIMIT == 1
-          /* Write each block using only the single block transfer method */
+          /* Write this chunk of sectors from the user buffer */
 
-          nwrite = mmcsd_writesingle(priv, buffer, sector);
-#else
           nwrite = endsector - sector;
           if (nwrite > MMCSD_MULTIBLOCK_LIMIT)
             {
               nwrite = MMCSD_MULTIBLOCK_LIMIT;
             }
 
-          if (nwrite == 1)
+#ifdef MMCSD_DMA_BOUNCE
+          if (bounce)
             {
-              nwrite = mmcsd_writesingle(priv, buffer, sector);
+              if (nwrite > CONFIG_MMCSD_DMA_BOUNCE_NSECTORS)
+                {
+                  nwrite = CONFIG_MMCSD_DMA_BOUNCE_NSECTORS;
+                }
+
+              memcpy(priv->bounce, buffer,
+                     (size_t)nwrite << priv->blockshift);
+              nwrite = mmcsd_writeblocks(priv, priv->bounce, sector,
+                                         nwrite);
             }
           else
+#endif
             {
-              nwrite = mmcsd_writemultiple(priv, buffer, sector, nwrite);
+              nwrite = mmcsd_writeblocks(priv, buffer, sector, nwrite);
             }
 
-#endif
           if (nwrite < 0)
             {
               ret = nwrite;
@@ -4177,6 +4318,18 @@ static int mmcsd_removed(FAR struct mmcsd_state_s *priv)
   priv->rca          = 0;
   priv->selblocklen  = 0;
 
+#ifdef MMCSD_DMA_BOUNCE
+  /* Free the DMA bounce buffer.  The next card may have a different block
+   * geometry; the buffer will be re-allocated if it is needed again.
+   */
+
+  if (priv->bounce != NULL)
+    {
+      kmm_free(priv->bounce);
+      priv->bounce = NULL;
+    }
+#endif
+
   /* Go back to the default 1-bit data bus. */
 
   priv->buswidth     = MMCSD_SCR_BUSWIDTH_1BIT;
@@ -0,0 +1,481 @@
+/****************************************************************************
+ * drivers/mtd/mtd_async.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/* MTD driver that contains another MTD driver and performs the (slow)
+ * erase operations asynchronously on the low-priority work queue.  The
+ * caller of erase() returns immediately; reads and writes touching a
+ * block whose erase is still pending complete that erase first, while
+ * accesses to unrelated blocks bypass the erase queue entirely.
+ */
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+
+#include <assert.h>
+#include <debug.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <nuttx/fs/ioctl.h>
+#include <nuttx/kmalloc.h>
+#include <nuttx/mtd/mtd.h>
+#include <nuttx/mutex.h>
+#include <nuttx/queue.h>
+#include <nuttx/semaphore.h>
+#include <nuttx/wqueue.h>
+
+#ifdef CONFIG_MTD_ASYNC_ERASE
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* One range of erase blocks waiting to be erased */
+
+struct mtd_async_range_s
+{
+  sq_entry_t             entry;      /* Supports a singly linked list */
+  off_t                  block;      /* First erase block in the range */
+  size_t                 nblocks;    /* Number of erase blocks */
+};
+
+/* This type represents the state of the MTD device.  The struct mtd_dev_s
+ * must appear at the beginning of the definition so that you can freely
+ * cast between pointers to struct mtd_dev_s and struct mtd_async_s.
+ */
+
+struct mtd_async_s
+{
+  struct mtd_dev_s       mtd;        /* Our exported MTD interface */
+  FAR struct mtd_dev_s  *dev;        /* Saved lower level MTD instance */
+  sq_queue_t             pending;    /* Erase ranges not yet started */
+  mutex_t                lock;       /* Protects the erase queue state */
+  sem_t                  done;       /* Signals completion of an erase */
+  struct work_s          work;       /* Supports the deferred erases */
+  uint32_t               blocksize;  /* Size of one read/write block */
+  uint16_t               spb;        /* Number of sectors per erase block */
+  uint16_t               waiters;    /* Threads waiting on the erase */
+  bool                   inprogress; /* An erase is running right now */
+  off_t                  ipblock;    /* First erase block being erased */
+  size_t                 ipnblocks;  /* Number of erase blocks erasing */
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+static void mtd_async_worker(FAR void *arg);
+static void mtd_async_sync(FAR struct mtd_async_s *priv,
+                           off_t sector, size_t nsectors);
+
+/* MTD driver methods */
+
+static int mtd_async_erase(FAR struct mtd_dev_s *dev,
+                           off_t block, size_t nblocks);
+static ssize_t mtd_async_bread(FAR struct mtd_dev_s *dev, off_t sector,
+                               size_t nsectors, FAR uint8_t *buffer);
+static ssize_t mtd_async_bwrite(FAR struct mtd_dev_s *dev, off_t sector,
+                                size_t nsectors, FAR const uint8_t *buffer);
+static ssize_t mtd_async_read(FAR struct mtd_dev_s *dev, off_t offset,
+                              size_t nbytes, FAR uint8_t *buffer);
+#ifdef CONFIG_MTD_BYTE_WRITE
+static ssize_t mtd_async_write(FAR struct mtd_dev_s *dev, off_t offset,
+                               size_t nbytes, FAR const uint8_t *buffer);
+#endif
+static int mtd_async_ioctl(FAR struct mtd_dev_s *dev, int cmd,
+                           unsigned long arg);
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mtd_async_overlap
+ *
+ * Description:
+ *   Check if a range of erase blocks overlaps a range of sectors.
+ *
+ ****************************************************************************/
+
+static bool mtd_async_overlap(FAR struct mtd_async_s *priv,
+                              off_t block, size_t nblocks,
+                              off_t sector, size_t nsectors)
+{
+  off_t first = block * priv->spb;
+  off_t last  = (block + nblocks) * priv->spb;
+
+  return sector < last && first < (off_t)(sector + nsectors);
+}
+
+/****************************************************************************
+ * Name: mtd_async_worker
+ *
+ * Description:
+ *   Drain the erase queue on the low-priority work queue.  The queue lock
+ *   is never held across the lower level erase so that readers and
+ *   writers of unrelated blocks are not delayed.
+ *
+ ****************************************************************************/
+
+static void mtd_async_worker(FAR void *arg)
+{
+  FAR struct mtd_async_s *priv = arg;
+  FAR struct mtd_async_range_s *range;
+  FAR sq_entry_t *entry;
+  uint16_t waiters;
+  int ret;
+
+  for (; ; )
+    {
+      nxmutex_lock(&priv->lock);
+      entry = sq_remfirst(&priv->pending);
+      if (entry == NULL)
+        {
+          nxmutex_unlock(&priv->lock);
+          return;
+        }
+
+      range            = (FAR struct mtd_async_range_s *)entry;
+      priv->inprogress = true;
+      priv->ipblock    = range->block;
+      priv->ipnblocks  = range->nblocks;
+      nxmutex_unlock(&priv->lock);
+
+      ret = priv->dev->erase(priv->dev, range->block, range->nblocks);
+      if (ret < 0)
+        {
+          ferr("ERROR: deferred erase of %" PRIdOFF "/%zu failed: %d\n",
+               range->block, range->nblocks, ret);
+        }
+
+      kmm_free(range);
+
+      /* The erase is complete.  Wake up any thread that was waiting for
+       * this range before accessing it.
+       */
+
+      nxmutex_lock(&priv->lock);
+      priv->inprogress = false;
+      waiters          = priv->waiters;
+      priv->waiters    = 0;
+      nxmutex_unlock(&priv->lock);
+
+      while (waiters-- > 0)
+        {
+          nxsem_post(&priv->done);
+        }
+    }
+}
+
+/****************************************************************************
+ * Name: mtd_async_sync
+ *
+ * Description:
+ *   Make sure that no pending or in-progress erase overlaps the given
+ *   range of sectors.  Overlapping queued erases are completed in the
+ *   caller's context; an overlapping in-progress erase is waited for.
+ *   Accesses to blocks with no pending erase return immediately.
+ *
+ ****************************************************************************/
+
+static void mtd_async_sync(FAR struct mtd_async_s *priv,
+                           off_t sector, size_t nsectors)
+{
+  FAR struct mtd_async_range_s *range;
+  FAR sq_entry_t *entry;
+  FAR sq_entry_t *prev;
+
+restart:
+  nxmutex_lock(&priv->lock);
+
+  for (prev = NULL, entry = sq_peek(&priv->pending); entry != NULL;
+       prev = entry, entry = sq_next(entry))
+    {
+      range = (FAR struct mtd_async_range_s *)entry;
+      if (mtd_async_overlap(priv, range->block, range->nblocks,
+                            sector, nsectors))
+        {
+          /* Claim this range and erase it ourselves.  The list may
+           * change while the lock is released, so restart the scan.
+           */
+
+          if (prev != NULL)
+            {
+              sq_remafter(prev, &priv->pending);
+            }
+          else
+            {
+              sq_remfirst(&priv->pending);
+            }
+
+          nxmutex_unlock(&priv->lock);
+
+          priv->dev->erase(priv->dev, range->block, range->nblocks);
+          kmm_free(range);
+          goto restart;
+        }
+    }
+
+  if (priv->inprogress &&
+      mtd_async_overlap(priv, priv->ipblock, priv->ipnblocks,
+                        sector, nsectors))
+    {
+      priv->waiters++;
+      nxmutex_unlock(&priv->lock);
+      nxsem_wait_uninterruptible(&priv->done);
+      goto restart;
+    }
+
+  nxmutex_unlock(&priv->lock);
+}
+
+/****************************************************************************
+ * Name: mtd_async_erase
+ ****************************************************************************/
+
+static int mtd_async_erase(FAR struct mtd_dev_s *dev,
+                           off_t block, size_t nblocks)
+{
+  FAR struct mtd_async_s *priv = (FAR struct mtd_async_s *)dev;
+  FAR struct mtd_async_range_s *range;
+  FAR sq_entry_t *entry;
+
+  /* Fall back to a synchronous erase if the range cannot be queued */
+
+  range = kmm_malloc(sizeof(struct mtd_async_range_s));
+  if (range == NULL)
+    {
+      return priv->dev->erase(priv->dev, block, nblocks);
+    }
+
+  range->block   = block;
+  range->nblocks = nblocks;
+
+  nxmutex_lock(&priv->lock);
+
+  /* Drop the request if an identical range is already queued */
+
+  for (entry = sq_peek(&priv->pending); entry != NULL;
+       entry = sq_next(entry))
+    {
+      FAR struct mtd_async_range_s *queued =
+        (FAR struct mtd_async_range_s *)entry;
+
+      if (queued->block == block && queued->nblocks == nblocks)
+        {
+          nxmutex_unlock(&priv->lock);
+          kmm_free(range);
+          return OK;
+        }
+    }
+
+  sq_addlast(&range->entry, &priv->pending);
+  nxmutex_unlock(&priv->lock);
+
+  /* (Re-)schedule the drain.  work_queue() replaces any pending
+   * instance of the work, so this never loses a queued range.
+   */
+
+  work_queue(LPWORK, &priv->work, mtd_async_worker, priv, 0);
+  return OK;
+}
+
+/****************************************************************************
+ * Name: mtd_async_bread
+ ****************************************************************************/
+
+static ssize_t mtd_async_bread(FAR struct mtd_dev_s *dev, off_t sector,
+                               size_t nsectors, FAR uint8_t *buffer)
+{
+  FAR struct mtd_async_s *priv = (FAR struct mtd_async_s *)dev;
+
+  mtd_async_sync(priv, sector, nsectors);
+  return priv->dev->bread(priv->dev, sector, nsectors, buffer);
+}
+
+/****************************************************************************
+ * Name: mtd_async_bwrite
+ ****************************************************************************/
+
+static ssize_t mtd_async_bwrite(FAR struct mtd_dev_s *dev, off_t sector,
+                                size_t nsectors, FAR const uint8_t *buffer)
+{
+  FAR struct mtd_async_s *priv = (FAR struct mtd_async_s *)dev;
+
+  mtd_async_sync(priv, sector, nsectors);
+  return priv->dev->bwrite(priv->dev, sector, nsectors, buffer);
+}
+
+/****************************************************************************
+ * Name: mtd_async_read
+ ****************************************************************************/
+
+static ssize_t mtd_async_read(FAR struct mtd_dev_s *dev, off_t offset,
+                              size_t nbytes, FAR uint8_t *buffer)
+{
+  FAR struct mtd_async_s *priv = (FAR struct mtd_async_s *)dev;
+  off_t sector  = offset / priv->blocksize;
+  off_t last    = (offset + nbytes + priv->blocksize - 1) /
+                  priv->blocksize;
+
+  mtd_async_sync(priv, sector, last - sector);
+  return priv->dev->read(priv->dev, offset, nbytes, buffer);
+}
+
+/****************************************************************************
+ * Name: mtd_async_write
+ ****************************************************************************/
+
+#ifdef CONFIG_MTD_BYTE_WRITE
+static ssize_t mtd_async_write(FAR struct mtd_dev_s *dev, off_t offset,
+                               size_t nbytes, FAR const uint8_t *buffer)
+{
+  FAR struct mtd_async_s *priv = (FAR struct mtd_async_s *)dev;
+  off_t sector  = offset / priv->blocksize;
+  off_t last    = (offset + nbytes + priv->blocksize - 1) /
+                  priv->blocksize;
+
+  mtd_async_sync(priv, sector, last - sector);
+  return priv->dev->write(priv->dev, offset, nbytes, buffer);
+}
+#endif
+
+/****************************************************************************
+ * Name: mtd_async_ioctl
+ ****************************************************************************/
+
+static int mtd_async_ioctl(FAR struct mtd_dev_s *dev, int cmd,
+                           unsigned long arg)
+{
+  FAR struct mtd_async_s *priv = (FAR struct mtd_async_s *)dev;
+  FAR sq_entry_t *entry;
+
+  if (cmd == MTDIOC_BULKERASE)
+    {
+      /* The bulk erase covers every block; individually queued erases
+       * become redundant.  Discard them, then wait out any erase that
+       * is already running.
+       */
+
+      nxmutex_lock(&priv->lock);
+      while ((entry = sq_remfirst(&priv->pending)) != NULL)
+        {
+          kmm_free(entry);
+        }
+
+      while (priv->inprogress)
+        {
+          priv->waiters++;
+          nxmutex_unlock(&priv->lock);
+          nxsem_wait_uninterruptible(&priv->done);
+          nxmutex_lock(&priv->lock);
+        }
+
+      nxmutex_unlock(&priv->lock);
+    }
+
+  return priv->dev->ioctl(priv->dev, cmd, arg);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mtd_async_initialize
+ *
+ * Description:
+ *   Create an initialized MTD device instance.  This MTD driver contains
+ *   another MTD driver and performs its erase operations in the
+ *   background on the low-priority work queue.  Reads and writes that do
+ *   not touch a block with a pending erase are never delayed by an
+ *   erase; accesses that do touch such a block complete the erase first.
+ *
+ *   MTD devices are not registered in the file system, but are created as
+ *   instances that can be bound to other functions (such as a block or
+ *   character driver front end).
+ *
+ ****************************************************************************/
+
+FAR struct mtd_dev_s *mtd_async_initialize(FAR struct mtd_dev_s *mtd)
+{
+  FAR struct mtd_async_s *priv;
+  struct mtd_geometry_s geo;
+  int ret;
+
+  finfo("mtd: %p\n", mtd);
+  DEBUGASSERT(mtd != NULL && mtd->ioctl != NULL);
+
+  /* Get the device geometry */
+
+  ret = mtd->ioctl(mtd, MTDIOC_GEOMETRY, (unsigned long)((uintptr_t)&geo));
+  if (ret < 0)
+    {
+      ferr("ERROR: MTDIOC_GEOMETRY ioctl failed: %d\n", ret);
+      return NULL;
+    }
+
+  /* Allocate and initialize the wrapper structure */
+
+  priv = (FAR struct mtd_async_s *)kmm_zalloc(sizeof(struct mtd_async_s));
+  if (priv == NULL)
+    {
+      ferr("ERROR: Failed to allocate mtd_async\n");
+      return NULL;
+    }
+
+  priv->mtd.erase     = mtd_async_erase;
+  priv->mtd.bread     = mtd_async_bread;
+  priv->mtd.bwrite    = mtd_async_bwrite;
+  if (mtd->read != NULL)
+    {
+      priv->mtd.read  = mtd_async_read;
+    }
+
+#ifdef CONFIG_MTD_BYTE_WRITE
+  if (mtd->write != NULL)
+    {
+      priv->mtd.write = mtd_async_write;
+    }
+
+#endif
+  priv->mtd.ioctl     = mtd_async_ioctl;
+  priv->mtd.name      = "async";
+
+  priv->dev           = mtd;
+  priv->blocksize     = geo.blocksize;
+  priv->spb           = geo.erasesize / geo.blocksize;
+  DEBUGASSERT((uint32_t)priv->spb * geo.blocksize == geo.erasesize);
+
+  sq_init(&priv->pending);
+  nxmutex_init(&priv->lock);
+  nxsem_init(&priv->done, 0, 0);
+
+  return &priv->mtd;
+}
+
+#endif /* CONFIG_MTD_ASYNC_ERASE */
@@ -0,0 +1,566 @@
+/****************************************************************************
+ * drivers/mtd/mtd_interleave.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/* MTD driver that combines several MTD driver instances with identical
+ * geometry (for example the individual dice of a multi-die NAND) into one
+ * logical device by interleaving erase blocks across them:  Logical erase
+ * block i resides on device i % count.  Operations that span several
+ * erase blocks are split by device and the parts for the second and
+ * subsequent devices run on the low-priority work queue, overlapping the
+ * program/erase busy times of the devices.
+ */
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/param.h>
+#include <sys/types.h>
+
+#include <assert.h>
+#include <debug.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <nuttx/fs/ioctl.h>
+#include <nuttx/kmalloc.h>
+#include <nuttx/mtd/mtd.h>
+#include <nuttx/mutex.h>
+#include <nuttx/semaphore.h>
+#include <nuttx/wqueue.h>
+
+#ifdef CONFIG_MTD_INTERLEAVE
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct mtd_interleave_s;
+
+/* The operations that can be split across the underlying devices */
+
+enum mtd_interleave_op_e
+{
+  MTD_INTERLEAVE_READ = 0,
+  MTD_INTERLEAVE_WRITE,
+  MTD_INTERLEAVE_ERASE
+};
+
+/* One device's share of a split operation.  There is one (pre-allocated)
+ * task per underlying device; the device lock serializes their re-use.
+ */
+
+struct mtd_interleave_task_s
+{
+  struct work_s              work;   /* Supports the parallel dispatch */
+  FAR struct mtd_interleave_s *priv; /* The interleave device */
+  unsigned int               die;    /* Index of the underlying device */
+  uint8_t                    op;     /* See enum mtd_interleave_op_e */
+  off_t                      startblock; /* Logical start of the range */
+  size_t                     nblocks;    /* Logical size of the range */
+  FAR uint8_t               *buffer; /* User buffer for the whole range */
+  ssize_t                    result; /* Result of this device's share */
+  sem_t                      done;   /* Signals completion of the share */
+};
+
+/* This type represents the state of the MTD device.  The struct mtd_dev_s
+ * must appear at the beginning of the definition so that you can freely
+ * cast between pointers to struct mtd_dev_s and struct mtd_interleave_s.
+ */
+
+struct mtd_interleave_s
+{
+  struct mtd_dev_s           mtd;    /* Our exported MTD interface */
+  FAR struct mtd_dev_s     **devs;   /* The underlying MTD instances */
+  FAR struct mtd_interleave_task_s *tasks; /* One task per device */
+  unsigned int               count;  /* Number of underlying devices */
+  mutex_t                    lock;   /* Serializes split operations */
+  uint32_t                   blocksize;    /* Size of one r/w block */
+  uint32_t                   erasesize;    /* Size of one erase block */
+  uint32_t                   neraseblocks; /* Per underlying device */
+  uint16_t                   spb;    /* R/W blocks per erase block */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mtd_interleave_stride
+ *
+ * Description:
+ *   Execute one device's share of an operation on a logical block range:
+ *   Every erase block whose logical number is congruent to 'die' modulo
+ *   the device count.  Consecutive logical erase blocks of one die map to
+ *   consecutive physical erase blocks, so an erase range needs a single
+ *   lower level call; read/write ranges are walked one erase block at a
+ *   time because the user buffer positions are interleaved.
+ *
+ * Returned Value:
+ *   The number of blocks processed on success (erase blocks for the
+ *   erase operation, read/write blocks otherwise); a negated errno value
+ *   is returned on any failure.
+ *
+ ****************************************************************************/
+
+static ssize_t mtd_interleave_stride(FAR struct mtd_interleave_s *priv,
+                                     unsigned int die, uint8_t op,
+                                     off_t startblock, size_t nblocks,
+                                     FAR uint8_t *buffer)
+{
+  FAR struct mtd_dev_s *dev = priv->devs[die];
+  ssize_t total = 0;
+  ssize_t ret;
+  off_t block;
+  off_t end;
+
+  if (op == MTD_INTERLEAVE_ERASE)
+    {
+      size_t n;
+
+      /* Find the first logical erase block of this die in the range */
+
+      block = startblock +
+              (die + priv->count - startblock % priv->count) % priv->count;
+      if (block >= (off_t)(startblock + nblocks))
+        {
+          return 0;
+        }
+
+      /* This die owns every count-th erase block of the range, and they
+       * are physically consecutive.
+       */
+
+      n = (startblock + nblocks - block + priv->count - 1) / priv->count;
+      ret = dev->erase(dev, block / priv->count, n);
+      return ret < 0 ? ret : (ssize_t)n;
+    }
+
+  /* Read/write:  Walk the range one erase block at a time and execute
+   * the erase blocks that belong to this die.
+   */
+
+  block = startblock;
+  end   = startblock + nblocks;
+
+  while (block < end)
+    {
+      off_t eb = block / priv->spb;
+      off_t next = (eb + 1) * priv->spb;
+      size_t chunk = MIN(end, next) - block;
+
+      if (eb % priv->count == die)
+        {
+          off_t pblock = (eb / priv->count) * priv->spb +
+                         (block - eb * priv->spb);
+          FAR uint8_t *dest = buffer +
+                              (block - startblock) * priv->blocksize;
+
+          if (op == MTD_INTERLEAVE_READ)
+            {
+              ret = dev->bread(dev, pblock, chunk, dest);
+            }
+          else
+            {
+              ret = dev->bwrite(dev, pblock, chunk, dest);
+            }
+
+          if (ret < 0)
+            {
+              return ret;
+            }
+
+          total += ret;
+          if ((size_t)ret != chunk)
+            {
+              break;
+            }
+        }
+
+      block += chunk;
+    }
+
+  return total;
+}
+
+/****************************************************************************
+ * Name: mtd_interleave_worker
+ *
+ * Description:
+ *   Execute one device's share of a split operation on the low-priority
+ *   work queue and signal its completion.
+ *
+ ****************************************************************************/
+
+static void mtd_interleave_worker(FAR void *arg)
+{
+  FAR struct mtd_interleave_task_s *task = arg;
+
+  task->result = mtd_interleave_stride(task->priv, task->die, task->op,
+                                       task->startblock, task->nblocks,
+                                       task->buffer);
+  nxsem_post(&task->done);
+}
+
+/****************************************************************************
+ * Name: mtd_interleave_dispatch
+ *
+ * Description:
+ *   Split an operation across the underlying devices.  The shares of the
+ *   second and subsequent devices are queued to the low-priority work
+ *   queue; the first device's share runs in the calling context.  An
+ *   operation confined to a single erase block involves only one device
+ *   and is executed entirely in the calling context.
+ *
+ * Returned Value:
+ *   The total number of blocks processed, or a negated errno value.
+ *
+ ****************************************************************************/
+
+static ssize_t mtd_interleave_dispatch(FAR struct mtd_interleave_s *priv,
+                                       uint8_t op, off_t startblock,
+                                       size_t nblocks, FAR uint8_t *buffer)
+{
+  unsigned int ndies = priv->count;
+  unsigned int die;
+  ssize_t total = 0;
+  ssize_t err = 0;
+  ssize_t ret;
+  size_t nebs;
+
+  if (nblocks == 0)
+    {
+      return 0;
+    }
+
+  /* How many erase blocks (and, hence, how many dies at most) does the
+   * range touch?
+   */
+
+  if (op == MTD_INTERLEAVE_ERASE)
+    {
+      nebs = nblocks;
+    }
+  else
+    {
+      nebs = (startblock + nblocks - 1) / priv->spb -
+             startblock / priv->spb + 1;
+    }
+
+  if (nebs < ndies)
+    {
+      ndies = nebs;
+    }
+
+  nxmutex_lock(&priv->lock);
+
+  /* Hand the shares of all but the first involved die to the work queue.
+   * The die indices are rotated so that 'first' is the die owning the
+   * first erase block of the range; dies without a share are skipped by
+   * the ndies clamp above.
+   */
+
+  for (die = 1; die < ndies; die++)
+    {
+      FAR struct mtd_interleave_task_s *task = &priv->tasks[die];
+      unsigned int first;
+
+      if (op == MTD_INTERLEAVE_ERASE)
+        {
+          first = startblock % priv->count;
+        }
+      else
+        {
+          first = (startblock / priv->spb) % priv->count;
+        }
+
+      task->die        = (first + die) % priv->count;
+      task->op         = op;
+      task->startblock = startblock;
+      task->nblocks    = nblocks;
+      task->buffer     = buffer;
+      work_queue(LPWORK, &task->work, mtd_interleave_worker, task, 0);
+    }
+
+  /* Execute the first die's share in this context */
+
+  ret = mtd_interleave_stride(priv,
+                              (op == MTD_INTERLEAVE_ERASE ?
+                               startblock % priv->count :
+                               (startblock / priv->spb) % priv->count),
+                              op, startblock, nblocks, buffer);
+  if (ret < 0)
+    {
+      err = ret;
+    }
+  else
+    {
+      total += ret;
+    }
+
+  /* Then collect the deferred shares */
+
+  for (die = 1; die < ndies; die++)
+    {
+      FAR struct mtd_interleave_task_s *task = &priv->tasks[die];
+
+      nxsem_wait_uninterruptible(&task->done);
+      if (task->result < 0)
+        {
+          err = task->result;
+        }
+      else
+        {
+          total += task->result;
+        }
+    }
+
+  nxmutex_unlock(&priv->lock);
+  return err < 0 ? err : total;
+}
+
+/****************************************************************************
+ * Name: mtd_interleave_erase
+ ****************************************************************************/
+
+static int mtd_interleave_erase(FAR struct mtd_dev_s *dev,
+                                off_t startblock, size_t nblocks)
+{
+  FAR struct mtd_interleave_s *priv = (FAR struct mtd_interleave_s *)dev;
+  ssize_t ret;
+
+  ret = mtd_interleave_dispatch(priv, MTD_INTERLEAVE_ERASE,
+                                startblock, nblocks, NULL);
+  return ret < 0 ? (int)ret : OK;
+}
+
+/****************************************************************************
+ * Name: mtd_interleave_bread
+ ****************************************************************************/
+
+static ssize_t mtd_interleave_bread(FAR struct mtd_dev_s *dev, off_t block,
+                                    size_t nblocks, FAR uint8_t *buffer)
+{
+  FAR struct mtd_interleave_s *priv = (FAR struct mtd_interleave_s *)dev;
+
+  return mtd_interleave_dispatch(priv, MTD_INTERLEAVE_READ,
+                                 block, nblocks, buffer);
+}
+
+/****************************************************************************
+ * Name: mtd_interleave_bwrite
+ ****************************************************************************/
+
+static ssize_t mtd_interleave_bwrite(FAR struct mtd_dev_s *dev, off_t block,
+                                     size_t nblocks,
+                                     FAR const uint8_t *buffer)
+{
+  FAR struct mtd_interleave_s *priv = (FAR struct mtd_interleave_s *)dev;
+
+  return mtd_interleave_dispatch(priv, MTD_INTERLEAVE_WRITE, block,
+                                 nblocks,
+                                 (FAR uint8_t *)(uintptr_t)buffer);
+}
+
+/****************************************************************************
+ * Name: mtd_interleave_ioctl
+ ****************************************************************************/
+
+static int mtd_interleave_ioctl(FAR struct mtd_dev_s *dev, int cmd,
+                                unsigned long arg)
+{
+  FAR struct mtd_interleave_s *priv = (FAR struct mtd_interleave_s *)dev;
+  unsigned int i;
+  int ret;
+
+  switch (cmd)
+    {
+      case MTDIOC_GEOMETRY:
+        {
+          FAR struct mtd_geometry_s *geo =
+            (FAR struct mtd_geometry_s *)((uintptr_t)arg);
+
+          /* First get the lower level geometry so that the model name is
+           * filled in, then scale the erase block count.
+           */
+
+          ret = priv->devs[0]->ioctl(priv->devs[0], MTDIOC_GEOMETRY, arg);
+          if (ret >= 0)
+            {
+              geo->blocksize    = priv->blocksize;
+              geo->erasesize    = priv->erasesize;
+              geo->neraseblocks = priv->neraseblocks * priv->count;
+            }
+        }
+        break;
+
+      case MTDIOC_BULKERASE:
+        {
+          ret = OK;
+          for (i = 0; i < priv->count && ret >= 0; i++)
+            {
+              ret = priv->devs[i]->ioctl(priv->devs[i], cmd, arg);
+            }
+        }
+        break;
+
+      default:
+        ret = priv->devs[0]->ioctl(priv->devs[0], cmd, arg);
+        break;
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: mtd_interleave_isbad
+ ****************************************************************************/
+
+static int mtd_interleave_isbad(FAR struct mtd_dev_s *dev, off_t block)
+{
+  FAR struct mtd_interleave_s *priv = (FAR struct mtd_interleave_s *)dev;
+  FAR struct mtd_dev_s *lower = priv->devs[block % priv->count];
+
+  if (lower->isbad == NULL)
+    {
+      return -ENOSYS;
+    }
+
+  return lower->isbad(lower, block / priv->count);
+}
+
+/****************************************************************************
+ * Name: mtd_interleave_markbad
+ ****************************************************************************/
+
+static int mtd_interleave_markbad(FAR struct mtd_dev_s *dev, off_t block)
+{
+  FAR struct mtd_interleave_s *priv = (FAR struct mtd_interleave_s *)dev;
+  FAR struct mtd_dev_s *lower = priv->devs[block % priv->count];
+
+  if (lower->markbad == NULL)
+    {
+      return -ENOSYS;
+    }
+
+  return lower->markbad(lower, block / priv->count);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mtd_interleave
+ *
+ * Description:
+ *   Create an MTD driver instance that interleaves erase blocks across
+ *   several MTD driver instances with identical geometry.  See
+ *   include/nuttx/mtd/mtd.h.
+ *
+ ****************************************************************************/
+
+FAR struct mtd_dev_s *mtd_interleave(FAR struct mtd_dev_s **mtds,
+                                     unsigned int count)
+{
+  FAR struct mtd_interleave_s *priv;
+  struct mtd_geometry_s geo;
+  unsigned int i;
+  int ret;
+
+  DEBUGASSERT(mtds != NULL && count > 0);
+
+  /* All devices must share one read/write and erase block size; the
+   * interleaved device exposes the smallest common erase block count.
+   */
+
+  ret = mtds[0]->ioctl(mtds[0], MTDIOC_GEOMETRY,
+                       (unsigned long)(uintptr_t)&geo);
+  if (ret < 0)
+    {
+      ferr("ERROR: MTDIOC_GEOMETRY failed: %d\n", ret);
+      return NULL;
+    }
+
+  for (i = 1; i < count; i++)
+    {
+      struct mtd_geometry_s other;
+
+      ret = mtds[i]->ioctl(mtds[i], MTDIOC_GEOMETRY,
+                           (unsigned long)(uintptr_t)&other);
+      if (ret < 0 || other.blocksize != geo.blocksize ||
+          other.erasesize != geo.erasesize)
+        {
+          ferr("ERROR: Device %u geometry mismatch\n", i);
+          return NULL;
+        }
+
+      if (other.neraseblocks < geo.neraseblocks)
+        {
+          geo.neraseblocks = other.neraseblocks;
+        }
+    }
+
+  /* Allocate and initialize the interleave device structure */
+
+  priv = kmm_zalloc(sizeof(struct mtd_interleave_s) +
+                    count * (sizeof(FAR struct mtd_dev_s *) +
+                             sizeof(struct mtd_interleave_task_s)));
+  if (priv == NULL)
+    {
+      ferr("ERROR: Failed to allocate the interleave structure\n");
+      return NULL;
+    }
+
+  priv->devs  = (FAR struct mtd_dev_s **)(priv + 1);
+  priv->tasks = (FAR struct mtd_interleave_task_s *)
+                (priv->devs + count);
+  memcpy(priv->devs, mtds, count * sizeof(FAR struct mtd_dev_s *));
+
+  priv->count        = count;
+  priv->blocksize    = geo.blocksize;
+  priv->erasesize    = geo.erasesize;
+  priv->neraseblocks = geo.neraseblocks;
+  priv->spb          = geo.erasesize / geo.blocksize;
+
+  priv->mtd.erase    = mtd_interleave_erase;
+  priv->mtd.bread    = mtd_interleave_bread;
+  priv->mtd.bwrite   = mtd_interleave_bwrite;
+  priv->mtd.ioctl    = mtd_interleave_ioctl;
+  priv->mtd.isbad    = mtd_interleave_isbad;
+  priv->mtd.markbad  = mtd_interleave_markbad;
+  priv->mtd.name     = "interleave";
+
+  nxmutex_init(&priv->lock);
+
+  for (i = 0; i < count; i++)
+    {
+      priv->tasks[i].priv = priv;
+      nxsem_init(&priv->tasks[i].done, 0, 0);
+    }
+
+  return &priv->mtd;
+}
+
+#endif /* CONFIG_MTD_INTERLEAVE */
@@ -101,6 +101,12 @@ static ssize_t nand_bread(FAR struct mtd_dev_s *dev, off_t startblock,
                           size_t nblocks, uint8_t *buffer);
 static ssize_t nand_bwrite(FAR struct mtd_dev_s *dev, off_t startblock,
                            size_t nblocks, const uint8_t *buffer);
+static ssize_t nand_breadv(FAR struct mtd_dev_s *dev,
+                           FAR const struct mtd_iovec_s *iov,
+                           size_t iovcnt);
+static ssize_t nand_bwritev(FAR struct mtd_dev_s *dev,
+                            FAR const struct mtd_iovec_s *iov,
+                            size_t iovcnt);
 static int     nand_ioctl(FAR struct mtd_dev_s *dev, int cmd,
                           unsigned long arg);
 static int     nand_isbad(FAR struct mtd_dev_s *dev, off_t block);
@@ -562,20 +568,21 @@ static int nand_erase(FAR struct mtd_dev_s *dev, off_t startblock,
 }
 
 /****************************************************************************
- * Name: nand_bread
+ * Name: nand_read_unlocked
  *
  * Description:
  *   Read the specified number of blocks into the user provided buffer.
+ *   The caller holds the lock.
  *
  ****************************************************************************/
 
-static ssize_t nand_bread(FAR struct mtd_dev_s *dev, off_t startpage,
-                          size_t npages, FAR uint8_t *buffer)
+static ssize_t nand_read_unlocked(FAR struct nand_dev_s *nand,
+                                  off_t startpage, size_t npages,
+                                  FAR uint8_t *buffer,
+                                  FAR bool *fixedecc)
 {
-  FAR struct nand_dev_s *nand = (FAR struct nand_dev_s *)dev;
   FAR struct nand_raw_s *raw;
   FAR struct nand_model_s *model;
-  bool fixedecc = false;
   unsigned int pagesperblock;
   unsigned int page;
   uint16_t pagesize;
@@ -584,7 +591,6 @@ static ssize_t nand_bread(FAR struct mtd_dev_s *dev, off_t startpage,
   off_t block;
   int ret;
 
-  finfo("startpage: %" PRIdOFF " npages: %zu\n", startpage, npages);
   DEBUGASSERT(nand && nand->raw);
 
   /* Retrieve the model */
@@ -605,10 +611,6 @@ static ssize_t nand_bread(FAR struct mtd_dev_s *dev, off_t startpage,
   block = startpage / pagesperblock;
   page  = startpage % pagesperblock;
 
-  /* Lock access to the NAND until we complete the read */
-
-  nxmutex_lock(&nand->lock);
-
   /* Then read every page from NAND */
 
   for (remaining = npages; remaining > 0; remaining--)
@@ -620,8 +622,7 @@ static ssize_t nand_bread(FAR struct mtd_dev_s *dev, off_t startpage,
           ferr("ERROR: Read beyond the end of FLASH, block=%ld\n",
                (long)block);
 
-          ret = -ESPIPE;
-          goto errout_with_lock;
+          return -ESPIPE;
         }
 
       /* Read the next page from NAND */
@@ -629,13 +630,13 @@ static ssize_t nand_bread(FAR struct mtd_dev_s *dev, off_t startpage,
       ret = nand_readpage(nand, block, page, buffer);
       if (ret == -EUCLEAN)
         {
-          fixedecc = true;
+          *fixedecc = true;
         }
       else if (ret < 0)
         {
           ferr("ERROR: nand_readpage failed block=%" PRIdOFF
                " page=%d: %d\n", block, page, ret);
-          goto errout_with_lock;
+          return ret;
         }
 
       /* Increment the page number.  If we exceed the number of
@@ -654,26 +655,95 @@ static ssize_t nand_bread(FAR struct mtd_dev_s *dev, off_t startpage,
       buffer += pagesize;
     }
 
+  return npages;
+}
+
+/****************************************************************************
+ * Name: nand_bread
+ *
+ * Description:
+ *   Read the specified number of blocks into the user provided buffer.
+ *
+ ****************************************************************************/
+
+static ssize_t nand_bread(FAR struct mtd_dev_s *dev, off_t startpage,
+                          size_t npages, FAR uint8_t *buffer)
+{
+  FAR struct nand_dev_s *nand = (FAR struct nand_dev_s *)dev;
+  bool fixedecc = false;
+  ssize_t ret;
+
+  finfo("startpage: %" PRIdOFF " npages: %zu\n", startpage, npages);
+
+  /* Lock access to the NAND until we complete the read */
+
+  nxmutex_lock(&nand->lock);
+  ret = nand_read_unlocked(nand, startpage, npages, buffer, &fixedecc);
   nxmutex_unlock(&nand->lock);
-  return fixedecc ? -EUCLEAN : npages;
 
-errout_with_lock:
+  return (ret > 0 && fixedecc) ? -EUCLEAN : ret;
+}
+
+/****************************************************************************
+ * Name: nand_breadv
+ *
+ * Description:
+ *   Read the segments of a scatter-gather list from NAND, holding the
+ *   lock across the whole list so that a multi-segment read costs one
+ *   lock/setup sequence.
+ *
+ ****************************************************************************/
+
+static ssize_t nand_breadv(FAR struct mtd_dev_s *dev,
+                           FAR const struct mtd_iovec_s *iov,
+                           size_t iovcnt)
+{
+  FAR struct nand_dev_s *nand = (FAR struct nand_dev_s *)dev;
+  bool fixedecc = false;
+  ssize_t npages = 0;
+  ssize_t ret = 0;
+  size_t i;
+
+  finfo("iovcnt: %zu\n", iovcnt);
+
+  /* Lock access to the NAND until all segments have been read */
+
+  nxmutex_lock(&nand->lock);
+  for (i = 0; i < iovcnt; i++)
+    {
+      ret = nand_read_unlocked(nand, iov[i].startblock, iov[i].nblocks,
+                               iov[i].buffer, &fixedecc);
+      if (ret < 0)
+        {
+          break;
+        }
+
+      npages += ret;
+    }
+
   nxmutex_unlock(&nand->lock);
-  return ret;
+
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  return fixedecc ? -EUCLEAN : npages;
 }
 
 /****************************************************************************
- * Name: nand_bwrite
+ * Name: nand_write_unlocked
  *
  * Description:
  *   Write the specified number of blocks from the user provided buffer.
+ *   The caller holds the lock.
  *
  ****************************************************************************/
 
-static ssize_t nand_bwrite(FAR struct mtd_dev_s *dev, off_t startpage,
-                           size_t npages, const uint8_t *buffer)
+static ssize_t nand_write_unlocked(FAR struct nand_dev_s *nand,
+                                   off_t startpage, size_t npages,
+                                   FAR const uint8_t *buffer)
 {
-  FAR struct nand_dev_s *nand = (FAR struct nand_dev_s *)dev;
   FAR struct nand_raw_s *raw;
   FAR struct nand_model_s *model;
   unsigned int pagesperblock;
@@ -684,7 +754,6 @@ static ssize_t nand_bwrite(FAR struct mtd_dev_s *dev, off_t startpage,
   off_t block;
   int ret;
 
-  finfo("startpage: %" PRIdOFF " npages: %zu\n", startpage, npages);
   DEBUGASSERT(nand && nand->raw);
 
   /* Retrieve the model */
@@ -705,10 +774,6 @@ static ssize_t nand_bwrite(FAR struct mtd_dev_s *dev, off_t startpage,
   block = startpage / pagesperblock;
   page  = startpage % pagesperblock;
 
-  /* Lock access to the NAND until we complete the write */
-
-  nxmutex_lock(&nand->lock);
-
   /* Then write every page into NAND */
 
   for (remaining = npages; remaining > 0; remaining--)
@@ -720,8 +785,7 @@ static ssize_t nand_bwrite(FAR struct mtd_dev_s *dev, off_t startpage,
           ferr("ERROR: Write beyond the end of FLASH, block=%ld\n",
                (long)block);
 
-          ret = -ESPIPE;
-          goto errout_with_lock;
+          return -ESPIPE;
         }
 
       /* Write the next page into NAND */
@@ -731,7 +795,7 @@ static ssize_t nand_bwrite(FAR struct mtd_dev_s *dev, off_t startpage,
         {
           ferr("ERROR: nand_writepage failed block=%ld page=%d: %d\n",
                (long)block, page, ret);
-          goto errout_with_lock;
+          return ret;
         }
 
       /* Increment the page number.  If we exceed the number of
@@ -750,14 +814,74 @@ static ssize_t nand_bwrite(FAR struct mtd_dev_s *dev, off_t startpage,
       buffer += pagesize;
     }
 
-  nxmutex_unlock(&nand->lock);
   return npages;
+}
+
+/****************************************************************************
+ * Name: nand_bwrite
+ *
+ * Description:
+ *   Write the specified number of blocks from the user provided buffer.
+ *
+ ****************************************************************************/
+
+static ssize_t nand_bwrite(FAR struct mtd_dev_s *dev, off_t startpage,
+                           size_t npages, const uint8_t *buffer)
+{
+  FAR struct nand_dev_s *nand = (FAR struct nand_dev_s *)dev;
+  ssize_t ret;
+
+  finfo("startpage: %" PRIdOFF " npages: %zu\n", startpage, npages);
+
+  /* Lock access to the NAND until we complete the write */
 
-errout_with_lock:
+  nxmutex_lock(&nand->lock);
+  ret = nand_write_unlocked(nand, startpage, npages, buffer);
   nxmutex_unlock(&nand->lock);
+
   return ret;
 }
 
+/****************************************************************************
+ * Name: nand_bwritev
+ *
+ * Description:
+ *   Write the segments of a scatter-gather list into NAND, holding the
+ *   lock across the whole list so that a multi-segment write costs one
+ *   lock/setup sequence.
+ *
+ ****************************************************************************/
+
+static ssize_t nand_bwritev(FAR struct mtd_dev_s *dev,
+                            FAR const struct mtd_iovec_s *iov,
+                            size_t iovcnt)
+{
+  FAR struct nand_dev_s *nand = (FAR struct nand_dev_s *)dev;
+  ssize_t npages = 0;
+  ssize_t ret = 0;
+  size_t i;
+
+  finfo("iovcnt: %zu\n", iovcnt);
+
+  /* Lock access to the NAND until all segments have been written */
+
+  nxmutex_lock(&nand->lock);
+  for (i = 0; i < iovcnt; i++)
+    {
+      ret = nand_write_unlocked(nand, iov[i].startblock, iov[i].nblocks,
+                                iov[i].buffer);
+      if (ret < 0)
+        {
+          break;
+        }
+
+      npages += ret;
+    }
+
+  nxmutex_unlock(&nand->lock);
+  return ret < 0 ? ret : npages;
+}
+
 /****************************************************************************
  * Name: nand_ioctl
  ****************************************************************************/
@@ -922,6 +1046,8 @@ FAR struct mtd_dev_s *nand_raw_initialize(FAR struct nand_raw_s *raw)
   nand->mtd.erase   = nand_erase;
   nand->mtd.bread   = nand_bread;
   nand->mtd.bwrite  = nand_bwrite;
+  nand->mtd.breadv  = nand_breadv;
+  nand->mtd.bwritev = nand_bwritev;
   nand->mtd.ioctl   = nand_ioctl;
   nand->mtd.isbad   = nand_isbad;
   nand->mtd.markbad = nand_markbad;
@@ -4012,6 +4012,54 @@ retry:
   return physicalsector;
 }
 
+/****************************************************************************
+ * Name: smart_find_collectblock
+ *
+ * Description:  Find the erase block with the most released sectors as
+ *               the next candidate for garbage collection.  Returns
+ *               0xffff if there is no candidate.
+ *
+ ****************************************************************************/
+
+static uint16_t smart_find_collectblock(FAR struct smart_struct_s *dev)
+{
+  uint16_t collectblock = 0xffff;
+  uint16_t releasemax = 0;
+  int x;
+#ifdef CONFIG_MTD_SMART_PACK_COUNTS
+  uint8_t count;
+#endif
+
+  for (x = 0; x < dev->neraseblocks; x++)
+    {
+#ifdef CONFIG_MTD_SMART_WEAR_LEVEL
+      /* Don't collect blocks that have been worn completely */
+
+      if (smart_get_wear_level(dev, x) >= SMART_WEAR_REORG_THRESHOLD)
+        {
+          continue;
+        }
+#endif
+
+#ifdef CONFIG_MTD_SMART_PACK_COUNTS
+      count = smart_get_count(dev, dev->releasecount, x);
+      if (count > releasemax)
+        {
+          releasemax = count;
+          collectblock = x;
+        }
+#else
+      if (dev->releasecount[x] > releasemax)
+        {
+          releasemax = dev->releasecount[x];
+          collectblock = x;
+        }
+#endif
+    }
+
+  return collectblock;
+}
+
 /****************************************************************************
  * Name: smart_garbagecollect
  *
@@ -4024,13 +4072,8 @@ retry:
 static int smart_garbagecollect(FAR struct smart_struct_s *dev)
 {
   uint16_t collectblock;
-  uint16_t releasemax;
   bool collect = true;
-  int x;
   int ret;
-#ifdef CONFIG_MTD_SMART_PACK_COUNTS
-  uint8_t count;
-#endif
 
   while (collect)
     {
@@ -4059,38 +4102,7 @@ static int smart_garbagecollect(FAR struct smart_struct_s *dev)
         {
           /* Find the block with the most released sectors */
 
-          collectblock = 0xffff;
-          releasemax = 0;
-          for (x = 0; x < dev->neraseblocks; x++)
-            {
-#ifdef CONFIG_MTD_SMART_WEAR_LEVEL
-              /* Don't collect blocks that have been worn completely */
-
-              if (smart_get_wear_level(dev, x) >= SMART_WEAR_REORG_THRESHOLD)
-                {
-                  continue;
-                }
-#endif
-
-#ifdef CONFIG_MTD_SMART_PACK_COUNTS
-              count = smart_get_count(dev, dev->releasecount, x);
-              if (count > releasemax)
-                {
-                  releasemax = count;
-                  collectblock = x;
-                }
-#else
-              if (dev->releasecount[x] > releasemax)
-                {
-                  releasemax = dev->releasecount[x];
-                  collectblock = x;
-                }
-#endif
-            }
-
-#if 0
-          releasemax = smart_get_count(dev, dev->releasecount, collectblock);
-#endif
+          collectblock = smart_find_collectblock(dev);
 
           if (collectblock == 0xffff)
             {
@@ -4144,6 +4156,43 @@ errout:
   return ret;
 }
 
+/****************************************************************************
+ * Name: smart_gc_reserve
+ *
+ * Description:  Collect released sectors until the requested free sector
+ *               reserve is met or there is nothing left to collect.  This
+ *               allows an upper layer to pre-reclaim space (via BIOC_GC)
+ *               before the normal on-demand collection thresholds would
+ *               trigger inside a foreground write.
+ *
+ ****************************************************************************/
+
+static int smart_gc_reserve(FAR struct smart_struct_s *dev,
+                            uint16_t reserve)
+{
+  uint16_t collectblock;
+  int ret = OK;
+
+  while (dev->freesectors < reserve && dev->releasesectors > 0)
+    {
+      collectblock = smart_find_collectblock(dev);
+      if (collectblock == 0xffff)
+        {
+          /* Sectors are released, but no block can be collected */
+
+          return -ENOSPC;
+        }
+
+      ret = smart_relocate_block(dev, collectblock);
+      if (ret != OK)
+        {
+          break;
+        }
+    }
+
+  return ret;
+}
+
 /****************************************************************************
  * Name: smart_write_wearstatus
  *
@@ -5554,6 +5603,15 @@ static int smart_ioctl(FAR struct inode *inode, int cmd, unsigned long arg)
       ret = smart_freesector(dev, arg);
       goto ok_out;
 
+    case BIOC_GC:
+
+      /* Reclaim released sectors until the requested free sector reserve
+       * is met.
+       */
+
+      ret = smart_gc_reserve(dev, (uint16_t)arg);
+      goto ok_out;
+
     case BIOC_WRITESECT:
 
       /* Write to the sector */
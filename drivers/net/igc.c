@@ -27,6 +27,7 @@
 #include <assert.h>
 #include <debug.h>
 #include <errno.h>
+#include <sys/uio.h>
 
 #include <nuttx/kmalloc.h>
 #include <nuttx/wqueue.h>
@@ -53,6 +54,13 @@
 #define IGC_TX_DESC            256
 #define IGC_RX_DESC            256
 
+/* A TX packet may be fragmented into several net packet buffers; in that
+ * case each fragment gets its own TX descriptor.
+ */
+
+#define IGC_TX_MAXFRAGS        ((IGC_PKTBUF_SIZE + NETPKT_BUFLEN - 1) / \
+                                NETPKT_BUFLEN + 1)
+
 /* After RX packet is done, we provide free netpkt to the RX descriptor ring.
  * The upper-half network logic is responsible for freeing the RX packets
  * so we need some additional spare netpkt buffers to assure that it's
@@ -431,9 +439,14 @@ static int igc_transmit(FAR struct netdev_lowerhalf_s *dev,
                           FAR netpkt_t *pkt)
 {
   FAR struct igc_driver_s *priv = (FAR struct igc_driver_s *)dev;
+  struct iovec             iov[IGC_TX_MAXFRAGS];
   uint64_t                 pa   = 0;
-  int                      desc = priv->tx_now;
   size_t                   len  = netpkt_getdatalen(dev, pkt);
+  size_t                   left = len;
+  int                      desc;
+  int                      iovcnt;
+  int                      avail;
+  int                      i;
 
   ninfo("transmit\n");
 
@@ -445,24 +458,61 @@ static int igc_transmit(FAR struct netdev_lowerhalf_s *dev,
       return -EINVAL;
     }
 
-  /* Store TX packet reference */
+  /* Get the (data, len) pairs that make up this packet.  The packet may be
+   * fragmented into several net packet buffers; in that case each fragment
+   * is handed to the hardware in its own TX descriptor so that we can
+   * transmit directly from the net packet chain without copying.
+   */
 
-  priv->tx_pkt[priv->tx_now] = pkt;
+  iovcnt = netpkt_to_iov(dev, pkt, iov, IGC_TX_MAXFRAGS);
+  for (i = 0; i < iovcnt; i++)
+    {
+      left -= iov[i].iov_len;
+    }
 
-  /* Prepare next TX descriptor */
+  if (left > 0)
+    {
+      nerr("net transmit buffer too fragmented\n");
+      return -EMSGSIZE;
+    }
 
-  priv->tx_now = (priv->tx_now + 1) % IGC_TX_DESC;
+  /* Make sure that all fragments fit in the free TX descriptors */
 
-  /* Setup TX descriptor */
+  avail = (priv->tx_done - priv->tx_now - 1 + IGC_TX_DESC) % IGC_TX_DESC;
+  if (iovcnt > avail)
+    {
+      return -ENOMEM;
+    }
+
+  for (i = 0; i < iovcnt; i++)
+    {
+      desc = priv->tx_now;
 
-  pa = up_addrenv_va_to_pa(netpkt_getdata(dev, pkt));
+      /* Store the TX packet reference on the last descriptor so that the
+       * packet is not freed until all fragments have been transmitted.
+       */
 
-  priv->tx[desc].addr   = pa;
-  priv->tx[desc].len    = len;
-  priv->tx[desc].cmd    = (IGC_TDESC_CMD_EOP | IGC_TDESC_CMD_IFCS |
-                           IGC_TDESC_CMD_RS);
-  priv->tx[desc].cso    = 0;
-  priv->tx[desc].status = 0;
+      priv->tx_pkt[desc] = (i == iovcnt - 1) ? pkt : NULL;
+
+      /* Prepare next TX descriptor */
+
+      priv->tx_now = (priv->tx_now + 1) % IGC_TX_DESC;
+
+      /* Setup TX descriptor */
+
+      pa = up_addrenv_va_to_pa(iov[i].iov_base);
+
+      priv->tx[desc].addr   = pa;
+      priv->tx[desc].len    = iov[i].iov_len;
+      priv->tx[desc].cmd    = IGC_TDESC_CMD_IFCS | IGC_TDESC_CMD_RS;
+      priv->tx[desc].cso    = 0;
+      priv->tx[desc].status = 0;
+
+      if (i == iovcnt - 1)
+        {
+          priv->tx[desc].cmd |= IGC_TDESC_CMD_EOP;
+        }
+    }
 
   SP_DSB();
 
@@ -470,8 +520,6 @@ static int igc_transmit(FAR struct netdev_lowerhalf_s *dev,
 
   igc_putreg_mem(priv, IGC_TDT0, priv->tx_now);
 
-  ninfodumpbuffer("Transmitted:", netpkt_getdata(dev, pkt), len);
-
   return OK;
 }
 
@@ -588,9 +636,15 @@ static void igc_txdone(FAR struct netdev_lowerhalf_s *dev)
           NETDEV_TXERRORS(priv->dev);
         }
 
-      /* Free net packet */
+      /* Free net packet.  Only the last descriptor of a packet carries
+       * the net packet reference.
+       */
 
-      netpkt_free(dev, priv->tx_pkt[priv->tx_done], NETPKT_TX);
+      if (priv->tx_pkt[priv->tx_done] != NULL)
+        {
+          netpkt_free(dev, priv->tx_pkt[priv->tx_done], NETPKT_TX);
+          priv->tx_pkt[priv->tx_done] = NULL;
+        }
 
       /* Next descriptor */
 
@@ -798,6 +798,43 @@ void sched_note_resume(FAR struct tcb_s *tcb)
 }
 #endif
 
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SWITCH
+void sched_note_wakeup(FAR struct tcb_s *tcb)
+{
+  struct note_wakeup_s note;
+  FAR struct note_driver_s **driver;
+  bool formatted = false;
+
+  if (!note_isenabled_switch())
+    {
+      return;
+    }
+
+  for (driver = g_note_drivers; *driver; driver++)
+    {
+      if ((*driver)->ops->add == NULL)
+        {
+          continue;
+        }
+
+      /* Format the note */
+
+      if (!formatted)
+        {
+          formatted = true;
+          note_common(tcb, &note.nwk_cmn, sizeof(struct note_wakeup_s),
+                      NOTE_WAKEUP);
+          note.nwk_waker = up_interrupt_context() ? INVALID_PROCESS_ID :
+                           this_task()->pid;
+        }
+
+      /* Add the note to circular buffer */
+
+      note_add(*driver, &note, sizeof(struct note_wakeup_s));
+    }
+}
+#endif
+
 #ifdef CONFIG_SMP
 void sched_note_cpu_start(FAR struct tcb_s *tcb, int cpu)
 {
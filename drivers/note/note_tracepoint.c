@@ -0,0 +1,160 @@
+/****************************************************************************
+ * drivers/note/note_tracepoint.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <errno.h>
+#include <string.h>
+
+#include <nuttx/sched_note.h>
+#include <nuttx/spinlock.h>
+#include <nuttx/tracepoint.h>
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* Singly linked list of registered tracepoints.  The list is only
+ * walked on the (rare) control paths; tracepoint hits never touch it.
+ */
+
+static FAR struct tracepoint_s *g_tracepoints;
+static spinlock_t g_tracepoint_lock = SP_UNLOCKED;
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: tracepoint_register
+ *
+ * Description:
+ *   Add a tracepoint to the list used by tracepoint_enable() and
+ *   tracepoint_find().
+ *
+ ****************************************************************************/
+
+void tracepoint_register(FAR struct tracepoint_s *tp)
+{
+  irqstate_t flags;
+
+  flags = spin_lock_irqsave(&g_tracepoint_lock);
+  tp->flink = g_tracepoints;
+  g_tracepoints = tp;
+  spin_unlock_irqrestore(&g_tracepoint_lock, flags);
+}
+
+/****************************************************************************
+ * Name: tracepoint_unregister
+ *
+ * Description:
+ *   Remove a tracepoint from the registered list and disable it.
+ *
+ ****************************************************************************/
+
+void tracepoint_unregister(FAR struct tracepoint_s *tp)
+{
+  FAR struct tracepoint_s **prev;
+  irqstate_t flags;
+
+  flags = spin_lock_irqsave(&g_tracepoint_lock);
+  tp->enabled = 0;
+
+  for (prev = &g_tracepoints; *prev != NULL; prev = &(*prev)->flink)
+    {
+      if (*prev == tp)
+        {
+          *prev = tp->flink;
+          break;
+        }
+    }
+
+  spin_unlock_irqrestore(&g_tracepoint_lock, flags);
+}
+
+/****************************************************************************
+ * Name: tracepoint_find
+ *
+ * Description:
+ *   Look up a registered tracepoint by name.
+ *
+ ****************************************************************************/
+
+FAR struct tracepoint_s *tracepoint_find(FAR const char *name)
+{
+  FAR struct tracepoint_s *tp;
+  irqstate_t flags;
+
+  flags = spin_lock_irqsave(&g_tracepoint_lock);
+
+  for (tp = g_tracepoints; tp != NULL; tp = tp->flink)
+    {
+      if (strcmp(tp->name, name) == 0)
+        {
+          break;
+        }
+    }
+
+  spin_unlock_irqrestore(&g_tracepoint_lock, flags);
+  return tp;
+}
+
+/****************************************************************************
+ * Name: tracepoint_enable
+ *
+ * Description:
+ *   Enable or disable the named tracepoint.
+ *
+ ****************************************************************************/
+
+int tracepoint_enable(FAR const char *name, bool enable)
+{
+  FAR struct tracepoint_s *tp;
+
+  tp = tracepoint_find(name);
+  if (tp == NULL)
+    {
+      return -ENOENT;
+    }
+
+  tp->enabled = enable;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: tracepoint_emit
+ *
+ * Description:
+ *   Emit one record for an enabled tracepoint into the note transport.
+ *   The record is delivered as a dump mark carrying the caller's
+ *   fixed-size payload, tagged with the tracepoint's subsystem so the
+ *   existing note filters and tools apply.
+ *
+ ****************************************************************************/
+
+void tracepoint_emit(FAR struct tracepoint_s *tp, uintptr_t ip,
+                     FAR const void *buf, size_t len)
+{
+  sched_note_event_ip(tp->tag, ip, NOTE_DUMP_MARK, buf, len);
+}
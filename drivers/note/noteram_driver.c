@@ -73,18 +73,33 @@
  * Private Types
  ****************************************************************************/
 
+/* Each CPU traces into its own circular buffer under its own lock so
+ * that adding a note never contends with instrumentation running on the
+ * other CPUs.  The reader merges the rings in timestamp order.
+ */
+
+struct noteram_ring_s
+{
+  volatile unsigned int head;
+  volatile unsigned int tail;
+  volatile unsigned int read;
+  spinlock_t lock;
+};
+
 struct noteram_driver_s
 {
   struct note_driver_s driver;
   FAR uint8_t *ni_buffer;
-  size_t ni_bufsize;
+  size_t ni_bufsize;            /* The size of one per-CPU ring */
   unsigned int ni_overwrite;
-  volatile unsigned int ni_head;
-  volatile unsigned int ni_tail;
-  volatile unsigned int ni_read;
-  spinlock_t lock;
+  struct noteram_ring_s ni_ring[NCPUS];
 };
 
+/* The slice of ni_buffer holding the ring of the given CPU */
+
+#define noteram_ring_buffer(drv, cpu) \
+  ((drv)->ni_buffer + (cpu) * (drv)->ni_bufsize)
+
 /* The structure to hold the context data of trace dump */
 
 struct noteram_dump_cpu_context_s
@@ -148,7 +163,7 @@ struct noteram_driver_s g_noteram_driver =
 {
   {&g_noteram_ops},
   g_ramnote_buffer,
-  CONFIG_DRIVERS_NOTERAM_BUFSIZE,
+  CONFIG_DRIVERS_NOTERAM_BUFSIZE / NCPUS,
 #ifdef CONFIG_DRIVERS_NOTERAM_DEFAULT_NOOVERWRITE
   NOTERAM_MODE_OVERWRITE_DISABLE
 #else
@@ -176,8 +191,18 @@ struct noteram_driver_s g_noteram_driver =
 
 static void noteram_buffer_clear(FAR struct noteram_driver_s *drv)
 {
-  drv->ni_tail = drv->ni_head;
-  drv->ni_read = drv->ni_head;
+  FAR struct noteram_ring_s *ring;
+  irqstate_t flags;
+  int cpu;
+
+  for (cpu = 0; cpu < NCPUS; cpu++)
+    {
+      ring = &drv->ni_ring[cpu];
+      flags = spin_lock_irqsave_wo_note(&ring->lock);
+      ring->tail = ring->head;
+      ring->read = ring->head;
+      spin_unlock_irqrestore_wo_note(&ring->lock, flags);
+    }
 
   if (drv->ni_overwrite == NOTERAM_MODE_OVERWRITE_OVERFLOW)
     {
@@ -227,10 +252,11 @@ static inline unsigned int noteram_next(FAR struct noteram_driver_s *drv,
  *
  ****************************************************************************/
 
-static unsigned int noteram_length(FAR struct noteram_driver_s *drv)
+static unsigned int noteram_length(FAR struct noteram_driver_s *drv,
+                                   FAR struct noteram_ring_s *ring)
 {
-  unsigned int head = drv->ni_head;
-  unsigned int tail = drv->ni_tail;
+  unsigned int head = ring->head;
+  unsigned int tail = ring->tail;
 
   if (tail > head)
     {
@@ -254,10 +280,12 @@ static unsigned int noteram_length(FAR struct noteram_driver_s *drv)
  *
  ****************************************************************************/
 
-static unsigned int noteram_unread_length(FAR struct noteram_driver_s *drv)
+static unsigned int
+noteram_unread_length(FAR struct noteram_driver_s *drv,
+                      FAR struct noteram_ring_s *ring)
 {
-  unsigned int head = drv->ni_head;
-  unsigned int read = drv->ni_read;
+  unsigned int head = ring->head;
+  unsigned int read = ring->read;
 
   if (read > head)
     {
@@ -284,40 +312,89 @@ static unsigned int noteram_unread_length(FAR struct noteram_driver_s *drv)
  *
  ****************************************************************************/
 
-static void noteram_remove(FAR struct noteram_driver_s *drv)
+static void noteram_remove(FAR struct noteram_driver_s *drv, int cpu)
 {
+  FAR struct noteram_ring_s *ring = &drv->ni_ring[cpu];
   unsigned int tail;
   unsigned int length;
 
   /* Get the tail index of the circular buffer */
 
-  tail = drv->ni_tail;
+  tail = ring->tail;
   DEBUGASSERT(tail < drv->ni_bufsize);
 
   /* Get the length of the note at the tail index */
 
-  length = NOTE_ALIGN(drv->ni_buffer[tail]);
-  DEBUGASSERT(length <= noteram_length(drv));
+  length = NOTE_ALIGN(noteram_ring_buffer(drv, cpu)[tail]);
+  DEBUGASSERT(length <= noteram_length(drv, ring));
 
   /* Increment the tail index to remove the entire note from the circular
    * buffer.
    */
 
-  if (drv->ni_read == drv->ni_tail)
+  if (ring->read == ring->tail)
     {
       /* The read index also needs increment. */
 
-      drv->ni_read = noteram_next(drv, tail, length);
+      ring->read = noteram_next(drv, tail, length);
+    }
+
+  ring->tail = noteram_next(drv, tail, length);
+}
+
+/****************************************************************************
+ * Name: noteram_peek
+ *
+ * Description:
+ *   Copy out the common header of the next unread note of one CPU ring
+ *   without removing it.
+ *
+ * Input Parameters:
+ *   cpu    - The CPU whose ring to peek
+ *   header - Location to return the common note header
+ *
+ * Returned Value:
+ *   The length of the next note, or zero if the ring is empty.
+ *
+ * Assumptions:
+ *   The ring lock is held by the caller.
+ *
+ ****************************************************************************/
+
+static size_t noteram_peek(FAR struct noteram_driver_s *drv, int cpu,
+                           FAR struct note_common_s *header)
+{
+  FAR struct noteram_ring_s *ring = &drv->ni_ring[cpu];
+  FAR uint8_t *out = (FAR uint8_t *)header;
+  unsigned int read;
+  size_t i;
+
+  /* Is there an unread note in this ring? */
+
+  if (noteram_unread_length(drv, ring) == 0)
+    {
+      return 0;
+    }
+
+  /* Copy out the common header, handling wraparound */
+
+  read = ring->read;
+  for (i = 0; i < sizeof(struct note_common_s); i++)
+    {
+      out[i] = noteram_ring_buffer(drv, cpu)[read];
+      read   = noteram_next(drv, read, 1);
     }
 
-  drv->ni_tail = noteram_next(drv, tail, length);
+  return header->nc_length;
 }
 
 /****************************************************************************
  * Name: noteram_get
  *
  * Description:
- *   Get the next note from the read index of the circular buffer.
+ *   Get the next note from the read index of the circular buffers.  The
+ *   per-CPU rings are merged here: the unread note with the earliest
+ *   timestamp across all rings is returned first.
  *
  * Input Parameters:
  *   buffer - Location to return the next note
@@ -325,7 +402,7 @@ static void noteram_remove(FAR struct noteram_driver_s *drv)
  *
  * Returned Value:
  *   On success, the positive, non-zero length of the return note is
- *   provided.  Zero is returned only if the circular buffer is empty.  A
+ *   provided.  Zero is returned only if the circular buffers are empty.  A
  *   negated errno value is returned in the event of any failure.
  *
  ****************************************************************************/
@@ -333,32 +410,59 @@ static void noteram_remove(FAR struct noteram_driver_s *drv)
 static ssize_t noteram_get(FAR struct noteram_driver_s *drv,
                            FAR uint8_t *buffer, size_t buflen)
 {
-  FAR struct note_common_s *note;
+  FAR struct noteram_ring_s *ring;
+  struct note_common_s header;
+  irqstate_t flags;
   unsigned int remaining;
   unsigned int read;
   ssize_t notelen;
-  size_t circlen;
+  uint32_t nsec = 0;
+  time_t sec = 0;
+  int cpu;
+  int best = -1;
 
   DEBUGASSERT(buffer != NULL);
 
-  /* Verify that the circular buffer is not empty */
+  /* Find the ring whose next unread note carries the earliest timestamp */
 
-  circlen = noteram_unread_length(drv);
-  if (circlen <= 0)
+  for (cpu = 0; cpu < NCPUS; cpu++)
     {
-      return 0;
+      ring  = &drv->ni_ring[cpu];
+      flags = spin_lock_irqsave_wo_note(&ring->lock);
+      if (noteram_peek(drv, cpu, &header) > 0 &&
+          (best < 0 || header.nc_systime_sec < sec ||
+           (header.nc_systime_sec == sec && header.nc_systime_nsec < nsec)))
+        {
+          best = cpu;
+          sec  = header.nc_systime_sec;
+          nsec = header.nc_systime_nsec;
+        }
+
+      spin_unlock_irqrestore_wo_note(&ring->lock, flags);
     }
 
-  /* Get the read index of the circular buffer */
+  if (best < 0)
+    {
+      return 0;
+    }
 
-  read = drv->ni_read;
-  DEBUGASSERT(read < drv->ni_bufsize);
+  /* Then extract that note.  The ring may have wrapped since the scan;
+   * whatever note is now at the read index is still the oldest one this
+   * CPU holds.
+   */
 
-  /* Get the length of the note at the read index */
+  ring  = &drv->ni_ring[best];
+  flags = spin_lock_irqsave_wo_note(&ring->lock);
+  if (noteram_peek(drv, best, &header) == 0)
+    {
+      spin_unlock_irqrestore_wo_note(&ring->lock, flags);
+      return 0;
+    }
 
-  note = (FAR struct note_common_s *)&drv->ni_buffer[read];
-  notelen = note->nc_length;
-  DEBUGASSERT(notelen <= circlen);
+  read    = ring->read;
+  notelen = header.nc_length;
+  DEBUGASSERT(read < drv->ni_bufsize &&
+              notelen <= noteram_unread_length(drv, ring));
 
   /* Is the user buffer large enough to hold the note? */
 
@@ -366,7 +470,8 @@ static ssize_t noteram_get(FAR struct noteram_driver_s *drv,
     {
       /* Skip the large note so that we do not get constipated. */
 
-      drv->ni_read = noteram_next(drv, read, NOTE_ALIGN(notelen));
+      ring->read = noteram_next(drv, read, NOTE_ALIGN(notelen));
+      spin_unlock_irqrestore_wo_note(&ring->lock, flags);
 
       /* and return an error */
 
@@ -380,7 +485,7 @@ static ssize_t noteram_get(FAR struct noteram_driver_s *drv,
     {
       /* Copy the next byte at the read index */
 
-      *buffer++ = drv->ni_buffer[read];
+      *buffer++ = noteram_ring_buffer(drv, best)[read];
 
       /* Adjust indices and counts */
 
@@ -388,7 +493,8 @@ static ssize_t noteram_get(FAR struct noteram_driver_s *drv,
       remaining--;
     }
 
-  drv->ni_read = noteram_next(drv, drv->ni_read, NOTE_ALIGN(notelen));
+  ring->read = noteram_next(drv, ring->read, NOTE_ALIGN(notelen));
+  spin_unlock_irqrestore_wo_note(&ring->lock, flags);
 
   return notelen;
 }
@@ -402,10 +508,20 @@ static int noteram_open(FAR struct file *filep)
   FAR struct noteram_dump_context_s *ctx;
   FAR struct noteram_driver_s *drv = (FAR struct noteram_driver_s *)
                                      filep->f_inode->i_private;
+  FAR struct noteram_ring_s *ring;
+  irqstate_t flags;
+  int cpu;
 
-  /* Reset the read index of the circular buffer */
+  /* Reset the read index of each circular buffer */
+
+  for (cpu = 0; cpu < NCPUS; cpu++)
+    {
+      ring = &drv->ni_ring[cpu];
+      flags = spin_lock_irqsave_wo_note(&ring->lock);
+      ring->read = ring->tail;
+      spin_unlock_irqrestore_wo_note(&ring->lock, flags);
+    }
 
-  drv->ni_read = drv->ni_tail;
   ctx = kmm_zalloc(sizeof(*ctx));
   if (ctx == NULL)
     {
@@ -441,14 +557,13 @@ static ssize_t noteram_read(FAR struct file *filep, FAR char *buffer,
 
   do
     {
-      irqstate_t flags;
       uint8_t note[256];
 
-      /* Get the next note (removing it from the buffer) */
+      /* Get the next note (removing it from the buffer).  noteram_get()
+       * performs its own per-ring locking.
+       */
 
-      flags = spin_lock_irqsave_wo_note(&drv->lock);
       ret = noteram_get(drv, note, sizeof(note));
-      spin_unlock_irqrestore_wo_note(&drv->lock, flags);
       if (ret <= 0)
         {
           return ret;
@@ -472,7 +587,6 @@ static int noteram_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
 {
   int ret = -ENOSYS;
   FAR struct noteram_driver_s *drv = filep->f_inode->i_private;
-  irqstate_t flags = spin_lock_irqsave_wo_note(&drv->lock);
 
   /* Handle the ioctl commands */
 
@@ -526,7 +640,6 @@ static int noteram_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
           break;
     }
 
-  spin_unlock_irqrestore_wo_note(&drv->lock, flags);
   return ret;
 }
 
@@ -553,21 +666,31 @@ static void noteram_add(FAR struct note_driver_s *driver,
 {
   FAR const char *buf = note;
   FAR struct noteram_driver_s *drv = (FAR struct noteram_driver_s *)driver;
+  FAR struct noteram_ring_s *ring;
+  FAR uint8_t *buffer;
   unsigned int head;
   unsigned int remain;
   unsigned int space;
   irqstate_t flags;
-
-  flags = spin_lock_irqsave_wo_note(&drv->lock);
+  int cpu;
 
   if (drv->ni_overwrite == NOTERAM_MODE_OVERWRITE_OVERFLOW)
     {
-      spin_unlock_irqrestore_wo_note(&drv->lock, flags);
       return;
     }
 
+  /* Trace into the ring of the current CPU.  Only the reader and local
+   * interrupt handlers can contend for this lock, so adding a note never
+   * waits on instrumentation running on the other CPUs.
+   */
+
+  cpu    = this_cpu();
+  ring   = &drv->ni_ring[cpu];
+  buffer = noteram_ring_buffer(drv, cpu);
+  flags  = spin_lock_irqsave_wo_note(&ring->lock);
+
   DEBUGASSERT(note != NULL && notelen < drv->ni_bufsize);
-  remain = drv->ni_bufsize - noteram_length(drv);
+  remain = drv->ni_bufsize - noteram_length(drv, ring);
 
   if (remain <= NOTE_ALIGN(notelen))
     {
@@ -576,7 +699,7 @@ static void noteram_add(FAR struct note_driver_s *driver,
           /* Stop recording if not in overwrite mode */
 
           drv->ni_overwrite = NOTERAM_MODE_OVERWRITE_OVERFLOW;
-          spin_unlock_irqrestore_wo_note(&drv->lock, flags);
+          spin_unlock_irqrestore_wo_note(&ring->lock, flags);
           return;
         }
 
@@ -585,19 +708,19 @@ static void noteram_add(FAR struct note_driver_s *driver,
 
       do
         {
-          noteram_remove(drv);
-          remain = drv->ni_bufsize - noteram_length(drv);
+          noteram_remove(drv, cpu);
+          remain = drv->ni_bufsize - noteram_length(drv, ring);
         }
       while (remain <= NOTE_ALIGN(notelen));
     }
 
-  head = drv->ni_head;
+  head = ring->head;
   space = drv->ni_bufsize - head;
   space = space < notelen ? space : notelen;
-  memcpy(drv->ni_buffer + head, note, space);
-  memcpy(drv->ni_buffer, buf + space, notelen - space);
-  drv->ni_head = noteram_next(drv, head, NOTE_ALIGN(notelen));
-  spin_unlock_irqrestore_wo_note(&drv->lock, flags);
+  memcpy(buffer + head, note, space);
+  memcpy(buffer, buf + space, notelen - space);
+  ring->head = noteram_next(drv, head, NOTE_ALIGN(notelen));
+  spin_unlock_irqrestore_wo_note(&ring->lock, flags);
 }
 
 /****************************************************************************
@@ -1337,6 +1460,7 @@ FAR struct note_driver_s *
 noteram_initialize(FAR const char *devpath, size_t bufsize, bool overwrite)
 {
   FAR struct noteram_driver_s *drv;
+  int cpu;
   int ret;
 
   drv = kmm_malloc(sizeof(*drv) + bufsize);
@@ -1346,12 +1470,17 @@ noteram_initialize(FAR const char *devpath, size_t bufsize, bool overwrite)
     }
 
   drv->driver.ops = &g_noteram_ops;
-  drv->ni_bufsize = bufsize;
+  drv->ni_bufsize = bufsize / NCPUS;
   drv->ni_buffer = (FAR uint8_t *)(drv + 1);
   drv->ni_overwrite = overwrite;
-  drv->ni_head = 0;
-  drv->ni_tail = 0;
-  drv->ni_read = 0;
+
+  for (cpu = 0; cpu < NCPUS; cpu++)
+    {
+      drv->ni_ring[cpu].head = 0;
+      drv->ni_ring[cpu].tail = 0;
+      drv->ni_ring[cpu].read = 0;
+      spin_lock_init(&drv->ni_ring[cpu].lock);
+    }
 
   ret = note_driver_register(&drv->driver);
   if (ret < 0)
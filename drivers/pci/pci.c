@@ -1958,6 +1958,74 @@ int pci_connect_irq(FAR struct pci_device_s *dev, FAR int *irq, int num)
     }
 }
 
+#ifdef CONFIG_SMP
+/****************************************************************************
+ * Name: pci_set_irq_affinity
+ *
+ * Description:
+ *   Bind one MSI or MSI-X vector to the given set of CPUs.
+ *
+ * Input Parameters:
+ *   dev    - PCI device
+ *   irq    - The vector, as returned by pci_connect_irq()
+ *   cpuset - The set of CPUs that may service the vector
+ *
+ * Return value:
+ *   Failed if return a negative value, otherwise success
+ *
+ ****************************************************************************/
+
+int pci_set_irq_affinity(FAR struct pci_device_s *dev, int irq,
+                         cpu_set_t cpuset)
+{
+  if (dev == NULL || CPU_COUNT(&cpuset) == 0)
+    {
+      return -EINVAL;
+    }
+
+  up_affinity_irq(irq, cpuset);
+  return OK;
+}
+
+/****************************************************************************
+ * Name: pci_spread_irqs
+ *
+ * Description:
+ *   Spread a set of MSI or MSI-X vectors round-robin over all CPUs, so
+ *   that per-queue vectors of a multi-queue device are serviced on
+ *   different CPUs.
+ *
+ * Input Parameters:
+ *   dev - PCI device
+ *   irq - The vectors, as returned by pci_connect_irq()
+ *   num - number of vectors
+ *
+ * Return value:
+ *   Failed if return a negative value, otherwise success
+ *
+ ****************************************************************************/
+
+int pci_spread_irqs(FAR struct pci_device_s *dev, FAR int *irq, int num)
+{
+  cpu_set_t cpuset;
+  int i;
+
+  if (dev == NULL || irq == NULL || num <= 0)
+    {
+      return -EINVAL;
+    }
+
+  for (i = 0; i < num; i++)
+    {
+      CPU_ZERO(&cpuset);
+      CPU_SET(i % CONFIG_SMP_NCPUS, &cpuset);
+      up_affinity_irq(irq[i], cpuset);
+    }
+
+  return OK;
+}
+#endif /* CONFIG_SMP */
+
 /****************************************************************************
  * Name: pci_register_driver
  *
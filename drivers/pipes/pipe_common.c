@@ -411,6 +411,10 @@ ssize_t pipecommon_read(FAR struct file *filep, FAR char *buffer, size_t len)
   FAR struct inode      *inode = filep->f_inode;
   FAR struct pipe_dev_s *dev   = inode->i_private;
   ssize_t                nread = 0;
+  bool                   wasfull;
+#ifdef CONFIG_DEV_PIPE_DIRECT_XFER
+  bool                   registered = false;
+#endif
   int                    ret;
 
   DEBUGASSERT(dev);
@@ -454,9 +458,72 @@ ssize_t pipecommon_read(FAR struct file *filep, FAR char *buffer, size_t len)
 
       /* Otherwise, wait for something to be written to the pipe */
 
+#ifdef CONFIG_DEV_PIPE_DIRECT_XFER
+      /* Before blocking, publish our buffer so that the next writer can
+       * copy data into it directly, skipping the circular buffer.  Only
+       * one blocked reader at a time may do so.
+       */
+
+      if (dev->d_rdbuffer == NULL)
+        {
+          dev->d_rdbuffer = buffer;
+          dev->d_rdlen    = len;
+          dev->d_rdfilled = 0;
+          registered      = true;
+        }
+#endif
+
       nxrmutex_unlock(&dev->d_bflock);
       ret = nxsem_wait(&dev->d_rdsem);
 
+#ifdef CONFIG_DEV_PIPE_DIRECT_XFER
+      if (registered)
+        {
+          /* The registration must be revoked on every path out of this
+           * loop; a writer must never be left holding a pointer into
+           * this (possibly about to be unwound) stack frame.  So the
+           * mutex is re-taken even if the wait failed.
+           */
+
+          int ret2;
+
+          ret2 = nxrmutex_lock(&dev->d_bflock);
+          if (ret2 < 0)
+            {
+              return ret < 0 ? ret : ret2;
+            }
+
+          nread           = dev->d_rdfilled;
+          dev->d_rdbuffer = NULL;
+          dev->d_rdfilled = 0;
+          registered      = false;
+
+          if (nread > 0)
+            {
+              /* A writer satisfied the read directly.  The circular
+               * buffer was not involved, so no waiting writer needs to
+               * be awakened.
+               */
+
+              nxrmutex_unlock(&dev->d_bflock);
+              pipe_dumpbuffer("From PIPE:", buffer, nread);
+              return nread;
+            }
+
+          if (ret < 0)
+            {
+              nxrmutex_unlock(&dev->d_bflock);
+              return ret;
+            }
+
+          /* Nothing was transferred directly.  The mutex is held, so
+           * just re-examine the state of the pipe.
+           */
+
+          continue;
+        }
+#endif
+
       if (ret < 0 || (ret = nxrmutex_lock(&dev->d_bflock)) < 0)
         {
           /* May fail because a signal was received or if the task was
@@ -471,7 +538,8 @@ ssize_t pipecommon_read(FAR struct file *filep, FAR char *buffer, size_t len)
    * byte).
    */
 
-  nread = circbuf_read(&dev->d_buffer, buffer, len);
+  wasfull = circbuf_is_full(&dev->d_buffer);
+  nread   = circbuf_read(&dev->d_buffer, buffer, len);
 
   /* Notify all poll/select waiters that they can write to the
    * FIFO when buffer can accept more than d_polloutthrd bytes.
@@ -483,10 +551,14 @@ ssize_t pipecommon_read(FAR struct file *filep, FAR char *buffer, size_t len)
     }
 
   /* Notify all waiting writers that bytes have been removed from the
-   * buffer.
+   * buffer.  Writers only block on a full pipe, so the wakeup is needed
+   * only when this read created the first free space.
    */
 
-  pipecommon_wakeup(&dev->d_wrsem);
+  if (wasfull)
+    {
+      pipecommon_wakeup(&dev->d_wrsem);
+    }
 
   nxrmutex_unlock(&dev->d_bflock);
   pipe_dumpbuffer("From PIPE:", buffer, nread);
@@ -504,6 +576,7 @@ ssize_t pipecommon_write(FAR struct file *filep, FAR const char *buffer,
   FAR struct pipe_dev_s *dev      = inode->i_private;
   ssize_t                nwritten = 0;
   ssize_t                last;
+  bool                   wasempty = false;
   int                    ret;
 
   DEBUGASSERT(dev);
@@ -560,12 +633,41 @@ ssize_t pipecommon_write(FAR struct file *filep, FAR const char *buffer,
           return nwritten == 0 ? -EPIPE : nwritten;
         }
 
+#ifdef CONFIG_DEV_PIPE_DIRECT_XFER
+      /* If a reader is blocked on the pipe with its buffer published,
+       * copy data into that buffer directly and skip the circular buffer
+       * entirely.  This is only permitted while the circular buffer is
+       * empty; otherwise the direct bytes would overtake buffered ones.
+       */
+
+      if (circbuf_is_empty(&dev->d_buffer) && dev->d_rdbuffer != NULL &&
+          dev->d_rdfilled == 0)
+        {
+          size_t ncopy = MIN(len - nwritten, dev->d_rdlen);
+
+          memcpy(dev->d_rdbuffer, buffer + nwritten, ncopy);
+          dev->d_rdfilled = ncopy;
+          nwritten       += ncopy;
+
+          /* Wake up the reader that owns the published buffer */
+
+          pipecommon_wakeup(&dev->d_rdsem);
+
+          if ((size_t)nwritten == len)
+            {
+              nxrmutex_unlock(&dev->d_bflock);
+              return len;
+            }
+        }
+#endif
+
       /* Would the next write overflow the circular buffer? */
 
       if (!circbuf_is_full(&dev->d_buffer))
         {
           /* Loop until all of the bytes have been written */
 
+          wasempty  = circbuf_is_empty(&dev->d_buffer);
           nwritten += circbuf_write(&dev->d_buffer,
                                     buffer + nwritten, len - nwritten);
 
@@ -582,10 +684,15 @@ ssize_t pipecommon_write(FAR struct file *filep, FAR const char *buffer,
                 }
 
               /* Yes.. Notify all of the waiting readers that more data is
-               * available.
+               * available.  Readers only block on an empty pipe, so the
+               * wakeup is needed only when this write wrote the first
+               * byte.
                */
 
-              pipecommon_wakeup(&dev->d_rdsem);
+              if (wasempty)
+                {
+                  pipecommon_wakeup(&dev->d_rdsem);
+                }
 
               /* Return the number of bytes written */
 
@@ -608,10 +715,15 @@ ssize_t pipecommon_write(FAR struct file *filep, FAR const char *buffer,
               poll_notify(dev->d_fds, CONFIG_DEV_PIPE_NPOLLWAITERS, POLLIN);
 
               /* Yes.. Notify all of the waiting readers that more data is
-               * available.
+               * available (only the write that filled the first byte can
+               * have readers waiting on it).
                */
 
-              pipecommon_wakeup(&dev->d_rdsem);
+              if (wasempty)
+                {
+                  pipecommon_wakeup(&dev->d_rdsem);
+                  wasempty = false;
+                }
             }
 
           last = nwritten;
@@ -867,6 +979,15 @@ int pipecommon_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
             }
 
           dev->d_bufsize = size;
+
+          /* Growing the buffer creates free space: wake any writer that
+           * blocked when the old, smaller buffer was full.
+           */
+
+          if (!circbuf_is_full(&dev->d_buffer))
+            {
+              pipecommon_wakeup(&dev->d_wrsem);
+            }
         }
         break;
 
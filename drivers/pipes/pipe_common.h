@@ -129,6 +129,18 @@ struct pipe_dev_s
   int16_t          d_crefs;       /* References to dev */
   struct circbuf_s d_buffer;      /* Buffer allocated when device opened */
 
+#ifdef CONFIG_DEV_PIPE_DIRECT_XFER
+  /* While a reader is blocked on an empty pipe it publishes its buffer
+   * here so that the next writer can copy data into it directly,
+   * bypassing the circular buffer.  Only one blocked reader at a time
+   * may register; others fall back to the buffered path.
+   */
+
+  FAR char        *d_rdbuffer;    /* Buffer of the blocked reader, or NULL */
+  size_t           d_rdlen;       /* Size of d_rdbuffer in bytes */
+  size_t           d_rdfilled;    /* Bytes copied directly to d_rdbuffer */
+#endif
+
   /* The following is a list if poll structures of threads waiting for
    * driver events. The 'struct pollfd' reference for each open is also
    * retained in the f_priv field of the 'struct file'.
@@ -0,0 +1,184 @@
+/****************************************************************************
+ * drivers/power/pm/deadline_governor.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdbool.h>
+
+#include <nuttx/clock.h>
+#include <nuttx/wdog.h>
+#include <nuttx/power/pm.h>
+
+#include "pm.h"
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+/* PM governor methods */
+
+static void deadline_governor_statechanged(int domain,
+                                           enum pm_state_e newstate);
+static enum pm_state_e deadline_governor_checkstate(int domain);
+static void deadline_governor_activity(int domain, int count);
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const struct pm_governor_s g_deadline_governor_ops =
+{
+  NULL,                           /* initialize */
+  NULL,                           /* deinitialize */
+  deadline_governor_statechanged, /* statechanged */
+  deadline_governor_checkstate,   /* checkstate */
+  deadline_governor_activity,     /* activity */
+  NULL                            /* priv */
+};
+
+/* Worst-case exit latency of each state in microseconds.  A state may not
+ * be entered unless the system can be back at PM_NORMAL before the next
+ * timer expires.
+ */
+
+static const uint32_t g_deadline_governor_latency[PM_COUNT] =
+{
+  0,
+  CONFIG_PM_GOVERNOR_DEADLINE_IDLE_LATENCY,
+  CONFIG_PM_GOVERNOR_DEADLINE_STANDBY_LATENCY,
+  CONFIG_PM_GOVERNOR_DEADLINE_SLEEP_LATENCY,
+};
+
+/* Minimum worthwhile residency of each state in microseconds.  Entering
+ * and leaving a state costs energy; a state only saves power if the idle
+ * period is at least this long.
+ */
+
+static const uint32_t g_deadline_governor_residency[PM_COUNT] =
+{
+  0,
+  CONFIG_PM_GOVERNOR_DEADLINE_IDLE_RESIDENCY,
+  CONFIG_PM_GOVERNOR_DEADLINE_STANDBY_RESIDENCY,
+  CONFIG_PM_GOVERNOR_DEADLINE_SLEEP_RESIDENCY,
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: deadline_governor_statechanged
+ ****************************************************************************/
+
+static void deadline_governor_statechanged(int domain,
+                                           enum pm_state_e newstate)
+{
+  /* no need to react to state changes */
+
+  UNUSED(domain);
+  UNUSED(newstate);
+}
+
+/****************************************************************************
+ * Name: deadline_governor_checkstate
+ ****************************************************************************/
+
+static enum pm_state_e deadline_governor_checkstate(int domain)
+{
+  FAR struct pm_domain_s *pdom;
+  irqstate_t flags;
+  sclock_t delay;
+  uint64_t sleep;
+  int state;
+
+  pdom = &g_pmdomains[domain];
+  state = PM_NORMAL;
+
+  /* We disable interrupts since pm_stay()/pm_relax() could be simultaneously
+   * invoked, which modifies the stay count which we are about to read
+   */
+
+  flags = spin_lock_irqsave(&pdom->lock);
+
+  /* Find the lowest power-level which is not locked. */
+
+  while (dq_empty(&pdom->wakelock[state]) && state < (PM_COUNT - 1))
+    {
+      state++;
+    }
+
+  spin_unlock_irqrestore(&pdom->lock, flags);
+
+  /* Then back off to the deepest state whose exit latency and minimum
+   * residency both fit into the time until the next timer expiration.
+   * With no active timer any state is acceptable; the next wakeup will
+   * come from an external event that has no known deadline.
+   */
+
+  delay = wd_gettime_next();
+  if (delay >= 0)
+    {
+      sleep = (uint64_t)TICK2USEC((clock_t)delay);
+      while (state > PM_NORMAL &&
+             (g_deadline_governor_latency[state] +
+              g_deadline_governor_residency[state] > sleep))
+        {
+          state--;
+        }
+    }
+
+  /* Return the found state */
+
+  return state;
+}
+
+/****************************************************************************
+ * Name: deadline_governor_activity
+ ****************************************************************************/
+
+static void deadline_governor_activity(int domain, int count)
+{
+  pm_staytimeout(domain, PM_NORMAL, (count ? count : 1) * 1000);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: pm_deadline_governor_initialize
+ *
+ * Description:
+ *   Return the deadline governor instance.
+ *
+ * Returned Value:
+ *   A pointer to the governor struct. Otherwise NULL is returned on error.
+ *
+ ****************************************************************************/
+
+FAR const struct pm_governor_s *pm_deadline_governor_initialize(void)
+{
+  return &g_deadline_governor_ops;
+}
@@ -23,6 +23,7 @@
  ****************************************************************************/
 
 #include <nuttx/config.h>
+#include <nuttx/clock.h>
 #include <nuttx/power/pm.h>
 #include <sched/sched.h>
 
@@ -60,6 +61,12 @@ static struct pm_idle_s g_pm_idle =
   0,
 };
 
+#if CONFIG_PM_IDLE_CHECK_INTERVAL > 0
+/* Time of the last full housekeeping pass, per CPU domain */
+
+static clock_t g_pm_idle_lastcheck[CONFIG_SMP_NCPUS];
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -134,6 +141,9 @@ void pm_idle(pm_idle_handler_t handler)
   enum pm_state_e oldstate;
   enum pm_state_e newstate;
   irqstate_t flags;
+#if CONFIG_PM_IDLE_CHECK_INTERVAL > 0
+  clock_t now;
+#endif
   int domain;
   bool first;
   bool last;
@@ -152,6 +162,36 @@ void pm_idle(pm_idle_handler_t handler)
 
   flags = up_irq_save();
 
+#if CONFIG_PM_IDLE_CHECK_INTERVAL > 0
+  /* If the CPU domain settled at PM_NORMAL less than the configured
+   * interval ago, skip the governor and driver housekeeping and enter the
+   * low power wait immediately.  Only the idle CPU bookkeeping is kept
+   * up to date so that the other CPUs still see a consistent running set,
+   * and a first-woken CPU still restores the system domain.
+   */
+
+  now = clock_systime_ticks();
+  if (pm_querystate(domain) == PM_NORMAL &&
+      now - g_pm_idle_lastcheck[cpu] <
+        MSEC2TICK(CONFIG_PM_IDLE_CHECK_INTERVAL))
+    {
+      spin_lock(&g_pm_idle.lock);
+      CPU_CLR(cpu, &g_pm_idle.running);
+
+      first = handler(cpu, PM_NORMAL, PM_RESTORE);
+      if (first)
+        {
+          pm_changestate(PM_IDLE_DOMAIN, PM_RESTORE);
+        }
+
+      spin_unlock(&g_pm_idle.lock);
+      up_irq_restore(flags);
+      return;
+    }
+
+  g_pm_idle_lastcheck[cpu] = now;
+#endif
+
   oldstate = pm_querystate(domain);
   newstate = pm_checkstate(domain);
 
@@ -210,6 +250,20 @@ void pm_idle(pm_idle_handler_t handler)
 
 #else
 
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+#if CONFIG_PM_IDLE_CHECK_INTERVAL > 0
+/* Time of the last full housekeeping pass */
+
+static clock_t g_pm_idle_lastcheck;
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
 /****************************************************************************
  * Name: pm_idle
  *
@@ -229,6 +283,9 @@ void pm_idle(pm_idle_handler_t handler)
 {
   enum pm_state_e newstate;
   irqstate_t flags;
+#if CONFIG_PM_IDLE_CHECK_INTERVAL > 0
+  clock_t now;
+#endif
   int ret;
 
   /* If sched lock before irq save, and irq handler do post, scheduler will
@@ -238,6 +295,27 @@ void pm_idle(pm_idle_handler_t handler)
   flags = up_irq_save();
   sched_lock();
 
+#if CONFIG_PM_IDLE_CHECK_INTERVAL > 0
+  /* If the domain settled at PM_NORMAL less than the configured interval
+   * ago, the drivers are still in their run state:  skip the governor and
+   * the prepare/notify round trips and enter the low power wait at once.
+   * Deeper states are considered again when the interval has elapsed.
+   */
+
+  now = clock_systime_ticks();
+  if (pm_querystate(PM_IDLE_DOMAIN) == PM_NORMAL &&
+      now - g_pm_idle_lastcheck <
+        MSEC2TICK(CONFIG_PM_IDLE_CHECK_INTERVAL))
+    {
+      handler(PM_NORMAL);
+      up_irq_restore(flags);
+      sched_unlock();
+      return;
+    }
+
+  g_pm_idle_lastcheck = now;
+#endif
+
   newstate = pm_checkstate(PM_IDLE_DOMAIN);
   ret      = pm_changestate(PM_IDLE_DOMAIN, newstate);
   if (ret < 0)
@@ -0,0 +1,536 @@
+/****************************************************************************
+ * drivers/power/snapshot/snapshot.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/* Hibernate-style snapshot/resume:  snapshot_save() streams a set of RAM
+ * regions (kernel .data/.bss and heap, per the board's table) to an MTD
+ * device and captures a continuation with setjmp.  On the next boot,
+ * snapshot_restore() CRC-checks the image, copies the regions back, and
+ * longjmps into the saved continuation, turning a full OS boot into a
+ * memory copy.
+ *
+ * The image is written data first, header last, so a save interrupted by
+ * power loss never leaves a bootable-looking image; the header CRC covers
+ * the region table and the data CRC covers the payload.
+ */
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/param.h>
+
+#include <assert.h>
+#include <debug.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <setjmp.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <nuttx/crc32.h>
+#include <nuttx/fs/ioctl.h>
+#include <nuttx/irq.h>
+#include <nuttx/kmalloc.h>
+#include <nuttx/mtd/mtd.h>
+#include <nuttx/power/snapshot.h>
+
+#ifdef CONFIG_SNAPSHOT
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define SNAPSHOT_MAGIC      0x50414e53    /* "SNAP", little endian */
+#define SNAPSHOT_VERSION    1
+#define SNAPSHOT_MAXREGIONS 8
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* On-flash region descriptor */
+
+begin_packed_struct struct snapshot_desc_s
+{
+  uintptr_t start;              /* RAM address of the region */
+  uint32_t  size;               /* Size of the region in bytes */
+} end_packed_struct;
+
+/* On-flash image header.  It occupies block 0 alone; the region payload
+ * is packed into the blocks that follow.
+ */
+
+begin_packed_struct struct snapshot_header_s
+{
+  uint32_t magic;               /* SNAPSHOT_MAGIC */
+  uint32_t version;             /* SNAPSHOT_VERSION */
+  uint32_t nregions;            /* Number of valid descriptors */
+  uint32_t datacrc;             /* CRC32 of the packed region payload */
+  uint32_t hdrcrc;              /* CRC32 of the descriptors above + table */
+  struct snapshot_desc_s desc[SNAPSHOT_MAXREGIONS];
+} end_packed_struct;
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* The continuation captured by snapshot_save().  It lives in .data/.bss
+ * and is therefore part of the image; by the time snapshot_restore()
+ * longjmps through it, it holds the saved contents again.
+ */
+
+static jmp_buf g_snapshot_env;
+
+/* Registered driver clients */
+
+static FAR struct snapshot_client_s *g_snapshot_clients;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: snapshot_geometry
+ *
+ * Description:
+ *   Fetch the MTD geometry needed to lay out the image.
+ *
+ ****************************************************************************/
+
+static int snapshot_geometry(FAR struct mtd_dev_s *mtd,
+                             FAR struct mtd_geometry_s *geo)
+{
+  int ret;
+
+  ret = mtd->ioctl(mtd, MTDIOC_GEOMETRY,
+                   (unsigned long)(uintptr_t)geo);
+  if (ret < 0)
+    {
+      ferr("ERROR: MTDIOC_GEOMETRY failed: %d\n", ret);
+      return ret;
+    }
+
+  if (geo->blocksize < sizeof(struct snapshot_header_s))
+    {
+      ferr("ERROR: Block size %" PRIu32 " too small for the header\n",
+           geo->blocksize);
+      return -EINVAL;
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: snapshot_hdrcrc
+ *
+ * Description:
+ *   Compute the CRC over the header fields it protects.
+ *
+ ****************************************************************************/
+
+static uint32_t snapshot_hdrcrc(FAR const struct snapshot_header_s *hdr)
+{
+  uint32_t crc;
+
+  crc = crc32part((FAR const uint8_t *)hdr,
+                  offsetof(struct snapshot_header_s, hdrcrc), 0);
+  return crc32part((FAR const uint8_t *)hdr->desc, sizeof(hdr->desc), crc);
+}
+
+/****************************************************************************
+ * Name: snapshot_write_data
+ *
+ * Description:
+ *   Stream the packed region payload to the MTD device starting at block
+ *   1, returning the payload CRC through 'crc'.
+ *
+ ****************************************************************************/
+
+static int snapshot_write_data(FAR struct mtd_dev_s *mtd,
+                               FAR const struct snapshot_region_s *regions,
+                               size_t nregions, FAR uint8_t *block,
+                               uint32_t blocksize, FAR uint32_t *crc)
+{
+  off_t blkno = 1;
+  uint32_t fill = 0;
+  ssize_t nwritten;
+  size_t i;
+
+  *crc = 0;
+
+  for (i = 0; i < nregions; i++)
+    {
+      FAR const uint8_t *src = regions[i].start;
+      size_t remaining = regions[i].size;
+
+      *crc = crc32part(src, remaining, *crc);
+
+      while (remaining > 0)
+        {
+          size_t chunk = MIN(remaining, (size_t)(blocksize - fill));
+
+          memcpy(block + fill, src, chunk);
+          fill      += chunk;
+          src       += chunk;
+          remaining -= chunk;
+
+          if (fill == blocksize)
+            {
+              nwritten = mtd->bwrite(mtd, blkno, 1, block);
+              if (nwritten != 1)
+                {
+                  return nwritten < 0 ? (int)nwritten : -EIO;
+                }
+
+              blkno++;
+              fill = 0;
+            }
+        }
+    }
+
+  /* Flush the final partial block */
+
+  if (fill > 0)
+    {
+      memset(block + fill, 0xff, blocksize - fill);
+      nwritten = mtd->bwrite(mtd, blkno, 1, block);
+      if (nwritten != 1)
+        {
+          return nwritten < 0 ? (int)nwritten : -EIO;
+        }
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: snapshot_walk_data
+ *
+ * Description:
+ *   Read the packed region payload back from the MTD device, either only
+ *   accumulating its CRC (copy == false) or also copying it to the RAM
+ *   addresses recorded in the descriptors (copy == true).
+ *
+ ****************************************************************************/
+
+static int snapshot_walk_data(FAR struct mtd_dev_s *mtd,
+                              FAR const struct snapshot_header_s *hdr,
+                              FAR uint8_t *block, uint32_t blocksize,
+                              bool copy, FAR uint32_t *crc)
+{
+  off_t blkno = 1;
+  uint32_t fill = blocksize;    /* Forces a read on first use */
+  ssize_t nread;
+  size_t i;
+
+  *crc = 0;
+
+  for (i = 0; i < hdr->nregions; i++)
+    {
+      FAR uint8_t *dest = (FAR uint8_t *)hdr->desc[i].start;
+      size_t remaining = hdr->desc[i].size;
+
+      while (remaining > 0)
+        {
+          size_t chunk;
+
+          if (fill == blocksize)
+            {
+              nread = mtd->bread(mtd, blkno, 1, block);
+              if (nread != 1)
+                {
+                  return nread < 0 ? (int)nread : -EIO;
+                }
+
+              blkno++;
+              fill = 0;
+            }
+
+          chunk = MIN(remaining, (size_t)(blocksize - fill));
+          *crc = crc32part(block + fill, chunk, *crc);
+          if (copy)
+            {
+              memcpy(dest, block + fill, chunk);
+            }
+
+          fill      += chunk;
+          dest      += chunk;
+          remaining -= chunk;
+        }
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: snapshot_register
+ *
+ * Description:
+ *   Register a driver with the snapshot framework.  See
+ *   include/nuttx/power/snapshot.h.
+ *
+ ****************************************************************************/
+
+void snapshot_register(FAR struct snapshot_client_s *client)
+{
+  irqstate_t flags;
+
+  flags = enter_critical_section();
+  client->flink = g_snapshot_clients;
+  g_snapshot_clients = client;
+  leave_critical_section(flags);
+}
+
+/****************************************************************************
+ * Name: snapshot_save
+ *
+ * Description:
+ *   Write a resumable image of the given RAM regions to the MTD device.
+ *   See include/nuttx/power/snapshot.h.
+ *
+ ****************************************************************************/
+
+int snapshot_save(FAR struct mtd_dev_s *mtd,
+                  FAR const struct snapshot_region_s *regions,
+                  size_t nregions)
+{
+  FAR struct snapshot_client_s *client;
+  struct snapshot_header_s hdr;
+  struct mtd_geometry_s geo;
+  FAR uint8_t *block;
+  irqstate_t flags;
+  uint32_t datacrc;
+  size_t nblocks;
+  size_t total;
+  ssize_t nrw;
+  size_t i;
+  int ret;
+
+  if (nregions == 0 || nregions > SNAPSHOT_MAXREGIONS)
+    {
+      return -EINVAL;
+    }
+
+  ret = snapshot_geometry(mtd, &geo);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  block = kmm_malloc(geo.blocksize);
+  if (block == NULL)
+    {
+      return -ENOMEM;
+    }
+
+  flags = enter_critical_section();
+
+  /* Capture the continuation.  The second return is the resume path:
+   * snapshot_restore() has rebuilt RAM and longjmps here.
+   */
+
+  if (setjmp(g_snapshot_env) != 0)
+    {
+      for (client = g_snapshot_clients; client != NULL;
+           client = client->flink)
+        {
+          if (client->restore != NULL)
+            {
+              client->restore(client);
+            }
+        }
+
+      leave_critical_section(flags);
+      kmm_free(block);
+      return SNAPSHOT_RESUMED;
+    }
+
+  /* Give the clients a chance to park their hardware, then build the
+   * header and size the image.
+   */
+
+  for (client = g_snapshot_clients; client != NULL; client = client->flink)
+    {
+      if (client->save != NULL)
+        {
+          client->save(client);
+        }
+    }
+
+  memset(&hdr, 0, sizeof(hdr));
+  hdr.magic    = SNAPSHOT_MAGIC;
+  hdr.version  = SNAPSHOT_VERSION;
+  hdr.nregions = nregions;
+
+  total = 0;
+  for (i = 0; i < nregions; i++)
+    {
+      hdr.desc[i].start = (uintptr_t)regions[i].start;
+      hdr.desc[i].size  = regions[i].size;
+      total            += regions[i].size;
+    }
+
+  /* One block for the header plus the packed payload */
+
+  nblocks = 1 + (total + geo.blocksize - 1) / geo.blocksize;
+  if (nblocks > geo.neraseblocks * (geo.erasesize / geo.blocksize))
+    {
+      ret = -ENOSPC;
+      goto errout;
+    }
+
+  ret = mtd->erase(mtd, 0,
+                   (nblocks + geo.erasesize / geo.blocksize - 1) /
+                   (geo.erasesize / geo.blocksize));
+  if (ret < 0)
+    {
+      goto errout;
+    }
+
+  /* Data first, header last:  A save cut short by power loss leaves no
+   * valid-looking header behind.
+   */
+
+  ret = snapshot_write_data(mtd, regions, nregions, block, geo.blocksize,
+                            &datacrc);
+  if (ret < 0)
+    {
+      goto errout;
+    }
+
+  hdr.datacrc = datacrc;
+  hdr.hdrcrc  = snapshot_hdrcrc(&hdr);
+  memset(block, 0xff, geo.blocksize);
+  memcpy(block, &hdr, sizeof(hdr));
+  nrw = mtd->bwrite(mtd, 0, 1, block);
+  if (nrw != 1)
+    {
+      ret = nrw < 0 ? (int)nrw : -EIO;
+      goto errout;
+    }
+
+  ret = OK;
+
+errout:
+  leave_critical_section(flags);
+  kmm_free(block);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: snapshot_restore
+ *
+ * Description:
+ *   Validate the image on the MTD device and resume it.  See
+ *   include/nuttx/power/snapshot.h.
+ *
+ ****************************************************************************/
+
+int snapshot_restore(FAR struct mtd_dev_s *mtd, FAR void *workbuf,
+                     size_t buflen)
+{
+  struct snapshot_header_s hdr;
+  struct mtd_geometry_s geo;
+  FAR uint8_t *block = workbuf;
+  uint32_t crc;
+  ssize_t nread;
+  int ret;
+
+  ret = snapshot_geometry(mtd, &geo);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  if (buflen < geo.blocksize)
+    {
+      return -EINVAL;
+    }
+
+  nread = mtd->bread(mtd, 0, 1, block);
+  if (nread != 1)
+    {
+      return nread < 0 ? (int)nread : -EIO;
+    }
+
+  memcpy(&hdr, block, sizeof(hdr));
+  if (hdr.magic != SNAPSHOT_MAGIC || hdr.version != SNAPSHOT_VERSION ||
+      hdr.nregions == 0 || hdr.nregions > SNAPSHOT_MAXREGIONS ||
+      hdr.hdrcrc != snapshot_hdrcrc(&hdr))
+    {
+      return -ENOENT;
+    }
+
+  /* First pass:  CRC the payload without touching RAM so that a corrupt
+   * image degrades to a cold boot instead of a crash.
+   */
+
+  ret = snapshot_walk_data(mtd, &hdr, block, geo.blocksize, false, &crc);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  if (crc != hdr.datacrc)
+    {
+      return -ENOENT;
+    }
+
+  /* Second pass:  Copy the payload back.  From here on RAM is in
+   * transition and there is no way back; any MTD failure now is fatal
+   * for this boot, but the first pass just read every block
+   * successfully.
+   */
+
+  ret = snapshot_walk_data(mtd, &hdr, block, geo.blocksize, true, &crc);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  /* Resume the continuation captured by snapshot_save().  Never returns. */
+
+  longjmp(g_snapshot_env, SNAPSHOT_RESUMED);
+  return -EFAULT;   /* Unreachable */
+}
+
+/****************************************************************************
+ * Name: snapshot_invalidate
+ *
+ * Description:
+ *   Erase the image header so that the next boot is a cold boot.  See
+ *   include/nuttx/power/snapshot.h.
+ *
+ ****************************************************************************/
+
+int snapshot_invalidate(FAR struct mtd_dev_s *mtd)
+{
+  return mtd->erase(mtd, 0, 1);
+}
+
+#endif /* CONFIG_SNAPSHOT */
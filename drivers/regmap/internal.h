@@ -79,6 +79,20 @@ struct regmap_s
 
   int reg_stride;
 
+#ifdef CONFIG_REGMAP_CACHE
+  /* Register value cache state, see the cache_mode and max_register
+   * fields of regmap_config_s.
+   */
+
+  int cache_mode;             /* See enum regmap_cache_mode_e */
+  unsigned int max_register;  /* Highest cacheable register address */
+  unsigned int cache_nregs;   /* Flat: table size; sparse: used entries */
+  unsigned int cache_alloc;   /* Sparse: allocated entries */
+  FAR void *cache_val;        /* Flat: value table; sparse: entry array */
+  FAR uint32_t *cache_valid;  /* Flat: valid bitmap */
+  FAR uint32_t *cache_dirty;  /* Flat: dirty bitmap */
+#endif
+
   /* Prevent fragmentation */
 
   mutex_t mutex[0];
@@ -26,6 +26,8 @@
 #include <nuttx/lib/math32.h>
 #include <nuttx/kmalloc.h>
 
+#include <sys/param.h>
+#include <string.h>
 #include <debug.h>
 
 #include "internal.h"
@@ -39,6 +41,30 @@
 
 #define REGMAP_DEFAULT_BIT 8
 
+#ifdef CONFIG_REGMAP_CACHE
+#  define REGMAP_BIT_WORD(n)  ((n) >> 5)
+#  define REGMAP_BIT_MASK(n)  (1UL << ((n) & 31))
+
+/* Initial entry number of a sparse cache, grown by doubling. */
+
+#  define REGMAP_SPARSE_INIT  16
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+#ifdef CONFIG_REGMAP_CACHE
+/* One register of a sparse cache, kept sorted by address. */
+
+struct regmap_cache_entry_s
+{
+  unsigned int reg;
+  uint32_t val;
+  bool dirty;
+};
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -59,6 +85,273 @@ static void regmap_unlock_mutex(FAR void *context)
   nxmutex_unlock(&map->mutex[0]);
 }
 
+#ifdef CONFIG_REGMAP_CACHE
+
+/****************************************************************************
+ * Name: regmap_sparse_find
+ *
+ * Description:
+ *   Binary search the sorted sparse entry array.  Returns the matching
+ *   entry, or NULL with *pos set to the insertion index.
+ *
+ ****************************************************************************/
+
+static FAR struct regmap_cache_entry_s *
+regmap_sparse_find(FAR struct regmap_s *map, unsigned int reg,
+                   FAR unsigned int *pos)
+{
+  FAR struct regmap_cache_entry_s *entries = map->cache_val;
+  unsigned int lo = 0;
+  unsigned int hi = map->cache_nregs;
+  unsigned int mid;
+
+  while (lo < hi)
+    {
+      mid = (lo + hi) / 2;
+      if (entries[mid].reg == reg)
+        {
+          *pos = mid;
+          return &entries[mid];
+        }
+      else if (entries[mid].reg < reg)
+        {
+          lo = mid + 1;
+        }
+      else
+        {
+          hi = mid;
+        }
+    }
+
+  *pos = lo;
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: regmap_cache_get
+ *
+ * Description:
+ *   Look a register value up in the cache.  Returns OK on a hit and
+ *   -ENOENT when the value is unknown or the register is not cacheable.
+ *
+ ****************************************************************************/
+
+static int regmap_cache_get(FAR struct regmap_s *map, unsigned int reg,
+                            FAR unsigned int *val)
+{
+  FAR struct regmap_cache_entry_s *entry;
+  FAR uint32_t *table;
+  unsigned int idx;
+
+  if (reg > map->max_register)
+    {
+      return -ENOENT;
+    }
+
+  if (map->cache_mode == REGMAP_CACHE_FLAT)
+    {
+      idx   = reg / map->reg_stride;
+      table = map->cache_val;
+      if ((map->cache_valid[REGMAP_BIT_WORD(idx)] &
+           REGMAP_BIT_MASK(idx)) == 0)
+        {
+          return -ENOENT;
+        }
+
+      *val = table[idx];
+      return OK;
+    }
+
+  entry = regmap_sparse_find(map, reg, &idx);
+  if (entry == NULL)
+    {
+      return -ENOENT;
+    }
+
+  *val = entry->val;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: regmap_cache_set
+ *
+ * Description:
+ *   Store a register value in the cache.  Returns -ERANGE when the
+ *   register is above max_register and therefore not cacheable, and
+ *   -ENOMEM when a sparse cache could not grow.
+ *
+ ****************************************************************************/
+
+static int regmap_cache_set(FAR struct regmap_s *map, unsigned int reg,
+                            unsigned int val, bool dirty)
+{
+  FAR struct regmap_cache_entry_s *entries;
+  FAR struct regmap_cache_entry_s *entry;
+  FAR uint32_t *table;
+  unsigned int alloc;
+  unsigned int idx;
+
+  if (reg > map->max_register)
+    {
+      return -ERANGE;
+    }
+
+  if (map->cache_mode == REGMAP_CACHE_FLAT)
+    {
+      idx   = reg / map->reg_stride;
+      table = map->cache_val;
+
+      table[idx] = val;
+      map->cache_valid[REGMAP_BIT_WORD(idx)] |= REGMAP_BIT_MASK(idx);
+      if (dirty)
+        {
+          map->cache_dirty[REGMAP_BIT_WORD(idx)] |= REGMAP_BIT_MASK(idx);
+        }
+
+      return OK;
+    }
+
+  entry = regmap_sparse_find(map, reg, &idx);
+  if (entry == NULL)
+    {
+      if (map->cache_nregs >= map->cache_alloc)
+        {
+          alloc = map->cache_alloc != 0 ?
+                  2 * map->cache_alloc : REGMAP_SPARSE_INIT;
+          entries = kmm_realloc(map->cache_val,
+                                alloc * sizeof(*entries));
+          if (entries == NULL)
+            {
+              return -ENOMEM;
+            }
+
+          map->cache_val   = entries;
+          map->cache_alloc = alloc;
+        }
+
+      entries = map->cache_val;
+      memmove(&entries[idx + 1], &entries[idx],
+              (map->cache_nregs - idx) * sizeof(*entries));
+      map->cache_nregs++;
+
+      entry        = &entries[idx];
+      entry->reg   = reg;
+      entry->dirty = false;
+    }
+
+  entry->val    = val;
+  entry->dirty |= dirty;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: regmap_cache_drop_range
+ *
+ * Description:
+ *   Discard the cached values of val_count registers starting at reg,
+ *   used when a bulk access bypasses the cache.
+ *
+ ****************************************************************************/
+
+static void regmap_cache_drop_range(FAR struct regmap_s *map,
+                                    unsigned int reg,
+                                    unsigned int val_count)
+{
+  FAR struct regmap_cache_entry_s *entries = map->cache_val;
+  unsigned int last = reg + (val_count - 1) * map->reg_stride;
+  unsigned int first;
+  unsigned int idx;
+
+  if (map->cache_mode == REGMAP_CACHE_NONE || reg > map->max_register)
+    {
+      return;
+    }
+
+  if (map->cache_mode == REGMAP_CACHE_FLAT)
+    {
+      last = MIN(last, map->max_register);
+      for (; reg <= last; reg += map->reg_stride)
+        {
+          idx = reg / map->reg_stride;
+          map->cache_valid[REGMAP_BIT_WORD(idx)] &= ~REGMAP_BIT_MASK(idx);
+          map->cache_dirty[REGMAP_BIT_WORD(idx)] &= ~REGMAP_BIT_MASK(idx);
+        }
+
+      return;
+    }
+
+  if (map->cache_nregs == 0)
+    {
+      return;
+    }
+
+  regmap_sparse_find(map, reg, &first);
+  for (idx = first; idx < map->cache_nregs; idx++)
+    {
+      if (entries[idx].reg > last)
+        {
+          break;
+        }
+    }
+
+  memmove(&entries[first], &entries[idx],
+          (map->cache_nregs - idx) * sizeof(*entries));
+  map->cache_nregs -= idx - first;
+}
+
+/****************************************************************************
+ * Name: regmap_cache_writeback
+ *
+ * Description:
+ *   Write a run of val_count consecutive register values back to the
+ *   device.  With single byte registers and a bus bulk write operation
+ *   the run is sent as one burst (address byte followed by the values,
+ *   relying on the device auto-increment addressing); otherwise one
+ *   register write per value is issued.
+ *
+ ****************************************************************************/
+
+static int regmap_cache_writeback(FAR struct regmap_s *map,
+                                  unsigned int reg,
+                                  FAR const uint32_t *vals,
+                                  unsigned int val_count)
+{
+  FAR uint8_t *buf;
+  unsigned int i;
+  int ret = OK;
+
+  if (val_count > 1 && map->write != NULL &&
+      map->reg_bytes == 1 && map->val_bytes == 1)
+    {
+      buf = kmm_malloc(val_count + 1);
+      if (buf != NULL)
+        {
+          buf[0] = reg;
+          for (i = 0; i < val_count; i++)
+            {
+              buf[i + 1] = vals[i];
+            }
+
+          ret = map->write(map->bus, buf, val_count + 1);
+          kmm_free(buf);
+          return ret;
+        }
+    }
+
+  for (i = 0; i < val_count; i++)
+    {
+      ret = map->reg_write(map->bus, reg + (i * map->reg_stride),
+                           vals[i]);
+      if (ret < 0)
+        {
+          break;
+        }
+    }
+
+  return ret;
+}
+#endif /* CONFIG_REGMAP_CACHE */
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -90,6 +383,10 @@ FAR struct regmap_s *regmap_init(FAR struct regmap_bus_s *bus,
                                  FAR const struct regmap_config_s *config)
 {
   FAR struct regmap_s *map;
+#ifdef CONFIG_REGMAP_CACHE
+  unsigned int nregs;
+  unsigned int words;
+#endif
 
   if (config == NULL || bus == NULL)
     {
@@ -138,6 +435,35 @@ FAR struct regmap_s *regmap_init(FAR struct regmap_bus_s *bus,
   map->read  = bus->read;
   map->write = bus->write;
 
+#ifdef CONFIG_REGMAP_CACHE
+  map->cache_mode   = config->cache_mode;
+  map->max_register = config->max_register;
+  if (config->cache_mode == REGMAP_CACHE_FLAT)
+    {
+      nregs = config->max_register / map->reg_stride + 1;
+      words = REGMAP_DIVUP(nregs, 32);
+
+      map->cache_nregs = nregs;
+      map->cache_val   = kmm_zalloc(nregs * sizeof(uint32_t));
+      map->cache_valid = kmm_zalloc(words * sizeof(uint32_t));
+      map->cache_dirty = kmm_zalloc(words * sizeof(uint32_t));
+      if (map->cache_val == NULL || map->cache_valid == NULL ||
+          map->cache_dirty == NULL)
+        {
+          kmm_free(map->cache_val);
+          kmm_free(map->cache_valid);
+          kmm_free(map->cache_dirty);
+          if (!config->disable_locking)
+            {
+              nxmutex_destroy(&map->mutex[0]);
+            }
+
+          kmm_free(map);
+          return NULL;
+        }
+    }
+#endif
+
   return map;
 }
 
@@ -171,6 +497,23 @@ int regmap_write(FAR struct regmap_s *map, unsigned int reg,
 
   map->lock(map);
 
+#ifdef CONFIG_REGMAP_CACHE
+  if (map->cache_mode != REGMAP_CACHE_NONE)
+    {
+      /* Lazy write-back: only update the cache here and leave the bus
+       * access to regmap_cache_flush().  Registers above max_register
+       * are not cacheable and go straight to the bus.
+       */
+
+      ret = regmap_cache_set(map, reg, val, true);
+      if (ret != -ERANGE)
+        {
+          map->unlock(map);
+          return ret;
+        }
+    }
+#endif
+
   ret = map->reg_write(map->bus, reg, val);
 
   map->unlock(map);
@@ -212,6 +555,16 @@ int regmap_bulk_write(FAR struct regmap_s *map, unsigned int reg,
   DEBUGASSERT(REGMAP_ALIGNED(reg, map->reg_stride));
 
   map->lock(map);
+
+#ifdef CONFIG_REGMAP_CACHE
+  /* A bulk access bypasses the cache; forget the registers it touches */
+
+  if (map->cache_mode != REGMAP_CACHE_NONE)
+    {
+      regmap_cache_drop_range(map, reg, val_count);
+    }
+#endif
+
   if (map->write != NULL)
     {
       ret = map->write(map->bus, val, val_bytes * val_count);
@@ -272,14 +625,64 @@ out:
 
 int regmap_read(FAR struct regmap_s *map, unsigned int reg, FAR void *val)
 {
+#ifdef CONFIG_REGMAP_CACHE
+  unsigned int ival;
+#endif
   int ret;
 
   DEBUGASSERT(REGMAP_ALIGNED(reg, map->reg_stride));
 
   map->lock(map);
 
+#ifdef CONFIG_REGMAP_CACHE
+  if (map->cache_mode != REGMAP_CACHE_NONE &&
+      regmap_cache_get(map, reg, &ival) == OK)
+    {
+      switch (map->val_bytes)
+        {
+          case 1:
+            *(FAR uint8_t *)val = ival;
+            break;
+          case 2:
+            *(FAR uint16_t *)val = ival;
+            break;
+          case 4:
+            *(FAR uint32_t *)val = ival;
+            break;
+          default:
+            map->unlock(map);
+            return -EINVAL;
+        }
+
+      map->unlock(map);
+      return OK;
+    }
+#endif
+
   ret = map->reg_read(map->bus, reg, val);
 
+#ifdef CONFIG_REGMAP_CACHE
+  if (ret >= 0 && map->cache_mode != REGMAP_CACHE_NONE)
+    {
+      /* Remember the value just read, best effort only */
+
+      switch (map->val_bytes)
+        {
+          case 1:
+            regmap_cache_set(map, reg, *(FAR uint8_t *)val, false);
+            break;
+          case 2:
+            regmap_cache_set(map, reg, *(FAR uint16_t *)val, false);
+            break;
+          case 4:
+            regmap_cache_set(map, reg, *(FAR uint32_t *)val, false);
+            break;
+          default:
+            break;
+        }
+    }
+#endif
+
   map->unlock(map);
   return ret;
 }
@@ -320,6 +723,15 @@ int regmap_bulk_read(FAR struct regmap_s *map, unsigned int reg,
 
   map->lock(map);
 
+#ifdef CONFIG_REGMAP_CACHE
+  /* A bulk access bypasses the cache; forget the registers it touches */
+
+  if (map->cache_mode != REGMAP_CACHE_NONE)
+    {
+      regmap_cache_drop_range(map, reg, val_count);
+    }
+#endif
+
   if (map->read != NULL)
     {
       ret = map->read(map->bus, &reg, map->reg_bytes, val, val_count);
@@ -357,6 +769,177 @@ int regmap_bulk_read(FAR struct regmap_s *map, unsigned int reg,
   return ret;
 }
 
+#ifdef CONFIG_REGMAP_CACHE
+/****************************************************************************
+ * Name: regmap_cache_flush
+ *
+ * Description:
+ *   Write all dirty cached register values back to the device.  Runs of
+ *   consecutive dirty registers are coalesced into one bulk transaction
+ *   where the bus supports it.
+ *
+ * Input Parameters:
+ *   map - regmap handler, from regmap bus init function return.
+ *
+ * Returned Value:
+ *   Zero on success; a negated errno value from the first failed bus
+ *   access otherwise.  Values that could not be written stay dirty.
+ *
+ * Assumptions/Limitations:
+ *   None.
+ *
+ ****************************************************************************/
+
+int regmap_cache_flush(FAR struct regmap_s *map)
+{
+  FAR struct regmap_cache_entry_s *entries;
+  FAR uint32_t *table;
+  FAR uint32_t *vals;
+  unsigned int start;
+  unsigned int count;
+  unsigned int idx;
+  unsigned int i;
+  int ret = OK;
+
+  map->lock(map);
+
+  if (map->cache_mode == REGMAP_CACHE_FLAT)
+    {
+      table = map->cache_val;
+      for (idx = 0; idx < map->cache_nregs && ret >= 0; )
+        {
+          if ((map->cache_dirty[REGMAP_BIT_WORD(idx)] &
+               REGMAP_BIT_MASK(idx)) == 0)
+            {
+              idx++;
+              continue;
+            }
+
+          /* Collect the run of consecutive dirty registers */
+
+          start = idx;
+          do
+            {
+              idx++;
+            }
+          while (idx < map->cache_nregs &&
+                 (map->cache_dirty[REGMAP_BIT_WORD(idx)] &
+                  REGMAP_BIT_MASK(idx)) != 0);
+
+          ret = regmap_cache_writeback(map, start * map->reg_stride,
+                                       &table[start], idx - start);
+          if (ret >= 0)
+            {
+              for (i = start; i < idx; i++)
+                {
+                  map->cache_dirty[REGMAP_BIT_WORD(i)] &=
+                    ~REGMAP_BIT_MASK(i);
+                }
+            }
+        }
+    }
+  else if (map->cache_mode == REGMAP_CACHE_SPARSE)
+    {
+      entries = map->cache_val;
+      for (idx = 0; idx < map->cache_nregs && ret >= 0; )
+        {
+          if (!entries[idx].dirty)
+            {
+              idx++;
+              continue;
+            }
+
+          /* Collect the run of adjacent dirty entries */
+
+          start = idx;
+          do
+            {
+              idx++;
+            }
+          while (idx < map->cache_nregs && entries[idx].dirty &&
+                 entries[idx].reg ==
+                 entries[idx - 1].reg + map->reg_stride);
+
+          count = idx - start;
+          vals  = kmm_malloc(count * sizeof(*vals));
+          if (vals != NULL)
+            {
+              for (i = 0; i < count; i++)
+                {
+                  vals[i] = entries[start + i].val;
+                }
+
+              ret = regmap_cache_writeback(map, entries[start].reg,
+                                           vals, count);
+              kmm_free(vals);
+              if (ret >= 0)
+                {
+                  for (i = start; i < idx; i++)
+                    {
+                      entries[i].dirty = false;
+                    }
+                }
+            }
+          else
+            {
+              /* Cannot gather the run, write it one register at a time */
+
+              for (i = start; i < idx && ret >= 0; i++)
+                {
+                  ret = regmap_cache_writeback(map, entries[i].reg,
+                                               &entries[i].val, 1);
+                  if (ret >= 0)
+                    {
+                      entries[i].dirty = false;
+                    }
+                }
+            }
+        }
+    }
+
+  map->unlock(map);
+  return ret < 0 ? ret : OK;
+}
+
+/****************************************************************************
+ * Name: regmap_cache_drop
+ *
+ * Description:
+ *   Discard all cached register values, including dirty ones.  Following
+ *   reads go to the device again.
+ *
+ * Input Parameters:
+ *   map - regmap handler, from regmap bus init function return.
+ *
+ * Returned Value:
+ *   Zero is always returned.
+ *
+ * Assumptions/Limitations:
+ *   None.
+ *
+ ****************************************************************************/
+
+int regmap_cache_drop(FAR struct regmap_s *map)
+{
+  map->lock(map);
+
+  if (map->cache_mode == REGMAP_CACHE_FLAT)
+    {
+      memset(map->cache_valid, 0,
+             REGMAP_DIVUP(map->cache_nregs, 32) * sizeof(uint32_t));
+      memset(map->cache_dirty, 0,
+             REGMAP_DIVUP(map->cache_nregs, 32) * sizeof(uint32_t));
+    }
+  else if (map->cache_mode == REGMAP_CACHE_SPARSE)
+    {
+      map->cache_nregs = 0;
+    }
+
+  map->unlock(map);
+  return OK;
+}
+#endif /* CONFIG_REGMAP_CACHE */
+
 /****************************************************************************
  * Name: regmap_exit
  *
@@ -372,6 +955,12 @@ int regmap_bulk_read(FAR struct regmap_s *map, unsigned int reg,
 
 void regmap_exit(FAR struct regmap_s *map)
 {
+#ifdef CONFIG_REGMAP_CACHE
+  kmm_free(map->cache_val);
+  kmm_free(map->cache_valid);
+  kmm_free(map->cache_dirty);
+#endif
+
   if (!map->disable_locking)
     {
       nxmutex_destroy(&map->mutex[0]);
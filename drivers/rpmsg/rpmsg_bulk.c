@@ -0,0 +1,317 @@
+/****************************************************************************
+ * drivers/rpmsg/rpmsg_bulk.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <debug.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <nuttx/kmalloc.h>
+#include <nuttx/mm/mm.h>
+#include <nuttx/rpmsg/rpmsg.h>
+#include <nuttx/rpmsg/rpmsg_bulk.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define RPMSG_BULK_EPT_FORMAT       "rpmsg-bulk-%s"
+
+#define RPMSG_BULK_RECLAIM          0
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+begin_packed_struct struct rpmsg_bulk_reclaim_s
+{
+  uint32_t                  command;
+  uint32_t                  offset;
+} end_packed_struct;
+
+/* This structure describes one side of a bulk shared-memory pool */
+
+struct rpmsg_bulk_s
+{
+  struct rpmsg_endpoint     ept;
+  FAR uint8_t              *base;    /* Local address of the pool */
+  size_t                    size;    /* Size of the pool */
+  bool                      owner;   /* True: this side allocates */
+  FAR struct mm_heap_s     *heap;    /* Pool allocator (owner side only) */
+  char                      cpuname[RPMSG_NAME_SIZE];
+  char                      name[RPMSG_NAME_SIZE];
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: rpmsg_bulk_ept_cb
+ *
+ * Description:
+ *   Process messages on the bulk endpoint.  Only the owner side receives
+ *   traffic: reclaim messages returning payload buffers to the pool.
+ *
+ ****************************************************************************/
+
+static int rpmsg_bulk_ept_cb(FAR struct rpmsg_endpoint *ept,
+                             FAR void *data, size_t len,
+                             uint32_t src, FAR void *priv)
+{
+  FAR struct rpmsg_bulk_s *bulk =
+    metal_container_of(ept, struct rpmsg_bulk_s, ept);
+  FAR struct rpmsg_bulk_reclaim_s *msg = data;
+
+  if (len >= sizeof(*msg) && msg->command == RPMSG_BULK_RECLAIM &&
+      bulk->owner)
+    {
+      mm_free(bulk->heap, bulk->base + msg->offset);
+    }
+
+  return 0;
+}
+
+/****************************************************************************
+ * Name: rpmsg_bulk_device_created
+ *
+ * Description:
+ *   The peer (non-owner) side initiates the endpoint when the rpmsg
+ *   device towards the owner cpu comes up.
+ *
+ ****************************************************************************/
+
+static void rpmsg_bulk_device_created(FAR struct rpmsg_device *rdev,
+                                      FAR void *priv)
+{
+  FAR struct rpmsg_bulk_s *bulk = priv;
+
+  if (!bulk->owner &&
+      strcmp(bulk->cpuname, rpmsg_get_cpuname(rdev)) == 0)
+    {
+      rpmsg_create_ept(&bulk->ept, rdev, bulk->name,
+                       RPMSG_ADDR_ANY, RPMSG_ADDR_ANY,
+                       rpmsg_bulk_ept_cb, NULL);
+    }
+}
+
+static void rpmsg_bulk_device_destroy(FAR struct rpmsg_device *rdev,
+                                      FAR void *priv)
+{
+  FAR struct rpmsg_bulk_s *bulk = priv;
+
+  if (strcmp(bulk->cpuname, rpmsg_get_cpuname(rdev)) == 0)
+    {
+      rpmsg_destroy_ept(&bulk->ept);
+    }
+}
+
+/****************************************************************************
+ * Name: rpmsg_bulk_ns_match/rpmsg_bulk_ns_bind
+ *
+ * Description:
+ *   The owner side answers the name-service announcement of the peer.
+ *
+ ****************************************************************************/
+
+static bool rpmsg_bulk_ns_match(FAR struct rpmsg_device *rdev,
+                                FAR void *priv, FAR const char *name,
+                                uint32_t dest)
+{
+  FAR struct rpmsg_bulk_s *bulk = priv;
+
+  return bulk->owner && strcmp(name, bulk->name) == 0 &&
+         strcmp(bulk->cpuname, rpmsg_get_cpuname(rdev)) == 0;
+}
+
+static void rpmsg_bulk_ns_bind(FAR struct rpmsg_device *rdev,
+                               FAR void *priv, FAR const char *name,
+                               uint32_t dest)
+{
+  FAR struct rpmsg_bulk_s *bulk = priv;
+
+  rpmsg_create_ept(&bulk->ept, rdev, name, RPMSG_ADDR_ANY, dest,
+                   rpmsg_bulk_ept_cb, NULL);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: rpmsg_bulk_register
+ *
+ * Description:
+ *   Attach to a bulk shared-memory pool used to pass large payloads
+ *   between two cpus without copying them through the rpmsg buffers.
+ *   Both sides must register the same pool (same name and the same
+ *   shared-memory region, each given in its local address space).
+ *
+ * Input Parameters:
+ *   cpuname - The remote cpu sharing the pool
+ *   name    - The name of the pool
+ *   base    - The local address of the shared-memory region
+ *   size    - The size of the shared-memory region
+ *   owner   - True if this side allocates from the pool
+ *
+ * Returned Value:
+ *   The pool handle on success; NULL on any failure.
+ *
+ ****************************************************************************/
+
+FAR struct rpmsg_bulk_s *rpmsg_bulk_register(FAR const char *cpuname,
+                                             FAR const char *name,
+                                             FAR void *base, size_t size,
+                                             bool owner)
+{
+  FAR struct rpmsg_bulk_s *bulk;
+  int ret;
+
+  if (cpuname == NULL || name == NULL || base == NULL || size == 0)
+    {
+      return NULL;
+    }
+
+  bulk = kmm_zalloc(sizeof(struct rpmsg_bulk_s));
+  if (bulk == NULL)
+    {
+      return NULL;
+    }
+
+  bulk->base  = base;
+  bulk->size  = size;
+  bulk->owner = owner;
+  strlcpy(bulk->cpuname, cpuname, sizeof(bulk->cpuname));
+  snprintf(bulk->name, sizeof(bulk->name), RPMSG_BULK_EPT_FORMAT, name);
+
+  if (owner)
+    {
+      bulk->heap = mm_initialize(bulk->name, base, size);
+      if (bulk->heap == NULL)
+        {
+          kmm_free(bulk);
+          return NULL;
+        }
+    }
+
+  ret = rpmsg_register_callback(bulk,
+                                rpmsg_bulk_device_created,
+                                rpmsg_bulk_device_destroy,
+                                rpmsg_bulk_ns_match,
+                                rpmsg_bulk_ns_bind);
+  if (ret < 0)
+    {
+      if (bulk->heap != NULL)
+        {
+          mm_uninitialize(bulk->heap);
+        }
+
+      kmm_free(bulk);
+      return NULL;
+    }
+
+  return bulk;
+}
+
+/****************************************************************************
+ * Name: rpmsg_bulk_alloc
+ *
+ * Description:
+ *   Allocate a payload buffer from the pool.  Only the owner side of the
+ *   pool may allocate.
+ *
+ * Returned Value:
+ *   The buffer address on success; NULL if the pool is exhausted.
+ *
+ ****************************************************************************/
+
+FAR void *rpmsg_bulk_alloc(FAR struct rpmsg_bulk_s *bulk, size_t size)
+{
+  DEBUGASSERT(bulk->owner);
+
+  return mm_malloc(bulk->heap, size);
+}
+
+/****************************************************************************
+ * Name: rpmsg_bulk_free
+ *
+ * Description:
+ *   Return a payload buffer to the pool.  On the owner side the buffer
+ *   is freed directly; on the peer side a reclaim message is sent to the
+ *   owner.
+ *
+ ****************************************************************************/
+
+void rpmsg_bulk_free(FAR struct rpmsg_bulk_s *bulk, FAR void *mem)
+{
+  struct rpmsg_bulk_reclaim_s msg;
+  int ret;
+
+  if (bulk->owner)
+    {
+      mm_free(bulk->heap, mem);
+      return;
+    }
+
+  msg.command = RPMSG_BULK_RECLAIM;
+  msg.offset  = rpmsg_bulk_getoffset(bulk, mem);
+
+  ret = rpmsg_send(&bulk->ept, &msg, sizeof(msg));
+  if (ret < 0)
+    {
+      rpmsgerr("reclaim of offset %" PRIu32 " failed: %d\n",
+               msg.offset, ret);
+    }
+}
+
+/****************************************************************************
+ * Name: rpmsg_bulk_getoffset/rpmsg_bulk_getaddress
+ *
+ * Description:
+ *   Convert between a payload buffer address and its pool offset.  The
+ *   offset is what travels in the rpmsg message since the two sides may
+ *   map the pool at different addresses.
+ *
+ ****************************************************************************/
+
+uint32_t rpmsg_bulk_getoffset(FAR struct rpmsg_bulk_s *bulk,
+                              FAR const void *mem)
+{
+  DEBUGASSERT((FAR const uint8_t *)mem >= bulk->base &&
+              (FAR const uint8_t *)mem < bulk->base + bulk->size);
+
+  return (FAR const uint8_t *)mem - bulk->base;
+}
+
+FAR void *rpmsg_bulk_getaddress(FAR struct rpmsg_bulk_s *bulk,
+                                uint32_t offset)
+{
+  DEBUGASSERT(offset < bulk->size);
+
+  return bulk->base + offset;
+}
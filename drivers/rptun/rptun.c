@@ -881,6 +881,17 @@ static int rptun_dev_start(FAR struct remoteproc *rproc)
           rpmsg_virtio_init_shm_pool(&priv->pool[1], shbuf, shbufsz);
         }
 
+#ifdef CONFIG_RPTUN_EVENT_IDX
+      /* Advertise event-index based doorbell/interrupt suppression.  The
+       * virtio ring layer then batches notifications:  A burst of sends
+       * rings the doorbell once instead of once per message.  The slave
+       * picks the feature up from the shared resource table during
+       * negotiation.
+       */
+
+      rsc->rpmsg_vdev.dfeatures |= VIRTIO_RING_F_EVENT_IDX;
+#endif
+
       role = RPMSG_HOST;
     }
 
@@ -22,18 +22,62 @@
  * Included Files
  ****************************************************************************/
 
+#include <string.h>
+
+#include <nuttx/irq.h>
+#include <nuttx/sched.h>
+#include <nuttx/spinlock.h>
 #include <nuttx/note/note_driver.h>
 #include <nuttx/segger/note_rtt.h>
 #include <nuttx/segger/rtt.h>
 
+#ifdef CONFIG_NOTE_RTT_STAGING
+#  include <SEGGER_RTT.h>
+#endif
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifdef CONFIG_NOTE_RTT_STAGING
+#  define NOTERTT_STAGING_SIZE  CONFIG_NOTE_RTT_STAGING_BUFSIZE
+
+#  ifdef CONFIG_SMP
+#    define NOTERTT_NCPUS       CONFIG_SMP_NCPUS
+#  else
+#    define NOTERTT_NCPUS       1
+#  endif
+#endif
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
 
+#ifdef CONFIG_NOTE_RTT_STAGING
+/* Per-CPU staging ring.  The local CPU appends whole notes with interrupts
+ * disabled (the producer), the head index is advanced only after the note
+ * bytes are in place.  The ring is drained to the RTT up buffer by whoever
+ * holds the global drain lock (the consumer), which is the only context
+ * that moves the tail index.
+ */
+
+struct notertt_cpu_s
+{
+  volatile uint16_t head;      /* Next byte to write (local CPU only) */
+  volatile uint16_t tail;      /* Next byte to drain (under drain lock) */
+  uint32_t dropped;            /* Notes lost to staging overflow */
+  uint8_t  buffer[NOTERTT_STAGING_SIZE];
+};
+#endif
+
 struct notertt_s
 {
   struct note_driver_s driver;
   struct lib_rttoutstream_s stream;
+#ifdef CONFIG_NOTE_RTT_STAGING
+  spinlock_t lock;             /* Serializes draining to the RTT buffer */
+  struct notertt_cpu_s cpu[NOTERTT_NCPUS];
+#endif
 };
 
 /****************************************************************************
@@ -63,6 +107,106 @@ struct notertt_s g_notertt =
  * Private Functions
  ****************************************************************************/
 
+#ifdef CONFIG_NOTE_RTT_STAGING
+
+/****************************************************************************
+ * Name: notertt_stage
+ *
+ * Description:
+ *   Copy a whole note into the staging ring of the current CPU.  Returns
+ *   false when the ring does not have room for the complete note; partial
+ *   notes are never staged since they would corrupt the stream.
+ *
+ ****************************************************************************/
+
+static bool notertt_stage(FAR struct notertt_cpu_s *stage,
+                          FAR const uint8_t *note, size_t len)
+{
+  uint16_t head = stage->head;
+  uint16_t tail = stage->tail;
+  uint16_t used = (head - tail + NOTERTT_STAGING_SIZE) %
+                  NOTERTT_STAGING_SIZE;
+  size_t part;
+
+  if (len >= NOTERTT_STAGING_SIZE - used)
+    {
+      return false;
+    }
+
+  part = NOTERTT_STAGING_SIZE - head;
+  if (part >= len)
+    {
+      memcpy(&stage->buffer[head], note, len);
+    }
+  else
+    {
+      memcpy(&stage->buffer[head], note, part);
+      memcpy(stage->buffer, note + part, len - part);
+    }
+
+  /* Publish the note only after its bytes are in place */
+
+  stage->head = (head + len) % NOTERTT_STAGING_SIZE;
+  return true;
+}
+
+/****************************************************************************
+ * Name: notertt_drain
+ *
+ * Description:
+ *   Move staged notes from all the CPU rings to the RTT up buffer.  A
+ *   note is only forwarded when the RTT buffer can take it completely;
+ *   when the host reader falls behind, the notes stay staged and are
+ *   retried on the next call (flow control without blocking the caller).
+ *   Must be called with the drain lock held.
+ *
+ ****************************************************************************/
+
+static void notertt_drain(FAR struct notertt_s *note)
+{
+  FAR struct notertt_cpu_s *stage;
+  unsigned int avail;
+  uint16_t tail;
+  uint8_t len;
+  size_t part;
+  int cpu;
+
+  avail = SEGGER_RTT_GetAvailWriteSpace(note->stream.channel);
+  for (cpu = 0; cpu < NOTERTT_NCPUS; cpu++)
+    {
+      stage = &note->cpu[cpu];
+      while (stage->tail != stage->head)
+        {
+          /* The first byte of every note is its total length */
+
+          tail = stage->tail;
+          len  = stage->buffer[tail];
+          if (len > avail)
+            {
+              break;
+            }
+
+          part = NOTERTT_STAGING_SIZE - tail;
+          if (part >= len)
+            {
+              SEGGER_RTT_Write(note->stream.channel,
+                               &stage->buffer[tail], len);
+            }
+          else
+            {
+              SEGGER_RTT_Write(note->stream.channel,
+                               &stage->buffer[tail], part);
+              SEGGER_RTT_Write(note->stream.channel,
+                               stage->buffer, len - part);
+            }
+
+          avail       -= len;
+          stage->tail  = (tail + len) % NOTERTT_STAGING_SIZE;
+        }
+    }
+}
+#endif /* CONFIG_NOTE_RTT_STAGING */
+
 /****************************************************************************
  * Name: notertt_add
  *
@@ -82,7 +226,33 @@ static void notertt_add(FAR struct note_driver_s *drv,
                         FAR const void *buf, size_t notelen)
 {
   FAR struct notertt_s *note = (FAR struct notertt_s *)drv;
+#ifdef CONFIG_NOTE_RTT_STAGING
+  FAR struct notertt_cpu_s *stage;
+  irqstate_t flags;
+
+  /* Stage the note locally first so that notes from different CPUs can
+   * never interleave inside the RTT buffer.
+   */
+
+  flags = up_irq_save();
+  stage = &note->cpu[this_cpu()];
+  if (!notertt_stage(stage, buf, notelen))
+    {
+      stage->dropped++;
+      up_irq_restore(flags);
+      return;
+    }
+
+  up_irq_restore(flags);
+
+  /* Drain the staged notes of all CPUs to the RTT buffer */
+
+  flags = spin_lock_irqsave(&note->lock);
+  notertt_drain(note);
+  spin_unlock_irqrestore(&note->lock, flags);
+#else
   lib_stream_puts(&note->stream, buf, notelen);
+#endif
 }
 
 /****************************************************************************
@@ -104,5 +274,8 @@ int notertt_register(void)
   lib_rttoutstream_open(&g_notertt.stream,
                         CONFIG_NOTE_RTT_CHANNEL,
                         CONFIG_NOTE_RTT_BUFFER_SIZE_UP);
+#ifdef CONFIG_NOTE_RTT_STAGING
+  spin_lock_init(&g_notertt.lock);
+#endif
   return note_driver_register(&g_notertt.driver);
 }
@@ -424,6 +424,43 @@ static bool sensor_is_updated(FAR struct sensor_upperhalf_s *upper,
     }
 }
 
+static bool sensor_should_wakeup(FAR struct sensor_upperhalf_s *upper,
+                                 FAR struct sensor_user_s *user)
+{
+  long long delta;
+  size_t nums;
+
+  /* Wake the user on every event unless the user requested batching (a
+   * non-zero latency) and the hardware cannot batch by itself.  In the
+   * latter case the wakeup is deferred until the events accumulated in
+   * the circular buffer cover the requested latency, so that a slow
+   * reader is woken once per batch instead of once per sample.
+   */
+
+  if (user->state.latency == 0 || upper->lower->ops->batch != NULL)
+    {
+      return true;
+    }
+
+  /* Never defer beyond the capacity of the circular buffer, otherwise
+   * the oldest events would be overwritten before the user reads them.
+   */
+
+  nums = upper->timing.head / TIMING_BUF_ESIZE - user->bufferpos;
+  if (nums + 1 >= upper->state.nbuffer)
+    {
+      return true;
+    }
+
+  /* The generation counter advances by the publish interval (in
+   * microseconds) on every event, so the buffered-but-unread time of
+   * this user is simply the generation delta.
+   */
+
+  delta = (long long)upper->state.generation - user->state.generation;
+  return delta >= user->state.latency;
+}
+
 static void sensor_catch_up(FAR struct sensor_upperhalf_s *upper,
                             FAR struct sensor_user_s *user)
 {
@@ -1140,7 +1177,8 @@ static ssize_t sensor_push_event(FAR void *priv, FAR const void *data,
   sensor_generate_timing(upper, envcount);
   list_for_every_entry(&upper->userlist, user, struct sensor_user_s, node)
     {
-      if (sensor_is_updated(upper, user))
+      if (sensor_is_updated(upper, user) &&
+          sensor_should_wakeup(upper, user))
         {
           nxsem_get_value(&user->buffersem, &semcount);
           if (semcount < 1)
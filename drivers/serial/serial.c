@@ -43,6 +43,7 @@
 #include <nuttx/ascii.h>
 #include <nuttx/arch.h>
 #include <nuttx/clock.h>
+#include <nuttx/wdog.h>
 #include <nuttx/sched.h>
 #include <nuttx/signal.h>
 #include <nuttx/fs/fs.h>
@@ -90,6 +91,12 @@
 static void    uart_poll_notify(FAR uart_dev_t *dev, unsigned int min,
                                 unsigned int max, pollevent_t eventset);
 
+/* RX DMA poll support */
+
+#if defined(CONFIG_SERIAL_RXDMA) && CONFIG_SERIAL_RXDMA_TIMEOUT > 0
+static void    uart_rxdmapoll(wdparm_t arg);
+#endif
+
 /* Write support */
 
 static int     uart_putxmitchar(FAR uart_dev_t *dev, int ch,
@@ -159,6 +166,28 @@ static struct work_s g_serial_work;
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: uart_rxdmapoll
+ *
+ * Description:
+ *   Periodically ask the lower half driver to flush any bytes held in a
+ *   partially filled RX DMA buffer, so that slowly arriving data reaches
+ *   readers with bounded latency even if the hardware has no idle line
+ *   detection.  The timer runs while the device is open.
+ *
+ ****************************************************************************/
+
+#if defined(CONFIG_SERIAL_RXDMA) && CONFIG_SERIAL_RXDMA_TIMEOUT > 0
+static void uart_rxdmapoll(wdparm_t arg)
+{
+  FAR uart_dev_t *dev = (FAR uart_dev_t *)arg;
+
+  uart_dmarxpoll(dev);
+  wd_start(&dev->rxdmatimer, MSEC2TICK(CONFIG_SERIAL_RXDMA_TIMEOUT),
+           uart_rxdmapoll, arg);
+}
+#endif
+
 /****************************************************************************
  * Name: uart_poll_notify
  ****************************************************************************/
@@ -693,6 +722,17 @@ static int uart_open(FAR struct file *filep)
       /* Notify DMA that there is free space in the RX buffer */
 
       uart_dmarxfree(dev);
+
+#if CONFIG_SERIAL_RXDMA_TIMEOUT > 0
+      /* Periodically flush partially filled RX DMA buffers */
+
+      if (dev->ops->dmarxpoll != NULL)
+        {
+          wd_start(&dev->rxdmatimer,
+                   MSEC2TICK(CONFIG_SERIAL_RXDMA_TIMEOUT),
+                   uart_rxdmapoll, (wdparm_t)dev);
+        }
+#endif
 #endif
 
       /* Enable the RX interrupt */
@@ -749,6 +789,12 @@ static int uart_close(FAR struct file *filep)
 
   uart_disablerxint(dev);
 
+#if defined(CONFIG_SERIAL_RXDMA) && CONFIG_SERIAL_RXDMA_TIMEOUT > 0
+  /* Stop polling the RX DMA buffers */
+
+  wd_cancel(&dev->rxdmatimer);
+#endif
+
   /* Prevent blocking if the device is opened with O_NONBLOCK */
 
   if ((filep->f_oflags & O_NONBLOCK) == 0)
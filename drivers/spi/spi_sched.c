@@ -0,0 +1,283 @@
+/****************************************************************************
+ * drivers/spi/spi_sched.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <assert.h>
+#include <errno.h>
+
+#include <nuttx/irq.h>
+#include <nuttx/kmalloc.h>
+#include <nuttx/queue.h>
+#include <nuttx/wqueue.h>
+#include <nuttx/spi/spi.h>
+#include <nuttx/spi/spi_transfer.h>
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* The state of one SPI bus scheduler.  The structure is opaque to
+ * clients.
+ */
+
+struct spi_sched_s
+{
+  FAR struct spi_dev_s *spi; /* The scheduled bus */
+  struct work_s work;        /* Drains the queue of requests */
+  sq_queue_t pending;        /* Queued requests, highest priority first */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: spi_sched_worker
+ *
+ * Description:
+ *   Perform the queued sequences on the low priority work queue, invoking
+ *   the completion callback of each request after its sequence has
+ *   finished.  The queue is kept sorted by priority, so the highest
+ *   priority pending request runs next at every sequence boundary.
+ *
+ ****************************************************************************/
+
+static void spi_sched_worker(FAR void *arg)
+{
+  FAR struct spi_sched_s *sched = arg;
+  FAR struct spi_sched_req_s *req;
+  irqstate_t flags;
+
+  for (; ; )
+    {
+      flags = enter_critical_section();
+      req = (FAR struct spi_sched_req_s *)sq_remfirst(&sched->pending);
+      leave_critical_section(flags);
+
+      if (req == NULL)
+        {
+          break;
+        }
+
+      /* Perform the sequence with the queue unlocked so that further
+       * requests may be queued in the meantime.  The bus is locked only
+       * for the duration of one sequence, so a higher priority request
+       * that arrives meanwhile is served directly afterwards.
+       */
+
+      req->result = spi_transfer(sched->spi, req->seq);
+
+      /* Notify the client.  The callback may re-queue, reuse or free the
+       * request.
+       */
+
+      if (req->callback != NULL)
+        {
+          req->callback(req);
+        }
+    }
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: spi_sched_initialize
+ *
+ * Description:
+ *   Create a transaction scheduler on top of an SPI bus.  Sequences
+ *   queued with spi_sched_submit() are performed on the low priority work
+ *   queue in priority order, FIFO among requests of equal priority, using
+ *   spi_transfer().
+ *
+ * Input Parameters:
+ *   spi - An instance of the lower half SPI driver
+ *
+ * Returned Value:
+ *   A reference to the scheduler on success; NULL on allocation failure.
+ *
+ ****************************************************************************/
+
+FAR struct spi_sched_s *spi_sched_initialize(FAR struct spi_dev_s *spi)
+{
+  FAR struct spi_sched_s *sched;
+
+  DEBUGASSERT(spi != NULL);
+
+  sched = kmm_zalloc(sizeof(struct spi_sched_s));
+  if (sched != NULL)
+    {
+      sched->spi = spi;
+      sq_init(&sched->pending);
+    }
+
+  return sched;
+}
+
+/****************************************************************************
+ * Name: spi_sched_uninitialize
+ *
+ * Description:
+ *   Destroy a transaction scheduler.  The scheduler must be idle:  All
+ *   queued requests must have completed (or been cancelled) before this
+ *   function is called.
+ *
+ * Input Parameters:
+ *   sched - The scheduler to destroy
+ *
+ ****************************************************************************/
+
+void spi_sched_uninitialize(FAR struct spi_sched_s *sched)
+{
+  DEBUGASSERT(sched != NULL && sq_peek(&sched->pending) == NULL &&
+              work_available(&sched->work));
+
+  kmm_free(sched);
+}
+
+/****************************************************************************
+ * Name: spi_sched_submit
+ *
+ * Description:
+ *   Queue a sequence of SPI transfers for asynchronous completion.  The
+ *   function returns immediately; when the sequence has been performed,
+ *   req->result holds the result of spi_transfer() and the completion
+ *   callback of the request is invoked from the low priority work queue.
+ *
+ *   Requests are served in priority order (higher values first) and in
+ *   FIFO order among requests of equal priority.  A running sequence is
+ *   never interrupted; priority takes effect at sequence boundaries, so
+ *   bulk clients should split their traffic into multiple sequences to
+ *   bound the latency seen by higher priority clients.
+ *
+ *   The request structure, the sequence and all buffers it refers to are
+ *   provided by the caller and must remain valid until the callback has
+ *   been invoked.
+ *
+ * Input Parameters:
+ *   sched - The scheduler
+ *   req   - The request to queue
+ *
+ * Returned Value:
+ *   Zero (OK) if the request was queued; a negated errno value on failure.
+ *   Failure to queue does not invoke the callback.
+ *
+ ****************************************************************************/
+
+int spi_sched_submit(FAR struct spi_sched_s *sched,
+                     FAR struct spi_sched_req_s *req)
+{
+  FAR sq_entry_t *prev = NULL;
+  FAR sq_entry_t *entry;
+  irqstate_t flags;
+  int ret = OK;
+
+  DEBUGASSERT(sched != NULL && req != NULL && req->seq != NULL);
+
+  flags = enter_critical_section();
+
+  /* Insert after the last queued request of equal or higher priority. */
+
+  for (entry = sq_peek(&sched->pending); entry != NULL;
+       entry = sq_next(entry))
+    {
+      FAR struct spi_sched_req_s *queued =
+        (FAR struct spi_sched_req_s *)entry;
+
+      if (queued->priority < req->priority)
+        {
+          break;
+        }
+
+      prev = entry;
+    }
+
+  if (prev == NULL)
+    {
+      sq_addfirst(&req->node, &sched->pending);
+    }
+  else
+    {
+      sq_addafter(prev, &req->node, &sched->pending);
+    }
+
+  /* Kick the worker unless it is already draining the queue. */
+
+  if (work_available(&sched->work))
+    {
+      ret = work_queue(LPWORK, &sched->work, spi_sched_worker, sched, 0);
+      if (ret < 0)
+        {
+          sq_rem(&req->node, &sched->pending);
+        }
+    }
+
+  leave_critical_section(flags);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: spi_sched_cancel
+ *
+ * Description:
+ *   Remove a request from the scheduler before it has been started.  The
+ *   completion callback of a cancelled request is not invoked.
+ *
+ * Input Parameters:
+ *   sched - The scheduler
+ *   req   - The request to cancel
+ *
+ * Returned Value:
+ *   Zero (OK) if the request was still queued and has been removed;
+ *   -ENOENT if the request is not in the queue (it may have completed
+ *   already or be in progress on the bus).
+ *
+ ****************************************************************************/
+
+int spi_sched_cancel(FAR struct spi_sched_s *sched,
+                     FAR struct spi_sched_req_s *req)
+{
+  FAR sq_entry_t *entry;
+  irqstate_t flags;
+  int ret = -ENOENT;
+
+  DEBUGASSERT(sched != NULL && req != NULL);
+
+  flags = enter_critical_section();
+  for (entry = sq_peek(&sched->pending); entry != NULL;
+       entry = sq_next(entry))
+    {
+      if (entry == &req->node)
+        {
+          sq_rem(entry, &sched->pending);
+          ret = OK;
+          break;
+        }
+    }
+
+  leave_critical_section(flags);
+  return ret;
+}
@@ -26,8 +26,10 @@
 
 #include <sys/types.h>
 #include <sys/ioctl.h>
+#include <sys/param.h>
 
 #include <stdio.h>
+#include <stdarg.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdlib.h>
@@ -38,10 +40,14 @@
 #include <assert.h>
 #include <debug.h>
 #include <ctype.h>
+#include <time.h>
 #include <sys/boardctl.h>
 
 #include <nuttx/arch.h>
+#include <nuttx/clock.h>
+#include <nuttx/init.h>
 #include <nuttx/kmalloc.h>
+#include <nuttx/sched.h>
 #include <nuttx/spinlock.h>
 #include <nuttx/semaphore.h>
 #include <nuttx/fs/fs.h>
@@ -59,6 +65,13 @@
 
 #define RAMLOG_MAGIC_NUMBER 0x12345678
 
+#ifdef CONFIG_RAMLOG_BINARY
+#  define RAMLOG_BREC_MAGIC     0x524c  /* Marks the start of a record */
+#  define RAMLOG_BREC_ALIGN(n)  (((n) + 7) & ~7)
+#  define RAMLOG_BREC_MAXLEN    (CONFIG_RAMLOG_BINARY_RECSIZE & ~7)
+#  define RAMLOG_BREC_HDRLEN    RAMLOG_BREC_ALIGN(sizeof(struct ramlog_brec_s))
+#endif
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -87,6 +100,73 @@ struct ramlog_user_s
   FAR struct pollfd *rl_fds;
 };
 
+#ifdef CONFIG_RAMLOG_BINARY
+/* One binary log record.  The header is followed by the captured
+ * arguments, stored as a sequence of 64-bit cells:  Every numeric
+ * argument occupies one cell; a string argument occupies one cell
+ * holding its length followed by the string bytes (with terminator)
+ * padded to a whole number of cells.  A NULL br_fmt marks a plain text
+ * record whose payload is encoded like a single string argument.
+ */
+
+struct ramlog_brec_s
+{
+  uint16_t br_magic;           /* Marks the start of a record */
+  uint8_t  br_len;             /* Total record length (multiple of 8) */
+  uint8_t  br_priority;        /* LOG_* priority of the message */
+#ifdef CONFIG_SMP
+  uint8_t  br_cpu;             /* CPU that generated the message */
+#endif
+#ifdef CONFIG_SYSLOG_TIMESTAMP
+  struct timespec br_time;     /* Time when the message was generated */
+#endif
+  FAR const IPTR char *br_fmt; /* Format string; NULL for plain text */
+};
+
+/* Argument class of one conversion specification */
+
+enum ramlog_bclass_e
+{
+  RAMLOG_BC_SIGNED = 0,        /* Signed integer, stored sign-extended */
+  RAMLOG_BC_UNSIGNED,          /* Unsigned integer, stored zero-extended */
+  RAMLOG_BC_CHAR,              /* Character (promoted to int) */
+  RAMLOG_BC_STRING,            /* String, copied inline */
+  RAMLOG_BC_POINTER,           /* Pointer value */
+  RAMLOG_BC_DOUBLE             /* Floating point (promoted to double) */
+};
+
+/* Length modifier of one conversion specification */
+
+enum ramlog_blm_e
+{
+  RAMLOG_LM_NONE = 0,
+  RAMLOG_LM_HH,
+  RAMLOG_LM_H,
+  RAMLOG_LM_L,
+  RAMLOG_LM_LL,
+  RAMLOG_LM_J,
+  RAMLOG_LM_Z,
+  RAMLOG_LM_T
+};
+
+/* A parsed conversion specification.  Both the capturing writer and the
+ * formatting reader use the same parser so that they always agree on the
+ * argument cell layout.
+ */
+
+struct ramlog_bconv_s
+{
+  uint8_t bc_class;            /* See enum ramlog_bclass_e */
+  uint8_t bc_lm;               /* See enum ramlog_blm_e */
+  bool bc_wstar;               /* Width given as '*' argument */
+  bool bc_pstar;               /* Precision given as '*' argument */
+  int bc_prec;                 /* Literal precision, -1 if none */
+  char bc_conv;                /* The conversion character */
+  FAR const char *bc_modstart; /* Where the length modifier begins */
+  FAR const char *bc_next;     /* First character after the conversion */
+};
+#endif /* CONFIG_RAMLOG_BINARY */
+
 struct ramlog_dev_s
 {
   /* The following is the header of the RAM buffer,
@@ -385,6 +465,802 @@ static ssize_t ramlog_addbuf(FAR struct ramlog_dev_s *priv,
   return len;
 }
 
+#ifdef CONFIG_RAMLOG_BINARY
+/****************************************************************************
+ * Name: ramlog_bparse
+ *
+ * Description:
+ *   Parse the conversion specification beginning at 'p' (the character
+ *   just past the '%').  Returns OK if the conversion is supported by the
+ *   binary capture format, or a negated errno value if not.
+ *
+ ****************************************************************************/
+
+static int ramlog_bparse(FAR const char *p, FAR struct ramlog_bconv_s *cv)
+{
+  cv->bc_wstar = false;
+  cv->bc_pstar = false;
+  cv->bc_prec  = -1;
+  cv->bc_lm    = RAMLOG_LM_NONE;
+
+  /* Flags */
+
+  while (*p == '-' || *p == '+' || *p == ' ' || *p == '#' ||
+         *p == '0' || *p == '\'')
+    {
+      p++;
+    }
+
+  /* Field width */
+
+  if (*p == '*')
+    {
+      cv->bc_wstar = true;
+      p++;
+    }
+  else
+    {
+      while (*p >= '0' && *p <= '9')
+        {
+          p++;
+        }
+    }
+
+  /* Precision */
+
+  if (*p == '.')
+    {
+      p++;
+      if (*p == '*')
+        {
+          cv->bc_pstar = true;
+          p++;
+        }
+      else
+        {
+          cv->bc_prec = 0;
+          while (*p >= '0' && *p <= '9')
+            {
+              cv->bc_prec = cv->bc_prec * 10 + (*p - '0');
+              p++;
+            }
+        }
+    }
+
+  /* Length modifier */
+
+  cv->bc_modstart = p;
+  if (*p == 'h')
+    {
+      cv->bc_lm = RAMLOG_LM_H;
+      if (*++p == 'h')
+        {
+          cv->bc_lm = RAMLOG_LM_HH;
+          p++;
+        }
+    }
+  else if (*p == 'l')
+    {
+      cv->bc_lm = RAMLOG_LM_L;
+      if (*++p == 'l')
+        {
+          cv->bc_lm = RAMLOG_LM_LL;
+          p++;
+        }
+    }
+  else if (*p == 'j')
+    {
+      cv->bc_lm = RAMLOG_LM_J;
+      p++;
+    }
+  else if (*p == 'z')
+    {
+      cv->bc_lm = RAMLOG_LM_Z;
+      p++;
+    }
+  else if (*p == 't')
+    {
+      cv->bc_lm = RAMLOG_LM_T;
+      p++;
+    }
+  else if (*p == 'L')
+    {
+      /* long double is not captured */
+
+      return -EINVAL;
+    }
+
+  /* Conversion */
+
+  cv->bc_conv = *p;
+  cv->bc_next = p + 1;
+
+  switch (*p)
+    {
+      case 'd':
+      case 'i':
+        cv->bc_class = RAMLOG_BC_SIGNED;
+        break;
+
+      case 'u':
+      case 'o':
+      case 'x':
+      case 'X':
+        cv->bc_class = RAMLOG_BC_UNSIGNED;
+        break;
+
+      case 'c':
+        if (cv->bc_lm != RAMLOG_LM_NONE)
+          {
+            return -EINVAL;
+          }
+
+        cv->bc_class = RAMLOG_BC_CHAR;
+        break;
+
+      case 's':
+        if (cv->bc_lm != RAMLOG_LM_NONE)
+          {
+            return -EINVAL;
+          }
+
+        cv->bc_class = RAMLOG_BC_STRING;
+        break;
+
+      case 'p':
+        if (cv->bc_lm != RAMLOG_LM_NONE)
+          {
+            return -EINVAL;
+          }
+
+        cv->bc_class = RAMLOG_BC_POINTER;
+        break;
+
+      case 'e':
+      case 'E':
+      case 'f':
+      case 'F':
+      case 'g':
+      case 'G':
+      case 'a':
+      case 'A':
+        cv->bc_class = RAMLOG_BC_DOUBLE;
+        break;
+
+      default:
+        return -EINVAL;
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: ramlog_bcapture
+ *
+ * Description:
+ *   Capture the arguments referenced by 'fmt' into the argument cells of
+ *   the record at 'buf'.  Returns the total record length in bytes, or a
+ *   negated errno value if the format uses an unsupported conversion or
+ *   the record space is exhausted.
+ *
+ ****************************************************************************/
+
+static ssize_t ramlog_bcapture(FAR uint8_t *buf, FAR const char *fmt,
+                               FAR va_list *ap)
+{
+  FAR uint64_t *cell = (FAR uint64_t *)(buf + RAMLOG_BREC_HDRLEN);
+  FAR uint64_t *cend = (FAR uint64_t *)(buf + RAMLOG_BREC_MAXLEN);
+  FAR const char *p = fmt;
+
+  while (*p != '\0')
+    {
+      struct ramlog_bconv_s cv;
+      int prec;
+
+      if (*p++ != '%')
+        {
+          continue;
+        }
+
+      if (*p == '%')
+        {
+          p++;
+          continue;
+        }
+
+      if (ramlog_bparse(p, &cv) < 0)
+        {
+          return -EINVAL;
+        }
+
+      prec = cv.bc_prec;
+      if (cv.bc_wstar)
+        {
+          if (cell >= cend)
+            {
+              return -EINVAL;
+            }
+
+          *cell++ = (uint64_t)(int64_t)va_arg(*ap, int);
+        }
+
+      if (cv.bc_pstar)
+        {
+          if (cell >= cend)
+            {
+              return -EINVAL;
+            }
+
+          prec = va_arg(*ap, int);
+          *cell++ = (uint64_t)(int64_t)prec;
+        }
+
+      if (cv.bc_class != RAMLOG_BC_STRING && cell >= cend)
+        {
+          return -EINVAL;
+        }
+
+      switch (cv.bc_class)
+        {
+          case RAMLOG_BC_SIGNED:
+            {
+              int64_t value;
+
+              switch (cv.bc_lm)
+                {
+                  case RAMLOG_LM_L:
+                    value = va_arg(*ap, long);
+                    break;
+                  case RAMLOG_LM_LL:
+                    value = va_arg(*ap, long long);
+                    break;
+                  case RAMLOG_LM_J:
+                    value = va_arg(*ap, intmax_t);
+                    break;
+                  case RAMLOG_LM_Z:
+                    value = (int64_t)(ssize_t)va_arg(*ap, size_t);
+                    break;
+                  case RAMLOG_LM_T:
+                    value = va_arg(*ap, ptrdiff_t);
+                    break;
+                  default:
+                    value = va_arg(*ap, int);
+                    break;
+                }
+
+              *cell++ = (uint64_t)value;
+            }
+            break;
+
+          case RAMLOG_BC_UNSIGNED:
+            {
+              uint64_t value;
+
+              switch (cv.bc_lm)
+                {
+                  case RAMLOG_LM_L:
+                    value = va_arg(*ap, unsigned long);
+                    break;
+                  case RAMLOG_LM_LL:
+                    value = va_arg(*ap, unsigned long long);
+                    break;
+                  case RAMLOG_LM_J:
+                    value = va_arg(*ap, uintmax_t);
+                    break;
+                  case RAMLOG_LM_Z:
+                    value = va_arg(*ap, size_t);
+                    break;
+                  case RAMLOG_LM_T:
+                    value = (uint64_t)va_arg(*ap, ptrdiff_t);
+                    break;
+                  default:
+                    value = va_arg(*ap, unsigned int);
+                    break;
+                }
+
+              *cell++ = value;
+            }
+            break;
+
+          case RAMLOG_BC_CHAR:
+            *cell++ = (uint64_t)(int64_t)va_arg(*ap, int);
+            break;
+
+          case RAMLOG_BC_POINTER:
+            *cell++ = (uint64_t)(uintptr_t)va_arg(*ap, FAR void *);
+            break;
+
+          case RAMLOG_BC_DOUBLE:
+            {
+              double value = va_arg(*ap, double);
+
+              memcpy(cell, &value, sizeof(value));
+              cell++;
+            }
+            break;
+
+          case RAMLOG_BC_STRING:
+            {
+              FAR const char *str = va_arg(*ap, FAR const char *);
+              size_t avail;
+              size_t sl;
+
+              if (str == NULL)
+                {
+                  str = "(null)";
+                }
+
+              sl = prec >= 0 ? strnlen(str, prec) : strlen(str);
+
+              /* One cell for the length, then the padded string bytes.
+               * Truncate the string if the record space is exhausted.
+               */
+
+              if (cell + 1 >= cend)
+                {
+                  return -EINVAL;
+                }
+
+              avail = (cend - (cell + 1)) * sizeof(uint64_t) - 1;
+              if (sl > avail)
+                {
+                  sl = avail;
+                }
+
+              *cell++ = sl;
+              memcpy(cell, str, sl);
+              ((FAR char *)cell)[sl] = '\0';
+              cell += RAMLOG_BREC_ALIGN(sl + 1) / sizeof(uint64_t);
+            }
+            break;
+        }
+
+      p = cv.bc_next;
+    }
+
+  return (FAR uint8_t *)cell - buf;
+}
+
+/****************************************************************************
+ * Name: ramlog_bheader
+ *
+ * Description:
+ *   Initialize the fixed fields of a binary record header.
+ *
+ ****************************************************************************/
+
+static void ramlog_bheader(FAR struct ramlog_brec_s *rec, int priority,
+                           FAR const IPTR char *fmt)
+{
+  rec->br_magic    = RAMLOG_BREC_MAGIC;
+  rec->br_priority = priority;
+  rec->br_fmt      = fmt;
+#ifdef CONFIG_SMP
+  rec->br_cpu      = this_cpu();
+#endif
+#ifdef CONFIG_SYSLOG_TIMESTAMP
+  rec->br_time.tv_sec  = 0;
+  rec->br_time.tv_nsec = 0;
+
+  if (OSINIT_HW_READY())
+    {
+#ifdef CONFIG_SYSLOG_TIMESTAMP_REALTIME
+      clock_gettime(CLOCK_REALTIME, &rec->br_time);
+#else
+      clock_gettime(CLOCK_MONOTONIC, &rec->br_time);
+#endif
+    }
+#endif
+}
+
+/****************************************************************************
+ * Name: ramlog_btext
+ *
+ * Description:
+ *   Wrap already-formatted text into one or more plain text records so
+ *   that the record framing of the binary RAM log stays intact.
+ *
+ ****************************************************************************/
+
+static ssize_t ramlog_btext(FAR struct ramlog_dev_s *priv,
+                            FAR const char *buffer, size_t len)
+{
+  uint64_t buf[RAMLOG_BREC_MAXLEN / sizeof(uint64_t)];
+  FAR struct ramlog_brec_s *rec = (FAR struct ramlog_brec_s *)buf;
+  FAR uint64_t *cell = (FAR uint64_t *)((FAR uint8_t *)buf +
+                                        RAMLOG_BREC_HDRLEN);
+  FAR char *text = (FAR char *)(cell + 1);
+  const size_t room = RAMLOG_BREC_MAXLEN - RAMLOG_BREC_HDRLEN -
+                      sizeof(uint64_t) - 1;
+  size_t nwritten = 0;
+
+  while (nwritten < len)
+    {
+      size_t chunk = MIN(len - nwritten, room);
+
+      ramlog_bheader(rec, LOG_INFO, NULL);
+      *cell = chunk;
+      memcpy(text, buffer + nwritten, chunk);
+      text[chunk] = '\0';
+      rec->br_len = RAMLOG_BREC_HDRLEN + sizeof(uint64_t) +
+                    RAMLOG_BREC_ALIGN(chunk + 1);
+      ramlog_addbuf(priv, (FAR const char *)buf, rec->br_len);
+      nwritten += chunk;
+    }
+
+  return len;
+}
+
+/****************************************************************************
+ * Name: ramlog_peekbuf
+ *
+ * Description:
+ *   Copy 'len' bytes beginning at ring position 'tail' out of the
+ *   circular buffer, handling wrap-around.
+ *
+ ****************************************************************************/
+
+static void ramlog_peekbuf(FAR struct ramlog_dev_s *priv, uint32_t tail,
+                           FAR void *dst, size_t len)
+{
+  FAR struct ramlog_header_s *header = priv->rl_header;
+  uint32_t pos = tail % priv->rl_bufsize;
+  uint32_t cnt = priv->rl_bufsize - pos;
+
+  if (len > cnt)
+    {
+      memcpy(dst, &header->rl_buffer[pos], cnt);
+      memcpy((FAR uint8_t *)dst + cnt, header->rl_buffer, len - cnt);
+    }
+  else
+    {
+      memcpy(dst, &header->rl_buffer[pos], len);
+    }
+}
+
+/****************************************************************************
+ * Name: ramlog_bformat
+ *
+ * Description:
+ *   Format one binary record into the caller provided buffer.  Returns
+ *   the number of characters written.  Output that does not fit is
+ *   silently truncated.
+ *
+ ****************************************************************************/
+
+static ssize_t ramlog_bformat(FAR struct ramlog_brec_s *rec, FAR char *out,
+                              size_t outlen)
+{
+  FAR const uint64_t *cell = (FAR const uint64_t *)
+                             ((FAR const uint8_t *)rec + RAMLOG_BREC_HDRLEN);
+  FAR const uint64_t *cend = (FAR const uint64_t *)
+                             ((FAR const uint8_t *)rec + rec->br_len);
+  FAR const char *p;
+  size_t off = 0;
+  int ret;
+
+  if (outlen < 2)
+    {
+      return 0;
+    }
+
+#ifdef CONFIG_SYSLOG_TIMESTAMP
+  ret = snprintf(out, outlen, "[%5jd.%06ld] ",
+                 (uintmax_t)rec->br_time.tv_sec,
+                 rec->br_time.tv_nsec / NSEC_PER_USEC);
+  off = MIN((size_t)ret, outlen - 1);
+#endif
+
+#ifdef CONFIG_SMP
+  ret = snprintf(out + off, outlen - off, "[CPU%d] ", rec->br_cpu);
+  off += MIN((size_t)ret, outlen - off - 1);
+#endif
+
+  if (rec->br_fmt == NULL)
+    {
+      /* Plain text record:  One length cell followed by the text */
+
+      size_t tl;
+
+      if (cell >= cend)
+        {
+          return off;
+        }
+
+      tl = (size_t)*cell++;
+      tl = MIN(tl, (size_t)((cend - cell) * sizeof(uint64_t)));
+      tl = MIN(tl, outlen - off);
+      memcpy(out + off, cell, tl);
+      return off + tl;
+    }
+
+  p = rec->br_fmt;
+  while (*p != '\0' && off < outlen - 1)
+    {
+      struct ramlog_bconv_s cv;
+      FAR const char *start;
+      char frag[40];
+      size_t fl;
+      size_t rem;
+      int starv[2];
+      int ns = 0;
+
+      if (*p != '%')
+        {
+          out[off++] = *p++;
+          continue;
+        }
+
+      if (p[1] == '%')
+        {
+          out[off++] = '%';
+          p += 2;
+          continue;
+        }
+
+      start = p;
+      if (ramlog_bparse(p + 1, &cv) < 0)
+        {
+          /* Cannot happen for records built by ramlog_bcapture */
+
+          out[off++] = *p++;
+          continue;
+        }
+
+      if (cv.bc_wstar)
+        {
+          if (cell >= cend)
+            {
+              break;
+            }
+
+          starv[ns++] = (int)(int64_t)*cell++;
+        }
+
+      if (cv.bc_pstar)
+        {
+          if (cell >= cend)
+            {
+              break;
+            }
+
+          starv[ns++] = (int)(int64_t)*cell++;
+        }
+
+      /* Rebuild the conversion with a length modifier that matches the
+       * type we pass to snprintf below.
+       */
+
+      fl = cv.bc_modstart - start;
+      if (fl + 4 > sizeof(frag) || cell >= cend)
+        {
+          break;
+        }
+
+      memcpy(frag, start, fl);
+      rem = outlen - off;
+
+      switch (cv.bc_class)
+        {
+          case RAMLOG_BC_SIGNED:
+          case RAMLOG_BC_UNSIGNED:
+            {
+              long long value = (long long)*cell++;
+
+              frag[fl++] = 'l';
+              frag[fl++] = 'l';
+              frag[fl++] = cv.bc_conv;
+              frag[fl]   = '\0';
+              ret = ns == 2 ?
+                    snprintf(out + off, rem, frag, starv[0], starv[1],
+                             value) :
+                    ns == 1 ?
+                    snprintf(out + off, rem, frag, starv[0], value) :
+                    snprintf(out + off, rem, frag, value);
+            }
+            break;
+
+          case RAMLOG_BC_CHAR:
+            {
+              int value = (int)(int64_t)*cell++;
+
+              frag[fl++] = 'c';
+              frag[fl]   = '\0';
+              ret = ns == 2 ?
+                    snprintf(out + off, rem, frag, starv[0], starv[1],
+                             value) :
+                    ns == 1 ?
+                    snprintf(out + off, rem, frag, starv[0], value) :
+                    snprintf(out + off, rem, frag, value);
+            }
+            break;
+
+          case RAMLOG_BC_POINTER:
+            {
+              FAR void *value = (FAR void *)(uintptr_t)*cell++;
+
+              frag[fl++] = 'p';
+              frag[fl]   = '\0';
+              ret = ns == 2 ?
+                    snprintf(out + off, rem, frag, starv[0], starv[1],
+                             value) :
+                    ns == 1 ?
+                    snprintf(out + off, rem, frag, starv[0], value) :
+                    snprintf(out + off, rem, frag, value);
+            }
+            break;
+
+          case RAMLOG_BC_DOUBLE:
+            {
+              double value;
+
+              memcpy(&value, cell, sizeof(value));
+              cell++;
+              frag[fl++] = cv.bc_conv;
+              frag[fl]   = '\0';
+              ret = ns == 2 ?
+                    snprintf(out + off, rem, frag, starv[0], starv[1],
+                             value) :
+                    ns == 1 ?
+                    snprintf(out + off, rem, frag, starv[0], value) :
+                    snprintf(out + off, rem, frag, value);
+            }
+            break;
+
+          case RAMLOG_BC_STRING:
+          default:
+            {
+              FAR const char *value;
+              size_t sl = (size_t)*cell++;
+
+              if (cell + RAMLOG_BREC_ALIGN(sl + 1) / sizeof(uint64_t) >
+                  cend)
+                {
+                  ret = 0;
+                  break;
+                }
+
+              value = (FAR const char *)cell;
+              cell += RAMLOG_BREC_ALIGN(sl + 1) / sizeof(uint64_t);
+              frag[fl++] = 's';
+              frag[fl]   = '\0';
+              ret = ns == 2 ?
+                    snprintf(out + off, rem, frag, starv[0], starv[1],
+                             value) :
+                    ns == 1 ?
+                    snprintf(out + off, rem, frag, starv[0], value) :
+                    snprintf(out + off, rem, frag, value);
+            }
+            break;
+        }
+
+      if (ret < 0)
+        {
+          ret = 0;
+        }
+
+      off += MIN((size_t)ret, rem - 1);
+      p = cv.bc_next;
+    }
+
+  /* Terminate the message with a newline like the text syslog path */
+
+  if (off == 0 || out[off - 1] != '\n')
+    {
+      if (off >= outlen)
+        {
+          off = outlen - 1;
+        }
+
+      out[off++] = '\n';
+    }
+
+  return off;
+}
+
+/****************************************************************************
+ * Name: ramlog_bread
+ *
+ * Description:
+ *   Read one binary record from the RAM log and return it formatted.
+ *   Each call returns at most one complete log message.
+ *
+ ****************************************************************************/
+
+static ssize_t ramlog_bread(FAR struct file *filep, FAR char *buffer,
+                            size_t len)
+{
+  FAR struct inode *inode = filep->f_inode;
+  FAR struct ramlog_dev_s *priv = inode->i_private;
+  FAR struct ramlog_header_s *header = priv->rl_header;
+  FAR struct ramlog_user_s *upriv = filep->f_priv;
+  uint64_t recbuf[RAMLOG_BREC_MAXLEN / sizeof(uint64_t)];
+  FAR struct ramlog_brec_s *rec = (FAR struct ramlog_brec_s *)recbuf;
+  bool got = false;
+  irqstate_t flags;
+
+  /* This function may NOT be called from an interrupt handler */
+
+  DEBUGASSERT(!up_interrupt_context());
+
+  /* Get exclusive access to the rl_tail index */
+
+  flags = enter_critical_section();
+
+  while (!got)
+    {
+      /* Determine whether the read pointer was overwritten */
+
+      if (header->rl_head - upriv->rl_tail > priv->rl_bufsize)
+        {
+          upriv->rl_tail = header->rl_head - priv->rl_bufsize;
+        }
+
+      /* Hunt for the next complete record.  After an overrun the tail
+       * may point into the middle of a record; skip forward until a
+       * plausible record header is found.
+       */
+
+      while (header->rl_head - upriv->rl_tail >=
+             sizeof(struct ramlog_brec_s))
+        {
+          ramlog_peekbuf(priv, upriv->rl_tail, rec,
+                         sizeof(struct ramlog_brec_s));
+          if (rec->br_magic == RAMLOG_BREC_MAGIC &&
+              rec->br_len >= RAMLOG_BREC_HDRLEN &&
+              rec->br_len <= RAMLOG_BREC_MAXLEN &&
+              (rec->br_len & 7) == 0 &&
+              header->rl_head - upriv->rl_tail >= rec->br_len)
+            {
+              ramlog_peekbuf(priv, upriv->rl_tail, rec, rec->br_len);
+              upriv->rl_tail += rec->br_len;
+              got = true;
+              break;
+            }
+
+          upriv->rl_tail++;
+        }
+
+      if (!got)
+        {
+          /* The circular buffer contains no complete record. */
+
+#ifdef CONFIG_RAMLOG_NONBLOCKING
+          /* Return zero (meaning the end-of-file) */
+
+          leave_critical_section(flags);
+          return 0;
+#else
+          int ret;
+
+          /* If the driver was opened with O_NONBLOCK option, then don't
+           * wait.
+           */
+
+          if (filep->f_oflags & O_NONBLOCK)
+            {
+              leave_critical_section(flags);
+              return -EAGAIN;
+            }
+
+          ret = nxsem_wait(&upriv->rl_waitsem);
+          if (ret < 0)
+            {
+              leave_critical_section(flags);
+              return ret;
+            }
+#endif /* CONFIG_RAMLOG_NONBLOCKING */
+        }
+    }
+
+  leave_critical_section(flags);
+
+  /* Format the record outside of the critical section */
+
+  return ramlog_bformat(rec, buffer, len);
+}
+#endif /* CONFIG_RAMLOG_BINARY */
+
 /****************************************************************************
  * Name: ramlog_read
  ****************************************************************************/
@@ -402,6 +1278,15 @@ static ssize_t ramlog_file_read(FAR struct file *filep, FAR char *buffer,
   uint32_t tail;
   uint32_t pos;
 
+#ifdef CONFIG_RAMLOG_BINARY
+  /* The system log device holds binary records, not text */
+
+  if (priv == &g_sysdev)
+    {
+      return ramlog_bread(filep, buffer, len);
+    }
+#endif
+
   /* If the circular buffer is empty, then wait for something to be written
    * to it.  This function may NOT be called from an interrupt handler.
    */
@@ -523,6 +1408,15 @@ static ssize_t ramlog_file_write(FAR struct file *filep,
   FAR struct inode *inode = filep->f_inode;
   FAR struct ramlog_dev_s *priv = inode->i_private;
 
+#ifdef CONFIG_RAMLOG_BINARY
+  /* Already-formatted text must be framed as records on the system log */
+
+  if (priv == &g_sysdev)
+    {
+      return ramlog_btext(priv, buffer, len);
+    }
+#endif
+
   return ramlog_addbuf(priv, buffer, len);
 }
 
@@ -755,7 +1649,11 @@ int ramlog_putc(FAR syslog_channel_t *channel, int ch)
 
   /* Add the character to the RAMLOG */
 
+#ifdef CONFIG_RAMLOG_BINARY
+  ramlog_btext(&g_sysdev, &cch, 1);
+#else
   ramlog_addbuf(&g_sysdev, &cch, 1);
+#endif
 
   /* Return the character added on success */
 
@@ -765,8 +1663,74 @@ int ramlog_putc(FAR syslog_channel_t *channel, int ch)
 ssize_t ramlog_write(FAR syslog_channel_t *channel,
                      FAR const char *buffer, size_t buflen)
 {
+#ifdef CONFIG_RAMLOG_BINARY
+  return ramlog_btext(&g_sysdev, buffer, buflen);
+#else
   return ramlog_addbuf(&g_sysdev, buffer, buflen);
+#endif
+}
+
+/****************************************************************************
+ * Name: ramlog_bprintf
+ *
+ * Description:
+ *   Capture one log message into the RAM log as a binary record:  The
+ *   format string pointer and the raw arguments are stored and the
+ *   vsprintf work is deferred until a reader fetches the record.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_RAMLOG_BINARY
+ssize_t ramlog_bprintf(int priority, FAR const IPTR char *fmt,
+                       FAR va_list *ap)
+{
+  uint64_t buf[RAMLOG_BREC_MAXLEN / sizeof(uint64_t)];
+  FAR struct ramlog_brec_s *rec = (FAR struct ramlog_brec_s *)buf;
+  va_list copy;
+  ssize_t len;
+
+  ramlog_bheader(rec, priority, fmt);
+
+  va_copy(copy, *ap);
+  len = ramlog_bcapture((FAR uint8_t *)buf, fmt, &copy);
+  va_end(copy);
+
+  if (len < 0)
+    {
+      /* The format uses a conversion that the capture format does not
+       * support (or the arguments overflow the record):  Fall back to
+       * formatting immediately into a plain text record.
+       */
+
+      FAR uint64_t *cell = (FAR uint64_t *)((FAR uint8_t *)buf +
+                                            RAMLOG_BREC_HDRLEN);
+      FAR char *text = (FAR char *)(cell + 1);
+      const size_t room = RAMLOG_BREC_MAXLEN - RAMLOG_BREC_HDRLEN -
+                          sizeof(uint64_t);
+      int ret;
+
+      ret = vsnprintf(text, room, fmt, *ap);
+      if (ret < 0)
+        {
+          return ret;
+        }
+
+      if ((size_t)ret >= room)
+        {
+          ret = room - 1;
+        }
+
+      rec->br_fmt = NULL;
+      *cell = ret;
+      len = RAMLOG_BREC_HDRLEN + sizeof(uint64_t) +
+            RAMLOG_BREC_ALIGN(ret + 1);
+    }
+
+  rec->br_len = len;
+  ramlog_addbuf(&g_sysdev, (FAR const char *)buf, len);
+  return len;
 }
 #endif
+#endif
 
 #endif /* CONFIG_RAMLOG */
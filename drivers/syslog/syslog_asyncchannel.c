@@ -0,0 +1,356 @@
+/****************************************************************************
+ * drivers/syslog/syslog_asyncchannel.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#include <nuttx/circbuf.h>
+#include <nuttx/kmalloc.h>
+#include <nuttx/spinlock.h>
+#include <nuttx/syslog/syslog.h>
+#include <nuttx/wqueue.h>
+
+#include "syslog.h"
+
+#ifdef CONFIG_SYSLOG_ASYNC
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* This structure describes the asynchronous channel wrapper.  SYSLOG
+ * output is staged into the circular buffer and drained to the wrapped
+ * channel from the low-priority work queue.
+ */
+
+struct syslog_async_channel_s
+{
+  syslog_channel_t channel;       /* Base channel, must be first */
+  FAR syslog_channel_t *backend;  /* The wrapped (real) channel */
+  struct circbuf_s circ;          /* Staging ring for pending output */
+  spinlock_t splock;              /* Protects the staging ring */
+  struct work_s work;             /* Supports the deferred draining */
+  size_t dropped;                 /* Bytes dropped on ring overflow */
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+static int     syslog_async_putc(FAR syslog_channel_t *channel, int ch);
+static int     syslog_async_force(FAR syslog_channel_t *channel, int ch);
+static int     syslog_async_flush(FAR syslog_channel_t *channel);
+static ssize_t syslog_async_write(FAR syslog_channel_t *channel,
+                                  FAR const char *buffer, size_t buflen);
+static void    syslog_async_close(FAR syslog_channel_t *channel);
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const struct syslog_channel_ops_s g_syslog_async_ops =
+{
+  syslog_async_putc,
+  syslog_async_force,
+  syslog_async_flush,
+  syslog_async_write,
+  syslog_async_write,
+  syslog_async_close
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: syslog_async_backend_write
+ *
+ * Description:
+ *   Write a block of data to the wrapped channel, using the multi-byte
+ *   write method when the channel provides one.
+ *
+ ****************************************************************************/
+
+static void syslog_async_backend_write(
+                               FAR struct syslog_async_channel_s *chan,
+                               FAR const char *buffer, size_t buflen)
+{
+  FAR syslog_channel_t *backend = chan->backend;
+  size_t i;
+
+  if (backend->sc_ops->sc_write != NULL)
+    {
+      backend->sc_ops->sc_write(backend, buffer, buflen);
+    }
+  else
+    {
+      for (i = 0; i < buflen; i++)
+        {
+          backend->sc_ops->sc_putc(backend, buffer[i]);
+        }
+    }
+}
+
+/****************************************************************************
+ * Name: syslog_async_work
+ *
+ * Description:
+ *   Drain the staging ring to the wrapped channel.  Runs on the low
+ *   priority work queue so that the caller of syslog() never waits on
+ *   the speed of the sink.
+ *
+ ****************************************************************************/
+
+static void syslog_async_work(FAR void *arg)
+{
+  FAR struct syslog_async_channel_s *chan = arg;
+  char tmp[64];
+  irqstate_t flags;
+  size_t dropped = 0;
+  ssize_t n;
+
+  for (; ; )
+    {
+      flags = spin_lock_irqsave(&chan->splock);
+      n = circbuf_read(&chan->circ, tmp, sizeof(tmp));
+      if (n <= 0)
+        {
+          dropped = chan->dropped;
+          chan->dropped = 0;
+          spin_unlock_irqrestore(&chan->splock, flags);
+          break;
+        }
+
+      spin_unlock_irqrestore(&chan->splock, flags);
+      syslog_async_backend_write(chan, tmp, n);
+    }
+
+  /* If the ring overflowed while we were behind, leave a trace of how
+   * much output was lost.
+   */
+
+  if (dropped > 0)
+    {
+      int len = snprintf(tmp, sizeof(tmp),
+                         "[syslog] dropped %zu bytes\n", dropped);
+      syslog_async_backend_write(chan, tmp, len);
+    }
+}
+
+/****************************************************************************
+ * Name: syslog_async_stage
+ *
+ * Description:
+ *   Copy output into the staging ring and schedule the drain work.  May
+ *   be called from any context, including interrupt handlers.  Output
+ *   that does not fit in the ring is dropped and counted.
+ *
+ ****************************************************************************/
+
+static ssize_t syslog_async_stage(FAR struct syslog_async_channel_s *chan,
+                                  FAR const char *buffer, size_t buflen)
+{
+  irqstate_t flags;
+  ssize_t ret;
+
+  flags = spin_lock_irqsave(&chan->splock);
+  ret = circbuf_write(&chan->circ, buffer, buflen);
+  if (ret < 0)
+    {
+      ret = 0;
+    }
+
+  if ((size_t)ret < buflen)
+    {
+      chan->dropped += buflen - ret;
+    }
+
+  spin_unlock_irqrestore(&chan->splock, flags);
+
+  if (work_available(&chan->work))
+    {
+      work_queue(LPWORK, &chan->work, syslog_async_work, chan, 0);
+    }
+
+  return buflen;
+}
+
+/****************************************************************************
+ * Name: syslog_async_putc/syslog_async_force
+ ****************************************************************************/
+
+static int syslog_async_putc(FAR syslog_channel_t *channel, int ch)
+{
+  FAR struct syslog_async_channel_s *chan = (FAR void *)channel;
+  char c = ch;
+
+  syslog_async_stage(chan, &c, 1);
+  return ch;
+}
+
+static int syslog_async_force(FAR syslog_channel_t *channel, int ch)
+{
+  /* The staging ring is protected by a spinlock and the work queue may
+   * be scheduled from interrupt handlers, so the normal path is safe
+   * here as well.
+   */
+
+  return syslog_async_putc(channel, ch);
+}
+
+/****************************************************************************
+ * Name: syslog_async_write
+ ****************************************************************************/
+
+static ssize_t syslog_async_write(FAR syslog_channel_t *channel,
+                                  FAR const char *buffer, size_t buflen)
+{
+  FAR struct syslog_async_channel_s *chan = (FAR void *)channel;
+
+  return syslog_async_stage(chan, buffer, buflen);
+}
+
+/****************************************************************************
+ * Name: syslog_async_flush
+ *
+ * Description:
+ *   Drain any pending output synchronously.  This is called on crash or
+ *   assertion, so the wrapped channel's force methods are used; the work
+ *   queue may never run again.
+ *
+ ****************************************************************************/
+
+static int syslog_async_flush(FAR syslog_channel_t *channel)
+{
+  FAR struct syslog_async_channel_s *chan = (FAR void *)channel;
+  FAR syslog_channel_t *backend = chan->backend;
+  char tmp[64];
+  irqstate_t flags;
+  ssize_t n;
+  ssize_t i;
+
+  for (; ; )
+    {
+      flags = spin_lock_irqsave(&chan->splock);
+      n = circbuf_read(&chan->circ, tmp, sizeof(tmp));
+      spin_unlock_irqrestore(&chan->splock, flags);
+      if (n <= 0)
+        {
+          break;
+        }
+
+      if (backend->sc_ops->sc_write_force != NULL)
+        {
+          backend->sc_ops->sc_write_force(backend, tmp, n);
+        }
+      else if (backend->sc_ops->sc_force != NULL)
+        {
+          for (i = 0; i < n; i++)
+            {
+              backend->sc_ops->sc_force(backend, tmp[i]);
+            }
+        }
+      else
+        {
+          syslog_async_backend_write(chan, tmp, n);
+        }
+    }
+
+  if (backend->sc_ops->sc_flush != NULL)
+    {
+      return backend->sc_ops->sc_flush(backend);
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: syslog_async_close
+ ****************************************************************************/
+
+static void syslog_async_close(FAR syslog_channel_t *channel)
+{
+  FAR struct syslog_async_channel_s *chan = (FAR void *)channel;
+
+  work_cancel_sync(LPWORK, &chan->work);
+  syslog_async_flush(channel);
+
+  if (chan->backend->sc_ops->sc_close != NULL)
+    {
+      chan->backend->sc_ops->sc_close(chan->backend);
+    }
+
+  circbuf_uninit(&chan->circ);
+  kmm_free(chan);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: syslog_async_channel
+ *
+ * Description:
+ *   Wrap a SYSLOG channel so that all output is staged into an in-memory
+ *   ring buffer and drained to the wrapped channel from the low-priority
+ *   work queue.  syslog() callers then only pay for a memcpy into the
+ *   ring, never for the speed of the sink.  Output is dropped (and the
+ *   loss is reported on the channel) when the ring overflows.
+ *
+ * Input Parameters:
+ *   channel - The channel that performs the actual output
+ *
+ * Returned Value:
+ *   A pointer to the new SYSLOG channel; NULL is returned on any failure
+ *   (in which case the wrapped channel is left untouched).
+ *
+ ****************************************************************************/
+
+FAR syslog_channel_t *syslog_async_channel(FAR syslog_channel_t *channel)
+{
+  FAR struct syslog_async_channel_s *chan;
+
+  chan = kmm_zalloc(sizeof(struct syslog_async_channel_s));
+  if (chan == NULL)
+    {
+      return NULL;
+    }
+
+  if (circbuf_init(&chan->circ, NULL, CONFIG_SYSLOG_ASYNC_BUFSIZE) < 0)
+    {
+      kmm_free(chan);
+      return NULL;
+    }
+
+  chan->channel.sc_ops = &g_syslog_async_ops;
+  chan->backend = channel;
+  spin_lock_init(&chan->splock);
+
+  return &chan->channel;
+}
+
+#endif /* CONFIG_SYSLOG_ASYNC */
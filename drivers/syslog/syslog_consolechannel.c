@@ -75,6 +75,9 @@
 FAR syslog_channel_t *syslog_console_channel(void)
 {
   FAR syslog_channel_t *console_channel;
+#ifdef CONFIG_SYSLOG_ASYNC
+  FAR syslog_channel_t *async_channel;
+#endif
 
   /* Initialize the character driver interface */
 
@@ -85,11 +88,30 @@ FAR syslog_channel_t *syslog_console_channel(void)
       return NULL;
     }
 
+#ifdef CONFIG_SYSLOG_ASYNC
+  /* Stage the output through the asynchronous channel wrapper */
+
+  async_channel = syslog_async_channel(console_channel);
+  if (async_channel == NULL)
+    {
+      syslog_dev_uninitialize(console_channel);
+      return NULL;
+    }
+
+  console_channel = async_channel;
+#endif
+
   /* Use the character driver as the SYSLOG channel */
 
   if (syslog_channel_register(console_channel) != OK)
     {
+#ifdef CONFIG_SYSLOG_ASYNC
+      /* Closing the wrapper also closes the wrapped channel */
+
+      console_channel->sc_ops->sc_close(console_channel);
+#else
       syslog_dev_uninitialize(console_channel);
+#endif
       console_channel = NULL;
     }
 
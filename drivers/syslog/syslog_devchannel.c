@@ -72,6 +72,9 @@
 FAR syslog_channel_t *syslog_dev_channel(void)
 {
   FAR syslog_channel_t *dev_channel;
+#ifdef CONFIG_SYSLOG_ASYNC
+  FAR syslog_channel_t *async_channel;
+#endif
 
   /* Initialize the character driver interface */
 
@@ -82,11 +85,30 @@ FAR syslog_channel_t *syslog_dev_channel(void)
       return NULL;
     }
 
+#ifdef CONFIG_SYSLOG_ASYNC
+  /* Stage the output through the asynchronous channel wrapper */
+
+  async_channel = syslog_async_channel(dev_channel);
+  if (async_channel == NULL)
+    {
+      syslog_dev_uninitialize(dev_channel);
+      return NULL;
+    }
+
+  dev_channel = async_channel;
+#endif
+
   /* Use the character driver as the SYSLOG channel */
 
   if (syslog_channel_register(dev_channel) != OK)
     {
+#ifdef CONFIG_SYSLOG_ASYNC
+      /* Closing the wrapper also closes the wrapped channel */
+
+      dev_channel->sc_ops->sc_close(dev_channel);
+#else
       syslog_dev_uninitialize(dev_channel);
+#endif
       dev_channel = NULL;
     }
 
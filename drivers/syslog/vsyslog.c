@@ -33,6 +33,7 @@
 #include <nuttx/clock.h>
 #include <nuttx/streams.h>
 #include <nuttx/syslog/syslog.h>
+#include <nuttx/syslog/ramlog.h>
 
 #include "syslog.h"
 
@@ -81,6 +82,13 @@ static FAR const char * const g_priority_str[] =
 
 int nx_vsyslog(int priority, FAR const IPTR char *fmt, FAR va_list *ap)
 {
+#ifdef CONFIG_RAMLOG_BINARY
+  /* Defer all formatting:  Store the format string pointer and the raw
+   * arguments in the RAM log and let the reader do the vsprintf work.
+   */
+
+  return ramlog_bprintf(priority, fmt, ap);
+#else
   struct lib_syslograwstream_s stream;
   int ret = 0;
 #ifdef CONFIG_SYSLOG_PROCESS_NAME
@@ -271,4 +279,5 @@ int nx_vsyslog(int priority, FAR const IPTR char *fmt, FAR va_list *ap)
 
   lib_syslograwstream_close(&stream);
   return ret;
+#endif /* CONFIG_RAMLOG_BINARY */
 }
@@ -492,6 +492,91 @@ static int pwm_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
         }
         break;
 
+      /* PWMIOC_SETDUTYCYCLES - Update only the duty cycles of the pulsed
+       *   output, committing all channels to the hardware at once.
+       *
+       *   ioctl argument:  A read-only reference to struct pwm_info_s;
+       *   only the duty (and channel) fields are used.
+       */
+
+      case PWMIOC_SETDUTYCYCLES:
+        {
+          FAR const struct pwm_info_s *info =
+            (FAR const struct pwm_info_s *)((uintptr_t)arg);
+#ifdef CONFIG_PWM_MULTICHAN
+          int i;
+          int j;
+#endif
+          DEBUGASSERT(info != NULL && lower->ops->start != NULL);
+
+          pwm_dump("PWMIOC_SETDUTYCYCLES", info, upper->started);
+
+          /* Merge the new duty cycles into the saved characteristics */
+
+#ifdef CONFIG_PWM_MULTICHAN
+          for (i = 0; i < CONFIG_PWM_NCHANNELS; i++)
+            {
+              if (info->channels[i].channel < 0)
+                {
+                  break;
+                }
+              else if (info->channels[i].channel == 0)
+                {
+                  continue;
+                }
+
+              for (j = 0; j < CONFIG_PWM_NCHANNELS; j++)
+                {
+                  if (upper->info.channels[j].channel ==
+                      info->channels[i].channel)
+                    {
+                      upper->info.channels[j].duty =
+                        info->channels[i].duty;
+                      break;
+                    }
+                }
+
+              if (j == CONFIG_PWM_NCHANNELS)
+                {
+                  /* The channel was not previously configured */
+
+                  ret = -EINVAL;
+                  break;
+                }
+            }
+
+          if (ret < 0)
+            {
+              break;
+            }
+#else
+          upper->info.duty = info->duty;
+#endif
+
+          /* If the pulsed output is running, apply the new duty cycles
+           * through the atomic update method when the lower half has one;
+           * re-start with the merged characteristics otherwise.  When the
+           * output is stopped the duty cycles take effect on start.
+           */
+
+          if (upper->started)
+            {
+              if (lower->ops->update != NULL)
+                {
+                  ret = lower->ops->update(lower, &upper->info);
+                }
+              else
+                {
+#ifdef CONFIG_PWM_PULSECOUNT
+                  ret = lower->ops->start(lower, &upper->info, upper);
+#else
+                  ret = lower->ops->start(lower, &upper->info);
+#endif
+                }
+            }
+        }
+        break;
+
       /* PWMIOC_START - Start the pulsed output.  The
        *   PWMIOC_SETCHARACTERISTICS  command must have previously been sent.
        *
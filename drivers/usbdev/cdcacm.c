@@ -331,9 +331,14 @@ static ssize_t cdcuart_sendbuf(FAR struct uart_dev_s *dev,
   size_t nbytes;
   int ret;
 
-  /* Get the maximum number of bytes that will fit into one bulk IN request */
+  /* Get the maximum number of bytes that will fit into one bulk IN
+   * request.  The request buffers were allocated with at least this size
+   * (see cdcacm_bind()); a request may span several USB packets and the
+   * controller will split it, so there is no reason to limit the fill to
+   * a single maxpacket.
+   */
 
-  reqlen = MIN(CONFIG_CDCACM_BULKIN_REQLEN, ep->maxpacket);
+  reqlen = MAX(CONFIG_CDCACM_BULKIN_REQLEN, ep->maxpacket);
 
   /* Peek at the request in the container at the head of the list */
 
@@ -2671,9 +2676,12 @@ static void cdcuart_dmasend(FAR struct uart_dev_s *dev)
   size_t reqlen;
   int ret;
 
-  /* Get the maximum number of bytes that will fit into one bulk IN request */
+  /* Get the maximum number of bytes that will fit into one bulk IN
+   * request.  As in cdcuart_sendbuf(), the request buffers hold at least
+   * this much and multi-packet requests are split by the controller.
+   */
 
-  reqlen = MIN(CONFIG_CDCACM_BULKIN_REQLEN, ep->maxpacket);
+  reqlen = MAX(CONFIG_CDCACM_BULKIN_REQLEN, ep->maxpacket);
 
   /* Peek at the request in the container at the head of the list */
 
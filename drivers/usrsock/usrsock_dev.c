@@ -137,6 +137,9 @@ static ssize_t usrsockdev_read(FAR struct file *filep, FAR char *buffer,
 {
   FAR struct inode *inode = filep->f_inode;
   FAR struct usrsockdev_s *dev;
+#ifdef CONFIG_NET_USRSOCK_PIPELINE
+  bool consumed = false;
+#endif
   int ret;
 
   if (len == 0)
@@ -164,11 +167,20 @@ static ssize_t usrsockdev_read(FAR struct file *filep, FAR char *buffer,
   if (dev->req.iov)
     {
       ssize_t rlen;
+#ifdef CONFIG_NET_USRSOCK_PIPELINE
+      bool done = false;
+#endif
 
       /* Copy request to user-space. */
 
       rlen = usrsock_iovec_get(buffer, len, dev->req.iov, dev->req.iovcnt,
-                               dev->req.pos, NULL);
+                               dev->req.pos,
+#ifdef CONFIG_NET_USRSOCK_PIPELINE
+                               &done
+#else
+                               NULL
+#endif
+                               );
       if (rlen < 0)
         {
           /* Tried reading beyond buffer. */
@@ -179,6 +191,21 @@ static ssize_t usrsockdev_read(FAR struct file *filep, FAR char *buffer,
         {
           dev->req.pos += rlen;
           len = rlen;
+
+#ifdef CONFIG_NET_USRSOCK_PIPELINE
+          if (done)
+            {
+              /* The daemon has read the whole request.  Release the
+               * request buffers now; the response is matched to the
+               * requester by exchange id when it arrives.
+               */
+
+              dev->req.iov = NULL;
+              dev->req.iovcnt = 0;
+              dev->req.pos = 0;
+              consumed = true;
+            }
+#endif
         }
     }
   else
@@ -187,6 +214,14 @@ static ssize_t usrsockdev_read(FAR struct file *filep, FAR char *buffer,
     }
 
   nxmutex_unlock(&dev->devlock);
+
+#ifdef CONFIG_NET_USRSOCK_PIPELINE
+  if (consumed)
+    {
+      usrsock_request_consumed();
+    }
+#endif
+
   return len;
 }
 
@@ -235,6 +235,13 @@ int usrsock_request(FAR struct iovec *iov, unsigned int iovcnt)
 
       if (done)
         {
+#ifdef CONFIG_NET_USRSOCK_PIPELINE
+          /* The whole request has been copied to rpmsg buffers; the
+           * caller's buffers may be reused for the next request.
+           */
+
+          usrsock_request_consumed();
+#endif
           ret = OK;
           break;
         }
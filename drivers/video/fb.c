@@ -33,6 +33,7 @@
 #include <assert.h>
 #include <debug.h>
 #include <errno.h>
+#include <fcntl.h>
 #include <poll.h>
 
 #include <nuttx/kmalloc.h>
@@ -977,11 +978,47 @@ static int fb_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
           FAR struct fb_planeinfo_s *pinfo =
             (FAR struct fb_planeinfo_s *)((uintptr_t)arg);
           union fb_paninfo_u paninfo;
+#ifdef CONFIG_VIDEO_FB_FLIPQUEUE
+          FAR struct circbuf_s *panbuf;
+#endif
 
           DEBUGASSERT(pinfo != NULL && fb->vtable != NULL);
 
           memcpy(&paninfo, pinfo, sizeof(*pinfo));
 
+#ifdef CONFIG_VIDEO_FB_FLIPQUEUE
+          /* Flip-queue semantics:  Accept the new frame only if there is
+           * room for it in the pan queue.  A queue slot frees when the
+           * display retires a frame at vsync, at which point POLLOUT is
+           * reported to any poll waiter.
+           */
+
+          panbuf = fb_get_panbuf(fb, FB_NO_OVERLAY);
+
+#ifdef CONFIG_FB_SYNC
+          while (circbuf_is_full(panbuf) &&
+                 (filep->f_oflags & O_NONBLOCK) == 0)
+            {
+              ret = fb_sem_wait(fb, filep->f_priv, FB_NO_OVERLAY);
+              if (ret < 0)
+                {
+                  break;
+                }
+            }
+
+          if (ret < 0)
+            {
+              break;
+            }
+#endif
+
+          if (circbuf_is_full(panbuf))
+            {
+              ret = -EAGAIN;
+              break;
+            }
+#endif /* CONFIG_VIDEO_FB_FLIPQUEUE */
+
           if (fb->vtable->pandisplay != NULL)
             {
               fb->vtable->pandisplay(fb->vtable, pinfo);
@@ -34,6 +34,7 @@
 #include <nuttx/video/video.h>
 
 #include "video_framebuff.h"
+#include "v4l2_expbuf.h"
 
 /****************************************************************************
  * Pre-processor Definitions
@@ -107,6 +108,7 @@ struct capture_type_inf_s
   struct v4l2_fract      frame_interval;
   video_framebuff_t      bufinf;
   FAR uint8_t            *bufheap;   /* for V4L2_MEMORY_MMAP buffers */
+  FAR struct v4l2_bufheap_s *bufref; /* Lifetime of bufheap for EXPBUF */
   FAR struct pollfd      *fds;
   uint32_t               seqnum;
 };
@@ -227,6 +229,8 @@ static int capture_reqbufs(FAR struct file *filep,
                            FAR struct v4l2_requestbuffers *reqbufs);
 static int capture_querybuf(FAR struct file *filep,
                             FAR struct v4l2_buffer *buf);
+static int capture_expbuf(FAR struct file *filep,
+                          FAR struct v4l2_exportbuffer *expbuf);
 static int capture_qbuf(FAR struct file *filep,
                         FAR struct v4l2_buffer *buf);
 static int capture_dqbuf(FAR struct file *filep,
@@ -309,6 +313,7 @@ static const struct v4l2_ops_s g_capture_vops =
   capture_enum_input,                 /* enum_input */
   capture_reqbufs,                    /* reqbufs */
   capture_querybuf,                   /* querybuf */
+  capture_expbuf,                     /* expbuf */
   capture_qbuf,                       /* qbuf */
   capture_dqbuf,                      /* dqbuf */
   capture_cancel_dqbuf,               /* cancel_dqbuf */
@@ -1175,27 +1180,42 @@ static void initialize_resources(FAR capture_mng_t *cmng)
   initialize_scenes_parameter(cmng);
 }
 
-static void cleanup_streamresources(FAR capture_type_inf_t *type_inf,
-                                    FAR capture_mng_t *cmng)
+static void capture_bufheap_free(FAR struct v4l2_bufheap_s *heap)
 {
-  video_framebuff_uninit(&type_inf->bufinf);
-  nxsem_destroy(&type_inf->wait_capture.dqbuf_wait_flg);
-  nxmutex_destroy(&type_inf->lock_state);
-  if (type_inf->bufheap != NULL)
+  FAR struct imgdata_s *imgdata = heap->priv;
+
+  if (imgdata->ops->free)
     {
-      if (cmng->imgdata->ops->free)
-        {
-          cmng->imgdata->ops->free(cmng->imgdata, type_inf->bufheap);
-        }
-      else
-        {
-          kumm_free(type_inf->bufheap);
-        }
+      imgdata->ops->free(imgdata, heap->mem);
+    }
+  else
+    {
+      kumm_free(heap->mem);
+    }
+}
 
+static void capture_bufheap_release(FAR capture_type_inf_t *type_inf)
+{
+  /* Drop the device's reference.  The memory itself stays alive until
+   * all descriptors exported with VIDIOC_EXPBUF are closed as well.
+   */
+
+  if (type_inf->bufheap != NULL)
+    {
+      v4l2_bufheap_unref(type_inf->bufref);
       type_inf->bufheap = NULL;
+      type_inf->bufref  = NULL;
     }
 }
 
+static void cleanup_streamresources(FAR capture_type_inf_t *type_inf)
+{
+  video_framebuff_uninit(&type_inf->bufinf);
+  nxsem_destroy(&type_inf->wait_capture.dqbuf_wait_flg);
+  nxmutex_destroy(&type_inf->lock_state);
+  capture_bufheap_release(type_inf);
+}
+
 static void cleanup_scene_parameter(FAR capture_scene_params_t **vsp)
 {
   FAR capture_scene_params_t *sp = *vsp;
@@ -1240,8 +1260,8 @@ static void cleanup_resources(FAR capture_mng_t *cmng)
 
   /* Clean up resource */
 
-  cleanup_streamresources(&cmng->capture_inf, cmng);
-  cleanup_streamresources(&cmng->still_inf, cmng);
+  cleanup_streamresources(&cmng->capture_inf);
+  cleanup_streamresources(&cmng->still_inf);
   cleanup_scenes_parameter(cmng);
 }
 
@@ -2170,34 +2190,46 @@ static int capture_reqbufs(FAR struct file *filep,
                                               reqbufs->count);
       if (ret == OK && reqbufs->memory == V4L2_MEMORY_MMAP)
         {
-          if (type_inf->bufheap != NULL)
-            {
-              if (imgdata->ops->free)
-                {
-                    imgdata->ops->free(imgdata, type_inf->bufheap);
-                }
-              else
-                {
-                  kumm_free(type_inf->bufheap);
-                }
-            }
+          size_t heapsize = reqbufs->count *
+            get_bufsize(&type_inf->fmt[CAPTURE_FMT_MAIN]);
+
+          capture_bufheap_release(type_inf);
 
           if (imgdata->ops->alloc)
             {
               type_inf->bufheap = imgdata->ops->alloc(imgdata, 32,
-                reqbufs->count *
-                get_bufsize(&type_inf->fmt[CAPTURE_FMT_MAIN]));
+                                                      heapsize);
             }
           else
             {
-              type_inf->bufheap = kumm_memalign(32, reqbufs->count *
-                get_bufsize(&type_inf->fmt[CAPTURE_FMT_MAIN]));
+              type_inf->bufheap = kumm_memalign(32, heapsize);
             }
 
           if (type_inf->bufheap == NULL)
             {
               ret = -ENOMEM;
             }
+          else
+            {
+              type_inf->bufref = v4l2_bufheap_create(type_inf->bufheap,
+                                                     heapsize,
+                                                     capture_bufheap_free,
+                                                     imgdata);
+              if (type_inf->bufref == NULL)
+                {
+                  if (imgdata->ops->free)
+                    {
+                      imgdata->ops->free(imgdata, type_inf->bufheap);
+                    }
+                  else
+                    {
+                      kumm_free(type_inf->bufheap);
+                    }
+
+                  type_inf->bufheap = NULL;
+                  ret = -ENOMEM;
+                }
+            }
         }
     }
 
@@ -2234,6 +2266,39 @@ static int capture_querybuf(FAR struct file *filep,
   return OK;
 }
 
+static int capture_expbuf(FAR struct file *filep,
+                          FAR struct v4l2_exportbuffer *expbuf)
+{
+  FAR struct inode *inode = filep->f_inode;
+  FAR capture_mng_t *cmng = inode->i_private;
+  FAR capture_type_inf_t *type_inf;
+  size_t length;
+  int fd;
+
+  if (cmng == NULL || expbuf == NULL || expbuf->plane != 0)
+    {
+      return -EINVAL;
+    }
+
+  type_inf = get_capture_type_inf(cmng, expbuf->type);
+  if (type_inf == NULL || type_inf->bufref == NULL ||
+      expbuf->index >= (uint32_t)type_inf->bufinf.container_size)
+    {
+      return -EINVAL;
+    }
+
+  length = get_bufsize(&type_inf->fmt[CAPTURE_FMT_MAIN]);
+  fd = v4l2_expbuf_export(type_inf->bufref, length * expbuf->index,
+                          length, expbuf->flags);
+  if (fd < 0)
+    {
+      return fd;
+    }
+
+  expbuf->fd = fd;
+  return OK;
+}
+
 static int capture_qbuf(FAR struct file *filep,
                         FAR struct v4l2_buffer *buf)
 {
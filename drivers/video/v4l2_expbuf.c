@@ -0,0 +1,243 @@
+/****************************************************************************
+ * drivers/video/v4l2_expbuf.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <debug.h>
+#include <errno.h>
+#include <fcntl.h>
+
+#include <nuttx/fs/fs.h>
+#include <nuttx/irq.h>
+#include <nuttx/kmalloc.h>
+
+#include "v4l2_expbuf.h"
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* State behind one descriptor returned by VIDIOC_EXPBUF */
+
+struct v4l2_export_s
+{
+  FAR struct v4l2_bufheap_s *heap;   /* Referenced buffer heap */
+  off_t                      offset; /* Buffer offset within the heap */
+  size_t                     length; /* Buffer size in bytes */
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+static int v4l2_export_close(FAR struct file *filep);
+static int v4l2_export_mmap(FAR struct file *filep,
+                            FAR struct mm_map_entry_s *map);
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const struct file_operations g_v4l2_export_fops =
+{
+  NULL,              /* open */
+  v4l2_export_close, /* close */
+  NULL,              /* read */
+  NULL,              /* write */
+  NULL,              /* seek */
+  NULL,              /* ioctl */
+  v4l2_export_mmap,  /* mmap */
+};
+
+static struct inode g_v4l2_export_inode =
+{
+  NULL,                   /* i_parent */
+  NULL,                   /* i_peer */
+  NULL,                   /* i_child */
+  1,                      /* i_crefs */
+  FSNODEFLAG_TYPE_DRIVER, /* i_flags */
+  {
+    &g_v4l2_export_fops   /* u */
+  }
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: v4l2_export_close
+ ****************************************************************************/
+
+static int v4l2_export_close(FAR struct file *filep)
+{
+  FAR struct v4l2_export_s *exp = filep->f_priv;
+
+  v4l2_bufheap_unref(exp->heap);
+  kmm_free(exp);
+  return OK;
+}
+
+/****************************************************************************
+ * Name: v4l2_export_mmap
+ ****************************************************************************/
+
+static int v4l2_export_mmap(FAR struct file *filep,
+                            FAR struct mm_map_entry_s *map)
+{
+  FAR struct v4l2_export_s *exp = filep->f_priv;
+
+  if (map->offset < 0 || map->length == 0 ||
+      map->offset + map->length > exp->length)
+    {
+      return -EINVAL;
+    }
+
+  map->vaddr = exp->heap->mem + exp->offset + map->offset;
+  return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: v4l2_bufheap_create
+ *
+ * Description:
+ *   Wrap an allocated buffer heap for reference counting.  The caller
+ *   (the owning device) holds the initial reference.
+ *
+ * Input Parameters:
+ *   mem    - The allocated buffer memory
+ *   length - Total size of mem in bytes
+ *   freecb - Method to release mem when the last reference is dropped
+ *   priv   - Opaque context for freecb
+ *
+ * Returned Value:
+ *   The wrapper on success; NULL on allocation failure.
+ *
+ ****************************************************************************/
+
+FAR struct v4l2_bufheap_s *v4l2_bufheap_create(FAR uint8_t *mem,
+                                               size_t length,
+                                               v4l2_bufheap_free_t freecb,
+                                               FAR void *priv)
+{
+  FAR struct v4l2_bufheap_s *heap;
+
+  heap = kmm_zalloc(sizeof(struct v4l2_bufheap_s));
+  if (heap != NULL)
+    {
+      heap->mem    = mem;
+      heap->length = length;
+      heap->crefs  = 1;
+      heap->free   = freecb;
+      heap->priv   = priv;
+    }
+
+  return heap;
+}
+
+/****************************************************************************
+ * Name: v4l2_bufheap_unref
+ *
+ * Description:
+ *   Drop one reference to the buffer heap.  The buffer memory and the
+ *   wrapper are released when the last reference is dropped.
+ *
+ ****************************************************************************/
+
+void v4l2_bufheap_unref(FAR struct v4l2_bufheap_s *heap)
+{
+  irqstate_t flags;
+  uint8_t crefs;
+
+  flags = enter_critical_section();
+  crefs = --heap->crefs;
+  leave_critical_section(flags);
+
+  if (crefs == 0)
+    {
+      heap->free(heap);
+      kmm_free(heap);
+    }
+}
+
+/****************************************************************************
+ * Name: v4l2_expbuf_export
+ *
+ * Description:
+ *   Export one buffer of the heap as a file descriptor.  The descriptor
+ *   holds a reference to the heap until it is closed, and mmap() on it
+ *   returns the address of the exported buffer.
+ *
+ * Input Parameters:
+ *   heap   - The buffer heap containing the buffer
+ *   offset - Buffer offset within the heap
+ *   length - Buffer size in bytes
+ *   flags  - Open flags for the descriptor (O_CLOEXEC etc.)
+ *
+ * Returned Value:
+ *   The new file descriptor on success; a negated errno value on failure.
+ *
+ ****************************************************************************/
+
+int v4l2_expbuf_export(FAR struct v4l2_bufheap_s *heap, off_t offset,
+                       size_t length, uint32_t flags)
+{
+  FAR struct v4l2_export_s *exp;
+  irqstate_t irqflags;
+  int fd;
+
+  if (offset < 0 || offset + length > heap->length)
+    {
+      return -EINVAL;
+    }
+
+  exp = kmm_zalloc(sizeof(struct v4l2_export_s));
+  if (exp == NULL)
+    {
+      return -ENOMEM;
+    }
+
+  exp->heap   = heap;
+  exp->offset = offset;
+  exp->length = length;
+
+  irqflags = enter_critical_section();
+  heap->crefs++;
+  leave_critical_section(irqflags);
+
+  fd = file_allocate(&g_v4l2_export_inode, O_RDWR | flags,
+                     0, exp, 0, true);
+  if (fd < 0)
+    {
+      v4l2_bufheap_unref(heap);
+      kmm_free(exp);
+    }
+
+  return fd;
+}
@@ -0,0 +1,70 @@
+/****************************************************************************
+ * drivers/video/v4l2_expbuf.h
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __DRIVERS_VIDEO_V4L2_EXPBUF_H
+#define __DRIVERS_VIDEO_V4L2_EXPBUF_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+struct v4l2_bufheap_s;
+
+/* Called to release the buffer memory once the owning device and all
+ * exported descriptors have dropped their references.
+ */
+
+typedef CODE void (*v4l2_bufheap_free_t)(FAR struct v4l2_bufheap_s *heap);
+
+/* Reference-counted wrapper around a device's V4L2_MEMORY_MMAP buffer
+ * heap.  The owning device holds one reference; each descriptor created
+ * by VIDIOC_EXPBUF holds another, so the memory outlives REQBUFS
+ * reallocation and device close while a consumer still uses it.
+ */
+
+struct v4l2_bufheap_s
+{
+  FAR uint8_t         *mem;    /* Buffer memory */
+  size_t               length; /* Total size of mem in bytes */
+  uint8_t              crefs;  /* Owning device + exported descriptors */
+  v4l2_bufheap_free_t  free;   /* How to release mem */
+  FAR void            *priv;   /* For the free method (e.g. imgdata) */
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+FAR struct v4l2_bufheap_s *v4l2_bufheap_create(FAR uint8_t *mem,
+                                               size_t length,
+                                               v4l2_bufheap_free_t freecb,
+                                               FAR void *priv);
+void v4l2_bufheap_unref(FAR struct v4l2_bufheap_s *heap);
+int  v4l2_expbuf_export(FAR struct v4l2_bufheap_s *heap, off_t offset,
+                        size_t length, uint32_t flags);
+
+#endif /* __DRIVERS_VIDEO_V4L2_EXPBUF_H */
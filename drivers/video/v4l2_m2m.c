@@ -162,6 +162,7 @@ static const struct v4l2_ops_s g_codec_vops =
   NULL,                  /* enum_input */
   codec_reqbufs,         /* reqbufs */
   codec_querybuf,        /* querybuf */
+  NULL,                  /* expbuf */
   codec_qbuf,            /* qbuf */
   codec_dqbuf,           /* dqbuf */
   NULL,                  /* cancel_dqbuf */
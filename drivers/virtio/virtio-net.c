@@ -27,8 +27,10 @@
 #include <stdint.h>
 #include <string.h>
 
+#include <nuttx/arch.h>
 #include <nuttx/compiler.h>
 #include <nuttx/kmalloc.h>
+#include <nuttx/semaphore.h>
 #include <nuttx/net/ip.h>
 #include <nuttx/net/netdev_lowerhalf.h>
 #include <nuttx/virtio/virtio.h>
@@ -43,6 +45,10 @@
 /* Virtio net feature bits */
 
 #define VIRTIO_NET_F_MAC      5
+#ifdef CONFIG_DRIVERS_VIRTIO_NET_MQ
+#  define VIRTIO_NET_F_CTRL_VQ 17
+#  define VIRTIO_NET_F_MQ      22
+#endif
 
 /* Virtio net header size and packet buffer size */
 
@@ -50,12 +56,28 @@
 #define VIRTIO_NET_LLHDRSIZE  (sizeof(struct virtio_net_llhdr_s))
 #define VIRTIO_NET_BUFSIZE    (CONFIG_NET_ETH_PKTSIZE + CONFIG_NET_GUARDSIZE)
 
-/* Virtio net virtqueue index and number */
+/* Virtio net virtqueue index and number.  The virtqueues come in TX/RX
+ * pairs: pair i uses virtqueue 2i for receive and 2i + 1 for transmit.
+ * Without VIRTIO_NET_F_MQ there is only pair 0 and, when multiqueue is
+ * active, the control virtqueue is the last one after all the pairs.
+ */
 
 #define VIRTIO_NET_RX         0
 #define VIRTIO_NET_TX         1
 #define VIRTIO_NET_NUM        2
 
+#define VIRTIO_NET_RXQ(i)     (2 * (i))
+#define VIRTIO_NET_TXQ(i)     (2 * (i) + 1)
+#define VIRTIO_NET_ISRXQ(id)  (((id) & 1) == 0)
+
+#ifdef CONFIG_DRIVERS_VIRTIO_NET_MQ
+/* Control virtqueue class and commands (VIRTIO_NET_F_CTRL_VQ) */
+
+#  define VIRTIO_NET_CTRL_MQ              4
+#  define VIRTIO_NET_CTRL_MQ_VQ_PAIRS_SET 0
+#  define VIRTIO_NET_CTRL_ACK_OK          0
+#endif
+
 #define VIRTIO_NET_MAX_PKT_SIZE \
     ((CONFIG_NET_LL_GUARDSIZE - ETH_HDRLEN) + VIRTIO_NET_BUFSIZE)
 #define VIRTIO_NET_MAX_NIOB \
@@ -97,6 +119,20 @@ begin_packed_struct struct virtio_net_config_s
   uint32_t supported_hash_types;
 } end_packed_struct;
 
+#ifdef CONFIG_DRIVERS_VIRTIO_NET_MQ
+/* Control virtqueue command layout, the ack byte is written back by the
+ * device.
+ */
+
+begin_packed_struct struct virtio_net_ctrl_cmd_s
+{
+  uint8_t  ctrl_class;
+  uint8_t  cmd;
+  uint16_t pairs;
+  uint8_t  ack;
+} end_packed_struct;
+#endif
+
 struct virtio_net_priv_s
 {
 #ifdef CONFIG_DRIVERS_WIFI_SIM
@@ -110,12 +146,18 @@ struct virtio_net_priv_s
   struct netdev_lowerhalf_s lower;     /* The netdev lowerhalf */
 #endif
 
-  spinlock_t                lock[VIRTIO_NET_NUM];
+  FAR spinlock_t           *lock;      /* One lock per virtqueue */
+#ifdef CONFIG_DRIVERS_VIRTIO_NET_MQ
+  sem_t                     ctrlsem;   /* Control command completion */
+#endif
 
   /* Virtio device information */
 
   FAR struct virtio_device *vdev;      /* Virtio device pointer */
-  int                       bufnum;    /* TX and RX Buffer number */
+  int                       bufnum;    /* Per-virtqueue buffer number */
+  int                       npairs;    /* Active TX/RX virtqueue pairs */
+  int                       nvqs;      /* Created virtqueue number */
+  int                       rxq;       /* Next RX pair polled by recv */
 };
 
 /* Virtio Link Layer Header, follow shows the iob buffer layout:
@@ -264,7 +306,7 @@ static int virtio_net_addbuffer(FAR struct netdev_lowerhalf_s *dev,
     }
 
   vrtinfo("Fill vq=%u, hdr=%p, count=%d\n", vq_id, hdr, iov_cnt);
-  if (vq_id == VIRTIO_NET_RX)
+  if (VIRTIO_NET_ISRXQ(vq_id))
     {
       return virtqueue_add_buffer_lock(vq, vb, 0, iov_cnt, hdr,
                                        &priv->lock[vq_id]);
@@ -283,39 +325,47 @@ static int virtio_net_addbuffer(FAR struct netdev_lowerhalf_s *dev,
 static void virtio_net_rxfill(FAR struct netdev_lowerhalf_s *dev)
 {
   FAR struct virtio_net_priv_s *priv = (FAR struct virtio_net_priv_s *)dev;
-  FAR struct virtqueue *vq = priv->vdev->vrings_info[VIRTIO_NET_RX].vq;
+  FAR struct virtqueue *vq;
   FAR netpkt_t *pkt;
+  unsigned int vq_id;
+  int q;
   int i;
 
-  for (i = 0; i < priv->bufnum; i++)
+  for (q = 0; q < priv->npairs; q++)
     {
-      /* IOB Offload, Alloc buffer from RX netpkt */
+      vq_id = VIRTIO_NET_RXQ(q);
+      vq    = priv->vdev->vrings_info[vq_id].vq;
 
-      pkt = netpkt_alloc(dev, NETPKT_RX);
-      if (pkt == NULL)
+      for (i = 0; i < priv->bufnum; i++)
         {
-          vrtinfo("Has ran out of the RX buffer, i=%d\n", i);
-          break;
-        }
+          /* IOB Offload, Alloc buffer from RX netpkt */
 
-      /* Preserve data length */
+          pkt = netpkt_alloc(dev, NETPKT_RX);
+          if (pkt == NULL)
+            {
+              vrtinfo("Has ran out of the RX buffer, i=%d\n", i);
+              break;
+            }
 
-      if (netpkt_setdatalen(dev, pkt, VIRTIO_NET_BUFSIZE) <
-          VIRTIO_NET_BUFSIZE)
-        {
-          vrtwarn("No enough buffer to prepare RX buffer, i=%d\n", i);
-          netpkt_free(dev, pkt, NETPKT_RX);
-          break;
-        }
+          /* Preserve data length */
 
-      /* Add buffer to RX virtqueue */
+          if (netpkt_setdatalen(dev, pkt, VIRTIO_NET_BUFSIZE) <
+              VIRTIO_NET_BUFSIZE)
+            {
+              vrtwarn("No enough buffer to prepare RX buffer, i=%d\n", i);
+              netpkt_free(dev, pkt, NETPKT_RX);
+              break;
+            }
 
-      virtio_net_addbuffer(dev, vq, pkt, VIRTIO_NET_RX);
-    }
+          /* Add buffer to RX virtqueue */
 
-  if (i > 0)
-    {
-      virtqueue_kick_lock(vq, &priv->lock[VIRTIO_NET_RX]);
+          virtio_net_addbuffer(dev, vq, pkt, vq_id);
+        }
+
+      if (i > 0)
+        {
+          virtqueue_kick_lock(vq, &priv->lock[vq_id]);
+        }
     }
 }
 
@@ -326,22 +376,30 @@ static void virtio_net_rxfill(FAR struct netdev_lowerhalf_s *dev)
 static void virtio_net_txfree(FAR struct netdev_lowerhalf_s *dev)
 {
   FAR struct virtio_net_priv_s *priv = (FAR struct virtio_net_priv_s *)dev;
-  FAR struct virtqueue *vq = priv->vdev->vrings_info[VIRTIO_NET_TX].vq;
   FAR struct virtio_net_llhdr_s *hdr;
+  FAR struct virtqueue *vq;
+  unsigned int vq_id;
+  int q;
 
-  while (1)
+  for (q = 0; q < priv->npairs; q++)
     {
-      /* Get buffer from tx virtqueue */
+      vq_id = VIRTIO_NET_TXQ(q);
+      vq    = priv->vdev->vrings_info[vq_id].vq;
 
-      hdr = virtqueue_get_buffer_lock(vq, NULL, NULL,
-                                      &priv->lock[VIRTIO_NET_TX]);
-      if (hdr == NULL)
+      while (1)
         {
-          break;
-        }
+          /* Get buffer from tx virtqueue */
+
+          hdr = virtqueue_get_buffer_lock(vq, NULL, NULL,
+                                          &priv->lock[vq_id]);
+          if (hdr == NULL)
+            {
+              break;
+            }
 
-      netpkt_free(dev, hdr->pkt, NETPKT_TX);
-      vrtinfo("Free, hdr: %p, pkt: %p\n", hdr, hdr->pkt);
+          netpkt_free(dev, hdr->pkt, NETPKT_TX);
+          vrtinfo("Free, hdr: %p, pkt: %p\n", hdr, hdr->pkt);
+        }
     }
 }
 
@@ -352,6 +410,7 @@ static void virtio_net_txfree(FAR struct netdev_lowerhalf_s *dev)
 static int virtio_net_ifup(FAR struct netdev_lowerhalf_s *dev)
 {
   FAR struct virtio_net_priv_s *priv = (FAR struct virtio_net_priv_s *)dev;
+  int i;
 
 #ifdef CONFIG_NET_IPv4
   vrtinfo("Bringing up: %u.%u.%u.%u\n",
@@ -368,8 +427,12 @@ static int virtio_net_ifup(FAR struct netdev_lowerhalf_s *dev)
 
   /* Prepare interrupt and packets for receiving */
 
-  virtqueue_enable_cb_lock(priv->vdev->vrings_info[VIRTIO_NET_RX].vq,
-                           &priv->lock[VIRTIO_NET_RX]);
+  for (i = 0; i < priv->npairs; i++)
+    {
+      virtqueue_enable_cb_lock(priv->vdev->vrings_info[VIRTIO_NET_RXQ(i)].vq,
+                               &priv->lock[VIRTIO_NET_RXQ(i)]);
+    }
+
   virtio_net_rxfill(dev);
 
 #ifdef CONFIG_DRIVERS_WIFI_SIM
@@ -393,7 +456,7 @@ static int virtio_net_ifdown(FAR struct netdev_lowerhalf_s *dev)
 
   /* Disable the Ethernet interrupt */
 
-  for (i = 0; i < VIRTIO_NET_NUM; i++)
+  for (i = 0; i < 2 * priv->npairs; i++)
     {
       virtqueue_disable_cb_lock(priv->vdev->vrings_info[i].vq,
                                 &priv->lock[i]);
@@ -420,7 +483,8 @@ static int virtio_net_send(FAR struct netdev_lowerhalf_s *dev,
                            FAR netpkt_t *pkt)
 {
   FAR struct virtio_net_priv_s *priv = (FAR struct virtio_net_priv_s *)dev;
-  FAR struct virtqueue *vq = priv->vdev->vrings_info[VIRTIO_NET_TX].vq;
+  FAR struct virtqueue *vq;
+  unsigned int vq_id;
 
   /* Check the send length */
 
@@ -430,10 +494,17 @@ static int virtio_net_send(FAR struct netdev_lowerhalf_s *dev,
       return -EINVAL;
     }
 
+  /* Spread the transmissions over the TX virtqueue pairs by the
+   * submitting CPU, so concurrent senders do not contend for one ring.
+   */
+
+  vq_id = VIRTIO_NET_TXQ(up_cpu_index() % priv->npairs);
+  vq    = priv->vdev->vrings_info[vq_id].vq;
+
   /* Add buffer to vq and notify the other side */
 
-  virtio_net_addbuffer(dev, vq, pkt, VIRTIO_NET_TX);
-  virtqueue_kick_lock(vq, &priv->lock[VIRTIO_NET_TX]);
+  virtio_net_addbuffer(dev, vq, pkt, vq_id);
+  virtqueue_kick_lock(vq, &priv->lock[vq_id]);
 
   /* Try return Netpkt TX buffer to upper-half. */
 
@@ -443,7 +514,7 @@ static int virtio_net_send(FAR struct netdev_lowerhalf_s *dev,
 
   if (netdev_lower_quota_load(dev, NETPKT_TX) <= 0)
     {
-      virtqueue_enable_cb_lock(vq, &priv->lock[VIRTIO_NET_TX]);
+      virtqueue_enable_cb_lock(vq, &priv->lock[vq_id]);
     }
 
   return OK;
@@ -456,39 +527,53 @@ static int virtio_net_send(FAR struct netdev_lowerhalf_s *dev,
 static netpkt_t *virtio_net_recv(FAR struct netdev_lowerhalf_s *dev)
 {
   FAR struct virtio_net_priv_s *priv = (FAR struct virtio_net_priv_s *)dev;
-  FAR struct virtqueue *vq = priv->vdev->vrings_info[VIRTIO_NET_RX].vq;
   FAR struct virtio_net_llhdr_s *hdr;
+  FAR struct virtqueue *vq;
+  unsigned int vq_id;
   irqstate_t flags;
   uint32_t len;
+  int pair;
+  int q;
 
-  /* Fill the free Netpkt RX buffer to the RX virtqueue */
+  /* Fill the free Netpkt RX buffer to the RX virtqueues */
 
   virtio_net_rxfill(dev);
 
-  /* Get received buffer form RX virtqueue */
+  /* Get received buffer from the RX virtqueues.  Continue with the pair
+   * that delivered the previous packet, so a burst on one used ring is
+   * drained in batch before moving on to the next pair.
+   */
 
-  flags = spin_lock_irqsave(&priv->lock[VIRTIO_NET_RX]);
-  hdr = virtqueue_get_buffer(vq, &len, NULL);
-  if (hdr == NULL)
+  for (q = 0; q < priv->npairs; q++)
     {
-      /* If we have no buffer left, enable RX callback. */
+      pair  = (priv->rxq + q) % priv->npairs;
+      vq_id = VIRTIO_NET_RXQ(pair);
+      vq    = priv->vdev->vrings_info[vq_id].vq;
+
+      flags = spin_lock_irqsave(&priv->lock[vq_id]);
+      hdr = virtqueue_get_buffer(vq, &len, NULL);
+      if (hdr == NULL)
+        {
+          /* If this pair has no buffer left, enable its RX callback. */
 
-      virtqueue_enable_cb(vq);
-      spin_unlock_irqrestore(&priv->lock[VIRTIO_NET_RX], flags);
+          virtqueue_enable_cb(vq);
+          spin_unlock_irqrestore(&priv->lock[vq_id], flags);
+          continue;
+        }
 
-      vrtinfo("get NULL buffer\n");
-      return NULL;
-    }
-  else
-    {
-      spin_unlock_irqrestore(&priv->lock[VIRTIO_NET_RX], flags);
-    }
+      spin_unlock_irqrestore(&priv->lock[vq_id], flags);
+      priv->rxq = pair;
 
-  /* Set the received pkt length */
+      /* Set the received pkt length */
 
-  netpkt_setdatalen(dev, hdr->pkt, len - VIRTIO_NET_HDRSIZE);
-  vrtinfo("Recv, hdr=%p, pkt=%p, len=%" PRIu32 "\n", hdr, hdr->pkt, len);
-  return hdr->pkt;
+      netpkt_setdatalen(dev, hdr->pkt, len - VIRTIO_NET_HDRSIZE);
+      vrtinfo("Recv, hdr=%p, pkt=%p, len=%" PRIu32 "\n",
+              hdr, hdr->pkt, len);
+      return hdr->pkt;
+    }
+
+  vrtinfo("get NULL buffer\n");
+  return NULL;
 }
 
 #ifdef CONFIG_NET_MCASTGROUP
@@ -533,7 +618,7 @@ static void virtio_net_rxready(FAR struct virtqueue *vq)
 {
   FAR struct virtio_net_priv_s *priv = vq->vq_dev->priv;
 
-  virtqueue_disable_cb_lock(vq, &priv->lock[VIRTIO_NET_RX]);
+  virtqueue_disable_cb_lock(vq, &priv->lock[vq->vq_queue_index]);
   netdev_lower_rxready((FAR struct netdev_lowerhalf_s *)priv);
 }
 
@@ -545,10 +630,76 @@ static void virtio_net_txdone(FAR struct virtqueue *vq)
 {
   FAR struct virtio_net_priv_s *priv = vq->vq_dev->priv;
 
-  virtqueue_disable_cb_lock(vq, &priv->lock[VIRTIO_NET_TX]);
+  virtqueue_disable_cb_lock(vq, &priv->lock[vq->vq_queue_index]);
   netdev_lower_txdone((FAR struct netdev_lowerhalf_s *)priv);
 }
 
+#ifdef CONFIG_DRIVERS_VIRTIO_NET_MQ
+/****************************************************************************
+ * Name: virtio_net_ctrldone
+ ****************************************************************************/
+
+static void virtio_net_ctrldone(FAR struct virtqueue *vq)
+{
+  FAR struct virtio_net_priv_s *priv = vq->vq_dev->priv;
+
+  virtqueue_disable_cb_lock(vq, &priv->lock[vq->vq_queue_index]);
+  nxsem_post(&priv->ctrlsem);
+}
+
+/****************************************************************************
+ * Name: virtio_net_set_vq_pairs
+ *
+ * Description:
+ *   Tell the device how many TX/RX virtqueue pairs the driver drives by
+ *   sending VIRTIO_NET_CTRL_MQ_VQ_PAIRS_SET over the control virtqueue.
+ *   Until the command is acknowledged the device only uses pair 0.
+ *
+ ****************************************************************************/
+
+static int virtio_net_set_vq_pairs(FAR struct virtio_net_priv_s *priv)
+{
+  FAR struct virtqueue *vq = priv->vdev->vrings_info[priv->nvqs - 1].vq;
+  FAR spinlock_t *lock = &priv->lock[priv->nvqs - 1];
+  FAR struct virtio_net_ctrl_cmd_s *cmd;
+  struct virtqueue_buf vb[2];
+  int ret;
+
+  cmd = kmm_zalloc(sizeof(*cmd));
+  if (cmd == NULL)
+    {
+      return -ENOMEM;
+    }
+
+  cmd->ctrl_class = VIRTIO_NET_CTRL_MQ;
+  cmd->cmd        = VIRTIO_NET_CTRL_MQ_VQ_PAIRS_SET;
+  cmd->pairs      = priv->npairs;
+  cmd->ack        = 0xff;
+
+  vb[0].buf = cmd;
+  vb[0].len = sizeof(cmd->ctrl_class) + sizeof(cmd->cmd) +
+              sizeof(cmd->pairs);
+  vb[1].buf = &cmd->ack;
+  vb[1].len = sizeof(cmd->ack);
+
+  virtqueue_enable_cb_lock(vq, lock);
+  ret = virtqueue_add_buffer_lock(vq, vb, 1, 1, cmd, lock);
+  if (ret < 0)
+    {
+      kmm_free(cmd);
+      return ret;
+    }
+
+  virtqueue_kick_lock(vq, lock);
+  nxsem_wait_uninterruptible(&priv->ctrlsem);
+  virtqueue_get_buffer_lock(vq, NULL, NULL, lock);
+
+  ret = cmd->ack == VIRTIO_NET_CTRL_ACK_OK ? OK : -EIO;
+  kmm_free(cmd);
+  return ret;
+}
+#endif /* CONFIG_DRIVERS_VIRTIO_NET_MQ */
+
 /****************************************************************************
  * Name: virtio_net_init
  ****************************************************************************/
@@ -556,50 +707,128 @@ static void virtio_net_txdone(FAR struct virtqueue *vq)
 static int virtio_net_init(FAR struct virtio_net_priv_s *priv,
                            FAR struct virtio_device *vdev)
 {
-  FAR const char *vqnames[VIRTIO_NET_NUM];
-  vq_callback callbacks[VIRTIO_NET_NUM];
+  FAR const char **vqnames;
+  FAR vq_callback *callbacks;
+  uint32_t features;
+#ifdef CONFIG_DRIVERS_VIRTIO_NET_MQ
+  uint16_t maxpairs;
+#endif
   int ret;
+  int q;
 
-  spin_lock_init(&priv->lock[VIRTIO_NET_RX]);
-  spin_lock_init(&priv->lock[VIRTIO_NET_TX]);
-  priv->vdev = vdev;
-  vdev->priv = priv;
+  priv->vdev   = vdev;
+  vdev->priv   = priv;
+  priv->npairs = 1;
+  priv->nvqs   = VIRTIO_NET_NUM;
 
   /* Initialize the virtio device */
 
   virtio_set_status(vdev, VIRTIO_CONFIG_STATUS_DRIVER);
-  virtio_negotiate_features(vdev, (1UL << VIRTIO_NET_F_MAC) |
-                                  (1UL << VIRTIO_F_ANY_LAYOUT), NULL);
+  features = (1UL << VIRTIO_NET_F_MAC) | (1UL << VIRTIO_F_ANY_LAYOUT);
+#ifdef CONFIG_DRIVERS_VIRTIO_NET_MQ
+  features |= (1UL << VIRTIO_NET_F_CTRL_VQ) | (1UL << VIRTIO_NET_F_MQ);
+#endif
+  virtio_negotiate_features(vdev, features, NULL);
   virtio_set_status(vdev, VIRTIO_CONFIG_FEATURES_OK);
 
-  vqnames[VIRTIO_NET_RX]   = "virtio_net_rx";
-  vqnames[VIRTIO_NET_TX]   = "virtio_net_tx";
-  callbacks[VIRTIO_NET_RX] = virtio_net_rxready;
-  callbacks[VIRTIO_NET_TX] = virtio_net_txdone;
-  ret = virtio_create_virtqueues(vdev, 0, VIRTIO_NET_NUM, vqnames,
+#ifdef CONFIG_DRIVERS_VIRTIO_NET_MQ
+  /* Drive one TX/RX virtqueue pair per CPU if the device offers enough
+   * pairs.  All the pairs the device advertises must be created even if
+   * fewer are used, because the control virtqueue comes after them.
+   */
+
+  if (virtio_has_feature(vdev, VIRTIO_NET_F_MQ) &&
+      virtio_has_feature(vdev, VIRTIO_NET_F_CTRL_VQ))
+    {
+      virtio_read_config_member(vdev, struct virtio_net_config_s,
+                                max_virtqueue_pairs, &maxpairs);
+      if (maxpairs > 1)
+        {
+          priv->npairs = MIN(maxpairs, CONFIG_SMP_NCPUS);
+          priv->nvqs   = 2 * maxpairs + 1;
+        }
+    }
+#endif
+
+  priv->lock = kmm_zalloc(priv->nvqs * sizeof(*priv->lock));
+  vqnames    = kmm_zalloc(priv->nvqs * sizeof(*vqnames));
+  callbacks  = kmm_zalloc(priv->nvqs * sizeof(*callbacks));
+  if (priv->lock == NULL || vqnames == NULL || callbacks == NULL)
+    {
+      ret = -ENOMEM;
+      goto err_with_arrays;
+    }
+
+  for (q = 0; q < priv->nvqs / 2; q++)
+    {
+      spin_lock_init(&priv->lock[VIRTIO_NET_RXQ(q)]);
+      spin_lock_init(&priv->lock[VIRTIO_NET_TXQ(q)]);
+      vqnames[VIRTIO_NET_RXQ(q)]   = "virtio_net_rx";
+      vqnames[VIRTIO_NET_TXQ(q)]   = "virtio_net_tx";
+      callbacks[VIRTIO_NET_RXQ(q)] = virtio_net_rxready;
+      callbacks[VIRTIO_NET_TXQ(q)] = virtio_net_txdone;
+    }
+
+#ifdef CONFIG_DRIVERS_VIRTIO_NET_MQ
+  if (priv->nvqs > VIRTIO_NET_NUM)
+    {
+      nxsem_init(&priv->ctrlsem, 0, 0);
+      spin_lock_init(&priv->lock[priv->nvqs - 1]);
+      vqnames[priv->nvqs - 1]   = "virtio_net_ctl";
+      callbacks[priv->nvqs - 1] = virtio_net_ctrldone;
+    }
+#endif
+
+  ret = virtio_create_virtqueues(vdev, 0, priv->nvqs, vqnames,
                                  callbacks, NULL);
+  kmm_free(vqnames);
+  kmm_free(callbacks);
+  vqnames   = NULL;
+  callbacks = NULL;
   if (ret < 0)
     {
       vrterr("virtio_device_create_virtqueue failed, ret=%d\n", ret);
-      return ret;
+      goto err_with_arrays;
     }
 
   virtio_set_status(vdev, VIRTIO_CONFIG_STATUS_DRIVER_OK);
 
+#ifdef CONFIG_DRIVERS_VIRTIO_NET_MQ
+  if (priv->nvqs > VIRTIO_NET_NUM &&
+      virtio_net_set_vq_pairs(priv) < 0)
+    {
+      /* Without the acknowledge the device only uses pair 0 */
+
+      vrtwarn("Multiqueue enable failed, using a single queue pair\n");
+      priv->npairs = 1;
+    }
+#endif
+
 #if CONFIG_DRIVERS_VIRTIO_NET_BUFNUM > 0
   priv->bufnum = CONFIG_DRIVERS_VIRTIO_NET_BUFNUM;
 #else
-  /* Calculate the virtio network buffer number:
+  /* Calculate the virtio network buffer number per virtqueue:
    * 1/4 for the TX netpkts, 1/4 for the RX netpkts.
    */
 
-  priv->bufnum = CONFIG_IOB_NBUFFERS / VIRTIO_NET_MAX_NIOB / 4;
+  priv->bufnum = CONFIG_IOB_NBUFFERS / VIRTIO_NET_MAX_NIOB / 4 /
+                 priv->npairs;
+  priv->bufnum = MAX(priv->bufnum, 1);
 #endif
-  priv->bufnum = MIN(vdev->vrings_info[VIRTIO_NET_RX].info.num_descs /
-                     (VIRTIO_NET_MAX_NIOB + 1), priv->bufnum);
-  priv->bufnum = MIN(vdev->vrings_info[VIRTIO_NET_TX].info.num_descs /
-                     (VIRTIO_NET_MAX_NIOB + 1), priv->bufnum);
+  for (q = 0; q < 2 * priv->npairs; q++)
+    {
+      priv->bufnum = MIN(vdev->vrings_info[q].info.num_descs /
+                         (VIRTIO_NET_MAX_NIOB + 1), priv->bufnum);
+    }
+
   return OK;
+
+err_with_arrays:
+  kmm_free(vqnames);
+  kmm_free(callbacks);
+  kmm_free(priv->lock);
+  priv->lock = NULL;
+  return ret;
 }
 
 static void virtio_net_set_macaddr(FAR struct virtio_net_priv_s *priv)
@@ -666,8 +895,8 @@ static int virtio_net_probe(FAR struct virtio_device *vdev)
   /* Initialize the netdev lower half */
 
   netdev = (FAR struct netdev_lowerhalf_s *)priv;
-  netdev->quota[NETPKT_RX] = priv->bufnum;
-  netdev->quota[NETPKT_TX] = priv->bufnum;
+  netdev->quota[NETPKT_RX] = priv->bufnum * priv->npairs;
+  netdev->quota[NETPKT_TX] = priv->bufnum * priv->npairs;
   netdev->ops = &g_virtio_net_ops;
 
 #ifdef CONFIG_DRIVERS_WIFI_SIM
@@ -713,6 +942,7 @@ static int virtio_net_probe(FAR struct virtio_device *vdev)
 err_with_virtqueues:
   virtio_reset_device(vdev);
   virtio_delete_virtqueues(vdev);
+  kmm_free(priv->lock);
 err_with_priv:
   kmm_free(priv);
   return ret;
@@ -729,6 +959,13 @@ static void virtio_net_remove(FAR struct virtio_device *vdev)
   netdev_lower_unregister((FAR struct netdev_lowerhalf_s *)priv);
   virtio_reset_device(vdev);
   virtio_delete_virtqueues(vdev);
+#ifdef CONFIG_DRIVERS_VIRTIO_NET_MQ
+  if (priv->nvqs > VIRTIO_NET_NUM)
+    {
+      nxsem_destroy(&priv->ctrlsem);
+    }
+#endif
+  kmm_free(priv->lock);
 #ifdef CONFIG_DRIVERS_WIFI_SIM
   g_netdev_num--;
   wifi_sim_remove(&priv->lower);
@@ -932,7 +932,7 @@ static int virtio_snd_allocbuffer(FAR struct audio_lowerhalf_s *dev,
 
   *desc->u.pbuffer = &buf->apb;
 
-  buf->apb.crefs = 1;
+  atomic_store(&buf->apb.crefs, 1);
   buf->apb.nmaxbytes = desc->numbytes;
   buf->apb.samp = (FAR uint8_t *)(buf + 1);
 #ifdef CONFIG_AUDIO_MULTI_SESSION
@@ -941,7 +941,6 @@ static int virtio_snd_allocbuffer(FAR struct audio_lowerhalf_s *dev,
   buf->xfer.stream_id = sdev->index;
   buf->status.status = VIRTIO_SND_S_IO_ERR;
   buf->dev = dev;
-  nxmutex_init(&buf->apb.lock);
 
   return sizeof(struct audio_buf_desc_s);
 }
@@ -955,12 +954,9 @@ static int virtio_snd_freebuffer(FAR struct audio_lowerhalf_s *dev,
   FAR struct ap_buffer_s *apb = desc->u.buffer;
   int refcount;
 
-  nxmutex_lock(&apb->lock);
-  refcount = apb->crefs--;
-  nxmutex_unlock(&apb->lock);
+  refcount = atomic_fetch_sub(&apb->crefs, 1);
   if (refcount <= 1)
     {
-      nxmutex_destroy(&apb->lock);
       virtio_free_buf(vdev, apb);
     }
 
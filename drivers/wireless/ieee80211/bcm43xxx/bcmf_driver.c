@@ -49,6 +49,10 @@
 #include "bcmf_netdev.h"
 #include "bcmf_core.h"
 
+#ifdef CONFIG_IEEE80211_BROADCOM_TXGLOM
+#include "bcmf_sdpcm.h"
+#endif
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
@@ -451,6 +455,36 @@ int bcmf_wl_active(FAR struct bcmf_dev_s *priv, bool active)
     }
 #endif
 
+#ifdef CONFIG_IEEE80211_BROADCOM_TXGLOM
+  /* Try to enable the TX Gloming feature.  Fall back to per-frame
+   * transfers if the firmware or the bus refuses it.
+   */
+
+  out_len = 4;
+  *(FAR uint32_t *)tmp_buf = 1;
+  ret = bcmf_cdc_iovar_request(priv, interface, true,
+                               IOVAR_STR_TX_GLOM, tmp_buf,
+                               &out_len);
+  if (ret == OK)
+    {
+      ret = bcmf_sdpcm_txglom_set(priv, true);
+    }
+
+  if (ret != OK)
+    {
+      wlwarn("TX glomming not available %d\n", ret);
+
+      out_len = 4;
+      *(FAR uint32_t *)tmp_buf = 0;
+      ret = bcmf_cdc_iovar_request(priv, interface, true,
+                                   IOVAR_STR_TX_GLOM, tmp_buf,
+                                   &out_len);
+      if (ret != OK)
+        {
+          goto errout_in_sdio_active;
+        }
+    }
+#else
   /* Disable TX Gloming feature */
 
   out_len = 4;
@@ -462,6 +496,7 @@ int bcmf_wl_active(FAR struct bcmf_dev_s *priv, bool active)
     {
       goto errout_in_sdio_active;
     }
+#endif
 
   /* Set default power save mode */
 
@@ -105,6 +105,11 @@ struct bcmf_sdio_dev_s
   uint8_t rx_seq;                  /* Receive sequence number (expected) */
   bool    flow_ctrl;               /* Current flow control status */
 
+#ifdef CONFIG_IEEE80211_BROADCOM_TXGLOM
+  bool tx_glom;                    /* Firmware accepted TX glomming */
+  FAR uint8_t *glom_buf;           /* Superframe assembly buffer */
+#endif
+
   mutex_t queue_lock;              /* Lock for TX/RX/free queues */
   struct list_node tx_queue;       /* Queue of frames to transmit */
   struct list_node rx_queue;       /* Queue of frames used to receive */
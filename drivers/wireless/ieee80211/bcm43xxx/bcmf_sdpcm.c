@@ -25,11 +25,14 @@
 #include <nuttx/config.h>
 #include <nuttx/compiler.h>
 
+#include <sys/param.h>
+
 #include <debug.h>
 #include <errno.h>
 #include <assert.h>
 
 #include <nuttx/arch.h>
+#include <nuttx/kmalloc.h>
 
 #include <stddef.h>
 #include <string.h>
@@ -53,6 +56,24 @@
 #define SDPCM_EVENT_CHANNEL   1  /* Asynchronous event frame id */
 #define SDPCM_DATA_CHANNEL    2  /* Data frame id */
 
+#ifdef CONFIG_IEEE80211_BROADCOM_TXGLOM
+#define SDPCM_GLOM_LASTFRM    (1ul << 24) /* Marks the last subframe */
+#define SDPCM_GLOM_ALIGN      4           /* Subframe alignment */
+
+/* Worst case glommed subframe:  Extended header plus everything that can
+ * follow the standard header of a queued frame, rounded to alignment.
+ */
+
+#define SDPCM_GLOM_MAXSUB \
+  ((sizeof(struct bcmf_sdpcm_glom_header) + HEADER_SIZE + \
+    MAX_NETDEV_PKTSIZE + CONFIG_NET_GUARDSIZE - \
+    sizeof(struct bcmf_sdpcm_header) + SDPCM_GLOM_ALIGN - 1) & \
+   ~(SDPCM_GLOM_ALIGN - 1))
+
+#define SDPCM_GLOM_BUFSIZE \
+  (CONFIG_IEEE80211_BROADCOM_TXGLOM_LIMIT * SDPCM_GLOM_MAXSUB)
+#endif
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -70,6 +91,28 @@ begin_packed_struct struct bcmf_sdpcm_header
   uint16_t padding;
 } end_packed_struct;
 
+#ifdef CONFIG_IEEE80211_BROADCOM_TXGLOM
+/* Header of a glommed subframe:  the standard hardware tag and sw header
+ * with the 8-byte hardware extension (subframe length and tail padding)
+ * inserted in between, as expected by firmware with "bus:txglom" active.
+ */
+
+begin_packed_struct struct bcmf_sdpcm_glom_header
+{
+  uint16_t size;
+  uint16_t checksum;
+  uint32_t glomlen;      /* (size - 4) | SDPCM_GLOM_LASTFRM on last frame */
+  uint32_t tailpad;      /* Tail padding length << 16 */
+  uint8_t  sequence;
+  uint8_t  channel;
+  uint8_t  next_length;
+  uint8_t  data_offset;
+  uint8_t  flow_control;
+  uint8_t  credit;
+  uint16_t padding;
+} end_packed_struct;
+#endif
+
 /****************************************************************************
  * Private Function Prototypes
  ****************************************************************************/
@@ -79,6 +122,10 @@ static int bcmf_sdpcm_rxfail(FAR bcmf_interface_dev_t *ibus, bool retry);
 static int bcmf_sdpcm_process_header(FAR bcmf_interface_dev_t *ibus,
                                      FAR struct bcmf_sdpcm_header *header);
 
+#ifdef CONFIG_IEEE80211_BROADCOM_TXGLOM
+static int bcmf_sdpcm_sendframe_glom(FAR struct bcmf_dev_s *priv);
+#endif
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -127,6 +174,139 @@ int bcmf_sdpcm_process_header(FAR bcmf_interface_dev_t *ibus,
   return OK;
 }
 
+#ifdef CONFIG_IEEE80211_BROADCOM_TXGLOM
+int bcmf_sdpcm_sendframe_glom(FAR struct bcmf_dev_s *priv)
+{
+  FAR bcmf_interface_frame_t *frames[CONFIG_IEEE80211_BROADCOM_TXGLOM_LIMIT];
+  FAR struct bcmf_sdpcm_glom_header *ghdr;
+  FAR struct bcmf_sdpcm_header *header;
+  FAR bcmf_interface_frame_t *iframe;
+  FAR bcmf_interface_dev_t *ibus = (FAR bcmf_interface_dev_t *)priv->bus;
+  unsigned int offset = 0;
+  unsigned int sublen;
+  unsigned int pad;
+  bool is_txframe = false;
+  int nframes = 0;
+  int limit;
+  int ret;
+  int i;
+
+  /* Pop a batch of frames.  Every subframe consumes one sequence number,
+   * so the batch is bounded by the remaining credits.  The first frame is
+   * taken unconditionally; further frames are taken only while the head
+   * of the queue is a data frame, so control frames are never glommed
+   * with other traffic.
+   */
+
+  limit = MIN(CONFIG_IEEE80211_BROADCOM_TXGLOM_LIMIT,
+              (uint8_t)(ibus->max_seq - ibus->tx_seq));
+
+  if (nxmutex_lock(&ibus->queue_lock) < 0)
+    {
+      DEBUGPANIC();
+    }
+
+  while (nframes < limit)
+    {
+      iframe = list_remove_head_type(&ibus->tx_queue,
+                                     bcmf_interface_frame_t, list_entry);
+      if (iframe == NULL)
+        {
+          break;
+        }
+
+      frames[nframes++] = iframe;
+
+      iframe = list_peek_head_type(&ibus->tx_queue,
+                                   bcmf_interface_frame_t, list_entry);
+      if (iframe == NULL)
+        {
+          break;
+        }
+
+      header = (FAR struct bcmf_sdpcm_header *)iframe->header.base;
+      if (header->channel != SDPCM_DATA_CHANNEL)
+        {
+          break;
+        }
+    }
+
+  nxmutex_unlock(&ibus->queue_lock);
+
+  if (nframes == 0)
+    {
+      return -ENODATA;
+    }
+
+  /* Rebuild each frame in the assembly buffer with the extended header */
+
+  for (i = 0; i < nframes; i++)
+    {
+      iframe = frames[i];
+      header = (FAR struct bcmf_sdpcm_header *)iframe->header.base;
+
+      sublen = iframe->header.len - sizeof(struct bcmf_sdpcm_header) +
+               sizeof(struct bcmf_sdpcm_glom_header);
+
+      /* All subframes but the last one are padded to 4-byte alignment.
+       * The padding is not counted in the subframe size; the firmware
+       * strips it from the tailpad field.
+       */
+
+      pad = i + 1 < nframes ? (-sublen) & (SDPCM_GLOM_ALIGN - 1) : 0;
+
+      ghdr = (FAR struct bcmf_sdpcm_glom_header *)(ibus->glom_buf + offset);
+
+      ghdr->size         = sublen;
+      ghdr->checksum     = ~ghdr->size;
+      ghdr->glomlen      = (sublen - FIRST_WORD_SIZE) |
+                           (i + 1 == nframes ? SDPCM_GLOM_LASTFRM : 0);
+      ghdr->tailpad      = (uint32_t)pad << 16;
+      ghdr->sequence     = ibus->tx_seq++;
+      ghdr->channel      = header->channel;
+      ghdr->next_length  = 0;
+      ghdr->data_offset  = header->data_offset +
+                           sizeof(struct bcmf_sdpcm_glom_header) -
+                           sizeof(struct bcmf_sdpcm_header);
+      ghdr->flow_control = 0;
+      ghdr->credit       = 0;
+      ghdr->padding      = 0;
+
+      memcpy((FAR uint8_t *)ghdr + sizeof(struct bcmf_sdpcm_glom_header),
+             iframe->header.base + sizeof(struct bcmf_sdpcm_header),
+             iframe->header.len - sizeof(struct bcmf_sdpcm_header));
+
+      memset((FAR uint8_t *)ghdr + sublen, 0, pad);
+
+      offset += sublen + pad;
+
+      is_txframe |= iframe->tx;
+    }
+
+  wlinfo("Send glom of %d frames, %u bytes\n", nframes, offset);
+
+  /* Write the whole superframe in a single transfer */
+
+  ret = bcmf_transfer_bytes(ibus, true, 2, 0, ibus->glom_buf, offset);
+
+  /* Free frame buffers */
+
+  for (i = 0; i < nframes; i++)
+    {
+      bcmf_interface_free_frame(priv, frames[i]);
+    }
+
+  if (ret == OK && is_txframe)
+    {
+      /* Notify upper layer at least one TX buffer is available */
+
+      bcmf_netdev_notify_tx(priv);
+    }
+
+  return ret;
+}
+#endif /* CONFIG_IEEE80211_BROADCOM_TXGLOM */
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -376,6 +556,13 @@ int bcmf_sdpcm_sendframe(FAR struct bcmf_dev_s *priv)
       return -EAGAIN;
     }
 
+#ifdef CONFIG_IEEE80211_BROADCOM_TXGLOM
+  if (ibus->tx_glom)
+    {
+      return bcmf_sdpcm_sendframe_glom(priv);
+    }
+#endif
+
   if (nxmutex_lock(&ibus->queue_lock) < 0)
     {
       DEBUGPANIC();
@@ -529,3 +716,25 @@ FAR struct bcmf_frame_s *bcmf_sdpcm_get_rx_frame(FAR struct bcmf_dev_s *priv)
 
   return &iframe->header;
 }
+
+#ifdef CONFIG_IEEE80211_BROADCOM_TXGLOM
+int bcmf_sdpcm_txglom_set(FAR struct bcmf_dev_s *priv, bool enable)
+{
+  FAR bcmf_interface_dev_t *ibus = (FAR bcmf_interface_dev_t *)priv->bus;
+
+  if (enable && ibus->glom_buf == NULL)
+    {
+      /* Allocate the superframe assembly buffer on first activation */
+
+      ibus->glom_buf = kmm_malloc(SDPCM_GLOM_BUFSIZE);
+      if (ibus->glom_buf == NULL)
+        {
+          ibus->tx_glom = false;
+          return -ENOMEM;
+        }
+    }
+
+  ibus->tx_glom = enable;
+  return OK;
+}
+#endif /* CONFIG_IEEE80211_BROADCOM_TXGLOM */
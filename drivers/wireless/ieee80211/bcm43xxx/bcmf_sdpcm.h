@@ -47,4 +47,8 @@ struct bcmf_frame_s *bcmf_sdpcm_alloc_frame(FAR struct bcmf_dev_s *priv,
 
 struct bcmf_frame_s *bcmf_sdpcm_get_rx_frame(FAR struct bcmf_dev_s *priv);
 
+#ifdef CONFIG_IEEE80211_BROADCOM_TXGLOM
+int bcmf_sdpcm_txglom_set(FAR struct bcmf_dev_s *priv, bool enable);
+#endif
+
 #endif /* __DRIVERS_WIRELESS_IEEE80211_BCM43XXX_BCMF_SDPCM_H */
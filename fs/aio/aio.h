@@ -48,6 +48,14 @@
 #  define CONFIG_FS_NAIOC 8
 #endif
 
+/* Number of dedicated AIO worker threads.  Zero means that the I/O is
+ * performed on the low-priority work queue.
+ */
+
+#ifndef CONFIG_FS_AIO_NTHREADS
+#  define CONFIG_FS_AIO_NTHREADS 0
+#endif
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -64,6 +72,10 @@ struct aio_container_s
   FAR struct aiocb *aioc_aiocbp;   /* The contained AIO control block */
   FAR struct file *aioc_filep;     /* File structure to use with the I/O */
   struct work_s aioc_work;         /* Used to defer I/O to the work thread */
+#if CONFIG_FS_AIO_NTHREADS > 0
+  dq_entry_t aioc_qlink;           /* Supports the worker pool ready list */
+  worker_t aioc_worker;            /* The I/O method to perform */
+#endif
   pid_t aioc_pid;                  /* ID of the waiting task */
 #ifdef CONFIG_PRIORITY_INHERITANCE
   uint8_t aioc_prio;               /* Priority of the waiting task */
@@ -220,6 +232,45 @@ FAR struct aiocb *aioc_decant(FAR struct aio_container_s *aioc);
 
 int aio_queue(FAR struct aio_container_s *aioc, worker_t worker);
 
+/****************************************************************************
+ * Name: aio_queue_cancel
+ *
+ * Description:
+ *   Attempt to remove a queued asynchronous I/O before it is started.
+ *
+ * Input Parameters:
+ *   aioc - Pointer to the AIO control block container
+ *
+ * Returned Value:
+ *   Zero (OK) if the I/O was still queued and has been removed.  A negated
+ *   errno value (-ENOENT) is returned if the I/O has already been started
+ *   and can no longer be canceled.
+ *
+ ****************************************************************************/
+
+int aio_queue_cancel(FAR struct aio_container_s *aioc);
+
+/****************************************************************************
+ * Name: aio_pool_initialize
+ *
+ * Description:
+ *   Start the pool of dedicated AIO worker threads.  Called once from
+ *   aio_initialize().
+ *
+ * Input Parameters:
+ *   None
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+#if CONFIG_FS_AIO_NTHREADS > 0
+void aio_pool_initialize(void);
+#else
+#  define aio_pool_initialize()
+#endif
+
 /****************************************************************************
  * Name: aio_signal
  *
@@ -98,6 +98,10 @@ void aio_initialize(void)
 
       dq_addlast(&g_aioc_alloc[i].aioc_link, &g_aioc_free);
     }
+
+  /* Start the dedicated worker thread pool (if one is configured) */
+
+  aio_pool_initialize();
 }
 
 /****************************************************************************
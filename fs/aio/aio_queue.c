@@ -24,27 +24,214 @@
 
 #include <nuttx/config.h>
 
+#include <stdbool.h>
 #include <sched.h>
 #include <aio.h>
 #include <assert.h>
 #include <errno.h>
 #include <debug.h>
 
+#include <nuttx/kthread.h>
+#include <nuttx/mutex.h>
+#include <nuttx/semaphore.h>
+#include <nuttx/queue.h>
 #include <nuttx/wqueue.h>
 
 #include "aio/aio.h"
 
 #ifdef CONFIG_FS_AIO
 
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+#if CONFIG_FS_AIO_NTHREADS > 0
+/* This is the list of queued I/O waiting for a worker thread.  The ready
+ * list and the table of active file descriptors are protected by
+ * g_aio_pool_lock; g_aio_pool_sem wakes a worker whenever the ready list
+ * may hold something runnable.
+ */
+
+static dq_queue_t g_aio_pool_ready;
+static mutex_t g_aio_pool_lock = NXMUTEX_INITIALIZER;
+static sem_t g_aio_pool_sem = SEM_INITIALIZER(0);
+
+/* The file descriptor that each worker thread is currently operating on,
+ * or -1 if the worker is idle.  Used to preserve the submission order of
+ * operations on the same file descriptor.
+ */
+
+static int g_aio_pool_active[CONFIG_FS_AIO_NTHREADS];
+
+/* The number of worker threads that have been started; each worker claims
+ * the next slot of g_aio_pool_active as it starts.
+ */
+
+static int g_aio_pool_nthreads;
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: aio_pool_fd_active
+ *
+ * Description:
+ *   Check if some worker thread is currently performing an I/O on the
+ *   file descriptor 'fildes'.  The caller must hold g_aio_pool_lock.
+ *
+ ****************************************************************************/
+
+#if CONFIG_FS_AIO_NTHREADS > 0
+static bool aio_pool_fd_active(int fildes)
+{
+  int i;
+
+  for (i = 0; i < g_aio_pool_nthreads; i++)
+    {
+      if (g_aio_pool_active[i] == fildes)
+        {
+          return true;
+        }
+    }
+
+  return false;
+}
+#endif
+
+/****************************************************************************
+ * Name: aio_pool_thread
+ *
+ * Description:
+ *   One AIO worker thread.  Loops forever performing queued asynchronous
+ *   I/O.  Operations on different file descriptors proceed in parallel on
+ *   different workers; operations on the same file descriptor are
+ *   performed strictly in submission order.
+ *
+ ****************************************************************************/
+
+#if CONFIG_FS_AIO_NTHREADS > 0
+static int aio_pool_thread(int argc, FAR char *argv[])
+{
+  FAR struct aio_container_s *aioc;
+  worker_t worker;
+  int self;
+
+  /* Claim our slot in the table of active file descriptors */
+
+  nxmutex_lock(&g_aio_pool_lock);
+  self = g_aio_pool_nthreads++;
+  DEBUGASSERT(self < CONFIG_FS_AIO_NTHREADS);
+  nxmutex_unlock(&g_aio_pool_lock);
+
+  for (; ; )
+    {
+      /* Wait until the ready list may hold something runnable */
+
+      nxsem_wait_uninterruptible(&g_aio_pool_sem);
+      nxmutex_lock(&g_aio_pool_lock);
+
+      /* Take the oldest queued I/O that does not target a file that
+       * another worker is currently operating on.  Skipping those
+       * entries preserves per-file ordering (later operations on the
+       * same descriptor are, necessarily, behind the busy one) while
+       * still letting independent files proceed in parallel.
+       */
+
+      for (aioc = (FAR struct aio_container_s *)g_aio_pool_ready.head;
+           aioc != NULL;
+           aioc = (FAR struct aio_container_s *)aioc->aioc_qlink.flink)
+        {
+          if (!aio_pool_fd_active(aioc->aioc_aiocbp->aio_fildes))
+            {
+              break;
+            }
+        }
+
+      if (aioc == NULL)
+        {
+          /* Everything queued is ordered behind an I/O that is already
+           * in flight.  The wakeup posted when that I/O completes will
+           * get us going again.
+           */
+
+          nxmutex_unlock(&g_aio_pool_lock);
+          continue;
+        }
+
+      dq_rem(&aioc->aioc_qlink, &g_aio_pool_ready);
+      g_aio_pool_active[self] = aioc->aioc_aiocbp->aio_fildes;
+      worker = aioc->aioc_worker;
+      nxmutex_unlock(&g_aio_pool_lock);
+
+      /* Perform the I/O.  The worker signals the client and releases the
+       * container.
+       */
+
+      worker(aioc);
+
+      /* Mark this worker idle again and wake a peer to re-examine any
+       * queued I/O that we may have been holding back.
+       */
+
+      nxmutex_lock(&g_aio_pool_lock);
+      g_aio_pool_active[self] = -1;
+      if (g_aio_pool_ready.head != NULL)
+        {
+          nxsem_post(&g_aio_pool_sem);
+        }
+
+      nxmutex_unlock(&g_aio_pool_lock);
+    }
+
+  return OK; /* Not reachable */
+}
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: aio_pool_initialize
+ *
+ * Description:
+ *   Start the pool of dedicated AIO worker threads.  Called once from
+ *   aio_initialize().
+ *
+ ****************************************************************************/
+
+#if CONFIG_FS_AIO_NTHREADS > 0
+void aio_pool_initialize(void)
+{
+  int pid;
+  int i;
+
+  for (i = 0; i < CONFIG_FS_AIO_NTHREADS; i++)
+    {
+      g_aio_pool_active[i] = -1;
+    }
+
+  for (i = 0; i < CONFIG_FS_AIO_NTHREADS; i++)
+    {
+      pid = kthread_create("aio", CONFIG_FS_AIO_PRIORITY,
+                           CONFIG_FS_AIO_STACKSIZE, aio_pool_thread, NULL);
+      if (pid < 0)
+        {
+          ferr("ERROR: kthread_create failed: %d\n", pid);
+          break;
+        }
+    }
+}
+#endif
+
 /****************************************************************************
  * Name: aio_queue
  *
  * Description:
- *   Schedule the asynchronous I/O on the low priority work queue
+ *   Schedule the asynchronous I/O on the AIO worker pool or, if no pool
+ *   is configured, on the low priority work queue.
  *
  * Input Parameters:
  *   arg - Worker argument.  In this case, a pointer to an instance of
@@ -58,6 +245,18 @@
 
 int aio_queue(FAR struct aio_container_s *aioc, worker_t worker)
 {
+#if CONFIG_FS_AIO_NTHREADS > 0
+  /* Add the I/O to the pool ready list and wake one worker thread */
+
+  aioc->aioc_worker = worker;
+
+  nxmutex_lock(&g_aio_pool_lock);
+  dq_addlast(&aioc->aioc_qlink, &g_aio_pool_ready);
+  nxmutex_unlock(&g_aio_pool_lock);
+
+  nxsem_post(&g_aio_pool_sem);
+  return OK;
+#else
   int ret;
 
 #ifdef CONFIG_PRIORITY_INHERITANCE
@@ -94,6 +293,52 @@ int aio_queue(FAR struct aio_container_s *aioc, worker_t worker)
   sched_unlock();
 #endif
   return ret;
+#endif /* CONFIG_FS_AIO_NTHREADS > 0 */
+}
+
+/****************************************************************************
+ * Name: aio_queue_cancel
+ *
+ * Description:
+ *   Attempt to remove a queued asynchronous I/O before it is started.
+ *
+ * Input Parameters:
+ *   aioc - Pointer to the AIO control block container
+ *
+ * Returned Value:
+ *   Zero (OK) if the I/O was still queued and has been removed.  A negated
+ *   errno value (-ENOENT) is returned if the I/O has already been started
+ *   and can no longer be canceled.
+ *
+ ****************************************************************************/
+
+int aio_queue_cancel(FAR struct aio_container_s *aioc)
+{
+#if CONFIG_FS_AIO_NTHREADS > 0
+  FAR dq_entry_t *entry;
+  int ret = -ENOENT;
+
+  nxmutex_lock(&g_aio_pool_lock);
+  for (entry = g_aio_pool_ready.head; entry != NULL; entry = entry->flink)
+    {
+      if (entry == &aioc->aioc_qlink)
+        {
+          dq_rem(entry, &g_aio_pool_ready);
+          ret = OK;
+          break;
+        }
+    }
+
+  nxmutex_unlock(&g_aio_pool_lock);
+
+  /* The wakeup posted when this I/O was queued is left pending; a worker
+   * will wake, find nothing runnable, and wait again.
+   */
+
+  return ret;
+#else
+  return work_cancel(LPWORK, &aioc->aioc_work);
+#endif
 }
 
 #endif /* CONFIG_FS_AIO */
@@ -0,0 +1,162 @@
+/****************************************************************************
+ * fs/aio/lio_submit.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <aio.h>
+#include <assert.h>
+#include <debug.h>
+#include <errno.h>
+
+#include "aio.h"
+
+#ifdef CONFIG_FS_AIO
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: lio_submit
+ *
+ * Description:
+ *   Submit a list of asynchronous I/O operations.  This is a non-standard
+ *   interface used by lio_listio():  In PROTECTED and KERNEL builds it
+ *   places the whole submission loop on the kernel side of the boundary so
+ *   that a batch of operations costs a single kernel entry instead of one
+ *   trap per aio_read()/aio_write() call.
+ *
+ *   NULL list entries and LIO_NOP operations are skipped.  Operations that
+ *   cannot be queued have their error reported through the aio_result
+ *   field of the aiocb, exactly as if aio_read() or aio_write() had been
+ *   called directly.
+ *
+ * Input Parameters:
+ *   list - The list of I/O operations to be performed
+ *   nent - The number of elements in the list
+ *
+ * Returned Value:
+ *   On success, the number of operations successfully queued is returned
+ *   (which may be less than 'nent'; the caller must inspect the aio_result
+ *   of each list element).  On failure to process the list at all, -1
+ *   (ERROR) is returned and the errno is set appropriately.
+ *
+ ****************************************************************************/
+
+int lio_submit(FAR struct aiocb * const list[], int nent)
+{
+  FAR struct aiocb *aiocbp;
+  int nqueued;
+  int errcode;
+  int status;
+  int i;
+
+  if (list == NULL || nent < 0)
+    {
+      set_errno(EINVAL);
+      return ERROR;
+    }
+
+  nqueued = 0;
+
+  /* Submit each asynchronous I/O operation in the list, skipping over NULL
+   * entries.
+   */
+
+  for (i = 0; i < nent; i++)
+    {
+      /* Skip over NULL entries */
+
+      aiocbp = list[i];
+      if (aiocbp == NULL)
+        {
+          continue;
+        }
+
+      /* Submit the operation according to its opcode */
+
+      switch (aiocbp->aio_lio_opcode)
+        {
+        case LIO_NOP:
+          {
+            /* Mark the do-nothing operation complete */
+
+            aiocbp->aio_result = OK;
+          }
+          break;
+
+        case LIO_READ:
+        case LIO_WRITE:
+          {
+            if (aiocbp->aio_lio_opcode == LIO_READ)
+              {
+                /* Submit the asynchronous read operation */
+
+                status = aio_read(aiocbp);
+              }
+            else
+              {
+                /* Submit the asynchronous write operation */
+
+                status = aio_write(aiocbp);
+              }
+
+            if (status < 0)
+              {
+                /* Failed to queue the I/O.  Report the error through
+                 * the aiocb.
+                 */
+
+                errcode = get_errno();
+                ferr("ERROR: aio_read/write failed: %d\n", errcode);
+                DEBUGASSERT(errcode > 0);
+                aiocbp->aio_result = -errcode;
+              }
+            else
+              {
+                /* Increment the count of successfully queued operations */
+
+                nqueued++;
+              }
+          }
+          break;
+
+        default:
+          {
+            /* Make the invalid operation complete with an error */
+
+            ferr("ERROR: Unrecognized opcode: %d\n",
+                 aiocbp->aio_lio_opcode);
+            aiocbp->aio_result = -EINVAL;
+          }
+          break;
+        }
+    }
+
+  return nqueued;
+}
+
+#endif /* CONFIG_FS_AIO */
@@ -41,6 +41,8 @@
 #include <nuttx/kmalloc.h>
 #include <nuttx/fs/fs.h>
 #include <nuttx/fs/ioctl.h>
+#include <nuttx/mutex.h>
+#include <nuttx/wqueue.h>
 
 #include "cromfs.h"
 #include "fs_heap.h"
@@ -74,6 +76,33 @@ struct cromfs_file_s
   FAR uint8_t *ff_buffer;                   /* Cached, decompressed data */
 };
 
+#ifdef CONFIG_FS_CROMFS_BLOCK_CACHE
+/* One cached, decompressed block.  The cache is shared by all open files
+ * and all mounted volumes and is kept in MRU-first order.
+ */
+
+struct cromfs_cacheblk_s
+{
+  FAR struct cromfs_cacheblk_s *cb_flink;  /* MRU-first list link */
+  FAR const struct cromfs_volume_s *cb_fs; /* Volume the block belongs to */
+  uint32_t cb_offset;  /* Volume offset of the compressed data */
+  uint16_t cb_ulen;    /* Length of the decompressed data */
+  uint16_t cb_size;    /* Allocated size of cb_data[] */
+  uint8_t  cb_data[1]; /* The decompressed data */
+};
+
+#ifdef CONFIG_FS_CROMFS_READAHEAD
+/* Pending read-ahead decompression */
+
+struct cromfs_readahead_s
+{
+  struct work_s ra_work;                   /* Work queue entry */
+  FAR const struct cromfs_volume_s *ra_fs; /* Volume to read ahead on */
+  FAR const struct lzf_header_s *ra_hdr;   /* Block to decompress */
+};
+#endif
+#endif
+
 /* This is the form of the callback from cromfs_foreach_node(): */
 
 typedef CODE int (*cromfs_foreach_t)(FAR const struct cromfs_volume_s *fs,
@@ -136,6 +165,17 @@ static int      cromfs_find_node(FAR const struct cromfs_volume_s *fs,
                                  FAR struct cromfs_nodeinfo_s *info,
                                  FAR uint32_t *offset);
 
+#ifdef CONFIG_FS_CROMFS_BLOCK_CACHE
+static int      cromfs_blkread(FAR const struct cromfs_volume_s *fs,
+                               FAR const uint8_t *src, uint16_t clen,
+                               uint16_t ulen, unsigned int copyoffs,
+                               unsigned int copysize, FAR uint8_t *dest);
+static void     cromfs_cache_flush(FAR const struct cromfs_volume_s *fs);
+#ifdef CONFIG_FS_CROMFS_READAHEAD
+static void     cromfs_readahead_worker(FAR void *arg);
+#endif
+#endif
+
 /* Common file system methods */
 
 static int      cromfs_open(FAR struct file *filep, FAR const char *relpath,
@@ -226,6 +266,22 @@ const struct mountpt_operations g_cromfs_operations =
 
 extern const struct cromfs_volume_s g_cromfs_image;
 
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_CROMFS_BLOCK_CACHE
+/* The shared cache of decompressed blocks, in MRU-first order */
+
+static FAR struct cromfs_cacheblk_s *g_cromfs_cache;
+static uint8_t g_cromfs_ncached;
+static mutex_t g_cromfs_cachelock = NXMUTEX_INITIALIZER;
+
+#ifdef CONFIG_FS_CROMFS_READAHEAD
+static struct cromfs_readahead_s g_cromfs_readahead;
+#endif
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -724,6 +780,189 @@ static int cromfs_find_node(FAR const struct cromfs_volume_s *fs,
     }
 }
 
+#ifdef CONFIG_FS_CROMFS_BLOCK_CACHE
+/****************************************************************************
+ * Name: cromfs_blkread
+ *
+ * Description:
+ *   Look up the compressed block at 'src' in the shared cache,
+ *   decompressing it into the cache on a miss, and copy 'copysize'
+ *   decompressed bytes starting at 'copyoffs' to 'dest'.  A NULL 'dest'
+ *   only populates the cache (used by read-ahead).
+ *
+ * Returned Value:
+ *   OK on success; -ENOMEM if no cache buffer could be obtained (the
+ *   caller then falls back to its private decompression buffer).
+ *
+ ****************************************************************************/
+
+static int cromfs_blkread(FAR const struct cromfs_volume_s *fs,
+                          FAR const uint8_t *src, uint16_t clen,
+                          uint16_t ulen, unsigned int copyoffs,
+                          unsigned int copysize, FAR uint8_t *dest)
+{
+  FAR struct cromfs_cacheblk_s *cb;
+  FAR struct cromfs_cacheblk_s *prev;
+  uint32_t voloffs;
+
+  voloffs = cromfs_addr2offset(fs, src);
+  nxmutex_lock(&g_cromfs_cachelock);
+
+  /* Search the cache, remembering the predecessor for the MRU move */
+
+  for (prev = NULL, cb = g_cromfs_cache;
+       cb != NULL;
+       prev = cb, cb = cb->cb_flink)
+    {
+      if (cb->cb_fs == fs && cb->cb_offset == voloffs)
+        {
+          break;
+        }
+    }
+
+  if (cb == NULL)
+    {
+      /* Miss.  Re-use the LRU entry if the cache is full, enlarging its
+       * buffer if this volume's block size requires it.
+       */
+
+      if (g_cromfs_ncached >= CONFIG_FS_CROMFS_BLOCK_CACHE_SIZE)
+        {
+          for (prev = NULL, cb = g_cromfs_cache;
+               cb->cb_flink != NULL;
+               prev = cb, cb = cb->cb_flink);
+
+          if (prev != NULL)
+            {
+              prev->cb_flink = NULL;
+            }
+          else
+            {
+              g_cromfs_cache = NULL;
+            }
+
+          g_cromfs_ncached--;
+          if (cb->cb_size < fs->cv_bsize)
+            {
+              fs_heap_free(cb);
+              cb = NULL;
+            }
+        }
+
+      if (cb == NULL)
+        {
+          cb = fs_heap_malloc(sizeof(struct cromfs_cacheblk_s) +
+                              fs->cv_bsize - 1);
+          if (cb == NULL)
+            {
+              nxmutex_unlock(&g_cromfs_cachelock);
+              return -ENOMEM;
+            }
+
+          cb->cb_size = fs->cv_bsize;
+        }
+
+      cb->cb_fs     = fs;
+      cb->cb_offset = voloffs;
+      cb->cb_ulen   = lzf_decompress(src, clen, cb->cb_data, cb->cb_size);
+      cb->cb_flink  = g_cromfs_cache;
+      g_cromfs_cache = cb;
+      g_cromfs_ncached++;
+    }
+  else if (prev != NULL)
+    {
+      /* Hit.  Move the block to the MRU position. */
+
+      prev->cb_flink = cb->cb_flink;
+      cb->cb_flink   = g_cromfs_cache;
+      g_cromfs_cache = cb;
+    }
+
+  DEBUGASSERT(cb->cb_ulen == ulen);
+  if (dest != NULL)
+    {
+      DEBUGASSERT(cb->cb_ulen >= copyoffs + copysize);
+      memcpy(dest, &cb->cb_data[copyoffs], copysize);
+    }
+
+  nxmutex_unlock(&g_cromfs_cachelock);
+  return OK;
+}
+
+/****************************************************************************
+ * Name: cromfs_cache_flush
+ *
+ * Description:
+ *   Drop all cached blocks belonging to the given volume.  Called when
+ *   the volume is unbound.
+ *
+ ****************************************************************************/
+
+static void cromfs_cache_flush(FAR const struct cromfs_volume_s *fs)
+{
+  FAR struct cromfs_cacheblk_s *cb;
+  FAR struct cromfs_cacheblk_s *prev;
+  FAR struct cromfs_cacheblk_s *next;
+
+  nxmutex_lock(&g_cromfs_cachelock);
+  for (prev = NULL, cb = g_cromfs_cache; cb != NULL; cb = next)
+    {
+      next = cb->cb_flink;
+      if (cb->cb_fs == fs)
+        {
+          if (prev != NULL)
+            {
+              prev->cb_flink = next;
+            }
+          else
+            {
+              g_cromfs_cache = next;
+            }
+
+          g_cromfs_ncached--;
+          fs_heap_free(cb);
+        }
+      else
+        {
+          prev = cb;
+        }
+    }
+
+  nxmutex_unlock(&g_cromfs_cachelock);
+}
+
+#ifdef CONFIG_FS_CROMFS_READAHEAD
+/****************************************************************************
+ * Name: cromfs_readahead_worker
+ *
+ * Description:
+ *   Decompress the next block of the file most recently read into the
+ *   shared cache on the low-priority work queue, overlapping the LZ work
+ *   of sequential readers with their processing of the previous block.
+ *
+ ****************************************************************************/
+
+static void cromfs_readahead_worker(FAR void *arg)
+{
+  FAR struct cromfs_readahead_s *ra = arg;
+  FAR const struct lzf_header_s *hdr = ra->ra_hdr;
+
+  if (hdr->lzf_type != LZF_TYPE0_HDR)
+    {
+      FAR const struct lzf_type1_header_s *hdr1 =
+        (FAR const struct lzf_type1_header_s *)hdr;
+      uint16_t ulen = (uint16_t)hdr1->lzf_ulen[0] << 8 |
+                      (uint16_t)hdr1->lzf_ulen[1];
+      uint16_t clen = (uint16_t)hdr1->lzf_clen[0] << 8 |
+                      (uint16_t)hdr1->lzf_clen[1];
+
+      cromfs_blkread(ra->ra_fs, (FAR const uint8_t *)hdr +
+                     LZF_TYPE1_HDR_SIZE, clen, ulen, 0, 0, NULL);
+    }
+}
+#endif
+#endif
+
 /****************************************************************************
  * Name: cromfs_open
  ****************************************************************************/
@@ -979,6 +1218,49 @@ static ssize_t cromfs_read(FAR struct file *filep, FAR char *buffer,
         }
       else
         {
+#ifdef CONFIG_FS_CROMFS_BLOCK_CACHE
+          /* Copy the data out of the shared block cache, decompressing it
+           * there on a miss so that a re-access of the block costs a
+           * memcpy instead of another decompression.
+           */
+
+          copyoffs = (blkoffs >= filep->f_pos) ? 0 : filep->f_pos - blkoffs;
+          DEBUGASSERT(ulen > copyoffs);
+          copysize = ulen - copyoffs;
+
+          if (copysize > remaining)
+            {
+              /* Clip to the size really needed */
+
+              copysize = remaining;
+            }
+
+          src = (FAR const uint8_t *)currhdr + LZF_TYPE1_HDR_SIZE;
+          if (cromfs_blkread(fs, src, clen, ulen, copyoffs, copysize,
+                             dest) < 0)
+            {
+              uint32_t voloffs;
+
+              /* No cache buffer was available; decompress into this
+               * file's private buffer as if the cache were disabled.
+               */
+
+              voloffs = cromfs_addr2offset(fs, src);
+              if (voloffs != ff->ff_offset)
+                {
+                  unsigned int decomplen;
+
+                  decomplen = lzf_decompress(src, clen, ff->ff_buffer,
+                                             fs->cv_bsize);
+
+                  ff->ff_offset = voloffs;
+                  ff->ff_ulen   = decomplen;
+                }
+
+              DEBUGASSERT(ff->ff_ulen >= (copyoffs + copysize));
+              memcpy(dest, &ff->ff_buffer[copyoffs], copysize);
+            }
+#else
           /* If the source of the data is at the beginning of the compressed
            * data buffer and if the uncompressed data would not overrun the
            * buffer, then we can decompress directly into the user buffer.
@@ -1059,6 +1341,7 @@ static ssize_t cromfs_read(FAR struct file *filep, FAR char *buffer,
 
               memcpy(dest, &ff->ff_buffer[copyoffs], copysize);
             }
+#endif /* CONFIG_FS_CROMFS_BLOCK_CACHE */
         }
 
       /* Adjust pointers counts and offset */
@@ -1068,6 +1351,22 @@ static ssize_t cromfs_read(FAR struct file *filep, FAR char *buffer,
       fpos      += copysize;
     }
 
+#ifdef CONFIG_FS_CROMFS_READAHEAD
+  /* Queue decompression of the next block into the shared cache so that
+   * a sequential reader finds it already decompressed.  blkoffs + ulen is
+   * the file offset of the block at nexthdr.
+   */
+
+  if ((blkoffs + ulen) < ff->ff_node->cn_size &&
+      work_available(&g_cromfs_readahead.ra_work))
+    {
+      g_cromfs_readahead.ra_fs  = fs;
+      g_cromfs_readahead.ra_hdr = nexthdr;
+      work_queue(LPWORK, &g_cromfs_readahead.ra_work,
+                 cromfs_readahead_worker, &g_cromfs_readahead, 0);
+    }
+#endif
+
   /* Update the file pointer */
 
   filep->f_pos = fpos;
@@ -1451,6 +1750,14 @@ static int cromfs_unbind(FAR void *handle, FAR struct inode **blkdriver,
 {
   finfo("handle: %p blkdriver: %p flags: %02x\n",
         handle, blkdriver, flags);
+
+#ifdef CONFIG_FS_CROMFS_BLOCK_CACHE
+#ifdef CONFIG_FS_CROMFS_READAHEAD
+  work_cancel_sync(LPWORK, &g_cromfs_readahead.ra_work);
+#endif
+  cromfs_cache_flush(handle);
+#endif
+
   return OK;
 }
 
@@ -100,6 +100,47 @@ int register_partition_with_inode(FAR const char *partition,
 int block_proxy(FAR struct file *filep, FAR const char *blkdev, int oflags);
 #endif
 
+/****************************************************************************
+ * Name: block_cache_wrap
+ *
+ * Description:
+ *   Interpose a sector cache between a mountpoint file system and the
+ *   block driver 'blkdriver'.  On success, the caller's reference to
+ *   'blkdriver' is taken over by the cache and an anonymous block driver
+ *   inode implementing the cache is returned instead.  On failure the
+ *   original inode is returned unchanged so that the mount proceeds
+ *   uncached.
+ *
+ * Input Parameters:
+ *   blkdriver  - The open block driver inode to wrap
+ *   mountflags - The flags passed to mount()
+ *
+ * Returned Value:
+ *   The inode to bind the file system to.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_BLOCKCACHE
+FAR struct inode *block_cache_wrap(FAR struct inode *blkdriver,
+                                   unsigned long mountflags);
+#endif
+
+/****************************************************************************
+ * Name: block_cache_unwrap
+ *
+ * Description:
+ *   Undo block_cache_wrap() when the mount fails before the file system
+ *   took ownership of the inode.  Returns the original block driver inode
+ *   with the caller's reference, or NULL if the file system already
+ *   closed the device.  Inodes that are not cache wrappers pass through
+ *   unchanged.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_BLOCKCACHE
+FAR struct inode *block_cache_unwrap(FAR struct inode *inode);
+#endif
+
 /****************************************************************************
  * Name: register_partition_with_mtd
  *
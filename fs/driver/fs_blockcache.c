@@ -0,0 +1,876 @@
+/****************************************************************************
+ * fs/driver/fs_blockcache.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <debug.h>
+#include <sys/mount.h>
+
+#include <nuttx/clock.h>
+#include <nuttx/fs/fs.h>
+#include <nuttx/fs/ioctl.h>
+#include <nuttx/mutex.h>
+#include <nuttx/wqueue.h>
+
+#include "driver/driver.h"
+#include "inode/inode.h"
+#include "fs_heap.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define BCACHE_NPAGES      CONFIG_FS_BLOCKCACHE_NPAGES
+#define BCACHE_INVALID     ((off_t)-1)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* One cache page holding a run of contiguous sectors.  'first' is the
+ * device sector number of the first sector in the page (always a multiple
+ * of the sectors-per-page) or BCACHE_INVALID if the page is empty.
+ */
+
+struct bcache_page_s
+{
+  off_t first;               /* First sector held, or BCACHE_INVALID */
+  uint32_t stamp;            /* LRU stamp of the last access */
+  bool dirty;                /* Page contains unwritten data */
+  FAR uint8_t *data;         /* Page buffer */
+};
+
+/* The cache state bound to one mounted volume.  The structure is the
+ * i_private of an anonymous block driver inode which is interposed
+ * between the mountpoint file system and the real block driver.
+ */
+
+struct bcache_dev_s
+{
+  FAR struct inode *parent;  /* The real block driver */
+  mutex_t lock;              /* Serializes cache state and parent I/O */
+  struct work_s work;        /* Delayed write-back work */
+  uint16_t sectorsize;       /* Parent sector size in bytes */
+  uint16_t sectsperpage;     /* Sectors held by one cache page */
+  off_t nsectors;            /* Parent device size in sectors */
+  uint32_t stamp;            /* LRU clock */
+  uint8_t opencount;         /* References from open() */
+  struct bcache_page_s pages[BCACHE_NPAGES];
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+static int     bcache_open(FAR struct inode *inode);
+static int     bcache_close(FAR struct inode *inode);
+static ssize_t bcache_read(FAR struct inode *inode,
+                           FAR unsigned char *buffer,
+                           blkcnt_t start_sector, unsigned int nsectors);
+static ssize_t bcache_write(FAR struct inode *inode,
+                            FAR const unsigned char *buffer,
+                            blkcnt_t start_sector, unsigned int nsectors);
+static int     bcache_geometry(FAR struct inode *inode,
+                               FAR struct geometry *geometry);
+static int     bcache_ioctl(FAR struct inode *inode, int cmd,
+                            unsigned long arg);
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const struct block_operations g_bcache_bops =
+{
+  bcache_open,     /* open     */
+  bcache_close,    /* close    */
+  bcache_read,     /* read     */
+  bcache_write,    /* write    */
+  bcache_geometry, /* geometry */
+  bcache_ioctl     /* ioctl    */
+#ifndef CONFIG_DISABLE_PSEUDOFS_OPERATIONS
+  , NULL           /* unlink   */
+#endif
+};
+
+/* Used when the parent driver (or the mount) is read-only so that the
+ * file system sees no write method, exactly as it would from the real
+ * driver.
+ */
+
+static const struct block_operations g_bcache_robops =
+{
+  bcache_open,     /* open     */
+  bcache_close,    /* close    */
+  bcache_read,     /* read     */
+  NULL,            /* write    */
+  bcache_geometry, /* geometry */
+  bcache_ioctl     /* ioctl    */
+#ifndef CONFIG_DISABLE_PSEUDOFS_OPERATIONS
+  , NULL           /* unlink   */
+#endif
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: bcache_flushpage
+ *
+ * Description:
+ *   Write one dirty page back to the parent driver.  The cache lock must
+ *   be held.
+ *
+ ****************************************************************************/
+
+static int bcache_flushpage(FAR struct bcache_dev_s *dev,
+                            FAR struct bcache_page_s *page)
+{
+  FAR struct inode *parent = dev->parent;
+  unsigned int nsectors = dev->sectsperpage;
+  ssize_t nwritten;
+
+  if (!page->dirty)
+    {
+      return OK;
+    }
+
+  /* The last page of the device may be short */
+
+  if (page->first + nsectors > dev->nsectors)
+    {
+      nsectors = dev->nsectors - page->first;
+    }
+
+  nwritten = parent->u.i_bops->write(parent, page->data, page->first,
+                                     nsectors);
+  if (nwritten < 0)
+    {
+      ferr("ERROR: Write-back of sector %jd failed: %zd\n",
+           (intmax_t)page->first, nwritten);
+      return (int)nwritten;
+    }
+
+  page->dirty = false;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: bcache_flushall
+ *
+ * Description:
+ *   Write all dirty pages back to the parent driver.  The cache lock must
+ *   be held.
+ *
+ ****************************************************************************/
+
+static int bcache_flushall(FAR struct bcache_dev_s *dev)
+{
+  int ret = OK;
+  int i;
+
+  for (i = 0; i < BCACHE_NPAGES; i++)
+    {
+      if (dev->pages[i].first != BCACHE_INVALID)
+        {
+          int status = bcache_flushpage(dev, &dev->pages[i]);
+          if (status < 0)
+            {
+              ret = status;
+            }
+        }
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: bcache_flushwork
+ *
+ * Description:
+ *   Delayed work entry point for write-back of dirty pages.
+ *
+ ****************************************************************************/
+
+static void bcache_flushwork(FAR void *arg)
+{
+  FAR struct bcache_dev_s *dev = arg;
+
+  nxmutex_lock(&dev->lock);
+  bcache_flushall(dev);
+  nxmutex_unlock(&dev->lock);
+}
+
+/****************************************************************************
+ * Name: bcache_markdirty
+ *
+ * Description:
+ *   Mark a page dirty and make sure that the delayed write-back is
+ *   scheduled.  The cache lock must be held.
+ *
+ ****************************************************************************/
+
+static void bcache_markdirty(FAR struct bcache_dev_s *dev,
+                             FAR struct bcache_page_s *page)
+{
+  page->dirty = true;
+
+  if (work_available(&dev->work))
+    {
+      work_queue(LPWORK, &dev->work, bcache_flushwork, dev,
+                 MSEC2TICK(CONFIG_FS_BLOCKCACHE_FLUSH_DELAY));
+    }
+}
+
+/****************************************************************************
+ * Name: bcache_findpage
+ *
+ * Description:
+ *   Return the page holding 'first', or NULL.  The cache lock must be
+ *   held.
+ *
+ ****************************************************************************/
+
+static FAR struct bcache_page_s *
+bcache_findpage(FAR struct bcache_dev_s *dev, off_t first)
+{
+  int i;
+
+  for (i = 0; i < BCACHE_NPAGES; i++)
+    {
+      if (dev->pages[i].first == first)
+        {
+          dev->pages[i].stamp = ++dev->stamp;
+          return &dev->pages[i];
+        }
+    }
+
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: bcache_victim
+ *
+ * Description:
+ *   Claim a page for 'first', evicting the least recently used page (with
+ *   write-back if it is dirty).  The page contents are NOT loaded.  The
+ *   cache lock must be held.
+ *
+ ****************************************************************************/
+
+static FAR struct bcache_page_s *
+bcache_victim(FAR struct bcache_dev_s *dev, off_t first)
+{
+  FAR struct bcache_page_s *victim = &dev->pages[0];
+  int ret;
+  int i;
+
+  for (i = 1; i < BCACHE_NPAGES; i++)
+    {
+      if (victim->first == BCACHE_INVALID)
+        {
+          break;
+        }
+
+      if (dev->pages[i].first == BCACHE_INVALID ||
+          dev->pages[i].stamp < victim->stamp)
+        {
+          victim = &dev->pages[i];
+        }
+    }
+
+  if (victim->first != BCACHE_INVALID && victim->dirty)
+    {
+      ret = bcache_flushpage(dev, victim);
+      if (ret < 0)
+        {
+          return NULL;
+        }
+    }
+
+  victim->first = first;
+  victim->dirty = false;
+  victim->stamp = ++dev->stamp;
+  return victim;
+}
+
+/****************************************************************************
+ * Name: bcache_loadpage
+ *
+ * Description:
+ *   Claim a page for 'first' and fill it from the parent driver.  The
+ *   cache lock must be held.
+ *
+ ****************************************************************************/
+
+static FAR struct bcache_page_s *
+bcache_loadpage(FAR struct bcache_dev_s *dev, off_t first)
+{
+  FAR struct inode *parent = dev->parent;
+  FAR struct bcache_page_s *page;
+  unsigned int nsectors = dev->sectsperpage;
+  ssize_t nread;
+
+  page = bcache_victim(dev, first);
+  if (page == NULL)
+    {
+      return NULL;
+    }
+
+  if (first + nsectors > dev->nsectors)
+    {
+      nsectors = dev->nsectors - first;
+    }
+
+  nread = parent->u.i_bops->read(parent, page->data, first, nsectors);
+  if (nread < 0)
+    {
+      page->first = BCACHE_INVALID;
+      return NULL;
+    }
+
+  return page;
+}
+
+/****************************************************************************
+ * Name: bcache_discard
+ *
+ * Description:
+ *   Drop (without write-back) all pages overlapping the sector range.
+ *   The cache lock must be held.
+ *
+ ****************************************************************************/
+
+static void bcache_discard(FAR struct bcache_dev_s *dev, off_t start,
+                           off_t end)
+{
+  int i;
+
+  for (i = 0; i < BCACHE_NPAGES; i++)
+    {
+      FAR struct bcache_page_s *page = &dev->pages[i];
+
+      if (page->first != BCACHE_INVALID &&
+          page->first < end && page->first + dev->sectsperpage > start)
+        {
+          page->first = BCACHE_INVALID;
+          page->dirty = false;
+        }
+    }
+}
+
+/****************************************************************************
+ * Name: bcache_flushrange
+ *
+ * Description:
+ *   Write back all dirty pages overlapping the sector range.  The cache
+ *   lock must be held.
+ *
+ ****************************************************************************/
+
+static int bcache_flushrange(FAR struct bcache_dev_s *dev, off_t start,
+                             off_t end)
+{
+  int ret = OK;
+  int i;
+
+  for (i = 0; i < BCACHE_NPAGES; i++)
+    {
+      FAR struct bcache_page_s *page = &dev->pages[i];
+
+      if (page->first != BCACHE_INVALID && page->dirty &&
+          page->first < end && page->first + dev->sectsperpage > start)
+        {
+          int status = bcache_flushpage(dev, page);
+          if (status < 0)
+            {
+              ret = status;
+            }
+        }
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: bcache_teardown
+ *
+ * Description:
+ *   Flush the cache, stop the write-back work and detach from the parent
+ *   driver.  Called on the last close and on block_cache_unwrap().
+ *
+ ****************************************************************************/
+
+static void bcache_teardown(FAR struct inode *inode)
+{
+  FAR struct bcache_dev_s *dev = inode->i_private;
+  int i;
+
+  work_cancel_sync(LPWORK, &dev->work);
+
+  nxmutex_lock(&dev->lock);
+  bcache_flushall(dev);
+  nxmutex_unlock(&dev->lock);
+
+  inode_release(dev->parent);
+  nxmutex_destroy(&dev->lock);
+
+  for (i = 0; i < BCACHE_NPAGES; i++)
+    {
+      fs_heap_free(dev->pages[i].data);
+    }
+
+  fs_heap_free(dev);
+  inode->i_private = NULL;
+}
+
+/****************************************************************************
+ * Name: bcache_open
+ *
+ * Description: Open the block device
+ *
+ ****************************************************************************/
+
+static int bcache_open(FAR struct inode *inode)
+{
+  FAR struct bcache_dev_s *dev = inode->i_private;
+  FAR struct inode *parent = dev->parent;
+  int ret = OK;
+
+  if (parent->u.i_bops->open != NULL)
+    {
+      ret = parent->u.i_bops->open(parent);
+    }
+
+  if (ret >= 0)
+    {
+      dev->opencount++;
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: bcache_close
+ *
+ * Description:
+ *   Close the block device.  On the last close, the cache is flushed and
+ *   all resources are released:  the mounted file system closes the
+ *   device exactly once, from its unbind method, and the interposed inode
+ *   itself is freed by the umount logic right afterwards.
+ *
+ ****************************************************************************/
+
+static int bcache_close(FAR struct inode *inode)
+{
+  FAR struct bcache_dev_s *dev = inode->i_private;
+  FAR struct inode *parent = dev->parent;
+  int ret = OK;
+
+  nxmutex_lock(&dev->lock);
+  bcache_flushall(dev);
+  nxmutex_unlock(&dev->lock);
+
+  if (parent->u.i_bops->close != NULL)
+    {
+      ret = parent->u.i_bops->close(parent);
+    }
+
+  if (--dev->opencount == 0)
+    {
+      bcache_teardown(inode);
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: bcache_read
+ *
+ * Description:  Read the specified number of sectors
+ *
+ ****************************************************************************/
+
+static ssize_t bcache_read(FAR struct inode *inode,
+                           FAR unsigned char *buffer,
+                           blkcnt_t start_sector, unsigned int nsectors)
+{
+  FAR struct bcache_dev_s *dev = inode->i_private;
+  FAR struct inode *parent = dev->parent;
+  unsigned int remaining = nsectors;
+  off_t sector = start_sector;
+  ssize_t ret = nsectors;
+
+  nxmutex_lock(&dev->lock);
+
+  /* Requests of at least one full page gain nothing from the cache; pass
+   * them through after making any dirty overlap visible to the driver.
+   */
+
+  if (nsectors >= dev->sectsperpage)
+    {
+      ret = bcache_flushrange(dev, sector, sector + nsectors);
+      if (ret >= 0)
+        {
+          ret = parent->u.i_bops->read(parent, buffer, start_sector,
+                                       nsectors);
+        }
+
+      nxmutex_unlock(&dev->lock);
+      return ret;
+    }
+
+  while (remaining > 0)
+    {
+      FAR struct bcache_page_s *page;
+      off_t first = sector - (sector % dev->sectsperpage);
+      unsigned int offset = sector - first;
+      unsigned int count = dev->sectsperpage - offset;
+
+      if (count > remaining)
+        {
+          count = remaining;
+        }
+
+      page = bcache_findpage(dev, first);
+      if (page == NULL)
+        {
+          page = bcache_loadpage(dev, first);
+          if (page == NULL)
+            {
+              ret = -EIO;
+              break;
+            }
+        }
+
+      memcpy(buffer, &page->data[offset * dev->sectorsize],
+             count * dev->sectorsize);
+
+      buffer    += count * dev->sectorsize;
+      sector    += count;
+      remaining -= count;
+    }
+
+  nxmutex_unlock(&dev->lock);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: bcache_write
+ *
+ * Description: Write (or buffer) the specified number of sectors
+ *
+ ****************************************************************************/
+
+static ssize_t bcache_write(FAR struct inode *inode,
+                            FAR const unsigned char *buffer,
+                            blkcnt_t start_sector, unsigned int nsectors)
+{
+  FAR struct bcache_dev_s *dev = inode->i_private;
+  FAR struct inode *parent = dev->parent;
+  unsigned int remaining = nsectors;
+  off_t sector = start_sector;
+  ssize_t ret = nsectors;
+
+  nxmutex_lock(&dev->lock);
+
+  /* Large writes go straight to the driver.  Dirty sectors outside the
+   * written range must be flushed first; everything overlapping is then
+   * stale and dropped.
+   */
+
+  if (nsectors >= dev->sectsperpage)
+    {
+      ret = bcache_flushrange(dev, sector, sector + nsectors);
+      if (ret >= 0)
+        {
+          bcache_discard(dev, sector, sector + nsectors);
+          ret = parent->u.i_bops->write(parent, buffer, start_sector,
+                                        nsectors);
+        }
+
+      nxmutex_unlock(&dev->lock);
+      return ret;
+    }
+
+  while (remaining > 0)
+    {
+      FAR struct bcache_page_s *page;
+      off_t first = sector - (sector % dev->sectsperpage);
+      unsigned int offset = sector - first;
+      unsigned int count = dev->sectsperpage - offset;
+
+      if (count > remaining)
+        {
+          count = remaining;
+        }
+
+      page = bcache_findpage(dev, first);
+      if (page == NULL)
+        {
+          /* A page that will be completely overwritten need not be read */
+
+          if (offset == 0 && count == dev->sectsperpage)
+            {
+              page = bcache_victim(dev, first);
+            }
+          else
+            {
+              page = bcache_loadpage(dev, first);
+            }
+
+          if (page == NULL)
+            {
+              ret = -EIO;
+              break;
+            }
+        }
+
+      memcpy(&page->data[offset * dev->sectorsize], buffer,
+             count * dev->sectorsize);
+      bcache_markdirty(dev, page);
+
+      buffer    += count * dev->sectorsize;
+      sector    += count;
+      remaining -= count;
+    }
+
+  nxmutex_unlock(&dev->lock);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: bcache_geometry
+ *
+ * Description: Return device geometry
+ *
+ ****************************************************************************/
+
+static int bcache_geometry(FAR struct inode *inode,
+                           FAR struct geometry *geometry)
+{
+  FAR struct bcache_dev_s *dev = inode->i_private;
+  FAR struct inode *parent = dev->parent;
+
+  return parent->u.i_bops->geometry(parent, geometry);
+}
+
+/****************************************************************************
+ * Name: bcache_ioctl
+ *
+ * Description: Forward ioctls to the parent driver
+ *
+ ****************************************************************************/
+
+static int bcache_ioctl(FAR struct inode *inode, int cmd, unsigned long arg)
+{
+  FAR struct bcache_dev_s *dev = inode->i_private;
+  FAR struct inode *parent = dev->parent;
+  int ret = -ENOTTY;
+
+  /* Ioctls may bypass the sector read/write interface (erase, low level
+   * format, direct memory access...).  Make the cache coherent:  push out
+   * dirty data first and reload everything afterwards.
+   */
+
+  nxmutex_lock(&dev->lock);
+  ret = bcache_flushall(dev);
+  if (ret >= 0)
+    {
+      bcache_discard(dev, 0, dev->nsectors);
+
+      if (parent->u.i_bops->ioctl != NULL)
+        {
+          ret = parent->u.i_bops->ioctl(parent, cmd, arg);
+        }
+      else
+        {
+          ret = -ENOTTY;
+        }
+
+      /* The cache itself satisfies a flush request */
+
+      if (ret == -ENOTTY && cmd == BIOC_FLUSH)
+        {
+          ret = OK;
+        }
+    }
+
+  nxmutex_unlock(&dev->lock);
+  return ret;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: block_cache_wrap
+ *
+ * Description:
+ *   Interpose a sector cache between a mountpoint file system and the
+ *   block driver 'blkdriver'.  On success, the caller's reference to
+ *   'blkdriver' is taken over by the cache and an anonymous block driver
+ *   inode implementing the cache is returned instead; it can be used
+ *   (and released) exactly like the original driver inode.  On failure
+ *   the original inode is returned unchanged so that the mount simply
+ *   proceeds uncached.
+ *
+ * Input Parameters:
+ *   blkdriver  - The open block driver inode to wrap
+ *   mountflags - The flags passed to mount(); MS_RDONLY disables the
+ *                write path
+ *
+ * Returned Value:
+ *   The inode to bind the file system to:  either the new cache inode or
+ *   'blkdriver' itself if the cache could not be created.
+ *
+ ****************************************************************************/
+
+FAR struct inode *block_cache_wrap(FAR struct inode *blkdriver,
+                                   unsigned long mountflags)
+{
+  FAR struct bcache_dev_s *dev;
+  FAR struct inode *inode;
+  struct geometry geo;
+  size_t pagebytes;
+  int ret;
+  int i;
+
+  /* The geometry gives the sector size that fixes the page layout */
+
+  if (blkdriver->u.i_bops->geometry == NULL)
+    {
+      return blkdriver;
+    }
+
+  ret = blkdriver->u.i_bops->geometry(blkdriver, &geo);
+  if (ret < 0 || geo.geo_sectorsize == 0 || geo.geo_sectorsize > UINT16_MAX)
+    {
+      return blkdriver;
+    }
+
+  dev = fs_heap_zalloc(sizeof(*dev));
+  if (dev == NULL)
+    {
+      return blkdriver;
+    }
+
+  dev->sectorsize   = geo.geo_sectorsize;
+  dev->nsectors     = geo.geo_nsectors;
+  dev->sectsperpage = CONFIG_FS_BLOCKCACHE_PAGESIZE / geo.geo_sectorsize;
+  if (dev->sectsperpage < 1)
+    {
+      dev->sectsperpage = 1;
+    }
+
+  pagebytes = (size_t)dev->sectsperpage * dev->sectorsize;
+
+  for (i = 0; i < BCACHE_NPAGES; i++)
+    {
+      dev->pages[i].first = BCACHE_INVALID;
+      dev->pages[i].data  = fs_heap_malloc(pagebytes);
+      if (dev->pages[i].data == NULL)
+        {
+          goto errout_with_pages;
+        }
+    }
+
+  /* Create the anonymous inode fronting the cache.  It is freed by
+   * inode_release() when the umount logic drops the last reference.
+   */
+
+  inode = fs_heap_zalloc(FSNODE_SIZE(0));
+  if (inode == NULL)
+    {
+      goto errout_with_pages;
+    }
+
+  atomic_init(&inode->i_crefs, 1);
+  INODE_SET_BLOCK(inode);
+
+  if ((mountflags & MS_RDONLY) != 0 || blkdriver->u.i_bops->write == NULL)
+    {
+      inode->u.i_bops = &g_bcache_robops;
+    }
+  else
+    {
+      inode->u.i_bops = &g_bcache_bops;
+    }
+
+  nxmutex_init(&dev->lock);
+  dev->parent      = blkdriver;
+  inode->i_private = dev;
+
+  finfo("Caching %s: %d pages of %zu bytes\n",
+        blkdriver->i_name, BCACHE_NPAGES, pagebytes);
+  return inode;
+
+errout_with_pages:
+  for (i = 0; i < BCACHE_NPAGES; i++)
+    {
+      fs_heap_free(dev->pages[i].data);
+    }
+
+  fs_heap_free(dev);
+  return blkdriver;
+}
+
+/****************************************************************************
+ * Name: block_cache_unwrap
+ *
+ * Description:
+ *   Undo block_cache_wrap() when the mount fails before the file system
+ *   took ownership of the inode.  Returns the original block driver inode
+ *   with the caller's reference, or NULL if the file system already
+ *   closed the device (in which case the reference was consumed by the
+ *   close).  Inodes that are not cache wrappers pass through unchanged.
+ *
+ ****************************************************************************/
+
+FAR struct inode *block_cache_unwrap(FAR struct inode *inode)
+{
+  FAR struct bcache_dev_s *dev;
+  FAR struct inode *parent = NULL;
+
+  if (inode == NULL || (inode->u.i_bops != &g_bcache_bops &&
+                        inode->u.i_bops != &g_bcache_robops))
+    {
+      return inode;
+    }
+
+  dev = inode->i_private;
+  if (dev != NULL)
+    {
+      parent = dev->parent;
+      inode_addref(parent);
+      bcache_teardown(inode);
+    }
+
+  inode_release(inode);
+  return parent;
+}
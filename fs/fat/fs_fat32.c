@@ -588,6 +588,13 @@ static int fat_get_sectors(FAR struct file *filep, bool read)
   int zero_end;
   int clu_size = fs->fs_fatsecperclus * fs->fs_hwsectorsize;
 
+#ifdef CONFIG_FAT_EXTENTS
+  int target;
+  uint32_t cluno;
+  uint32_t physclu;
+  uint32_t contig;
+#endif
+
   num_clu = DIV_ROUND_UP(ff->ff_size, clu_size);
   new_num_clu = DIV_ROUND_UP(filep->f_pos + 1, clu_size);
 
@@ -615,6 +622,27 @@ static int fat_get_sectors(FAR struct file *filep, bool read)
       num_traversed = 1;
     }
 
+#ifdef CONFIG_FAT_EXTENTS
+  /* The extent map may know a cluster closer to the target than the one
+   * remembered in ff_currentcluster, letting us skip most (or all) of the
+   * FAT walk below.
+   */
+
+  if (ff->ff_startcluster != 0)
+    {
+      fat_extent_add(ff, 0, ff->ff_startcluster);
+
+      target = (num_clu < new_num_clu ? num_clu : new_num_clu) - 1;
+      if (target >= num_traversed &&
+          fat_extent_seek(ff, target, &cluno, &physclu) == OK &&
+          (int)cluno >= num_traversed)
+        {
+          cluster       = physclu;
+          num_traversed = cluno + 1;
+        }
+    }
+#endif
+
   /* Traverse the existing chain */
 
   for (i = num_traversed; i < num_clu && i < new_num_clu; i++)
@@ -627,6 +655,10 @@ static int fat_get_sectors(FAR struct file *filep, bool read)
         {
           return -EIO;
         }
+
+#ifdef CONFIG_FAT_EXTENTS
+      fat_extent_add(ff, i, cluster);
+#endif
     }
 
   if (read)
@@ -679,6 +711,10 @@ static int fat_get_sectors(FAR struct file *filep, bool read)
           return -EIO;
         }
 
+#ifdef CONFIG_FAT_EXTENTS
+      fat_extent_add(ff, i, cluster);
+#endif
+
       /* zero area (2) */
 
       ret = fat_zero_cluster(fs, cluster, 0, clu_size);
@@ -702,6 +738,10 @@ static int fat_get_sectors(FAR struct file *filep, bool read)
           return -EIO;
         }
 
+#ifdef CONFIG_FAT_EXTENTS
+      fat_extent_add(ff, i, cluster);
+#endif
+
       /* zero area (3) */
 
       zero_end = filep->f_pos & (clu_size -1);
@@ -734,6 +774,32 @@ out:
       return ret;
     }
 
+#ifdef CONFIG_FAT_EXTENTS
+  /* If the clusters that follow are known to be physically contiguous,
+   * present the whole run as one oversized cluster so that the direct
+   * read path issues a single large transfer to the driver.  The write
+   * path extends the chain cluster by cluster, so only reads may span
+   * cluster boundaries.
+   */
+
+  if (read && ff->ff_startcluster != 0)
+    {
+      contig = fat_extent_contig(ff, filep->f_pos / clu_size,
+                                 ff->ff_currentcluster);
+      if (contig > 0)
+        {
+          if (contig > UINT16_MAX)
+            {
+              contig = UINT16_MAX;
+            }
+
+          contig = contig * fs->fs_fatsecperclus + ff->ff_sectorsincluster;
+          ff->ff_sectorsincluster = contig > UINT16_MAX ?
+                                    UINT16_MAX : contig;
+        }
+    }
+#endif
+
   ff->ff_pos = ROUND_DOWN(filep->f_pos, clu_size);
 
   return 0;
@@ -1595,6 +1661,12 @@ static int fat_dup(FAR const struct file *oldp, FAR struct file *newp)
   newff->ff_currentsector    = oldff->ff_currentsector;    /* Current sector */
   newff->ff_cachesector      = 0;                          /* Sector in file buffer */
 
+#ifdef CONFIG_FAT_EXTENTS
+  newff->ff_nextents         = oldff->ff_nextents;         /* Cluster extent map */
+  memcpy(newff->ff_extents, oldff->ff_extents,
+         oldff->ff_nextents * sizeof(struct fat_extent_s));
+#endif
+
   /* Attach the private date to the struct file instance */
 
   newp->f_priv = newff;
@@ -1929,9 +2001,11 @@ static int fat_truncate(FAR struct file *filep, off_t length)
       if (ret >= 0)
         {
           /* The truncation has completed without error.  Update the file
-           * size.
+           * size and forget any extents that may refer to the freed part
+           * of the cluster chain.
            */
 
+          fat_extent_reset(ff);
           ff->ff_size = length;
           ret = OK;
         }
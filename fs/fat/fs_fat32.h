@@ -891,6 +891,20 @@ struct fat_mountpt_s
                                     * sector from the device */
 };
 
+/* One run of physically contiguous clusters discovered while traversing
+ * the FAT chain of an open file.  'fe_cluno' is the file relative cluster
+ * index (0 is the first cluster of the file) of the cluster 'fe_start'.
+ */
+
+#ifdef CONFIG_FAT_EXTENTS
+struct fat_extent_s
+{
+  uint32_t fe_cluno;               /* File relative index of the first cluster */
+  uint32_t fe_start;               /* First physical cluster of the run */
+  uint32_t fe_count;               /* Length of the run in clusters */
+};
+#endif
+
 /* This structure represents on open file under the mountpoint.  An instance
  * of this structure is retained as struct file specific information on each
  * opened file.
@@ -901,7 +915,9 @@ struct fat_file_s
   FAR struct fat_file_s *ff_next;  /* Retained in a singly linked list */
   uint8_t  ff_bflags;              /* The file buffer/mount flags */
   uint8_t  ff_oflags;              /* Flags provided when file was opened */
-  uint8_t  ff_sectorsincluster;    /* Sectors remaining in cluster */
+  uint16_t ff_sectorsincluster;    /* Sectors remaining in cluster (or in a
+                                    * contiguous run of clusters when the
+                                    * extent map is enabled) */
   uint16_t ff_dirindex;            /* Index into ff_dirsector to directory entry */
   uint32_t ff_currentcluster;      /* Current cluster being accessed */
   off_t    ff_dirsector;           /* Sector containing the directory entry */
@@ -911,6 +927,10 @@ struct fat_file_s
   off_t    ff_cachesector;         /* Current sector in the file buffer */
   off_t    ff_pos;                 /* Current position in the file */
   uint8_t *ff_buffer;              /* File buffer (for partial sector accesses) */
+#ifdef CONFIG_FAT_EXTENTS
+  uint8_t  ff_nextents;            /* Number of valid entries in ff_extents */
+  struct fat_extent_s ff_extents[CONFIG_FAT_EXTENTS_SIZE];
+#endif
 };
 
 /* This structure holds the sequence of directory entries used by one
@@ -1053,6 +1073,21 @@ EXTERN int32_t fat_extendchain(FAR struct fat_mountpt_s *fs,
 
 #define fat_createchain(fs) fat_extendchain(fs, 0)
 
+/* Cluster extent map helpers */
+
+#ifdef CONFIG_FAT_EXTENTS
+EXTERN void   fat_extent_add(FAR struct fat_file_s *ff, uint32_t cluno,
+                             uint32_t cluster);
+EXTERN int    fat_extent_seek(FAR struct fat_file_s *ff, uint32_t target,
+                              FAR uint32_t *cluno, FAR uint32_t *cluster);
+EXTERN uint32_t fat_extent_contig(FAR struct fat_file_s *ff, uint32_t cluno,
+                                  uint32_t cluster);
+
+#  define fat_extent_reset(ff) ((ff)->ff_nextents = 0)
+#else
+#  define fat_extent_reset(ff)
+#endif
+
 /* Help for traversing directory trees and accessing directory entries */
 
 EXTERN int    fat_nextdirentry(FAR struct fat_mountpt_s *fs,
@@ -2199,3 +2199,138 @@ int fat_currentsector(struct fat_mountpt_s *fs, struct fat_file_s *ff,
 
   return -ENOSPC;
 }
+
+/****************************************************************************
+ * Name: fat_extent_add
+ *
+ * Description:
+ *   Record in the extent map of the open file that the file relative
+ *   cluster index 'cluno' is stored in the physical cluster 'cluster'.
+ *   Adjacent contiguous clusters coalesce into a single extent; once the
+ *   map is full, additional fragments are simply not remembered.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FAT_EXTENTS
+void fat_extent_add(FAR struct fat_file_s *ff, uint32_t cluno,
+                    uint32_t cluster)
+{
+  FAR struct fat_extent_s *fe;
+  int i;
+
+  for (i = 0; i < ff->ff_nextents; i++)
+    {
+      fe = &ff->ff_extents[i];
+
+      /* Already covered by this extent? */
+
+      if (cluno >= fe->fe_cluno && cluno - fe->fe_cluno < fe->fe_count)
+        {
+          return;
+        }
+
+      /* Does this cluster extend the extent by one? */
+
+      if (cluno == fe->fe_cluno + fe->fe_count &&
+          cluster == fe->fe_start + fe->fe_count)
+        {
+          fe->fe_count++;
+          return;
+        }
+    }
+
+  /* Start a new extent (if there is room for one) */
+
+  if (ff->ff_nextents < CONFIG_FAT_EXTENTS_SIZE)
+    {
+      fe           = &ff->ff_extents[ff->ff_nextents++];
+      fe->fe_cluno = cluno;
+      fe->fe_start = cluster;
+      fe->fe_count = 1;
+    }
+}
+#endif
+
+/****************************************************************************
+ * Name: fat_extent_seek
+ *
+ * Description:
+ *   Find the remembered cluster closest to (but not beyond) the file
+ *   relative cluster index 'target'.
+ *
+ * Returned Value:
+ *   OK with 'cluno'/'cluster' set to the best file relative index and its
+ *   physical cluster if any extent covers an index at or below 'target';
+ *   -ENOENT if the map holds nothing useful.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FAT_EXTENTS
+int fat_extent_seek(FAR struct fat_file_s *ff, uint32_t target,
+                    FAR uint32_t *cluno, FAR uint32_t *cluster)
+{
+  FAR struct fat_extent_s *fe;
+  uint32_t reach;
+  int best = -1;
+  int i;
+
+  for (i = 0; i < ff->ff_nextents; i++)
+    {
+      fe = &ff->ff_extents[i];
+      if (fe->fe_cluno > target)
+        {
+          continue;
+        }
+
+      /* The highest index covered by this extent that does not pass the
+       * target.
+       */
+
+      reach = fe->fe_cluno + fe->fe_count - 1;
+      if (reach > target)
+        {
+          reach = target;
+        }
+
+      if (best < 0 || reach > *cluno)
+        {
+          best     = i;
+          *cluno   = reach;
+          *cluster = fe->fe_start + (reach - fe->fe_cluno);
+        }
+    }
+
+  return best < 0 ? -ENOENT : OK;
+}
+#endif
+
+/****************************************************************************
+ * Name: fat_extent_contig
+ *
+ * Description:
+ *   Return the number of physically contiguous clusters that are known to
+ *   follow the file relative cluster index 'cluno' (stored in the physical
+ *   cluster 'cluster'), or zero if the map holds no such information.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FAT_EXTENTS
+uint32_t fat_extent_contig(FAR struct fat_file_s *ff, uint32_t cluno,
+                           uint32_t cluster)
+{
+  FAR struct fat_extent_s *fe;
+  int i;
+
+  for (i = 0; i < ff->ff_nextents; i++)
+    {
+      fe = &ff->ff_extents[i];
+      if (cluno >= fe->fe_cluno && cluno - fe->fe_cluno < fe->fe_count &&
+          cluster == fe->fe_start + (cluno - fe->fe_cluno))
+        {
+          return fe->fe_cluno + fe->fe_count - 1 - cluno;
+        }
+    }
+
+  return 0;
+}
+#endif
@@ -236,6 +236,97 @@ static void hostfs_mkpath(FAR struct hostfs_mountpt_s  *fs,
     }
 }
 
+#if defined(CONFIG_FS_HOSTFS_READBUFFER) || defined(CONFIG_FS_HOSTFS_WRITEBUFFER)
+/****************************************************************************
+ * Name: hostfs_hostread
+ *
+ * Description: Position the host file at the given offset and read.  With
+ *   batched I/O the host file position no longer tracks f_pos, so every
+ *   host transfer seeks explicitly.
+ *
+ ****************************************************************************/
+
+static ssize_t hostfs_hostread(FAR struct hostfs_ofile_s *hf, off_t offset,
+                               FAR void *buffer, size_t buflen)
+{
+  off_t pos;
+
+  pos = host_lseek(hf->fd, offset, offset, SEEK_SET);
+  if (pos < 0)
+    {
+      return (ssize_t)pos;
+    }
+
+  return host_read(hf->fd, buffer, buflen);
+}
+
+/****************************************************************************
+ * Name: hostfs_hostwrite
+ *
+ * Description: Position the host file at the given offset and write.
+ *
+ ****************************************************************************/
+
+static ssize_t hostfs_hostwrite(FAR struct hostfs_ofile_s *hf, off_t offset,
+                                FAR const void *buffer, size_t buflen)
+{
+  off_t pos;
+
+  pos = host_lseek(hf->fd, offset, offset, SEEK_SET);
+  if (pos < 0)
+    {
+      return (ssize_t)pos;
+    }
+
+  return host_write(hf->fd, buffer, buflen);
+}
+#endif
+
+#ifdef CONFIG_FS_HOSTFS_WRITEBUFFER
+/****************************************************************************
+ * Name: hostfs_flushwrite
+ *
+ * Description: Pass any gathered, unsent write data to the host.  The
+ *   buffer is emptied even on failure; the caller sees the error but the
+ *   data cannot be retried.
+ *
+ ****************************************************************************/
+
+static int hostfs_flushwrite(FAR struct hostfs_ofile_s *hf)
+{
+  FAR uint8_t *src;
+  off_t        offset;
+  size_t       remaining;
+  ssize_t      written;
+
+  src       = hf->wrbuffer;
+  offset    = hf->wroffset;
+  remaining = hf->wrbytes;
+
+  hf->wrbytes = 0;
+
+  while (remaining > 0)
+    {
+      written = hostfs_hostwrite(hf, offset, src, remaining);
+      if (written < 0)
+        {
+          return (int)written;
+        }
+
+      if (written == 0)
+        {
+          return -EIO;
+        }
+
+      src       += written;
+      offset    += written;
+      remaining -= written;
+    }
+
+  return OK;
+}
+#endif
+
 /****************************************************************************
  * Name: hostfs_open
  ****************************************************************************/
@@ -317,6 +408,41 @@ static int hostfs_open(FAR struct file *filep, FAR const char *relpath,
 
   filep->f_priv = hf;
 
+#ifdef CONFIG_FS_HOSTFS_READBUFFER
+  hf->rdbuffer = NULL;
+  hf->rdvalid  = 0;
+#endif
+
+#ifdef CONFIG_FS_HOSTFS_WRITEBUFFER
+  hf->wrbuffer = NULL;
+  hf->wrbytes  = 0;
+#endif
+
+#ifdef CONFIG_FS_HOSTFS_MMAP
+  /* Try to map read-only regular files into our address space so that
+   * reads need no host call at all.  If the mapping fails, reads simply
+   * fall back to host_read().
+   */
+
+  hf->map    = NULL;
+  hf->maplen = 0;
+
+  if ((oflags & O_WROK) == 0)
+    {
+      struct stat buf;
+
+      if (host_fstat(hf->fd, &buf) == OK &&
+          S_ISREG(buf.st_mode) && buf.st_size > 0)
+        {
+          hf->map = host_mmap(hf->fd, buf.st_size);
+          if (hf->map != NULL)
+            {
+              hf->maplen = buf.st_size;
+            }
+        }
+    }
+#endif
+
   /* Then insert the new instance into the mountpoint structure.
    * It needs to be there (1) to handle error conditions that effect
    * all files, and (2) to inform the umount logic that we are busy
@@ -376,6 +502,12 @@ static int hostfs_close(FAR struct file *filep)
       return ret;
     }
 
+#ifdef CONFIG_FS_HOSTFS_WRITEBUFFER
+  /* Push any gathered write data to the host before the file goes away */
+
+  hostfs_flushwrite(hf);
+#endif
+
   /* Check if we are the last one with a reference to the file and
    * only close if we are.
    */
@@ -420,6 +552,29 @@ static int hostfs_close(FAR struct file *filep)
         }
     }
 
+#ifdef CONFIG_FS_HOSTFS_MMAP
+  /* Release the host mapping */
+
+  if (hf->map != NULL)
+    {
+      host_munmap(hf->map, hf->maplen);
+    }
+#endif
+
+#ifdef CONFIG_FS_HOSTFS_READBUFFER
+  if (hf->rdbuffer != NULL)
+    {
+      fs_heap_free(hf->rdbuffer);
+    }
+#endif
+
+#ifdef CONFIG_FS_HOSTFS_WRITEBUFFER
+  if (hf->wrbuffer != NULL)
+    {
+      fs_heap_free(hf->wrbuffer);
+    }
+#endif
+
   /* Close the host file */
 
   host_close(hf->fd);
@@ -466,6 +621,135 @@ static ssize_t hostfs_read(FAR struct file *filep, FAR char *buffer,
       return ret;
     }
 
+#ifdef CONFIG_FS_HOSTFS_WRITEBUFFER
+  /* Gathered, unsent writes must be visible to reads of the file */
+
+  ret = hostfs_flushwrite(hf);
+  if (ret < 0)
+    {
+      goto errout_with_lock;
+    }
+#endif
+
+#ifdef CONFIG_FS_HOSTFS_MMAP
+  /* Serve the read with a memory copy from the host mapping.  The mapping
+   * length was fixed at open time; it is the end of file.
+   */
+
+  if (hf->map != NULL)
+    {
+      if (filep->f_pos >= (off_t)hf->maplen)
+        {
+          ret = 0;
+        }
+      else
+        {
+          ret = hf->maplen - filep->f_pos;
+          if (ret > buflen)
+            {
+              ret = buflen;
+            }
+
+          memcpy(buffer, (FAR uint8_t *)hf->map + filep->f_pos, ret);
+          filep->f_pos += ret;
+        }
+
+      goto errout_with_lock;
+    }
+#endif
+
+#if defined(CONFIG_FS_HOSTFS_READBUFFER)
+  /* Loop, serving the read from the batched read buffer and refilling it
+   * with one large host read on a miss.
+   */
+
+  ret = 0;
+  while (ret < buflen)
+    {
+      ssize_t nread;
+
+      /* Allocate the read buffer on first use.  If the allocation fails,
+       * reads simply bypass the buffer.
+       */
+
+      if (hf->rdbuffer == NULL)
+        {
+          hf->rdbuffer = fs_heap_malloc(CONFIG_FS_HOSTFS_READBUFFER_SIZE);
+        }
+
+      if (hf->rdvalid > 0 && filep->f_pos >= hf->rdoffset &&
+          filep->f_pos < hf->rdoffset + (off_t)hf->rdvalid)
+        {
+          size_t skew   = filep->f_pos - hf->rdoffset;
+          size_t nbytes = hf->rdvalid - skew;
+
+          if (nbytes > buflen - ret)
+            {
+              nbytes = buflen - ret;
+            }
+
+          memcpy(&buffer[ret], &hf->rdbuffer[skew], nbytes);
+          filep->f_pos += nbytes;
+          ret          += nbytes;
+          continue;
+        }
+
+      /* On a miss, refill the buffer when the remaining request is small;
+       * larger requests go directly to the user buffer.
+       */
+
+      if (hf->rdbuffer != NULL &&
+          buflen - ret < CONFIG_FS_HOSTFS_READBUFFER_SIZE)
+        {
+          nread = hostfs_hostread(hf, filep->f_pos, hf->rdbuffer,
+                                  CONFIG_FS_HOSTFS_READBUFFER_SIZE);
+          if (nread < 0)
+            {
+              if (ret == 0)
+                {
+                  ret = nread;
+                }
+
+              break;
+            }
+
+          hf->rdoffset = filep->f_pos;
+          hf->rdvalid  = nread;
+
+          if (nread == 0)
+            {
+              break;
+            }
+
+          continue;
+        }
+
+      nread = hostfs_hostread(hf, filep->f_pos, &buffer[ret],
+                              buflen - ret);
+      if (nread < 0)
+        {
+          if (ret == 0)
+            {
+              ret = nread;
+            }
+        }
+      else if (nread > 0)
+        {
+          filep->f_pos += nread;
+          ret          += nread;
+        }
+
+      break;
+    }
+#elif defined(CONFIG_FS_HOSTFS_WRITEBUFFER)
+  /* Flushing may have moved the host file position; seek explicitly */
+
+  ret = hostfs_hostread(hf, filep->f_pos, buffer, buflen);
+  if (ret > 0)
+    {
+      filep->f_pos += ret;
+    }
+#else
   /* Call the host to perform the read */
 
   ret = host_read(hf->fd, buffer, buflen);
@@ -473,7 +757,11 @@ static ssize_t hostfs_read(FAR struct file *filep, FAR char *buffer,
     {
       filep->f_pos += ret;
     }
+#endif
 
+#if defined(CONFIG_FS_HOSTFS_WRITEBUFFER) || defined(CONFIG_FS_HOSTFS_MMAP)
+errout_with_lock:
+#endif
   nxmutex_unlock(&g_lock);
   return ret;
 }
@@ -518,6 +806,117 @@ static ssize_t hostfs_write(FAR struct file *filep, const char *buffer,
       goto errout_with_lock;
     }
 
+#ifdef CONFIG_FS_HOSTFS_READBUFFER
+  /* The write makes any buffered read data potentially stale */
+
+  hf->rdvalid = 0;
+#endif
+
+#if defined(CONFIG_FS_HOSTFS_WRITEBUFFER)
+  /* Gather the data; it is passed to the host when the buffer fills */
+
+  ret = 0;
+  while (ret < buflen)
+    {
+      size_t  chunk = buflen - ret;
+      ssize_t nwritten;
+      int     flushret;
+
+      /* Allocate the write buffer on first use.  If the allocation fails,
+       * writes simply bypass the buffer.
+       */
+
+      if (hf->wrbuffer == NULL)
+        {
+          hf->wrbuffer = fs_heap_malloc(CONFIG_FS_HOSTFS_WRITEBUFFER_SIZE);
+        }
+
+      /* A write that is not contiguous with the gathered data forces the
+       * gathered data out first.
+       */
+
+      if (hf->wrbytes > 0 &&
+          filep->f_pos != hf->wroffset + (off_t)hf->wrbytes)
+        {
+          flushret = hostfs_flushwrite(hf);
+          if (flushret < 0)
+            {
+              if (ret == 0)
+                {
+                  ret = flushret;
+                }
+
+              break;
+            }
+        }
+
+      if (hf->wrbuffer == NULL ||
+          (hf->wrbytes == 0 &&
+           chunk >= CONFIG_FS_HOSTFS_WRITEBUFFER_SIZE))
+        {
+          /* Full-sized (or unbufferable) writes go straight to the host */
+
+          nwritten = hostfs_hostwrite(hf, filep->f_pos, &buffer[ret],
+                                      chunk);
+          if (nwritten <= 0)
+            {
+              if (ret == 0)
+                {
+                  ret = nwritten;
+                }
+
+              break;
+            }
+        }
+      else
+        {
+          if (hf->wrbytes == 0)
+            {
+              hf->wroffset = filep->f_pos;
+            }
+
+          nwritten = CONFIG_FS_HOSTFS_WRITEBUFFER_SIZE - hf->wrbytes;
+          if (nwritten > chunk)
+            {
+              nwritten = chunk;
+            }
+
+          memcpy(&hf->wrbuffer[hf->wrbytes], &buffer[ret], nwritten);
+          hf->wrbytes += nwritten;
+        }
+
+      filep->f_pos += nwritten;
+      ret          += nwritten;
+
+      /* Flush as soon as the buffer fills so that errors surface close to
+       * the write that caused them.
+       */
+
+      if (hf->wrbytes >= CONFIG_FS_HOSTFS_WRITEBUFFER_SIZE)
+        {
+          flushret = hostfs_flushwrite(hf);
+          if (flushret < 0)
+            {
+              if (ret == 0)
+                {
+                  ret = flushret;
+                }
+
+              break;
+            }
+        }
+    }
+#elif defined(CONFIG_FS_HOSTFS_READBUFFER)
+  /* Buffered reads may have moved the host file position; seek
+   * explicitly.
+   */
+
+  ret = hostfs_hostwrite(hf, filep->f_pos, buffer, buflen);
+  if (ret > 0)
+    {
+      filep->f_pos += ret;
+    }
+#else
   /* Call the host to perform the write */
 
   ret = host_write(hf->fd, buffer, buflen);
@@ -525,6 +924,7 @@ static ssize_t hostfs_write(FAR struct file *filep, const char *buffer,
     {
       filep->f_pos += ret;
     }
+#endif
 
 errout_with_lock:
   nxmutex_unlock(&g_lock);
@@ -562,6 +962,19 @@ static off_t hostfs_seek(FAR struct file *filep, off_t offset, int whence)
       return ret;
     }
 
+#ifdef CONFIG_FS_HOSTFS_WRITEBUFFER
+  /* Gathered writes may extend the file; push them out so that SEEK_END
+   * resolves against the true size.
+   */
+
+  ret = hostfs_flushwrite(hf);
+  if (ret < 0)
+    {
+      nxmutex_unlock(&g_lock);
+      return ret;
+    }
+#endif
+
   /* Call our internal routine to perform the seek */
 
   ret = host_lseek(hf->fd, filep->f_pos, offset, whence);
@@ -667,6 +1080,17 @@ static int hostfs_sync(FAR struct file *filep)
       return ret;
     }
 
+#ifdef CONFIG_FS_HOSTFS_WRITEBUFFER
+  /* Push any gathered write data to the host first */
+
+  ret = hostfs_flushwrite(hf);
+  if (ret < 0)
+    {
+      nxmutex_unlock(&g_lock);
+      return ret;
+    }
+#endif
+
   host_sync(hf->fd);
 
   nxmutex_unlock(&g_lock);
@@ -741,6 +1165,19 @@ static int hostfs_fstat(FAR const struct file *filep, FAR struct stat *buf)
       return ret;
     }
 
+#ifdef CONFIG_FS_HOSTFS_WRITEBUFFER
+  /* Gathered writes may extend the file; push them out so that the
+   * reported size is current.
+   */
+
+  ret = hostfs_flushwrite(hf);
+  if (ret < 0)
+    {
+      nxmutex_unlock(&g_lock);
+      return ret;
+    }
+#endif
+
   /* Call the host to perform the read */
 
   ret = host_fstat(hf->fd, buf);
@@ -828,6 +1265,23 @@ static int hostfs_ftruncate(FAR struct file *filep, off_t length)
       return ret;
     }
 
+#ifdef CONFIG_FS_HOSTFS_WRITEBUFFER
+  /* Gathered writes must reach the host before the size change */
+
+  ret = hostfs_flushwrite(hf);
+  if (ret < 0)
+    {
+      nxmutex_unlock(&g_lock);
+      return ret;
+    }
+#endif
+
+#ifdef CONFIG_FS_HOSTFS_READBUFFER
+  /* The size change invalidates any buffered read data */
+
+  hf->rdvalid = 0;
+#endif
+
   /* Call the host to perform the truncate */
 
   ret = host_ftruncate(hf->fd, length);
@@ -51,6 +51,20 @@ struct hostfs_ofile_s
   int16_t                   crefs;   /* Reference count */
   mode_t                    oflags;  /* Open mode */
   int                       fd;
+#ifdef CONFIG_FS_HOSTFS_READBUFFER
+  FAR uint8_t              *rdbuffer; /* Batched read buffer */
+  off_t                     rdoffset; /* File offset of first buffered byte */
+  size_t                    rdvalid;  /* Valid bytes in the buffer (0=empty) */
+#endif
+#ifdef CONFIG_FS_HOSTFS_WRITEBUFFER
+  FAR uint8_t              *wrbuffer; /* Batched write buffer */
+  off_t                     wroffset; /* File offset of first gathered byte */
+  size_t                    wrbytes;  /* Gathered, unsent bytes (0=empty) */
+#endif
+#ifdef CONFIG_FS_HOSTFS_MMAP
+  FAR void                 *map;      /* Read-only host mapping (or NULL) */
+  size_t                    maplen;   /* Length of the mapping in bytes */
+#endif
   char                      relpath[1];
 };
 
@@ -68,6 +68,62 @@ static FAR struct file *files_fget_by_index(FAR struct filelist *list,
 {
   FAR struct file *filep;
   irqstate_t flags;
+#ifdef CONFIG_FS_REFCOUNT
+  int refs;
+#endif
+
+  if (new == NULL)
+    {
+      /* Lock-free fast path for the lookup case (read/write/poll...).
+       * The caller has verified the index against fl_rows.  Make sure
+       * that a row count published by a concurrent files_extend() is
+       * not paired with the previous, shorter fl_files array:
+       * files_extend() stores fl_files before fl_rows with a barrier
+       * in between, and replaced arrays stay valid until the list is
+       * released (see fl_retired), so the snapshot taken here is
+       * always safe to index.
+       */
+
+      SP_DMB();
+
+      filep = &list->fl_files[l1][l2];
+#ifdef CONFIG_FS_REFCOUNT
+
+      /* Grab a reference only if the descriptor is still open:  a zero
+       * count means the slot is free or the last close is in progress.
+       */
+
+      refs = atomic_load(&filep->f_refs);
+
+      do
+        {
+          if (refs == 0)
+            {
+              return NULL;
+            }
+        }
+      while (!atomic_compare_exchange_weak(&filep->f_refs, &refs,
+                                           refs + 1));
+
+      /* The slot may hold a reserved but not yet opened file (e.g. the
+       * target of an in-flight dup3).  Such descriptors are not visible
+       * to lookups; drop the reference we just took.
+       */
+
+      if (filep->f_inode == NULL)
+        {
+          fs_putfilep(filep);
+          filep = NULL;
+        }
+#else
+      if (filep->f_inode == NULL)
+        {
+          filep = NULL;
+        }
+#endif
+
+      return filep;
+    }
 
   flags = spin_lock_irqsave(NULL);
 
@@ -79,33 +135,24 @@ static FAR struct file *files_fget_by_index(FAR struct filelist *list,
        * released, At this point we should return a null pointer
        */
 
-      if (filep->f_refs == 0)
+      if (atomic_load(&filep->f_refs) == 0)
         {
           filep = NULL;
         }
       else
         {
-          filep->f_refs++;
+          atomic_fetch_add(&filep->f_refs, 1);
         }
     }
-  else if (new == NULL)
-    {
-      filep = NULL;
-    }
-  else if (filep->f_refs)
+  else if (atomic_load(&filep->f_refs))
     {
-      filep->f_refs++;
+      atomic_fetch_add(&filep->f_refs, 1);
     }
   else
     {
-      filep->f_refs = 2;
+      atomic_store(&filep->f_refs, 2);
       *new = true;
     }
-#else
-  if (filep->f_inode == NULL && new == NULL)
-    {
-      filep = NULL;
-    }
 #endif
 
   spin_unlock_irqrestore(NULL, flags);
@@ -137,13 +184,21 @@ static int files_extend(FAR struct filelist *list, size_t row)
       return -EMFILE;
     }
 
-  files = fs_heap_malloc(sizeof(FAR struct file *) * row);
+  /* Allocate one extra leading slot.  If this array is later replaced by
+   * a further extension it cannot be freed while lock-free readers may
+   * still hold a pointer to it; the hidden slot is then used to chain the
+   * array onto list->fl_retired until the whole list is released.
+   */
+
+  files = fs_heap_malloc(sizeof(FAR struct file *) * (row + 1));
   DEBUGASSERT(files);
   if (files == NULL)
     {
       return -ENFILE;
     }
 
+  files++;
+
   i = orig_rows;
   do
     {
@@ -156,7 +211,7 @@ static int files_extend(FAR struct filelist *list, size_t row)
               fs_heap_free(files[i]);
             }
 
-          fs_heap_free(files);
+          fs_heap_free(files - 1);
           return -ENFILE;
         }
     }
@@ -178,7 +233,7 @@ static int files_extend(FAR struct filelist *list, size_t row)
           fs_heap_free(files[j]);
         }
 
-      fs_heap_free(files);
+      fs_heap_free(files - 1);
 
       return OK;
     }
@@ -191,15 +246,27 @@ static int files_extend(FAR struct filelist *list, size_t row)
 
   tmp = list->fl_files;
   list->fl_files = files;
+
+  /* Publish the new array before the new row count so that a lock-free
+   * reader which observes the larger fl_rows can never index the old,
+   * shorter array.
+   */
+
+  SP_DMB();
   list->fl_rows = row;
 
-  spin_unlock_irqrestore(NULL, flags);
+  /* The replaced array may still be in use by concurrent lock-free
+   * readers.  Retire it; it is freed with the list in files_putlist().
+   */
 
   if (tmp != NULL && tmp != &list->fl_prefile)
     {
-      fs_heap_free(tmp);
+      ((FAR void **)tmp)[-1] = list->fl_retired;
+      list->fl_retired = tmp;
     }
 
+  spin_unlock_irqrestore(NULL, flags);
+
   return OK;
 }
 
@@ -368,6 +435,7 @@ void files_initlist(FAR struct filelist *list)
   list->fl_crefs = 1;
   list->fl_files = &list->fl_prefile;
   list->fl_prefile = list->fl_prefiles;
+  list->fl_retired = NULL;
 }
 
 /****************************************************************************
@@ -504,7 +572,19 @@ void files_putlist(FAR struct filelist *list)
 
   if (list->fl_files != &list->fl_prefile)
     {
-      fs_heap_free(list->fl_files);
+      fs_heap_free(list->fl_files - 1);
+    }
+
+  /* Free the top level arrays retired by files_extend().  No readers can
+   * reference them any longer since the list itself is going away.
+   */
+
+  while (list->fl_retired != NULL)
+    {
+      FAR void *next = ((FAR void **)list->fl_retired)[-1];
+
+      fs_heap_free((FAR void **)list->fl_retired - 1);
+      list->fl_retired = next;
     }
 }
 
@@ -608,7 +688,7 @@ int file_allocate_from_tcb(FAR struct tcb_s *tcb, FAR struct inode *inode,
               filep->f_inode       = inode;
               filep->f_priv        = priv;
 #ifdef CONFIG_FS_REFCOUNT
-              filep->f_refs        = 1;
+              atomic_store(&filep->f_refs, 1);
 #endif
 #ifdef CONFIG_FDSAN
               filep->f_tag_fdsan   = 0;
@@ -838,12 +918,8 @@ void fs_reffilep(FAR struct file *filep)
 {
   /* This interface is used to increase the reference count of filep */
 
-  irqstate_t flags;
-
   DEBUGASSERT(filep);
-  flags = spin_lock_irqsave(NULL);
-  filep->f_refs++;
-  spin_unlock_irqrestore(NULL, flags);
+  atomic_fetch_add(&filep->f_refs, 1);
 }
 
 /****************************************************************************
@@ -860,16 +936,12 @@ void fs_reffilep(FAR struct file *filep)
 
 int fs_putfilep(FAR struct file *filep)
 {
-  irqstate_t flags;
   int ret = 0;
   int refs;
 
   DEBUGASSERT(filep);
-  flags = spin_lock_irqsave(NULL);
-
-  refs = --filep->f_refs;
 
-  spin_unlock_irqrestore(NULL, flags);
+  refs = atomic_fetch_sub(&filep->f_refs, 1) - 1;
 
   /* If refs is zero, the close() had called, closing it now. */
 
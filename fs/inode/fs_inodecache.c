@@ -0,0 +1,243 @@
+/****************************************************************************
+ * fs/inode/fs_inodecache.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <string.h>
+
+#include <nuttx/fs/fs.h>
+#include <nuttx/spinlock.h>
+
+#include "inode/inode.h"
+#include "fs_heap.h"
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* One cached inode_search() result.  'path' is a private copy of the full,
+ * absolute search path.  The output pointers of the search descriptor are
+ * reproduced literally; 'path_ofs' and 'relpath_ofs' locate the residual
+ * path and the mountpoint relative path within the caller's path string
+ * (they are always suffixes of the search path when an entry is cached).
+ * A negative 'relpath_ofs' means that no relative path was returned.
+ *
+ * The entry is valid only while 'generation' matches the global counter:
+ * any mutation of the inode tree makes all older entries stale.  Stale
+ * inode pointers are never dereferenced; the entry is simply replaced.
+ */
+
+struct inode_cache_entry_s
+{
+  FAR char *path;            /* Copy of the search path (cache key) */
+  FAR struct inode *node;    /* Result: the inode found (NULL on failure) */
+  FAR struct inode *peer;    /* Result: node to the "left" */
+  FAR struct inode *parent;  /* Result: node "above" */
+  uint32_t generation;       /* Tree generation when the entry was filled */
+  int16_t path_ofs;          /* Offset of the residual path */
+  int16_t relpath_ofs;       /* Offset of relpath, or -1 */
+  int result;                /* Return value of inode_search() */
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* A small, direct mapped cache:  each path hashes to exactly one slot and
+ * collisions simply replace the previous occupant.
+ */
+
+static struct inode_cache_entry_s g_path_cache[CONFIG_FS_PATHCACHE_SIZE];
+static spinlock_t g_path_cache_lock = SP_UNLOCKED;
+
+/* Bumped (under the inode tree write lock) whenever a node is inserted
+ * into or unlinked from the tree.  Lookups run under at least the read
+ * lock, so the counter is never read while it is being modified.
+ */
+
+static uint32_t g_path_cache_gen;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: inode_cache_hash
+ *
+ * Description:
+ *   Map a path string onto a cache slot index.
+ *
+ ****************************************************************************/
+
+static unsigned int inode_cache_hash(FAR const char *path)
+{
+  unsigned int hash = 5381;
+
+  while (*path != '\0')
+    {
+      hash = ((hash << 5) + hash) ^ (unsigned char)*path++;
+    }
+
+  return hash % CONFIG_FS_PATHCACHE_SIZE;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: inode_cache_lookup
+ *
+ * Description:
+ *   Try to satisfy inode_search() from the path cache.  The path in 'desc'
+ *   must be absolute.  On a hit, all output fields of the descriptor are
+ *   filled in exactly as the full search would have and the saved result
+ *   of the search is returned in 'result'.
+ *
+ * Returned Value:
+ *   True if the descriptor was completed from the cache.
+ *
+ * Assumptions:
+ *   The caller holds the inode tree lock (read or write).
+ *
+ ****************************************************************************/
+
+bool inode_cache_lookup(FAR struct inode_search_s *desc, FAR int *result)
+{
+  FAR struct inode_cache_entry_s *entry;
+  FAR const char *path = desc->path;
+  irqstate_t flags;
+  bool hit = false;
+
+  entry = &g_path_cache[inode_cache_hash(path)];
+
+  flags = spin_lock_irqsave(&g_path_cache_lock);
+  if (entry->path != NULL && entry->generation == g_path_cache_gen &&
+      strcmp(entry->path, path) == 0)
+    {
+      desc->node    = entry->node;
+      desc->peer    = entry->peer;
+      desc->parent  = entry->parent;
+      desc->path    = path + entry->path_ofs;
+      desc->relpath = entry->relpath_ofs < 0 ? NULL :
+                      path + entry->relpath_ofs;
+      *result       = entry->result;
+      hit           = true;
+    }
+
+  spin_unlock_irqrestore(&g_path_cache_lock, flags);
+  return hit;
+}
+
+/****************************************************************************
+ * Name: inode_cache_insert
+ *
+ * Description:
+ *   Remember the outcome of a completed inode_search().  'path' is the
+ *   full absolute path that the search started from; 'desc' holds the
+ *   search outputs and 'result' the value that inode_search() will return.
+ *   Results that cannot be reproduced from the original path string (the
+ *   search followed a symbolic link and rewrote the path) and terminal
+ *   symbolic links (whose resolution depends on the nofollow flag) must
+ *   not be passed here; inode_search() filters them out.
+ *
+ * Assumptions:
+ *   The caller holds the inode tree lock (read or write).
+ *
+ ****************************************************************************/
+
+void inode_cache_insert(FAR struct inode_search_s *desc,
+                        FAR const char *path, int result)
+{
+  FAR struct inode_cache_entry_s *entry;
+  FAR char *oldpath;
+  FAR char *newpath;
+  irqstate_t flags;
+  size_t len = strlen(path);
+
+  /* The residual path (and relpath, when returned) must be suffixes of
+   * the original path string so that they can be rebuilt by offset on a
+   * later hit.
+   */
+
+  if (len > INT16_MAX || desc->path < path || desc->path > path + len)
+    {
+      return;
+    }
+
+  if (desc->relpath != NULL &&
+      (desc->relpath < path || desc->relpath > path + len))
+    {
+      return;
+    }
+
+  newpath = fs_heap_malloc(len + 1);
+  if (newpath == NULL)
+    {
+      return;
+    }
+
+  memcpy(newpath, path, len + 1);
+
+  entry = &g_path_cache[inode_cache_hash(path)];
+
+  flags = spin_lock_irqsave(&g_path_cache_lock);
+
+  oldpath            = entry->path;
+  entry->path        = newpath;
+  entry->node        = desc->node;
+  entry->peer        = desc->peer;
+  entry->parent      = desc->parent;
+  entry->generation  = g_path_cache_gen;
+  entry->path_ofs    = desc->path - path;
+  entry->relpath_ofs = desc->relpath != NULL ? desc->relpath - path : -1;
+  entry->result      = result;
+
+  spin_unlock_irqrestore(&g_path_cache_lock, flags);
+
+  if (oldpath != NULL)
+    {
+      fs_heap_free(oldpath);
+    }
+}
+
+/****************************************************************************
+ * Name: inode_cache_invalidate
+ *
+ * Description:
+ *   Drop all cached path lookups.  Called whenever an inode is inserted
+ *   into or unlinked from the pseudo file system tree (this includes
+ *   mount and umount):  any such change can alter the outcome of any
+ *   cached search, including negative ones.
+ *
+ * Assumptions:
+ *   The caller holds the inode tree write lock.
+ *
+ ****************************************************************************/
+
+void inode_cache_invalidate(void)
+{
+  g_path_cache_gen++;
+}
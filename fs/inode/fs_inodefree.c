@@ -74,6 +74,15 @@ void inode_free(FAR struct inode *inode)
         }
 #endif
 
+#ifdef CONFIG_FS_LATENCY
+      /* Free any latency histograms attached to the inode */
+
+      if (inode->i_latency != NULL)
+        {
+          fs_heap_free(inode->i_latency);
+        }
+#endif
+
       fs_heap_free(inode);
     }
 }
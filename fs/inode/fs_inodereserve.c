@@ -127,6 +127,10 @@ static void inode_insert(FAR struct inode *inode,
       inode->i_parent = parent;
       parent->i_child = inode;
     }
+
+  /* The new node may change the outcome of any cached path search */
+
+  inode_cache_invalidate();
 }
 
 /****************************************************************************
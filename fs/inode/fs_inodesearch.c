@@ -465,6 +465,10 @@ static FAR const char *_inode_getcwd(void)
 
 int inode_search(FAR struct inode_search_s *desc)
 {
+#ifdef CONFIG_FS_PATHCACHE
+  FAR const char *abspath;
+  FAR char *obuffer;
+#endif
   int ret;
 
   /* Perform the common _inode_search() logic.  This does everything except
@@ -487,6 +491,23 @@ int inode_search(FAR struct inode_search_s *desc)
       desc->path = desc->buffer;
     }
 
+#ifdef CONFIG_FS_PATHCACHE
+  /* A previous search for the same path may still be valid. */
+
+  if (inode_cache_lookup(desc, &ret))
+    {
+      return ret;
+    }
+
+  /* Remember the full search path so that the result can be cached below.
+   * If the search follows a symbolic link, then desc->buffer is replaced
+   * (and abspath possibly freed); such results are not cacheable.
+   */
+
+  abspath = desc->path;
+  obuffer = desc->buffer;
+#endif
+
   ret = _inode_search(desc);
 
 #ifdef CONFIG_PSEUDOFS_SOFTLINKS
@@ -522,6 +543,26 @@ int inode_search(FAR struct inode_search_s *desc)
     }
 #endif
 
+#ifdef CONFIG_FS_PATHCACHE
+  /* Cache the outcome, including failures:  negative entries make
+   * repeated probing for optional files cheap.  Results are cacheable
+   * only if no symbolic link rewrote the search path (the residual and
+   * relative paths must remain suffixes of the original path; this is
+   * re-verified by offset in inode_cache_insert()) and the terminal node
+   * is not itself a symbolic link, since its resolution depends on the
+   * nofollow flag.
+   */
+
+  if (desc->buffer == obuffer
+#ifdef CONFIG_PSEUDOFS_SOFTLINKS
+      && (ret < 0 || !INODE_IS_SOFTLINK(desc->node))
+#endif
+     )
+    {
+      inode_cache_insert(desc, abspath, ret);
+    }
+#endif
+
   return ret;
 }
 
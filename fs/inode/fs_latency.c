@@ -0,0 +1,104 @@
+/****************************************************************************
+ * fs/inode/fs_latency.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <assert.h>
+
+#include <nuttx/clock.h>
+#include <nuttx/irq.h>
+#include <nuttx/fs/fs.h>
+
+#include "inode/inode.h"
+#include "fs_heap.h"
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: fslat_record
+ *
+ * Description:
+ *   Account for one completed mountpoint operation in the latency
+ *   histograms attached to 'inode'.  The histogram structure is allocated
+ *   on first use; if the allocation fails the sample is silently dropped.
+ *
+ * Input Parameters:
+ *   inode   - The mountpoint inode that performed the operation
+ *   op      - Which operation completed (see enum fslat_op_e)
+ *   elapsed - Duration of the operation in perf counter units
+ *
+ ****************************************************************************/
+
+void fslat_record(FAR struct inode *inode, enum fslat_op_e op,
+                  clock_t elapsed)
+{
+  unsigned int bin;
+
+  DEBUGASSERT(inode != NULL && op < FSLAT_NOPS);
+
+  /* Lazily attach the histogram structure the first time that the
+   * mountpoint is exercised.  Concurrent first operations may race to
+   * install the structure; the loser frees its copy.
+   */
+
+  if (inode->i_latency == NULL)
+    {
+      FAR struct fslatency_s *latency;
+      irqstate_t flags;
+
+      latency = fs_heap_zalloc(sizeof(struct fslatency_s));
+      if (latency == NULL)
+        {
+          return;
+        }
+
+      flags = enter_critical_section();
+      if (inode->i_latency == NULL)
+        {
+          inode->i_latency = latency;
+          latency          = NULL;
+        }
+
+      leave_critical_section(flags);
+
+      if (latency != NULL)
+        {
+          fs_heap_free(latency);
+        }
+    }
+
+  /* Find the log2 bin for the elapsed time and count the operation.  The
+   * increment is not atomic; an occasional lost count is acceptable for
+   * telemetry and much cheaper than locking the hot I/O path.
+   */
+
+  for (bin = 0; elapsed > 1 && bin < FSLAT_NBINS - 1; bin++)
+    {
+      elapsed >>= 1;
+    }
+
+  inode->i_latency->hist[op][bin]++;
+}
@@ -137,6 +137,32 @@ typedef int (*foreach_inode_t)(FAR struct inode *inode,
                                FAR char dirpath[PATH_MAX],
                                FAR void *arg);
 
+#ifdef CONFIG_FS_LATENCY
+/* Mountpoint operations instrumented by the VFS latency logic */
+
+enum fslat_op_e
+{
+  FSLAT_OPEN = 0,            /* Mountpoint open() method */
+  FSLAT_READ,                /* Mountpoint read() method */
+  FSLAT_WRITE,               /* Mountpoint write() method */
+  FSLAT_NOPS                 /* Number of instrumented operations */
+};
+
+/* Number of log2 histogram bins.  Bin n counts operations that completed
+ * in [2^n, 2^(n+1)) units of the perf counter; the last bin also absorbs
+ * everything longer.
+ */
+
+#define FSLAT_NBINS 16
+
+/* Latency histograms lazily attached to a mountpoint inode */
+
+struct fslatency_s
+{
+  uint32_t hist[FSLAT_NOPS][FSLAT_NBINS];
+};
+#endif
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -233,6 +259,60 @@ void inode_runlock(void);
 
 int inode_search(FAR struct inode_search_s *desc);
 
+/****************************************************************************
+ * Name: inode_cache_lookup
+ *
+ * Description:
+ *   Try to satisfy inode_search() from the path lookup cache.  On a hit,
+ *   the output fields of 'desc' are filled in and the saved result of the
+ *   original search is returned in 'result'.
+ *
+ * Returned Value:
+ *   True if the descriptor was completed from the cache.
+ *
+ * Assumptions:
+ *   The caller holds the inode tree lock (read or write).
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_PATHCACHE
+bool inode_cache_lookup(FAR struct inode_search_s *desc, FAR int *result);
+#endif
+
+/****************************************************************************
+ * Name: inode_cache_insert
+ *
+ * Description:
+ *   Remember the outcome of a completed inode_search() for 'path'.
+ *
+ * Assumptions:
+ *   The caller holds the inode tree lock (read or write).
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_PATHCACHE
+void inode_cache_insert(FAR struct inode_search_s *desc,
+                        FAR const char *path, int result);
+#endif
+
+/****************************************************************************
+ * Name: inode_cache_invalidate
+ *
+ * Description:
+ *   Drop all cached path lookups.  Must be called whenever a node is
+ *   inserted into or unlinked from the pseudo file system tree.
+ *
+ * Assumptions:
+ *   The caller holds the inode tree write lock.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_PATHCACHE
+void inode_cache_invalidate(void);
+#else
+#  define inode_cache_invalidate()
+#endif
+
 /****************************************************************************
  * Name: inode_find
  *
@@ -423,6 +503,26 @@ void inode_release(FAR struct inode *inode);
 
 int foreach_inode(foreach_inode_t handler, FAR void *arg);
 
+#ifdef CONFIG_FS_LATENCY
+/****************************************************************************
+ * Name: fslat_record
+ *
+ * Description:
+ *   Account for one completed mountpoint operation in the latency
+ *   histograms attached to 'inode'.  The histogram structure is allocated
+ *   on first use; if the allocation fails the sample is silently dropped.
+ *
+ * Input Parameters:
+ *   inode   - The mountpoint inode that performed the operation
+ *   op      - Which operation completed (see enum fslat_op_e)
+ *   elapsed - Duration of the operation in perf counter units
+ *
+ ****************************************************************************/
+
+void fslat_record(FAR struct inode *inode, enum fslat_op_e op,
+                  clock_t elapsed);
+#endif
+
 /****************************************************************************
  * Name: dir_allocate
  *
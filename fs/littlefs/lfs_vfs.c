@@ -50,6 +50,10 @@
 #  error littlefs requires CONFIG_C99_BOOL to be selected
 #endif
 
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+#  define LITTLEFS_CACHE_INVALID UINT32_MAX
+#endif
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -66,6 +70,17 @@ struct littlefs_file_s
   int                   refs;
 };
 
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+/* One cached device block */
+
+struct littlefs_cache_block_s
+{
+  uint32_t              block;   /* Device block number, or INVALID */
+  uint32_t              age;     /* Generation of last hit, for LRU */
+  FAR uint8_t          *data;    /* Block contents */
+};
+#endif
+
 /* This structure represents the overall mountpoint state. An instance of
  * this structure is retained as inode private data on each mountpoint that
  * is mounted with a littlefs filesystem.
@@ -78,6 +93,15 @@ struct littlefs_mountpt_s
   struct mtd_geometry_s geo;
   struct lfs_config     cfg;
   struct lfs            lfs;
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+  /* Shared device block cache.  Protected by 'lock' like the lfs state
+   * since all littlefs callbacks run with it held.
+   */
+
+  struct littlefs_cache_block_s cache[CONFIG_FS_LITTLEFS_BLOCK_CACHE_BLOCKS];
+  FAR uint8_t          *cache_data;  /* Backing store, NULL if disabled */
+  uint32_t              cache_age;   /* LRU generation counter */
+#endif
 };
 
 /****************************************************************************
@@ -934,38 +958,151 @@ static int littlefs_rewinddir(FAR struct inode *mountpt,
 }
 
 /****************************************************************************
- * Name: littlefs_bind
+ * Name: littlefs_read_device
+ *
+ * Description: Read device blocks directly from the MTD or block driver.
+ *
+ ****************************************************************************/
+
+static int littlefs_read_device(FAR struct littlefs_mountpt_s *fs,
+                                uint32_t block, uint32_t nblocks,
+                                FAR void *buffer)
+{
+  FAR struct inode *drv = fs->drv;
+  int ret;
+
+  if (INODE_IS_MTD(drv))
+    {
+      ret = MTD_BREAD(drv->u.i_mtd, block, nblocks, buffer);
+    }
+  else
+    {
+      ret = drv->u.i_bops->read(drv, buffer, block, nblocks);
+    }
+
+  return ret >= 0 ? OK : ret;
+}
+
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+
+/****************************************************************************
+ * Name: littlefs_cache_readblock
  *
- * Description: This implements a portion of the mount operation. This
- *  function allocates and initializes the mountpoint private data and
- *  binds the driver inode to the filesystem private data. The final
- *  binding of the private data (containing the driver) to the
- *  mountpoint is performed by mount().
+ * Description: Read one device block through the shared LRU cache.  On a
+ *   miss, the least recently used entry is refilled from the device.
  *
  ****************************************************************************/
 
+static int littlefs_cache_readblock(FAR struct littlefs_mountpt_s *fs,
+                                    uint32_t block, FAR uint8_t *dest)
+{
+  FAR struct littlefs_cache_block_s *victim = &fs->cache[0];
+  int ret;
+  int i;
+
+  for (i = 0; i < CONFIG_FS_LITTLEFS_BLOCK_CACHE_BLOCKS; i++)
+    {
+      FAR struct littlefs_cache_block_s *cb = &fs->cache[i];
+
+      if (cb->block == block)
+        {
+          cb->age = ++fs->cache_age;
+          memcpy(dest, cb->data, fs->geo.blocksize);
+          return OK;
+        }
+
+      /* Remember the best eviction candidate:  Any empty entry, else
+       * the least recently used one.
+       */
+
+      if (victim->block != LITTLEFS_CACHE_INVALID &&
+          (cb->block == LITTLEFS_CACHE_INVALID || cb->age < victim->age))
+        {
+          victim = cb;
+        }
+    }
+
+  /* Miss:  Refill the victim entry from the device */
+
+  ret = littlefs_read_device(fs, block, 1, victim->data);
+  if (ret < 0)
+    {
+      victim->block = LITTLEFS_CACHE_INVALID;
+      return ret;
+    }
+
+  victim->block = block;
+  victim->age   = ++fs->cache_age;
+  memcpy(dest, victim->data, fs->geo.blocksize);
+  return OK;
+}
+
+/****************************************************************************
+ * Name: littlefs_cache_invalidate
+ *
+ * Description: Drop any cached copy of the given device block range.
+ *
+ ****************************************************************************/
+
+static void littlefs_cache_invalidate(FAR struct littlefs_mountpt_s *fs,
+                                      uint32_t block, uint32_t nblocks)
+{
+  int i;
+
+  if (fs->cache_data == NULL)
+    {
+      return;
+    }
+
+  for (i = 0; i < CONFIG_FS_LITTLEFS_BLOCK_CACHE_BLOCKS; i++)
+    {
+      if (fs->cache[i].block != LITTLEFS_CACHE_INVALID &&
+          fs->cache[i].block - block < nblocks)
+        {
+          fs->cache[i].block = LITTLEFS_CACHE_INVALID;
+          fs->cache[i].age   = 0;
+        }
+    }
+}
+#endif /* CONFIG_FS_LITTLEFS_BLOCK_CACHE */
+
+/****************************************************************************
+ * Name: littlefs_read_block
+ ****************************************************************************/
+
 static int littlefs_read_block(FAR const struct lfs_config *c,
                                lfs_block_t block, lfs_off_t off,
                                FAR void *buffer, lfs_size_t size)
 {
   FAR struct littlefs_mountpt_s *fs = c->context;
   FAR struct mtd_geometry_s *geo = &fs->geo;
-  FAR struct inode *drv = fs->drv;
-  int ret;
 
   block = (block * c->block_size + off) / geo->blocksize;
   size  = size / geo->blocksize;
 
-  if (INODE_IS_MTD(drv))
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+  if (fs->cache_data != NULL)
     {
-      ret = MTD_BREAD(drv->u.i_mtd, block, size, buffer);
-    }
-  else
-    {
-      ret = drv->u.i_bops->read(drv, buffer, block, size);
+      FAR uint8_t *dest = buffer;
+      lfs_size_t i;
+      int ret;
+
+      for (i = 0; i < size; i++)
+        {
+          ret = littlefs_cache_readblock(fs, block + i, dest);
+          if (ret < 0)
+            {
+              return ret;
+            }
+
+          dest += geo->blocksize;
+        }
+
+      return OK;
     }
+#endif
 
-  return ret >= 0 ? OK : ret;
+  return littlefs_read_device(fs, block, size, buffer);
 }
 
 /****************************************************************************
@@ -984,6 +1121,10 @@ static int littlefs_write_block(FAR const struct lfs_config *c,
   block = (block * c->block_size + off) / geo->blocksize;
   size  = size / geo->blocksize;
 
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+  littlefs_cache_invalidate(fs, block, size);
+#endif
+
   if (INODE_IS_MTD(drv))
     {
       ret = MTD_BWRITE(drv->u.i_mtd, block, size, buffer);
@@ -1007,6 +1148,11 @@ static int littlefs_erase_block(FAR const struct lfs_config *c,
   FAR struct inode *drv = fs->drv;
   int ret = OK;
 
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+  littlefs_cache_invalidate(fs, block * c->block_size / fs->geo.blocksize,
+                            c->block_size / fs->geo.blocksize);
+#endif
+
   if (INODE_IS_MTD(drv))
     {
       FAR struct mtd_geometry_s *geo = &fs->geo;
@@ -1130,6 +1276,26 @@ static int littlefs_bind(FAR struct inode *driver, FAR const void *data,
       goto errout_with_fs;
     }
 
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+  /* Allocate the shared device block cache.  The filesystem remains
+   * usable without it if the allocation fails:  fs was zalloc'ed, so
+   * cache_data stays NULL and the cache paths are skipped.
+   */
+
+  fs->cache_data = fs_heap_malloc(CONFIG_FS_LITTLEFS_BLOCK_CACHE_BLOCKS *
+                                  fs->geo.blocksize);
+  if (fs->cache_data != NULL)
+    {
+      int i;
+
+      for (i = 0; i < CONFIG_FS_LITTLEFS_BLOCK_CACHE_BLOCKS; i++)
+        {
+          fs->cache[i].block = LITTLEFS_CACHE_INVALID;
+          fs->cache[i].data  = fs->cache_data + i * fs->geo.blocksize;
+        }
+    }
+#endif
+
   /* Initialize lfs_config structure */
 
   fs->cfg.context        = fs;
@@ -1200,6 +1366,9 @@ static int littlefs_bind(FAR struct inode *driver, FAR const void *data,
   return OK;
 
 errout_with_fs:
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+  fs_heap_free(fs->cache_data);
+#endif
   nxmutex_destroy(&fs->lock);
   fs_heap_free(fs);
 errout_with_block:
@@ -1259,6 +1428,9 @@ static int littlefs_unbind(FAR void *handle, FAR struct inode **driver,
 
       /* Release the mountpoint private data */
 
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+      fs_heap_free(fs->cache_data);
+#endif
       nxmutex_destroy(&fs->lock);
       fs_heap_free(fs);
     }
@@ -25,6 +25,7 @@
 #include <nuttx/config.h>
 #include <sys/types.h>
 #include <sys/ioctl.h>
+#include <sys/mman.h>
 
 #include <assert.h>
 #include <debug.h>
@@ -236,11 +237,30 @@ int rammap(FAR struct file *filep, FAR struct mm_map_entry_s *entry,
            enum mm_map_type_e type)
 {
   FAR uint8_t *rdbuffer;
+  uintptr_t xipbase;
   ssize_t nread;
   off_t fpos;
   int ret;
   size_t length = entry->length;
 
+  /* If the file lies in directly addressable memory, then map it in place
+   * with no copying.  A file system that stores its files contiguously on
+   * memory mapped media (such as ROMFS) reports the in-memory location of
+   * a file with FIOC_XIPBASE.  This is only usable when the mapping does
+   * not need write (copy) semantics.
+   */
+
+  if ((entry->prot & PROT_WRITE) == 0)
+    {
+      ret = file_ioctl(filep, FIOC_XIPBASE, (unsigned long)&xipbase);
+      if (ret == OK)
+        {
+          entry->vaddr = (FAR void *)(xipbase + entry->offset);
+          type = MAP_XIP;
+          goto out;
+        }
+    }
+
   ret = file_ioctl(filep, BIOC_XIPBASE, (unsigned long)&entry->vaddr);
   if (ret == OK)
     {
@@ -317,6 +317,15 @@ int nx_mount(FAR const char *source, FAR const char *target,
           ret = -ENODEV;
           goto errout_with_inode;
         }
+
+#ifdef CONFIG_FS_BLOCKCACHE
+      /* Interpose the sector cache between the file system and the block
+       * driver.  On failure the original driver inode is returned and
+       * the volume is simply mounted uncached.
+       */
+
+      drvr_inode = block_cache_wrap(drvr_inode, mountflags);
+#endif
     }
   else if (source != NULL && source[0] != '\0' &&
            (ret = find_mtddriver(source, &drvr_inode)) >= 0)
@@ -450,6 +459,14 @@ int nx_mount(FAR const char *source, FAR const char *target,
         }
 #endif
 
+#ifdef CONFIG_FS_BLOCKCACHE
+      /* Tear down the sector cache (if one was interposed) and fall back
+       * to the real driver inode for the error cleanup.
+       */
+
+      drvr_inode = block_cache_unwrap(drvr_inode);
+#endif
+
       goto errout_with_lock;
     }
 
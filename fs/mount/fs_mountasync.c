@@ -0,0 +1,172 @@
+/****************************************************************************
+ * fs/mount/fs_mountasync.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <assert.h>
+#include <debug.h>
+#include <errno.h>
+#include <string.h>
+
+#include <nuttx/fs/fs.h>
+#include <nuttx/wqueue.h>
+
+#include "fs_heap.h"
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* This structure carries one deferred mount request.  The string arguments
+ * are copied into the trailing buffer since the caller's strings may not
+ * outlive the call.
+ */
+
+struct mount_work_s
+{
+  struct work_s work;       /* Supports deferral to the work queue */
+  FAR char *source;         /* Copy of the source path, or NULL */
+  FAR char *target;         /* Copy of the target path */
+  FAR char *filesystemtype; /* Copy of the file system type */
+  FAR char *data;           /* Copy of the option string, or NULL */
+  unsigned long mountflags; /* Mount flags */
+  char buffer[1];           /* Buffer holding the string copies */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mount_async_worker
+ *
+ * Description:
+ *   Perform one deferred mount on the low-priority work queue.
+ *
+ ****************************************************************************/
+
+static void mount_async_worker(FAR void *arg)
+{
+  FAR struct mount_work_s *mw = arg;
+  int ret;
+
+  ret = nx_mount(mw->source, mw->target, mw->filesystemtype,
+                 mw->mountflags, mw->data);
+  if (ret < 0)
+    {
+      ferr("ERROR: Deferred mount of %s at %s failed: %d\n",
+           mw->filesystemtype, mw->target, ret);
+    }
+
+  fs_heap_free(mw);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nx_mount_async
+ *
+ * Description:
+ *   Queue a mount operation on the low-priority work queue and return
+ *   immediately.  This permits board bring-up logic to start several
+ *   independent volume mounts without serializing on slow media spin-up.
+ *
+ *   There is no completion return to the caller.  Completion can be
+ *   observed by watching the target path with inotify (an IN_CREATE event
+ *   is generated for the mount point when CONFIG_FS_NOTIFY is enabled) or
+ *   simply by polling the target path with stat().  Mount failures are
+ *   logged.
+ *
+ *   Unlike nx_mount(), the 'data' argument must be a NUL-terminated option
+ *   string (or NULL) since it has to be copied for the deferred call.
+ *
+ * Returned Value:
+ *   Zero is returned if the mount was successfully queued; a negated errno
+ *   value is returned on any failure to queue it.
+ *
+ ****************************************************************************/
+
+int nx_mount_async(FAR const char *source, FAR const char *target,
+                   FAR const char *filesystemtype, unsigned long mountflags,
+                   FAR const char *data)
+{
+  FAR struct mount_work_s *mw;
+  FAR char *buffer;
+  size_t bufsize;
+
+  DEBUGASSERT(target != NULL && filesystemtype != NULL);
+
+  /* Allocate the work structure with space for copies of all of the
+   * string arguments.
+   */
+
+  bufsize = strlen(target) + strlen(filesystemtype) + 2;
+  if (source != NULL)
+    {
+      bufsize += strlen(source) + 1;
+    }
+
+  if (data != NULL)
+    {
+      bufsize += strlen(data) + 1;
+    }
+
+  mw = fs_heap_zalloc(sizeof(struct mount_work_s) + bufsize - 1);
+  if (mw == NULL)
+    {
+      return -ENOMEM;
+    }
+
+  /* Copy each string argument into the trailing buffer */
+
+  buffer = mw->buffer;
+  if (source != NULL)
+    {
+      mw->source = buffer;
+      buffer += strlen(source) + 1;
+      strcpy(mw->source, source);
+    }
+
+  mw->target = buffer;
+  buffer += strlen(target) + 1;
+  strcpy(mw->target, target);
+
+  mw->filesystemtype = buffer;
+  buffer += strlen(filesystemtype) + 1;
+  strcpy(mw->filesystemtype, filesystemtype);
+
+  if (data != NULL)
+    {
+      mw->data = buffer;
+      strcpy(mw->data, data);
+    }
+
+  mw->mountflags = mountflags;
+
+  /* Then queue the mount on the low-priority work queue */
+
+  return work_queue(LPWORK, &mw->work, mount_async_worker, mw, 0);
+}
@@ -46,12 +46,14 @@
 #include <nuttx/fs/procfs.h>
 
 #include "mount/mount.h"
+#include "inode/inode.h"
 #include "fs_heap.h"
 
 #if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS)
 #if !defined(CONFIG_FS_PROCFS_EXCLUDE_MOUNT) || \
     !defined(CONFIG_FS_PROCFS_EXCLUDE_BLOCKS) || \
-    !defined(CONFIG_FS_PROCFS_EXCLUDE_USAGE)
+    !defined(CONFIG_FS_PROCFS_EXCLUDE_USAGE) || \
+    defined(CONFIG_FS_LATENCY)
 
 /****************************************************************************
  * Pre-processor Definitions
@@ -72,6 +74,9 @@ enum mount_file_e
   FS_MOUNT_FILE = 0,                 /* /proc/fs/mount */
   FS_BLOCKS_FILE,                    /* /proc/fs/blocks */
   FS_USAGE_FILE,                     /* /proc/fs/usage */
+#ifdef CONFIG_FS_LATENCY
+  FS_LATENCY_FILE,                   /* /proc/fs/latency */
+#endif
 };
 
 struct mount_file_s
@@ -115,6 +120,10 @@ static int     blocks_entry(FAR const char *mountpoint,
 static int     usage_entry(FAR const char *mountpoint,
                            FAR struct statfs *statbuf, FAR void *arg);
 #endif
+#ifdef CONFIG_FS_LATENCY
+static int     latency_entry(FAR struct inode *node,
+                             FAR char dirpath[PATH_MAX], FAR void *arg);
+#endif
 
 /* File system methods */
 
@@ -357,6 +366,62 @@ static int usage_entry(FAR const char *mountpoint,
 }
 #endif
 
+/****************************************************************************
+ * Name: latency_entry
+ *
+ * Description:
+ *   Output the fs/latency histograms for one mountpoint inode
+ *
+ *   Format:
+ *     <mountpoint> <operation> <bin0> <bin1> ... <bin15>
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_LATENCY
+static int latency_entry(FAR struct inode *node,
+                         FAR char dirpath[PATH_MAX], FAR void *arg)
+{
+  FAR struct mount_info_s *info = (FAR struct mount_info_s *)arg;
+  int op;
+  int bin;
+  static FAR const char *opnames[FSLAT_NOPS] =
+  {
+    "open", "read", "write"
+  };
+
+  DEBUGASSERT(node != NULL && info != NULL);
+
+  /* Skip inodes that are not mountpoints and mountpoints that have not
+   * yet recorded any operation.
+   */
+
+  if (!INODE_IS_MOUNTPT(node) || node->i_latency == NULL)
+    {
+      return 0;
+    }
+
+  /* Generate one line per instrumented operation.  Each bin is emitted
+   * with its own mount_sprintf() call so that the full histogram is not
+   * constrained by the length of the line buffer.
+   */
+
+  for (op = 0; op < FSLAT_NOPS; op++)
+    {
+      mount_sprintf(info, "%s/%s %-5s", dirpath, node->i_name,
+                    opnames[op]);
+
+      for (bin = 0; bin < FSLAT_NBINS; bin++)
+        {
+          mount_sprintf(info, " %" PRIu32, node->i_latency->hist[op][bin]);
+        }
+
+      mount_sprintf(info, "\n");
+    }
+
+  return (info->totalsize >= info->buflen) ? 1 : 0;
+}
+#endif
+
 /****************************************************************************
  * Name: mount_open
  ****************************************************************************/
@@ -401,6 +466,12 @@ static int mount_open(FAR struct file *filep, FAR const char *relpath,
     {
       id = FS_USAGE_FILE;
     }
+#ifdef CONFIG_FS_LATENCY
+  else if (strcmp(relpath, "fs/latency") == 0)
+    {
+      id = FS_LATENCY_FILE;
+    }
+#endif
   else
     {
       ferr("ERROR: relpath is '%s'\n", relpath);
@@ -477,6 +548,26 @@ static ssize_t mount_read(FAR struct file *filep, FAR char *buffer,
   info.offset    = filep->f_pos;
   info.header    = false;
 
+#ifdef CONFIG_FS_LATENCY
+  /* The latency histograms hang off of the mountpoint inodes themselves,
+   * so fs/latency traverses the inode tree instead of the mountpoint
+   * statfs list used by the other files.
+   */
+
+  if (procfile->id == FS_LATENCY_FILE)
+    {
+      foreach_inode(latency_entry, &info);
+      ret = info.totalsize;
+
+      if (ret > 0)
+        {
+          filep->f_pos += ret;
+        }
+
+      return ret;
+    }
+#endif
+
   switch (procfile->id)
     {
 #ifndef CONFIG_FS_PROCFS_EXCLUDE_MOUNT
@@ -577,5 +668,6 @@ static int mount_stat(FAR const char *relpath, FAR struct stat *buf)
 
 #endif /* !CONFIG_FS_PROCFS_EXCLUDE_MOUNT || \
         * !CONFIG_FS_PROCFS_EXCLUDE_BLOCKS || \
-        * !CONFIG_FS_PROCFS_EXCLUDE_USAGE */
+        * !CONFIG_FS_PROCFS_EXCLUDE_USAGE || \
+        * CONFIG_FS_LATENCY */
 #endif /* !CONFIG_DISABLE_MOUNTPOINT && CONFIG_FS_PROCFS */
@@ -70,6 +70,16 @@ struct nfsnode
   struct timespec     n_ctime;      /* File creation time */
   nfsfh_t             n_fhandle;    /* NFS File Handle */
   uint64_t            n_size;       /* Current size of file */
+#ifdef CONFIG_NFS_READAHEAD
+  FAR uint8_t        *n_rabuffer;   /* Read-ahead buffer (rsize bytes) */
+  uint64_t            n_raoffset;   /* File offset of first buffered byte */
+  size_t              n_ravalid;    /* Valid bytes in the buffer (0=empty) */
+#endif
+#ifdef CONFIG_NFS_WRITE_GATHER
+  FAR uint8_t        *n_wgbuffer;   /* Write gathering buffer (wsize bytes) */
+  uint64_t            n_wgoffset;   /* File offset of first gathered byte */
+  size_t              n_wgbytes;    /* Gathered bytes not yet sent (0=empty) */
+#endif
 };
 
 #endif /* __FS_NFS_NFS_NODE_H */
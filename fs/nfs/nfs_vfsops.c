@@ -136,6 +136,18 @@ static int     nfs_fileopen(FAR struct nfsmount *nmp,
                    FAR struct nfsnode *np, FAR const char *relpath,
                    int oflags, mode_t mode);
 
+static ssize_t nfs_readrpc(FAR struct nfsmount *nmp,
+                   FAR struct nfsnode *np, uint64_t offset,
+                   FAR uint8_t *buffer, size_t buflen, FAR bool *eof);
+static ssize_t nfs_writerpc(FAR struct nfsmount *nmp,
+                   FAR struct nfsnode *np, uint64_t offset,
+                   FAR const uint8_t *buffer, size_t buflen,
+                   FAR int *committed);
+#ifdef CONFIG_NFS_WRITE_GATHER
+static int     nfs_flushgather(FAR struct nfsmount *nmp,
+                   FAR struct nfsnode *np);
+#endif
+
 static int     nfs_open(FAR struct file *filep, FAR const char *relpath,
                    int oflags, mode_t mode);
 static int     nfs_close(FAR struct file *filep);
@@ -770,6 +782,9 @@ static int nfs_close(FAR struct file *filep)
   FAR struct nfsnode  *np;
   FAR struct nfsnode  *prev;
   FAR struct nfsnode  *curr;
+#ifdef CONFIG_NFS_WRITE_GATHER
+  int flushret;
+#endif
   int ret;
 
   /* Sanity checks */
@@ -791,6 +806,15 @@ static int nfs_close(FAR struct file *filep)
       return ret;
     }
 
+#ifdef CONFIG_NFS_WRITE_GATHER
+  /* Push any gathered write data to the server.  The close proceeds even
+   * if the flush fails; the error is reported if the close itself
+   * succeeds.
+   */
+
+  flushret = nfs_flushgather(nmp, np);
+#endif
+
   /* Decrement the reference count.  If the reference count would not
    * decrement to zero, then that is all we have to do.
    */
@@ -839,6 +863,19 @@ static int nfs_close(FAR struct file *filep)
 
               /* Then deallocate the file structure and return success */
 
+#ifdef CONFIG_NFS_READAHEAD
+              if (np->n_rabuffer != NULL)
+                {
+                  fs_heap_free(np->n_rabuffer);
+                }
+#endif
+#ifdef CONFIG_NFS_WRITE_GATHER
+              if (np->n_wgbuffer != NULL)
+                {
+                  fs_heap_free(np->n_wgbuffer);
+                }
+#endif
+
               fs_heap_free(np);
               ret = OK;
               break;
@@ -848,9 +885,147 @@ static int nfs_close(FAR struct file *filep)
 
   filep->f_priv = NULL;
   nxmutex_unlock(&nmp->nm_lock);
+
+#ifdef CONFIG_NFS_WRITE_GATHER
+  if (ret == OK)
+    {
+      ret = flushret;
+    }
+#endif
+
   return ret;
 }
 
+/****************************************************************************
+ * Name: nfs_readrpc
+ *
+ * Description:
+ *   Perform one READ RPC at the given file offset.  The read size is
+ *   limited by the 'rsize' mount option and by the size of the I/O buffer.
+ *   The mount structure must be locked by the caller.
+ *
+ * Returned Value:
+ *   The (non-negative) number of bytes read on success; a negated errno
+ *   value on failure.  'eof' is set if the server reported the end of the
+ *   file.
+ *
+ ****************************************************************************/
+
+static ssize_t nfs_readrpc(FAR struct nfsmount *nmp,
+                           FAR struct nfsnode *np, uint64_t offset,
+                           FAR uint8_t *buffer, size_t buflen,
+                           FAR bool *eof)
+{
+  ssize_t        readsize;
+  ssize_t        tmp;
+  size_t         reqlen;
+  FAR uint32_t  *ptr;
+  int            ret;
+
+  *eof = false;
+
+  /* Make sure that the attempted read size does not exceed the RPC
+   * maximum
+   */
+
+  readsize = buflen;
+  if (readsize > nmp->nm_rsize)
+    {
+      readsize = nmp->nm_rsize;
+    }
+
+  /* Make sure that the attempted read size does not exceed the IO buffer
+   * size
+   */
+
+  tmp = SIZEOF_rpc_reply_read(readsize);
+  if (tmp > nmp->nm_buflen)
+    {
+      readsize -= (tmp - nmp->nm_buflen);
+    }
+
+  /* Initialize the request */
+
+  ptr     = (FAR uint32_t *)&nmp->nm_msgbuffer.read.read;
+  reqlen  = 0;
+
+  /* Copy the variable length, file handle */
+
+  *ptr++  = txdr_unsigned((uint32_t)np->n_fhsize);
+  reqlen += sizeof(uint32_t);
+
+  memcpy(ptr, &np->n_fhandle, np->n_fhsize);
+  reqlen += uint32_alignup(np->n_fhsize);
+  ptr    += uint32_increment(np->n_fhsize);
+
+  /* Copy the file offset */
+
+  txdr_hyper(offset, ptr);
+  ptr += 2;
+  reqlen += 2*sizeof(uint32_t);
+
+  /* Set the readsize */
+
+  *ptr = txdr_unsigned(readsize);
+  reqlen += sizeof(uint32_t);
+
+  /* Perform the read */
+
+  finfo("Reading %zu bytes\n", readsize);
+  nfs_statistics(NFSPROC_READ);
+  ret = nfs_request(nmp, NFSPROC_READ,
+                    &nmp->nm_msgbuffer.read, reqlen,
+                    nmp->nm_iobuffer, nmp->nm_buflen);
+  if (ret)
+    {
+      ferr("ERROR: nfs_request failed: %d\n", ret);
+      return (ssize_t)ret;
+    }
+
+  /* The read was successful.  Get a pointer to the beginning of the NFS
+   * response data.
+   */
+
+  ptr = (FAR uint32_t *)
+    &((FAR struct rpc_reply_read *)nmp->nm_iobuffer)->read;
+
+  /* Check if attributes are included in the responses */
+
+  tmp = *ptr++;
+  if (tmp != 0)
+    {
+      /* Yes.. Update the cached file status in the file structure. */
+
+      nfs_attrupdate(np, (FAR struct nfs_fattr *)ptr);
+      ptr += uint32_increment(sizeof(struct nfs_fattr));
+    }
+
+  /* This is followed by the count of data read.  Isn't this
+   * the same as the length that is included in the read data?
+   *
+   * Just skip over if for now.
+   */
+
+  ptr++;
+
+  /* Next comes an EOF indication. */
+
+  if (*ptr++ != 0)
+    {
+      *eof = true;
+    }
+
+  /* Then the length of the read data followed by the read data itself */
+
+  readsize = fxdr_unsigned(uint32_t, *ptr);
+  ptr++;
+
+  /* Copy the read data into the caller's buffer */
+
+  memcpy(buffer, ptr, readsize);
+  return readsize;
+}
+
 /****************************************************************************
  * Name: nfs_read
  *
@@ -865,11 +1040,9 @@ static ssize_t nfs_read(FAR struct file *filep, FAR char *buffer,
 {
   FAR struct nfsmount       *nmp;
   FAR struct nfsnode        *np;
-  ssize_t                    readsize;
   ssize_t                    tmp;
   ssize_t                    bytesread;
-  size_t                     reqlen;
-  FAR uint32_t              *ptr;
+  bool                       eof;
   int                        ret = 0;
 
   finfo("Read %zu bytes from offset %jd\n",
@@ -892,6 +1065,18 @@ static ssize_t nfs_read(FAR struct file *filep, FAR char *buffer,
       return (ssize_t)ret;
     }
 
+  bytesread = 0;
+
+#ifdef CONFIG_NFS_WRITE_GATHER
+  /* Any gathered, unsent writes must be visible to reads of the file */
+
+  ret = nfs_flushgather(nmp, np);
+  if (ret < 0)
+    {
+      goto errout_with_lock;
+    }
+#endif
+
   /* Get the number of bytes left in the file and truncate read count so that
    * it does not exceed the number of bytes left in the file.
    */
@@ -905,123 +1090,292 @@ static ssize_t nfs_read(FAR struct file *filep, FAR char *buffer,
 
   /* Now loop until we fill the user buffer (or hit the end of the file) */
 
-  for (bytesread = 0; bytesread < buflen; )
+  while (bytesread < buflen)
     {
-      /* Make sure that the attempted read size does not exceed the RPC
-       * maximum
+#ifdef CONFIG_NFS_READAHEAD
+      /* Allocate the read-ahead buffer on first use.  If the allocation
+       * fails, reads simply bypass the buffer.
        */
 
-      readsize = buflen - bytesread;
-      if (readsize > nmp->nm_rsize)
+      if (np->n_rabuffer == NULL)
         {
-          readsize = nmp->nm_rsize;
+          np->n_rabuffer = fs_heap_malloc(nmp->nm_rsize);
         }
 
-      /* Make sure that the attempted read size does not exceed the IO buffer
-       * size
+      /* Serve the read from the read-ahead buffer if it holds the current
+       * file position.
        */
 
-      tmp = SIZEOF_rpc_reply_read(readsize);
-      if (tmp > nmp->nm_buflen)
+      if (np->n_ravalid > 0 &&
+          (uint64_t)filep->f_pos >= np->n_raoffset &&
+          (uint64_t)filep->f_pos < np->n_raoffset + np->n_ravalid)
         {
-          readsize -= (tmp - nmp->nm_buflen);
-        }
+          size_t skew   = filep->f_pos - np->n_raoffset;
+          size_t nbytes = np->n_ravalid - skew;
 
-      /* Initialize the request */
-
-      ptr     = (FAR uint32_t *)&nmp->nm_msgbuffer.read.read;
-      reqlen  = 0;
-
-      /* Copy the variable length, file handle */
+          if (nbytes > buflen - bytesread)
+            {
+              nbytes = buflen - bytesread;
+            }
 
-      *ptr++  = txdr_unsigned((uint32_t)np->n_fhsize);
-      reqlen += sizeof(uint32_t);
+          memcpy(buffer, &np->n_rabuffer[skew], nbytes);
 
-      memcpy(ptr, &np->n_fhandle, np->n_fhsize);
-      reqlen += uint32_alignup(np->n_fhsize);
-      ptr    += uint32_increment(np->n_fhsize);
+          filep->f_pos += nbytes;
+          bytesread    += nbytes;
+          buffer       += nbytes;
+          continue;
+        }
 
-      /* Copy the file offset */
+      /* On a miss, refill the buffer with one full rsize READ when the
+       * remaining request is smaller than rsize.  Larger requests go
+       * directly to the user buffer below and avoid the extra copy.
+       */
 
-      txdr_hyper((uint64_t)filep->f_pos, ptr);
-      ptr += 2;
-      reqlen += 2*sizeof(uint32_t);
+      if (np->n_rabuffer != NULL && buflen - bytesread < nmp->nm_rsize)
+        {
+          tmp = nfs_readrpc(nmp, np, filep->f_pos, np->n_rabuffer,
+                            nmp->nm_rsize, &eof);
+          if (tmp < 0)
+            {
+              ret = tmp;
+              goto errout_with_lock;
+            }
 
-      /* Set the readsize */
+          np->n_raoffset = filep->f_pos;
+          np->n_ravalid  = tmp;
 
-      *ptr = txdr_unsigned(readsize);
-      reqlen += sizeof(uint32_t);
+          if (tmp == 0)
+            {
+              break;
+            }
 
-      /* Perform the read */
+          continue;
+        }
+#endif
 
-      finfo("Reading %zu bytes\n", readsize);
-      nfs_statistics(NFSPROC_READ);
-      ret = nfs_request(nmp, NFSPROC_READ,
-                        &nmp->nm_msgbuffer.read, reqlen,
-                        nmp->nm_iobuffer, nmp->nm_buflen);
-      if (ret)
+      tmp = nfs_readrpc(nmp, np, filep->f_pos, (FAR uint8_t *)buffer,
+                        buflen - bytesread, &eof);
+      if (tmp < 0)
         {
-          ferr("ERROR: nfs_request failed: %d\n", ret);
+          ret = tmp;
           goto errout_with_lock;
         }
 
-      /* The read was successful.  Get a pointer to the beginning of the NFS
-       * response data.
-       */
+      /* Update the read state data */
 
-      ptr = (FAR uint32_t *)
-        &((FAR struct rpc_reply_read *)nmp->nm_iobuffer)->read;
+      filep->f_pos += tmp;
+      bytesread    += tmp;
+      buffer       += tmp;
 
-      /* Check if attributes are included in the responses */
+      /* Check if we hit the end of file */
 
-      tmp = *ptr++;
-      if (tmp != 0)
+      if (eof)
         {
-          /* Yes.. Update the cached file status in the file structure. */
-
-          nfs_attrupdate(np, (FAR struct nfs_fattr *)ptr);
-          ptr += uint32_increment(sizeof(struct nfs_fattr));
+          break;
         }
+    }
 
-      /* This is followed by the count of data read.  Isn't this
-       * the same as the length that is included in the read data?
-       *
-       * Just skip over if for now.
-       */
+errout_with_lock:
+  nxmutex_unlock(&nmp->nm_lock);
+  return bytesread > 0 ? bytesread : ret;
+}
 
-      ptr++;
+/****************************************************************************
+ * Name: nfs_writerpc
+ *
+ * Description:
+ *   Perform one WRITE RPC at the given file offset.  The write size is
+ *   limited by the 'wsize' mount option and by the size of the I/O buffer.
+ *   The mount structure must be locked by the caller.
+ *
+ * Returned Value:
+ *   The (non-negative) number of bytes written on success; a negated errno
+ *   value on failure.  'committed' tracks the lowest commitment level
+ *   obtained by any of the WRITE RPCs issued so far.
+ *
+ ****************************************************************************/
 
-      /* Next comes an EOF indication.  Save that in tmp for now. */
+static ssize_t nfs_writerpc(FAR struct nfsmount *nmp,
+                            FAR struct nfsnode *np, uint64_t offset,
+                            FAR const uint8_t *buffer, size_t buflen,
+                            FAR int *committed)
+{
+  ssize_t        writesize;
+  ssize_t        bufsize;
+  size_t         reqlen;
+  FAR uint32_t  *ptr;
+  uint32_t       tmp;
+  int            commit;
+  int            ret;
+
+  /* Make sure that the attempted write size does not exceed the RPC
+   * maximum.
+   */
 
-      tmp = *ptr++;
+  writesize = buflen;
+  if (writesize > nmp->nm_wsize)
+    {
+      writesize = nmp->nm_wsize;
+    }
 
-      /* Then the length of the read data followed by the read data itself */
+  /* Make sure that the attempted read size does not exceed the IO
+   * buffer size.
+   */
 
-      readsize = fxdr_unsigned(uint32_t, *ptr);
-      ptr++;
+  bufsize = SIZEOF_rpc_call_write(writesize);
+  if (bufsize > nmp->nm_buflen)
+    {
+      writesize -= (bufsize - nmp->nm_buflen);
+    }
 
-      /* Copy the read data into the user buffer */
+  /* Initialize the request.  Here we need an offset pointer to the write
+   * arguments, skipping over the RPC header.  Write is unique among the
+   * RPC calls in that the entry RPC calls message lies in the I/O buffer
+   */
 
-      memcpy(buffer, ptr, readsize);
+  ptr     = (FAR uint32_t *)&((FAR struct rpc_call_write *)
+              nmp->nm_iobuffer)->write;
+  reqlen  = 0;
 
-      /* Update the read state data */
+  /* Copy the variable length, file handle */
 
-      filep->f_pos += readsize;
-      bytesread    += readsize;
-      buffer       += readsize;
+  *ptr++  = txdr_unsigned((uint32_t)np->n_fhsize);
+  reqlen += sizeof(uint32_t);
 
-      /* Check if we hit the end of file */
+  memcpy(ptr, &np->n_fhandle, np->n_fhsize);
+  reqlen += uint32_alignup(np->n_fhsize);
+  ptr    += uint32_increment(np->n_fhsize);
 
-      if (tmp != 0)
+  /* Copy the file offset */
+
+  txdr_hyper(offset, ptr);
+  ptr    += 2;
+  reqlen += 2*sizeof(uint32_t);
+
+  /* Copy the count and stable values */
+
+  *ptr++  = txdr_unsigned(writesize);
+  *ptr++  = txdr_unsigned(*committed);
+  reqlen += 2*sizeof(uint32_t);
+
+  /* Copy a chunk of the user data into the I/O buffer */
+
+  *ptr++  = txdr_unsigned(writesize);
+  reqlen += sizeof(uint32_t);
+  memcpy(ptr, buffer, writesize);
+  reqlen += uint32_alignup(writesize);
+
+  /* Perform the write */
+
+  nfs_statistics(NFSPROC_WRITE);
+  ret = nfs_request(nmp, NFSPROC_WRITE,
+                    nmp->nm_iobuffer, reqlen,
+                    &nmp->nm_msgbuffer.write,
+                    sizeof(struct rpc_reply_write));
+  if (ret)
+    {
+      ferr("ERROR: nfs_request failed: %d\n", ret);
+      return (ssize_t)ret;
+    }
+
+  /* Get a pointer to the WRITE reply data */
+
+  ptr = (FAR uint32_t *)&nmp->nm_msgbuffer.write.write;
+
+  /* Parse file_wcc.  First, check if WCC attributes follow. */
+
+  tmp = *ptr++;
+  if (tmp != 0)
+    {
+      /* Yes.. WCC attributes follow.  But we just skip over them. */
+
+      ptr += uint32_increment(sizeof(struct wcc_attr));
+    }
+
+  /* Check if normal file attributes follow */
+
+  tmp = *ptr++;
+  if (tmp != 0)
+    {
+      /* Yes.. Update the cached file status in the file structure. */
+
+      nfs_attrupdate(np, (FAR struct nfs_fattr *)ptr);
+      ptr += uint32_increment(sizeof(struct nfs_fattr));
+    }
+
+  /* Get the count of bytes actually written */
+
+  tmp = fxdr_unsigned(uint32_t, *ptr);
+  ptr++;
+
+  if (tmp < 1 || tmp > writesize)
+    {
+      return -EIO;
+    }
+
+  writesize = tmp;
+
+  /* Determine the lowest commitment level obtained by any of the RPCs. */
+
+  commit = *ptr++;
+  if (*committed == NFSV3WRITE_FILESYNC)
+    {
+      *committed = commit;
+    }
+  else if (*committed == NFSV3WRITE_DATASYNC &&
+           commit == NFSV3WRITE_UNSTABLE)
+    {
+      *committed = commit;
+    }
+
+  return writesize;
+}
+
+#ifdef CONFIG_NFS_WRITE_GATHER
+/****************************************************************************
+ * Name: nfs_flushgather
+ *
+ * Description:
+ *   Send any gathered, unsent write data to the server.  The gathering
+ *   buffer is emptied even on failure; the caller sees the error but the
+ *   data cannot be retried.  The mount structure must be locked by the
+ *   caller.
+ *
+ * Returned Value:
+ *   0 on success; a negated errno value on failure.
+ *
+ ****************************************************************************/
+
+static int nfs_flushgather(FAR struct nfsmount *nmp, FAR struct nfsnode *np)
+{
+  FAR uint8_t *src;
+  uint64_t     offset;
+  size_t       remaining;
+  ssize_t      written;
+  int          committed = NFSV3WRITE_FILESYNC;
+
+  offset    = np->n_wgoffset;
+  src       = np->n_wgbuffer;
+  remaining = np->n_wgbytes;
+
+  np->n_wgbytes = 0;
+
+  while (remaining > 0)
+    {
+      written = nfs_writerpc(nmp, np, offset, src, remaining, &committed);
+      if (written < 0)
         {
-          break;
+          return (int)written;
         }
+
+      offset    += written;
+      src       += written;
+      remaining -= written;
     }
 
-errout_with_lock:
-  nxmutex_unlock(&nmp->nm_lock);
-  return bytesread > 0 ? bytesread : ret;
+  return OK;
 }
+#endif
 
 /****************************************************************************
  * Name: nfs_write
@@ -1038,12 +1392,7 @@ static ssize_t nfs_write(FAR struct file *filep, FAR const char *buffer,
   FAR struct nfsmount *nmp;
   FAR struct nfsnode  *np;
   ssize_t              writesize;
-  ssize_t              bufsize;
   ssize_t              byteswritten = 0;
-  size_t               reqlen;
-  FAR uint32_t        *ptr;
-  uint32_t             tmp;
-  int                  commit = 0;
   int                  committed = NFSV3WRITE_FILESYNC;
   int                  ret;
 
@@ -1075,136 +1424,116 @@ static ssize_t nfs_write(FAR struct file *filep, FAR const char *buffer,
       goto errout_with_lock;
     }
 
+#ifdef CONFIG_NFS_READAHEAD
+  /* The write makes any read-ahead data potentially stale */
+
+  np->n_ravalid = 0;
+#endif
+
   /* Now loop until we send the entire user buffer */
 
   for (byteswritten = 0; byteswritten < buflen; )
     {
-      /* Make sure that the attempted write size does not exceed the RPC
-       * maximum.
-       */
+#ifdef CONFIG_NFS_WRITE_GATHER
+      size_t chunk = buflen - byteswritten;
 
-      writesize = buflen - byteswritten;
-      if (writesize > nmp->nm_wsize)
-        {
-          writesize = nmp->nm_wsize;
-        }
-
-      /* Make sure that the attempted read size does not exceed the IO
-       * buffer size.
+      /* Allocate the gathering buffer on first use.  If the allocation
+       * fails, writes simply bypass the buffer.
        */
 
-      bufsize = SIZEOF_rpc_call_write(writesize);
-      if (bufsize > nmp->nm_buflen)
+      if (np->n_wgbuffer == NULL)
         {
-          writesize -= (bufsize - nmp->nm_buflen);
+          np->n_wgbuffer = fs_heap_malloc(nmp->nm_wsize);
         }
 
-      /* Initialize the request.  Here we need an offset pointer to the write
-       * arguments, skipping over the RPC header.  Write is unique among the
-       * RPC calls in that the entry RPC calls message lies in the I/O buffer
+      /* A write that is not contiguous with the gathered data forces the
+       * gathered data out first.
        */
 
-      ptr     = (FAR uint32_t *)&((FAR struct rpc_call_write *)
-                  nmp->nm_iobuffer)->write;
-      reqlen  = 0;
-
-      /* Copy the variable length, file handle */
-
-      *ptr++  = txdr_unsigned((uint32_t)np->n_fhsize);
-      reqlen += sizeof(uint32_t);
-
-      memcpy(ptr, &np->n_fhandle, np->n_fhsize);
-      reqlen += uint32_alignup(np->n_fhsize);
-      ptr    += uint32_increment(np->n_fhsize);
-
-      /* Copy the file offset */
-
-      txdr_hyper((uint64_t)filep->f_pos, ptr);
-      ptr    += 2;
-      reqlen += 2*sizeof(uint32_t);
-
-      /* Copy the count and stable values */
-
-      *ptr++  = txdr_unsigned(writesize);
-      *ptr++  = txdr_unsigned(committed);
-      reqlen += 2*sizeof(uint32_t);
-
-      /* Copy a chunk of the user data into the I/O buffer */
-
-      *ptr++  = txdr_unsigned(writesize);
-      reqlen += sizeof(uint32_t);
-      memcpy(ptr, buffer, writesize);
-      reqlen += uint32_alignup(writesize);
-
-      /* Perform the write */
-
-      nfs_statistics(NFSPROC_WRITE);
-      ret = nfs_request(nmp, NFSPROC_WRITE,
-                        nmp->nm_iobuffer, reqlen,
-                        &nmp->nm_msgbuffer.write,
-                        sizeof(struct rpc_reply_write));
-      if (ret)
+      if (np->n_wgbytes > 0 &&
+          (uint64_t)filep->f_pos != np->n_wgoffset + np->n_wgbytes)
         {
-          ferr("ERROR: nfs_request failed: %d\n", ret);
-          goto errout_with_lock;
+          ret = nfs_flushgather(nmp, np);
+          if (ret < 0)
+            {
+              goto errout_with_lock;
+            }
         }
 
-      /* Get a pointer to the WRITE reply data */
-
-      ptr = (FAR uint32_t *)&nmp->nm_msgbuffer.write.write;
-
-      /* Parse file_wcc.  First, check if WCC attributes follow. */
-
-      tmp = *ptr++;
-      if (tmp != 0)
+      if (np->n_wgbuffer == NULL ||
+          (np->n_wgbytes == 0 && chunk >= nmp->nm_wsize))
         {
-          /* Yes.. WCC attributes follow.  But we just skip over them. */
+          /* Full-sized (or unbufferable) writes go straight to the
+           * server.
+           */
 
-          ptr += uint32_increment(sizeof(struct wcc_attr));
+          writesize = nfs_writerpc(nmp, np, filep->f_pos,
+                                   (FAR const uint8_t *)buffer, chunk,
+                                   &committed);
+          if (writesize < 0)
+            {
+              ret = writesize;
+              goto errout_with_lock;
+            }
         }
-
-      /* Check if normal file attributes follow */
-
-      tmp = *ptr++;
-      if (tmp != 0)
+      else
         {
-          /* Yes.. Update the cached file status in the file structure. */
-
-          nfs_attrupdate(np, (FAR struct nfs_fattr *)ptr);
-          ptr += uint32_increment(sizeof(struct nfs_fattr));
-        }
+          /* Gather the data; it is sent when the buffer fills */
 
-      /* Get the count of bytes actually written */
+          if (np->n_wgbytes == 0)
+            {
+              np->n_wgoffset = filep->f_pos;
+            }
 
-      tmp = fxdr_unsigned(uint32_t, *ptr);
-      ptr++;
+          writesize = nmp->nm_wsize - np->n_wgbytes;
+          if (writesize > chunk)
+            {
+              writesize = chunk;
+            }
 
-      if (tmp < 1 || tmp > writesize)
+          memcpy(&np->n_wgbuffer[np->n_wgbytes], buffer, writesize);
+          np->n_wgbytes += writesize;
+        }
+#else
+      writesize = nfs_writerpc(nmp, np, filep->f_pos,
+                               (FAR const uint8_t *)buffer,
+                               buflen - byteswritten, &committed);
+      if (writesize < 0)
         {
-          ret = -EIO;
+          ret = writesize;
           goto errout_with_lock;
         }
+#endif
 
-      writesize = tmp;
+      /* Update the read state data */
 
-      /* Determine the lowest commitment level obtained by any of the RPCs. */
+      filep->f_pos += writesize;
+      byteswritten += writesize;
+      buffer       += writesize;
 
-      commit = *ptr++;
-      if (committed == NFSV3WRITE_FILESYNC)
-        {
-          committed = commit;
-        }
-      else if (committed == NFSV3WRITE_DATASYNC &&
-               commit == NFSV3WRITE_UNSTABLE)
+#ifdef CONFIG_NFS_WRITE_GATHER
+      /* Gathered data is not yet on the server; track the size locally so
+       * that fstat() and the read truncation logic see it.
+       */
+
+      if ((uint64_t)filep->f_pos > np->n_size)
         {
-          committed = commit;
+          np->n_size = filep->f_pos;
         }
 
-      /* Update the read state data */
+      /* Flush as soon as the buffer fills so that errors surface close to
+       * the write that caused them.
+       */
 
-      filep->f_pos += writesize;
-      byteswritten += writesize;
-      buffer       += writesize;
+      if (np->n_wgbytes >= nmp->nm_wsize)
+        {
+          ret = nfs_flushgather(nmp, np);
+          if (ret < 0)
+            {
+              goto errout_with_lock;
+            }
+        }
+#endif
     }
 
 errout_with_lock:
@@ -1287,7 +1616,37 @@ static off_t nfs_seek(FAR struct file *filep, off_t offset, int whence)
 
 static int nfs_sync(FAR struct file *filep)
 {
+#ifdef CONFIG_NFS_WRITE_GATHER
+  FAR struct nfsmount *nmp;
+  FAR struct nfsnode  *np;
+  int ret;
+
+  /* Sanity checks */
+
+  DEBUGASSERT(filep->f_priv != NULL);
+
+  /* Recover our private data from the struct file instance */
+
+  nmp = filep->f_inode->i_private;
+  np  = (FAR struct nfsnode *)filep->f_priv;
+
+  DEBUGASSERT(nmp != NULL);
+
+  ret = nxmutex_lock(&nmp->nm_lock);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  /* Push any gathered write data to the server */
+
+  ret = nfs_flushgather(nmp, np);
+
+  nxmutex_unlock(&nmp->nm_lock);
+  return ret;
+#else
   return 0;
+#endif
 }
 
 /****************************************************************************
@@ -1370,6 +1729,17 @@ static int nfs_fstat(FAR const struct file *filep, FAR struct stat *buf)
       return ret;
     }
 
+#ifdef CONFIG_NFS_WRITE_GATHER
+  /* Flush gathered writes so that the reported times are current */
+
+  ret = nfs_flushgather(nmp, np);
+  if (ret < 0)
+    {
+      nxmutex_unlock(&nmp->nm_lock);
+      return ret;
+    }
+#endif
+
   /* Extract the file mode, file type, and file size from the nfsnode
    * structure.
    */
@@ -1420,6 +1790,26 @@ static int nfs_fchstat(FAR const struct file *filep,
       return ret;
     }
 
+#ifdef CONFIG_NFS_WRITE_GATHER
+  /* Gathered writes must reach the server before any size change */
+
+  ret = nfs_flushgather(nmp, np);
+  if (ret < 0)
+    {
+      nxmutex_unlock(&nmp->nm_lock);
+      return ret;
+    }
+#endif
+
+#ifdef CONFIG_NFS_READAHEAD
+  /* A size change can invalidate buffered read-ahead data */
+
+  if ((flags & CH_STAT_SIZE) != 0)
+    {
+      np->n_ravalid = 0;
+    }
+#endif
+
   /* Change the file mode, owner, group and time. */
 
   ret = nfs_filechstat(nmp, np, buf, flags);
@@ -1458,6 +1848,23 @@ static int nfs_truncate(FAR struct file *filep, off_t length)
     {
       struct stat buf;
 
+#ifdef CONFIG_NFS_WRITE_GATHER
+      /* Gathered writes must reach the server before the size change */
+
+      ret = nfs_flushgather(nmp, np);
+      if (ret < 0)
+        {
+          nxmutex_unlock(&nmp->nm_lock);
+          return ret;
+        }
+#endif
+
+#ifdef CONFIG_NFS_READAHEAD
+      /* The size change invalidates any buffered read-ahead data */
+
+      np->n_ravalid = 0;
+#endif
+
       /* Then perform the SETATTR RPC to set the new file size */
 
       buf.st_size = length;
@@ -37,6 +37,10 @@
 #include <nuttx/mutex.h>
 #include <nuttx/semaphore.h>
 
+#ifdef CONFIG_NXFFS_BGPACK
+#  include <nuttx/wqueue.h>
+#endif
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
@@ -279,6 +283,9 @@ struct nxffs_volume_s
   FAR struct nxffs_ofile_s *ofiles;    /* A singly-linked list of open files */
   FAR uint8_t              *cache;     /* On cached erase block for general I/O */
   FAR uint8_t              *pack;      /* A full erase block to support packing */
+#ifdef CONFIG_NXFFS_BGPACK
+  struct work_s             packwork;  /* Supports background packing */
+#endif
 };
 
 /* This structure describes the state of the blocks on the NXFFS volume */
@@ -1060,6 +1067,27 @@ int nxffs_rminode(FAR struct nxffs_volume_s *volume, FAR const char *name);
 
 int nxffs_pack(FAR struct nxffs_volume_s *volume);
 
+/****************************************************************************
+ * Name: nxffs_pack_schedule
+ *
+ * Description:
+ *   Schedule packing of the volume on the low-priority work queue if the
+ *   free FLASH region at the end of the volume has fallen below the
+ *   configured threshold.  Called with the volume lock held after
+ *   operations that consume free FLASH or release inodes.
+ *
+ * Input Parameters:
+ *   volume - The volume to be checked.
+ *
+ * Returned Value:
+ *   None.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NXFFS_BGPACK
+void nxffs_pack_schedule(FAR struct nxffs_volume_s *volume);
+#endif
+
 /****************************************************************************
  * Standard mountpoint operation methods
  *
@@ -565,6 +565,17 @@ int nxffs_unbind(FAR void *handle, FAR struct inode **blkdriver,
       return -ENOSYS;
     }
 
-  return g_volume.ofiles ? -EBUSY : OK;
+  if (g_volume.ofiles)
+    {
+      return -EBUSY;
+    }
+
+#ifdef CONFIG_NXFFS_BGPACK
+  /* Make sure that no deferred packing runs after the volume is gone */
+
+  work_cancel_sync(LPWORK, &g_volume.packwork);
+#endif
+
+  return OK;
 #endif
 }
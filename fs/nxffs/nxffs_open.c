@@ -1171,6 +1171,15 @@ int nxffs_close(FAR struct file *filep)
     }
 
   filep->f_priv = NULL;
+
+#ifdef CONFIG_NXFFS_BGPACK
+  /* Kick off background packing if this write left the volume short on
+   * free FLASH, so the next writer does not have to pack synchronously.
+   */
+
+  nxffs_pack_schedule(volume);
+#endif
+
   nxmutex_unlock(&volume->lock);
 
 errout:
@@ -1243,6 +1243,43 @@ static inline int nxffs_packwriter(FAR struct nxffs_volume_s *volume,
   return -ENOSYS;
 }
 
+/****************************************************************************
+ * Name: nxffs_pack_worker
+ *
+ * Description:
+ *   Low-priority work queue callback that performs the deferred packing
+ *   operation scheduled by nxffs_pack_schedule().
+ *
+ * Input Parameters:
+ *   arg - The volume to be packed.
+ *
+ * Returned Value:
+ *   None.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NXFFS_BGPACK
+static void nxffs_pack_worker(FAR void *arg)
+{
+  FAR struct nxffs_volume_s *volume = arg;
+  int ret;
+
+  ret = nxmutex_lock(&volume->lock);
+  if (ret < 0)
+    {
+      return;
+    }
+
+  ret = nxffs_pack(volume);
+  if (ret < 0)
+    {
+      fwarn("WARNING: Background packing failed: %d\n", -ret);
+    }
+
+  nxmutex_unlock(&volume->lock);
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -1610,3 +1647,47 @@ errout_with_pack:
   nxffs_freeentry(&pack.dest.entry);
   return ret;
 }
+
+/****************************************************************************
+ * Name: nxffs_pack_schedule
+ *
+ * Description:
+ *   Schedule packing of the volume on the low-priority work queue if the
+ *   free FLASH region at the end of the volume has fallen below the
+ *   configured threshold.  Called with the volume lock held after
+ *   operations that consume free FLASH or release inodes.
+ *
+ * Input Parameters:
+ *   volume - The volume to be checked.
+ *
+ * Returned Value:
+ *   None.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NXFFS_BGPACK
+void nxffs_pack_schedule(FAR struct nxffs_volume_s *volume)
+{
+  off_t total = volume->nblocks * volume->geo.blocksize;
+  off_t avail = total - volume->froffset;
+
+  /* Is the free FLASH region at the end of the volume below the
+   * threshold?
+   */
+
+  if (avail * 100 >= total * CONFIG_NXFFS_BGPACK_THRESHOLD)
+    {
+      return;
+    }
+
+  /* Yes.. schedule the packing operation unless it is already pending.
+   * The worker re-takes the volume lock, so the pack itself happens
+   * after the caller has released it.
+   */
+
+  if (work_available(&volume->packwork))
+    {
+      work_queue(LPWORK, &volume->packwork, nxffs_pack_worker, volume, 0);
+    }
+}
+#endif
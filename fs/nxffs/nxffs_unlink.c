@@ -151,6 +151,17 @@ int nxffs_unlink(FAR struct inode *mountpt, FAR const char *relpath)
 
   ret = nxffs_rminode(volume, relpath);
 
+#ifdef CONFIG_NXFFS_BGPACK
+  /* Deleted inodes only become reusable FLASH after packing, so check
+   * whether the delete should trigger a background pack.
+   */
+
+  if (ret == OK)
+    {
+      nxffs_pack_schedule(volume);
+    }
+#endif
+
   nxmutex_unlock(&volume->lock);
 
 errout:
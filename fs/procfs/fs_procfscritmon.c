@@ -175,6 +175,68 @@ static int critmon_close(FAR struct file *filep)
   return OK;
 }
 
+#if CONFIG_SCHED_CRITMONITOR_MAXTIME_PREEMPTION >= 0 || \
+    CONFIG_SCHED_CRITMONITOR_MAXTIME_CSECTION >= 0
+/****************************************************************************
+ * Name: critmon_append_holder
+ *
+ * Description:
+ *   Append ",pid,caller[,pc;pc;...]" fields identifying the holder that
+ *   set one of the per-CPU maxima, then reset the holder information.
+ *
+ ****************************************************************************/
+
+static size_t critmon_append_holder(FAR struct critmon_file_s *attr,
+                                    FAR char *buffer, size_t buflen,
+                                    FAR off_t *offset, FAR pid_t *pid,
+                                    FAR void **caller, FAR void **backtrace)
+{
+  size_t linesize;
+  size_t copysize;
+  size_t totalsize;
+
+  linesize = procfs_snprintf(attr->line, CRITMON_LINELEN, ",%d,%p",
+                             *pid, *caller);
+  copysize = procfs_memcpy(attr->line, linesize, buffer, buflen, offset);
+
+  totalsize = copysize;
+  buffer   += copysize;
+  buflen   -= copysize;
+
+  *pid    = 0;
+  *caller = NULL;
+
+#if CONFIG_SCHED_CRITMONITOR_BACKTRACE > 0
+  if (buflen > 0)
+    {
+      int i;
+
+      linesize = 0;
+      for (i = 0;
+           i < CONFIG_SCHED_CRITMONITOR_BACKTRACE && backtrace[i] != NULL;
+           i++)
+        {
+          linesize += procfs_snprintf(attr->line + linesize,
+                                      CRITMON_LINELEN - linesize, "%c%p",
+                                      i == 0 ? ',' : ';', backtrace[i]);
+          backtrace[i] = NULL;
+        }
+
+      if (i > 0)
+        {
+          copysize   = procfs_memcpy(attr->line, linesize, buffer, buflen,
+                                     offset);
+          totalsize += copysize;
+        }
+    }
+#else
+  UNUSED(backtrace);
+#endif
+
+  return totalsize;
+}
+#endif
+
 /****************************************************************************
  * Name: critmon_read_cpu
  ****************************************************************************/
@@ -276,6 +338,50 @@ static ssize_t critmon_read_cpu(FAR struct critmon_file_s *attr,
     }
 #endif
 
+#if CONFIG_SCHED_CRITMONITOR_MAXTIME_PREEMPTION >= 0
+  /* Identify who set the pre-emption maximum */
+
+  copysize = critmon_append_holder(attr, buffer, buflen, offset,
+                                   &g_premp_max_pid[cpu],
+                                   &g_premp_max_caller[cpu],
+#if CONFIG_SCHED_CRITMONITOR_BACKTRACE > 0
+                                   g_premp_max_backtrace[cpu]);
+#else
+                                   NULL);
+#endif
+
+  totalsize += copysize;
+  buffer    += copysize;
+  buflen    -= copysize;
+
+  if (buflen <= 0)
+    {
+      return totalsize;
+    }
+#endif
+
+#if CONFIG_SCHED_CRITMONITOR_MAXTIME_CSECTION >= 0
+  /* Identify who set the critical section maximum */
+
+  copysize = critmon_append_holder(attr, buffer, buflen, offset,
+                                   &g_crit_max_pid[cpu],
+                                   &g_crit_max_caller[cpu],
+#if CONFIG_SCHED_CRITMONITOR_BACKTRACE > 0
+                                   g_crit_max_backtrace[cpu]);
+#else
+                                   NULL);
+#endif
+
+  totalsize += copysize;
+  buffer    += copysize;
+  buflen    -= copysize;
+
+  if (buflen <= 0)
+    {
+      return totalsize;
+    }
+#endif
+
   linesize = procfs_snprintf(attr->line, CRITMON_LINELEN, "\n");
   copysize = procfs_memcpy(attr->line, linesize, buffer, buflen, offset);
 
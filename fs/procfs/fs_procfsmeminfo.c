@@ -106,6 +106,10 @@ static ssize_t memdump_write(FAR struct file *filep, FAR const char *buffer,
 #endif
 static ssize_t meminfo_read(FAR struct file *filep, FAR char *buffer,
                  size_t buflen);
+#ifdef CONFIG_MM_HEAP_STATS
+static ssize_t heapstats_read(FAR struct file *filep, FAR char *buffer,
+                 size_t buflen);
+#endif
 static int     meminfo_dup(FAR const struct file *oldp,
                  FAR struct file *newp);
 static int     meminfo_stat(FAR const char *relpath, FAR struct stat *buf);
@@ -151,6 +155,23 @@ const struct procfs_operations g_memdump_operations =
 };
 #endif
 
+#ifdef CONFIG_MM_HEAP_STATS
+const struct procfs_operations g_heapstats_operations =
+{
+  meminfo_open,   /* open */
+  meminfo_close,  /* close */
+  heapstats_read, /* read */
+  NULL,           /* write */
+  NULL,           /* poll */
+  meminfo_dup,    /* dup */
+  NULL,           /* opendir */
+  NULL,           /* closedir */
+  NULL,           /* readdir */
+  NULL,           /* rewinddir */
+  meminfo_stat    /* stat */
+};
+#endif
+
 static FAR struct procfs_meminfo_entry_s *g_procfs_meminfo = NULL;
 
 /****************************************************************************
@@ -407,6 +428,95 @@ static ssize_t meminfo_read(FAR struct file *filep, FAR char *buffer,
   return totalsize;
 }
 
+/****************************************************************************
+ * Name: heapstats_read
+ ****************************************************************************/
+
+#ifdef CONFIG_MM_HEAP_STATS
+static ssize_t heapstats_read(FAR struct file *filep, FAR char *buffer,
+                              size_t buflen)
+{
+  FAR const struct procfs_meminfo_entry_s *entry;
+  FAR struct meminfo_file_s *procfile;
+  size_t linesize;
+  size_t copysize;
+  size_t totalsize;
+  off_t offset;
+
+  finfo("buffer=%p buflen=%d\n", buffer, (int)buflen);
+
+  DEBUGASSERT(buffer != NULL && buflen > 0);
+  offset = filep->f_pos;
+
+  /* Recover our private data from the struct file instance */
+
+  procfile = (FAR struct meminfo_file_s *)filep->f_priv;
+  DEBUGASSERT(procfile);
+
+  /* The first line is the headers */
+
+  linesize  = procfs_snprintf(procfile->line, MEMINFO_LINELEN,
+                              "%10s%11s%11s  %s\n",
+                              "name", "contended", "failures",
+                              "allocations per log2 size class");
+
+  copysize  = procfs_memcpy(procfile->line, linesize, buffer, buflen,
+                            &offset);
+  totalsize = copysize;
+
+  /* Followed by one line of counters per registered heap */
+
+  for (entry = g_procfs_meminfo; entry != NULL; entry = entry->next)
+    {
+      if (buflen > 0)
+        {
+          struct mm_heapstats_s stats;
+          int last;
+          int i;
+
+          buffer    += copysize;
+          buflen    -= copysize;
+
+          mm_heapstats(entry->heap, &stats);
+
+          /* Drop trailing empty size classes to keep the line short */
+
+          for (last = MM_HEAP_STATS_NBUCKETS - 1;
+               last > 0 && stats.hist[last] == 0;
+               last--);
+
+          linesize = procfs_snprintf(procfile->line, MEMINFO_LINELEN,
+                                     "%10s%11lu%11lu ",
+                                     entry->name,
+                                     (unsigned long)stats.contended,
+                                     (unsigned long)stats.failures);
+
+          for (i = 0; i <= last && linesize < MEMINFO_LINELEN - 1; i++)
+            {
+              linesize += procfs_snprintf(procfile->line + linesize,
+                                          MEMINFO_LINELEN - linesize,
+                                          " %lu",
+                                          (unsigned long)stats.hist[i]);
+            }
+
+          if (linesize < MEMINFO_LINELEN)
+            {
+              procfile->line[linesize++] = '\n';
+            }
+
+          copysize   = procfs_memcpy(procfile->line, linesize, buffer,
+                                     buflen, &offset);
+          totalsize += copysize;
+        }
+    }
+
+  /* Update the file offset */
+
+  filep->f_pos += totalsize;
+  return totalsize;
+}
+#endif
+
 /****************************************************************************
  * Name: memdump_read
  ****************************************************************************/
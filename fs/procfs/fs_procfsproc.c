@@ -95,6 +95,9 @@ enum proc_node_e
 #ifdef CONFIG_SCHED_CRITMONITOR
   PROC_CRITMON,                       /* Critical section monitor */
 #endif
+#ifdef CONFIG_SCHED_WAKEUPMONITOR
+  PROC_WAKEUP,                        /* Wakeup latency histogram */
+#endif
 #if CONFIG_MM_BACKTRACE >= 0
   PROC_HEAP,                          /* Task heap info */
 #endif
@@ -129,6 +132,9 @@ struct proc_file_s
   struct procfs_file_s base;          /* Base open file structure */
   FAR const struct proc_node_s *node; /* Describes the file node */
   pid_t pid;                          /* Task/thread ID */
+#ifdef CONFIG_FS_PROCFS_GENBUF
+  struct procfs_genbuf_s gen;         /* Per-open generation buffer */
+#endif
   char line[STATUS_LINELEN];          /* Pre-allocated buffer for formatted lines */
 };
 
@@ -186,6 +192,11 @@ static ssize_t proc_critmon(FAR struct proc_file_s *procfile,
                  FAR struct tcb_s *tcb, FAR char *buffer, size_t buflen,
                  off_t offset);
 #endif
+#ifdef CONFIG_SCHED_WAKEUPMONITOR
+static ssize_t proc_wakeup(FAR struct proc_file_s *procfile,
+                 FAR struct tcb_s *tcb, FAR char *buffer, size_t buflen,
+                 off_t offset);
+#endif
 #if CONFIG_MM_BACKTRACE >= 0
 static ssize_t proc_heap(FAR struct proc_file_s *procfile,
                          FAR struct tcb_s *tcb, FAR char *buffer,
@@ -214,6 +225,8 @@ static ssize_t proc_groupenv(FAR struct proc_file_s *procfile,
                  FAR struct tcb_s *tcb, FAR char *buffer, size_t buflen,
                  off_t offset);
 #endif
+static ssize_t proc_render(FAR void *arg, FAR char *buffer, size_t buflen,
+                 off_t offset);
 
 /* File system methods */
 
@@ -298,6 +311,13 @@ static const struct proc_node_s g_critmon =
 };
 #endif
 
+#ifdef CONFIG_SCHED_WAKEUPMONITOR
+static const struct proc_node_s g_wakeup =
+{
+  "wakeup",        "wakeup",  (uint8_t)PROC_WAKEUP,      DTYPE_FILE        /* Wakeup latency histogram */
+};
+#endif
+
 #if CONFIG_MM_BACKTRACE >= 0
 static const struct proc_node_s g_heap =
 {
@@ -352,6 +372,9 @@ static FAR const struct proc_node_s * const g_nodeinfo[] =
 #ifdef CONFIG_SCHED_CRITMONITOR
   &g_critmon,      /* Critical section Monitor */
 #endif
+#ifdef CONFIG_SCHED_WAKEUPMONITOR
+  &g_wakeup,       /* Wakeup latency histogram */
+#endif
 #if CONFIG_MM_BACKTRACE >= 0
   &g_heap,         /* Task heap info */
 #endif
@@ -381,6 +404,9 @@ static const struct proc_node_s * const g_level0info[] =
 #ifdef CONFIG_SCHED_CRITMONITOR
   &g_critmon,      /* Critical section monitor */
 #endif
+#ifdef CONFIG_SCHED_WAKEUPMONITOR
+  &g_wakeup,       /* Wakeup latency histogram */
+#endif
 #if CONFIG_MM_BACKTRACE >= 0
   &g_heap,         /* Task heap info */
 #endif
@@ -876,6 +902,38 @@ static ssize_t proc_critmon(FAR struct proc_file_s *procfile,
 }
 #endif
 
+/****************************************************************************
+ * Name: proc_wakeup
+ ****************************************************************************/
+
+#ifdef CONFIG_SCHED_WAKEUPMONITOR
+static ssize_t proc_wakeup(FAR struct proc_file_s *procfile,
+                           FAR struct tcb_s *tcb, FAR char *buffer,
+                           size_t buflen, off_t offset)
+{
+  size_t linesize;
+  size_t copysize;
+  int i;
+
+  /* Generate one count per log2 wake-to-run latency bin, in units of
+   * perf_gettime() ticks.
+   */
+
+  linesize = 0;
+  for (i = 0; i < WAKEHIST_NBINS; i++)
+    {
+      linesize += procfs_snprintf(procfile->line + linesize,
+                                  STATUS_LINELEN - linesize,
+                                  "%" PRIu32 "%c", tcb->wake_hist[i],
+                                  (i == WAKEHIST_NBINS - 1) ? '\n' : ' ');
+    }
+
+  copysize = procfs_memcpy(procfile->line, linesize, buffer, buflen,
+                           &offset);
+  return copysize;
+}
+#endif
+
 /****************************************************************************
  * Name: proc_heap
  ****************************************************************************/
@@ -1557,30 +1615,33 @@ static int proc_close(FAR struct file *filep)
 
   /* Release the file container structure */
 
+#ifdef CONFIG_FS_PROCFS_GENBUF
+  procfs_genbuf_free(&procfile->gen);
+#endif
   fs_heap_free(procfile);
   filep->f_priv = NULL;
   return OK;
 }
 
 /****************************************************************************
- * Name: proc_read
+ * Name: proc_render
+ *
+ * Description:
+ *   Generate the content of the selected node beginning at the provided
+ *   offset.  This is the per-node dispatch that was historically the body
+ *   of proc_read(); it is factored out so that it can also serve as the
+ *   render callback of a generation buffer.
+ *
  ****************************************************************************/
 
-static ssize_t proc_read(FAR struct file *filep, FAR char *buffer,
-                         size_t buflen)
+static ssize_t proc_render(FAR void *arg, FAR char *buffer, size_t buflen,
+                           off_t offset)
 {
-  FAR struct proc_file_s *procfile;
+  FAR struct proc_file_s *procfile = (FAR struct proc_file_s *)arg;
   FAR struct tcb_s *tcb;
   irqstate_t flags;
   ssize_t ret;
 
-  finfo("buffer=%p buflen=%d\n", buffer, (int)buflen);
-
-  /* Recover our private data from the struct file instance */
-
-  procfile = (FAR struct proc_file_s *)filep->f_priv;
-  DEBUGASSERT(procfile != NULL);
-
   /* Verify that the thread is still valid */
 
   flags = enter_critical_section();
@@ -1597,48 +1658,53 @@ static ssize_t proc_read(FAR struct file *filep, FAR char *buffer,
   switch (procfile->node->node)
     {
     case PROC_STATUS: /* Task/thread status */
-      ret = proc_status(procfile, tcb, buffer, buflen, filep->f_pos);
+      ret = proc_status(procfile, tcb, buffer, buflen, offset);
       break;
 
     case PROC_CMDLINE: /* Task command line */
-      ret = proc_cmdline(procfile, tcb, buffer, buflen, filep->f_pos);
+      ret = proc_cmdline(procfile, tcb, buffer, buflen, offset);
       break;
 
 #ifndef CONFIG_SCHED_CPULOAD_NONE
     case PROC_LOADAVG: /* Average CPU utilization */
-      ret = proc_loadavg(procfile, tcb, buffer, buflen, filep->f_pos);
+      ret = proc_loadavg(procfile, tcb, buffer, buflen, offset);
       break;
 #endif
 #ifdef CONFIG_SCHED_CRITMONITOR
     case PROC_CRITMON: /* Critical section monitor */
-      ret = proc_critmon(procfile, tcb, buffer, buflen, filep->f_pos);
+      ret = proc_critmon(procfile, tcb, buffer, buflen, offset);
+      break;
+#endif
+#ifdef CONFIG_SCHED_WAKEUPMONITOR
+    case PROC_WAKEUP: /* Wakeup latency histogram */
+      ret = proc_wakeup(procfile, tcb, buffer, buflen, offset);
       break;
 #endif
 #if CONFIG_MM_BACKTRACE >= 0
     case PROC_HEAP: /* Task heap info */
-      ret = proc_heap(procfile, tcb, buffer, buflen, filep->f_pos);
+      ret = proc_heap(procfile, tcb, buffer, buflen, offset);
       break;
 #endif
 #ifdef CONFIG_DEBUG_MM
     case PROC_HEAP_CHECK: /* Task heap check flag */
-      ret = proc_heapcheck(procfile, tcb, buffer, buflen, filep->f_pos);
+      ret = proc_heapcheck(procfile, tcb, buffer, buflen, offset);
       break;
 #endif
     case PROC_STACK: /* Task stack info */
-      ret = proc_stack(procfile, tcb, buffer, buflen, filep->f_pos);
+      ret = proc_stack(procfile, tcb, buffer, buflen, offset);
       break;
 
     case PROC_GROUP_STATUS: /* Task group status */
-      ret = proc_groupstatus(procfile, tcb, buffer, buflen, filep->f_pos);
+      ret = proc_groupstatus(procfile, tcb, buffer, buflen, offset);
       break;
 
     case PROC_GROUP_FD: /* Group file descriptors */
-      ret = proc_groupfd(procfile, tcb, buffer, buflen, filep->f_pos);
+      ret = proc_groupfd(procfile, tcb, buffer, buflen, offset);
       break;
 
 #if !defined(CONFIG_DISABLE_ENVIRON) && !defined(CONFIG_FS_PROCFS_EXCLUDE_ENVIRON)
     case PROC_GROUP_ENV: /* Group environment variables */
-      ret = proc_groupenv(procfile, tcb, buffer, buflen, filep->f_pos);
+      ret = proc_groupenv(procfile, tcb, buffer, buflen, offset);
       break;
 #endif
 
@@ -1648,6 +1714,39 @@ static ssize_t proc_read(FAR struct file *filep, FAR char *buffer,
     }
 
   leave_critical_section(flags);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: proc_read
+ ****************************************************************************/
+
+static ssize_t proc_read(FAR struct file *filep, FAR char *buffer,
+                         size_t buflen)
+{
+  FAR struct proc_file_s *procfile;
+#ifndef CONFIG_FS_PROCFS_GENBUF
+  ssize_t ret;
+#endif
+
+  finfo("buffer=%p buflen=%d\n", buffer, (int)buflen);
+
+  /* Recover our private data from the struct file instance */
+
+  procfile = (FAR struct proc_file_s *)filep->f_priv;
+  DEBUGASSERT(procfile != NULL);
+
+#ifdef CONFIG_FS_PROCFS_GENBUF
+  /* Render the content once and serve this (and subsequent sequential)
+   * reads from the generation buffer.
+   */
+
+  return procfs_genbuf_read(&procfile->gen, filep, buffer, buflen,
+                            proc_render, procfile);
+#else
+  /* Provide the requested data */
+
+  ret = proc_render(procfile, buffer, buflen, filep->f_pos);
 
   /* Update the file offset */
 
@@ -1657,6 +1756,7 @@ static ssize_t proc_read(FAR struct file *filep, FAR char *buffer,
     }
 
   return ret;
+#endif
 }
 
 /****************************************************************************
@@ -1736,6 +1836,14 @@ static int proc_dup(FAR const struct file *oldp, FAR struct file *newp)
 
   memcpy(newfile, oldfile, sizeof(struct proc_file_s));
 
+#ifdef CONFIG_FS_PROCFS_GENBUF
+  /* The duplicate must not share the generation buffer; it will render its
+   * own content on the first read.
+   */
+
+  memset(&newfile->gen, 0, sizeof(newfile->gen));
+#endif
+
   /* Save the new container in the new file structure */
 
   newp->f_priv = (FAR void *)newfile;
@@ -31,6 +31,8 @@
 
 #include <nuttx/fs/procfs.h>
 
+#include "fs_heap.h"
+
 #if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS)
 
 /****************************************************************************
@@ -43,6 +45,12 @@
 
 #define LINEBUF_SIZE 128
 
+/* Initial allocation for a generation buffer.  The buffer is doubled until
+ * the rendered content fits.
+ */
+
+#define GENBUF_INITSIZE 128
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -210,4 +218,125 @@ void procfs_sprintf(FAR char *buf, size_t size, FAR off_t *offset,
   *offset -= copysize;
 }
 
+/****************************************************************************
+ * Name: procfs_genbuf_read
+ *
+ * Description:
+ *   Serve a read from a per-open generation buffer.  When the file is read
+ *   from offset zero (or nothing has been rendered for this open yet), the
+ *   complete content is rendered once by the 'render' callback into the
+ *   buffer, growing it as needed; the requested window and all subsequent
+ *   sequential reads are then satisfied by copying from the buffer.  The
+ *   file position is advanced by the number of bytes returned.
+ *
+ *   If the buffer cannot be allocated, the read falls back to a direct
+ *   windowed render, preserving the uncached behavior.
+ *
+ * Input Parameters:
+ *   gen    - The generation buffer of this open file
+ *   filep  - The open file instance (provides and updates f_pos)
+ *   buffer - The user's receive buffer
+ *   buflen - The size (in bytes) of the user's receive buffer
+ *   render - Callback that renders the file content
+ *   arg    - Opaque argument passed to the render callback
+ *
+ * Returned Value:
+ *   The number of bytes transferred to the user's receive buffer, or a
+ *   negated errno value on failure.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_PROCFS_GENBUF
+ssize_t procfs_genbuf_read(FAR struct procfs_genbuf_s *gen,
+                           FAR struct file *filep, FAR char *buffer,
+                           size_t buflen, procfs_render_t render,
+                           FAR void *arg)
+{
+  off_t offset = filep->f_pos;
+  ssize_t nread;
+
+  /* (Re)generate the content when the file is read from the beginning or
+   * nothing has been rendered for this open yet.  Reads at a non-zero
+   * offset continue to see the content generated when the reader last
+   * started from the beginning, so a file read in chunks is consistent.
+   */
+
+  if (offset == 0 || gen->buffer == NULL)
+    {
+      size_t size = gen->size > 0 ? gen->size : GENBUF_INITSIZE;
+      ssize_t len;
+
+      for (; ; )
+        {
+          if (gen->buffer == NULL || gen->size < size)
+            {
+              fs_heap_free(gen->buffer);
+              gen->len    = 0;
+              gen->size   = 0;
+              gen->buffer = fs_heap_malloc(size);
+              if (gen->buffer == NULL)
+                {
+                  /* Fall back to an uncached windowed render */
+
+                  nread = render(arg, buffer, buflen, offset);
+                  if (nread > 0)
+                    {
+                      filep->f_pos += nread;
+                    }
+
+                  return nread;
+                }
+
+              gen->size = size;
+            }
+
+          len = render(arg, gen->buffer, gen->size, 0);
+          if (len < 0)
+            {
+              gen->len = 0;
+              return len;
+            }
+
+          if ((size_t)len < gen->size)
+            {
+              gen->len = len;
+              break;
+            }
+
+          /* The content may have been truncated; retry with more space */
+
+          size <<= 1;
+        }
+    }
+
+  /* Serve the read from the rendered content */
+
+  nread = procfs_memcpy(gen->buffer, gen->len, buffer, buflen, &offset);
+  filep->f_pos += nread;
+  return nread;
+}
+#endif
+
+/****************************************************************************
+ * Name: procfs_genbuf_free
+ *
+ * Description:
+ *   Release the memory held by a generation buffer.  Must be called when
+ *   the open file structure embedding the buffer is released.
+ *
+ * Input Parameters:
+ *   gen - The generation buffer to release
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_PROCFS_GENBUF
+void procfs_genbuf_free(FAR struct procfs_genbuf_s *gen)
+{
+  fs_heap_free(gen->buffer);
+  gen->buffer = NULL;
+  gen->size   = 0;
+  gen->len    = 0;
+}
+#endif
+
 #endif /* !CONFIG_DISABLE_MOUNTPOINT && CONFIG_FS_PROCFS */
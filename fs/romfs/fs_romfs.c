@@ -639,11 +639,15 @@ static int romfs_mmap(FAR struct file *filep, FAR struct mm_map_entry_s *map)
   rm = filep->f_inode->i_private;
 
   /* Return the address on the media corresponding to the start of
-   * the file.
+   * the file.  The mapping may extend past the end of the file into the
+   * remainder of the file's final media sector so that lengths that have
+   * been rounded up to a page boundary can still be mapped in place.
    */
 
   if (rm->rm_xipbase && map->offset >= 0 && map->offset < rf->rf_size &&
-      map->length != 0 && map->offset + map->length <= rf->rf_size)
+      map->length != 0 &&
+      map->offset + map->length <=
+      SEC_ALIGN(rm, (off_t)rf->rf_size + SEC_NDXMASK(rm)))
     {
       map->vaddr = rm->rm_xipbase + rf->rf_startoffset + map->offset;
       return OK;
@@ -1135,6 +1139,15 @@ static int romfs_bind(FAR struct inode *blkdriver, FAR const void *data,
       goto errout_with_buffer;
     }
 
+#ifdef CONFIG_FS_ROMFS_PATH_CACHE
+  /* Allocate the path lookup cache.  The mount succeeds without it if the
+   * allocation fails; lookups then simply walk the directory chains.
+   */
+
+  rm->rm_pathcache = fs_heap_zalloc(CONFIG_FS_ROMFS_PATH_CACHE_SIZE *
+                                    sizeof(struct romfs_pathentry_s));
+#endif
+
   /* Mounted! */
 
   *handle = rm;
@@ -1238,6 +1251,9 @@ static int romfs_unbind(FAR void *handle, FAR struct inode **blkdriver,
 
 #ifdef CONFIG_FS_ROMFS_CACHE_NODE
       romfs_freenode(rm->rm_root);
+#endif
+#ifdef CONFIG_FS_ROMFS_PATH_CACHE
+      romfs_pathcache_free(rm);
 #endif
       nxrmutex_destroy(&rm->rm_lock);
       fs_heap_free(rm);
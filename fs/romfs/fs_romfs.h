@@ -122,9 +122,13 @@
  */
 
 struct romfs_file_s;
+struct romfs_pathentry_s;
 struct romfs_mountpt_s
 {
   FAR struct inode *rm_blkdriver; /* The block driver inode that hosts the romfs */
+#ifdef CONFIG_FS_ROMFS_PATH_CACHE
+  FAR struct romfs_pathentry_s *rm_pathcache; /* Path lookup cache, NULL if disabled */
+#endif
 #ifdef CONFIG_FS_ROMFS_CACHE_NODE
   FAR struct romfs_nodeinfo_s *rm_root; /* The node for root node */
 #else
@@ -171,6 +175,19 @@ struct romfs_nodeinfo_s
 #endif
 };
 
+#ifdef CONFIG_FS_ROMFS_PATH_CACHE
+/* This structure is one slot in the direct-mapped path lookup cache.  The
+ * cache maps a full relative path to the result of romfs_finddirentry() so
+ * that repeated opens avoid re-walking the directory chains.
+ */
+
+struct romfs_pathentry_s
+{
+  FAR char *rp_path;               /* Full path, NULL if the slot is empty */
+  struct romfs_nodeinfo_s rp_node; /* Lookup result for the path */
+};
+#endif
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -211,6 +228,9 @@ int  romfs_datastart(FAR struct romfs_mountpt_s *rm,
 #ifdef CONFIG_FS_ROMFS_CACHE_NODE
 void romfs_freenode(FAR struct romfs_nodeinfo_s *node);
 #endif
+#ifdef CONFIG_FS_ROMFS_PATH_CACHE
+void romfs_pathcache_free(FAR struct romfs_mountpt_s *rm);
+#endif
 
 #undef EXTERN
 #if defined(__cplusplus)
@@ -314,6 +314,65 @@ static int romfs_nodeinfo_compare(FAR const void *a, FAR const void *b)
 }
 #endif
 
+/****************************************************************************
+ * Name: romfs_pathcache_probe
+ *
+ * Description:
+ *   Return the path cache slot for the given path.  The cache is direct-
+ *   mapped:  Each path hashes to exactly one slot which may or may not
+ *   currently hold it.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_ROMFS_PATH_CACHE
+static FAR struct romfs_pathentry_s *
+romfs_pathcache_probe(FAR struct romfs_mountpt_s *rm, FAR const char *path)
+{
+  uint32_t hash = 0;
+
+  while (*path != '\0')
+    {
+      hash = hash * 31 + (uint8_t)*path++;
+    }
+
+  return &rm->rm_pathcache[hash % CONFIG_FS_ROMFS_PATH_CACHE_SIZE];
+}
+
+/****************************************************************************
+ * Name: romfs_pathcache_store
+ *
+ * Description:
+ *   Remember a successful lookup in the given cache slot, evicting
+ *   whatever the slot held before.
+ *
+ ****************************************************************************/
+
+static void romfs_pathcache_store(FAR struct romfs_pathentry_s *pentry,
+                                  FAR const char *path,
+                                  FAR const struct romfs_nodeinfo_s *nodeinfo)
+{
+  size_t len = strlen(path);
+  FAR char *copy;
+
+  copy = fs_heap_malloc(len + 1);
+  if (copy == NULL)
+    {
+      /* Just skip caching this lookup */
+
+      return;
+    }
+
+  if (pentry->rp_path != NULL)
+    {
+      fs_heap_free(pentry->rp_path);
+    }
+
+  memcpy(copy, path, len + 1);
+  pentry->rp_path = copy;
+  memcpy(&pentry->rp_node, nodeinfo, sizeof(pentry->rp_node));
+}
+#endif
+
 /****************************************************************************
  * Name: romfs_searchdir
  *
@@ -872,6 +931,37 @@ void romfs_freenode(FAR struct romfs_nodeinfo_s *nodeinfo)
 }
 #endif
 
+/****************************************************************************
+ * Name: romfs_pathcache_free
+ *
+ * Description:
+ *   Free the path lookup cache when the filesystem is unmounted
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_ROMFS_PATH_CACHE
+void romfs_pathcache_free(FAR struct romfs_mountpt_s *rm)
+{
+  int i;
+
+  if (rm->rm_pathcache == NULL)
+    {
+      return;
+    }
+
+  for (i = 0; i < CONFIG_FS_ROMFS_PATH_CACHE_SIZE; i++)
+    {
+      if (rm->rm_pathcache[i].rp_path != NULL)
+        {
+          fs_heap_free(rm->rm_pathcache[i].rp_path);
+        }
+    }
+
+  fs_heap_free(rm->rm_pathcache);
+  rm->rm_pathcache = NULL;
+}
+#endif
+
 /****************************************************************************
  * Name: romfs_finddirentry
  *
@@ -885,6 +975,9 @@ int romfs_finddirentry(FAR struct romfs_mountpt_s *rm,
                        FAR struct romfs_nodeinfo_s *nodeinfo,
                        FAR const char *path)
 {
+#ifdef CONFIG_FS_ROMFS_PATH_CACHE
+  FAR struct romfs_pathentry_s *pentry = NULL;
+#endif
   FAR const char *entryname;
   FAR const char *terminator;
   int entrylen;
@@ -907,6 +1000,22 @@ int romfs_finddirentry(FAR struct romfs_mountpt_s *rm,
       return OK;
     }
 
+#ifdef CONFIG_FS_ROMFS_PATH_CACHE
+  /* Check whether this full path was looked up before.  ROMFS is
+   * read-only, so a cached result can never go stale.
+   */
+
+  if (rm->rm_pathcache != NULL)
+    {
+      pentry = romfs_pathcache_probe(rm, path);
+      if (pentry->rp_path != NULL && strcmp(pentry->rp_path, path) == 0)
+        {
+          memcpy(nodeinfo, &pentry->rp_node, sizeof(*nodeinfo));
+          return OK;
+        }
+    }
+#endif
+
   /* Then loop for each directory/file component in the full path */
 
   entryname  = path;
@@ -956,8 +1065,14 @@ int romfs_finddirentry(FAR struct romfs_mountpt_s *rm,
 
       if (!terminator)
         {
-          /* Yes.. return success */
+          /* Yes.. remember the result and return success */
 
+#ifdef CONFIG_FS_ROMFS_PATH_CACHE
+          if (pentry != NULL)
+            {
+              romfs_pathcache_store(pentry, path, nodeinfo);
+            }
+#endif
           return OK;
         }
 
@@ -33,6 +33,7 @@
 
 #include <nuttx/mtd/mtd.h>
 #include <nuttx/fs/smart.h>
+#include <nuttx/semaphore.h>
 
 /****************************************************************************
  * Pre-processor Definitions
@@ -327,6 +328,11 @@ struct smartfs_mountpt_s
   FAR char                     *fs_rwbuffer;   /* Read/Write working buffer */
   FAR char                     *fs_workbuffer; /* Working buffer */
   uint8_t                       fs_rootsector; /* Root directory sector num */
+#ifdef CONFIG_SMARTFS_GC_THREAD
+  sem_t                         fs_gcsem;      /* Wakes the GC thread early */
+  sem_t                         fs_gcdone;     /* GC thread exit handshake */
+  volatile bool                 fs_gcrun;      /* true: GC thread keeps running */
+#endif
 };
 
 /****************************************************************************
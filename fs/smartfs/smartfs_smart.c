@@ -28,6 +28,7 @@
 #include <sys/stat.h>
 #include <sys/statfs.h>
 
+#include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
 #include <string.h>
@@ -36,8 +37,11 @@
 #include <errno.h>
 #include <debug.h>
 
+#include <nuttx/clock.h>
 #include <nuttx/kmalloc.h>
+#include <nuttx/kthread.h>
 #include <nuttx/mutex.h>
+#include <nuttx/semaphore.h>
 #include <nuttx/fs/fs.h>
 #include <nuttx/fs/fat.h>
 #include <nuttx/fs/ioctl.h>
@@ -94,6 +98,10 @@ static int     smartfs_readdir(FAR struct inode *mountpt,
 static int     smartfs_rewinddir(FAR struct inode *mountpt,
                         FAR struct fs_dirent_s *dir);
 
+#ifdef CONFIG_SMARTFS_GC_THREAD
+static int     smartfs_gc_thread(int argc, FAR char *argv[]);
+#endif
+
 static int     smartfs_bind(FAR struct inode *blkdriver,
                         FAR const void *data,
                         FAR void **handle);
@@ -1501,6 +1509,60 @@ static int smartfs_rewinddir(FAR struct inode *mountpt,
   return 0;
 }
 
+/****************************************************************************
+ * Name: smartfs_gc_thread
+ *
+ * Description: Background garbage collection thread.  Periodically checks
+ *   the free sector level of the volume and pre-reclaims released sectors
+ *   through the block driver when the level falls below the configured
+ *   reserve, so that collection does not have to run synchronously inside
+ *   a foreground write.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SMARTFS_GC_THREAD
+static int smartfs_gc_thread(int argc, FAR char *argv[])
+{
+  FAR struct smartfs_mountpt_s *fs;
+  struct smart_format_s fmt;
+  int ret;
+
+  fs = (FAR struct smartfs_mountpt_s *)
+       (uintptr_t)strtoul(argv[1], NULL, 16);
+
+  while (fs->fs_gcrun)
+    {
+      /* Wait for the next check interval or an early wakeup at umount */
+
+      nxsem_tickwait(&fs->fs_gcsem,
+                     MSEC2TICK(CONFIG_SMARTFS_GC_THREAD_INTERVAL));
+
+      ret = nxmutex_lock(&g_lock);
+      if (ret < 0)
+        {
+          continue;
+        }
+
+      if (fs->fs_gcrun && fs->fs_mounted)
+        {
+          /* Check the free sector level and pre-reclaim if it is low */
+
+          ret = FS_IOCTL(fs, BIOC_GETFORMAT, (unsigned long)&fmt);
+          if (ret >= 0 &&
+              fmt.nfreesectors < CONFIG_SMARTFS_GC_THREAD_RESERVE)
+            {
+              FS_IOCTL(fs, BIOC_GC, CONFIG_SMARTFS_GC_THREAD_RESERVE);
+            }
+        }
+
+      nxmutex_unlock(&g_lock);
+    }
+
+  nxsem_post(&fs->fs_gcdone);
+  return OK;
+}
+#endif /* CONFIG_SMARTFS_GC_THREAD */
+
 /****************************************************************************
  * Name: smartfs_bind
  *
@@ -1516,6 +1578,10 @@ static int smartfs_bind(FAR struct inode *blkdriver, FAR const void *data,
                         FAR void **handle)
 {
   FAR struct smartfs_mountpt_s *fs;
+#ifdef CONFIG_SMARTFS_GC_THREAD
+  FAR char *argv[2];
+  char arg1[32];
+#endif
   int ret;
 
   /* Open the block driver */
@@ -1565,6 +1631,29 @@ static int smartfs_bind(FAR struct inode *blkdriver, FAR const void *data,
       return ret;
     }
 
+#ifdef CONFIG_SMARTFS_GC_THREAD
+  /* Start the background garbage collection thread for this volume */
+
+  fs->fs_gcrun = true;
+  nxsem_init(&fs->fs_gcsem, 0, 0);
+  nxsem_init(&fs->fs_gcdone, 0, 0);
+
+  snprintf(arg1, sizeof(arg1), "%p", fs);
+  argv[0] = arg1;
+  argv[1] = NULL;
+
+  ret = kthread_create("smartfs_gc", CONFIG_SMARTFS_GC_THREAD_PRIORITY,
+                       CONFIG_SMARTFS_GC_THREAD_STACKSIZE,
+                       smartfs_gc_thread, argv);
+  if (ret < 0)
+    {
+      /* The volume is still usable without background collection */
+
+      fwarn("WARNING: Failed to start GC thread: %d\n", ret);
+      fs->fs_gcrun = false;
+    }
+#endif
+
   *handle = fs;
   nxmutex_unlock(&g_lock);
   return OK;
@@ -1613,6 +1702,25 @@ static int smartfs_unbind(FAR void *handle, FAR struct inode **blkdriver,
     }
   else
     {
+#ifdef CONFIG_SMARTFS_GC_THREAD
+      /* Stop the garbage collection thread before tearing the mount
+       * down.  The lock must be released while waiting for the thread
+       * to exit since it may itself be blocked on the lock.
+       */
+
+      if (fs->fs_gcrun)
+        {
+          fs->fs_gcrun = false;
+          nxsem_post(&fs->fs_gcsem);
+          nxmutex_unlock(&g_lock);
+          nxsem_wait_uninterruptible(&fs->fs_gcdone);
+          nxmutex_lock(&g_lock);
+        }
+
+      nxsem_destroy(&fs->fs_gcsem);
+      nxsem_destroy(&fs->fs_gcdone);
+#endif
+
       /* Unmount ... close the block driver */
 
       ret = smartfs_unmount(fs);
@@ -55,6 +55,15 @@
 #  warning CONFIG_FS_TMPFS_FILE_FREEGUARD needs to be > ALLOCGUARD
 #endif
 
+/* Directory hash table parameters.  A directory carries no hash table until
+ * it holds at least TMPFS_HASH_MINENTRIES entries; smaller directories (and
+ * directories whose table allocation failed) are searched linearly.
+ */
+
+#define TMPFS_HASH_MINENTRIES  16
+#define TMPFS_HASH_MINBUCKETS  16
+#define TMPFS_HASH_MAXBUCKETS  0x8000
+
 #define tmpfs_lock(fs) \
            nxrmutex_lock(&fs->tfs_lock)
 #define tmpfs_lock_object(to) \
@@ -89,6 +98,12 @@ struct tmpfs_dir_s
 
 /* TMPFS helpers */
 
+static uint32_t tmpfs_hash_name(FAR const char *name, size_t len);
+static void tmpfs_hash_insert(FAR struct tmpfs_directory_s *tdo,
+              unsigned int index);
+static void tmpfs_hash_delete(FAR struct tmpfs_directory_s *tdo,
+              unsigned int index);
+static void tmpfs_hash_rebuild(FAR struct tmpfs_directory_s *tdo);
 static int  tmpfs_realloc_directory(FAR struct tmpfs_directory_s *tdo,
               unsigned int nentries);
 static int  tmpfs_realloc_file(FAR struct tmpfs_file_s *tfo,
@@ -214,6 +229,104 @@ const struct mountpt_operations g_tmpfs_operations =
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: tmpfs_hash_name
+ ****************************************************************************/
+
+static uint32_t tmpfs_hash_name(FAR const char *name, size_t len)
+{
+  uint32_t hash = 5381;
+
+  while (len-- > 0)
+    {
+      hash = ((hash << 5) + hash) ^ (uint8_t)*name++;
+    }
+
+  return hash;
+}
+
+/****************************************************************************
+ * Name: tmpfs_hash_insert
+ ****************************************************************************/
+
+static void tmpfs_hash_insert(FAR struct tmpfs_directory_s *tdo,
+                              unsigned int index)
+{
+  FAR struct tmpfs_dirent_s *tde = &tdo->tdo_entry[index];
+  unsigned int bucket;
+
+  bucket              = tde->tde_hash & (tdo->tdo_nbuckets - 1);
+  tde->tde_hnext      = tdo->tdo_bucket[bucket];
+  tdo->tdo_bucket[bucket] = index;
+}
+
+/****************************************************************************
+ * Name: tmpfs_hash_delete
+ ****************************************************************************/
+
+static void tmpfs_hash_delete(FAR struct tmpfs_directory_s *tdo,
+                              unsigned int index)
+{
+  FAR uint16_t *prev;
+  unsigned int bucket;
+
+  bucket = tdo->tdo_entry[index].tde_hash & (tdo->tdo_nbuckets - 1);
+
+  /* Find the chain link that references this entry and unlink it */
+
+  for (prev = &tdo->tdo_bucket[bucket];
+       *prev != TMPFS_HASH_EOC;
+       prev = &tdo->tdo_entry[*prev].tde_hnext)
+    {
+      if (*prev == index)
+        {
+          *prev = tdo->tdo_entry[index].tde_hnext;
+          return;
+        }
+    }
+}
+
+/****************************************************************************
+ * Name: tmpfs_hash_rebuild
+ ****************************************************************************/
+
+static void tmpfs_hash_rebuild(FAR struct tmpfs_directory_s *tdo)
+{
+  FAR uint16_t *bucket;
+  unsigned int nbuckets;
+  unsigned int i;
+
+  /* Pick a power-of-two bucket count of at least one bucket per entry */
+
+  nbuckets = TMPFS_HASH_MINBUCKETS;
+  while (nbuckets < tdo->tdo_nentries && nbuckets < TMPFS_HASH_MAXBUCKETS)
+    {
+      nbuckets <<= 1;
+    }
+
+  /* If the allocation fails, keep any previous (denser but still correct)
+   * hash table; with no table at all the directory is searched linearly.
+   */
+
+  bucket = fs_heap_malloc(nbuckets * sizeof(uint16_t));
+  if (bucket == NULL)
+    {
+      return;
+    }
+
+  fs_heap_free(tdo->tdo_bucket);
+  tdo->tdo_bucket   = bucket;
+  tdo->tdo_nbuckets = nbuckets;
+
+  /* Mark all buckets empty, then re-insert every directory entry */
+
+  memset(bucket, 0xff, nbuckets * sizeof(uint16_t));
+  for (i = 0; i < tdo->tdo_nentries; i++)
+    {
+      tmpfs_hash_insert(tdo, i);
+    }
+}
+
 /****************************************************************************
  * Name: tmpfs_realloc_directory
  ****************************************************************************/
@@ -325,6 +438,17 @@ static int tmpfs_realloc_file(FAR struct tmpfs_file_s *tfo,
       return -ENOMEM;
     }
 
+  /* When growing, grow the allocation at least geometrically so that a
+   * file built up from many small appends is copied O(log n) times
+   * rather than once per ALLOCGUARD bytes written.
+   */
+
+  if (newsize > tfo->tfo_alloc &&
+      allocsize < tfo->tfo_alloc + (tfo->tfo_alloc >> 1))
+    {
+      allocsize = tfo->tfo_alloc + (tfo->tfo_alloc >> 1);
+    }
+
   /* Realloc the file object */
 
   newdata = fs_heap_realloc(tfo->tfo_data, allocsize);
@@ -420,6 +544,8 @@ static int tmpfs_release_file(FAR struct tmpfs_file_s *tfo)
 static int tmpfs_find_dirent(FAR struct tmpfs_directory_s *tdo,
                              FAR const char *name, size_t len)
 {
+  uint32_t hash;
+  uint16_t next;
   int i;
 
   if (len == 0)
@@ -436,7 +562,30 @@ static int tmpfs_find_dirent(FAR struct tmpfs_directory_s *tdo,
         }
     }
 
-  /* Search the list of directory entries for a match */
+  /* Search the hash chain for the name, if this directory has a hash
+   * table.
+   */
+
+  if (tdo->tdo_bucket != NULL)
+    {
+      hash = tmpfs_hash_name(name, len);
+
+      for (next = tdo->tdo_bucket[hash & (tdo->tdo_nbuckets - 1)];
+           next != TMPFS_HASH_EOC;
+           next = tdo->tdo_entry[next].tde_hnext)
+        {
+          if (tdo->tdo_entry[next].tde_hash == hash &&
+              strncmp(tdo->tdo_entry[next].tde_name, name, len) == 0 &&
+              tdo->tdo_entry[next].tde_name[len] == 0)
+            {
+              return next;
+            }
+        }
+
+      return -ENOENT;
+    }
+
+  /* Otherwise, search the list of directory entries for a match */
 
   for (i = 0;
        i < tdo->tdo_nentries &&
@@ -477,9 +626,26 @@ static int tmpfs_remove_dirent(FAR struct tmpfs_directory_s *tdo,
   /* Remove by replacing this entry with the final directory entry */
 
   last = tdo->tdo_nentries - 1;
+  if (tdo->tdo_bucket != NULL)
+    {
+      /* Unlink both the removed entry and the final entry from their hash
+       * chains; the final entry is re-inserted below at its new index.
+       */
+
+      tmpfs_hash_delete(tdo, index);
+      if (index != last)
+        {
+          tmpfs_hash_delete(tdo, last);
+        }
+    }
+
   if (index != last)
     {
       tdo->tdo_entry[index] = tdo->tdo_entry[last];
+      if (tdo->tdo_bucket != NULL)
+        {
+          tmpfs_hash_insert(tdo, index);
+        }
     }
 
   /* And decrement the count of directory entries */
@@ -546,6 +712,25 @@ static int tmpfs_add_dirent(FAR struct tmpfs_directory_s *tdo,
   tde             = &tdo->tdo_entry[index];
   tde->tde_object = to;
   tde->tde_name   = newname;
+  tde->tde_hash   = tmpfs_hash_name(newname, namelen);
+  tde->tde_hnext  = TMPFS_HASH_EOC;
+
+  /* Add the new entry to the directory hash table, creating or growing the
+   * table once the directory is large enough to profit from one.
+   */
+
+  if (tdo->tdo_bucket != NULL)
+    {
+      tmpfs_hash_insert(tdo, index);
+      if (nentries > tdo->tdo_nbuckets)
+        {
+          tmpfs_hash_rebuild(tdo);
+        }
+    }
+  else if (nentries >= TMPFS_HASH_MINENTRIES)
+    {
+      tmpfs_hash_rebuild(tdo);
+    }
 
   return OK;
 }
@@ -726,7 +911,9 @@ tmpfs_alloc_directory(FAR struct tmpfs_directory_s *parent)
   tdo->tdo_refs     = 0;
   tdo->tdo_parent   = parent;
   tdo->tdo_nentries = 0;
+  tdo->tdo_nbuckets = 0;
   tdo->tdo_entry    = NULL;
+  tdo->tdo_bucket   = NULL;
 
   nxrmutex_init(&tdo->tdo_lock);
 
@@ -1225,11 +1412,28 @@ static int tmpfs_free_callout(FAR struct tmpfs_directory_s *tdo,
   to   = tde->tde_object;
   last = tdo->tdo_nentries - 1;
 
+  if (tdo->tdo_bucket != NULL)
+    {
+      /* Unlink both the removed entry and the final entry from their hash
+       * chains; the final entry is re-inserted below at its new index.
+       */
+
+      tmpfs_hash_delete(tdo, index);
+      if (index != last)
+        {
+          tmpfs_hash_delete(tdo, last);
+        }
+    }
+
   if (index != last)
     {
       /* Move the directory entry */
 
       *tde = tdo->tdo_entry[last];
+      if (tdo->tdo_bucket != NULL)
+        {
+          tmpfs_hash_insert(tdo, index);
+        }
     }
 
   /* And decrement the count of directory entries */
@@ -1258,6 +1462,7 @@ static int tmpfs_free_callout(FAR struct tmpfs_directory_s *tdo,
     {
       tdo = (FAR struct tmpfs_directory_s *)to;
 
+      fs_heap_free(tdo->tdo_bucket);
       fs_heap_free(tdo->tdo_entry);
     }
 
@@ -2246,6 +2451,7 @@ static int tmpfs_unbind(FAR void *handle, FAR struct inode **blkdriver,
   /* Now we can destroy the root file system and the file system itself. */
 
   nxrmutex_destroy(&tdo->tdo_lock);
+  fs_heap_free(tdo->tdo_bucket);
   fs_heap_free(tdo->tdo_entry);
   fs_heap_free(tdo);
 
@@ -2555,6 +2761,7 @@ static int tmpfs_rmdir(FAR struct inode *mountpt, FAR const char *relpath)
   /* Free the directory object */
 
   nxrmutex_destroy(&tdo->tdo_lock);
+  fs_heap_free(tdo->tdo_bucket);
   fs_heap_free(tdo->tdo_entry);
   fs_heap_free(tdo);
 
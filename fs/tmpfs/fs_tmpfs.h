@@ -40,6 +40,10 @@
 
 #define TFO_FLAG_UNLINKED (1 << 0)  /* Bit 0: File is unlinked */
 
+/* Value of tde_hnext marking the end of a directory hash chain */
+
+#define TMPFS_HASH_EOC    UINT16_MAX
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -68,6 +72,8 @@ struct tmpfs_dirent_s
 {
   FAR struct tmpfs_object_s *tde_object;
   FAR char *tde_name;
+  uint32_t tde_hash;     /* Hash of tde_name */
+  uint16_t tde_hnext;    /* Index of the next entry in the same hash chain */
 };
 
 /* The generic form of a TMPFS memory object */
@@ -98,7 +104,11 @@ struct tmpfs_directory_s
   /* Remaining fields are unique to a directory object */
 
   uint16_t tdo_nentries; /* Number of directory entries */
+  uint16_t tdo_nbuckets; /* Number of hash buckets (power of two, or zero) */
   FAR struct tmpfs_dirent_s *tdo_entry;
+  FAR uint16_t *tdo_bucket; /* Head entry index of each hash chain.  May be
+                             * NULL in which case directory entries are
+                             * searched linearly. */
 };
 
 #define SIZEOF_TMPFS_DIRECTORY(n) ((n) * sizeof(struct tmpfs_dirent_s))
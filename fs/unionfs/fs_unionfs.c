@@ -72,6 +72,19 @@ struct unionfs_mountpt_s
   FAR char *um_prefix;               /* Path prefix to filesystem */
 };
 
+#ifdef CONFIG_FS_UNIONFS_CACHE
+/* This structure is one slot in the direct-mapped branch residency cache.
+ * The cache remembers which contained file system holds a relative path so
+ * that steady-state lookups probe only the owning branch.
+ */
+
+struct unionfs_cache_s
+{
+  FAR char *uc_path;                 /* Relative path, NULL if slot empty */
+  uint8_t uc_ndx;                    /* Index of the owning file system */
+};
+#endif
+
 /* This structure describes the union file system */
 
 struct unionfs_inode_s
@@ -80,6 +93,9 @@ struct unionfs_inode_s
   mutex_t ui_lock;                   /* Enforces mutually exclusive access */
   int16_t ui_nopen;                  /* Number of open references */
   bool ui_unmounted;                 /* File system has been unmounted */
+#ifdef CONFIG_FS_UNIONFS_CACHE
+  FAR struct unionfs_cache_s *ui_cache; /* Branch residency cache */
+#endif
 };
 
 /* This structure descries one opened file */
@@ -100,6 +116,17 @@ static FAR const char *unionfs_offsetpath(FAR const char *relpath,
                                           FAR const char *prefix);
 static bool    unionfs_ispartprefix(FAR const char *partprefix,
                                     FAR const char *prefix);
+#ifdef CONFIG_FS_UNIONFS_CACHE
+static FAR struct unionfs_cache_s *
+               unionfs_cache_probe(FAR struct unionfs_inode_s *ui,
+                                   FAR const char *relpath);
+static int     unionfs_cache_get(FAR struct unionfs_inode_s *ui,
+                                 FAR const char *relpath);
+static void    unionfs_cache_put(FAR struct unionfs_inode_s *ui,
+                                 FAR const char *relpath, uint8_t ndx);
+static void    unionfs_cache_drop(FAR struct unionfs_inode_s *ui,
+                                  FAR const char *relpath);
+#endif
 static int     unionfs_tryopen(FAR struct file *filep,
                                FAR const char *relpath,
                                FAR const char *prefix, int oflags,
@@ -385,6 +412,123 @@ static bool unionfs_ispartprefix(FAR const char *partprefix,
     }
 }
 
+/****************************************************************************
+ * Name: unionfs_cache_probe
+ *
+ * Description:
+ *   Return the residency cache slot for the given relative path, or NULL
+ *   if the cache was not allocated.  The cache is direct-mapped:  Each
+ *   path hashes to exactly one slot.  The caller must hold ui_lock.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_UNIONFS_CACHE
+static FAR struct unionfs_cache_s *
+unionfs_cache_probe(FAR struct unionfs_inode_s *ui, FAR const char *relpath)
+{
+  uint32_t hash = 0;
+  FAR const char *p;
+
+  if (ui->ui_cache == NULL)
+    {
+      return NULL;
+    }
+
+  for (p = relpath; *p != '\0'; p++)
+    {
+      hash = hash * 31 + (uint8_t)*p;
+    }
+
+  return &ui->ui_cache[hash % CONFIG_FS_UNIONFS_CACHE_SIZE];
+}
+
+/****************************************************************************
+ * Name: unionfs_cache_get
+ *
+ * Description:
+ *   Return the index of the branch known to hold the given relative path,
+ *   or -ENOENT if the path is not cached.  The caller must hold ui_lock.
+ *
+ ****************************************************************************/
+
+static int unionfs_cache_get(FAR struct unionfs_inode_s *ui,
+                             FAR const char *relpath)
+{
+  FAR struct unionfs_cache_s *uc = unionfs_cache_probe(ui, relpath);
+
+  if (uc != NULL && uc->uc_path != NULL &&
+      strcmp(uc->uc_path, relpath) == 0)
+    {
+      return uc->uc_ndx;
+    }
+
+  return -ENOENT;
+}
+
+/****************************************************************************
+ * Name: unionfs_cache_put
+ *
+ * Description:
+ *   Remember which branch holds the given relative path, evicting whatever
+ *   the slot held before.  The caller must hold ui_lock.
+ *
+ ****************************************************************************/
+
+static void unionfs_cache_put(FAR struct unionfs_inode_s *ui,
+                              FAR const char *relpath, uint8_t ndx)
+{
+  FAR struct unionfs_cache_s *uc = unionfs_cache_probe(ui, relpath);
+  size_t len;
+  FAR char *copy;
+
+  if (uc == NULL)
+    {
+      return;
+    }
+
+  len  = strlen(relpath);
+  copy = fs_heap_malloc(len + 1);
+  if (copy == NULL)
+    {
+      /* Just skip caching this lookup */
+
+      return;
+    }
+
+  if (uc->uc_path != NULL)
+    {
+      fs_heap_free(uc->uc_path);
+    }
+
+  memcpy(copy, relpath, len + 1);
+  uc->uc_path = copy;
+  uc->uc_ndx  = ndx;
+}
+
+/****************************************************************************
+ * Name: unionfs_cache_drop
+ *
+ * Description:
+ *   Forget any cached residency for the given relative path.  Called when
+ *   an operation may change which branch holds the path.  The caller must
+ *   hold ui_lock.
+ *
+ ****************************************************************************/
+
+static void unionfs_cache_drop(FAR struct unionfs_inode_s *ui,
+                               FAR const char *relpath)
+{
+  FAR struct unionfs_cache_s *uc = unionfs_cache_probe(ui, relpath);
+
+  if (uc != NULL && uc->uc_path != NULL &&
+      strcmp(uc->uc_path, relpath) == 0)
+    {
+      fs_heap_free(uc->uc_path);
+      uc->uc_path = NULL;
+    }
+}
+#endif /* CONFIG_FS_UNIONFS_CACHE */
+
 /****************************************************************************
  * Name: unionfs_tryopen
  ****************************************************************************/
@@ -848,6 +992,25 @@ static void unionfs_destroy(FAR struct unionfs_inode_s *ui)
       lib_free(ui->ui_fs[1].um_prefix);
     }
 
+#ifdef CONFIG_FS_UNIONFS_CACHE
+  /* Free the branch residency cache and the cached path strings */
+
+  if (ui->ui_cache != NULL)
+    {
+      int i;
+
+      for (i = 0; i < CONFIG_FS_UNIONFS_CACHE_SIZE; i++)
+        {
+          if (ui->ui_cache[i].uc_path != NULL)
+            {
+              fs_heap_free(ui->ui_cache[i].uc_path);
+            }
+        }
+
+      fs_heap_free(ui->ui_cache);
+    }
+#endif
+
   /* And finally free the allocated unionfs state structure as well */
 
   nxmutex_destroy(&ui->ui_lock);
@@ -890,6 +1053,38 @@ static int unionfs_open(FAR struct file *filep, FAR const char *relpath,
       goto errout_with_lock;
     }
 
+#ifdef CONFIG_FS_UNIONFS_CACHE
+  /* A create may change which branch owns the path, so it must follow the
+   * normal search order with any cached residency forgotten.
+   */
+
+  if ((oflags & O_CREAT) != 0)
+    {
+      unionfs_cache_drop(ui, relpath);
+    }
+  else if (unionfs_cache_get(ui, relpath) == 1)
+    {
+      /* The path is known to reside only on file system 2 */
+
+      um = &ui->ui_fs[1];
+
+      uf->uf_file.f_oflags = filep->f_oflags;
+      uf->uf_file.f_inode  = um->um_node;
+
+      ret = unionfs_tryopen(&uf->uf_file, relpath, um->um_prefix, oflags,
+                            mode);
+      if (ret >= 0)
+        {
+          uf->uf_ndx = 1;
+          goto bookkeeping;
+        }
+
+      /* The cached entry was stale.. fall back to the normal search */
+
+      unionfs_cache_drop(ui, relpath);
+    }
+#endif
+
   /* Try to open the file on file system 1 */
 
   um = &ui->ui_fs[0];
@@ -927,6 +1122,17 @@ static int unionfs_open(FAR struct file *filep, FAR const char *relpath,
       uf->uf_ndx = 1;
     }
 
+#ifdef CONFIG_FS_UNIONFS_CACHE
+  /* Remember the owning branch for the next lookup of this path */
+
+  if ((oflags & O_CREAT) == 0)
+    {
+      unionfs_cache_put(ui, relpath, uf->uf_ndx);
+    }
+
+bookkeeping:
+#endif
+
   /* Increment the open reference count */
 
   ui->ui_nopen++;
@@ -2177,6 +2383,16 @@ static int unionfs_unlink(FAR struct inode *mountpt,
               relpath != NULL);
   ui = mountpt->i_private;
 
+#ifdef CONFIG_FS_UNIONFS_CACHE
+  /* Removing the path may expose a shadowed copy on the other branch */
+
+  if (nxmutex_lock(&ui->ui_lock) == OK)
+    {
+      unionfs_cache_drop(ui, relpath);
+      nxmutex_unlock(&ui->ui_lock);
+    }
+#endif
+
   /* Check if some exists at this path on file system 1.  This might be
    * a file or a directory
    */
@@ -2241,6 +2457,16 @@ static int unionfs_mkdir(FAR struct inode *mountpt, FAR const char *relpath,
               relpath != NULL);
   ui = mountpt->i_private;
 
+#ifdef CONFIG_FS_UNIONFS_CACHE
+  /* The new directory may change the owning branch of the path */
+
+  if (nxmutex_lock(&ui->ui_lock) == OK)
+    {
+      unionfs_cache_drop(ui, relpath);
+      nxmutex_unlock(&ui->ui_lock);
+    }
+#endif
+
   /* Is there anything with this name on either file system? */
 
   um  = &ui->ui_fs[0];
@@ -2292,6 +2518,18 @@ static int unionfs_rmdir(FAR struct inode *mountpt, FAR const char *relpath)
               relpath != NULL);
   ui = mountpt->i_private;
 
+#ifdef CONFIG_FS_UNIONFS_CACHE
+  /* Removing the directory may expose a shadowed copy on the other
+   * branch
+   */
+
+  if (nxmutex_lock(&ui->ui_lock) == OK)
+    {
+      unionfs_cache_drop(ui, relpath);
+      nxmutex_unlock(&ui->ui_lock);
+    }
+#endif
+
   /* We really don't know any better so we will try to remove the directory
    * from both file systems.
    */
@@ -2357,6 +2595,17 @@ static int unionfs_rename(FAR struct inode *mountpt,
 
   DEBUGASSERT(oldrelpath != NULL && oldrelpath != NULL);
 
+#ifdef CONFIG_FS_UNIONFS_CACHE
+  /* The rename may change the owning branch of both paths */
+
+  if (nxmutex_lock(&ui->ui_lock) == OK)
+    {
+      unionfs_cache_drop(ui, oldrelpath);
+      unionfs_cache_drop(ui, newrelpath);
+      nxmutex_unlock(&ui->ui_lock);
+    }
+#endif
+
   /* Is there a file with this name on file system 1 */
 
   um   = &ui->ui_fs[0];
@@ -2420,6 +2669,38 @@ static int unionfs_stat(FAR struct inode *mountpt, FAR const char *relpath,
               relpath != NULL);
   ui = mountpt->i_private;
 
+#ifdef CONFIG_FS_UNIONFS_CACHE
+  /* Check whether a previous lookup found this path only on file
+   * system 2.  In that case we can skip the failing stat of file
+   * system 1.
+   */
+
+  ret = -ENOENT;
+  if (nxmutex_lock(&ui->ui_lock) == OK)
+    {
+      ret = unionfs_cache_get(ui, relpath);
+      nxmutex_unlock(&ui->ui_lock);
+    }
+
+  if (ret == 1)
+    {
+      um  = &ui->ui_fs[1];
+      ret = unionfs_trystat(um->um_node, relpath, um->um_prefix, buf);
+      if (ret >= 0)
+        {
+          return OK;
+        }
+
+      /* The cached entry was stale.. fall back to the normal search */
+
+      if (nxmutex_lock(&ui->ui_lock) == OK)
+        {
+          unionfs_cache_drop(ui, relpath);
+          nxmutex_unlock(&ui->ui_lock);
+        }
+    }
+#endif
+
   /* stat this path on file system 1 */
 
   um  = &ui->ui_fs[0];
@@ -2439,10 +2720,18 @@ static int unionfs_stat(FAR struct inode *mountpt, FAR const char *relpath,
   ret = unionfs_trystat(um->um_node, relpath, um->um_prefix, buf);
   if (ret >= 0)
     {
-      /* Return on the first success.  The first instance of the file will
-       * shadow the second anyway.
+      /* Remember that this path resides only on file system 2 so that
+       * the next lookup can go there directly.
        */
 
+#ifdef CONFIG_FS_UNIONFS_CACHE
+      if (nxmutex_lock(&ui->ui_lock) == OK)
+        {
+          unionfs_cache_put(ui, relpath, 1);
+          nxmutex_unlock(&ui->ui_lock);
+        }
+#endif
+
       return OK;
     }
 
@@ -2605,6 +2894,15 @@ static int unionfs_dobind(FAR const char *fspath1, FAR const char *prefix1,
 
   nxmutex_init(&ui->ui_lock);
 
+#ifdef CONFIG_FS_UNIONFS_CACHE
+  /* Allocate the branch residency cache.  The union still works without
+   * it if the allocation fails; lookups then simply probe both branches.
+   */
+
+  ui->ui_cache = fs_heap_zalloc(CONFIG_FS_UNIONFS_CACHE_SIZE *
+                                sizeof(struct unionfs_cache_s));
+#endif
+
   /* Get the inodes associated with fspath1 and fspath2 */
 
   ret = unionfs_getmount(fspath1, &ui->ui_fs[0].um_node);
@@ -2671,6 +2969,9 @@ errout_with_fs1:
   inode_release(ui->ui_fs[0].um_node);
 
 errout_with_uinode:
+#ifdef CONFIG_FS_UNIONFS_CACHE
+  fs_heap_free(ui->ui_cache);
+#endif
   nxmutex_destroy(&ui->ui_lock);
   fs_heap_free(ui);
   return ret;
@@ -465,7 +465,8 @@ static ssize_t dir_read(FAR struct file *filep, FAR char *buffer,
 #ifndef CONFIG_DISABLE_MOUNTPOINT
   FAR struct inode *inode = dir->fd_root;
 #endif
-  int ret;
+  size_t nread = 0;
+  int ret = 0;
 
   /* Verify that we were provided with a valid directory structure */
 
@@ -474,38 +475,53 @@ static ssize_t dir_read(FAR struct file *filep, FAR char *buffer,
       return -EINVAL;
     }
 
-  /* The way we handle the readdir depends on the type of inode
-   * that we are dealing with.
+  /* Fill the caller's buffer with as many entries as fit, getdents()
+   * style, so that a directory scan costs one read per buffer rather
+   * than one read per entry.  readdir() passes a buffer of exactly one
+   * entry and is unaffected.
    */
 
-#ifndef CONFIG_DISABLE_MOUNTPOINT
-  if (INODE_IS_MOUNTPT(inode))
-    {
-      ret = inode->u.i_mops->readdir(inode, dir,
-                                     (FAR struct dirent *)buffer);
-    }
-  else
-#endif
+  while (buflen - nread >= sizeof(struct dirent))
     {
-      /* The node is part of the root pseudo file system */
+      /* The way we handle the readdir depends on the type of inode
+       * that we are dealing with.
+       */
 
-      ret = read_pseudodir(dir, (FAR struct dirent *)buffer);
-    }
+#ifndef CONFIG_DISABLE_MOUNTPOINT
+      if (INODE_IS_MOUNTPT(inode))
+        {
+          ret = inode->u.i_mops->readdir(inode, dir,
+                                         (FAR struct dirent *)
+                                         &buffer[nread]);
+        }
+      else
+#endif
+        {
+          /* The node is part of the root pseudo file system */
 
-  /* ret < 0 is an error. Special case: ret = -ENOENT is end of file */
+          ret = read_pseudodir(dir, (FAR struct dirent *)&buffer[nread]);
+        }
 
-  if (ret < 0)
-    {
-      if (ret == -ENOENT)
+      if (ret < 0)
         {
-          ret = 0;
+          break;
         }
 
+      filep->f_pos++;
+      nread += sizeof(struct dirent);
+    }
+
+  /* ret < 0 is an error. Special cases: ret = -ENOENT is the end of the
+   * directory, and an error after some entries have already been
+   * returned is reported on the next call instead.
+   */
+
+  if (nread == 0 && ret < 0 && ret != -ENOENT)
+    {
       return ret;
     }
 
-  filep->f_pos++;
-  return sizeof(struct dirent);
+  return nread;
 }
 
 static off_t dir_seek(FAR struct file *filep, off_t offset, int whence)
@@ -40,6 +40,7 @@
 #include <nuttx/list.h>
 #include <nuttx/mutex.h>
 #include <nuttx/signal.h>
+#include <nuttx/spinlock.h>
 
 #include "inode/inode.h"
 #include "fs_heap.h"
@@ -51,8 +52,9 @@
 struct epoll_node_s
 {
   struct list_node         node;
+  struct list_node         rnode;    /* Supports the ready list */
   epoll_data_t             data;
-  bool                     notified;
+  bool                     notified; /* True: the node is on the ready list */
   struct pollfd            pfd;
   FAR struct epoll_head_s *eph;
 };
@@ -65,6 +67,16 @@ struct epoll_head_s
   int                   crefs;
   mutex_t               lock;
   sem_t                 sem;
+  spinlock_t            ready_lock; /* Protects the ready list, which is
+                                     * filled by the poll callback possibly
+                                     * from the interrupt context.
+                                     */
+  struct list_node      ready;    /* The ready list, the poll callback moves
+                                   * the epoll node here at event time so
+                                   * that epoll_wait() only has to drain
+                                   * this list instead of scanning all the
+                                   * registered fds.
+                                   */
   struct list_node      setup;    /* The setup list, store all the setuped
                                    * epoll node.
                                    */
@@ -235,11 +247,13 @@ static int epoll_do_create(int size, int flags)
   eph->size = size;
   nxmutex_init(&eph->lock);
   nxsem_init(&eph->sem, 0, 0);
+  spin_lock_init(&eph->ready_lock);
 
   /* List initialize */
 
   epn = (FAR epoll_node_t *)(eph + 1);
 
+  list_initialize(&eph->ready);
   list_initialize(&eph->setup);
   list_initialize(&eph->teardown);
   list_initialize(&eph->oneshot);
@@ -266,6 +280,37 @@ static int epoll_do_create(int size, int flags)
   return fd;
 }
 
+/****************************************************************************
+ * Name: epoll_ready_remove
+ *
+ * Description:
+ *   Remove the epoll node from the ready list if the poll callback has
+ *   queued it there.  Used before the node is re-armed, modified or freed.
+ *   The caller must hold the epoll head lock.
+ *
+ * Input Parameters:
+ *   eph - The epoll head pointer
+ *   epn - The epoll node pointer
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+static void epoll_ready_remove(FAR epoll_head_t *eph, FAR epoll_node_t *epn)
+{
+  irqstate_t flags;
+
+  flags = spin_lock_irqsave(&eph->ready_lock);
+  if (epn->notified)
+    {
+      list_delete(&epn->rnode);
+      epn->notified = false;
+    }
+
+  spin_unlock_irqrestore(&eph->ready_lock, flags);
+}
+
 /****************************************************************************
  * Name: epoll_setup
  *
@@ -320,8 +365,10 @@ static int epoll_setup(FAR epoll_head_t *eph)
  * Name: epoll_teardown
  *
  * Description:
- *   Teardown all the notifed fd and check the notified fd's event with user
- *   expected event.
+ *   Drain the ready list filled by the poll callbacks at event time and
+ *   check the notified fd's event with user expected event.  The cost is
+ *   proportional to the number of ready fds, not to the number of
+ *   registered fds.
  *
  * Input Parameters:
  *   eph       - The epoll head pointer
@@ -337,45 +384,79 @@ static int epoll_setup(FAR epoll_head_t *eph)
 static int epoll_teardown(FAR epoll_head_t *eph, FAR struct epoll_event *evs,
                           int maxevents)
 {
-  FAR epoll_node_t *tepn;
   FAR epoll_node_t *epn;
+  irqstate_t flags;
+  pollevent_t revents;
+  int semcount;
   int i = 0;
 
   nxmutex_lock(&eph->lock);
 
-  list_for_every_entry_safe(&eph->setup, epn, tepn, epoll_node_t, node)
+  flags = spin_lock_irqsave(&eph->ready_lock);
+  while (i < maxevents && !list_is_empty(&eph->ready))
     {
-      /* Only check the notifed fd */
-
-      if (!epn->notified)
-        {
-          continue;
-        }
-
-      /* Teradown all the notified fd */
+      /* Take the oldest ready node and latch its events.  Once 'notified'
+       * is cleared the poll callback may queue the node again for any new
+       * event.
+       */
 
-      poll_fdsetup(epn->pfd.fd, &epn->pfd, false);
-      list_delete(&epn->node);
+      epn = container_of(list_remove_head(&eph->ready), epoll_node_t,
+                         rnode);
+      revents          = epn->pfd.revents;
+      epn->pfd.revents = 0;
+      epn->notified    = false;
+      spin_unlock_irqrestore(&eph->ready_lock, flags);
 
-      if (epn->pfd.revents != 0 && i < maxevents)
+      if (revents != 0)
         {
           evs[i].data     = epn->data;
-          evs[i++].events = epn->pfd.revents;
+          evs[i++].events = revents;
           if ((epn->pfd.events & EPOLLONESHOT) != 0)
             {
+              /* Disarm the fd until EPOLL_CTL_MOD rearms it */
+
+              poll_fdsetup(epn->pfd.fd, &epn->pfd, false);
+              list_delete(&epn->node);
               list_add_tail(&eph->oneshot, &epn->node);
             }
+          else if ((epn->pfd.events & EPOLLET) != 0)
+            {
+              /* Edge-triggered:  Leave the fd armed.  The poll callback
+               * will queue it again on the next event with no more work
+               * needed here.
+               */
+            }
           else
             {
+              /* Level-triggered:  Disarm the fd and let the next
+               * epoll_wait() set it up again so that a still-pending
+               * event is reported again.
+               */
+
+              poll_fdsetup(epn->pfd.fd, &epn->pfd, false);
+              list_delete(&epn->node);
               list_add_tail(&eph->teardown, &epn->node);
             }
         }
-      else
+
+      flags = spin_lock_irqsave(&eph->ready_lock);
+    }
+
+  /* If ready fds remain (more than maxevents were ready), make sure the
+   * next epoll_wait() wakes up immediately to report them.
+   */
+
+  if (!list_is_empty(&eph->ready))
+    {
+      semcount = 0;
+      nxsem_get_value(&eph->sem, &semcount);
+      if (semcount < 1)
         {
-          list_add_tail(&eph->teardown, &epn->node);
+          nxsem_post(&eph->sem);
         }
     }
 
+  spin_unlock_irqrestore(&eph->ready_lock, flags);
   nxmutex_unlock(&eph->lock);
   return i;
 }
@@ -398,16 +479,32 @@ static int epoll_teardown(FAR epoll_head_t *eph, FAR struct epoll_event *evs,
 static void epoll_default_cb(FAR struct pollfd *fds)
 {
   FAR epoll_node_t *epn = fds->arg;
+  FAR epoll_head_t *eph = epn->eph;
+  irqstate_t flags;
   int semcount = 0;
 
-  epn->notified = true;
-  if (fds->revents != 0)
+  if (fds->revents == 0)
     {
-      nxsem_get_value(&epn->eph->sem, &semcount);
-      if (semcount < 1)
-        {
-          nxsem_post(&epn->eph->sem);
-        }
+      return;
+    }
+
+  /* Move the node to the ready list (unless it is already there) so that
+   * epoll_wait() finds it without scanning all the registered fds.
+   */
+
+  flags = spin_lock_irqsave(&eph->ready_lock);
+  if (!epn->notified)
+    {
+      epn->notified = true;
+      list_add_tail(&eph->ready, &epn->rnode);
+    }
+
+  spin_unlock_irqrestore(&eph->ready_lock, flags);
+
+  nxsem_get_value(&eph->sem, &semcount);
+  if (semcount < 1)
+    {
+      nxsem_post(&eph->sem);
     }
 }
 
@@ -580,6 +677,7 @@ int epoll_ctl(int epfd, int op, int fd, FAR struct epoll_event *ev)
             if (epn->pfd.fd == fd)
               {
                 poll_fdsetup(fd, &epn->pfd, false);
+                epoll_ready_remove(eph, epn);
                 list_delete(&epn->node);
                 list_add_tail(&eph->free, &epn->node);
                 goto out;
@@ -617,8 +715,8 @@ int epoll_ctl(int epfd, int op, int fd, FAR struct epoll_event *ev)
                 if (epn->pfd.events != (ev->events | POLLALWAYS))
                   {
                     poll_fdsetup(fd, &epn->pfd, false);
+                    epoll_ready_remove(eph, epn);
 
-                    epn->notified    = false;
                     epn->data        = ev->data;
                     epn->pfd.events  = ev->events | POLLALWAYS;
                     epn->pfd.fd      = fd;
@@ -242,7 +242,15 @@ static int file_vopen(FAR struct file *filep, FAR const char *path,
     {
       if (inode->u.i_mops->open != NULL)
         {
+#ifdef CONFIG_FS_LATENCY
+          clock_t start = perf_gettime();
+#endif
+
           ret = inode->u.i_mops->open(filep, desc.relpath, oflags, mode);
+
+#ifdef CONFIG_FS_LATENCY
+          fslat_record(inode, FSLAT_OPEN, perf_gettime() - start);
+#endif
         }
     }
 #endif
@@ -49,6 +49,7 @@
 struct pollfd_s
 {
   FAR struct pollfd *fds;
+  FAR struct file **fileps;
   nfds_t nfds;
 };
 
@@ -65,7 +66,7 @@ struct pollfd_s
  ****************************************************************************/
 
 static inline int poll_setup(FAR struct pollfd *fds, nfds_t nfds,
-                             FAR sem_t *sem)
+                             FAR struct file **fileps, FAR sem_t *sem)
 {
   unsigned int i;
   unsigned int j;
@@ -88,6 +89,7 @@ static inline int poll_setup(FAR struct pollfd *fds, nfds_t nfds,
       fds[i].cb      = poll_default_cb;
       fds[i].revents = 0;
       fds[i].priv    = NULL;
+      fileps[i]      = NULL;
 
       /* Check for invalid descriptors. "If the value of fd is less than 0,
        * events shall be ignored, and revents shall be set to 0 in that entry
@@ -100,7 +102,18 @@ static inline int poll_setup(FAR struct pollfd *fds, nfds_t nfds,
 
       if (fds[i].fd >= 0)
         {
-          ret = poll_fdsetup(fds[i].fd, &fds[i], true);
+          /* Look up the file only once per poll() call.  The reference is
+           * held until poll_teardown() so that the driver registration
+           * stays valid even if the descriptor is closed while we wait,
+           * and so that the teardown walk does not have to take the
+           * descriptor table lock again for every fd.
+           */
+
+          ret = fs_getfilep(fds[i].fd, &fileps[i]);
+          if (ret >= 0)
+            {
+              ret = file_poll(fileps[i], &fds[i], true);
+            }
         }
 
       if (ret < 0)
@@ -111,9 +124,20 @@ static inline int poll_setup(FAR struct pollfd *fds, nfds_t nfds,
            * and 'sem'.
            */
 
+          if (fileps[i] != NULL)
+            {
+              fs_putfilep(fileps[i]);
+              fileps[i] = NULL;
+            }
+
           for (j = 0; j < i; j++)
             {
-              poll_fdsetup(fds[j].fd, &fds[j], false);
+              if (fileps[j] != NULL)
+                {
+                  file_poll(fileps[j], &fds[j], false);
+                  fs_putfilep(fileps[j]);
+                  fileps[j] = NULL;
+                }
             }
 
           /* Indicate an error on the file descriptor */
@@ -136,24 +160,27 @@ static inline int poll_setup(FAR struct pollfd *fds, nfds_t nfds,
  ****************************************************************************/
 
 static inline int poll_teardown(FAR struct pollfd *fds, nfds_t nfds,
+                                FAR struct file **fileps,
                                 FAR int *count, int ret)
 {
   unsigned int i;
-  int status = OK;
+  int status;
 
   /* Process each descriptor in the list */
 
   *count = 0;
   for (i = 0; i < nfds; i++)
     {
-      if (fds[i].fd >= 0)
+      if (fileps[i] != NULL)
         {
-          status = poll_fdsetup(fds[i].fd, &fds[i], false);
-        }
+          status = file_poll(fileps[i], &fds[i], false);
+          fs_putfilep(fileps[i]);
+          fileps[i] = NULL;
 
-      if (status < 0)
-        {
-          ret = status;
+          if (status < 0)
+            {
+              ret = status;
+            }
         }
 
       /* Check if any events were posted */
@@ -185,7 +212,7 @@ static void poll_cleanup(FAR void *arg)
   FAR struct pollfd_s *fdsinfo = (FAR struct pollfd_s *)arg;
   int count;
 
-  poll_teardown(fdsinfo->fds, fdsinfo->nfds, &count, OK);
+  poll_teardown(fdsinfo->fds, fdsinfo->nfds, fdsinfo->fileps, &count, OK);
 }
 
 /****************************************************************************
@@ -422,6 +449,7 @@ int file_poll(FAR struct file *filep, FAR struct pollfd *fds, bool setup)
 int poll(FAR struct pollfd *fds, nfds_t nfds, int timeout)
 {
   FAR struct pollfd *kfds;
+  FAR struct file **fileps;
   sem_t sem;
   int count = 0;
   int ret2;
@@ -434,9 +462,12 @@ int poll(FAR struct pollfd *fds, nfds_t nfds, int timeout)
   enter_cancellation_point();
 
 #ifdef CONFIG_BUILD_KERNEL
-  /* Allocate kernel memory for the fds */
+  /* Allocate kernel memory for the fds and for the cache of file
+   * references that are held from setup to teardown.
+   */
 
-  kfds = fs_heap_malloc(nfds * sizeof(struct pollfd));
+  kfds = fs_heap_malloc(nfds * (sizeof(struct pollfd) +
+                                sizeof(FAR struct file *)));
   if (!kfds)
     {
       /* Out of memory */
@@ -445,6 +476,8 @@ int poll(FAR struct pollfd *fds, nfds_t nfds, int timeout)
       goto out_with_cancelpt;
     }
 
+  fileps = (FAR struct file **)(kfds + nfds);
+
   /* Copy the user fds to neutral kernel memory */
 
   memcpy(kfds, fds, nfds * sizeof(struct pollfd));
@@ -452,12 +485,23 @@ int poll(FAR struct pollfd *fds, nfds_t nfds, int timeout)
   /* Can use the user fds directly */
 
   kfds = fds;
+
+  /* Allocate the cache of file references held from setup to teardown */
+
+  fileps = fs_heap_malloc(nfds * sizeof(FAR struct file *));
+  if (fileps == NULL && nfds > 0)
+    {
+      /* Out of memory */
+
+      ret = -ENOMEM;
+      goto out_with_cancelpt;
+    }
 #endif
 
   /* Set up the poll structure */
 
   nxsem_init(&sem, 0, 0);
-  ret = poll_setup(kfds, nfds, &sem);
+  ret = poll_setup(kfds, nfds, fileps, &sem);
   if (ret >= 0)
     {
       struct pollfd_s fdsinfo;
@@ -467,6 +511,7 @@ int poll(FAR struct pollfd *fds, nfds_t nfds, int timeout)
        */
 
       fdsinfo.fds = kfds;
+      fdsinfo.fileps = fileps;
       fdsinfo.nfds = nfds;
       tls_cleanup_push(tls_get_info(), poll_cleanup, &fdsinfo);
 
@@ -521,7 +566,7 @@ int poll(FAR struct pollfd *fds, nfds_t nfds, int timeout)
        * Preserve ret, if negative, since it holds the result of the wait.
        */
 
-      ret2 = poll_teardown(kfds, nfds, &count, ret);
+      ret2 = poll_teardown(kfds, nfds, fileps, &count, ret);
       if (ret2 < 0 && ret >= 0)
         {
           ret = ret2;
@@ -549,10 +594,11 @@ int poll(FAR struct pollfd *fds, nfds_t nfds, int timeout)
   /* Free the temporary buffer */
 
   fs_heap_free(kfds);
-
-out_with_cancelpt:
+#else
+  fs_heap_free(fileps);
 #endif
 
+out_with_cancelpt:
   leave_cancellation_point();
 
   if (ret < 0)
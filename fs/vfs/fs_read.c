@@ -31,7 +31,9 @@
 #include <assert.h>
 #include <errno.h>
 
+#include <nuttx/addrenv.h>
 #include <nuttx/cancelpt.h>
+#include <nuttx/sched.h>
 
 #include "notify/notify.h"
 #include "inode/inode.h"
@@ -85,6 +87,10 @@ ssize_t file_read(FAR struct file *filep, FAR void *buf, size_t nbytes)
 
   else if (inode != NULL && inode->u.i_ops && inode->u.i_ops->read)
     {
+#ifdef CONFIG_FS_LATENCY
+      clock_t start = perf_gettime();
+#endif
+
       /* Yes.. then let it perform the read.  NOTE that for the case of the
        * mountpoint, we depend on the read methods being identical in
        * signature and position in the operations vtable.
@@ -93,6 +99,13 @@ ssize_t file_read(FAR struct file *filep, FAR void *buf, size_t nbytes)
       ret = inode->u.i_ops->read(filep,
                                  (FAR char *)buf,
                                  (size_t)nbytes);
+
+#ifdef CONFIG_FS_LATENCY
+      if (INODE_IS_MOUNTPT(inode))
+        {
+          fslat_record(inode, FSLAT_READ, perf_gettime() - start);
+        }
+#endif
     }
 
   /* Return the number of bytes read (or possibly an error code) */
@@ -175,6 +188,23 @@ ssize_t read(int fd, FAR void *buf, size_t nbytes)
 
   enter_cancellation_point();
 
+#if defined(CONFIG_ARCH_ADDRENV) && defined(CONFIG_BUILD_KERNEL)
+  /* The drivers below access the caller's buffer directly.  Validate the
+   * entire range once here at the system call boundary so that a bad user
+   * pointer is reported as EFAULT instead of faulting in a driver.
+   * Kernel threads pass kernel buffers and are exempt.
+   */
+
+  if ((nxsched_self()->flags & TCB_FLAG_TTYPE_MASK) !=
+      TCB_FLAG_TTYPE_KERNEL &&
+      !addrenv_user_range((uintptr_t)buf, nbytes))
+    {
+      set_errno(EFAULT);
+      leave_cancellation_point();
+      return ERROR;
+    }
+#endif
+
   /* Let nx_read() do the real work */
 
   ret = nx_read(fd, buf, nbytes);
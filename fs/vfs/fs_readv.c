@@ -0,0 +1,248 @@
+/****************************************************************************
+ * fs/vfs/fs_readv.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <limits.h>
+#include <string.h>
+#include <errno.h>
+
+#include <nuttx/cancelpt.h>
+
+#include "inode/inode.h"
+#include "fs_heap.h"
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: file_readv
+ *
+ * Description:
+ *   Equivalent to the standard readv() function except that it accepts a
+ *   struct file instance instead of a file descriptor.  Where possible the
+ *   whole vector is presented to the underlying driver or mountpoint as a
+ *   single read so that the transfer may be performed in one operation.
+ *
+ * Input Parameters:
+ *   filep  - File structure instance
+ *   iov    - Array of read buffer descriptors
+ *   iovcnt - Number of elements in iov[]
+ *
+ * Returned Value:
+ *   The positive non-zero number of bytes read on success, 0 on if an
+ *   end-of-file condition, or a negated errno value on any failure.
+ *
+ ****************************************************************************/
+
+ssize_t file_readv(FAR struct file *filep, FAR const struct iovec *iov,
+                   int iovcnt)
+{
+  FAR uint8_t *buffer;
+  ssize_t remaining;
+  ssize_t nread;
+  ssize_t total;
+  ssize_t ret;
+  size_t nbytes;
+  int i;
+
+  if (iov == NULL || iovcnt <= 0)
+    {
+      return -EINVAL;
+    }
+
+  /* Get the size of the full transfer, failing if it would overflow */
+
+  total = 0;
+  for (i = 0; i < iovcnt; i++)
+    {
+      if (iov[i].iov_len > (size_t)(SSIZE_MAX - total))
+        {
+          return -EINVAL;
+        }
+
+      total += iov[i].iov_len;
+    }
+
+  if (total == 0)
+    {
+      return 0;
+    }
+
+  if (iovcnt == 1)
+    {
+      return file_read(filep, iov[0].iov_base, iov[0].iov_len);
+    }
+
+  /* Read the full transfer into one contiguous buffer so that the file
+   * system or driver sees a single large read -- typically a few large
+   * multi-sector transfers instead of one transfer per buffer -- and then
+   * scatter the result into the caller's buffers.
+   */
+
+  buffer = fs_heap_malloc(total);
+  if (buffer != NULL)
+    {
+      nread = file_read(filep, buffer, total);
+
+      remaining = nread;
+      for (i = 0; i < iovcnt && remaining > 0; i++)
+        {
+          nbytes = iov[i].iov_len;
+          if (nbytes > (size_t)remaining)
+            {
+              nbytes = remaining;
+            }
+
+          memcpy(iov[i].iov_base, buffer + (nread - remaining), nbytes);
+          remaining -= nbytes;
+        }
+
+      fs_heap_free(buffer);
+      return nread;
+    }
+
+  /* No memory to coalesce the vector; fill each buffer separately */
+
+  nread = 0;
+  for (i = 0; i < iovcnt; i++)
+    {
+      if (iov[i].iov_len == 0)
+        {
+          continue;
+        }
+
+      ret = file_read(filep, iov[i].iov_base, iov[i].iov_len);
+      if (ret < 0)
+        {
+          return nread > 0 ? nread : ret;
+        }
+
+      nread += ret;
+      if ((size_t)ret < iov[i].iov_len)
+        {
+          break;
+        }
+    }
+
+  return nread;
+}
+
+/****************************************************************************
+ * Name: nx_readv
+ *
+ * Description:
+ *   nx_readv() is an internal OS interface.  It is functionally similar to
+ *   the standard readv() interface except:
+ *
+ *    - It does not modify the errno variable, and
+ *    - It is not a cancellation point.
+ *
+ * Input Parameters:
+ *   fd     - File descriptor to read from
+ *   iov    - Array of read buffer descriptors
+ *   iovcnt - Number of elements in iov[]
+ *
+ * Returned Value:
+ *   The positive non-zero number of bytes read on success, 0 on if an
+ *   end-of-file condition, or a negated errno value on any failure.
+ *
+ ****************************************************************************/
+
+ssize_t nx_readv(int fd, FAR const struct iovec *iov, int iovcnt)
+{
+  FAR struct file *filep;
+  ssize_t ret;
+
+  /* First, get the file structure.
+   * Note that fs_getfilep() will return the errno on failure.
+   */
+
+  ret = (ssize_t)fs_getfilep(fd, &filep);
+  if (ret >= 0)
+    {
+      /* Perform the readv operation using the file descriptor as an
+       * index.  Note that file_readv() will return the errno on failure.
+       */
+
+      ret = file_readv(filep, iov, iovcnt);
+      fs_putfilep(filep);
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: readv()
+ *
+ * Description:
+ *   The readv() function is equivalent to read(), except that it places
+ *   the input data into the 'iovcnt' buffers specified by the members of
+ *   the 'iov' array:  iov[0], iov[1], ..., iov[iovcnt-1].
+ *
+ *   Each iovec entry specifies the base address and length of an area in
+ *   memory where data should be placed.  The readv() function always
+ *   fills an area completely before proceeding to the next.
+ *
+ * Input Parameters:
+ *   fildes - The open file descriptor for the file to be read
+ *   iov    - Array of read buffer descriptors
+ *   iovcnt - Number of elements in iov[]
+ *
+ * Returned Value:
+ *   Upon successful completion, readv() shall return the number of bytes
+ *   actually read.  Otherwise, it shall return a value of -1, the file-
+ *   pointer shall remain unchanged, and errno shall be set to indicate an
+ *   error.  See read() for the list of returned errno values.  In
+ *   addition, the readv() function will fail if:
+ *
+ *    EINVAL.
+ *      The sum of the iov_len values in the iov array overflowed an
+ *      ssize_t or the 'iovcnt' argument was less than or equal to 0.
+ *
+ ****************************************************************************/
+
+ssize_t readv(int fildes, FAR const struct iovec *iov, int iovcnt)
+{
+  ssize_t ret;
+
+  /* readv() is a cancellation point */
+
+  enter_cancellation_point();
+
+  /* Let nx_readv() do all of the work */
+
+  ret = nx_readv(fildes, iov, iovcnt);
+  if (ret < 0)
+    {
+      set_errno(-ret);
+      ret = ERROR;
+    }
+
+  leave_cancellation_point();
+  return ret;
+}
@@ -31,7 +31,9 @@
 #include <errno.h>
 #include <assert.h>
 
+#include <nuttx/addrenv.h>
 #include <nuttx/cancelpt.h>
+#include <nuttx/sched.h>
 
 #include "notify/notify.h"
 #include "inode/inode.h"
@@ -70,6 +72,9 @@ ssize_t file_write(FAR struct file *filep, FAR const void *buf,
 {
   FAR struct inode *inode;
   ssize_t ret;
+#ifdef CONFIG_FS_LATENCY
+  clock_t start;
+#endif
 
   /* Was this file opened for write access? */
 
@@ -88,7 +93,19 @@ ssize_t file_write(FAR struct file *filep, FAR const void *buf,
 
   /* Yes, then let the driver perform the write */
 
+#ifdef CONFIG_FS_LATENCY
+  start = perf_gettime();
+#endif
+
   ret = inode->u.i_ops->write(filep, buf, nbytes);
+
+#ifdef CONFIG_FS_LATENCY
+  if (INODE_IS_MOUNTPT(inode))
+    {
+      fslat_record(inode, FSLAT_WRITE, perf_gettime() - start);
+    }
+#endif
+
 #ifdef CONFIG_FS_NOTIFY
   if (ret > 0)
     {
@@ -208,6 +225,23 @@ ssize_t write(int fd, FAR const void *buf, size_t nbytes)
 
   enter_cancellation_point();
 
+#if defined(CONFIG_ARCH_ADDRENV) && defined(CONFIG_BUILD_KERNEL)
+  /* The drivers below access the caller's buffer directly.  Validate the
+   * entire range once here at the system call boundary so that a bad user
+   * pointer is reported as EFAULT instead of faulting in a driver.
+   * Kernel threads pass kernel buffers and are exempt.
+   */
+
+  if ((nxsched_self()->flags & TCB_FLAG_TTYPE_MASK) !=
+      TCB_FLAG_TTYPE_KERNEL &&
+      !addrenv_user_range((uintptr_t)buf, nbytes))
+    {
+      set_errno(EFAULT);
+      leave_cancellation_point();
+      return ERROR;
+    }
+#endif
+
   /* Let nx_write() do all of the work */
 
   ret = nx_write(fd, buf, nbytes);
@@ -0,0 +1,245 @@
+/****************************************************************************
+ * fs/vfs/fs_writev.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <limits.h>
+#include <string.h>
+#include <errno.h>
+
+#include <nuttx/cancelpt.h>
+
+#include "inode/inode.h"
+#include "fs_heap.h"
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: file_writev
+ *
+ * Description:
+ *   Equivalent to the standard writev() function except that it accepts a
+ *   struct file instance instead of a file descriptor.  Where possible the
+ *   vector is gathered into one contiguous transfer so that the underlying
+ *   driver or mountpoint sees a single large write instead of one write
+ *   per buffer.
+ *
+ * Input Parameters:
+ *   filep  - Instance of struct file to use with the write
+ *   iov    - Array of write buffer descriptors
+ *   iovcnt - Number of elements in iov[]
+ *
+ * Returned Value:
+ *  On success, the number of bytes written are returned (zero indicates
+ *  nothing was written).  On any failure, a negated errno value is returned
+ *  (see comments with write() for a description of the appropriate errno
+ *  values).
+ *
+ ****************************************************************************/
+
+ssize_t file_writev(FAR struct file *filep, FAR const struct iovec *iov,
+                    int iovcnt)
+{
+  FAR uint8_t *buffer;
+  ssize_t nwritten;
+  ssize_t total;
+  ssize_t ret;
+  int i;
+
+  if (iov == NULL || iovcnt <= 0)
+    {
+      return -EINVAL;
+    }
+
+  /* Get the size of the full transfer, failing if it would overflow */
+
+  total = 0;
+  for (i = 0; i < iovcnt; i++)
+    {
+      if (iov[i].iov_len > (size_t)(SSIZE_MAX - total))
+        {
+          return -EINVAL;
+        }
+
+      total += iov[i].iov_len;
+    }
+
+  if (total == 0)
+    {
+      return 0;
+    }
+
+  if (iovcnt == 1)
+    {
+      return file_write(filep, iov[0].iov_base, iov[0].iov_len);
+    }
+
+  /* Gather the vector into one contiguous buffer so that the file system
+   * or driver sees the full transfer at once.  A file system can then
+   * perform the write as a few large multi-sector transfers instead of
+   * one transfer per buffer, and the write is not interleaved with the
+   * writes of other threads.
+   */
+
+  buffer = fs_heap_malloc(total);
+  if (buffer != NULL)
+    {
+      nwritten = 0;
+      for (i = 0; i < iovcnt; i++)
+        {
+          memcpy(buffer + nwritten, iov[i].iov_base, iov[i].iov_len);
+          nwritten += iov[i].iov_len;
+        }
+
+      nwritten = file_write(filep, buffer, total);
+      fs_heap_free(buffer);
+      return nwritten;
+    }
+
+  /* No memory to gather the vector; write each buffer separately */
+
+  nwritten = 0;
+  for (i = 0; i < iovcnt; i++)
+    {
+      if (iov[i].iov_len == 0)
+        {
+          continue;
+        }
+
+      ret = file_write(filep, iov[i].iov_base, iov[i].iov_len);
+      if (ret < 0)
+        {
+          return nwritten > 0 ? nwritten : ret;
+        }
+
+      nwritten += ret;
+      if ((size_t)ret < iov[i].iov_len)
+        {
+          break;
+        }
+    }
+
+  return nwritten;
+}
+
+/****************************************************************************
+ * Name: nx_writev
+ *
+ * Description:
+ *  nx_writev() is an internal OS interface.  It is functionally equivalent
+ *  to the standard writev() interface except that:
+ *
+ *  - It does not modify the errno variable, and
+ *  - It is not a cancellation point.
+ *
+ * Input Parameters:
+ *   fd     - file descriptor to write to
+ *   iov    - Array of write buffer descriptors
+ *   iovcnt - Number of elements in iov[]
+ *
+ * Returned Value:
+ *  On success, the number of bytes written are returned (zero indicates
+ *  nothing was written).  On any failure, a negated errno value is returned
+ *  (see comments with write() for a description of the appropriate errno
+ *   values).
+ *
+ ****************************************************************************/
+
+ssize_t nx_writev(int fd, FAR const struct iovec *iov, int iovcnt)
+{
+  FAR struct file *filep;
+  ssize_t ret;
+
+  /* First, get the file structure.
+   * Note that fs_getfilep() will return the errno on failure.
+   */
+
+  ret = (ssize_t)fs_getfilep(fd, &filep);
+  if (ret >= 0)
+    {
+      /* Perform the writev operation using the file descriptor as an
+       * index.  Note that file_writev() will return the errno on failure.
+       */
+
+      ret = file_writev(filep, iov, iovcnt);
+      fs_putfilep(filep);
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: writev()
+ *
+ * Description:
+ *   The writev() function is equivalent to write(), except that it gathers
+ *   the output data from the 'iovcnt' buffers specified by the members of
+ *   the 'iov' array:  iov[0], iov[1], ..., iov[iovcnt-1].
+ *
+ *   Each iovec entry specifies the base address and length of an area in
+ *   memory from which data should be written.  The writev() function
+ *   always writes a complete area before proceeding to the next.
+ *
+ * Input Parameters:
+ *   fildes - The open file descriptor for the file to be written
+ *   iov    - Array of write buffer descriptors
+ *   iovcnt - Number of elements in iov[]
+ *
+ * Returned Value:
+ *   Upon successful completion, writev() shall return the number of bytes
+ *   actually written.  Otherwise, it shall return a value of -1, the file-
+ *   pointer shall remain unchanged, and errno shall be set to indicate an
+ *   error.  See write() for the list of returned errno values.  In
+ *   addition, the writev() function will fail if:
+ *
+ *    EINVAL.
+ *      The sum of the iov_len values in the iov array overflowed an
+ *      ssize_t or the 'iovcnt' argument was less than or equal to 0.
+ *
+ ****************************************************************************/
+
+ssize_t writev(int fildes, FAR const struct iovec *iov, int iovcnt)
+{
+  ssize_t ret;
+
+  /* writev() is a cancellation point */
+
+  enter_cancellation_point();
+
+  /* Let nx_writev() do all of the work */
+
+  ret = nx_writev(fildes, iov, iovcnt);
+  if (ret < 0)
+    {
+      set_errno(-ret);
+      ret = ERROR;
+    }
+
+  leave_cancellation_point();
+  return ret;
+}
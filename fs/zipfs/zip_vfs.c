@@ -26,6 +26,7 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <string.h>
+#include <sys/param.h>
 #include <sys/stat.h>
 #include <sys/statfs.h>
 #include <nuttx/mutex.h>
@@ -49,8 +50,42 @@ struct zipfs_dir_s
   bool last;
 };
 
+#ifdef CONFIG_ZIPFS_DIR_INDEX
+/* One entry of the central directory hash index */
+
+struct zipfs_node_s
+{
+  unz_file_pos pos;      /* Location of the entry in the central directory */
+  ZPOS64_T size;         /* Uncompressed size */
+  char name[1];          /* Entry name */
+};
+#endif
+
+#ifdef CONFIG_ZIPFS_EXTENT_CACHE
+/* One cached decompressed extent, shared by all open files of the mount */
+
+struct zipfs_extent_s
+{
+  FAR char *path;        /* Entry name, NULL if the slot is empty */
+  off_t offset;          /* File offset of the first byte */
+  uint32_t valid;        /* Number of valid bytes */
+  uint32_t age;          /* Generation of last hit, for LRU */
+  FAR uint8_t *data;     /* Decompressed data */
+};
+#endif
+
 struct zipfs_mountpt_s
 {
+#ifdef CONFIG_ZIPFS_DIR_INDEX
+  FAR struct zipfs_node_s **nodes; /* Hash index, NULL if disabled */
+  uint32_t nslots;       /* Number of slots, power of two */
+#endif
+#ifdef CONFIG_ZIPFS_EXTENT_CACHE
+  mutex_t cachelock;     /* Serializes access to the extent cache */
+  FAR struct zipfs_extent_s *extents; /* Extent array, NULL if disabled */
+  FAR uint8_t *extdata;  /* Backing store for the extent data */
+  uint32_t extage;       /* LRU generation counter */
+#endif
   char abspath[1];
 };
 
@@ -59,6 +94,11 @@ struct zipfs_file_s
   unzFile uf;
   mutex_t lock;
   FAR char *seekbuf;
+#ifdef CONFIG_ZIPFS_EXTENT_CACHE
+  off_t streampos;       /* Position of the decompression stream, which
+                          * lags or leads f_pos when reads are served
+                          * from the extent cache */
+#endif
   char relpath[1];
 };
 
@@ -76,6 +116,24 @@ static ZPOS64_T zipfs_real_tell(voidpf opaque, voidpf stream);
 static int zipfs_real_close(voidpf opaque, voidpf stream);
 static int zipfs_real_error(voidpf opaque, voidpf stream);
 
+static off_t   zipfs_skip(FAR struct zipfs_file_s *fp, off_t amount);
+static int     zipfs_locate(FAR struct zipfs_mountpt_s *fs, unzFile uf,
+                            FAR const char *relpath);
+#ifdef CONFIG_ZIPFS_DIR_INDEX
+static void    zipfs_index_build(FAR struct zipfs_mountpt_s *fs,
+                                 unzFile uf);
+static void    zipfs_index_free(FAR struct zipfs_mountpt_s *fs);
+static FAR struct zipfs_node_s *
+               zipfs_index_lookup(FAR struct zipfs_mountpt_s *fs,
+                                  FAR const char *relpath);
+#endif
+#ifdef CONFIG_ZIPFS_EXTENT_CACHE
+static int     zipfs_restream(FAR struct zipfs_mountpt_s *fs,
+                              FAR struct zipfs_file_s *fp, off_t target);
+static ssize_t zipfs_read_cached(FAR struct file *filep, FAR char *buffer,
+                                 size_t buflen);
+#endif
+
 static int     zipfs_open(FAR struct file *filep, FAR const char *relpath,
                           int oflags, mode_t mode);
 static int     zipfs_close(FAR struct file *filep);
@@ -239,6 +297,176 @@ static int zipfs_convert_result(int ziperr)
     }
 }
 
+#ifdef CONFIG_ZIPFS_DIR_INDEX
+static uint32_t zipfs_index_hash(FAR const char *name)
+{
+  uint32_t hash = 0;
+
+  while (*name != '\0')
+    {
+      hash = hash * 31 + (uint8_t)*name++;
+    }
+
+  return hash;
+}
+
+/* Parse the central directory into the hash index.  On any failure the
+ * partial index is torn down and lookups fall back to unzLocateFile().
+ */
+
+static void zipfs_index_build(FAR struct zipfs_mountpt_s *fs, unzFile uf)
+{
+  FAR struct zipfs_node_s *node;
+  unz_global_info64 ginfo;
+  unz_file_info64 info;
+  FAR char *name;
+  uint32_t i;
+  int ret;
+
+  if (unzGetGlobalInfo64(uf, &ginfo) != UNZ_OK || ginfo.number_entry == 0)
+    {
+      return;
+    }
+
+  /* Size the table to a power of two holding twice the entry count so
+   * that linear probing stays short.
+   */
+
+  fs->nslots = 16;
+  while (fs->nslots < 2 * ginfo.number_entry)
+    {
+      fs->nslots <<= 1;
+    }
+
+  fs->nodes = fs_heap_zalloc(fs->nslots * sizeof(*fs->nodes));
+  if (fs->nodes == NULL)
+    {
+      return;
+    }
+
+  name = fs_heap_malloc(PATH_MAX);
+  if (name == NULL)
+    {
+      goto errout_with_nodes;
+    }
+
+  for (ret = unzGoToFirstFile(uf); ret == UNZ_OK;
+       ret = unzGoToNextFile(uf))
+    {
+      if (unzGetCurrentFileInfo64(uf, &info, name, PATH_MAX,
+                                  NULL, 0, NULL, 0) != UNZ_OK)
+        {
+          goto errout_with_name;
+        }
+
+      node = fs_heap_malloc(sizeof(*node) + strlen(name));
+      if (node == NULL)
+        {
+          goto errout_with_name;
+        }
+
+      if (unzGetFilePos(uf, &node->pos) != UNZ_OK)
+        {
+          fs_heap_free(node);
+          goto errout_with_name;
+        }
+
+      node->size = info.uncompressed_size;
+      strcpy(node->name, name);
+
+      i = zipfs_index_hash(name) & (fs->nslots - 1);
+      while (fs->nodes[i] != NULL)
+        {
+          i = (i + 1) & (fs->nslots - 1);
+        }
+
+      fs->nodes[i] = node;
+    }
+
+  fs_heap_free(name);
+  return;
+
+errout_with_name:
+  fs_heap_free(name);
+errout_with_nodes:
+  zipfs_index_free(fs);
+}
+
+static void zipfs_index_free(FAR struct zipfs_mountpt_s *fs)
+{
+  uint32_t i;
+
+  if (fs->nodes == NULL)
+    {
+      return;
+    }
+
+  for (i = 0; i < fs->nslots; i++)
+    {
+      if (fs->nodes[i] != NULL)
+        {
+          fs_heap_free(fs->nodes[i]);
+        }
+    }
+
+  fs_heap_free(fs->nodes);
+  fs->nodes = NULL;
+}
+
+static FAR struct zipfs_node_s *
+zipfs_index_lookup(FAR struct zipfs_mountpt_s *fs, FAR const char *relpath)
+{
+  uint32_t i;
+
+  if (fs->nodes == NULL)
+    {
+      return NULL;
+    }
+
+  i = zipfs_index_hash(relpath) & (fs->nslots - 1);
+  while (fs->nodes[i] != NULL)
+    {
+      if (strcmp(fs->nodes[i]->name, relpath) == 0)
+        {
+          return fs->nodes[i];
+        }
+
+      i = (i + 1) & (fs->nslots - 1);
+    }
+
+  return NULL;
+}
+#endif /* CONFIG_ZIPFS_DIR_INDEX */
+
+/* Position the zip handle at the named entry, using the central directory
+ * index when it is available and falling back to the linear scan of
+ * unzLocateFile() when it is not.
+ */
+
+static int zipfs_locate(FAR struct zipfs_mountpt_s *fs, unzFile uf,
+                        FAR const char *relpath)
+{
+#ifdef CONFIG_ZIPFS_DIR_INDEX
+  FAR struct zipfs_node_s *node = zipfs_index_lookup(fs, relpath);
+
+  if (node != NULL)
+    {
+      unz_file_pos pos = node->pos;
+
+      return zipfs_convert_result(unzGoToFilePos(uf, &pos));
+    }
+
+  if (fs->nodes != NULL)
+    {
+      /* The index is complete, so the entry does not exist */
+
+      return -ENOENT;
+    }
+#endif
+
+  return zipfs_convert_result(unzLocateFile(uf, relpath, 0));
+}
+
 static int zipfs_open(FAR struct file *filep, FAR const char *relpath,
                       int oflags, mode_t mode)
 {
@@ -267,7 +495,7 @@ static int zipfs_open(FAR struct file *filep, FAR const char *relpath,
       goto err_with_mutex;
     }
 
-  ret = zipfs_convert_result(unzLocateFile(fp->uf, relpath, 0));
+  ret = zipfs_locate(fs, fp->uf, relpath);
   if (ret < 0)
     {
       goto err_with_zip;
@@ -282,6 +510,9 @@ static int zipfs_open(FAR struct file *filep, FAR const char *relpath,
   if (ret == OK)
     {
       fp->seekbuf = NULL;
+#ifdef CONFIG_ZIPFS_EXTENT_CACHE
+      fp->streampos = 0;
+#endif
       strcpy(fp->relpath, relpath);
       filep->f_priv = fp;
     }
@@ -317,11 +548,15 @@ static ssize_t zipfs_read(FAR struct file *filep, FAR char *buffer,
   ssize_t ret;
 
   nxmutex_lock(&fp->lock);
+#ifdef CONFIG_ZIPFS_EXTENT_CACHE
+  ret = zipfs_read_cached(filep, buffer, buflen);
+#else
   ret = zipfs_convert_result(unzReadCurrentFile(fp->uf, buffer, buflen));
   if (ret > 0)
     {
       filep->f_pos += ret;
     }
+#endif
 
   nxmutex_unlock(&fp->lock);
   return ret;
@@ -362,10 +597,254 @@ static off_t zipfs_skip(FAR struct zipfs_file_s *fp, off_t amount)
   return next;
 }
 
+#ifdef CONFIG_ZIPFS_EXTENT_CACHE
+/* Bring the decompression stream of the open file to the given offset,
+ * reopening the entry if the stream is already past it.  On success the
+ * stream is at 'target' unless the entry ends first; the caller detects
+ * that case by comparing streampos against target.
+ */
+
+static int zipfs_restream(FAR struct zipfs_mountpt_s *fs,
+                          FAR struct zipfs_file_s *fp, off_t target)
+{
+  off_t ret;
+
+  if (fp->streampos > target)
+    {
+      ret = zipfs_convert_result(unzClose(fp->uf));
+      if (ret < 0)
+        {
+          return ret;
+        }
+
+      fp->uf = unzOpen2_64(fs->abspath, &zipfs_real_ops);
+      if (fp->uf == NULL)
+        {
+          return -EINVAL;
+        }
+
+      ret = zipfs_locate(fs, fp->uf, fp->relpath);
+      if (ret < 0)
+        {
+          return ret;
+        }
+
+      ret = zipfs_convert_result(unzOpenCurrentFile(fp->uf));
+      if (ret < 0)
+        {
+          return ret;
+        }
+
+      fp->streampos = 0;
+    }
+
+  if (fp->streampos < target)
+    {
+      ret = zipfs_skip(fp, target - fp->streampos);
+      if (ret < 0)
+        {
+          return ret;
+        }
+
+      fp->streampos += ret;
+    }
+
+  return OK;
+}
+
+/* Return the cached extent of the entry at the given (aligned) offset,
+ * or NULL.  The caller must hold cachelock.
+ */
+
+static FAR struct zipfs_extent_s *
+zipfs_extent_find(FAR struct zipfs_mountpt_s *fs, FAR const char *path,
+                  off_t offset)
+{
+  int i;
+
+  for (i = 0; i < CONFIG_ZIPFS_EXTENT_COUNT; i++)
+    {
+      FAR struct zipfs_extent_s *e = &fs->extents[i];
+
+      if (e->path != NULL && e->offset == offset &&
+          strcmp(e->path, path) == 0)
+        {
+          return e;
+        }
+    }
+
+  return NULL;
+}
+
+/* Decompress the extent at the given (aligned) offset into the least
+ * recently used cache slot.  Returns the number of bytes decompressed
+ * (zero at the end of the entry) and the slot used.  The caller must hold
+ * cachelock; inflate runs with it held, which serializes fills.
+ *
+ * Returned Value: number of valid bytes, zero at EOF, or a negated errno.
+ */
+
+static ssize_t zipfs_extent_fill(FAR struct zipfs_mountpt_s *fs,
+                                 FAR struct zipfs_file_s *fp, off_t offset,
+                                 FAR struct zipfs_extent_s **pe)
+{
+  FAR struct zipfs_extent_s *victim = &fs->extents[0];
+  ssize_t nread;
+  int ret;
+  int i;
+
+  ret = zipfs_restream(fs, fp, offset);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  if (fp->streampos != offset)
+    {
+      /* The entry ended before the extent starts */
+
+      return 0;
+    }
+
+  /* Pick the best eviction candidate:  Any empty slot, else the least
+   * recently used one.
+   */
+
+  for (i = 1; i < CONFIG_ZIPFS_EXTENT_COUNT; i++)
+    {
+      FAR struct zipfs_extent_s *e = &fs->extents[i];
+
+      if (victim->path != NULL &&
+          (e->path == NULL || e->age < victim->age))
+        {
+          victim = e;
+        }
+    }
+
+  nread = zipfs_convert_result(unzReadCurrentFile(fp->uf, victim->data,
+                               CONFIG_ZIPFS_EXTENT_SIZE));
+  if (nread <= 0)
+    {
+      return nread;
+    }
+
+  fp->streampos += nread;
+
+  /* Update the entry name unless the slot already holds it */
+
+  if (victim->path == NULL || strcmp(victim->path, fp->relpath) != 0)
+    {
+      fs_heap_free(victim->path);
+      victim->path = fs_heap_malloc(strlen(fp->relpath) + 1);
+      if (victim->path != NULL)
+        {
+          strcpy(victim->path, fp->relpath);
+        }
+
+      /* If the allocation failed, the slot still serves this one read
+       * but will not be found by later lookups.
+       */
+    }
+
+  victim->offset = offset;
+  victim->valid  = nread;
+  victim->age    = ++fs->extage;
+  *pe = victim;
+  return nread;
+}
+
+/* Serve a read from the shared extent cache, decompressing extents on
+ * misses.  The caller must hold the open file lock.
+ */
+
+static ssize_t zipfs_read_cached(FAR struct file *filep, FAR char *buffer,
+                                 size_t buflen)
+{
+  FAR struct zipfs_mountpt_s *fs = filep->f_inode->i_private;
+  FAR struct zipfs_file_s *fp = filep->f_priv;
+  size_t total = 0;
+  ssize_t ret;
+
+  if (fs->extents == NULL)
+    {
+      /* The cache could not be allocated at mount time.. read the
+       * stream directly.
+       */
+
+      ret = zipfs_restream(fs, fp, filep->f_pos);
+      if (ret < 0)
+        {
+          return ret;
+        }
+
+      if (fp->streampos != filep->f_pos)
+        {
+          return 0;
+        }
+
+      ret = zipfs_convert_result(unzReadCurrentFile(fp->uf, buffer,
+                                                    buflen));
+      if (ret > 0)
+        {
+          fp->streampos += ret;
+          filep->f_pos  += ret;
+        }
+
+      return ret;
+    }
+
+  while (total < buflen)
+    {
+      FAR struct zipfs_extent_s *e;
+      off_t ext = filep->f_pos -
+                  (filep->f_pos % CONFIG_ZIPFS_EXTENT_SIZE);
+      size_t skew = filep->f_pos - ext;
+      size_t nbytes;
+
+      nxmutex_lock(&fs->cachelock);
+      e = zipfs_extent_find(fs, fp->relpath, ext);
+      if (e == NULL)
+        {
+          ret = zipfs_extent_fill(fs, fp, ext, &e);
+          if (ret < 0)
+            {
+              nxmutex_unlock(&fs->cachelock);
+              return total > 0 ? (ssize_t)total : ret;
+            }
+          else if (ret == 0)
+            {
+              nxmutex_unlock(&fs->cachelock);
+              break;
+            }
+        }
+
+      if (skew >= e->valid)
+        {
+          /* The position is past the end of the entry */
+
+          nxmutex_unlock(&fs->cachelock);
+          break;
+        }
+
+      nbytes = MIN(buflen - total, e->valid - skew);
+      memcpy(buffer + total, e->data + skew, nbytes);
+      e->age = ++fs->extage;
+      nxmutex_unlock(&fs->cachelock);
+
+      total += nbytes;
+      filep->f_pos += nbytes;
+    }
+
+  return total;
+}
+#endif /* CONFIG_ZIPFS_EXTENT_CACHE */
+
 static off_t zipfs_seek(FAR struct file *filep, off_t offset,
                         int whence)
 {
+#ifndef CONFIG_ZIPFS_EXTENT_CACHE
   FAR struct zipfs_mountpt_s *fs = filep->f_inode->i_private;
+#endif
   FAR struct zipfs_file_s *fp = filep->f_priv;
   unz_file_info64 file_info;
   off_t ret = 0;
@@ -398,7 +877,15 @@ static off_t zipfs_seek(FAR struct file *filep, off_t offset,
     {
       goto err_with_lock;
     }
-  else if (filep->f_pos > offset)
+
+#ifdef CONFIG_ZIPFS_EXTENT_CACHE
+  /* The decompression stream is repositioned lazily by the next cache
+   * miss, so only the file position has to move here.
+   */
+
+  filep->f_pos = offset;
+#else
+  if (filep->f_pos > offset)
     {
       ret = zipfs_convert_result(unzClose(fp->uf));
       if (ret < 0)
@@ -413,7 +900,7 @@ static off_t zipfs_seek(FAR struct file *filep, off_t offset,
           goto err_with_lock;
         }
 
-      ret = zipfs_convert_result(unzLocateFile(fp->uf, fp->relpath, 0));
+      ret = zipfs_locate(fs, fp->uf, fp->relpath);
       if (ret < 0)
         {
           goto err_with_lock;
@@ -438,6 +925,7 @@ static off_t zipfs_seek(FAR struct file *filep, off_t offset,
     {
       filep->f_pos += ret;
     }
+#endif
 
 err_with_lock:
   nxmutex_unlock(&fp->lock);
@@ -599,7 +1087,46 @@ static int zipfs_bind(FAR struct inode *driver, FAR const void *data,
       return -EINVAL;
     }
 
+#ifdef CONFIG_ZIPFS_DIR_INDEX
+  /* Parse the central directory while the volume is already open.  The
+   * mount succeeds without the index if this fails.
+   */
+
+  zipfs_index_build(fs, uf);
+#endif
+
   unzClose(uf);
+
+#ifdef CONFIG_ZIPFS_EXTENT_CACHE
+  /* Allocate the decompressed extent cache.  The mount succeeds without
+   * it if the allocations fail; reads then decompress directly.
+   */
+
+  nxmutex_init(&fs->cachelock);
+  fs->extents = fs_heap_zalloc(CONFIG_ZIPFS_EXTENT_COUNT *
+                               sizeof(*fs->extents));
+  if (fs->extents != NULL)
+    {
+      fs->extdata = fs_heap_malloc(CONFIG_ZIPFS_EXTENT_COUNT *
+                                   CONFIG_ZIPFS_EXTENT_SIZE);
+      if (fs->extdata == NULL)
+        {
+          fs_heap_free(fs->extents);
+          fs->extents = NULL;
+        }
+      else
+        {
+          int i;
+
+          for (i = 0; i < CONFIG_ZIPFS_EXTENT_COUNT; i++)
+            {
+              fs->extents[i].data = fs->extdata +
+                                    i * CONFIG_ZIPFS_EXTENT_SIZE;
+            }
+        }
+    }
+#endif
+
   strcpy(fs->abspath, data);
   *handle = fs;
 
@@ -609,7 +1136,30 @@ static int zipfs_bind(FAR struct inode *driver, FAR const void *data,
 static int zipfs_unbind(FAR void *handle, FAR struct inode **driver,
                         unsigned int flags)
 {
-  fs_heap_free(handle);
+  FAR struct zipfs_mountpt_s *fs = handle;
+
+#ifdef CONFIG_ZIPFS_DIR_INDEX
+  zipfs_index_free(fs);
+#endif
+
+#ifdef CONFIG_ZIPFS_EXTENT_CACHE
+  if (fs->extents != NULL)
+    {
+      int i;
+
+      for (i = 0; i < CONFIG_ZIPFS_EXTENT_COUNT; i++)
+        {
+          fs_heap_free(fs->extents[i].path);
+        }
+
+      fs_heap_free(fs->extents);
+      fs_heap_free(fs->extdata);
+    }
+
+  nxmutex_destroy(&fs->cachelock);
+#endif
+
+  fs_heap_free(fs);
   return OK;
 }
 
@@ -638,13 +1188,35 @@ static int zipfs_stat(FAR struct inode *mountpt,
     }
 
   fs = mountpt->i_private;
+
+#ifdef CONFIG_ZIPFS_DIR_INDEX
+  /* With a complete index the stat can be answered without touching the
+   * backing file at all.
+   */
+
+  if (fs->nodes != NULL)
+    {
+      FAR struct zipfs_node_s *node = zipfs_index_lookup(fs, relpath);
+
+      if (node == NULL)
+        {
+          return -ENOENT;
+        }
+
+      memset(buf, 0, sizeof(struct stat));
+      buf->st_size = node->size;
+      buf->st_mode = S_IFREG | 0444;
+      return OK;
+    }
+#endif
+
   uf = unzOpen2_64(fs->abspath, &zipfs_real_ops);
   if (uf == NULL)
     {
       return -EINVAL;
     }
 
-  ret = zipfs_convert_result(unzLocateFile(uf, relpath, 0));
+  ret = zipfs_locate(fs, uf, relpath);
   if (ret < 0)
     {
       unzClose(uf);
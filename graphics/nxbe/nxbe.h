@@ -32,6 +32,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#include <nuttx/clock.h>
 #include <nuttx/nx/nx.h>
 #include <nuttx/nx/nxglib.h>
 #include <nuttx/nx/nxcursor.h>
@@ -173,6 +174,14 @@ struct nxbe_plane_s
   struct nxbe_cursorops_s cursor;
 #endif
 
+#ifdef CONFIG_NX_UPDATE_DAMAGE
+  /* Display damage accumulated since the last update callout */
+
+  struct nxgl_rect_s damage[CONFIG_NX_UPDATE_DAMAGE_NRECTS];
+  uint8_t ndamage;                  /* Number of valid damage rectangles */
+  clock_t dmgstart;                 /* Time when the oldest damage was added */
+#endif
+
   /* Framebuffer plane info describing destination video plane */
 
   NX_DRIVERTYPE *driver;
@@ -310,10 +319,54 @@ int nxbe_colormap(FAR NX_DRIVERTYPE *dev);
  ****************************************************************************/
 
 #ifdef CONFIG_NX_UPDATE
-void nxbe_notify_rectangle(FAR NX_DRIVERTYPE *dev,
+void nxbe_notify_rectangle(FAR struct nxbe_plane_s *plane,
                            FAR const struct nxgl_rect_s *rect);
 #endif
 
+/****************************************************************************
+ * Name: nxbe_damage_add
+ *
+ * Description:
+ *   When CONFIG_NX_UPDATE_DAMAGE=y, add the updated region to the damage
+ *   accumulated on the plane, merging it with overlapping damage.  The
+ *   deferred update callouts are issued later by nxbe_damage_flush().
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NX_UPDATE_DAMAGE
+void nxbe_damage_add(FAR struct nxbe_plane_s *plane,
+                     FAR const struct nxgl_rect_s *rect);
+#endif
+
+/****************************************************************************
+ * Name: nxbe_damage_delay
+ *
+ * Description:
+ *   When CONFIG_NX_UPDATE_DAMAGE=y, return the number of clock ticks
+ *   remaining until the accumulated damage must be flushed, or -1 if no
+ *   damage is pending.  A return value of zero means that the flush is
+ *   already due.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NX_UPDATE_DAMAGE
+sclock_t nxbe_damage_delay(FAR struct nxbe_state_s *be);
+#endif
+
+/****************************************************************************
+ * Name: nxbe_damage_flush
+ *
+ * Description:
+ *   When CONFIG_NX_UPDATE_DAMAGE=y, issue the deferred update callouts for
+ *   all of the damage rectangles accumulated on every plane and empty the
+ *   accumulators.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NX_UPDATE_DAMAGE
+void nxbe_damage_flush(FAR struct nxbe_state_s *be);
+#endif
+
 /****************************************************************************
  * Name: nx_configure
  *
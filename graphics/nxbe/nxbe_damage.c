@@ -0,0 +1,218 @@
+/****************************************************************************
+ * graphics/nxbe/nxbe_damage.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <nuttx/clock.h>
+#include <nuttx/nx/nxglib.h>
+
+#include "nxbe.h"
+
+#ifdef CONFIG_NX_UPDATE_DAMAGE
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxbe_damage_area
+ *
+ * Description:
+ *   Return the area of a rectangle in pixels.
+ *
+ ****************************************************************************/
+
+static int32_t nxbe_damage_area(FAR const struct nxgl_rect_s *rect)
+{
+  struct nxgl_size_s size;
+
+  nxgl_rectsize(&size, rect);
+  return (int32_t)size.w * (int32_t)size.h;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxbe_damage_add
+ *
+ * Description:
+ *   Add the updated region to the damage accumulated on the plane, merging
+ *   it with overlapping damage.  The deferred update callouts are issued
+ *   later by nxbe_damage_flush().
+ *
+ ****************************************************************************/
+
+void nxbe_damage_add(FAR struct nxbe_plane_s *plane,
+                     FAR const struct nxgl_rect_s *rect)
+{
+  FAR struct nxgl_rect_s *best;
+  int32_t growth;
+  int32_t least;
+  int i;
+
+  if (nxgl_nullrect(rect))
+    {
+      return;
+    }
+
+  /* Remember when the oldest unflushed damage was added so that the
+   * server can bound how long a notification is deferred.
+   */
+
+  if (plane->ndamage == 0)
+    {
+      plane->dmgstart = clock_systime_ticks();
+    }
+
+  /* If the update overlaps damage that is already pending, then just
+   * widen that damage.  Pixels in the union are refreshed only once no
+   * matter how many times they were drawn.
+   */
+
+  for (i = 0; i < plane->ndamage; i++)
+    {
+      if (nxgl_rectoverlap(&plane->damage[i], rect))
+        {
+          nxgl_rectunion(&plane->damage[i], &plane->damage[i], rect);
+          return;
+        }
+    }
+
+  /* Otherwise, track the update in a free slot if there is one */
+
+  if (plane->ndamage < CONFIG_NX_UPDATE_DAMAGE_NRECTS)
+    {
+      nxgl_rectcopy(&plane->damage[plane->ndamage], rect);
+      plane->ndamage++;
+      return;
+    }
+
+  /* All slots are in use.  Merge the update into the slot whose union
+   * with the update grows by the least area.
+   */
+
+  best  = &plane->damage[0];
+  least = INT32_MAX;
+
+  for (i = 0; i < plane->ndamage; i++)
+    {
+      struct nxgl_rect_s merged;
+
+      nxgl_rectunion(&merged, &plane->damage[i], rect);
+      growth = nxbe_damage_area(&merged) -
+               nxbe_damage_area(&plane->damage[i]);
+      if (growth < least)
+        {
+          best  = &plane->damage[i];
+          least = growth;
+        }
+    }
+
+  nxgl_rectunion(best, best, rect);
+}
+
+/****************************************************************************
+ * Name: nxbe_damage_delay
+ *
+ * Description:
+ *   Return the number of clock ticks remaining until the accumulated
+ *   damage must be flushed, or -1 if no damage is pending.  A return
+ *   value of zero means that the flush is already due.
+ *
+ ****************************************************************************/
+
+sclock_t nxbe_damage_delay(FAR struct nxbe_state_s *be)
+{
+  sclock_t remaining = -1;
+  sclock_t elapsed;
+  clock_t now;
+  int i;
+
+  now = clock_systime_ticks();
+
+#if CONFIG_NX_NPLANES > 1
+  for (i = 0; i < CONFIG_NX_NPLANES; i++)
+#else
+  i = 0;
+#endif
+    {
+      FAR struct nxbe_plane_s *plane = &be->plane[i];
+
+      if (plane->ndamage > 0)
+        {
+          elapsed = (sclock_t)(now - plane->dmgstart);
+          if (elapsed >= MSEC2TICK(CONFIG_NX_UPDATE_DAMAGE_DELAY))
+            {
+              return 0;
+            }
+
+          if (remaining < 0 ||
+              MSEC2TICK(CONFIG_NX_UPDATE_DAMAGE_DELAY) - elapsed < remaining)
+            {
+              remaining = MSEC2TICK(CONFIG_NX_UPDATE_DAMAGE_DELAY) - elapsed;
+            }
+        }
+    }
+
+  return remaining;
+}
+
+/****************************************************************************
+ * Name: nxbe_damage_flush
+ *
+ * Description:
+ *   Issue the deferred update callouts for all of the damage rectangles
+ *   accumulated on every plane and empty the accumulators.
+ *
+ ****************************************************************************/
+
+void nxbe_damage_flush(FAR struct nxbe_state_s *be)
+{
+  struct fb_area_s area;
+  int i;
+  int j;
+
+#if CONFIG_NX_NPLANES > 1
+  for (i = 0; i < CONFIG_NX_NPLANES; i++)
+#else
+  i = 0;
+#endif
+    {
+      FAR struct nxbe_plane_s *plane = &be->plane[i];
+
+      for (j = 0; j < plane->ndamage; j++)
+        {
+          nxgl_rect2area(&area, &plane->damage[j]);
+          plane->driver->updatearea(plane->driver, &area);
+        }
+
+      plane->ndamage = 0;
+    }
+}
+
+#endif /* CONFIG_NX_UPDATE_DAMAGE */
@@ -56,12 +56,21 @@
  ****************************************************************************/
 
 #ifdef CONFIG_NX_UPDATE
-void nxbe_notify_rectangle(FAR NX_DRIVERTYPE *dev,
+void nxbe_notify_rectangle(FAR struct nxbe_plane_s *plane,
                            FAR const struct nxgl_rect_s *rect)
 {
+#ifdef CONFIG_NX_UPDATE_DAMAGE
+  /* Defer the callout:  Accumulate the damage and let the server flush
+   * the coalesced set when it becomes idle or when the flush period
+   * expires.
+   */
+
+  nxbe_damage_add(plane, rect);
+#else
   struct fb_area_s area;
 
   nxgl_rect2area(&area, rect);
-  dev->updatearea(dev, &area);
+  plane->driver->updatearea(plane->driver, &area);
+#endif
 }
 #endif
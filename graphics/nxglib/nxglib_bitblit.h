@@ -30,6 +30,7 @@
 #include <nuttx/config.h>
 
 #include <stdint.h>
+#include <string.h>
 
 #include <nuttx/nx/nxglib.h>
 
@@ -106,26 +107,16 @@
 #  define NXGL_ALIGNDOWN(x)        ((x) & ~NXGL_PIXELMASK)
 #  define NXGL_ALIGNUP(x)          (((x) + NXGL_PIXELMASK) & ~NXGL_PIXELMASK)
 
+/* Sub-byte pixels are passed to these macros as a byte-replicated pattern,
+ * so whole spans can be handed to the (possibly architecture-optimized)
+ * memset/memmove implementations.
+ */
+
 #  define NXGL_MEMSET(dest,value,width) \
-   { \
-     FAR uint8_t *_ptr = (FAR uint8_t*)(dest); \
-     int        _nby = NXGL_SCALEX(width); \
-     while (_nby--) \
-       { \
-         *_ptr++ = (value); \
-       } \
-   }
+     memset((FAR void *)(dest), (value), NXGL_SCALEX(width))
 
 #  define NXGL_MEMCPY(dest,src,width) \
-   { \
-     FAR uint8_t *_dptr = (FAR uint8_t*)(dest); \
-     FAR uint8_t *_sptr = (FAR uint8_t*)(src); \
-     int        _nby  = NXGL_SCALEX(width); \
-     while (_nby--) \
-       { \
-         *_dptr++ = *_sptr++; \
-       } \
-   }
+     memmove((FAR void *)(dest), (FAR const void *)(src), NXGL_SCALEX(width))
 
 #elif NXGLIB_BITSPERPIXEL == 24
 
@@ -142,17 +133,7 @@
    }
 
 #  define NXGL_MEMCPY(dest,src,width) \
-   { \
-     FAR uint8_t *_dptr = (FAR uint8_t*)(dest); \
-     FAR uint8_t *_sptr = (FAR uint8_t*)(src); \
-     nxgl_coord_t _npix = (width); \
-     while (_npix--) \
-       { \
-         *_dptr++ = *_sptr++; \
-         *_dptr++ = *_sptr++; \
-         *_dptr++ = *_sptr++; \
-       } \
-   }
+     memmove((FAR void *)(dest), (FAR const void *)(src), NXGL_SCALEX(width))
 
 #ifdef CONFIG_NX_ANTIALIASING
 
@@ -173,27 +154,47 @@
 #endif /* CONFIG_NX_ANTIALIASING */
 #else /* NXGLIB_BITSPERPIXEL == 16 || NXGLIB_BITSPERPIXEL == 32 */
 
+/* Fill whole machine words at a time:  The pixel value is replicated
+ * across a word and the aligned body of the span is written one word per
+ * store, with any misaligned head and residual tail pixels written
+ * individually.
+ */
+
 #  define NXGL_MEMSET(dest,value,width) \
    { \
      FAR NXGL_PIXEL_T *_ptr = (FAR NXGL_PIXEL_T*)(dest); \
      nxgl_coord_t     _npix = (width); \
-     while (_npix--) \
+     uintptr_t        _word; \
+     unsigned int     _shift; \
+     while (_npix > 0 && \
+            ((uintptr_t)_ptr & (sizeof(uintptr_t) - 1)) != 0) \
        { \
          *_ptr++ = (value); \
+         _npix--; \
        } \
-   }
-
-#  define NXGL_MEMCPY(dest,src,width) \
-   { \
-     FAR NXGL_PIXEL_T *_dptr = (FAR NXGL_PIXEL_T*)(dest); \
-     FAR NXGL_PIXEL_T *_sptr = (FAR NXGL_PIXEL_T*)(src); \
-     nxgl_coord_t      _npix = (width); \
-     while (_npix--) \
+     _word = (NXGL_PIXEL_T)(value); \
+     for (_shift = NXGLIB_BITSPERPIXEL; \
+          _shift < 8 * sizeof(uintptr_t); \
+          _shift <<= 1) \
+       { \
+         _word |= _word << _shift; \
+       } \
+     while (_npix >= (nxgl_coord_t)(sizeof(uintptr_t) / \
+                                    sizeof(NXGL_PIXEL_T))) \
+       { \
+         *(FAR uintptr_t *)_ptr = _word; \
+         _ptr  += sizeof(uintptr_t) / sizeof(NXGL_PIXEL_T); \
+         _npix -= sizeof(uintptr_t) / sizeof(NXGL_PIXEL_T); \
+       } \
+     while (_npix-- > 0) \
        { \
-         *_dptr++ = *_sptr++; \
+         *_ptr++ = (value); \
        } \
    }
 
+#  define NXGL_MEMCPY(dest,src,width) \
+     memmove((FAR void *)(dest), (FAR const void *)(src), NXGL_SCALEX(width))
+
 #ifdef CONFIG_NX_ANTIALIASING
 
 #  define NXGL_BLEND(dest,color1,frac) \
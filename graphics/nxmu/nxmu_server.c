@@ -36,6 +36,7 @@
 #include <errno.h>
 #include <debug.h>
 
+#include <nuttx/clock.h>
 #include <nuttx/mqueue.h>
 #include <nuttx/nx/nx.h>
 
@@ -274,6 +275,11 @@ int nx_runinstance(FAR const char *mqname, FAR NX_DRIVERTYPE *dev)
   char                   buffer[NX_MXSVRMSGLEN];
   int                    nbytes;
   int                    ret;
+#ifdef CONFIG_NX_UPDATE_DAMAGE
+  struct timespec        abstime;
+  struct timespec        reltime;
+  sclock_t               delay;
+#endif
 
   /* Initialization *********************************************************/
 
@@ -299,7 +305,43 @@ int nx_runinstance(FAR const char *mqname, FAR NX_DRIVERTYPE *dev)
     {
       /* Receive the next server message */
 
+#ifdef CONFIG_NX_UPDATE_DAMAGE
+      /* While update damage is pending, wait no longer than the remainder
+       * of the flush period so that coalesced update notifications are
+       * issued on time.  The damage is also flushed whenever the message
+       * queue drains, i.e., at the end of a burst of drawing commands.
+       */
+
+      delay = nxbe_damage_delay(&nxmu.be);
+      if (delay == 0)
+        {
+          nxbe_damage_flush(&nxmu.be);
+          delay = -1;
+        }
+
+      if (delay > 0)
+        {
+          clock_gettime(CLOCK_REALTIME, &abstime);
+          clock_ticks2time(&reltime, delay);
+          clock_timespec_add(&abstime, &reltime, &abstime);
+
+          nbytes = nxmq_timedreceive(nxmu.conn.crdmq, buffer,
+                                     NX_MXSVRMSGLEN, 0, &abstime);
+          if (nbytes == -ETIMEDOUT)
+            {
+              nxbe_damage_flush(&nxmu.be);
+              continue;
+            }
+        }
+      else
+        {
+          nbytes = nxmq_receive(nxmu.conn.crdmq, buffer,
+                                NX_MXSVRMSGLEN, 0);
+        }
+#else
       nbytes = nxmq_receive(nxmu.conn.crdmq, buffer, NX_MXSVRMSGLEN, 0);
+#endif
+
       if (nbytes < 0)
         {
           if (nbytes != -EINTR)
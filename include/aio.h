@@ -163,6 +163,14 @@ int aio_write(FAR struct aiocb *aiocbp);
 int lio_listio(int mode, FAR struct aiocb * const list[], int nent,
                FAR struct sigevent *sig);
 
+/* lio_submit() is a non-standard interface used by lio_listio() to submit
+ * a list of I/O operations with a single kernel entry.  It returns the
+ * number of operations successfully queued; operations that could not be
+ * queued report their error through the aio_result field of the aiocb.
+ */
+
+int lio_submit(FAR struct aiocb * const list[], int nent);
+
 #undef EXTERN
 #ifdef __cplusplus
 }
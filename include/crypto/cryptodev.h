@@ -366,6 +366,19 @@ struct crypt_op
   caddr_t aad;
 };
 
+/* A batch of operations submitted with a single CIOCCRYPTM ioctl, so
+ * that multiple segments (e.g. TLS records) cost only one descriptor
+ * round trip.  The operations are performed in order and may reference
+ * different sessions.  On failure, count is updated to the number of
+ * operations that completed so that the caller may resubmit the rest.
+ */
+
+struct crypt_mop
+{
+  size_t count;             /* Number of operations in ops[] */
+  FAR struct crypt_op *ops; /* Array of operations to perform */
+};
+
 /* hamc buffer, software & hardware need it */
 
 extern const uint8_t hmac_ipad_buffer[HMAC_MAX_BLOCK_LEN];
@@ -387,6 +400,7 @@ extern const uint8_t hmac_opad_buffer[HMAC_MAX_BLOCK_LEN];
 #define CIOCKEY                 104
 #define CIOCKEYRET              105
 #define CIOCASYMFEAT            106
+#define CIOCCRYPTM              107
 
 int crypto_newsession(FAR uint64_t *, FAR struct cryptoini *, int);
 int crypto_freesession(uint64_t);
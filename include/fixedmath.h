@@ -28,6 +28,7 @@
  ****************************************************************************/
 
 #include <nuttx/compiler.h>
+#include <stddef.h>
 #include <stdint.h>
 
 /****************************************************************************
@@ -257,6 +258,25 @@ b16_t  b16sin(b16_t rad);
 b16_t  b16cos(b16_t rad);
 b16_t  b16atan2(b16_t y, b16_t x);
 
+#ifdef CONFIG_HAVE_LONG_LONG
+/* Table driven trigonometric functions (quarter wave table with linear
+ * interpolation)
+ */
+
+b16_t  b16fastsin(b16_t rad);
+b16_t  b16fastcos(b16_t rad);
+
+/* Vector operations (full precision multiply-accumulate, results
+ * saturated to the b16 range)
+ */
+
+b16_t  b16dotb16(FAR const b16_t *a, FAR const b16_t *b, size_t n);
+void   b16scalev(FAR const b16_t *src, b16_t scale, FAR b16_t *dest,
+                 size_t n);
+void   b16macv(FAR b16_t *acc, FAR const b16_t *src, b16_t scale,
+               size_t n);
+#endif
+
 /* Square root operators */
 
 #ifdef CONFIG_HAVE_LONG_LONG
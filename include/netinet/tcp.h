@@ -57,5 +57,14 @@
 #define TCP_KEEPCNT   (__SO_PROTOCOL + 3) /* Number of keepalives before death
                                            * Argument: max retry count */
 #define TCP_MAXSEG    (__SO_PROTOCOL + 4) /* The maximum segment size */
+#define TCP_QUICKACK  (__SO_PROTOCOL + 5) /* Send ACKs immediately, overriding
+                                           * the delayed ACK logic for
+                                           * interactive traffic
+                                           * Argument: integer boolean */
+#define TCP_CORK      (__SO_PROTOCOL + 6) /* Do not send partial segments;
+                                           * hold them back until the cork
+                                           * is removed or they fill to the
+                                           * MSS
+                                           * Argument: integer boolean */
 
 #endif /* __INCLUDE_NETINET_TCP_H */
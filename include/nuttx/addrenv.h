@@ -490,6 +490,69 @@ int addrenv_give(FAR struct addrenv_s *addrenv);
 
 void addrenv_drop(FAR struct addrenv_s *addrenv, bool deferred);
 
+/****************************************************************************
+ * Name: addrenv_user_range
+ *
+ * Description:
+ *   Check that an entire address range lies in user virtual address
+ *   space.  Note that this only verifies that the range is a user range;
+ *   it does not guarantee that the range is mapped.
+ *
+ * Input Parameters:
+ *   addr - The start of the range.
+ *   len  - The length of the range in bytes.
+ *
+ * Returned Value:
+ *   True if the whole range lies in user address space; false if not.
+ *
+ ****************************************************************************/
+
+bool addrenv_user_range(uintptr_t addr, size_t len);
+
+/****************************************************************************
+ * Name: copy_from_user
+ *
+ * Description:
+ *   Copy 'n' bytes from the user space buffer 'from' to the kernel
+ *   buffer 'to'.  The entire source range is validated once up front.
+ *   The function is weak so that an architecture may provide an
+ *   optimized replacement.
+ *
+ * Input Parameters:
+ *   to   - Kernel destination buffer.
+ *   from - User source buffer.
+ *   n    - The number of bytes to copy.
+ *
+ * Returned Value:
+ *   Zero (OK) on success; -EFAULT if the source range does not lie in
+ *   user address space.
+ *
+ ****************************************************************************/
+
+int copy_from_user(FAR void *to, FAR const void *from, size_t n);
+
+/****************************************************************************
+ * Name: copy_to_user
+ *
+ * Description:
+ *   Copy 'n' bytes from the kernel buffer 'from' to the user space
+ *   buffer 'to'.  The entire destination range is validated once up
+ *   front.  The function is weak so that an architecture may provide an
+ *   optimized replacement.
+ *
+ * Input Parameters:
+ *   to   - User destination buffer.
+ *   from - Kernel source buffer.
+ *   n    - The number of bytes to copy.
+ *
+ * Returned Value:
+ *   Zero (OK) on success; -EFAULT if the destination range does not lie
+ *   in user address space.
+ *
+ ****************************************************************************/
+
+int copy_to_user(FAR void *to, FAR const void *from, size_t n);
+
 /****************************************************************************
  * Address Environment Interfaces
  *
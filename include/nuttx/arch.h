@@ -2828,6 +2828,22 @@ void arch_sporadic_resume(FAR struct tcb_s *tcb);
  *   The second interface simple converts an elapsed time into well known
  *   units.
  *
+ *   When CONFIG_ARCH_PERF_EVENTS is selected, the architecture must back
+ *   these interfaces with a free-running counter of much finer grain than
+ *   the system tick (normally the CPU cycle counter, e.g. DWT CYCCNT on
+ *   ARMv7-M, the cycle/time CSRs on RISC-V or the PMU cycle counter on
+ *   ARM64) so that they are usable for micro-benchmarks:
+ *
+ *   - up_perf_init() receives the counter frequency in Hz, cast to a
+ *     pointer, from board bring-up logic; backends whose hardware
+ *     publishes its own frequency may ignore the argument.
+ *   - up_perf_getfreq() returns that frequency so that callers can
+ *     convert counts without knowing the backend.
+ *   - The counter is free-running and simply wraps; the 64-bit extension
+ *     of the raw count is maintained by sched/clock/clock_perf.c when
+ *     CONFIG_PERF_OVERFLOW_CORRECTION is selected, so backends need not
+ *     handle overflow themselves.
+ *
  ****************************************************************************/
 
 void up_perf_init(FAR void *arg);
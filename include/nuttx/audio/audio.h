@@ -43,8 +43,8 @@
 #include <nuttx/config.h>
 #include <nuttx/compiler.h>
 
+#include <nuttx/atomic.h>
 #include <nuttx/fs/ioctl.h>
-#include <nuttx/mutex.h>
 #include <nuttx/spi/spi.h>
 #include <nuttx/queue.h>
 
@@ -117,6 +117,7 @@
 #define AUDIOIOC_GETLATENCY         _AUDIOIOC(19)
 #define AUDIOIOC_FLUSH              _AUDIOIOC(20)
 #define AUDIOIOC_GETPOSITION        _AUDIOIOC(21)
+#define AUDIOIOC_ENQUEUEFILE        _AUDIOIOC(22)
 
 /* Audio Device Types *******************************************************/
 
@@ -466,9 +467,8 @@ struct ap_buffer_s
   apb_samp_t            nbytes;     /* The number of bytes used */
   apb_samp_t            curbyte;    /* Next byte to be processed */
   apb_samp_t            nsamples;   /* The number of samples in the buffer */
-  mutex_t               lock;       /* Reference locking mutex */
+  atomic_int            crefs;      /* Number of reference counts */
   uint16_t              flags;      /* Buffer flags */
-  uint16_t              crefs;      /* Number of reference counts */
   FAR uint8_t           *samp;      /* Offset of the first sample */
 };
 
@@ -523,6 +523,26 @@ struct audio_buf_desc_s
   } u;
 };
 
+/* Structure for streaming a file extent directly into an audio pipeline
+ * buffer via the AUDIOIOC_ENQUEUEFILE ioctl.  The upper half reads the
+ * extent from the file straight into the sample area of the buffer and
+ * enqueues it with the lower half, so no intermediate application copy
+ * is needed ("audio sendfile").
+ */
+
+struct audio_file_desc_s
+{
+#ifdef CONFIG_AUDIO_MULTI_SESSION
+  FAR void            *session;          /* Associated channel */
+#endif
+  int                 fd;                /* File to stream from */
+  off_t               offset;            /* File offset; -1 to read from the
+                                          * current position */
+  apb_samp_t          numbytes;          /* Number of bytes to stream; must
+                                          * not exceed apb->nmaxbytes */
+  FAR struct ap_buffer_s *buffer;        /* Buffer to fill and enqueue */
+};
+
 /* Typedef for lower-level to upper-level callback for buffer dequeuing */
 
 #ifdef CONFIG_AUDIO_MULTI_SESSION
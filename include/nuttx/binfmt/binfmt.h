@@ -99,6 +99,16 @@ struct binary_s
 
   size_t mapsize;                      /* Size of the mapped address region (needed for munmap) */
 
+#ifdef CONFIG_BINFMT_CACHE
+  /* Binary cache support.  The loader fills these in if the image can be
+   * kept resident and re-spawned by restoring the data segment.
+   */
+
+  FAR void *dataptr;                   /* Base of the data/bss segment */
+  size_t datalen;                      /* Size of the data/bss segment */
+  bool cachable;                       /* True: image may be cached */
+#endif
+
   /* Start-up information that is provided by the loader, but may be modified
    * by the caller between load_module() and exec_module() calls.
    */
@@ -95,6 +95,14 @@ struct elf_loadinfo_s
   uid_t              fileuid;    /* Uid of the file system */
   gid_t              filegid;    /* Gid of the file system */
   int                filemode;   /* Mode of the file system */
+#ifdef CONFIG_ELF_XIP
+  uintptr_t          xipbase;    /* Direct address of the file image, or 0 */
+#endif
+#ifdef CONFIG_ELF_SYMTAB_BUFFERED
+  FAR Elf_Sym       *symtab;     /* Buffered symbol table, or NULL */
+  FAR char          *strtab;     /* Buffered symbol string table, or NULL */
+  size_t             strtablen;  /* Size of the buffered string table */
+#endif
 
   Elf_Ehdr           ehdr;       /* Buffered ELF file header */
   FAR Elf_Phdr      *phdr;       /* Buffered ELF program headers */
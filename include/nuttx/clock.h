@@ -312,6 +312,34 @@ typedef int64_t sclock_t;
 typedef int32_t sclock_t;
 #endif
 
+#ifdef CONFIG_CLOCK_USERPAGE
+/* This structure describes the clock page shared between the kernel and
+ * the user-space blob.  The kernel refreshes the page on each timer tick;
+ * user code reads it with a sequence-lock protocol:  cp_seq is incremented
+ * before and after each update so that it is odd while an update is in
+ * progress.  A reader retries if cp_seq was odd or changed across the read.
+ */
+
+struct clock_userpage_s
+{
+  volatile uint32_t cp_seq;      /* Odd while an update is in progress */
+  volatile clock_t cp_ticks;     /* System tick count at the last update */
+  struct timespec cp_basetime;   /* CLOCK_REALTIME offset at the last update */
+};
+
+#define CLOCK_USERPAGE \
+  ((FAR struct clock_userpage_s *)CONFIG_CLOCK_USERPAGE_ADDR)
+
+/* Compiler barrier used on both sides of the sequence-lock protocol.
+ * cp_basetime is not volatile, so without the barrier the compiler may
+ * move its copy across the cp_seq accesses (the volatile accesses are
+ * only ordered with respect to each other), publishing or returning a
+ * torn snapshot.
+ */
+
+#define clock_userpage_barrier() __asm__ __volatile__("" ::: "memory")
+#endif
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -0,0 +1,161 @@
+/****************************************************************************
+ * include/nuttx/dma/dmapool.h
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_NUTTX_DMA_DMAPOOL_H
+#define __INCLUDE_NUTTX_DMA_DMAPOOL_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stddef.h>
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+struct dma_pool_s; /* Opaque pool state */
+
+/* One entry of a scatter list as used by the batched cache maintenance
+ * helpers.
+ */
+
+struct dma_sg_s
+{
+  FAR void *buffer; /* Start of the data buffer */
+  size_t length;    /* Length of the data buffer in bytes */
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#undef EXTERN
+#if defined(__cplusplus)
+#define EXTERN extern "C"
+extern "C"
+{
+#else
+#define EXTERN extern
+#endif
+
+/****************************************************************************
+ * Name: dma_pool_initialize
+ *
+ * Description:
+ *   Create a DMA buffer pool over a board-provided memory region.  The
+ *   region would normally be mapped uncached or write-through by the
+ *   board logic; the pool itself only manages the allocations.  The
+ *   requested granule size is rounded up to a power of two and to the
+ *   data cache line size, so every allocation is cache-line aligned and
+ *   padded and cache maintenance on one buffer can never touch a line
+ *   shared with another.
+ *
+ * Input Parameters:
+ *   heapstart - Start of the DMA-safe memory region
+ *   heapsize  - Size of the DMA-safe memory region in bytes
+ *   gransize  - Requested allocation granule size in bytes
+ *
+ * Returned Value:
+ *   A reference to the pool on success; NULL on failure.
+ *
+ ****************************************************************************/
+
+FAR struct dma_pool_s *dma_pool_initialize(FAR void *heapstart,
+                                           size_t heapsize,
+                                           size_t gransize);
+
+/****************************************************************************
+ * Name: dma_pool_alloc
+ *
+ * Description:
+ *   Allocate a DMA-safe buffer from the pool.
+ *
+ * Input Parameters:
+ *   pool - The pool to allocate from
+ *   size - Size of the buffer in bytes
+ *
+ * Returned Value:
+ *   A reference to the buffer on success; NULL if the pool is exhausted.
+ *
+ ****************************************************************************/
+
+FAR void *dma_pool_alloc(FAR struct dma_pool_s *pool, size_t size);
+
+/****************************************************************************
+ * Name: dma_pool_free
+ *
+ * Description:
+ *   Return a buffer to the pool.
+ *
+ * Input Parameters:
+ *   pool   - The pool that the buffer was allocated from
+ *   memory - The buffer previously returned by dma_pool_alloc()
+ *   size   - Size of the buffer in bytes, as passed to dma_pool_alloc()
+ *
+ ****************************************************************************/
+
+void dma_pool_free(FAR struct dma_pool_s *pool, FAR void *memory,
+                   size_t size);
+
+/****************************************************************************
+ * Name: dma_clean_sg
+ *
+ * Description:
+ *   Clean the data cache over a scatter list before a memory-to-device
+ *   transfer.  Segments that share or abut cache lines are merged so
+ *   that each affected line is cleaned exactly once, instead of issuing
+ *   one cache operation per (possibly tiny) segment.
+ *
+ * Input Parameters:
+ *   sg  - The scatter list
+ *   nsg - Number of entries in the scatter list
+ *
+ ****************************************************************************/
+
+void dma_clean_sg(FAR const struct dma_sg_s *sg, unsigned int nsg);
+
+/****************************************************************************
+ * Name: dma_invalidate_sg
+ *
+ * Description:
+ *   Invalidate the data cache over a scatter list before/after a
+ *   device-to-memory transfer.  Segments that share or abut cache lines
+ *   are merged so that each affected line is invalidated exactly once.
+ *
+ * Input Parameters:
+ *   sg  - The scatter list
+ *   nsg - Number of entries in the scatter list
+ *
+ ****************************************************************************/
+
+void dma_invalidate_sg(FAR const struct dma_sg_s *sg, unsigned int nsg);
+
+#undef EXTERN
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* __INCLUDE_NUTTX_DMA_DMAPOOL_H */
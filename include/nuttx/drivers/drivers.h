@@ -174,6 +174,24 @@ int devmem_register(void);
 
 void devzero_register(void);
 
+/****************************************************************************
+ * Name: kbench_register
+ *
+ * Description:
+ *   Register /dev/kbench
+ *
+ * Input Parameters:
+ *   None
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_DEV_KBENCH
+void kbench_register(void);
+#endif
+
 /****************************************************************************
  * Name: bchdev_register
  *
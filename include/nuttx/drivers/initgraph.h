@@ -0,0 +1,108 @@
+/****************************************************************************
+ * include/nuttx/drivers/initgraph.h
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_NUTTX_DRIVERS_INITGRAPH_H
+#define __INCLUDE_NUTTX_DRIVERS_INITGRAPH_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+#include <nuttx/compiler.h>
+
+#include <sys/types.h>
+
+#ifdef CONFIG_DRIVERS_INITGRAPH
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* One node of a board initialization graph.  Steps are identified by name;
+ * a step runs only after every step named in its dependency list has
+ * completed successfully.  Steps with no unsatisfied dependencies between
+ * each other may run concurrently on the low-priority work queue, so a
+ * step's init function must not assume any ordering beyond what its
+ * dependency list declares.
+ */
+
+struct initgraph_step_s
+{
+  FAR const char *name;         /* Unique name of this step */
+  CODE int (*init)(void);       /* The initialization function */
+
+  /* NULL-terminated array of names of steps that must complete before
+   * this one runs, or NULL if the step has no dependencies.
+   */
+
+  FAR const char * const *deps;
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#ifdef __cplusplus
+#define EXTERN extern "C"
+extern "C"
+{
+#else
+#define EXTERN extern
+#endif
+
+/****************************************************************************
+ * Name: initgraph_run
+ *
+ * Description:
+ *   Execute a set of initialization steps, honoring the declared
+ *   dependencies and running independent steps concurrently on the
+ *   low-priority work queue.  The achievable parallelism is bounded by
+ *   CONFIG_SCHED_LPNTHREADS.  The function returns when every step has
+ *   either run or been skipped because one of its dependencies failed.
+ *
+ *   Typical use is from board_app_initialize() with a constant step table
+ *   so that drivers with long hardware delays (PHY auto-negotiation,
+ *   sensor warm-up, card detection) overlap instead of serializing the
+ *   boot.
+ *
+ * Input Parameters:
+ *   steps  - Table of initialization steps
+ *   nsteps - Number of entries in the table
+ *
+ * Returned Value:
+ *   OK if all steps completed successfully.  Otherwise the (negated errno)
+ *   return value of the first failing step is returned; -EINVAL is
+ *   returned if the table names an undefined dependency or contains a
+ *   dependency cycle.  Steps that could not run are logged by name.
+ *
+ ****************************************************************************/
+
+int initgraph_run(FAR const struct initgraph_step_s *steps, size_t nsteps);
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONFIG_DRIVERS_INITGRAPH */
+#endif /* __INCLUDE_NUTTX_DRIVERS_INITGRAPH_H */
@@ -37,7 +37,7 @@
 
 /* Initializers */
 
-#define NXEVENT_INITIALIZER(e, v) {LIST_INITIAL_VALUE((e).list), (v)}
+#define NXEVENT_INITIALIZER(e, v) {LIST_INITIAL_VALUE((e).list), (v), 0}
 
 /* Event Wait Flags */
 
@@ -60,8 +60,13 @@ typedef unsigned long         nxevent_flags_t;
 
 struct nxevent_s
 {
-  struct list_node         list;    /* Waiting list of nxevent_wait_t */
-  volatile nxevent_mask_t  events;  /* Pending Events */
+  struct list_node         list;     /* Waiting list of nxevent_wait_t */
+  volatile nxevent_mask_t  events;   /* Pending Events */
+  nxevent_mask_t           waitmask; /* OR of the events expected by all
+                                      * current waiters.  Posts that do not
+                                      * intersect this mask skip the waiting
+                                      * list scan entirely.
+                                      */
 };
 
 #ifdef CONFIG_FS_NAMED_EVENTS
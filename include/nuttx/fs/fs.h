@@ -181,6 +181,7 @@ struct inode;
 struct stat;
 struct statfs;
 struct pollfd;
+struct iovec;
 struct mtd_dev_s;
 struct tcb_s;
 
@@ -433,6 +434,9 @@ struct inode
   struct timespec   i_atime;    /* Time of last access */
   struct timespec   i_mtime;    /* Time of last modification */
   struct timespec   i_ctime;    /* Time of last status change */
+#endif
+#ifdef CONFIG_FS_LATENCY
+  FAR struct fslatency_s *i_latency; /* Operation latency histograms */
 #endif
   FAR void         *i_private;  /* Per inode driver private data */
   char              i_name[1];  /* Name of inode (variable) */
@@ -476,7 +480,7 @@ struct file
 {
   int               f_oflags;   /* Open mode flags */
 #ifdef CONFIG_FS_REFCOUNT
-  int               f_refs;     /* Reference count */
+  atomic_int        f_refs;     /* Reference count */
 #endif
   off_t             f_pos;      /* File position */
   FAR struct inode *f_inode;    /* Driver or file system interface */
@@ -511,6 +515,13 @@ struct filelist
   uint8_t           fl_crefs;   /* The references to filelist */
   FAR struct file **fl_files;   /* The pointer of two layer file descriptors array */
 
+  /* Top level arrays that were replaced by files_extend().  They may still
+   * be referenced by concurrent lock-free readers, so they are retired to
+   * this chain and not freed until the file list itself is released.
+   */
+
+  FAR void         *fl_retired;
+
   /* Pre-allocated files to avoid allocator access during thread creation
    * phase, For functional safety requirements, increase
    * CONFIG_NFILE_DESCRIPTORS_PER_BLOCK could also avoid allocator access
@@ -849,6 +860,29 @@ int nx_mount(FAR const char *source, FAR const char *target,
              FAR const void *data);
 #endif
 
+/****************************************************************************
+ * Name: nx_mount_async
+ *
+ * Description:
+ *   Queue a mount operation on the low-priority work queue and return
+ *   immediately so that several independent volumes can be brought up in
+ *   parallel during boot.  Completion can be observed through inotify on
+ *   the target path (CONFIG_FS_NOTIFY) or by polling the target path.
+ *   Unlike nx_mount(), 'data' must be a NUL-terminated option string (or
+ *   NULL) since it is copied for the deferred call.
+ *
+ * Returned Value:
+ *   Zero is returned if the mount was successfully queued; a negated errno
+ *   value is returned on any failure to queue it.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_MOUNT_ASYNC
+int nx_mount_async(FAR const char *source, FAR const char *target,
+                   FAR const char *filesystemtype, unsigned long mountflags,
+                   FAR const char *data);
+#endif
+
 /****************************************************************************
  * Name: nx_umount2
  *
@@ -1440,6 +1474,52 @@ ssize_t file_read(FAR struct file *filep, FAR void *buf, size_t nbytes);
 
 ssize_t nx_read(int fd, FAR void *buf, size_t nbytes);
 
+/****************************************************************************
+ * Name: file_readv
+ *
+ * Description:
+ *   Equivalent to the standard readv() function except that it accepts a
+ *   struct file instance instead of a file descriptor.  Where possible the
+ *   whole vector is presented to the underlying driver or mountpoint as a
+ *   single read so that the transfer may be performed in one operation.
+ *
+ * Input Parameters:
+ *   filep  - File structure instance
+ *   iov    - Array of read buffer descriptors
+ *   iovcnt - Number of elements in iov[]
+ *
+ * Returned Value:
+ *   The positive non-zero number of bytes read on success, 0 on if an
+ *   end-of-file condition, or a negated errno value on any failure.
+ *
+ ****************************************************************************/
+
+ssize_t file_readv(FAR struct file *filep, FAR const struct iovec *iov,
+                   int iovcnt);
+
+/****************************************************************************
+ * Name: nx_readv
+ *
+ * Description:
+ *   nx_readv() is an internal OS interface.  It is functionally similar to
+ *   the standard readv() interface except:
+ *
+ *    - It does not modify the errno variable, and
+ *    - It is not a cancellation point.
+ *
+ * Input Parameters:
+ *   fd     - File descriptor to read from
+ *   iov    - Array of read buffer descriptors
+ *   iovcnt - Number of elements in iov[]
+ *
+ * Returned Value:
+ *   The positive non-zero number of bytes read on success, 0 on if an
+ *   end-of-file condition, or a negated errno value on any failure.
+ *
+ ****************************************************************************/
+
+ssize_t nx_readv(int fd, FAR const struct iovec *iov, int iovcnt);
+
 /****************************************************************************
  * Name: file_write
  *
@@ -1496,6 +1576,57 @@ ssize_t file_write(FAR struct file *filep, FAR const void *buf,
 
 ssize_t nx_write(int fd, FAR const void *buf, size_t nbytes);
 
+/****************************************************************************
+ * Name: file_writev
+ *
+ * Description:
+ *   Equivalent to the standard writev() function except that it accepts a
+ *   struct file instance instead of a file descriptor.  Where possible the
+ *   vector is gathered into one contiguous transfer so that the underlying
+ *   driver or mountpoint sees a single large write instead of one write
+ *   per buffer.
+ *
+ * Input Parameters:
+ *   filep  - Instance of struct file to use with the write
+ *   iov    - Array of write buffer descriptors
+ *   iovcnt - Number of elements in iov[]
+ *
+ * Returned Value:
+ *  On success, the number of bytes written are returned (zero indicates
+ *  nothing was written).  On any failure, a negated errno value is returned
+ *  (see comments with write() for a description of the appropriate errno
+ *  values).
+ *
+ ****************************************************************************/
+
+ssize_t file_writev(FAR struct file *filep, FAR const struct iovec *iov,
+                    int iovcnt);
+
+/****************************************************************************
+ * Name: nx_writev
+ *
+ * Description:
+ *  nx_writev() is an internal OS interface.  It is functionally equivalent
+ *  to the standard writev() interface except that:
+ *
+ *  - It does not modify the errno variable, and
+ *  - It is not a cancellation point.
+ *
+ * Input Parameters:
+ *   fd     - file descriptor to write to
+ *   iov    - Array of write buffer descriptors
+ *   iovcnt - Number of elements in iov[]
+ *
+ * Returned Value:
+ *  On success, the number of bytes written are returned (zero indicates
+ *  nothing was written).  On any failure, a negated errno value is returned
+ *  (see comments with write() for a description of the appropriate errno
+ *   values).
+ *
+ ****************************************************************************/
+
+ssize_t nx_writev(int fd, FAR const struct iovec *iov, int iovcnt);
+
 /****************************************************************************
  * Name: file_pread
  *
@@ -345,6 +345,13 @@
                                            *      to return sector numbers.
                                            * OUT: Data return in user-provided
                                            *      buffer. */
+#define BIOC_GC         _BIOC(0x0011)     /* Collect released sectors on
+                                           * SMART flash devices.
+                                           * IN:  Number of free sectors to
+                                           *      maintain as a reserve.
+                                           * OUT: None (ioctl return value
+                                           *      provides success/failure
+                                           *      indication). */
 
 /* NuttX MTD driver ioctl definitions ***************************************/
 
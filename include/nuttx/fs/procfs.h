@@ -128,6 +128,28 @@ struct procfs_dir_priv_s
   FAR const struct procfs_entry_s *procfsentry; /* Pointer to procfs handler entry */
 };
 
+#ifdef CONFIG_FS_PROCFS_GENBUF
+/* Describes a per-open generation buffer.  A handler embeds this structure
+ * in its open file structure and routes its read method through
+ * procfs_genbuf_read() so that the file content is rendered once and
+ * subsequent sequential reads are served from the buffer.
+ */
+
+struct procfs_genbuf_s
+{
+  FAR char *buffer;                             /* Rendered file content */
+  size_t size;                                  /* Allocated buffer size */
+  size_t len;                                   /* Valid content length */
+};
+
+/* Renders file content into 'buffer', skipping the first 'offset' bytes.
+ * Returns the number of bytes written or a negated errno value.
+ */
+
+typedef CODE ssize_t (*procfs_render_t)(FAR void *arg, FAR char *buffer,
+                                        size_t buflen, off_t offset);
+#endif
+
 /* An entry for procfs_register_meminfo */
 
 struct mm_heap_s;
@@ -245,6 +267,57 @@ int procfs_snprintf(FAR char *buf, size_t size,
 void procfs_sprintf(FAR char *buf, size_t size, FAR off_t *offset,
                     FAR const IPTR char *format, ...) printf_like(4, 5);
 
+/****************************************************************************
+ * Name: procfs_genbuf_read
+ *
+ * Description:
+ *   Serve a read from a per-open generation buffer.  When the file is read
+ *   from offset zero (or nothing has been rendered for this open yet), the
+ *   complete content is rendered once by the 'render' callback into the
+ *   buffer, growing it as needed; the requested window and all subsequent
+ *   sequential reads are then satisfied by copying from the buffer.  The
+ *   file position is advanced by the number of bytes returned.
+ *
+ *   If the buffer cannot be allocated, the read falls back to a direct
+ *   windowed render, preserving the uncached behavior.
+ *
+ * Input Parameters:
+ *   gen    - The generation buffer of this open file
+ *   filep  - The open file instance (provides and updates f_pos)
+ *   buffer - The user's receive buffer
+ *   buflen - The size (in bytes) of the user's receive buffer
+ *   render - Callback that renders the file content
+ *   arg    - Opaque argument passed to the render callback
+ *
+ * Returned Value:
+ *   The number of bytes transferred to the user's receive buffer, or a
+ *   negated errno value on failure.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_PROCFS_GENBUF
+ssize_t procfs_genbuf_read(FAR struct procfs_genbuf_s *gen,
+                           FAR struct file *filep, FAR char *buffer,
+                           size_t buflen, procfs_render_t render,
+                           FAR void *arg);
+#endif
+
+/****************************************************************************
+ * Name: procfs_genbuf_free
+ *
+ * Description:
+ *   Release the memory held by a generation buffer.  Must be called when
+ *   the open file structure embedding the buffer is released.
+ *
+ * Input Parameters:
+ *   gen - The generation buffer to release
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_PROCFS_GENBUF
+void procfs_genbuf_free(FAR struct procfs_genbuf_s *gen);
+#endif
+
 /****************************************************************************
  * Name: procfs_register
  *
@@ -0,0 +1,114 @@
+/****************************************************************************
+ * include/nuttx/futex.h
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_NUTTX_FUTEX_H
+#define __INCLUDE_NUTTX_FUTEX_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <time.h>
+
+#ifdef CONFIG_FUTEX
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#undef EXTERN
+#if defined(__cplusplus)
+#define EXTERN extern "C"
+extern "C"
+{
+#else
+#define EXTERN extern
+#endif
+
+/****************************************************************************
+ * Name: futex_wait
+ *
+ * Description:
+ *   Atomically verify that the 32-bit word at 'addr' still contains the
+ *   expected value 'val' and, if so, block until another task calls
+ *   futex_wake() on the same address or the timeout expires.  If the word
+ *   no longer contains 'val' the call returns immediately; the caller
+ *   re-reads the word and decides whether to retry.
+ *
+ *   The word is owned by the application and may live in a shared memory
+ *   segment; only its address is used as the wait channel.  The intended
+ *   fast path performs atomic operations on the word purely in user space
+ *   and calls futex_wait() only when it actually has to sleep.
+ *
+ * Input Parameters:
+ *   addr    - Address of the 32-bit word to wait on
+ *   val     - The value 'addr' is expected to still hold
+ *   timeout - Relative time to wait, or NULL to wait forever
+ *
+ * Returned Value:
+ *   Zero (OK) when woken by futex_wake(); a negated errno value on
+ *   failure:
+ *
+ *     -EAGAIN    The word did not contain the expected value.
+ *     -ETIMEDOUT The timeout elapsed before a wake arrived.
+ *     -EINTR     The wait was interrupted by a signal.
+ *     -EINVAL    'addr' is NULL or 'timeout' is invalid.
+ *
+ ****************************************************************************/
+
+int futex_wait(FAR const uint32_t *addr, uint32_t val,
+               FAR const struct timespec *timeout);
+
+/****************************************************************************
+ * Name: futex_wake
+ *
+ * Description:
+ *   Wake up to 'count' tasks currently blocked in futex_wait() on the
+ *   32-bit word at 'addr'.  Waiters are woken in FIFO order.  Waking when
+ *   there are no waiters is cheap:  one hash bucket is scanned under a
+ *   critical section and no scheduling occurs.
+ *
+ * Input Parameters:
+ *   addr  - Address of the 32-bit word waiters are blocked on
+ *   count - Maximum number of waiters to wake (e.g. 1 for a hand-off,
+ *           INT_MAX for a broadcast)
+ *
+ * Returned Value:
+ *   The number of tasks woken (zero or more) on success; a negated errno
+ *   value on failure:
+ *
+ *     -EINVAL  'addr' is NULL or 'count' is negative.
+ *
+ ****************************************************************************/
+
+int futex_wake(FAR const uint32_t *addr, int count);
+
+#undef EXTERN
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* CONFIG_FUTEX */
+#endif /* __INCLUDE_NUTTX_FUTEX_H */
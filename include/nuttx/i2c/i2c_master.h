@@ -34,6 +34,10 @@
 
 #include <nuttx/fs/ioctl.h>
 
+#ifdef CONFIG_I2C_ASYNC
+#  include <nuttx/queue.h>
+#endif
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
@@ -270,6 +274,30 @@ struct i2c_transfer_s
   size_t msgc;                /* Number of messages in the array. */
 };
 
+#ifdef CONFIG_I2C_ASYNC
+/* One asynchronously queued transfer.  The structure, the message array
+ * and the message buffers are provided by the caller and must remain
+ * valid until the completion callback has been invoked.
+ */
+
+struct i2c_async_s;           /* Opaque transfer queue state */
+struct i2c_async_req_s
+{
+  sq_entry_t node;            /* Supports a singly linked list.  Must be
+                               * the first field in the structure. */
+  FAR struct i2c_msg_s *msgv; /* Array of I2C messages for the transfer */
+  int msgc;                   /* Number of messages in the array */
+
+  /* Invoked from the low priority work queue when the transfer has
+   * completed.  The result of I2C_TRANSFER is in req->result.
+   */
+
+  CODE void (*callback)(FAR struct i2c_async_req_s *req);
+  FAR void *arg;              /* Available for use by the client */
+  int result;                 /* Result of the transfer */
+};
+#endif
+
 /****************************************************************************
  * Public Functions Definitions
  ****************************************************************************/
@@ -383,6 +411,86 @@ int i2c_read(FAR struct i2c_master_s *dev,
              FAR const struct i2c_config_s *config,
              FAR uint8_t *buffer, int buflen);
 
+/****************************************************************************
+ * Name: i2c_async_initialize
+ *
+ * Description:
+ *   Create an asynchronous transfer queue on top of an I2C bus.  Requests
+ *   queued with i2c_async_transfer() are performed in FIFO order on the
+ *   low priority work queue using the normal, synchronous I2C_TRANSFER
+ *   interface of the bus.
+ *
+ * Input Parameters:
+ *   i2c - An instance of the lower half I2C driver
+ *
+ * Returned Value:
+ *   A reference to the transfer queue on success; NULL on allocation
+ *   failure.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_I2C_ASYNC
+FAR struct i2c_async_s *i2c_async_initialize(FAR struct i2c_master_s *i2c);
+
+/****************************************************************************
+ * Name: i2c_async_uninitialize
+ *
+ * Description:
+ *   Destroy an asynchronous transfer queue.  The queue must be idle:  All
+ *   queued requests must have completed (or been cancelled) before this
+ *   function is called.
+ *
+ * Input Parameters:
+ *   async - The transfer queue to destroy
+ *
+ ****************************************************************************/
+
+void i2c_async_uninitialize(FAR struct i2c_async_s *async);
+
+/****************************************************************************
+ * Name: i2c_async_transfer
+ *
+ * Description:
+ *   Queue a sequence of I2C transfers for asynchronous completion.  The
+ *   function returns immediately; when the bus transaction has finished,
+ *   req->result holds the result of I2C_TRANSFER and the completion
+ *   callback of the request is invoked from the low priority work queue.
+ *
+ * Input Parameters:
+ *   async - The transfer queue
+ *   req   - The request to queue
+ *
+ * Returned Value:
+ *   Zero (OK) if the request was queued; a negated errno value on failure.
+ *   Failure to queue does not invoke the callback.
+ *
+ ****************************************************************************/
+
+int i2c_async_transfer(FAR struct i2c_async_s *async,
+                       FAR struct i2c_async_req_s *req);
+
+/****************************************************************************
+ * Name: i2c_async_cancel
+ *
+ * Description:
+ *   Remove a request from the transfer queue before it has been started.
+ *   The completion callback of a cancelled request is not invoked.
+ *
+ * Input Parameters:
+ *   async - The transfer queue
+ *   req   - The request to cancel
+ *
+ * Returned Value:
+ *   Zero (OK) if the request was still queued and has been removed;
+ *   -ENOENT if the request is not in the queue (it may have completed
+ *   already or be in progress on the bus).
+ *
+ ****************************************************************************/
+
+int i2c_async_cancel(FAR struct i2c_async_s *async,
+                     FAR struct i2c_async_req_s *req);
+#endif /* CONFIG_I2C_ASYNC */
+
 #undef EXTERN
 #if defined(__cplusplus)
 }
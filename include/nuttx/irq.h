@@ -76,13 +76,41 @@
 #endif /* __ASSEMBLY__ */
 
 #ifdef CONFIG_SMP
-#  define cpu_irqlock_clear() \
+#  ifdef CONFIG_MCS_SPINLOCK
+/* With CONFIG_MCS_SPINLOCK the critical section lock is a queued (MCS)
+ * lock.  Each CPU owns one queue node; the node of the acquiring CPU must
+ * also be used for the release, which is safe here because g_cpu_irqlock
+ * is always released by the CPU that acquired it.
+ */
+
+#    define cpu_irqlock_acquire() \
+  mcs_lock_acquire(&g_cpu_irqlock, &g_cpu_irqlock_node[this_cpu()])
+#    define cpu_irqlock_acquire_wo_note() \
+  mcs_lock_acquire(&g_cpu_irqlock, &g_cpu_irqlock_node[this_cpu()])
+#    define cpu_irqlock_islocked() \
+  mcs_lock_is_locked(&g_cpu_irqlock)
+#    define cpu_irqlock_clear() \
+  do \
+    { \
+      g_cpu_irqset = 0; \
+      mcs_lock_release(&g_cpu_irqlock, &g_cpu_irqlock_node[this_cpu()]); \
+    } \
+  while (0)
+#  else
+#    define cpu_irqlock_acquire() \
+  spin_lock(&g_cpu_irqlock)
+#    define cpu_irqlock_acquire_wo_note() \
+  spin_lock_wo_note(&g_cpu_irqlock)
+#    define cpu_irqlock_islocked() \
+  spin_is_locked(&g_cpu_irqlock)
+#    define cpu_irqlock_clear() \
   do \
     { \
       g_cpu_irqset = 0; \
       spin_unlock_wo_note(&g_cpu_irqlock); \
     } \
   while (0)
+#  endif
 #endif
 
 /* Interrupt was handled by this device */
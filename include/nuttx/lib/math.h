@@ -71,6 +71,8 @@
 #include <nuttx/config.h>
 #include <nuttx/compiler.h>
 
+#include <stddef.h>
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
@@ -402,6 +404,8 @@ long double frexpl(long double x, FAR int *exp);
 /* Trigonometric Functions **************************************************/
 
 void        sincosf(float, FAR float *, FAR float *);
+void        sinf_batch(FAR float *, size_t);
+void        cosf_batch(FAR float *, size_t);
 #ifdef CONFIG_HAVE_DOUBLE
 void        sincos(double, FAR double *, FAR double *);
 #endif
@@ -127,6 +127,10 @@ struct iob_s
 #endif
   unsigned int io_pktlen; /* Total length of the packet */
 
+#ifdef CONFIG_IOB_LOCKFREE
+  uint16_t io_index;      /* Index of this buffer in the pre-allocated pool */
+#endif
+
 #ifdef CONFIG_IOB_ALLOC
   iob_free_cb_t io_free;  /* Custom free callback */
   FAR uint8_t  *io_data;
@@ -92,6 +92,21 @@ struct mempool_procfs_entry_s
 };
 #endif
 
+#ifdef CONFIG_MM_MEMPOOL_MAGAZINE
+/* This structure describes one per-CPU magazine of pool blocks.  Each CPU
+ * pops allocations from and pushes freed blocks onto its own magazine with
+ * only local interrupts disabled; the pool spinlock is taken only to
+ * exchange a batch of blocks with the shared free queue when the magazine
+ * runs empty or full.
+ */
+
+struct mempool_magazine_s
+{
+  uint8_t    count;  /* The number of blocks held in this magazine */
+  FAR void  *blks[CONFIG_MM_MEMPOOL_MAGAZINE_SIZE];
+};
+#endif
+
 /* This structure describes memory buffer pool */
 
 struct mempool_s
@@ -115,6 +130,9 @@ struct mempool_s
   size_t     nalloc;  /* The number of used block in mempool */
   spinlock_t lock;    /* The protect lock to mempool */
   sem_t      waitsem; /* The semaphore of waiter get free block */
+#ifdef CONFIG_MM_MEMPOOL_MAGAZINE
+  struct mempool_magazine_s magazine[CONFIG_SMP_NCPUS];
+#endif
 #if defined(CONFIG_FS_PROCFS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_MEMPOOL)
   struct mempool_procfs_entry_s procfs; /* The entry of procfs */
 #endif
@@ -33,6 +33,7 @@
 
 #include <sys/types.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <malloc.h>
 
 /****************************************************************************
@@ -177,6 +178,22 @@ struct mempool_init_s
   size_t            dict_expendsize;
 };
 
+#ifdef CONFIG_MM_HEAP_STATS
+/* Allocator health counters.  One instance per CPU lives inside each
+ * heap and is updated without locking; mm_heapstats() returns the sum
+ * over all CPUs.
+ */
+
+#define MM_HEAP_STATS_NBUCKETS 32
+
+struct mm_heapstats_s
+{
+  uint32_t hist[MM_HEAP_STATS_NBUCKETS]; /* Allocations per log2 size */
+  uint32_t contended;                    /* Lock takes that had to wait */
+  uint32_t failures;                     /* Failed allocations */
+};
+#endif
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -406,6 +423,11 @@ struct mallinfo_task mm_mallinfo_task(FAR struct mm_heap_s *heap,
 size_t mm_heapfree(FAR struct mm_heap_s *heap);
 size_t mm_heapfree_largest(FAR struct mm_heap_s *heap);
 
+#ifdef CONFIG_MM_HEAP_STATS
+void mm_heapstats(FAR struct mm_heap_s *heap,
+                  FAR struct mm_heapstats_s *stats);
+#endif
+
 /* Functions contained in kmm_mallinfo.c ************************************/
 
 #ifdef CONFIG_MM_KERNEL_HEAP
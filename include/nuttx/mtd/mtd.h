@@ -150,6 +150,19 @@ struct mtd_erase_s
   uint32_t nblocks;     /* Number of blocks to be erased */
 };
 
+/* This structure describes one segment of a scatter-gather block
+ * transfer:  'nblocks' read/write blocks beginning at 'startblock' are
+ * transferred to/from 'buffer'.  Segments need not be adjacent on the
+ * device.
+ */
+
+struct mtd_iovec_s
+{
+  FAR uint8_t *buffer;  /* User buffer for this segment */
+  off_t        startblock; /* First read/write block of the segment */
+  size_t       nblocks; /* Number of read/write blocks in the segment */
+};
+
 /* This structure defines the interface to a simple memory technology device.
  * It will likely need to be extended in the future to support more complex
  * devices.
@@ -204,6 +217,21 @@ struct mtd_dev_s
   CODE int (*isbad)(FAR struct mtd_dev_s *dev, off_t block);
   CODE int (*markbad)(FAR struct mtd_dev_s *dev, off_t block);
 
+  /* Scatter-gather bulk transfers (optional, may be NULL).  All segments
+   * are transferred under a single driver lock so that a multi-segment
+   * transfer costs one lock/setup sequence instead of one per segment.
+   * On success the total number of blocks transferred is returned.
+   * Callers must fall back to looping over bread/bwrite when these
+   * methods are NULL.
+   */
+
+  CODE ssize_t (*breadv)(FAR struct mtd_dev_s *dev,
+                         FAR const struct mtd_iovec_s *iov,
+                         size_t iovcnt);
+  CODE ssize_t (*bwritev)(FAR struct mtd_dev_s *dev,
+                          FAR const struct mtd_iovec_s *iov,
+                          size_t iovcnt);
+
   /* Name of this MTD device */
 
   FAR const char *name;
@@ -289,6 +317,58 @@ int mtd_setpartitionname(FAR struct mtd_dev_s *mtd, FAR const char *name);
 FAR struct mtd_dev_s *mtd_rwb_initialize(FAR struct mtd_dev_s *mtd);
 #endif
 
+/****************************************************************************
+ * Name: mtd_async_initialize
+ *
+ * Description:
+ *   Create an initialized MTD device instance.  This MTD driver contains
+ *   another MTD driver and performs its erase operations in the background
+ *   on the low-priority work queue.  Reads and writes that do not touch a
+ *   block with a pending erase are never delayed by an erase.
+ *
+ *   MTD devices are not registered in the file system, but are created as
+ *   instances that can be bound to other functions (such as a block or
+ *   character driver front end).
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_MTD_ASYNC_ERASE
+FAR struct mtd_dev_s *mtd_async_initialize(FAR struct mtd_dev_s *mtd);
+#endif
+
+/****************************************************************************
+ * Name: mtd_interleave
+ *
+ * Description:
+ *   Given 'count' MTD driver instances with identical geometry (such as
+ *   the individual dice of a multi-die NAND, each attached as its own
+ *   MTD device), create a single MTD driver instance that interleaves
+ *   erase blocks across them:  Logical erase block i resides on device
+ *   i % count.  Transfers and erases that span several erase blocks are
+ *   split by device and the parts for the second and subsequent devices
+ *   are executed on the low-priority work queue, overlapping the device
+ *   busy times so that bulk throughput approaches the aggregate of the
+ *   underlying devices.
+ *
+ *   MTD devices are not registered in the file system, but are created as
+ *   instances that can be bound to other functions (such as a block or
+ *   character driver front end).
+ *
+ * Input Parameters:
+ *   mtds  - Array of the MTD devices to be interleaved
+ *   count - The number of MTD devices in the array
+ *
+ * Returned Value:
+ *   On success, an MTD device representing the interleaved devices is
+ *   returned.  NULL is returned on a failure.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_MTD_INTERLEAVE
+FAR struct mtd_dev_s *mtd_interleave(FAR struct mtd_dev_s **mtds,
+                                     unsigned int count);
+#endif
+
 /****************************************************************************
  * Name: ftl_initialize_by_path
  *
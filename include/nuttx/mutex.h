@@ -32,13 +32,32 @@
 
 #include <nuttx/semaphore.h>
 
+#ifdef CONFIG_LIBC_MUTEX_FASTPATH
+#  include <nuttx/atomic.h>
+#endif
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
 
 #define NXMUTEX_NO_HOLDER      ((pid_t)-1)
-#define NXMUTEX_INITIALIZER    {NXSEM_INITIALIZER(1, SEM_TYPE_MUTEX | \
+#ifdef CONFIG_LIBC_MUTEX_FASTPATH
+/* With the atomic fast path the semaphore is used only as a sleep/wake
+ * channel for contended lockers, so its count starts at zero and the
+ * lock state lives in the "fast" word.
+ */
+
+#  define NXMUTEX_FAST_UNLOCKED   0  /* No owner */
+#  define NXMUTEX_FAST_LOCKED     1  /* Owned, no contention observed */
+#  define NXMUTEX_FAST_CONTENDED  2  /* Owned, waiters may be sleeping */
+
+#  define NXMUTEX_INITIALIZER  {NXSEM_INITIALIZER(0, SEM_TYPE_MUTEX | \
+                                SEM_PRIO_INHERIT), NXMUTEX_NO_HOLDER, \
+                                NXMUTEX_FAST_UNLOCKED}
+#else
+#  define NXMUTEX_INITIALIZER  {NXSEM_INITIALIZER(1, SEM_TYPE_MUTEX | \
                                 SEM_PRIO_INHERIT), NXMUTEX_NO_HOLDER}
+#endif
 #define NXRMUTEX_INITIALIZER   {NXMUTEX_INITIALIZER, 0}
 
 /****************************************************************************
@@ -49,6 +68,9 @@ struct mutex_s
 {
   sem_t sem;
   pid_t holder;
+#ifdef CONFIG_LIBC_MUTEX_FASTPATH
+  atomic_int fast;  /* NXMUTEX_FAST_* lock word, CAS-ed in user space */
+#endif
 #if CONFIG_LIBC_MUTEX_BACKTRACE > 0
   FAR void *backtrace[CONFIG_LIBC_MUTEX_BACKTRACE];
 #endif
@@ -341,6 +363,50 @@ int nxmutex_breaklock(FAR mutex_t *mutex, FAR unsigned int *locked);
 
 int nxmutex_restorelock(FAR mutex_t *mutex, unsigned int locked);
 
+/****************************************************************************
+ * Name: nxmutex_condlock
+ *
+ * Description:
+ *   This function locks the mutex like nxmutex_lock() but always acquires
+ *   through the contended path so that the contended marker is left in
+ *   the lock word.  It must be used to re-acquire the mutex after a
+ *   condition variable wait, where pthread_cond_broadcast() may have
+ *   requeued further waiters directly onto the mutex wait queue.
+ *
+ * Parameters:
+ *   mutex   - mutex descriptor.
+ *
+ * Return Value:
+ *   This is an internal OS interface and should not be used by
+ *   applications.  It follows the NuttX internal error return policy:
+ *   Zero (OK) is returned on success.  A negated errno value is returned
+ *   on failure
+ *
+ ****************************************************************************/
+
+int nxmutex_condlock(FAR mutex_t *mutex);
+
+/****************************************************************************
+ * Name: nxmutex_condrestorelock
+ *
+ * Description:
+ *   This function attempts to restore the mutex after a condition
+ *   variable wait, re-acquiring it with nxmutex_condlock().
+ *
+ * Parameters:
+ *   mutex   - mutex descriptor.
+ *   locked  - true: it's mean that the mutex is broke success
+ *
+ * Return Value:
+ *   This is an internal OS interface and should not be used by
+ *   applications.  It follows the NuttX internal error return policy:
+ *   Zero (OK) is returned on success.  A negated errno value is returned
+ *   on failure
+ *
+ ****************************************************************************/
+
+int nxmutex_condrestorelock(FAR mutex_t *mutex, unsigned int locked);
+
 /****************************************************************************
  * Name: nxmutex_set_protocol
  *
@@ -679,6 +745,27 @@ int nxrmutex_breaklock(FAR rmutex_t *rmutex, FAR unsigned int *count);
 
 int nxrmutex_restorelock(FAR rmutex_t *rmutex, unsigned int count);
 
+/****************************************************************************
+ * Name: nxrmutex_condrestorelock
+ *
+ * Description:
+ *   This function attempts to restore the recursive mutex after a
+ *   condition variable wait, re-acquiring it with nxmutex_condlock().
+ *
+ * Parameters:
+ *   rmutex - Recursive mutex descriptor.
+ *   count  - Recursion count to restore.
+ *
+ * Return Value:
+ *   This is an internal OS interface and should not be used by
+ *   applications.  It follows the NuttX internal error return policy:
+ *   Zero (OK) is returned on success.  A negated errno value is returned
+ *   on failure.
+ *
+ ****************************************************************************/
+
+int nxrmutex_condrestorelock(FAR rmutex_t *rmutex, unsigned int count);
+
 #define nxrmutex_set_protocol(rmutex, protocol) \
         nxmutex_set_protocol(&(rmutex)->mutex, protocol)
 #define nxrmutex_getprioceiling(rmutex, prioceiling) \
@@ -928,6 +928,67 @@ ssize_t psock_sendmsg(FAR struct socket *psock, FAR struct msghdr *msg,
 ssize_t psock_recvmsg(FAR struct socket *psock, FAR struct msghdr *msg,
                       int flags);
 
+/****************************************************************************
+ * Name: psock_sendmmsg
+ *
+ * Description:
+ *   psock_sendmmsg() sends multiple messages on a socket with a single
+ *   call.  This is an internal OS interface.  It is functionally
+ *   equivalent to sendmmsg() except that:
+ *
+ *   - It is not a cancellation point,
+ *   - It does not modify the errno variable, and
+ *   - It accepts the internal socket structure as an input rather than an
+ *     task-specific socket descriptor.
+ *
+ * Input Parameters:
+ *   psock    A pointer to a NuttX-specific, internal socket structure
+ *   msgvec   Array of messages to send
+ *   vlen     Number of elements in msgvec
+ *   flags    Send flags, applied to each message
+ *
+ * Returned Value:
+ *   On success, returns the number of messages sent.  If nothing could be
+ *   sent, a negated errno value is returned (see comments with sendmsg()
+ *   for a list of appropriate errno values).
+ *
+ ****************************************************************************/
+
+int psock_sendmmsg(FAR struct socket *psock, FAR struct mmsghdr *msgvec,
+                   unsigned int vlen, int flags);
+
+/****************************************************************************
+ * Name: psock_recvmmsg
+ *
+ * Description:
+ *   psock_recvmmsg() receives multiple messages from a socket with a
+ *   single call.  This is an internal OS interface.  It is functionally
+ *   equivalent to recvmmsg() except that:
+ *
+ *   - It is not a cancellation point,
+ *   - It does not modify the errno variable, and
+ *   - It accepts the internal socket structure as an input rather than an
+ *     task-specific socket descriptor.
+ *
+ * Input Parameters:
+ *   psock    A pointer to a NuttX-specific, internal socket structure
+ *   msgvec   Array of message buffers to fill
+ *   vlen     Number of elements in msgvec
+ *   flags    Receive flags, applied to each message
+ *   timeout  Receive no more messages after this time has elapsed,
+ *            or NULL for no time limit
+ *
+ * Returned Value:
+ *   On success, returns the number of messages received.  If nothing could
+ *   be received, a negated errno value is returned (see comments with
+ *   recvmsg() for a list of appropriate errno values).
+ *
+ ****************************************************************************/
+
+int psock_recvmmsg(FAR struct socket *psock, FAR struct mmsghdr *msgvec,
+                   unsigned int vlen, int flags,
+                   FAR struct timespec *timeout);
+
 /****************************************************************************
  * Name: psock_send
  *
@@ -99,6 +99,28 @@
 #  define RADIO_MAX_ADDRLEN CONFIG_PKTRADIO_ADDRLEN
 #endif
 
+/* Hardware offload capabilities that a device driver may advertise in the
+ * d_hwcaps field.  A set capability tells the network stack to skip the
+ * corresponding software work for packets on this device; the hardware is
+ * then responsible for it.
+ */
+
+#define NETDEV_HWCAP_TX_CSUM  (1 << 0)  /* Hardware inserts the complete
+                                         * L4 (TCP/UDP) checksum on
+                                         * transmit, including the pseudo-
+                                         * header contribution */
+#define NETDEV_HWCAP_RX_CSUM  (1 << 1)  /* Hardware validates L4 checksums
+                                         * on receive and drops bad frames
+                                         * before they reach the stack */
+#define NETDEV_HWCAP_TSO      (1 << 2)  /* Hardware segments large TCP
+                                         * sends into MSS-sized frames */
+
+#ifdef CONFIG_NETDEV_HWCAP
+#  define NETDEV_HAS_HWCAP(dev,cap) (((dev)->d_hwcaps & (cap)) != 0)
+#else
+#  define NETDEV_HAS_HWCAP(dev,cap) (0)
+#endif
+
 /* Helper macros for network device statistics */
 
 #ifdef CONFIG_NETDEV_STATISTICS
@@ -327,6 +349,14 @@ struct net_driver_s
 
   uint32_t d_flags;
 
+#ifdef CONFIG_NETDEV_HWCAP
+  /* Hardware offload capabilities advertised by the driver.  See the
+   * NETDEV_HWCAP_* definitions above.
+   */
+
+  uint8_t d_hwcaps;
+#endif
+
   /* Multi network devices using multiple link layer protocols are
    * supported
    */
@@ -418,6 +448,15 @@ struct net_driver_s
   FAR struct iob_queue_s d_fragout;
 #endif
 
+  /* Queue of TCP connections bound to this device that have pending TX
+   * work.  Device polls drain this queue instead of traversing the full
+   * connection table.
+   */
+
+#ifdef CONFIG_NET_TCP_TXREADYQ
+  sq_queue_t d_txready;
+#endif
+
   /* The d_buf array is used to hold incoming and outgoing packets. The
    * device driver should place incoming data into this buffer.  When sending
    * data, the device driver should read the link level headers and the
@@ -301,6 +301,20 @@ ssize_t usrsock_response(FAR const char *buffer, size_t len,
 
 int usrsock_request(FAR struct iovec *iov, unsigned int iovcnt);
 
+/****************************************************************************
+ * Name: usrsock_request_consumed() - release the pending usrsock request
+ *
+ * Description:
+ *   Called by the usrsock link driver once the daemon has consumed the
+ *   request buffers handed over by usrsock_request(), allowing the next
+ *   request to be issued before the response to this one has arrived.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_USRSOCK_PIPELINE
+void usrsock_request_consumed(void);
+#endif
+
 /****************************************************************************
  * Name: usrsock_register
  *
@@ -27,8 +27,14 @@
  * Included Files
  ****************************************************************************/
 
+#include <nuttx/config.h>
+
 #include <stdint.h>
 
+#ifdef CONFIG_SMP
+#  include <sched.h>
+#endif
+
 #include <nuttx/list.h>
 #include <nuttx/pci/pci_ids.h>
 #include <nuttx/pci/pci_regs.h>
@@ -817,6 +823,47 @@ void pci_release_irq(FAR struct pci_device_s *dev, FAR int *irq, int num);
 
 int pci_connect_irq(FAR struct pci_device_s *dev, FAR int *irq, int num);
 
+#ifdef CONFIG_SMP
+/****************************************************************************
+ * Name: pci_set_irq_affinity
+ *
+ * Description:
+ *   Bind one MSI or MSI-X vector to the given set of CPUs.
+ *
+ * Input Parameters:
+ *   dev    - PCI device
+ *   irq    - The vector, as returned by pci_connect_irq()
+ *   cpuset - The set of CPUs that may service the vector
+ *
+ * Return value:
+ *   Failed if return a negative value, otherwise success
+ *
+ ****************************************************************************/
+
+int pci_set_irq_affinity(FAR struct pci_device_s *dev, int irq,
+                         cpu_set_t cpuset);
+
+/****************************************************************************
+ * Name: pci_spread_irqs
+ *
+ * Description:
+ *   Spread a set of MSI or MSI-X vectors round-robin over all CPUs, so
+ *   that per-queue vectors of a multi-queue device are serviced on
+ *   different CPUs.
+ *
+ * Input Parameters:
+ *   dev - PCI device
+ *   irq - The vectors, as returned by pci_connect_irq()
+ *   num - number of vectors
+ *
+ * Return value:
+ *   Failed if return a negative value, otherwise success
+ *
+ ****************************************************************************/
+
+int pci_spread_irqs(FAR struct pci_device_s *dev, FAR int *irq, int num);
+#endif /* CONFIG_SMP */
+
 /****************************************************************************
  * Name: pci_register_driver
  *
@@ -450,6 +450,19 @@ FAR const struct pm_governor_s *pm_stability_governor_initialize(void);
 
 FAR const struct pm_governor_s *pm_greedy_governor_initialize(void);
 
+/****************************************************************************
+ * Name: pm_deadline_governor_initialize
+ *
+ * Description:
+ *   Return the deadline governor instance.
+ *
+ * Returned Value:
+ *   A pointer to the governor struct. Otherwise NULL is returned on error.
+ *
+ ****************************************************************************/
+
+FAR const struct pm_governor_s *pm_deadline_governor_initialize(void);
+
 /****************************************************************************
  * Name: pm_activity_governor_initialize
  *
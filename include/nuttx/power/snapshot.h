@@ -0,0 +1,169 @@
+/****************************************************************************
+ * include/nuttx/power/snapshot.h
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_NUTTX_POWER_SNAPSHOT_H
+#define __INCLUDE_NUTTX_POWER_SNAPSHOT_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+#include <nuttx/compiler.h>
+#include <nuttx/mtd/mtd.h>
+
+#include <sys/types.h>
+
+#ifdef CONFIG_SNAPSHOT
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Distinguishes the two returns of snapshot_save():  OK means the image
+ * was written and the caller may power down; SNAPSHOT_RESUMED means the
+ * call is returning a second time because snapshot_restore() resumed a
+ * saved image, and the caller must now re-initialize its hardware.
+ */
+
+#define SNAPSHOT_RESUMED  1
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* One contiguous RAM range included in the snapshot image.  The board's
+ * table normally covers the kernel .data/.bss and the kernel heap.  The
+ * stack that snapshot_restore() runs on, and the work buffer it is given,
+ * must NOT lie inside any region.
+ */
+
+struct snapshot_region_s
+{
+  FAR void *start;              /* Start of the region */
+  size_t    size;               /* Size of the region in bytes */
+};
+
+/* Interface for drivers that must participate in save/resume.  The save
+ * callback runs just before the image is written (e.g. park hardware);
+ * the restore callback runs first thing on the resume path, before
+ * snapshot_save() returns SNAPSHOT_RESUMED to the board logic.
+ */
+
+struct snapshot_client_s
+{
+  FAR struct snapshot_client_s *flink;    /* Used internally */
+  CODE void (*save)(FAR struct snapshot_client_s *client);
+  CODE void (*restore)(FAR struct snapshot_client_s *client);
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#ifdef __cplusplus
+#define EXTERN extern "C"
+extern "C"
+{
+#else
+#define EXTERN extern
+#endif
+
+/****************************************************************************
+ * Name: snapshot_register
+ *
+ * Description:
+ *   Register a driver with the snapshot framework.  The client structure
+ *   must persist; it is linked, not copied.
+ *
+ ****************************************************************************/
+
+void snapshot_register(FAR struct snapshot_client_s *client);
+
+/****************************************************************************
+ * Name: snapshot_save
+ *
+ * Description:
+ *   Write a resumable image of the given RAM regions to the MTD device,
+ *   starting at block 0.  The continuation point is captured with setjmp
+ *   so that a later snapshot_restore() resumes execution as a second
+ *   return from this function.  The stack of the calling task MUST lie
+ *   inside one of the regions:  The resume path re-enters this
+ *   function's stack frame, which only exists again because the image
+ *   restored it.  The caller must have quiesced the system (no DMA in
+ *   flight, other CPUs parked); interrupts are disabled internally for
+ *   the capture.
+ *
+ * Returned Value:
+ *   OK               - Image written; the caller may now power down.
+ *   SNAPSHOT_RESUMED - Returning from snapshot_restore(); RAM state has
+ *                      been rebuilt and client restore callbacks have
+ *                      run.  The caller must re-initialize hardware not
+ *                      covered by a client.
+ *   Negative errno   - The image could not be written; RAM is unchanged.
+ *
+ ****************************************************************************/
+
+int snapshot_save(FAR struct mtd_dev_s *mtd,
+                  FAR const struct snapshot_region_s *regions,
+                  size_t nregions);
+
+/****************************************************************************
+ * Name: snapshot_restore
+ *
+ * Description:
+ *   Validate the image on the MTD device and, if it is intact, copy the
+ *   saved regions back to RAM and resume execution at the continuation
+ *   captured by snapshot_save().  Call early in boot, after the MTD
+ *   device is usable but before anything depends on RAM contents, on a
+ *   stack outside every saved region.  The work buffer must also lie
+ *   outside every saved region and hold at least one MTD block.
+ *
+ *   The image is CRC-checked in full before RAM is touched, so a failure
+ *   return leaves RAM intact and the caller simply continues a cold boot.
+ *
+ * Returned Value:
+ *   Does not return on success.  -ENOENT if no valid image is present;
+ *   other negated errno values on MTD access failures.
+ *
+ ****************************************************************************/
+
+int snapshot_restore(FAR struct mtd_dev_s *mtd, FAR void *workbuf,
+                     size_t buflen);
+
+/****************************************************************************
+ * Name: snapshot_invalidate
+ *
+ * Description:
+ *   Erase the image header so that the next boot is a cold boot.  Boards
+ *   that must not resume the same image twice (one-shot resume) call this
+ *   from the resumed path.
+ *
+ ****************************************************************************/
+
+int snapshot_invalidate(FAR struct mtd_dev_s *mtd);
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONFIG_SNAPSHOT */
+#endif /* __INCLUDE_NUTTX_POWER_SNAPSHOT_H */
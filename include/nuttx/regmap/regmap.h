@@ -41,6 +41,22 @@
 
 struct regmap_bus_s;
 
+#ifdef CONFIG_REGMAP_CACHE
+/* Register value cache modes.  With REGMAP_CACHE_FLAT a value table
+ * covering all registers up to max_register is allocated up front, which
+ * is the fastest choice for small dense register files.  With
+ * REGMAP_CACHE_SPARSE a sorted array of touched registers is grown on
+ * demand, which suits devices with a large, sparsely used address range.
+ */
+
+enum regmap_cache_mode_e
+{
+  REGMAP_CACHE_NONE = 0,
+  REGMAP_CACHE_FLAT,
+  REGMAP_CACHE_SPARSE
+};
+#endif
+
 /* Single byte register read/write. */
 
 typedef CODE int (*reg_read_t)(FAR struct regmap_bus_s *bus,
@@ -100,6 +116,23 @@ struct regmap_config_s
    */
 
   bool disable_locking;
+
+#ifdef CONFIG_REGMAP_CACHE
+  /* Register value cache mode, see enum regmap_cache_mode_e. With the
+   * cache enabled regmap_read() is served from RAM once a register value
+   * is known and regmap_write() only updates the cache; the dirty values
+   * are written back by regmap_cache_flush().
+   */
+
+  int cache_mode;
+
+  /* Highest register address covered by the cache, mandatory when
+   * cache_mode is not REGMAP_CACHE_NONE.  Accesses above this address
+   * always go straight to the bus.
+   */
+
+  unsigned int max_register;
+#endif
 };
 
 struct regmap_s;
@@ -312,6 +345,50 @@ int regmap_read(FAR struct regmap_s *map, unsigned int reg,
 int regmap_bulk_read(FAR struct regmap_s *map, unsigned int reg,
                      FAR void *val, unsigned int val_count);
 
+#ifdef CONFIG_REGMAP_CACHE
+/****************************************************************************
+ * Name: regmap_cache_flush
+ *
+ * Description:
+ *   Write all dirty cached register values back to the device.  Runs of
+ *   consecutive dirty registers are coalesced into one bulk transaction
+ *   where the bus supports it.
+ *
+ * Input Parameters:
+ *   map - regmap handler, from regmap bus init function return.
+ *
+ * Returned Value:
+ *   Zero on success; a negated errno value from the first failed bus
+ *   access otherwise.  Values that could not be written stay dirty.
+ *
+ * Assumptions/Limitations:
+ *   None.
+ *
+ ****************************************************************************/
+
+int regmap_cache_flush(FAR struct regmap_s *map);
+
+/****************************************************************************
+ * Name: regmap_cache_drop
+ *
+ * Description:
+ *   Discard all cached register values, including dirty ones.  Following
+ *   reads go to the device again.
+ *
+ * Input Parameters:
+ *   map - regmap handler, from regmap bus init function return.
+ *
+ * Returned Value:
+ *   Zero is always returned.
+ *
+ * Assumptions/Limitations:
+ *   None.
+ *
+ ****************************************************************************/
+
+int regmap_cache_drop(FAR struct regmap_s *map);
+#endif /* CONFIG_REGMAP_CACHE */
+
 #undef EXTERN
 #if defined(__cplusplus)
 }
@@ -0,0 +1,135 @@
+/****************************************************************************
+ * include/nuttx/rpmsg/rpmsg_bulk.h
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_NUTTX_RPMSG_RPMSG_BULK_H
+#define __INCLUDE_NUTTX_RPMSG_RPMSG_BULK_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#ifdef CONFIG_RPMSG_BULK
+
+#include <sys/types.h>
+#include <stdint.h>
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+struct rpmsg_bulk_s;
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#ifdef __cplusplus
+#define EXTERN extern "C"
+extern "C"
+{
+#else
+#define EXTERN extern
+#endif
+
+/****************************************************************************
+ * Name: rpmsg_bulk_register
+ *
+ * Description:
+ *   Attach to a bulk shared-memory pool used to pass large payloads
+ *   between two cpus without copying them through the rpmsg buffers.
+ *   Both sides must register the same pool (same name and the same
+ *   shared-memory region, each given in its local address space).
+ *
+ *   The owner side allocates payload buffers from the pool with
+ *   rpmsg_bulk_alloc() and passes their pool offset to the peer in its
+ *   own (small) rpmsg messages.  The peer converts the offset back to an
+ *   address with rpmsg_bulk_getaddress() and, when the payload has been
+ *   consumed, returns the buffer with rpmsg_bulk_free() which sends a
+ *   reclaim message back to the owner.
+ *
+ * Input Parameters:
+ *   cpuname - The remote cpu sharing the pool
+ *   name    - The name of the pool
+ *   base    - The local address of the shared-memory region
+ *   size    - The size of the shared-memory region
+ *   owner   - True if this side allocates from the pool
+ *
+ * Returned Value:
+ *   The pool handle on success; NULL on any failure.
+ *
+ ****************************************************************************/
+
+FAR struct rpmsg_bulk_s *rpmsg_bulk_register(FAR const char *cpuname,
+                                             FAR const char *name,
+                                             FAR void *base, size_t size,
+                                             bool owner);
+
+/****************************************************************************
+ * Name: rpmsg_bulk_alloc
+ *
+ * Description:
+ *   Allocate a payload buffer from the pool.  Only the owner side of the
+ *   pool may allocate.
+ *
+ * Returned Value:
+ *   The buffer address on success; NULL if the pool is exhausted.
+ *
+ ****************************************************************************/
+
+FAR void *rpmsg_bulk_alloc(FAR struct rpmsg_bulk_s *bulk, size_t size);
+
+/****************************************************************************
+ * Name: rpmsg_bulk_free
+ *
+ * Description:
+ *   Return a payload buffer to the pool.  On the owner side the buffer
+ *   is freed directly; on the peer side a reclaim message is sent to the
+ *   owner.
+ *
+ ****************************************************************************/
+
+void rpmsg_bulk_free(FAR struct rpmsg_bulk_s *bulk, FAR void *mem);
+
+/****************************************************************************
+ * Name: rpmsg_bulk_getoffset/rpmsg_bulk_getaddress
+ *
+ * Description:
+ *   Convert between a payload buffer address and its pool offset.  The
+ *   offset is what travels in the rpmsg message since the two sides may
+ *   map the pool at different addresses.
+ *
+ ****************************************************************************/
+
+uint32_t rpmsg_bulk_getoffset(FAR struct rpmsg_bulk_s *bulk,
+                              FAR const void *mem);
+FAR void *rpmsg_bulk_getaddress(FAR struct rpmsg_bulk_s *bulk,
+                                uint32_t offset);
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONFIG_RPMSG_BULK */
+#endif /* __INCLUDE_NUTTX_RPMSG_RPMSG_BULK_H */
@@ -107,6 +107,14 @@
 #define IDLE_PROCESS_ID            (pid_t)0
 #define INVALID_PROCESS_ID         (pid_t)-1
 
+/* Number of log2 bins in the per-task wakeup latency histogram.  The last
+ * bin collects everything at or above 2^(WAKEHIST_NBINS-2) perf ticks.
+ */
+
+#ifdef CONFIG_SCHED_WAKEUPMONITOR
+#  define WAKEHIST_NBINS           16
+#endif
+
 /* This is the maximum number of times that a lock can be set */
 
 #define MAX_LOCK_COUNT             127
@@ -383,6 +391,10 @@ struct sporadic_s
 struct child_status_s
 {
   FAR struct child_status_s *flink;
+#ifdef CONFIG_SCHED_CHILD_STATUS_HASH
+  FAR struct child_status_s *blink; /* Previous child in the sibling list      */
+  FAR struct child_status_s *hlink; /* Next child in the same hash bucket      */
+#endif
 
   uint8_t ch_flags;                 /* Child status:  See CHILD_FLAG_* defines */
   pid_t   ch_pid;                   /* Child task ID                           */
@@ -473,6 +485,11 @@ struct binary_s;                    /* Forward reference
                                     /* Defined in include/nuttx/binfmt/binfmt.h */
 #endif
 
+#ifdef CONFIG_MQ_DIRECT_HANDOFF
+struct mqueue_rcvbuf_s;             /* Forward reference                        */
+                                    /* Defined in sched/mqueue/mqueue.h         */
+#endif
+
 struct task_group_s
 {
   pid_t tg_pid;                     /* The ID of the task within the group      */
@@ -505,6 +522,12 @@ struct task_group_s
 
 #ifdef CONFIG_SCHED_CHILD_STATUS
   FAR struct child_status_s *tg_children; /* Head of a list of child status     */
+#ifdef CONFIG_SCHED_CHILD_STATUS_HASH
+  /* Child status structures indexed by PID for O(1) lookup and removal */
+
+  FAR struct child_status_s *
+    tg_chashtbl[CONFIG_SCHED_CHILD_STATUS_HASH_BUCKETS];
+#endif
 #else
   uint16_t tg_nchildren;                  /* This is the number active children */
 #endif
@@ -552,6 +575,9 @@ struct task_group_s
   FAR char **tg_envp;               /* Allocated environment strings        */
   ssize_t    tg_envpc;              /* Maximum entries of environment array */
   ssize_t    tg_envc;               /* Number of environment strings        */
+#ifdef CONFIG_SCHED_ENVIRON_COW
+  FAR uint16_t *tg_envref;          /* Sharers of the environment, or NULL  */
+#endif
 #endif
 
 #ifndef CONFIG_DISABLE_POSIX_TIMERS
@@ -675,6 +701,9 @@ struct tcb_s
   /* POSIX Semaphore and Message Queue Control Fields ***********************/
 
   FAR void *waitobj;                     /* Object thread waiting on        */
+#ifdef CONFIG_MQ_DIRECT_HANDOFF
+  FAR struct mqueue_rcvbuf_s *rcvbuf;    /* Buffer for direct mq handoff    */
+#endif
 
   /* POSIX Signal Control Fields ********************************************/
 
@@ -743,6 +772,17 @@ struct tcb_s
   size_t level_deepest;
   size_t level;
 #endif
+
+#ifdef CONFIG_SCHED_STACKMONITOR
+  uint32_t stackmon_color;               /* Color word sampled at first check */
+  size_t stackmon_free;                  /* Colored words above the watermark */
+  size_t stackmon_used;                  /* Cached peak stack usage in bytes */
+#endif
+
+#ifdef CONFIG_SCHED_WAKEUPMONITOR
+  clock_t wake_start;                    /* Time the task was last woken */
+  uint32_t wake_hist[WAKEHIST_NBINS];    /* log2 wake-to-run latency bins */
+#endif
 };
 
 /* struct task_tcb_s ********************************************************/
@@ -858,14 +898,28 @@ extern "C"
 #define EXTERN extern
 #endif
 
-/* Maximum time with pre-emption disabled or within critical section. */
+/* Maximum time with pre-emption disabled or within critical section and
+ * the identity of the holder that set each maximum.
+ */
 
 #if CONFIG_SCHED_CRITMONITOR_MAXTIME_PREEMPTION >= 0
 EXTERN clock_t g_premp_max[CONFIG_SMP_NCPUS];
+EXTERN FAR void *g_premp_max_caller[CONFIG_SMP_NCPUS];
+EXTERN pid_t g_premp_max_pid[CONFIG_SMP_NCPUS];
+#if CONFIG_SCHED_CRITMONITOR_BACKTRACE > 0
+EXTERN FAR void *g_premp_max_backtrace[CONFIG_SMP_NCPUS]
+                                      [CONFIG_SCHED_CRITMONITOR_BACKTRACE];
+#endif
 #endif /* CONFIG_SCHED_CRITMONITOR_MAXTIME_PREEMPTION  >= 0 */
 
 #if CONFIG_SCHED_CRITMONITOR_MAXTIME_CSECTION >= 0
 EXTERN clock_t g_crit_max[CONFIG_SMP_NCPUS];
+EXTERN FAR void *g_crit_max_caller[CONFIG_SMP_NCPUS];
+EXTERN pid_t g_crit_max_pid[CONFIG_SMP_NCPUS];
+#if CONFIG_SCHED_CRITMONITOR_BACKTRACE > 0
+EXTERN FAR void *g_crit_max_backtrace[CONFIG_SMP_NCPUS]
+                                     [CONFIG_SCHED_CRITMONITOR_BACKTRACE];
+#endif
 #endif /* CONFIG_SCHED_CRITMONITOR_MAXTIME_CSECTION >= 0 */
 
 EXTERN const struct tcbinfo_s g_tcbinfo;
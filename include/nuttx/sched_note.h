@@ -272,6 +272,7 @@ enum note_type_e
   NOTE_DUMP_END,
   NOTE_DUMP_MARK,
   NOTE_DUMP_COUNTER,
+  NOTE_WAKEUP,
 
   /* Always last */
 
@@ -355,6 +356,16 @@ struct note_resume_s
   struct note_common_s nre_cmn; /* Common note parameters */
 };
 
+/* This is the specific form of the NOTE_WAKEUP note */
+
+struct note_wakeup_s
+{
+  struct note_common_s nwk_cmn; /* Common note parameters (woken thread) */
+  pid_t nwk_waker;              /* Thread that triggered the wakeup, or
+                                 * INVALID_PROCESS_ID when woken from an
+                                 * interrupt handler */
+};
+
 /* This is the specific form of the NOTE_CPU_START note */
 
 struct note_cpu_start_s
@@ -581,9 +592,11 @@ void sched_note_stop(FAR struct tcb_s *tcb);
 #ifdef CONFIG_SCHED_INSTRUMENTATION_SWITCH
 void sched_note_suspend(FAR struct tcb_s *tcb);
 void sched_note_resume(FAR struct tcb_s *tcb);
+void sched_note_wakeup(FAR struct tcb_s *tcb);
 #else
 #  define sched_note_suspend(t)
 #  define sched_note_resume(t)
+#  define sched_note_wakeup(t)
 #endif
 
 #if defined(CONFIG_SMP) && defined(CONFIG_SCHED_INSTRUMENTATION)
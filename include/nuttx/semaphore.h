@@ -728,5 +728,10 @@ int nxsem_setprioceiling(FAR sem_t *sem, int prioceiling,
 }
 #endif
 
+#ifdef CONFIG_SYS_INLINE_PROXIES
+#  define __SYSCALL_INLINE_SEMAPHORE_H 1
+#  include <nuttx/syscall_inline.h>
+#endif
+
 #endif /* __ASSEMBLY__ */
 #endif /* __INCLUDE_NUTTX_SEMAPHORE_H */
@@ -0,0 +1,188 @@
+/****************************************************************************
+ * include/nuttx/seqlock.h
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_NUTTX_SEQLOCK_H
+#define __INCLUDE_NUTTX_SEQLOCK_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdbool.h>
+
+#include <nuttx/atomic.h>
+#include <nuttx/compiler.h>
+#include <nuttx/spinlock.h>
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* A sequence counter provides lock-free reads of data that is too wide to
+ * be loaded atomically, such as 64-bit tick or timestamp counters on
+ * 32-bit targets.  The writer increments the sequence to an odd value
+ * before updating the data and to the next even value afterwards; a
+ * reader retries whenever it observed an odd sequence or the sequence
+ * changed while it was reading.
+ *
+ * Writers are NOT serialized against each other by the sequence counter;
+ * the caller must hold a critical section or a spinlock around the write
+ * side.  Readers never block and never spin on the data itself, so the
+ * read side may be used from interrupt handlers and does not poison
+ * otherwise lock-free structures:
+ *
+ *   do
+ *     {
+ *       seq   = seqcount_read_begin(&counter->seq);
+ *       value = counter->value64;
+ *     }
+ *   while (seqcount_read_retry(&counter->seq, seq));
+ */
+
+typedef struct seqcount_s
+{
+  unsigned int sequence;
+} seqcount_t;
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Initializer for a statically allocated sequence counter */
+
+#define SEQCOUNT_INITIALIZER {0}
+
+/* Initializer for a sequence counter allocated at run time */
+
+#define seqcount_init(s) do { (s)->sequence = 0; } while (0)
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: seqcount_read_begin
+ *
+ * Description:
+ *   Begin a read-side critical section.  Waits for any write in progress
+ *   to complete, then returns the even sequence value to be passed to
+ *   seqcount_read_retry() after the protected data has been read.
+ *
+ * Input Parameters:
+ *   s - The sequence counter protecting the data
+ *
+ * Returned Value:
+ *   The sequence value observed at the start of the read.
+ *
+ ****************************************************************************/
+
+static inline_function unsigned int
+seqcount_read_begin(FAR const seqcount_t *s)
+{
+  unsigned int seq;
+
+  while (((seq = atomic_load_explicit((FAR atomic_uint *)&s->sequence,
+                                      memory_order_acquire)) & 1) != 0)
+    {
+      /* A write is in progress */
+
+      SP_DSB();
+    }
+
+  return seq;
+}
+
+/****************************************************************************
+ * Name: seqcount_read_retry
+ *
+ * Description:
+ *   End a read-side critical section.  Returns true if a write overlapped
+ *   the read and the read must be retried from seqcount_read_begin().
+ *
+ * Input Parameters:
+ *   s   - The sequence counter protecting the data
+ *   seq - The sequence value returned by seqcount_read_begin()
+ *
+ * Returned Value:
+ *   true if the protected data may be torn and must be re-read.
+ *
+ ****************************************************************************/
+
+static inline_function bool
+seqcount_read_retry(FAR const seqcount_t *s, unsigned int seq)
+{
+  /* Make sure that the data reads complete before the sequence re-read */
+
+  SP_DSB();
+  return atomic_load_explicit((FAR atomic_uint *)&s->sequence,
+                              memory_order_acquire) != seq;
+}
+
+/****************************************************************************
+ * Name: seqcount_write_begin
+ *
+ * Description:
+ *   Begin a write-side critical section.  The caller must already hold
+ *   the lock (or critical section) that serializes the writers.
+ *
+ * Input Parameters:
+ *   s - The sequence counter protecting the data
+ *
+ * Returned Value:
+ *   None.
+ *
+ ****************************************************************************/
+
+static inline_function void seqcount_write_begin(FAR seqcount_t *s)
+{
+  atomic_store_explicit((FAR atomic_uint *)&s->sequence,
+                        s->sequence + 1, memory_order_relaxed);
+
+  /* Make the odd sequence visible before any update of the data */
+
+  SP_DMB();
+}
+
+/****************************************************************************
+ * Name: seqcount_write_end
+ *
+ * Description:
+ *   End a write-side critical section, making the updated data visible
+ *   to the readers.
+ *
+ * Input Parameters:
+ *   s - The sequence counter protecting the data
+ *
+ * Returned Value:
+ *   None.
+ *
+ ****************************************************************************/
+
+static inline_function void seqcount_write_end(FAR seqcount_t *s)
+{
+  atomic_store_explicit((FAR atomic_uint *)&s->sequence,
+                        s->sequence + 1, memory_order_release);
+}
+
+#endif /* __INCLUDE_NUTTX_SEQLOCK_H */
@@ -37,6 +37,7 @@
 
 #include <nuttx/fs/fs.h>
 #include <nuttx/semaphore.h>
+#include <nuttx/wdog.h>
 
 /****************************************************************************
  * Pre-processor Definitions
@@ -109,6 +110,9 @@
 
 #define uart_dmarxfree(dev)    \
   ((dev)->ops->dmarxfree ? (dev)->ops->dmarxfree(dev) : -ENOSYS)
+
+#define uart_dmarxpoll(dev)    \
+  ((dev)->ops->dmarxpoll ? (dev)->ops->dmarxpoll(dev) : -ENOSYS)
 #endif
 
 #ifdef CONFIG_SERIAL_IFLOWCONTROL
@@ -232,6 +236,15 @@ struct uart_ops_s
   /* Notify DMA that there is free space in the RX buffer */
 
   CODE void (*dmarxfree)(FAR struct uart_dev_s *dev);
+
+  /* Flush bytes held in a partially filled RX DMA buffer.  This optional
+   * method is called periodically by the upper half when
+   * CONFIG_SERIAL_RXDMA_TIMEOUT is non-zero so that slowly arriving data
+   * reaches readers with bounded latency even if the hardware has no idle
+   * line detection.
+   */
+
+  CODE void (*dmarxpoll)(FAR struct uart_dev_s *dev);
 #endif
 
 #ifdef CONFIG_SERIAL_TXDMA
@@ -338,6 +351,9 @@ struct uart_dev_s
 #endif
 #ifdef CONFIG_SERIAL_RXDMA
   struct uart_dmaxfer_s dmarx;       /* Describes receive DMA transfer */
+#if CONFIG_SERIAL_RXDMA_TIMEOUT > 0
+  struct wdog_s rxdmatimer;          /* Flushes partial RX DMA buffers */
+#endif
 #endif
 
   /* Driver interface */
@@ -36,6 +36,10 @@
 #include <nuttx/fs/ioctl.h>
 #include <nuttx/spi/spi.h>
 
+#ifdef CONFIG_SPI_SCHED
+#  include <nuttx/queue.h>
+#endif
+
 #ifdef CONFIG_SPI_EXCHANGE
 
 /* SPI Character Driver IOCTL Commands **************************************/
@@ -114,6 +118,30 @@ struct spi_sequence_s
   FAR struct spi_trans_s *trans;
 };
 
+#ifdef CONFIG_SPI_SCHED
+/* One sequence queued to the SPI bus scheduler.  The structure, the
+ * sequence and all buffers it refers to are provided by the caller and
+ * must remain valid until the completion callback has been invoked.
+ */
+
+struct spi_sched_s;            /* Opaque scheduler state */
+struct spi_sched_req_s
+{
+  sq_entry_t node;             /* Supports a singly linked list.  Must be
+                                * the first field in the structure. */
+  FAR struct spi_sequence_s *seq; /* The sequence to perform */
+  uint8_t priority;            /* Higher values are served first */
+
+  /* Invoked from the low priority work queue when the sequence has
+   * completed.  The result of spi_transfer() is in req->result.
+   */
+
+  CODE void (*callback)(FAR struct spi_sched_req_s *req);
+  FAR void *arg;               /* Available for use by the client */
+  int result;                  /* Result of the transfer */
+};
+#endif
+
 /****************************************************************************
  * Public Functions Definitions
  ****************************************************************************/
@@ -163,6 +191,89 @@ int spi_transfer(FAR struct spi_dev_s *spi, FAR struct spi_sequence_s *seq);
 int spi_register(FAR struct spi_dev_s *spi, int bus);
 #endif
 
+/****************************************************************************
+ * Name: spi_sched_initialize
+ *
+ * Description:
+ *   Create a transaction scheduler on top of an SPI bus.  Sequences
+ *   queued with spi_sched_submit() are performed on the low priority work
+ *   queue in priority order, FIFO among requests of equal priority, using
+ *   spi_transfer().
+ *
+ * Input Parameters:
+ *   spi - An instance of the lower half SPI driver
+ *
+ * Returned Value:
+ *   A reference to the scheduler on success; NULL on allocation failure.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SPI_SCHED
+FAR struct spi_sched_s *spi_sched_initialize(FAR struct spi_dev_s *spi);
+
+/****************************************************************************
+ * Name: spi_sched_uninitialize
+ *
+ * Description:
+ *   Destroy a transaction scheduler.  The scheduler must be idle:  All
+ *   queued requests must have completed (or been cancelled) before this
+ *   function is called.
+ *
+ * Input Parameters:
+ *   sched - The scheduler to destroy
+ *
+ ****************************************************************************/
+
+void spi_sched_uninitialize(FAR struct spi_sched_s *sched);
+
+/****************************************************************************
+ * Name: spi_sched_submit
+ *
+ * Description:
+ *   Queue a sequence of SPI transfers for asynchronous completion.  The
+ *   function returns immediately; when the sequence has been performed,
+ *   req->result holds the result of spi_transfer() and the completion
+ *   callback of the request is invoked from the low priority work queue.
+ *
+ *   Requests are served in priority order (higher values first) and in
+ *   FIFO order among requests of equal priority.  A running sequence is
+ *   never interrupted; priority takes effect at sequence boundaries.
+ *
+ * Input Parameters:
+ *   sched - The scheduler
+ *   req   - The request to queue
+ *
+ * Returned Value:
+ *   Zero (OK) if the request was queued; a negated errno value on failure.
+ *   Failure to queue does not invoke the callback.
+ *
+ ****************************************************************************/
+
+int spi_sched_submit(FAR struct spi_sched_s *sched,
+                     FAR struct spi_sched_req_s *req);
+
+/****************************************************************************
+ * Name: spi_sched_cancel
+ *
+ * Description:
+ *   Remove a request from the scheduler before it has been started.  The
+ *   completion callback of a cancelled request is not invoked.
+ *
+ * Input Parameters:
+ *   sched - The scheduler
+ *   req   - The request to cancel
+ *
+ * Returned Value:
+ *   Zero (OK) if the request was still queued and has been removed;
+ *   -ENOENT if the request is not in the queue (it may have completed
+ *   already or be in progress on the bus).
+ *
+ ****************************************************************************/
+
+int spi_sched_cancel(FAR struct spi_sched_s *sched,
+                     FAR struct spi_sched_req_s *req);
+#endif /* CONFIG_SPI_SCHED */
+
 #undef EXTERN
 #if defined(__cplusplus)
 #define EXTERN extern "C"
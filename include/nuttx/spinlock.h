@@ -37,7 +37,12 @@
 #include <nuttx/irq.h>
 #include <nuttx/arch.h>
 
-#if defined(CONFIG_TICKET_SPINLOCK) || defined(CONFIG_RW_SPINLOCK)
+#ifdef CONFIG_SCHED_LOCKMONITOR
+#  include <nuttx/clock.h>
+#endif
+
+#if defined(CONFIG_TICKET_SPINLOCK) || defined(CONFIG_RW_SPINLOCK) || \
+    defined(CONFIG_MCS_SPINLOCK)
 #  include <nuttx/atomic.h>
 #endif
 
@@ -94,6 +99,38 @@ typedef union spinlock_u spinlock_t;
 
 #endif /* CONFIG_SPINLOCK */
 
+#ifdef CONFIG_MCS_SPINLOCK
+/* Queued (MCS) spinlock.  Each waiter enqueues its own node and spins on
+ * a flag inside that node, so the waiters do not ping-pong the cache line
+ * holding the lock word and the lock is granted in strict FIFO order.
+ * Unlike spinlock_t the caller must provide the queue node and pass the
+ * same node to the matching release; the node must stay valid (e.g. on
+ * the stack of the spinning context or in per-CPU storage) until the
+ * lock is released.
+ */
+
+struct mcs_node_s
+{
+  unsigned long next;          /* Successor node, zero if none */
+  unsigned long locked;        /* Nonzero while waiting for the handoff */
+};
+
+struct mcs_lock_s
+{
+  unsigned long tail;          /* Last node of the wait queue, zero if
+                                * the lock is free */
+};
+
+#define MCS_LOCK_INITIALIZER   {0}
+
+/* void mcs_lock_init(FAR struct mcs_lock_s *lock); */
+#define mcs_lock_init(l) do { (l)->tail = 0; } while (0)
+
+/* bool mcs_lock_is_locked(FAR struct mcs_lock_s *lock); */
+#define mcs_lock_is_locked(l) \
+  (atomic_load((FAR atomic_ulong *)&(l)->tail) != 0)
+#endif /* CONFIG_MCS_SPINLOCK */
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
@@ -144,6 +181,11 @@ void sched_note_spinlock_unlock(FAR volatile spinlock_t *spinlock);
 #  define sched_note_spinlock_unlock(spinlock)
 #endif
 
+#ifdef CONFIG_SCHED_LOCKMONITOR
+void nxsched_lockmon_record(FAR void *caller, bool contended,
+                            clock_t waitticks);
+#endif
+
 /****************************************************************************
  * Public Data Types
  ****************************************************************************/
@@ -282,15 +324,37 @@ static inline_function void spin_lock_wo_note(FAR volatile spinlock_t *lock)
  ****************************************************************************/
 
 #ifdef CONFIG_SPINLOCK
+#ifdef CONFIG_SCHED_LOCKMONITOR
+static inline_function bool
+spin_trylock_wo_note(FAR volatile spinlock_t *lock);
+#endif
+
 static inline_function void spin_lock(FAR volatile spinlock_t *lock)
 {
   /* Notify that we are waiting for a spinlock */
 
   sched_note_spinlock_lock(lock);
 
+#ifdef CONFIG_SCHED_LOCKMONITOR
+  /* Try once so that the uncontended acquisition costs no timer reads */
+
+  if (spin_trylock_wo_note(lock))
+    {
+      nxsched_lockmon_record(return_address(0), false, 0);
+    }
+  else
+    {
+      clock_t start = perf_gettime();
+
+      spin_lock_wo_note(lock);
+      nxsched_lockmon_record(return_address(0), true,
+                             perf_gettime() - start);
+    }
+#else
   /* Lock without trace note */
 
   spin_lock_wo_note(lock);
+#endif
 
   /* Notify that we have the spinlock */
 
@@ -474,6 +538,118 @@ static inline_function void spin_unlock(FAR volatile spinlock_t *lock)
 #  endif
 #endif /* CONFIG_SPINLOCK */
 
+/****************************************************************************
+ * Name: mcs_lock_acquire
+ *
+ * Description:
+ *   Acquire a queued (MCS) spinlock, spinning until the lock is granted.
+ *   Each waiter appends its own node to the queue and then spins on the
+ *   flag inside that node, so the lock word is touched exactly once per
+ *   acquisition and contending CPUs do not invalidate each other's cache
+ *   lines while they wait.  The lock is granted in strict FIFO order.
+ *
+ * Input Parameters:
+ *   lock - A reference to the MCS lock object to lock.
+ *   node - The caller's queue node.  It must remain valid and must not be
+ *          reused until the matching mcs_lock_release() returns.
+ *
+ * Returned Value:
+ *   None.  When the function returns, the caller holds the lock.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_MCS_SPINLOCK
+static inline_function void
+mcs_lock_acquire(FAR struct mcs_lock_s *lock, FAR struct mcs_node_s *node)
+{
+  unsigned long prev;
+
+  node->next   = 0;
+  node->locked = 1;
+
+  /* Swap ourself in as the new tail of the wait queue */
+
+  prev = atomic_exchange((FAR atomic_ulong *)&lock->tail,
+                         (unsigned long)(uintptr_t)node);
+  if (prev != 0)
+    {
+      /* Link behind the previous tail and wait for its handoff */
+
+      atomic_store((FAR atomic_ulong *)&((FAR struct mcs_node_s *)
+                   (uintptr_t)prev)->next, (unsigned long)(uintptr_t)node);
+
+      while (atomic_load((FAR atomic_ulong *)&node->locked) != 0)
+        {
+          SP_DSB();
+          SP_WFE();
+        }
+    }
+
+  SP_DMB();
+}
+#endif /* CONFIG_MCS_SPINLOCK */
+
+/****************************************************************************
+ * Name: mcs_lock_release
+ *
+ * Description:
+ *   Release a queued (MCS) spinlock and hand it to the next waiter, if
+ *   any.  The handoff writes only into the successor's own node, so the
+ *   release does not disturb the other waiters.
+ *
+ * Input Parameters:
+ *   lock - A reference to the MCS lock object to unlock.
+ *   node - The queue node that was passed to the matching
+ *          mcs_lock_acquire().
+ *
+ * Returned Value:
+ *   None.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_MCS_SPINLOCK
+static inline_function void
+mcs_lock_release(FAR struct mcs_lock_s *lock, FAR struct mcs_node_s *node)
+{
+  unsigned long next;
+  unsigned long expect = (unsigned long)(uintptr_t)node;
+
+  SP_DMB();
+
+  next = atomic_load((FAR atomic_ulong *)&node->next);
+  if (next == 0)
+    {
+      /* No visible successor.  If we are still the tail, the queue is
+       * empty and the lock becomes free.
+       */
+
+      if (atomic_compare_exchange_strong((FAR atomic_ulong *)&lock->tail,
+                                         &expect, 0))
+        {
+          SP_DSB();
+          SP_SEV();
+          return;
+        }
+
+      /* A new waiter swapped the tail but has not linked yet; wait for
+       * the link to appear.
+       */
+
+      while ((next = atomic_load((FAR atomic_ulong *)&node->next)) == 0)
+        {
+          SP_DSB();
+        }
+    }
+
+  /* Hand the lock to the successor */
+
+  atomic_store((FAR atomic_ulong *)&((FAR struct mcs_node_s *)
+               (uintptr_t)next)->locked, 0);
+  SP_DSB();
+  SP_SEV();
+}
+#endif /* CONFIG_MCS_SPINLOCK */
+
 /****************************************************************************
  * Name: spin_is_locked
  *
@@ -595,9 +771,38 @@ irqstate_t spin_lock_irqsave(FAR volatile spinlock_t *lock)
 
   sched_note_spinlock_lock(lock);
 
+#ifdef CONFIG_SCHED_LOCKMONITOR
+  /* The NULL (g_irq_spin) form may be nested and so cannot be timed with
+   * a simple try-then-spin; it is counted as an acquisition only.
+   */
+
+  if (lock != NULL)
+    {
+      flags = up_irq_save();
+
+      if (spin_trylock_wo_note(lock))
+        {
+          nxsched_lockmon_record(return_address(0), false, 0);
+        }
+      else
+        {
+          clock_t start = perf_gettime();
+
+          spin_lock_wo_note(lock);
+          nxsched_lockmon_record(return_address(0), true,
+                                 perf_gettime() - start);
+        }
+    }
+  else
+    {
+      flags = spin_lock_irqsave_wo_note(lock);
+      nxsched_lockmon_record(return_address(0), false, 0);
+    }
+#else
   /* Lock without trace note */
 
   flags = spin_lock_irqsave_wo_note(lock);
+#endif
 
   /* Notify that we have the spinlock */
 
@@ -29,6 +29,8 @@
 
 #include <nuttx/config.h>
 
+#include <stdint.h>
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
@@ -75,9 +77,9 @@ extern "C"
  *
  * Description:
  *   Find the symbol in the symbol table with the matching name.
- *   The implementation will be linear with respect to nsyms if
- *   CONFIG_SYMTAB_ORDEREDBYNAME is not selected, and logarithmic
- *   if it is.
+ *   The implementation will be linear with respect to nsyms unless
+ *   CONFIG_SYMTAB_ORDEREDBYNAME or CONFIG_SYMTAB_ORDEREDBYHASH is
+ *   selected, in which case it is logarithmic.
  *
  * Returned Value:
  *   A reference to the symbol table entry if an entry with the matching
@@ -121,6 +123,35 @@ symtab_findbyvalue(FAR const struct symtab_s *symtab,
 
 void symtab_sortbyname(FAR struct symtab_s *symtab, int nsyms);
 
+/****************************************************************************
+ * Name: symtab_hash
+ *
+ * Description:
+ *   Return the 32-bit hash of a symbol name.  This is the same hash used
+ *   by the GNU dynamic linker (dl_new_hash) and by tools/mksymtab when
+ *   generating hash-ordered symbol tables.
+ *
+ * Returned Value:
+ *   The hash of the symbol name.
+ *
+ ****************************************************************************/
+
+uint32_t symtab_hash(FAR const char *name);
+
+/****************************************************************************
+ * Name: symtab_sortbyhash
+ *
+ * Description:
+ *   Sort the symbol table by the hash of the symbol name as required for
+ *   lookups with CONFIG_SYMTAB_ORDEREDBYHASH.
+ *
+ * Returned Value:
+ *   None.
+ *
+ ****************************************************************************/
+
+void symtab_sortbyhash(FAR struct symtab_s *symtab, int nsyms);
+
 #undef EXTERN
 #if defined(__cplusplus)
 }
@@ -0,0 +1,130 @@
+/****************************************************************************
+ * include/nuttx/syscall_inline.h
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/* Inline trampolines for a few hot system call proxies.  The generated
+ * proxies in libproxies are nothing more than a call into the
+ * architecture's sys_call macro, but reaching them still costs an
+ * out-of-line call (and its argument shuffling) on every system call.  The
+ * definitions below expand the sys_call directly at the call site instead.
+ *
+ * The GNU extern inline semantics guarantee that no out-of-line copy of
+ * these definitions is ever emitted:  Call sites inline the trampoline and
+ * code that takes the address of one of these functions links against the
+ * generated proxy in libproxies, exactly as before.
+ *
+ * This file deliberately has no include guard.  It is included from the
+ * very end of unistd.h, time.h and nuttx/semaphore.h and each of those
+ * headers requests only its own trampolines by defining the matching
+ * __SYSCALL_INLINE_* macro first.  That way each trampoline is defined
+ * exactly once and only after the types it needs are complete, no matter
+ * in which order (or from within which other header) the public headers
+ * are included.
+ *
+ * The trampolines are suppressed when building the generated proxies
+ * themselves (__SYSCALL_PROXY_BUILD__) so that they cannot conflict with
+ * the real out-of-line definitions.
+ */
+
+#if defined(CONFIG_LIB_SYSCALL) && defined(CONFIG_SYS_INLINE_PROXIES) && \
+    !defined(__KERNEL__) && !defined(__SYSCALL_PROXY_BUILD__) && \
+    defined(__GNUC__) && !defined(__cplusplus)
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <sys/types.h>
+#include <sys/syscall.h>
+#include <stdint.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef syscall_inline_function
+#  define syscall_inline_function \
+     extern __inline__ __attribute__((__always_inline__, __gnu_inline__))
+#endif
+
+/****************************************************************************
+ * Inline Functions
+ ****************************************************************************/
+
+#ifdef __SYSCALL_INLINE_UNISTD_H
+
+syscall_inline_function ssize_t read(int fd, FAR void *buf, size_t nbytes)
+{
+  return (ssize_t)sys_call3((unsigned int)SYS_read, (uintptr_t)fd,
+                            (uintptr_t)buf, (uintptr_t)nbytes);
+}
+
+syscall_inline_function ssize_t write(int fd, FAR const void *buf,
+                                      size_t nbytes)
+{
+  return (ssize_t)sys_call3((unsigned int)SYS_write, (uintptr_t)fd,
+                            (uintptr_t)buf, (uintptr_t)nbytes);
+}
+
+#endif /* __SYSCALL_INLINE_UNISTD_H */
+
+#if defined(__SYSCALL_INLINE_TIME_H) && !defined(CONFIG_CLOCK_USERPAGE)
+
+syscall_inline_function int clock_gettime(clockid_t clockid,
+                                          FAR struct timespec *tp)
+{
+  return (int)sys_call2((unsigned int)SYS_clock_gettime,
+                        (uintptr_t)clockid, (uintptr_t)tp);
+}
+
+#endif /* __SYSCALL_INLINE_TIME_H && !CONFIG_CLOCK_USERPAGE */
+
+#ifdef __SYSCALL_INLINE_SEMAPHORE_H
+
+syscall_inline_function int nxsem_wait(FAR sem_t *sem)
+{
+  return (int)sys_call1((unsigned int)SYS_nxsem_wait, (uintptr_t)sem);
+}
+
+syscall_inline_function int nxsem_trywait(FAR sem_t *sem)
+{
+  return (int)sys_call1((unsigned int)SYS_nxsem_trywait, (uintptr_t)sem);
+}
+
+syscall_inline_function int nxsem_timedwait(FAR sem_t *sem,
+                                            FAR const struct timespec
+                                            *abstime)
+{
+  return (int)sys_call2((unsigned int)SYS_nxsem_timedwait, (uintptr_t)sem,
+                        (uintptr_t)abstime);
+}
+
+syscall_inline_function int nxsem_post(FAR sem_t *sem)
+{
+  return (int)sys_call1((unsigned int)SYS_nxsem_post, (uintptr_t)sem);
+}
+
+#endif /* __SYSCALL_INLINE_SEMAPHORE_H */
+#endif /* CONFIG_LIB_SYSCALL && CONFIG_SYS_INLINE_PROXIES && ... */
+
+#undef __SYSCALL_INLINE_UNISTD_H
+#undef __SYSCALL_INLINE_TIME_H
+#undef __SYSCALL_INLINE_SEMAPHORE_H
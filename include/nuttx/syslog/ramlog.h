@@ -43,6 +43,8 @@
 #include <nuttx/config.h>
 #include <nuttx/syslog/syslog.h>
 
+#include <stdarg.h>
+
 #ifdef CONFIG_RAMLOG
 
 /****************************************************************************
@@ -150,6 +152,23 @@ ssize_t ramlog_write(FAR syslog_channel_t *channel,
                      FAR const char *buffer, size_t buflen);
 #endif
 
+/****************************************************************************
+ * Name: ramlog_bprintf
+ *
+ * Description:
+ *   Capture one log message into the RAM log as a binary record.  The
+ *   format string pointer and the raw arguments are stored; the vsprintf
+ *   work is deferred until a reader fetches the record.  The format
+ *   string must remain valid for the life of the record (i.e. it must be
+ *   a string literal or other immutable storage).
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_RAMLOG_BINARY
+ssize_t ramlog_bprintf(int priority, FAR const IPTR char *fmt,
+                       FAR va_list *ap);
+#endif
+
 #undef EXTERN
 #ifdef __cplusplus
 }
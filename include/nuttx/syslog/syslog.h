@@ -97,7 +97,8 @@
 /* Forward declaration */
 
 #if defined(CONFIG_SYSLOG_IOCTL) || defined(CONFIG_SYSLOG_CONSOLE) || \
-    defined(CONFIG_SYSLOG_CHAR) || defined(CONFIG_SYSLOG_FILE)
+    defined(CONFIG_SYSLOG_CHAR) || defined(CONFIG_SYSLOG_FILE) || \
+    defined(CONFIG_SYSLOG_ASYNC)
 typedef struct syslog_channel_s syslog_channel_t;
 #else
 typedef const struct syslog_channel_s syslog_channel_t;
@@ -278,6 +279,29 @@ int syslog_initialize(void);
 FAR syslog_channel_t *syslog_file_channel(FAR const char *devpath);
 #endif
 
+/****************************************************************************
+ * Name: syslog_async_channel
+ *
+ * Description:
+ *   Wrap a SYSLOG channel so that all output is staged into an in-memory
+ *   ring buffer and drained to the wrapped channel from the low-priority
+ *   work queue.  syslog() callers then only pay for a copy into the ring
+ *   and are never stalled by the speed of the sink.  Output is dropped
+ *   (and the loss reported on the channel) when the ring overflows.
+ *
+ * Input Parameters:
+ *   channel - The channel that performs the actual output
+ *
+ * Returned Value:
+ *   A pointer to the new SYSLOG channel; NULL is returned on any failure
+ *   (in which case the wrapped channel is left untouched).
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SYSLOG_ASYNC
+FAR syslog_channel_t *syslog_async_channel(FAR syslog_channel_t *channel);
+#endif
+
 /****************************************************************************
  * Name: syslog_stream_channel
  *
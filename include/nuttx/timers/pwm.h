@@ -109,12 +109,24 @@
  *  and return immediately.
  *
  *  ioctl argument:  None
+ *
+ * PWMIOC_SETDUTYCYCLES - Update only the duty cycles of the pulsed output.
+ *  All other characteristics (frequency, polarity, ...) are left as
+ *  previously configured.  If the lower half provides the update method,
+ *  all channels are committed to the hardware in one atomic shadow
+ *  register update; otherwise the start method is used as fallback.  This
+ *  is the low overhead path for control loops that reprogram several
+ *  channels every cycle.
+ *
+ *  ioctl argument: A read-only reference to struct pwm_info_s; only the
+ *  duty (and, with CONFIG_PWM_MULTICHAN, channel) fields are used.
  */
 
 #define PWMIOC_SETCHARACTERISTICS _PWMIOC(1)
 #define PWMIOC_GETCHARACTERISTICS _PWMIOC(2)
 #define PWMIOC_START              _PWMIOC(3)
 #define PWMIOC_STOP               _PWMIOC(4)
+#define PWMIOC_SETDUTYCYCLES      _PWMIOC(5)
 
 /* PWM channel polarity *****************************************************/
 
@@ -241,6 +253,17 @@ struct pwm_ops_s
 
   CODE int (*ioctl)(FAR struct pwm_lowerhalf_s *dev,
                     int cmd, unsigned long arg);
+
+  /* Update only the duty cycles of the already running pulse train.  The
+   * lower half should load the compare value of every (enabled) channel
+   * into the timer shadow/preload registers and commit them in a single
+   * update event, so all the outputs change on the same timer cycle.  This
+   * method is optional; when it is NULL the upper half falls back to the
+   * start method.
+   */
+
+  CODE int (*update)(FAR struct pwm_lowerhalf_s *dev,
+                     FAR const struct pwm_info_s *info);
 };
 
 /* This structure is the generic form of state structure used by lower half
@@ -0,0 +1,185 @@
+/****************************************************************************
+ * include/nuttx/tracepoint.h
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_NUTTX_TRACEPOINT_H
+#define __INCLUDE_NUTTX_TRACEPOINT_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+#include <nuttx/compiler.h>
+#include <nuttx/sched_note.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Static tracepoints for custom instrumentation of hot paths.  A
+ * tracepoint is defined once at file scope and hit inline:
+ *
+ *   TRACEPOINT_DEFINE(tcp_input, NOTE_TAG_NET);
+ *   ...
+ *   TRACEPOINT(tcp_input, &record, sizeof(record));
+ *
+ * A disabled tracepoint costs a single load and predicted-untaken
+ * branch at the hit site.  When enabled, the fixed-size record is
+ * emitted into the note transport (drivers/note) together with the
+ * instruction pointer of the hit site, so the normal note tools can
+ * decode and filter it by subsystem tag.  Tracepoints are switched at
+ * runtime by name with tracepoint_enable().
+ */
+
+#ifdef CONFIG_DRIVERS_NOTE_TRACEPOINT
+
+#  define TRACEPOINT_DEFINE(name, tag_) \
+          struct tracepoint_s g_tracepoint_##name = \
+          { \
+            NULL, #name, tag_, 0 \
+          }
+
+#  define TRACEPOINT_EXTERN(name) \
+          extern struct tracepoint_s g_tracepoint_##name
+
+#  define TRACEPOINT(name, buf, len) \
+          do \
+            { \
+              if (g_tracepoint_##name.enabled) \
+                { \
+                  tracepoint_emit(&g_tracepoint_##name, SCHED_NOTE_IP, \
+                                  buf, len); \
+                } \
+            } \
+          while (0)
+
+#else
+
+/* Compile away to nothing, leaving only a harmless declaration where a
+ * definition would have been.
+ */
+
+#  define TRACEPOINT_DEFINE(name, tag_) \
+          extern struct tracepoint_s g_tracepoint_##name
+#  define TRACEPOINT_EXTERN(name) \
+          extern struct tracepoint_s g_tracepoint_##name
+#  define TRACEPOINT(name, buf, len)
+
+#endif
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+struct tracepoint_s
+{
+  FAR struct tracepoint_s *flink;   /* Registered tracepoint list */
+  FAR const char          *name;    /* Tracepoint name */
+  uint8_t                  tag;     /* Subsystem tag, enum note_tag_e */
+  volatile uint8_t         enabled; /* Nonzero: emit records on hit */
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#ifdef CONFIG_DRIVERS_NOTE_TRACEPOINT
+
+#ifdef __cplusplus
+#define EXTERN extern "C"
+extern "C"
+{
+#else
+#define EXTERN extern
+#endif
+
+/****************************************************************************
+ * Name: tracepoint_register
+ *
+ * Description:
+ *   Add a tracepoint to the list used by tracepoint_enable() and
+ *   tracepoint_find().  Typically called once from the subsystem
+ *   initialization of the instrumented module.
+ *
+ ****************************************************************************/
+
+void tracepoint_register(FAR struct tracepoint_s *tp);
+
+/****************************************************************************
+ * Name: tracepoint_unregister
+ *
+ * Description:
+ *   Remove a tracepoint from the registered list and disable it.
+ *
+ ****************************************************************************/
+
+void tracepoint_unregister(FAR struct tracepoint_s *tp);
+
+/****************************************************************************
+ * Name: tracepoint_find
+ *
+ * Description:
+ *   Look up a registered tracepoint by name.
+ *
+ * Returned Value:
+ *   The tracepoint, or NULL if no tracepoint with that name is
+ *   registered.
+ *
+ ****************************************************************************/
+
+FAR struct tracepoint_s *tracepoint_find(FAR const char *name);
+
+/****************************************************************************
+ * Name: tracepoint_enable
+ *
+ * Description:
+ *   Enable or disable the named tracepoint.
+ *
+ * Returned Value:
+ *   OK on success; -ENOENT if no tracepoint with that name is
+ *   registered.
+ *
+ ****************************************************************************/
+
+int tracepoint_enable(FAR const char *name, bool enable);
+
+/****************************************************************************
+ * Name: tracepoint_emit
+ *
+ * Description:
+ *   Emit one record for an enabled tracepoint into the note transport.
+ *   Normally reached through the TRACEPOINT() macro, not called
+ *   directly.
+ *
+ ****************************************************************************/
+
+void tracepoint_emit(FAR struct tracepoint_s *tp, uintptr_t ip,
+                     FAR const void *buf, size_t len);
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONFIG_DRIVERS_NOTE_TRACEPOINT */
+#endif /* __INCLUDE_NUTTX_TRACEPOINT_H */
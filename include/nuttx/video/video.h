@@ -79,6 +79,8 @@ struct v4l2_ops_s
                       FAR struct v4l2_requestbuffers *reqbufs);
   CODE int (*querybuf)(FAR struct file *filep,
                        FAR struct v4l2_buffer *buf);
+  CODE int (*expbuf)(FAR struct file *filep,
+                     FAR struct v4l2_exportbuffer *expbuf);
   CODE int (*qbuf)(FAR struct file *filep,
                    FAR struct v4l2_buffer *buf);
   CODE int (*dqbuf)(FAR struct file *filep,
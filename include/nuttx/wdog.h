@@ -334,6 +334,27 @@ int wd_cancel_irq(FAR struct wdog_s *wdog);
 
 sclock_t wd_gettime(FAR struct wdog_s *wdog);
 
+/****************************************************************************
+ * Name: wd_gettime_next
+ *
+ * Description:
+ *   This function returns the time remaining before the earliest active
+ *   watchdog timer expires, i.e. the time until the next timer driven
+ *   wakeup of the system.  It may be used by power management logic to
+ *   bound the latency of the idle state it selects.
+ *
+ * Input Parameters:
+ *   None.
+ *
+ * Returned Value:
+ *   The time in system ticks remaining until the earliest watchdog timer
+ *   expires.  Zero means that a watchdog has already expired.  A negative
+ *   value means that there is no active watchdog timer.
+ *
+ ****************************************************************************/
+
+sclock_t wd_gettime_next(void);
+
 #undef EXTERN
 #ifdef __cplusplus
 }
@@ -102,6 +102,10 @@ struct bt_buf_s
   uint8_t pool;          /* Memory pool */
   uint8_t ref;           /* Reference count */
   uint8_t type;          /* Type of data contained in the buffer */
+#if defined(CONFIG_BLUETOOTH_FRAME_PREALLOC) && \
+    CONFIG_BLUETOOTH_FRAME_PREALLOC > 0
+  uint8_t fpool;         /* Nonzero if frame is from the dedicated pool */
+#endif
 
   /* The full available buffer. */
 
@@ -171,6 +175,29 @@ FAR struct bt_buf_s *bt_buf_alloc(enum bt_buf_type_e type,
 
 void bt_buf_release(FAR struct bt_buf_s *buf);
 
+/****************************************************************************
+ * Name: bt_buf_detach_frame
+ *
+ * Description:
+ *   Detach the frame from a buffer structure so that it can be handed to
+ *   logic, such as the network layer, that will eventually dispose of it
+ *   with iob_free().  If the frame came from the dedicated frame pool, the
+ *   data is transferred to a freshly allocated IOB and the pool frame is
+ *   returned to the pool.
+ *
+ * Input Parameters:
+ *   buf - Buffer to detach the frame from
+ *
+ * Returned Value:
+ *   A reference to an IOB holding the frame data with io_len, io_pktlen,
+ *   and io_offset matching the buffer state.  On success the buffer no
+ *   longer references a frame.  NULL is returned if no IOB was available
+ *   for the transfer; the buffer is unmodified in that case.
+ *
+ ****************************************************************************/
+
+FAR struct iob_s *bt_buf_detach_frame(FAR struct bt_buf_s *buf);
+
 /****************************************************************************
  * Name: bt_buf_addref
  *
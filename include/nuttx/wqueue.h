@@ -261,8 +261,31 @@ struct work_s
   worker_t  worker;              /* Work callback */
   FAR void *arg;                 /* Callback argument */
   FAR struct kwork_wqueue_s *wq; /* Work queue */
+#ifdef CONFIG_SCHED_WORKQUEUE_PERCPU
+  uint8_t   cpu;                 /* Per-CPU sub-queue holding this work */
+#endif
 };
 
+#ifdef CONFIG_SCHED_WORKQUEUE_PERIODIC
+/* Defines one periodic work entry.  The work queue re-queues the embedded
+ * work structure every 'period' clock ticks.  All periodic work of one
+ * work queue shares a single watchdog timer; deadlines that fall within
+ * CONFIG_SCHED_WORKQUEUE_PERIODIC_TOLERANCE ticks of each other expire in
+ * the same worker wakeup.
+ */
+
+struct work_period_s
+{
+  struct work_s work;            /* Standard work payload */
+  dq_entry_t    node;            /* Entry in the deadline-ordered list */
+  clock_t       deadline;        /* Absolute tick of the next expiry */
+  clock_t       period;          /* Interval between expirations (ticks) */
+  worker_t      worker;          /* Work callback */
+  FAR void     *arg;             /* Callback argument */
+  FAR struct kwork_wqueue_s *wq; /* Work queue, non-NULL while active */
+};
+#endif
+
 /* This is an enumeration of the various events that may be
  * notified via work_notifier_signal().
  */
@@ -415,6 +438,77 @@ int work_queue_wq(FAR struct kwork_wqueue_s *wqueue,
                   FAR struct work_s *work, worker_t worker,
                   FAR void *arg, clock_t delay);
 
+/****************************************************************************
+ * Name: work_queue_period/work_queue_period_wq
+ *
+ * Description:
+ *   Queue periodic work.  The worker callback is invoked on the worker
+ *   thread of execution every 'period' clock ticks until the work is
+ *   cancelled with work_cancel_period().  Unlike re-submitting a plain
+ *   work structure from its own callback, all periodic work of one work
+ *   queue is driven by a single watchdog timer and items whose deadlines
+ *   fall within CONFIG_SCHED_WORKQUEUE_PERIODIC_TOLERANCE ticks of each
+ *   other are expired in the same worker wakeup.
+ *
+ *   The work structure must be initialized to all zero before the first
+ *   call.  If the previous period's work has not yet been performed when
+ *   the next period expires, it is re-queued and runs only once.
+ *
+ * Input Parameters:
+ *   qid    - The work queue ID (must be HPWORK or LPWORK)
+ *   wqueue - The work queue handle
+ *   pwork  - The periodic work structure to queue
+ *   worker - The worker callback to be invoked.  The callback will be
+ *            invoked on the worker thread of execution.
+ *   arg    - The argument that will be passed to the worker callback when
+ *            it is invoked.
+ *   delay  - Delay (in clock ticks) until the first invocation.  Zero
+ *            means to perform the work immediately.
+ *   period - Interval (in clock ticks) between invocations.  Must be
+ *            greater than zero.
+ *
+ * Returned Value:
+ *   Zero on success, a negated errno on failure
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SCHED_WORKQUEUE_PERIODIC
+int work_queue_period(int qid, FAR struct work_period_s *pwork,
+                      worker_t worker, FAR void *arg, clock_t delay,
+                      clock_t period);
+int work_queue_period_wq(FAR struct kwork_wqueue_s *wqueue,
+                         FAR struct work_period_s *pwork, worker_t worker,
+                         FAR void *arg, clock_t delay, clock_t period);
+#endif
+
+/****************************************************************************
+ * Name: work_cancel_period/work_cancel_period_wq
+ *
+ * Description:
+ *   Cancel previously queued periodic work.  This stops the period and
+ *   removes any instance of the work that is pending on the work queue.
+ *   After the work has been cancelled, it may be requeued by calling
+ *   work_queue_period() again.
+ *
+ * Input Parameters:
+ *   qid    - The work queue ID (must be HPWORK or LPWORK)
+ *   wqueue - The work queue handle
+ *   pwork  - The previously queued periodic work structure to cancel
+ *
+ * Returned Value:
+ *   Zero on success, a negated errno on failure
+ *
+ *   -ENOENT - There is no such work queued.
+ *   -EINVAL - An invalid work queue was specified
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SCHED_WORKQUEUE_PERIODIC
+int work_cancel_period(int qid, FAR struct work_period_s *pwork);
+int work_cancel_period_wq(FAR struct kwork_wqueue_s *wqueue,
+                          FAR struct work_period_s *pwork);
+#endif
+
 /****************************************************************************
  * Name: work_queue_pri
  *
@@ -433,6 +527,52 @@ int work_queue_wq(FAR struct kwork_wqueue_s *wqueue,
 int work_queue_priority(int qid);
 int work_queue_priority_wq(FAR struct kwork_wqueue_s *wqueue);
 
+/****************************************************************************
+ * Name: work_queue_set_maxwork/work_queue_set_maxwork_wq
+ *
+ * Description:
+ *   Bound the number of works that may be pending on the work queue at
+ *   any time.  When the bound is reached, work_queue() fails with -EBUSY
+ *   rather than queueing further work.  Delayed work counts against the
+ *   bound from the time that it is submitted.
+ *
+ * Input Parameters:
+ *   qid     - The work queue ID
+ *   wqueue  - The work queue handle
+ *   maxwork - The maximum number of pending works, or zero to remove the
+ *             bound.
+ *
+ * Returned Value:
+ *   Zero on success, a negated errno value on failure.
+ *
+ ****************************************************************************/
+
+int work_queue_set_maxwork(int qid, int maxwork);
+int work_queue_set_maxwork_wq(FAR struct kwork_wqueue_s *wqueue,
+                              int maxwork);
+
+/****************************************************************************
+ * Name: work_queue_set_affinity/work_queue_set_affinity_wq
+ *
+ * Description:
+ *   Set the CPU affinity mask of every worker thread of the work queue.
+ *
+ * Input Parameters:
+ *   qid      - The work queue ID
+ *   wqueue   - The work queue handle
+ *   affinity - The set of CPUs on which the workers may run
+ *
+ * Returned Value:
+ *   Zero on success, a negated errno value on failure.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SMP
+int work_queue_set_affinity(int qid, FAR const cpu_set_t *affinity);
+int work_queue_set_affinity_wq(FAR struct kwork_wqueue_s *wqueue,
+                               FAR const cpu_set_t *affinity);
+#endif
+
 /****************************************************************************
  * Name: work_cancel/work_cancel_wq
  *
@@ -265,10 +265,21 @@ typedef struct pthread_condattr_s pthread_condattr_t;
 #  define __PTHREAD_CONDATTR_T_DEFINED 1
 #endif
 
+struct pthread_mutex_s; /* Forward reference */
+
 struct pthread_cond_s
 {
   sem_t sem;
   clockid_t clockid;
+#ifdef CONFIG_LIBC_MUTEX_FASTPATH
+  /* The mutex named in the most recent pthread_cond_wait() on this
+   * condition variable.  pthread_cond_broadcast() requeues all but the
+   * highest priority waiter directly onto this mutex so that they are
+   * not awakened just to block on it again.
+   */
+
+  FAR struct pthread_mutex_s *mutex;
+#endif
 };
 
 #ifndef __PTHREAD_COND_T_DEFINED
@@ -276,7 +287,11 @@ typedef struct pthread_cond_s pthread_cond_t;
 #  define __PTHREAD_COND_T_DEFINED 1
 #endif
 
-#define PTHREAD_COND_INITIALIZER {SEM_INITIALIZER(0), CLOCK_REALTIME }
+#ifdef CONFIG_LIBC_MUTEX_FASTPATH
+#  define PTHREAD_COND_INITIALIZER {SEM_INITIALIZER(0), CLOCK_REALTIME, NULL}
+#else
+#  define PTHREAD_COND_INITIALIZER {SEM_INITIALIZER(0), CLOCK_REALTIME }
+#endif
 
 struct pthread_mutexattr_s
 {
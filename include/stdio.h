@@ -334,4 +334,34 @@ fortify_function(sprintf) int sprintf(FAR char *buf,
 }
 #endif
 
+/* Fast single character access.  When read-ahead data is already buffered
+ * (getc) or write data is already being buffered (putc), the character can
+ * be transferred with a direct buffer access, avoiding a function call per
+ * character.  The slow paths fall back to the out-of-line functions which
+ * handle unbuffered streams, ungotten characters, buffer mode switching,
+ * line buffering, and flushing.  Both fast-path conditions can only be
+ * true after a previous, successful buffered transfer in the same
+ * direction, so no access mode check is needed here.  These must follow
+ * the prototypes above so that the declarations are not expanded.
+ */
+
+#ifndef CONFIG_STDIO_DISABLE_BUFFERING
+#  if CONFIG_NUNGET_CHARS > 0
+#    define getc_unlocked(s) \
+       ((s)->fs_nungotten == 0 && (s)->fs_bufpos < (s)->fs_bufread ? \
+        (int)(unsigned char)*(s)->fs_bufpos++ : fgetc_unlocked(s))
+#  else
+#    define getc_unlocked(s) \
+       ((s)->fs_bufpos < (s)->fs_bufread ? \
+        (int)(unsigned char)*(s)->fs_bufpos++ : fgetc_unlocked(s))
+#  endif
+#  define putc_unlocked(c,s) \
+     (((s)->fs_flags & __FS_FLAG_LBF) == 0 && \
+      (s)->fs_bufread == (s)->fs_bufstart && \
+      (s)->fs_bufpos > (s)->fs_bufstart && \
+      (s)->fs_bufpos < (s)->fs_bufend ? \
+      (int)(unsigned char)(*(s)->fs_bufpos++ = (char)(c)) : \
+      fputc_unlocked(c, s))
+#endif
+
 #endif /* __INCLUDE_STDIO_H */
@@ -134,9 +134,20 @@
 #define MSG_ERRQUEUE     0x002000 /* Fetch message from error queue.  */
 #define MSG_NOSIGNAL     0x004000 /* Do not generate SIGPIPE.  */
 #define MSG_MORE         0x008000 /* Sender will send more.  */
+#define MSG_WAITFORONE   0x010000 /* Wait for at least one packet
+                                   * (recvmmsg).
+                                   */
 #define MSG_CMSG_CLOEXEC 0x100000 /* Set close_on_exit for file
                                    * descriptor received through SCM_RIGHTS.
                                    */
+#define MSG_DONATE       0x200000 /* NuttX-specific:  Receive by donating
+                                   * the I/O buffer chain to the caller
+                                   * instead of copying the data.  The
+                                   * buffer must hold one FAR struct
+                                   * iob_s * which receives the chain; the
+                                   * caller recycles it with
+                                   * iob_free_chain().
+                                   */
 
 /* Protocol levels supported by get/setsockopt(): */
 
@@ -218,6 +229,12 @@
 #define SO_PEERCRED     18 /* Return the credentials of the peer process
                             * connected to this socket.
                             */
+#define SO_REUSEPORT    19 /* Permits multiple sockets to listen on the same
+                            * address/port pair; incoming connections are
+                            * distributed among them by flow hash (get/set)
+                            * arg: pointer to integer containing a boolean
+                            * value
+                            */
 
 /* The options are unsupported but included for compatibility
  * and portability
@@ -368,6 +385,14 @@ struct msghdr
   unsigned int msg_flags;
 };
 
+/* Used with sendmmsg/recvmmsg to transfer multiple messages at once */
+
+struct mmsghdr
+{
+  struct msghdr msg_hdr;        /* Message header */
+  unsigned int  msg_len;        /* Number of bytes transferred */
+};
+
 struct cmsghdr
 {
   unsigned long cmsg_len;       /* Data byte count, including hdr */
@@ -455,6 +480,13 @@ int getpeername(int sockfd, FAR struct sockaddr *addr,
 ssize_t recvmsg(int sockfd, FAR struct msghdr *msg, int flags);
 ssize_t sendmsg(int sockfd, FAR struct msghdr *msg, int flags);
 
+struct timespec; /* Forward reference (see time.h) */
+
+int recvmmsg(int sockfd, FAR struct mmsghdr *msgvec, unsigned int vlen,
+             int flags, FAR struct timespec *timeout);
+int sendmmsg(int sockfd, FAR struct mmsghdr *msgvec, unsigned int vlen,
+             int flags);
+
 #if CONFIG_FORTIFY_SOURCE > 0
 fortify_function(send) ssize_t send(int sockfd, FAR const void *buf,
                                     size_t len, int flags)
@@ -800,6 +800,26 @@ struct v4l2_buffer
 
 typedef struct v4l2_buffer v4l2_buffer_t;
 
+/* struct v4l2_exportbuffer
+ * Parameter of ioctl(VIDIOC_EXPBUF).  Exports a V4L2_MEMORY_MMAP buffer
+ * as a DMABUF-style file descriptor.  The descriptor keeps the buffer
+ * memory alive until it is closed, so the buffer may be queued to
+ * another device (encoder, display) with V4L2_MEMORY_USERPTR without
+ * copying.  mmap() on the returned descriptor yields the buffer address.
+ */
+
+struct v4l2_exportbuffer
+{
+  uint32_t type;      /* enum #v4l2_buf_type of the exported buffer */
+  uint32_t index;     /* Buffer id */
+  uint32_t plane;     /* Plane index, currently must be 0 */
+  uint32_t flags;     /* Open flags for the descriptor (O_CLOEXEC etc.) */
+  int32_t  fd;        /* Returned file descriptor */
+  uint32_t reserved[11];
+};
+
+typedef struct v4l2_exportbuffer v4l2_exportbuffer_t;
+
 /* Image is a keyframe (I-frame) */
 
 #define V4L2_BUF_FLAG_KEYFRAME                  0x00000008
@@ -246,4 +246,9 @@ void tzset(void);
 }
 #endif
 
+#ifdef CONFIG_SYS_INLINE_PROXIES
+#  define __SYSCALL_INLINE_TIME_H 1
+#  include <nuttx/syscall_inline.h>
+#endif
+
 #endif /* __INCLUDE_TIME_H */
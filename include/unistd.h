@@ -542,4 +542,9 @@ fortify_function(write) ssize_t write(int fd, FAR const void *buf,
 }
 #endif
 
+#ifdef CONFIG_SYS_INLINE_PROXIES
+#  define __SYSCALL_INLINE_UNISTD_H 1
+#  include <nuttx/syscall_inline.h>
+#endif
+
 #endif /* __INCLUDE_UNISTD_H */
@@ -513,7 +513,6 @@ int lio_listio(int mode, FAR struct aiocb * const list[], int nent,
 {
   FAR struct aiocb *aiocbp = NULL;
   int nqueued;
-  int errcode;
   int retcode;
   int status;
   int ret;
@@ -527,8 +526,7 @@ int lio_listio(int mode, FAR struct aiocb * const list[], int nent,
 
   DEBUGASSERT(list);
 
-  nqueued = 0;    /* No I/O operations yet queued */
-  ret     = OK;   /* Assume success */
+  ret = OK;   /* Assume success */
 
   /* Lock the scheduler so that no I/O events can complete on the worker
    * thread until we set our wait set up.  Pre-emption will, of course, be
@@ -537,76 +535,27 @@ int lio_listio(int mode, FAR struct aiocb * const list[], int nent,
 
   sched_lock();
 
-  /* Submit each asynchronous I/O operation in the list, skipping over NULL
-   * entries.
+  /* Submit the entire list.  In PROTECTED and KERNEL builds this costs a
+   * single kernel entry for the whole batch.  Operations that could not be
+   * queued report their error through the aio_result field.
    */
 
-  for (i = 0; i < nent; i++)
+  nqueued = lio_submit(list, nent);
+  if (nqueued < 0)
     {
-      /* Skip over NULL entries */
+      sched_unlock();
+      return ERROR;
+    }
+
+  /* Check whether any operation failed to queue or had a bad opcode */
 
+  for (i = 0; i < nent; i++)
+    {
       aiocbp = list[i];
-      if (aiocbp)
+      if (aiocbp && aiocbp->aio_result < 0 &&
+          aiocbp->aio_result != -EINPROGRESS)
         {
-          /* Submit the operation according to its opcode */
-
-          status = OK;
-          switch (aiocbp->aio_lio_opcode)
-            {
-            case LIO_NOP:
-              {
-                /* Mark the do-nothing operation complete */
-
-                aiocbp->aio_result = OK;
-              }
-              break;
-
-            case LIO_READ:
-            case LIO_WRITE:
-              {
-                if (aiocbp->aio_lio_opcode == LIO_READ)
-                  {
-                    /* Submit the asynchronous read operation */
-
-                    status = aio_read(aiocbp);
-                  }
-                else
-                  {
-                    /* Submit the asynchronous write operation */
-
-                    status = aio_write(aiocbp);
-                  }
-
-                if (status < 0)
-                  {
-                    /* Failed to queue the I/O.  Set up the error return. */
-
-                    errcode = get_errno();
-                    ferr("ERROR: aio_read/write failed: %d\n", errcode);
-                    DEBUGASSERT(errcode > 0);
-                    aiocbp->aio_result = -errcode;
-                    ret = ERROR;
-                  }
-                else
-                  {
-                    /* Increment the count of successfully queue operations */
-
-                    nqueued++;
-                  }
-              }
-              break;
-
-            default:
-              {
-                /* Make the invalid operation complete with an error */
-
-                ferr("ERROR: Unrecognized opcode: %d\n",
-                     aiocbp->aio_lio_opcode);
-                aiocbp->aio_result = -EINVAL;
-                ret = ERROR;
-              }
-              break;
-            }
+          ret = ERROR;
         }
     }
 
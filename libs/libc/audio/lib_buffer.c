@@ -81,7 +81,6 @@ int apb_alloc(FAR struct audio_buf_desc_s *bufdesc)
 
       memset(apb, 0, bufsize);
       apb->i.channels = 1;
-      apb->crefs      = 1;
       apb->nmaxbytes  = bufdesc->numbytes;
       apb->nbytes     = 0;
       apb->flags      = 0;
@@ -90,7 +89,7 @@ int apb_alloc(FAR struct audio_buf_desc_s *bufdesc)
       apb->session    = bufdesc->session;
 #endif
 
-      nxmutex_init(&apb->lock);
+      atomic_store(&apb->crefs, 1);
       ret = sizeof(struct audio_buf_desc_s);
     }
 
@@ -108,16 +107,16 @@ void apb_free(FAR struct ap_buffer_s *apb)
 {
   int refcount;
 
-  /* Perform a reference count decrement and possibly release the memory */
-
-  nxmutex_lock(&apb->lock);
-  refcount = apb->crefs--;
-  nxmutex_unlock(&apb->lock);
+  /* Perform a lock-free reference count decrement and possibly release
+   * the memory.  Buffers circulate between the application, the audio
+   * upper half and DMA completion logic, so this must be safe from
+   * interrupt handlers and must not take a mutex.
+   */
 
+  refcount = atomic_fetch_sub(&apb->crefs, 1);
   if (refcount <= 1)
     {
       audinfo("Freeing %p\n", apb);
-      nxmutex_destroy(&apb->lock);
       lib_ufree(apb);
     }
 }
@@ -133,11 +132,7 @@ void apb_free(FAR struct ap_buffer_s *apb)
 
 void apb_reference(FAR struct ap_buffer_s *apb)
 {
-  /* Do we need any thread protection here?  Almost certainly... */
-
-  nxmutex_lock(&apb->lock);
-  apb->crefs++;
-  nxmutex_unlock(&apb->lock);
+  atomic_fetch_add(&apb->crefs, 1);
 }
 
 #endif /* CONFIG_AUDIO */
@@ -0,0 +1,62 @@
+/****************************************************************************
+ * libs/libc/dirent/lib_getdents.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <dirent.h>
+#include <unistd.h>
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: getdents
+ *
+ * Description:
+ *   The getdents() function reads several directory entries from the
+ *   directory referred to by the open file descriptor 'fd' into the
+ *   buffer pointed to by 'buf'.  Up to 'count' bytes, i.e. count /
+ *   sizeof(struct dirent) entries, are returned per call, so a directory
+ *   scan costs one kernel crossing per buffer rather than one per entry
+ *   as with readdir().
+ *
+ * Input Parameters:
+ *   fd    -- A file descriptor referring to a directory, such as the one
+ *            returned by dirfd();
+ *   buf   -- The buffer to fill with an array of struct dirent;
+ *   count -- The size of that buffer in bytes.
+ *
+ * Returned Value:
+ *   On success, the number of bytes read is returned.  The result is
+ *   always a multiple of sizeof(struct dirent).  On end of directory, 0
+ *   is returned.  On error, -1 is returned, and errno is set
+ *   appropriately.
+ *
+ ****************************************************************************/
+
+ssize_t getdents(int fd, FAR struct dirent *buf, size_t count)
+{
+  return read(fd, buf, count);
+}
@@ -0,0 +1,218 @@
+/****************************************************************************
+ * libs/libc/fixedmath/lib_b16fastsin.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <fixedmath.h>
+
+#ifdef CONFIG_HAVE_LONG_LONG
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* The quarter wave is tabulated in B16TAB_SIZE steps; a full circle is
+ * 4 * B16TAB_SIZE table units.
+ */
+
+#define B16TAB_SIZE   256
+#define B16TAB_CIRCLE (4 * B16TAB_SIZE)
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* sin(k * pi / 512) for k = 0..256 in b16 fixed point */
+
+static const b16_t g_b16sintab[B16TAB_SIZE + 1] =
+{
+  0x00000000, 0x00000192, 0x00000324, 0x000004b6,
+  0x00000648, 0x000007da, 0x0000096c, 0x00000afe,
+  0x00000c90, 0x00000e21, 0x00000fb3, 0x00001144,
+  0x000012d5, 0x00001466, 0x000015f7, 0x00001787,
+  0x00001918, 0x00001aa8, 0x00001c38, 0x00001dc7,
+  0x00001f56, 0x000020e5, 0x00002274, 0x00002402,
+  0x00002590, 0x0000271e, 0x000028ab, 0x00002a38,
+  0x00002bc4, 0x00002d50, 0x00002edc, 0x00003067,
+  0x000031f1, 0x0000337c, 0x00003505, 0x0000368e,
+  0x00003817, 0x0000399f, 0x00003b27, 0x00003cae,
+  0x00003e34, 0x00003fba, 0x0000413f, 0x000042c3,
+  0x00004447, 0x000045cb, 0x0000474d, 0x000048cf,
+  0x00004a50, 0x00004bd1, 0x00004d50, 0x00004ecf,
+  0x0000504d, 0x000051cb, 0x00005348, 0x000054c3,
+  0x0000563e, 0x000057b9, 0x00005932, 0x00005aaa,
+  0x00005c22, 0x00005d99, 0x00005f0f, 0x00006084,
+  0x000061f8, 0x0000636b, 0x000064dd, 0x0000664e,
+  0x000067be, 0x0000692d, 0x00006a9b, 0x00006c08,
+  0x00006d74, 0x00006edf, 0x00007049, 0x000071b2,
+  0x0000731a, 0x00007480, 0x000075e6, 0x0000774a,
+  0x000078ad, 0x00007a10, 0x00007b70, 0x00007cd0,
+  0x00007e2f, 0x00007f8c, 0x000080e8, 0x00008243,
+  0x0000839c, 0x000084f5, 0x0000864c, 0x000087a1,
+  0x000088f6, 0x00008a49, 0x00008b9a, 0x00008ceb,
+  0x00008e3a, 0x00008f88, 0x000090d4, 0x0000921f,
+  0x00009368, 0x000094b0, 0x000095f7, 0x0000973c,
+  0x00009880, 0x000099c2, 0x00009b03, 0x00009c42,
+  0x00009d80, 0x00009ebc, 0x00009ff7, 0x0000a130,
+  0x0000a268, 0x0000a39e, 0x0000a4d2, 0x0000a605,
+  0x0000a736, 0x0000a866, 0x0000a994, 0x0000aac1,
+  0x0000abeb, 0x0000ad14, 0x0000ae3c, 0x0000af62,
+  0x0000b086, 0x0000b1a8, 0x0000b2c9, 0x0000b3e8,
+  0x0000b505, 0x0000b620, 0x0000b73a, 0x0000b852,
+  0x0000b968, 0x0000ba7d, 0x0000bb8f, 0x0000bca0,
+  0x0000bdaf, 0x0000bebc, 0x0000bfc7, 0x0000c0d1,
+  0x0000c1d8, 0x0000c2de, 0x0000c3e2, 0x0000c4e4,
+  0x0000c5e4, 0x0000c6e2, 0x0000c7de, 0x0000c8d9,
+  0x0000c9d1, 0x0000cac7, 0x0000cbbc, 0x0000ccae,
+  0x0000cd9f, 0x0000ce8e, 0x0000cf7a, 0x0000d065,
+  0x0000d14d, 0x0000d234, 0x0000d318, 0x0000d3fb,
+  0x0000d4db, 0x0000d5ba, 0x0000d696, 0x0000d770,
+  0x0000d848, 0x0000d91e, 0x0000d9f2, 0x0000dac4,
+  0x0000db94, 0x0000dc62, 0x0000dd2d, 0x0000ddf7,
+  0x0000debe, 0x0000df83, 0x0000e046, 0x0000e107,
+  0x0000e1c6, 0x0000e282, 0x0000e33c, 0x0000e3f4,
+  0x0000e4aa, 0x0000e55e, 0x0000e610, 0x0000e6bf,
+  0x0000e76c, 0x0000e817, 0x0000e8bf, 0x0000e966,
+  0x0000ea0a, 0x0000eaab, 0x0000eb4b, 0x0000ebe8,
+  0x0000ec83, 0x0000ed1c, 0x0000edb3, 0x0000ee47,
+  0x0000eed9, 0x0000ef68, 0x0000eff5, 0x0000f080,
+  0x0000f109, 0x0000f18f, 0x0000f213, 0x0000f295,
+  0x0000f314, 0x0000f391, 0x0000f40c, 0x0000f484,
+  0x0000f4fa, 0x0000f56e, 0x0000f5df, 0x0000f64e,
+  0x0000f6ba, 0x0000f724, 0x0000f78c, 0x0000f7f1,
+  0x0000f854, 0x0000f8b4, 0x0000f913, 0x0000f96e,
+  0x0000f9c8, 0x0000fa1f, 0x0000fa73, 0x0000fac5,
+  0x0000fb15, 0x0000fb62, 0x0000fbad, 0x0000fbf5,
+  0x0000fc3b, 0x0000fc7f, 0x0000fcc0, 0x0000fcfe,
+  0x0000fd3b, 0x0000fd74, 0x0000fdac, 0x0000fde1,
+  0x0000fe13, 0x0000fe43, 0x0000fe71, 0x0000fe9c,
+  0x0000fec4, 0x0000feeb, 0x0000ff0e, 0x0000ff30,
+  0x0000ff4e, 0x0000ff6b, 0x0000ff85, 0x0000ff9c,
+  0x0000ffb1, 0x0000ffc4, 0x0000ffd4, 0x0000ffe1,
+  0x0000ffec, 0x0000fff5, 0x0000fffb, 0x0000ffff,
+  0x00010000
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: b16tablookup
+ *
+ * Description:
+ *   Return sin() of a phase given in table units with 16 fractional bits,
+ *   [0, B16TAB_CIRCLE << 16), by quarter wave symmetry and linear
+ *   interpolation between adjacent table entries.
+ *
+ ****************************************************************************/
+
+static b16_t b16tablookup(uint32_t phase)
+{
+  unsigned int idx = phase >> 16;
+  uint32_t frac    = phase & 0x0000ffff;
+  unsigned int k   = idx & (B16TAB_SIZE - 1);
+  b16_t s0;
+  b16_t s1;
+  b16_t val;
+
+  if ((idx & B16TAB_SIZE) != 0)
+    {
+      /* Second or fourth quadrant:  Mirror the table */
+
+      s0 = g_b16sintab[B16TAB_SIZE - k];
+      s1 = g_b16sintab[B16TAB_SIZE - k - 1];
+    }
+  else
+    {
+      s0 = g_b16sintab[k];
+      s1 = g_b16sintab[k + 1];
+    }
+
+  val = s0 + (b16_t)(((b32_t)(s1 - s0) * (b32_t)frac) >> 16);
+
+  /* Third and fourth quadrant:  Negate */
+
+  return (idx & (2 * B16TAB_SIZE)) != 0 ? -val : val;
+}
+
+/****************************************************************************
+ * Name: b16radtophase
+ *
+ * Description:
+ *   Convert b16 radians to table units with 16 fractional bits.
+ *
+ ****************************************************************************/
+
+static uint32_t b16radtophase(b16_t rad)
+{
+  rad %= b16TWOPI;
+  if (rad < 0)
+    {
+      rad += b16TWOPI;
+    }
+
+  return (uint32_t)((((b32_t)rad << 16) * B16TAB_CIRCLE +
+                     (b16TWOPI / 2)) / b16TWOPI);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: b16fastsin
+ *
+ * Description:
+ *   Table driven sin() with linear interpolation.  One modulo, one
+ *   division and two table reads per call; worst case error is three
+ *   b16 LSBs, considerably better than the b16sin() polynomial, at the
+ *   cost of a 1KiB quarter wave table.
+ *
+ ****************************************************************************/
+
+b16_t b16fastsin(b16_t rad)
+{
+  return b16tablookup(b16radtophase(rad));
+}
+
+/****************************************************************************
+ * Name: b16fastcos
+ *
+ * Description:
+ *   Table driven cos():  b16fastsin() a quarter circle ahead.
+ *
+ ****************************************************************************/
+
+b16_t b16fastcos(b16_t rad)
+{
+  uint32_t phase = b16radtophase(rad);
+
+  phase = (phase + ((uint32_t)B16TAB_SIZE << 16)) %
+          ((uint32_t)B16TAB_CIRCLE << 16);
+
+  return b16tablookup(phase);
+}
+
+#endif /* CONFIG_HAVE_LONG_LONG */
@@ -0,0 +1,127 @@
+/****************************************************************************
+ * libs/libc/fixedmath/lib_b16vector.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <stdint.h>
+#include <fixedmath.h>
+
+#ifdef CONFIG_HAVE_LONG_LONG
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: b16sat
+ *
+ * Description:
+ *   Saturate a b32 intermediate result to the b16 range.  Written so that
+ *   the compiler can select a saturating instruction (e.g. ARM SSAT)
+ *   where one is available.
+ *
+ ****************************************************************************/
+
+static inline b16_t b16sat(b32_t val)
+{
+  if (val > INT32_MAX)
+    {
+      return INT32_MAX;
+    }
+
+  if (val < INT32_MIN)
+    {
+      return INT32_MIN;
+    }
+
+  return (b16_t)val;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: b16dotb16
+ *
+ * Description:
+ *   Compute the dot product of two b16 arrays of 'n' elements.  The
+ *   products are accumulated at full b32 precision (one multiply-
+ *   accumulate per element, no intermediate rescaling) and the sum is
+ *   rescaled and saturated once at the end.
+ *
+ ****************************************************************************/
+
+b16_t b16dotb16(FAR const b16_t *a, FAR const b16_t *b, size_t n)
+{
+  b32_t acc = 0;
+
+  while (n-- > 0)
+    {
+      acc += (b32_t)*a++ * (b32_t)*b++;
+    }
+
+  return b16sat(acc >> 16);
+}
+
+/****************************************************************************
+ * Name: b16scalev
+ *
+ * Description:
+ *   Multiply each of the 'n' elements of 'src' by the b16 value 'scale'
+ *   and store the saturated b16 products in 'dest'.  'dest' may be the
+ *   same array as 'src'.
+ *
+ ****************************************************************************/
+
+void b16scalev(FAR const b16_t *src, b16_t scale, FAR b16_t *dest, size_t n)
+{
+  while (n-- > 0)
+    {
+      *dest++ = b16sat(((b32_t)*src++ * (b32_t)scale) >> 16);
+    }
+}
+
+/****************************************************************************
+ * Name: b16macv
+ *
+ * Description:
+ *   Multiply each of the 'n' elements of 'src' by the b16 value 'scale'
+ *   and add the products to the corresponding elements of 'acc' with
+ *   saturation:  acc[i] += src[i] * scale.  This is the building block
+ *   for mixing and FIR style loops.
+ *
+ ****************************************************************************/
+
+void b16macv(FAR b16_t *acc, FAR const b16_t *src, b16_t scale, size_t n)
+{
+  while (n-- > 0)
+    {
+      *acc = b16sat((b32_t)*acc +
+                    (((b32_t)*src++ * (b32_t)scale) >> 16));
+      acc++;
+    }
+}
+
+#endif /* CONFIG_HAVE_LONG_LONG */
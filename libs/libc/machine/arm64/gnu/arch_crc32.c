@@ -0,0 +1,110 @@
+/****************************************************************************
+ * libs/libc/machine/arm64/gnu/arch_crc32.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <nuttx/crc32.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Make the optional CRC32 extension instructions available to the
+ * assembler regardless of the configured -march level.
+ */
+
+__asm__(".arch_extension crc");
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: crc32part
+ *
+ * Description:
+ *   Continue CRC calculation on a part of the buffer using the ARMv8
+ *   CRC32 extension instructions.  These implement the same reflected
+ *   0xedb88320 polynomial as the table-driven C implementation.
+ *
+ ****************************************************************************/
+
+uint32_t crc32part(FAR const uint8_t *src, size_t len, uint32_t crc32val)
+{
+  uint32_t crc = crc32val;
+
+  while (len >= 8)
+    {
+      uint64_t val;
+
+      memcpy(&val, src, sizeof(val));
+      __asm__ volatile("crc32x %w0, %w0, %x1" : "+r"(crc) : "r"(val));
+      src += 8;
+      len -= 8;
+    }
+
+  if (len >= 4)
+    {
+      uint32_t val;
+
+      memcpy(&val, src, sizeof(val));
+      __asm__ volatile("crc32w %w0, %w0, %w1" : "+r"(crc) : "r"(val));
+      src += 4;
+      len -= 4;
+    }
+
+  if (len >= 2)
+    {
+      uint16_t val;
+
+      memcpy(&val, src, sizeof(val));
+      __asm__ volatile("crc32h %w0, %w0, %w1" : "+r"(crc) : "r"(val));
+      src += 2;
+      len -= 2;
+    }
+
+  if (len > 0)
+    {
+      __asm__ volatile("crc32b %w0, %w0, %w1" : "+r"(crc) : "r"(*src));
+    }
+
+  return crc;
+}
+
+/****************************************************************************
+ * Name: crc32
+ *
+ * Description:
+ *   Return a 32-bit CRC of the contents of the 'src' buffer, length 'len'
+ *
+ ****************************************************************************/
+
+uint32_t crc32(FAR const uint8_t *src, size_t len)
+{
+  return crc32part(src, len, 0);
+}
@@ -59,6 +59,7 @@
  ************************************************************************************************/
 
 #include <sys/types.h>
+#include <stdbool.h>
 #include <stdint.h>
 
 #include <nuttx/crc32.h>
@@ -107,6 +108,51 @@ static const uint32_t crc32_tab[] =
 };
 #endif
 
+#ifdef CONFIG_LIBC_CRC32_SLICE8
+/* Derived tables for the slice-by-8 algorithm.  Table k gives the effect of
+ * a byte XORed into the CRC register k + 1 bytes before the end of the
+ * block.  The first table is the standard table above; the remaining seven
+ * are derived from it at first use.
+ */
+
+static uint32_t crc32_tab8[7][256];
+static bool crc32_tab8_ready;
+#endif
+
+/************************************************************************************************
+ * Private Functions
+ ************************************************************************************************/
+
+#ifdef CONFIG_LIBC_CRC32_SLICE8
+/************************************************************************************************
+ * Name: crc32_tab8_init
+ *
+ * Description:
+ *   Derive the seven additional slice-by-8 tables from the standard table.  The derivation is
+ *   idempotent, so a race between two first callers is harmless.
+ *
+ ************************************************************************************************/
+
+static void crc32_tab8_init(void)
+{
+  uint32_t entry;
+  int i;
+  int k;
+
+  for (i = 0; i < 256; i++)
+    {
+      entry = crc32_tab[i];
+      for (k = 0; k < 7; k++)
+        {
+          entry            = (entry >> 8) ^ crc32_tab[entry & 0xff];
+          crc32_tab8[k][i] = entry;
+        }
+    }
+
+  crc32_tab8_ready = true;
+}
+#endif
+
 /************************************************************************************************
  * Public Functions
  ************************************************************************************************/
@@ -140,6 +186,45 @@ uint32_t crc32part(FAR const uint8_t *src, size_t len, uint32_t crc32val)
         }
     }
 #else
+#ifdef CONFIG_LIBC_CRC32_SLICE8
+  if (len >= 8)
+    {
+      if (!crc32_tab8_ready)
+        {
+          crc32_tab8_init();
+        }
+
+      /* Consume eight bytes per iteration.  The two words are composed
+       * from individual bytes so that the code is independent of the
+       * target endianness and of the buffer alignment.
+       */
+
+      while (len >= 8)
+        {
+          uint32_t one = crc32val ^
+                         ((uint32_t)src[0] |
+                          ((uint32_t)src[1] << 8) |
+                          ((uint32_t)src[2] << 16) |
+                          ((uint32_t)src[3] << 24));
+          uint32_t two = (uint32_t)src[4] |
+                         ((uint32_t)src[5] << 8) |
+                         ((uint32_t)src[6] << 16) |
+                         ((uint32_t)src[7] << 24);
+
+          crc32val = crc32_tab8[6][one & 0xff] ^
+                     crc32_tab8[5][(one >> 8) & 0xff] ^
+                     crc32_tab8[4][(one >> 16) & 0xff] ^
+                     crc32_tab8[3][one >> 24] ^
+                     crc32_tab8[2][two & 0xff] ^
+                     crc32_tab8[1][(two >> 8) & 0xff] ^
+                     crc32_tab8[0][(two >> 16) & 0xff] ^
+                     crc32_tab[two >> 24];
+          src += 8;
+          len -= 8;
+        }
+    }
+#endif
+
   for (i = 0; i < len; i++)
     {
       crc32val = crc32_tab[(crc32val & 0xff) ^ src[i]] ^ (crc32val >> 8);
@@ -31,6 +31,10 @@
 #include <nuttx/mutex.h>
 #include <nuttx/semaphore.h>
 
+#ifdef CONFIG_LIBC_MUTEX_FASTPATH
+#  include <nuttx/atomic.h>
+#endif
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
@@ -88,6 +92,63 @@ static void nxmutex_add_backtrace(FAR mutex_t *mutex)
 #  define nxmutex_add_backtrace(mutex)
 #endif
 
+/****************************************************************************
+ * Name: nxmutex_spin
+ *
+ * Description:
+ *   Spin briefly on the lock word of a contended mutex before giving up
+ *   and blocking on the semaphore.  Most critical sections are far
+ *   shorter than a sleep/wake round trip, so when the holder is running
+ *   on another CPU the mutex is usually released while the waiter is
+ *   still spinning.  The spin is abandoned early if the holder is
+ *   observed to be not running and is always bounded by
+ *   CONFIG_LIBC_MUTEX_SPIN_COUNT.
+ *
+ * Parameters:
+ *   mutex - mutex descriptor.
+ *
+ * Return Value:
+ *   True if the mutex was acquired while spinning; false if the caller
+ *   should fall back to blocking on the semaphore.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_LIBC_MUTEX_SPIN
+static bool nxmutex_spin(FAR mutex_t *mutex)
+{
+#if defined(CONFIG_BUILD_FLAT) || defined(__KERNEL__)
+  FAR struct tcb_s *htcb;
+#endif
+  int expect;
+  int count;
+
+  for (count = 0; count < CONFIG_LIBC_MUTEX_SPIN_COUNT; count++)
+    {
+      expect = NXMUTEX_FAST_UNLOCKED;
+      if (atomic_compare_exchange_strong(&mutex->fast, &expect,
+                                         NXMUTEX_FAST_LOCKED))
+        {
+          return true;
+        }
+
+#if defined(CONFIG_BUILD_FLAT) || defined(__KERNEL__)
+      /* Spinning only pays off while the holder is making progress on
+       * another CPU.  If the holder is not running (or has vanished),
+       * block immediately instead of burning the rest of the budget.
+       */
+
+      htcb = nxsched_get_tcb(mutex->holder);
+      if (htcb == NULL || htcb->task_state != TSTATE_TASK_RUNNING)
+        {
+          break;
+        }
+#endif
+    }
+
+  return false;
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -113,13 +174,20 @@ static void nxmutex_add_backtrace(FAR mutex_t *mutex)
 
 int nxmutex_init(FAR mutex_t *mutex)
 {
+#ifdef CONFIG_LIBC_MUTEX_FASTPATH
+  int ret = nxsem_init(&mutex->sem, 0, 0);
+#else
   int ret = nxsem_init(&mutex->sem, 0, 1);
+#endif
 
   if (ret < 0)
     {
       return ret;
     }
 
+#ifdef CONFIG_LIBC_MUTEX_FASTPATH
+  atomic_store(&mutex->fast, NXMUTEX_FAST_UNLOCKED);
+#endif
   mutex->holder = NXMUTEX_NO_HOLDER;
 #ifdef CONFIG_PRIORITY_INHERITANCE
   nxsem_set_protocol(&mutex->sem, SEM_TYPE_MUTEX | SEM_PRIO_INHERIT);
@@ -213,12 +281,16 @@ int nxmutex_get_holder(FAR mutex_t *mutex)
 
 bool nxmutex_is_locked(FAR mutex_t *mutex)
 {
+#ifdef CONFIG_LIBC_MUTEX_FASTPATH
+  return atomic_load(&mutex->fast) != NXMUTEX_FAST_UNLOCKED;
+#else
   int cnt;
   int ret;
 
   ret = nxsem_get_value(&mutex->sem, &cnt);
 
   return ret >= 0 && cnt < 1;
+#endif
 }
 
 /****************************************************************************
@@ -246,6 +318,59 @@ int nxmutex_lock(FAR mutex_t *mutex)
   int ret;
 
   DEBUGASSERT(!nxmutex_is_hold(mutex));
+#ifdef CONFIG_LIBC_MUTEX_FASTPATH
+  /* Uncontended case:  A single compare-and-swap on the lock word takes
+   * the mutex without entering the kernel.
+   */
+
+  ret = NXMUTEX_FAST_UNLOCKED;
+  if (atomic_compare_exchange_strong(&mutex->fast, &ret,
+                                     NXMUTEX_FAST_LOCKED))
+    {
+      mutex->holder = _SCHED_GETTID();
+      nxmutex_add_backtrace(mutex);
+      return OK;
+    }
+
+#ifdef CONFIG_LIBC_MUTEX_SPIN
+  /* Contended:  Spin briefly before sleeping in the hope that the holder
+   * releases the mutex from another CPU.
+   */
+
+  if (nxmutex_spin(mutex))
+    {
+      mutex->holder = _SCHED_GETTID();
+      nxmutex_add_backtrace(mutex);
+      return OK;
+    }
+#endif
+
+  for (; ; )
+    {
+      /* Mark the lock word contended so that the unlocker knows to post
+       * the semaphore.  If the lock was released in the meantime the
+       * exchange acquires it (conservatively leaving the contended
+       * marker in place; a spurious post only causes one extra loop in a
+       * later locker).
+       */
+
+      if (atomic_exchange(&mutex->fast, NXMUTEX_FAST_CONTENDED) ==
+          NXMUTEX_FAST_UNLOCKED)
+        {
+          mutex->holder = _SCHED_GETTID();
+          nxmutex_add_backtrace(mutex);
+          return OK;
+        }
+
+      /* Sleep until the holder releases the mutex */
+
+      ret = nxsem_wait(&mutex->sem);
+      if (ret < 0 && ret != -EINTR && ret != -ECANCELED)
+        {
+          return ret;
+        }
+    }
+#else
   for (; ; )
     {
       /* Take the semaphore (perhaps waiting) */
@@ -264,6 +389,7 @@ int nxmutex_lock(FAR mutex_t *mutex)
     }
 
   return ret;
+#endif
 }
 
 /****************************************************************************
@@ -291,11 +417,22 @@ int nxmutex_trylock(FAR mutex_t *mutex)
 {
   int ret;
 
+#ifdef CONFIG_LIBC_MUTEX_FASTPATH
+  ret = NXMUTEX_FAST_UNLOCKED;
+  if (!atomic_compare_exchange_strong(&mutex->fast, &ret,
+                                      NXMUTEX_FAST_LOCKED))
+    {
+      return -EAGAIN;
+    }
+
+  ret = OK;
+#else
   ret = nxsem_trywait(&mutex->sem);
   if (ret < 0)
     {
       return ret;
     }
+#endif
 
   mutex->holder = _SCHED_GETTID();
   nxmutex_add_backtrace(mutex);
@@ -335,6 +472,32 @@ int nxmutex_clocklock(FAR mutex_t *mutex, clockid_t clockid,
 
   /* Wait until we get the lock or until the timeout expires */
 
+#ifdef CONFIG_LIBC_MUTEX_FASTPATH
+  for (; ; )
+    {
+      if (atomic_exchange(&mutex->fast, NXMUTEX_FAST_CONTENDED) ==
+          NXMUTEX_FAST_UNLOCKED)
+        {
+          mutex->holder = _SCHED_GETTID();
+          nxmutex_add_backtrace(mutex);
+          return OK;
+        }
+
+      if (abstime)
+        {
+          ret = nxsem_clockwait(&mutex->sem, clockid, abstime);
+        }
+      else
+        {
+          ret = nxsem_wait(&mutex->sem);
+        }
+
+      if (ret < 0 && ret != -EINTR && ret != -ECANCELED)
+        {
+          return ret;
+        }
+    }
+#else
   do
     {
       if (abstime)
@@ -355,6 +518,7 @@ int nxmutex_clocklock(FAR mutex_t *mutex, clockid_t clockid,
     }
 
   return ret;
+#endif
 }
 
 /****************************************************************************
@@ -429,6 +593,25 @@ int nxmutex_unlock(FAR mutex_t *mutex)
 
   mutex->holder = NXMUTEX_NO_HOLDER;
 
+#ifdef CONFIG_LIBC_MUTEX_FASTPATH
+  /* Release the lock word; enter the kernel only if a waiter may be
+   * sleeping on the semaphore.
+   */
+
+  if (atomic_exchange(&mutex->fast, NXMUTEX_FAST_UNLOCKED) ==
+      NXMUTEX_FAST_CONTENDED)
+    {
+      ret = nxsem_post(&mutex->sem);
+      if (ret < 0)
+        {
+          mutex->holder = _SCHED_GETTID();
+        }
+
+      return ret;
+    }
+
+  return OK;
+#else
   ret = nxsem_post(&mutex->sem);
   if (ret < 0)
     {
@@ -436,6 +619,7 @@ int nxmutex_unlock(FAR mutex_t *mutex)
     }
 
   return ret;
+#endif
 }
 
 /****************************************************************************
@@ -454,7 +638,12 @@ void nxmutex_reset(FAR mutex_t *mutex)
 {
   mutex->holder = NXMUTEX_RESET;
 
+#ifdef CONFIG_LIBC_MUTEX_FASTPATH
+  atomic_store(&mutex->fast, NXMUTEX_FAST_UNLOCKED);
+  nxsem_reset(&mutex->sem, 0);
+#else
   nxsem_reset(&mutex->sem, 1);
+#endif
 }
 #endif
 
@@ -515,6 +704,97 @@ int nxmutex_restorelock(FAR mutex_t *mutex, unsigned int locked)
   return locked ? nxmutex_lock(mutex) : OK;
 }
 
+/****************************************************************************
+ * Name: nxmutex_condlock
+ *
+ * Description:
+ *   This function locks the mutex like nxmutex_lock() but always acquires
+ *   through the contended path so that the NXMUTEX_FAST_CONTENDED marker
+ *   is left in the lock word.  It must be used to re-acquire the mutex
+ *   after a condition variable wait:  pthread_cond_broadcast() transfers
+ *   waiters directly onto the mutex wait queue without those waiters ever
+ *   running the nxmutex_lock() slow path, so a re-acquisition through the
+ *   uncontended compare-and-swap would erase the only evidence that they
+ *   are sleeping and the next unlock would skip the semaphore post,
+ *   stranding them.  The cost is at most one spurious post when the
+ *   caller was in fact the last waiter.
+ *
+ *   In builds without CONFIG_LIBC_MUTEX_FASTPATH the semaphore count
+ *   carries the waiters and this is equivalent to nxmutex_lock().
+ *
+ * Parameters:
+ *   mutex - mutex descriptor.
+ *
+ * Return Value:
+ *   This is an internal OS interface and should not be used by
+ *   applications.  It follows the NuttX internal error return policy:
+ *   Zero (OK) is returned on success.  A negated errno value is returned
+ *   on failure.
+ *
+ ****************************************************************************/
+
+int nxmutex_condlock(FAR mutex_t *mutex)
+{
+#ifdef CONFIG_LIBC_MUTEX_FASTPATH
+  int ret;
+
+  DEBUGASSERT(!nxmutex_is_hold(mutex));
+
+  for (; ; )
+    {
+      /* Mark the lock word contended whether or not the exchange also
+       * acquires it, preserving the marker on behalf of any waiters
+       * still parked on the semaphore.
+       */
+
+      if (atomic_exchange(&mutex->fast, NXMUTEX_FAST_CONTENDED) ==
+          NXMUTEX_FAST_UNLOCKED)
+        {
+          mutex->holder = _SCHED_GETTID();
+          nxmutex_add_backtrace(mutex);
+          return OK;
+        }
+
+      /* Sleep until the holder releases the mutex */
+
+      ret = nxsem_wait(&mutex->sem);
+      if (ret < 0 && ret != -EINTR && ret != -ECANCELED)
+        {
+          return ret;
+        }
+    }
+#else
+  return nxmutex_lock(mutex);
+#endif
+}
+
+/****************************************************************************
+ * Name: nxmutex_condrestorelock
+ *
+ * Description:
+ *   This function restores a mutex broken by nxmutex_breaklock() around a
+ *   condition variable wait.  It differs from nxmutex_restorelock() only
+ *   in that the mutex is re-acquired with nxmutex_condlock() so that
+ *   waiters requeued onto the mutex by pthread_cond_broadcast() are not
+ *   stranded.
+ *
+ * Parameters:
+ *   mutex   - mutex descriptor.
+ *   locked  - true: it's mean that the mutex is broke success
+ *
+ * Return Value:
+ *   This is an internal OS interface and should not be used by
+ *   applications.  It follows the NuttX internal error return policy:
+ *   Zero (OK) is returned on success.  A negated errno value is returned
+ *   on failure.
+ *
+ ****************************************************************************/
+
+int nxmutex_condrestorelock(FAR mutex_t *mutex, unsigned int locked)
+{
+  return locked ? nxmutex_condlock(mutex) : OK;
+}
+
 /****************************************************************************
  * Name: nxmutex_set_protocol
  *
@@ -1007,3 +1287,41 @@ int nxrmutex_restorelock(FAR rmutex_t *rmutex, unsigned int count)
 
   return ret;
 }
+
+/****************************************************************************
+ * Name: nxrmutex_condrestorelock
+ *
+ * Description:
+ *   This function restores a recursive mutex broken by
+ *   nxrmutex_breaklock() around a condition variable wait.  It differs
+ *   from nxrmutex_restorelock() only in that the mutex is re-acquired
+ *   with nxmutex_condlock() so that waiters requeued onto the mutex by
+ *   pthread_cond_broadcast() are not stranded.
+ *
+ * Parameters:
+ *   rmutex - Recursive mutex descriptor.
+ *   count  - Recursion count to restore.
+ *
+ * Return Value:
+ *   This is an internal OS interface and should not be used by
+ *   applications.  It follows the NuttX internal error return policy:
+ *   Zero (OK) is returned on success.  A negated errno value is returned
+ *   on failure.
+ *
+ ****************************************************************************/
+
+int nxrmutex_condrestorelock(FAR rmutex_t *rmutex, unsigned int count)
+{
+  int ret = OK;
+
+  if (count != 0)
+    {
+      ret = nxmutex_condlock(&rmutex->mutex);
+      if (ret >= 0)
+        {
+          rmutex->count = count;
+        }
+    }
+
+  return ret;
+}
@@ -74,6 +74,9 @@ int pthread_cond_init(FAR pthread_cond_t *cond,
   else
     {
       cond->clockid = attr ? attr->clockid : CLOCK_REALTIME;
+#ifdef CONFIG_LIBC_MUTEX_FASTPATH
+      cond->mutex   = NULL;
+#endif
     }
 
   sinfo("Returning %d\n", ret);
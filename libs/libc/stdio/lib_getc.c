@@ -35,6 +35,11 @@ int getc(FAR FILE *stream)
   return fgetc(stream);
 }
 
+/* An out-of-line version is still provided for those who take the
+ * address of the function or undefine the fast-path macro.
+ */
+
+#undef getc_unlocked
 int getc_unlocked(FAR FILE *stream)
 {
   return fgetc_unlocked(stream);
@@ -35,6 +35,11 @@ int putc(int c, FAR FILE *stream)
   return fputc(c, stream);
 }
 
+/* An out-of-line version is still provided for those who take the
+ * address of the function or undefine the fast-path macro.
+ */
+
+#undef putc_unlocked
 int putc_unlocked(int c, FAR FILE *stream)
 {
   return fputc_unlocked(c, stream);
@@ -39,6 +39,27 @@
 
 #include "lib_ultoa_invert.h"
 
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* All two-digit decimal values.  Converting two digits per division
+ * halves the number of (slow, often library-call) divisions needed for
+ * the dominant base 10 case.
+ */
+
+static const char g_digit_pairs[] =
+  "00010203040506070809"
+  "10111213141516171819"
+  "20212223242526272829"
+  "30313233343536373839"
+  "40414243444546474849"
+  "50515253545556575859"
+  "60616263646566676869"
+  "70717273747576777879"
+  "80818283848586878889"
+  "90919293949596979899";
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -57,28 +78,84 @@ FAR char *__ultoa_invert(unsigned long val, FAR char *str, int base)
       base &= ~XTOA_UPPER;
     }
 
-  do
+  if (base == 10)
     {
-      int v;
+      /* Emit two (inverted) digits per division */
+
+      while (val >= 100)
+        {
+          unsigned int v = val % 100;
 
-      v   = val % base;
-      val = val / base;
+          val /= 100;
+          *str++ = g_digit_pairs[v * 2 + 1];
+          *str++ = g_digit_pairs[v * 2];
+        }
 
-      if (v <= 9)
+      if (val >= 10)
         {
-          v += '0';
+          *str++ = g_digit_pairs[(unsigned int)val * 2 + 1];
+          *str++ = g_digit_pairs[(unsigned int)val * 2];
         }
       else
         {
-          if (upper)
-            v += 'A' - 10;
+          *str++ = '0' + (unsigned int)val;
+        }
+    }
+  else if (base == 16 || base == 8)
+    {
+      /* Power-of-two bases need no division at all */
+
+      int shift = base == 16 ? 4 : 3;
+      unsigned int mask = base - 1;
+
+      do
+        {
+          unsigned int v = (unsigned int)val & mask;
+
+          val >>= shift;
+
+          if (v <= 9)
+            {
+              v += '0';
+            }
+          else if (upper)
+            {
+              v += 'A' - 10;
+            }
           else
-            v += 'a' - 10;
+            {
+              v += 'a' - 10;
+            }
+
+          *str++ = v;
         }
+      while (val);
+    }
+  else
+    {
+      do
+        {
+          int v;
+
+          v   = val % base;
+          val = val / base;
 
-      *str++ = v;
+          if (v <= 9)
+            {
+              v += '0';
+            }
+          else
+            {
+              if (upper)
+                v += 'A' - 10;
+              else
+                v += 'a' - 10;
+            }
+
+          *str++ = v;
+        }
+      while (val);
     }
-  while (val);
 
   return str;
 }
@@ -48,6 +48,7 @@
 
 #include <sys/types.h>
 #include <sys/param.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 /****************************************************************************
@@ -67,8 +68,10 @@
   }
 
 #define SWAPINIT(a, width) \
-  swaptype = (uintptr_t)a % sizeof(long) || \
-  width % sizeof(long) ? 2 : width == sizeof(long) ? 0 : 1;
+  swaptype = (uintptr_t)a % sizeof(long) || width % sizeof(long) ? \
+             ((uintptr_t)a % sizeof(uint32_t) == 0 && \
+              width == sizeof(uint32_t) ? 3 : 2) : \
+             width == sizeof(long) ? 0 : 1;
 
 #define swap(a, b) \
   if (swaptype == 0) \
@@ -77,6 +80,12 @@
       *(FAR long *)(a) = *(FAR long *)(b); \
       *(FAR long *)(b) = t; \
     } \
+  else if (swaptype == 3) \
+    { \
+      uint32_t t = *(FAR uint32_t *)(a); \
+      *(FAR uint32_t *)(a) = *(FAR uint32_t *)(b); \
+      *(FAR uint32_t *)(b) = t; \
+    } \
   else \
     { \
       swapfunc(a, b, width, swaptype); \
@@ -92,6 +101,11 @@ static inline void swapfunc(FAR char *a, FAR char *b, int n, int swaptype);
 static inline FAR char *med3(FAR char *a, FAR char *b, FAR char *c,
                              CODE int (*compar)(FAR const void *,
                              FAR const void *));
+static void hsort(FAR char *base, size_t nel, size_t width, int swaptype,
+                  CODE int (*compar)(FAR const void *, FAR const void *));
+static void introsort(FAR char *base, size_t nel, size_t width, int depth,
+                      CODE int (*compar)(FAR const void *,
+                      FAR const void *));
 
 /****************************************************************************
  * Private Functions
@@ -103,6 +117,10 @@ static inline void swapfunc(FAR char *a, FAR char *b, int n, int swaptype)
     {
       swapcode(long, a, b, n)
     }
+  else if (swaptype == 3)
+    {
+      swapcode(uint32_t, a, b, n)
+    }
   else
     {
       swapcode(char, a, b, n)
@@ -119,50 +137,79 @@ static inline FAR char *med3(FAR char *a, FAR char *b, FAR char *c,
 }
 
 /****************************************************************************
- * Public Function
+ * Name: hsort
+ *
+ * Description:
+ *   Bottom-up heapsort over 'nel' elements of 'width' bytes.  This is the
+ *   introsort fallback:  It is used only when quicksort partitioning has
+ *   degenerated, to bound the worst case at O(n log n).
+ *
  ****************************************************************************/
 
+static void hsort(FAR char *base, size_t nel, size_t width, int swaptype,
+                  CODE int (*compar)(FAR const void *, FAR const void *))
+{
+  size_t start = nel / 2;
+  size_t end   = nel;
+  size_t root;
+  size_t child;
+
+  for (; ; )
+    {
+      if (start > 0)
+        {
+          /* Still building the heap:  Sift down the next parent */
+
+          start--;
+        }
+      else
+        {
+          /* Heap built:  Move the largest element to the sorted tail and
+           * sift the displaced element down from the root.
+           */
+
+          if (--end == 0)
+            {
+              return;
+            }
+
+          swap(base, base + end * width);
+        }
+
+      root = start;
+      while ((child = 2 * root + 1) < end)
+        {
+          if (child + 1 < end &&
+              compar(base + child * width, base + (child + 1) * width) < 0)
+            {
+              child++;
+            }
+
+          if (compar(base + root * width, base + child * width) >= 0)
+            {
+              break;
+            }
+
+          swap(base + root * width, base + child * width);
+          root = child;
+        }
+    }
+}
+
 /****************************************************************************
- * Name: qsort
+ * Name: introsort
  *
  * Description:
- *   The qsort() function will sort an array of 'nel' objects, the initial
- *   element of which is pointed to by 'base'. The size of each object, in
- *   bytes, is specified by the 'width" argument. If the 'nel' argument has
- *   the value zero, the comparison function pointed to by 'compar' will not
- *   be called and no rearrangement will take place.
- *
- *   The application will ensure that the comparison function pointed to by
- *   'compar' does not alter the contents of the array. The implementation
- *   may reorder elements of the array between calls to the comparison
- *   function, but will not alter the contents of any individual element.
- *
- *   When the same objects (consisting of 'width" bytes, irrespective of
- *   their current positions in the array) are passed more than once to
- *   the comparison function, the results will be consistent with one
- *   another. That is, they will define a total ordering on the array.
- *
- *   The contents of the array will be sorted in ascending order according
- *   to a comparison function. The 'compar' argument is a pointer to the
- *   comparison function, which is called with two arguments that point to
- *   the elements being compared. The application will ensure that the
- *   function returns an integer less than, equal to, or greater than 0,
- *   if the first argument is considered respectively less than, equal to,
- *   or greater than the second. If two members compare as equal, their
- *   order in the sorted array is unspecified.
- *
- *   (Based on description from OpenGroup.org).
- *
- * Returned Value:
- *   The qsort() function will not return a value.
- *
- * Notes from the original BSD version:
- *   Qsort routine from Bentley & McIlroy's "Engineering a Sort Function".
+ *   Quicksort core from Bentley & McIlroy's "Engineering a Sort Function"
+ *   with an introsort depth bound:  Each level of partitioning decrements
+ *   'depth' and, when it is exhausted, the remaining range is handed to
+ *   heapsort.  Small ranges are finished with insertion sort.
  *
  ****************************************************************************/
 
-void qsort(FAR void *base, size_t nel, size_t width,
-           CODE int(*compar)(FAR const void *, FAR const void *))
+static void introsort(FAR char *base, size_t nel, size_t width, int depth,
+                      CODE int (*compar)(FAR const void *,
+                      FAR const void *))
 {
   FAR char *pa;
   FAR char *pb;
@@ -172,22 +219,18 @@ void qsort(FAR void *base, size_t nel, size_t width,
   FAR char *pm;
   FAR char *pn;
   int swaptype;
-  int swap_cnt;
   int d;
   int r;
 
 loop:
   SWAPINIT(base, width);
-  swap_cnt = 0;
 
   if (nel < 7)
     {
-      for (pm = (FAR char *)base + width;
-           pm < (FAR char *)base + nel * width;
-           pm += width)
+      for (pm = base + width; pm < base + nel * width; pm += width)
         {
           for (pl = pm;
-               pl > (FAR char *)base && compar(pl - width, pl) > 0;
+               pl > base && compar(pl - width, pl) > 0;
                pl -= width)
             {
               swap(pl, pl - width);
@@ -197,11 +240,19 @@ loop:
       return;
     }
 
-  pm = (FAR char *)base + (nel / 2) * width;
+  if (depth-- == 0)
+    {
+      /* Partitioning has degenerated:  Bound the worst case */
+
+      hsort(base, nel, width, swaptype, compar);
+      return;
+    }
+
+  pm = base + (nel / 2) * width;
   if (nel > 7)
     {
       pl = base;
-      pn = (FAR char *)base + (nel - 1) * width;
+      pn = base + (nel - 1) * width;
       if (nel > 40)
         {
           d  = (nel / 8) * width;
@@ -214,16 +265,15 @@ loop:
     }
 
   swap(base, pm);
-  pa = pb = (FAR char *)base + width;
+  pa = pb = base + width;
 
-  pc = pd = (FAR char *)base + (nel - 1) * width;
+  pc = pd = base + (nel - 1) * width;
   for (; ; )
     {
       while (pb <= pc && (r = compar(pb, base)) <= 0)
         {
           if (r == 0)
             {
-              swap_cnt = 1;
               swap(pa, pb);
               pa += width;
             }
@@ -235,7 +285,6 @@ loop:
         {
           if (r == 0)
             {
-              swap_cnt = 1;
               swap(pc, pd);
               pd -= width;
             }
@@ -249,32 +298,12 @@ loop:
         }
 
       swap(pb, pc);
-      swap_cnt = 1;
-      pb      += width;
-      pc      -= width;
-    }
-
-  if (swap_cnt == 0)
-    {
-      /* Switch to insertion sort */
-
-      for (pm = (FAR char *)base + width;
-           pm < (FAR char *)base + nel * width;
-           pm += width)
-        {
-          for (pl = pm;
-               pl > (FAR char *)base && compar(pl - width, pl) > 0;
-               pl -= width)
-            {
-              swap(pl, pl - width);
-            }
-        }
-
-      return;
+      pb += width;
+      pc -= width;
     }
 
-  pn = (FAR char *)base + nel * width;
-  r  = MIN(pa - (FAR char *)base, pb - pa);
+  pn = base + nel * width;
+  r  = MIN(pa - base, pb - pa);
   vecswap(base, pb - r, r);
 
   r  = MIN(pd - pc, pn - pd - width);
@@ -282,7 +311,7 @@ loop:
 
   if ((r = pb - pa) > width)
     {
-      qsort(base, r / width, width, compar);
+      introsort(base, r / width, width, depth, compar);
     }
 
   if ((r = pd - pc) > width)
@@ -294,3 +323,65 @@ loop:
       goto loop;
     }
 }
+
+/****************************************************************************
+ * Public Function
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: qsort
+ *
+ * Description:
+ *   The qsort() function will sort an array of 'nel' objects, the initial
+ *   element of which is pointed to by 'base'. The size of each object, in
+ *   bytes, is specified by the 'width" argument. If the 'nel' argument has
+ *   the value zero, the comparison function pointed to by 'compar' will not
+ *   be called and no rearrangement will take place.
+ *
+ *   The application will ensure that the comparison function pointed to by
+ *   'compar' does not alter the contents of the array. The implementation
+ *   may reorder elements of the array between calls to the comparison
+ *   function, but will not alter the contents of any individual element.
+ *
+ *   When the same objects (consisting of 'width" bytes, irrespective of
+ *   their current positions in the array) are passed more than once to
+ *   the comparison function, the results will be consistent with one
+ *   another. That is, they will define a total ordering on the array.
+ *
+ *   The contents of the array will be sorted in ascending order according
+ *   to a comparison function. The 'compar' argument is a pointer to the
+ *   comparison function, which is called with two arguments that point to
+ *   the elements being compared. The application will ensure that the
+ *   function returns an integer less than, equal to, or greater than 0,
+ *   if the first argument is considered respectively less than, equal to,
+ *   or greater than the second. If two members compare as equal, their
+ *   order in the sorted array is unspecified.
+ *
+ *   (Based on description from OpenGroup.org).
+ *
+ * Returned Value:
+ *   The qsort() function will not return a value.
+ *
+ * Notes from the original BSD version:
+ *   Qsort routine from Bentley & McIlroy's "Engineering a Sort Function".
+ *
+ ****************************************************************************/
+
+void qsort(FAR void *base, size_t nel, size_t width,
+           CODE int(*compar)(FAR const void *, FAR const void *))
+{
+  size_t n;
+  int depth;
+
+  /* Allow roughly 2*log2(nel) levels of partitioning before introsort
+   * falls back to heapsort.
+   */
+
+  depth = 0;
+  for (n = nel; n > 0; n >>= 1)
+    {
+      depth += 2;
+    }
+
+  introsort(base, nel, width, depth, compar);
+}
@@ -26,10 +26,31 @@
 
 #include <nuttx/config.h>
 
+#include <limits.h>
+#include <stdint.h>
 #include <string.h>
 
 #include "libc.h"
 
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifdef CONFIG_STRING_OPTSPEED
+/* A long is scanned per iteration.  The word is XORed with the target
+ * byte repeated in every lane so that a matching byte becomes zero, and
+ * the zero byte is detected with the usual subtract-and-mask trick.
+ */
+
+#  define UNALIGNED(x) ((uintptr_t)(x) & (sizeof(long) - 1))
+#  if LONG_MAX == 2147483647l
+#    define DETECTNULL(x) (((x) - 0x01010101ul) & ~(x) & 0x80808080ul)
+#  else
+#    define DETECTNULL(x) (((x) - 0x0101010101010101ul) & \
+                           ~(x) & 0x8080808080808080ul)
+#  endif
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -50,6 +71,66 @@
 
 #if !defined(CONFIG_LIBC_ARCH_MEMCHR) && defined(LIBC_BUILD_MEMCHR)
 #undef memchr /* See mm/README.txt */
+#ifdef CONFIG_STRING_OPTSPEED
+FAR void *memchr(FAR const void *s, int c, size_t n)
+{
+  FAR const unsigned char *p = (FAR const unsigned char *)s;
+  FAR const unsigned long *aligned;
+  unsigned long mask;
+  unsigned char d = (unsigned char)c;
+  size_t i;
+
+  /* Scan bytewise until the pointer is word aligned */
+
+  while (UNALIGNED(p))
+    {
+      if (n == 0)
+        {
+          return NULL;
+        }
+
+      if (*p == d)
+        {
+          return (FAR void *)p;
+        }
+
+      p++;
+      n--;
+    }
+
+  /* Repeat the target byte in every lane of the mask word */
+
+  mask = d;
+  for (i = 8; i < sizeof(long) * CHAR_BIT; i <<= 1)
+    {
+      mask |= mask << i;
+    }
+
+  /* Then scan a word at a time until a word holding a matching byte */
+
+  aligned = (FAR const unsigned long *)p;
+  while (n >= sizeof(long) && !DETECTNULL(*aligned ^ mask))
+    {
+      aligned++;
+      n -= sizeof(long);
+    }
+
+  /* And locate the matching byte within the remainder */
+
+  p = (FAR const unsigned char *)aligned;
+  while (n--)
+    {
+      if (*p == d)
+        {
+          return (FAR void *)p;
+        }
+
+      p++;
+    }
+
+  return NULL;
+}
+#else
 FAR void *memchr(FAR const void *s, int c, size_t n)
 {
   FAR const unsigned char *p = (FAR const unsigned char *)s;
@@ -67,3 +148,4 @@ FAR void *memchr(FAR const void *s, int c, size_t n)
   return NULL;
 }
 #endif
+#endif
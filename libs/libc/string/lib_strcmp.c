@@ -26,16 +26,80 @@
 
 #include <nuttx/config.h>
 
+#include <limits.h>
+#include <stdint.h>
 #include <string.h>
 
 #include "libc.h"
 
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifdef CONFIG_STRING_OPTSPEED
+/* A long is compared per iteration while both strings are word aligned.
+ * A zero byte within a word is detected with the usual trick: subtracting
+ * one from every byte borrows into bit 7 only for bytes that were zero.
+ */
+
+#  define UNALIGNED(x) ((uintptr_t)(x) & (sizeof(long) - 1))
+#  if LONG_MAX == 2147483647l
+#    define DETECTNULL(x) (((x) - 0x01010101ul) & ~(x) & 0x80808080ul)
+#  else
+#    define DETECTNULL(x) (((x) - 0x0101010101010101ul) & \
+                           ~(x) & 0x8080808080808080ul)
+#  endif
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
 
 #if !defined(CONFIG_LIBC_ARCH_STRCMP) && defined(LIBC_BUILD_STRCMP)
 #undef strcmp /* See mm/README.txt */
+#ifdef CONFIG_STRING_OPTSPEED
+int strcmp(FAR const char *cs, FAR const char *ct)
+{
+  FAR const unsigned long *a1;
+  FAR const unsigned long *a2;
+
+  /* If both strings are word aligned, compare them a word at a time */
+
+  if (!UNALIGNED(cs) && !UNALIGNED(ct))
+    {
+      a1 = (FAR const unsigned long *)cs;
+      a2 = (FAR const unsigned long *)ct;
+
+      while (*a1 == *a2)
+        {
+          /* The words are equal: if one holds a zero byte, the strings
+           * terminate equally within it.
+           */
+
+          if (DETECTNULL(*a1))
+            {
+              return 0;
+            }
+
+          a1++;
+          a2++;
+        }
+
+      /* The differing byte is found by the bytewise loop below */
+
+      cs = (FAR const char *)a1;
+      ct = (FAR const char *)a2;
+    }
+
+  while (*cs != '\0' && *cs == *ct)
+    {
+      cs++;
+      ct++;
+    }
+
+  return (unsigned char)*cs - (unsigned char)*ct;
+}
+#else
 int strcmp(FAR const char *cs, FAR const char *ct)
 {
   register int result;
@@ -51,3 +115,4 @@ int strcmp(FAR const char *cs, FAR const char *ct)
   return result;
 }
 #endif
+#endif
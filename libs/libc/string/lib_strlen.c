@@ -26,16 +26,74 @@
 
 #include <nuttx/config.h>
 #include <sys/types.h>
+#include <limits.h>
+#include <stdint.h>
 #include <string.h>
 
 #include "libc.h"
 
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifdef CONFIG_STRING_OPTSPEED
+/* A long is scanned per iteration.  A zero byte within the word is
+ * detected with the usual trick: subtracting one from every byte borrows
+ * into bit 7 only for bytes that were zero.
+ */
+
+#  define UNALIGNED(x) ((uintptr_t)(x) & (sizeof(long) - 1))
+#  if LONG_MAX == 2147483647l
+#    define DETECTNULL(x) (((x) - 0x01010101ul) & ~(x) & 0x80808080ul)
+#  else
+#    define DETECTNULL(x) (((x) - 0x0101010101010101ul) & \
+                           ~(x) & 0x8080808080808080ul)
+#  endif
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
 
 #if !defined(CONFIG_LIBC_ARCH_STRLEN) && defined(LIBC_BUILD_STRLEN)
 #undef strlen /* See mm/README.txt */
+#ifdef CONFIG_STRING_OPTSPEED
+size_t strlen(FAR const char *s)
+{
+  FAR const unsigned long *aligned;
+  FAR const char *sc = s;
+
+  /* Scan bytewise until the pointer is word aligned */
+
+  while (UNALIGNED(sc))
+    {
+      if (*sc == '\0')
+        {
+          return sc - s;
+        }
+
+      sc++;
+    }
+
+  /* Then scan a word at a time until a word holding a zero byte */
+
+  aligned = (FAR const unsigned long *)sc;
+  while (!DETECTNULL(*aligned))
+    {
+      aligned++;
+    }
+
+  /* And locate the zero byte within that word */
+
+  sc = (FAR const char *)aligned;
+  while (*sc != '\0')
+    {
+      sc++;
+    }
+
+  return sc - s;
+}
+#else
 size_t strlen(FAR const char *s)
 {
   FAR const char *sc;
@@ -43,3 +101,4 @@ size_t strlen(FAR const char *s)
   return sc - s;
 }
 #endif
+#endif
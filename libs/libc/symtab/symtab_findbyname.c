@@ -60,6 +60,12 @@ symtab_findbyname(FAR const struct symtab_s *symtab,
   int high = nsyms - 1;
   int mid;
   int cmp;
+#elif defined(CONFIG_SYMTAB_ORDEREDBYHASH)
+  int low  = 0;
+  int high = nsyms - 1;
+  int mid;
+  uint32_t hash;
+  uint32_t mhash;
 #endif
 
   if (symtab == NULL)
@@ -119,6 +125,49 @@ symtab_findbyname(FAR const struct symtab_s *symtab,
    */
 
   return strcmp(name, symtab[low].sym_name) == 0 ? &symtab[low] : NULL;
+#elif defined(CONFIG_SYMTAB_ORDEREDBYHASH)
+  /* Binary search on the hash of the name.  Only the (rare) entries whose
+   * names collide on the same hash value must be compared with strcmp().
+   */
+
+  hash = symtab_hash(name);
+  while (low <= high)
+    {
+      mid   = (low + high) >> 1;
+      mhash = symtab_hash(symtab[mid].sym_name);
+      if (hash < mhash)
+        {
+          high = mid - 1;
+        }
+      else if (hash > mhash)
+        {
+          low = mid + 1;
+        }
+      else
+        {
+          /* Back up to the first entry of the equal hash run, then
+           * compare names across the run.
+           */
+
+          while (mid > 0 && symtab_hash(symtab[mid - 1].sym_name) == hash)
+            {
+              mid--;
+            }
+
+          for (; mid < nsyms && symtab_hash(symtab[mid].sym_name) == hash;
+               mid++)
+            {
+              if (strcmp(name, symtab[mid].sym_name) == 0)
+                {
+                  return &symtab[mid];
+                }
+            }
+
+          return NULL;
+        }
+    }
+
+  return NULL;
 #else
   for (; nsyms > 0; symtab++, nsyms--)
     {
@@ -0,0 +1,114 @@
+/****************************************************************************
+ * libs/libc/time/lib_clockgettime.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <time.h>
+#include <errno.h>
+
+#include <nuttx/clock.h>
+
+#if defined(CONFIG_CLOCK_USERPAGE) && !defined(__KERNEL__)
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: clock_gettime
+ *
+ * Description:
+ *   Get the current value of the specified time clock without entering the
+ *   kernel.  The kernel refreshes the clock page on each timer tick; this
+ *   function converts the tick count and base time published there into a
+ *   timespec using the same logic as the kernel implementation.
+ *
+ *   The clock page is read with a sequence-lock protocol:  the read is
+ *   retried if the sequence count was odd (an update was in progress) or
+ *   changed while the page contents were being copied.
+ *
+ * Input Parameters:
+ *   clock_id - The clock to query:  CLOCK_REALTIME, CLOCK_MONOTONIC, or
+ *              CLOCK_BOOTTIME.
+ *   tp       - The location to return the current time
+ *
+ * Returned Value:
+ *   Zero (OK) on success;  -1 is returned on failure with the errno
+ *   variable set appropriately.
+ *
+ ****************************************************************************/
+
+int clock_gettime(clockid_t clock_id, FAR struct timespec *tp)
+{
+  FAR struct clock_userpage_s *cp = CLOCK_USERPAGE;
+  struct timespec basetime;
+  uint32_t seq;
+  clock_t ticks;
+
+  if (tp == NULL || clock_id < 0 || clock_id > CLOCK_BOOTTIME)
+    {
+      set_errno(EINVAL);
+      return ERROR;
+    }
+
+  /* Take a consistent snapshot of the clock page */
+
+  do
+    {
+      seq      = cp->cp_seq;
+
+      /* Keep the copies between the sequence reads:  cp_basetime is not
+       * volatile and could otherwise be moved across the recheck.
+       */
+
+      clock_userpage_barrier();
+      ticks    = cp->cp_ticks;
+      basetime = cp->cp_basetime;
+      clock_userpage_barrier();
+    }
+  while ((seq & 1) != 0 || seq != cp->cp_seq);
+
+  /* The tick count is the time elapsed since the timer was initialized
+   * at power on reset.
+   */
+
+  clock_ticks2time(tp, ticks);
+
+  if (clock_id == CLOCK_REALTIME)
+    {
+      /* Add the base time.  The base time is the time-of-day setting.
+       * When added to the elapsed time since the time-of-day was last
+       * set, this gives us the current time.
+       */
+
+      clock_timespec_add(&basetime, tp, tp);
+    }
+
+  return OK;
+}
+
+#endif /* CONFIG_CLOCK_USERPAGE && !__KERNEL__ */
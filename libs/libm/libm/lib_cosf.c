@@ -28,13 +28,50 @@
  * Included Files
  ****************************************************************************/
 
+#include <sys/types.h>
 #include <math.h>
 
+#include "libm.h"
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
 
 float cosf(float x)
 {
-  return sinf(x + M_PI_2_F);
+  if (!isfinite(x))
+    {
+      return x - x;
+    }
+
+  /* The octant reduction in the kernel is only accurate for |x| < 8192;
+   * pre-reduce larger arguments by the period.
+   */
+
+  if (fabsf(x) >= 8192.0F)
+    {
+      x = fmodf(x, 2 * M_PI_F);
+    }
+
+  return lib_sincosf_kernel(x, 1);
+}
+
+/****************************************************************************
+ * Name: cosf_batch
+ *
+ * Description:
+ *   In-place cos() over an array of single precision values.  The kernel
+ *   is inlined into one tight loop so that consecutive elements can
+ *   overlap in the FPU pipeline instead of paying a call per element.
+ *
+ ****************************************************************************/
+
+void cosf_batch(FAR float *x, size_t n)
+{
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      x[i] = cosf(x[i]);
+    }
 }
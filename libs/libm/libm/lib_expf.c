@@ -34,78 +34,72 @@
 #include "libm.h"
 
 /****************************************************************************
- * Private Data
+ * Pre-processor Definitions
  ****************************************************************************/
 
-static float _flt_inv_fact[] =
-{
-  1.0 / 1.0,                    /* 1/0! */
-  1.0 / 1.0,                    /* 1/1! */
-  1.0 / 2.0,                    /* 1/2! */
-  1.0 / 6.0,                    /* 1/3! */
-  1.0 / 24.0,                   /* 1/4! */
-  1.0 / 120.0,                  /* 1/5! */
-  1.0 / 720.0,                  /* 1/6! */
-  1.0 / 5040.0,                 /* 1/7! */
-  1.0 / 40320.0,                /* 1/8! */
-  1.0 / 362880.0,               /* 1/9! */
-  1.0 / 3628800.0,              /* 1/10! */
-};
+/* log2(e) and an extended precision (Cody and Waite) split of ln(2) */
+
+#define LOG2E_F    1.44269504088896341F
+#define LN2_C1_F   0.693359375F
+#define LN2_C2_F   (-2.12194440E-4F)
+
+/* Overflow and underflow limits of single precision exp() */
+
+#define MAXLOG_F   88.72283905206835F
+#define MINLOG_F   (-103.278929903431851103F)
 
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: expf
+ *
+ * Description:
+ *   Single precision exp() after Cephes:  x is reduced by an extended
+ *   precision multiple of ln(2) so that exp(x) = 2^n * exp(r) with r in
+ *   [-ln(2)/2, ln(2)/2], exp(r) is computed from a degree 6 minimax
+ *   polynomial, and the result is scaled by ldexpf().
+ *
+ ****************************************************************************/
+
 float expf(float x)
 {
-  size_t int_part;
-  bool invert;
-  float value;
-  float x0;
-  size_t i;
+  float z;
+  float r;
+  int n;
 
-  if (x == 0)
+  if (isnan(x))
     {
-      return 1;
+      return x;
     }
-  else if (x < 0)
+
+  if (x > MAXLOG_F)
     {
-      invert = true;
-      x = -x;
+      return INFINITY_F;
     }
-  else
+
+  if (x < MINLOG_F)
     {
-      invert = false;
+      return 0.0F;
     }
 
-  /* Extract integer component */
+  /* Express exp(x) = exp(r) 2^n = exp(r + n ln(2)) */
 
-  int_part = (size_t) x;
+  z = floorf(LOG2E_F * x + 0.5F);
+  n = (int)z;
+  x -= z * LN2_C1_F;
+  x -= z * LN2_C2_F;
 
-  /* set x to fractional component */
+  /* Minimax polynomial for exp(r) on [-ln(2)/2, ln(2)/2] */
 
-  x -= (float)int_part;
+  z = x * x;
+  r = (((((1.9875691500E-4F  * x
+         + 1.3981999507E-3F) * x
+         + 8.3334519073E-3F) * x
+         + 4.1665795894E-2F) * x
+         + 1.6666665459E-1F) * x
+         + 5.0000001201E-1F) * z + x + 1.0F;
 
-  /* Perform Taylor series approximation with eleven terms */
-
-  value = 0.0F;
-  x0 = 1.0F;
-  for (i = 0; i < 10; i++)
-    {
-      value += x0 * _flt_inv_fact[i];
-      x0 *= x;
-    }
-
-  /* Multiply by exp of the integer component */
-
-  value *= lib_expif(int_part);
-
-  if (invert)
-    {
-      return (1.0F / value);
-    }
-  else
-    {
-      return value;
-    }
+  return ldexpf(r, n);
 }
@@ -35,15 +35,11 @@
  * Pre-processor Definitions
  ****************************************************************************/
 
-#define FLT_MAX_EXP_X   88.0F
+/* sqrt(1/2) and an extended precision (Cody and Waite) split of ln(2) */
 
-/* To avoid looping forever in particular corner cases, every LOGF_MAX_ITER
- * the error criteria is relaxed by a factor LOGF_RELAX_MULTIPLIER.
- * todo: might need to adjust the double floating point version too.
- */
-
-#define LOGF_MAX_ITER         400
-#define LOGF_RELAX_MULTIPLIER 2.0F
+#define SQRTH_F    0.707106781186547524F
+#define LN2_C1_F   0.693359375F
+#define LN2_C2_F   (-2.12194440E-4F)
 
 /****************************************************************************
  * Public Functions
@@ -51,58 +47,70 @@
 
 /****************************************************************************
  * Name: logf
+ *
+ * Description:
+ *   Single precision log() after Cephes:  The argument is separated into
+ *   its exponent and fractional parts with frexpf(), the fraction is
+ *   normalized to [sqrt(1/2), sqrt(2)), and log(1 + r) is computed from a
+ *   degree 9 minimax polynomial.  The exponent contribution is added back
+ *   with an extended precision ln(2).
+ *
  ****************************************************************************/
 
 float logf(float x)
 {
+  float fe;
   float y;
-  float y_old;
-  float ey;
-  float epsilon;
-  float rf; /* epsilon relax factor */
-  int   iter;
-
-  y = 0.0F;
-  y_old = 1.0F;
-  epsilon = FLT_EPSILON;
+  float z;
+  int e;
 
-  iter = 0;
-  rf = 1.0F;
+  if (isnan(x) || x == INFINITY_F)
+    {
+      return x;
+    }
 
-  while (y > y_old + epsilon || y < y_old - epsilon)
+  if (x == 0.0F)
     {
-      y_old = y;
-      ey    = expf(y);
-      y    -= (ey - x) / ey;
-
-      if (y > FLT_MAX_EXP_X)
-        {
-          y = FLT_MAX_EXP_X;
-        }
-
-      if (y < -FLT_MAX_EXP_X)
-        {
-          y = -FLT_MAX_EXP_X;
-        }
-
-      epsilon = ((fabsf(y) > rf) ? fabsf(y) : rf) * FLT_EPSILON;
-
-      if (++iter >= LOGF_MAX_ITER)
-        {
-          rf *= LOGF_RELAX_MULTIPLIER;
-          iter = 0;
-        }
+      return -INFINITY_F;
     }
 
-  if (y == FLT_MAX_EXP_X)
+  if (x < 0.0F)
     {
-      return INFINITY_F;
+      return NAN_F;
     }
 
-  if (y == -FLT_MAX_EXP_X)
+  /* Separate mantissa from exponent, with x in [sqrt(1/2), sqrt(2)) */
+
+  x = frexpf(x, &e);
+  if (x < SQRTH_F)
     {
-      return INFINITY_F;
+      e -= 1;
+      x = x + x - 1.0F;
     }
+  else
+    {
+      x = x - 1.0F;
+    }
+
+  /* Minimax polynomial for log(1 + r) */
+
+  z = x * x;
+  y = ((((((((7.0376836292E-2F  * x
+            - 1.1514610310E-1F) * x
+            + 1.1676998740E-1F) * x
+            - 1.2420140846E-1F) * x
+            + 1.4249322787E-1F) * x
+            - 1.6668057665E-1F) * x
+            + 2.0000714765E-1F) * x
+            - 2.4999993993E-1F) * x
+            + 3.3333331174E-1F) * x * z;
+
+  fe = (float)e;
+  y += LN2_C2_F * fe;
+  y -= 0.5F * z;
+
+  z  = x + y;
+  z += LN2_C1_F * fe;
 
-  return y;
+  return z;
 }
@@ -31,19 +31,7 @@
 #include <sys/types.h>
 #include <math.h>
 
-/****************************************************************************
- * Private Data
- ****************************************************************************/
-
-static float _flt_inv_fact[] =
-{
-  1.0 / 1.0,                    /* 1 / 1! */
-  1.0 / 6.0,                    /* 1 / 3! */
-  1.0 / 120.0,                  /* 1 / 5! */
-  1.0 / 5040.0,                 /* 1 / 7! */
-  1.0 / 362880.0,               /* 1 / 9! */
-  1.0 / 39916800.0,             /* 1 / 11! */
-};
+#include "libm.h"
 
 /****************************************************************************
  * Public Functions
@@ -51,53 +39,39 @@ static float _flt_inv_fact[] =
 
 float sinf(float x)
 {
-  float x_squared;
-  float sin_x;
-  size_t i;
-
-  /* Move x to [-pi, pi) */
-
-  x = fmodf(x, 2 * M_PI_F);
-  if (x >= M_PI_F)
+  if (!isfinite(x))
     {
-      x -= 2 * M_PI_F;
+      return x - x;
     }
 
-  if (x < -M_PI_F)
-    {
-      x += 2 * M_PI_F;
-    }
+  /* The octant reduction in the kernel is only accurate for |x| < 8192;
+   * pre-reduce larger arguments by the period.
+   */
 
-  /* Move x to [-pi/2, pi/2) */
-
-  if (x >= M_PI_2_F)
+  if (fabsf(x) >= 8192.0F)
     {
-      x = M_PI_F - x;
+      x = fmodf(x, 2 * M_PI_F);
     }
 
-  if (x < -M_PI_2_F)
-    {
-      x = -M_PI_F - x;
-    }
+  return lib_sincosf_kernel(x, 0);
+}
 
-  x_squared = x * x;
-  sin_x = 0.0F;
+/****************************************************************************
+ * Name: sinf_batch
+ *
+ * Description:
+ *   In-place sin() over an array of single precision values.  The kernel
+ *   is inlined into one tight loop so that consecutive elements can
+ *   overlap in the FPU pipeline instead of paying a call per element.
+ *
+ ****************************************************************************/
 
-  /* Perform Taylor series approximation for sin(x) with six terms */
+void sinf_batch(FAR float *x, size_t n)
+{
+  size_t i;
 
-  for (i = 0; i < 6; i++)
+  for (i = 0; i < n; i++)
     {
-      if (i % 2 == 0)
-        {
-          sin_x += x * _flt_inv_fact[i];
-        }
-      else
-        {
-          sin_x -= x * _flt_inv_fact[i];
-        }
-
-      x *= x_squared;
+      x[i] = sinf(x[i]);
     }
-
-  return sin_x;
 }
@@ -30,10 +30,23 @@
 #include <nuttx/config.h>
 #include <sys/types.h>
 
+#include <math.h>
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
 
+/* Extended precision (Cody and Waite) split of pi/4 used for the argument
+ * reduction in the single precision sin/cos kernel, and 4/pi used to
+ * compute the octant.  The reduction is accurate for |x| < 8192; larger
+ * arguments must be pre-reduced by the caller.
+ */
+
+#define LIB_FOPI_F 1.27323954473516F
+#define LIB_DP1_F  0.78515625F
+#define LIB_DP2_F  2.4187564849853515625E-4F
+#define LIB_DP3_F  3.77489497744594108E-8F
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -69,4 +82,85 @@ float lib_sqrtapprox(float x);
 }
 #endif
 
+/****************************************************************************
+ * Inline Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: lib_sincosf_kernel
+ *
+ * Description:
+ *   Single precision sin/cos core (after Cephes):  The argument is reduced
+ *   to an octant of the circle with an extended precision multiple of pi/4
+ *   and the result is computed from a short minimax polynomial in the
+ *   reduced argument, accurate to about 1 ulp.  The caller must pass a
+ *   finite argument with |x| < 8192 (pre-reduce with fmodf() otherwise).
+ *   Set 'cosine' to compute cos(x) instead of sin(x).
+ *
+ ****************************************************************************/
+
+static inline float lib_sincosf_kernel(float x, int cosine)
+{
+  float y;
+  float z;
+  int sign = 0;
+  int j;
+
+  if (x < 0.0F)
+    {
+      x = -x;
+      if (!cosine)
+        {
+          sign = 1;
+        }
+    }
+
+  /* Identify the octant and map it to [0,3], tracking the sign */
+
+  j = (int)(x * LIB_FOPI_F);
+  y = (float)j;
+  if ((j & 1) != 0)
+    {
+      j += 1;
+      y += 1.0F;
+    }
+
+  j &= 7;
+  if (j > 3)
+    {
+      j -= 4;
+      sign ^= 1;
+    }
+
+  if (cosine && j > 1)
+    {
+      sign ^= 1;
+    }
+
+  /* Extended precision modular arithmetic */
+
+  x = ((x - y * LIB_DP1_F) - y * LIB_DP2_F) - y * LIB_DP3_F;
+  z = x * x;
+
+  if ((j == 1 || j == 2) == (cosine != 0))
+    {
+      /* sin polynomial on [-pi/4, pi/4] */
+
+      y = ((-1.9515295891E-4F * z
+            + 8.3321608736E-3F) * z
+            - 1.6666654611E-1F) * z * x + x;
+    }
+  else
+    {
+      /* cos polynomial on [-pi/4, pi/4] */
+
+      y = ((2.443315711809948E-5F * z
+            - 1.388731625493765E-3F) * z
+            + 4.166664568298827E-2F) * z * z
+            - 0.5F * z + 1.0F;
+    }
+
+  return sign ? -y : y;
+}
+
 #endif /* __LIBS_LIBM_LIBM_LIBM_H */
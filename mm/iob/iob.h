@@ -34,6 +34,9 @@
 #include <nuttx/mm/iob.h>
 #include <nuttx/spinlock.h>
 #include <nuttx/semaphore.h>
+#ifdef CONFIG_IOB_LOCKFREE
+#  include <nuttx/atomic.h>
+#endif
 
 #ifdef CONFIG_MM_IOB
 
@@ -53,6 +56,28 @@
 #  define iobinfo                _none
 #endif /* CONFIG_DEBUG_FEATURES && CONFIG_IOB_DEBUG */
 
+#ifdef CONFIG_IOB_LOCKFREE
+/* The lock-free free list is a Treiber stack of buffer indices.  The top
+ * of the stack is a single 32-bit word combining the index of the first
+ * free buffer with a generation counter that is bumped on every update
+ * for ABA protection; successor links are kept in g_iob_next[], indexed
+ * by buffer.  An index of IOB_IDX_NONE terminates the stack.
+ *
+ * The 16-bit generation counter can wrap, so ABA protection is
+ * probabilistic; 65536 push/pop operations would have to complete inside
+ * one CAS window for a stale update to be accepted.
+ */
+
+#  if CONFIG_IOB_NBUFFERS >= 65535
+#    error CONFIG_IOB_LOCKFREE requires CONFIG_IOB_NBUFFERS < 65535
+#  endif
+
+#  define IOB_IDX_NONE          UINT16_MAX
+#  define IOB_TOP_IDX(top)      ((uint16_t)((top) & 0xffff))
+#  define IOB_TOP_GEN(top)      ((top) >> 16)
+#  define IOB_TOP(gen, idx)     (((uint32_t)(gen) << 16) | (uint32_t)(idx))
+#endif
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -87,6 +112,29 @@ extern sem_t g_qentry_sem;    /* Counts free I/O buffer queue containers */
 
 extern spinlock_t g_iob_lock;
 
+#ifdef CONFIG_IOB_LOCKFREE
+/* The top of the lock-free free list and the per-buffer successor links */
+
+extern atomic_uint g_iob_freetop;
+extern uint16_t g_iob_next[CONFIG_IOB_NBUFFERS];
+
+/* Maps a buffer index back to the buffer within the pre-allocated pool */
+
+extern FAR struct iob_s *g_iob_ptrs[CONFIG_IOB_NBUFFERS];
+
+/* The number of free buffers and the number of blocked allocators.  In
+ * the lock-free configuration the semaphores above are used only as
+ * sleep/wake channels for the blocking-when-empty case; the counts of
+ * record are these atomics.
+ */
+
+extern atomic_int g_iob_navail;
+extern atomic_int g_iob_nwaiters;
+#if CONFIG_IOB_THROTTLE > 0
+extern atomic_int g_throttle_nwaiters;
+#endif
+#endif /* CONFIG_IOB_LOCKFREE */
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
@@ -60,6 +60,7 @@ static clock_t iob_allocwait_gettimeout(clock_t start, unsigned int timeout)
   return tick;
 }
 
+#ifndef CONFIG_IOB_LOCKFREE
 /****************************************************************************
  * Name: iob_alloc_committed
  *
@@ -110,6 +111,58 @@ static FAR struct iob_s *iob_alloc_committed(void)
  *
  ****************************************************************************/
 
+#ifdef CONFIG_IOB_LOCKFREE
+static FAR struct iob_s *iob_allocwait(bool throttled, unsigned int timeout)
+{
+  FAR struct iob_s *iob;
+  FAR atomic_int *nwaiters;
+  FAR sem_t *sem;
+  clock_t start;
+  int ret = OK;
+
+#if CONFIG_IOB_THROTTLE > 0
+  /* Select the semaphore and the waiter count to use. */
+
+  sem      = (throttled ? &g_throttle_sem : &g_iob_sem);
+  nwaiters = (throttled ? &g_throttle_nwaiters : &g_iob_nwaiters);
+#else
+  sem      = &g_iob_sem;
+  nwaiters = &g_iob_nwaiters;
+#endif
+
+  /* Register as a waiter so that iob_free() will post the semaphore, then
+   * retry the lock-free allocation until it succeeds.  The semaphore is
+   * only a sleep/wake channel here; a wakeup does not transfer ownership
+   * of a buffer, so the allocation is always retried.
+   */
+
+  start = clock_systime_ticks();
+  atomic_fetch_add(nwaiters, 1);
+
+  while ((iob = iob_tryalloc(throttled)) == NULL)
+    {
+      if (timeout == UINT_MAX)
+        {
+          ret = nxsem_wait_uninterruptible(sem);
+        }
+      else
+        {
+          ret = nxsem_tickwait_uninterruptible(sem,
+                                   iob_allocwait_gettimeout(start, timeout));
+        }
+
+      if (ret < 0)
+        {
+          break;
+        }
+    }
+
+  atomic_fetch_sub(nwaiters, 1);
+  return iob;
+}
+
+#else /* CONFIG_IOB_LOCKFREE */
+
 static FAR struct iob_s *iob_allocwait(bool throttled, unsigned int timeout)
 {
   FAR struct iob_s *iob;
@@ -171,6 +224,7 @@ static FAR struct iob_s *iob_allocwait(bool throttled, unsigned int timeout)
   leave_critical_section(flags);
   return iob;
 }
+#endif /* CONFIG_IOB_LOCKFREE */
 
 #ifdef CONFIG_IOB_ALLOC
 /****************************************************************************
@@ -246,6 +300,63 @@ FAR struct iob_s *iob_alloc(bool throttled)
  *
  ****************************************************************************/
 
+#ifdef CONFIG_IOB_LOCKFREE
+FAR struct iob_s *iob_tryalloc(bool throttled)
+{
+  FAR struct iob_s *iob;
+  unsigned int top;
+  unsigned int newtop;
+  uint16_t idx;
+  int navail;
+#if CONFIG_IOB_THROTTLE > 0
+  int limit = (throttled ? CONFIG_IOB_THROTTLE : 0);
+#else
+  int limit = 0;
+#endif
+
+  /* Reserve a buffer by decrementing the free count, enforcing the
+   * throttle floor for throttled allocations.  Holding a reservation
+   * guarantees that the free list below is non-empty.
+   */
+
+  navail = atomic_load(&g_iob_navail);
+  do
+    {
+      if (navail <= limit)
+        {
+          return NULL;
+        }
+    }
+  while (!atomic_compare_exchange_weak(&g_iob_navail, &navail, navail - 1));
+
+  /* Pop the I/O buffer from the head of the lock-free free list.  The
+   * generation counter in the top word is bumped on every update so that
+   * a concurrent pop/repush of the same buffer cannot be mistaken for an
+   * unchanged list (the ABA problem).
+   */
+
+  do
+    {
+      top = atomic_load(&g_iob_freetop);
+      idx = IOB_TOP_IDX(top);
+      DEBUGASSERT(idx != IOB_IDX_NONE);
+      newtop = IOB_TOP(IOB_TOP_GEN(top) + 1, g_iob_next[idx]);
+    }
+  while (!atomic_compare_exchange_weak(&g_iob_freetop, &top, newtop));
+
+  iob = g_iob_ptrs[idx];
+
+  /* Put the I/O buffer in a known state */
+
+  iob->io_flink  = NULL; /* Not in a chain */
+  iob->io_len    = 0;    /* Length of the data in the entry */
+  iob->io_offset = 0;    /* Offset to the beginning of data */
+  iob->io_pktlen = 0;    /* Total length of the packet */
+  return iob;
+}
+
+#else /* CONFIG_IOB_LOCKFREE */
+
 FAR struct iob_s *iob_tryalloc(bool throttled)
 {
   FAR struct iob_s *iob;
@@ -323,6 +434,7 @@ FAR struct iob_s *iob_tryalloc(bool throttled)
   spin_unlock_irqrestore(&g_iob_lock, flags);
   return NULL;
 }
+#endif /* CONFIG_IOB_LOCKFREE */
 
 #ifdef CONFIG_IOB_ALLOC
 
@@ -79,13 +79,22 @@
 FAR struct iob_s *iob_free(FAR struct iob_s *iob)
 {
   FAR struct iob_s *next = iob->io_flink;
-  irqstate_t flags;
-#ifdef CONFIG_IOB_NOTIFIER
-  int16_t navail;
+#ifdef CONFIG_IOB_LOCKFREE
+  unsigned int top;
+  unsigned int newtop;
+  uint16_t idx;
+#if CONFIG_IOB_THROTTLE > 0
+  int nfree;
 #endif
+#else
+  irqstate_t flags;
 #if CONFIG_IOB_THROTTLE > 0
   bool committed_thottled = false;
 #endif
+#endif
+#ifdef CONFIG_IOB_NOTIFIER
+  int16_t navail;
+#endif
 
   iobinfo("iob=%p io_pktlen=%u io_len=%u next=%p\n",
           iob, iob->io_pktlen, iob->io_len, next);
@@ -129,6 +138,61 @@ FAR struct iob_s *iob_free(FAR struct iob_s *iob)
     }
 #endif
 
+#ifdef CONFIG_IOB_LOCKFREE
+  /* Push the I/O buffer onto the head of the lock-free free list.  The
+   * generation counter in the top word is bumped on every update so that
+   * a concurrent pop/repush of the same buffer cannot be mistaken for an
+   * unchanged list (the ABA problem).
+   */
+
+  idx = iob->io_index;
+  do
+    {
+      top = atomic_load(&g_iob_freetop);
+      g_iob_next[idx] = IOB_TOP_IDX(top);
+      newtop = IOB_TOP(IOB_TOP_GEN(top) + 1, idx);
+    }
+  while (!atomic_compare_exchange_weak(&g_iob_freetop, &top, newtop));
+
+#if CONFIG_IOB_THROTTLE > 0
+  nfree = atomic_fetch_add(&g_iob_navail, 1) + 1;
+#else
+  atomic_fetch_add(&g_iob_navail, 1);
+#endif
+
+  /* Wake up any blocked allocators.  The semaphores are pure sleep/wake
+   * channels here:  a post does not transfer ownership of a buffer, it
+   * only causes a waiter to retry iob_tryalloc().  Posting is limited to
+   * the number of registered waiters so the semaphore count stays
+   * bounded.
+   */
+
+  if (atomic_load(&g_iob_nwaiters) > 0)
+    {
+      int semcount;
+
+      nxsem_get_value(&g_iob_sem, &semcount);
+      if (semcount < atomic_load(&g_iob_nwaiters))
+        {
+          nxsem_post(&g_iob_sem);
+        }
+    }
+
+#if CONFIG_IOB_THROTTLE > 0
+  if (nfree > CONFIG_IOB_THROTTLE && atomic_load(&g_throttle_nwaiters) > 0)
+    {
+      int semcount;
+
+      nxsem_get_value(&g_throttle_sem, &semcount);
+      if (semcount < atomic_load(&g_throttle_nwaiters))
+        {
+          nxsem_post(&g_throttle_sem);
+        }
+    }
+#endif
+
+#else /* CONFIG_IOB_LOCKFREE */
+
   /* Free the I/O buffer by adding it to the head of the free or the
    * committed list. We don't know what context we are called from so
    * we use extreme measures to protect the free list:  We disable
@@ -218,6 +282,7 @@ FAR struct iob_s *iob_free(FAR struct iob_s *iob)
 #endif
 
   sched_unlock();
+#endif /* CONFIG_IOB_LOCKFREE */
 
 #ifdef CONFIG_IOB_NOTIFIER
   /* Check if the IOB was claimed by a thread that is blocked waiting
@@ -91,16 +91,40 @@ FAR struct iob_qentry_s *g_iob_freeqlist;
 FAR struct iob_qentry_s *g_iob_qcommitted;
 #endif
 
-/* Counting semaphores that tracks the number of free IOBs/qentries */
+/* Counting semaphores that tracks the number of free IOBs/qentries.  In
+ * the lock-free configuration they are pure sleep/wake channels and so
+ * start at zero; the count of free buffers is kept in g_iob_navail.
+ */
 
+#ifdef CONFIG_IOB_LOCKFREE
+sem_t g_iob_sem = SEM_INITIALIZER(0);
+#else
 sem_t g_iob_sem = SEM_INITIALIZER(CONFIG_IOB_NBUFFERS);
+#endif
 
 #if CONFIG_IOB_THROTTLE > 0
 /* Counts available I/O buffers when throttled */
 
+#ifdef CONFIG_IOB_LOCKFREE
+sem_t g_throttle_sem = SEM_INITIALIZER(0);
+#else
 sem_t g_throttle_sem = SEM_INITIALIZER(CONFIG_IOB_NBUFFERS -
                                        CONFIG_IOB_THROTTLE);
 #endif
+#endif
+
+#ifdef CONFIG_IOB_LOCKFREE
+/* The lock-free free list.  See iob.h */
+
+atomic_uint g_iob_freetop = ATOMIC_VAR_INIT(IOB_TOP(0, IOB_IDX_NONE));
+uint16_t g_iob_next[CONFIG_IOB_NBUFFERS];
+FAR struct iob_s *g_iob_ptrs[CONFIG_IOB_NBUFFERS];
+atomic_int g_iob_navail = ATOMIC_VAR_INIT(0);
+atomic_int g_iob_nwaiters = ATOMIC_VAR_INIT(0);
+#if CONFIG_IOB_THROTTLE > 0
+atomic_int g_throttle_nwaiters = ATOMIC_VAR_INIT(0);
+#endif
+#endif
 
 #if CONFIG_IOB_NCHAINS > 0
 /* Counts free I/O buffer queue containers */
@@ -144,14 +168,27 @@ void iob_initialize(void)
 
       /* Add the pre-allocate I/O buffer to the head of the free list */
 
+#ifdef CONFIG_IOB_LOCKFREE
+      iob->io_index   = i;
+      g_iob_ptrs[i]   = iob;
+      g_iob_next[i]   = IOB_TOP_IDX(atomic_load(&g_iob_freetop));
+      atomic_store(&g_iob_freetop, IOB_TOP(0, i));
+#else
       iob->io_flink   = g_iob_freelist;
+#endif
 #ifdef CONFIG_IOB_ALLOC
       iob->io_bufsize = CONFIG_IOB_BUFSIZE;
       iob->io_data    = (FAR uint8_t *)(iob + 1);
 #endif
+#ifndef CONFIG_IOB_LOCKFREE
       g_iob_freelist  = iob;
+#endif
     }
 
+#ifdef CONFIG_IOB_LOCKFREE
+  atomic_store(&g_iob_navail, CONFIG_IOB_NBUFFERS);
+#endif
+
 #if CONFIG_IOB_NCHAINS > 0
   /* Add each I/O buffer chain queue container to the free list */
 
@@ -52,7 +52,12 @@ int iob_navail(bool throttled)
 #if CONFIG_IOB_NBUFFERS > 0
   /* Get the value of the IOB counting semaphores */
 
+#ifdef CONFIG_IOB_LOCKFREE
+  navail = atomic_load(&g_iob_navail);
+  ret = OK;
+#else
   ret = nxsem_get_value(&g_iob_sem, &navail);
+#endif
   if (ret >= 0)
     {
       ret = navail;
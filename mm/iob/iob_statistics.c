@@ -56,6 +56,17 @@ void iob_getstats(FAR struct iob_stats_s *stats)
 {
   stats->ntotal = CONFIG_IOB_NBUFFERS;
 
+#ifdef CONFIG_IOB_LOCKFREE
+  /* The counts of record are the atomics, not the semaphores */
+
+  stats->nfree = atomic_load(&g_iob_navail);
+  stats->nwait = atomic_load(&g_iob_nwaiters);
+#if CONFIG_IOB_THROTTLE > 0
+  stats->nthrottle = atomic_load(&g_throttle_nwaiters);
+#else
+  stats->nthrottle = 0;
+#endif
+#else
   nxsem_get_value(&g_iob_sem, &stats->nfree);
   if (stats->nfree < 0)
     {
@@ -78,6 +89,7 @@ void iob_getstats(FAR struct iob_stats_s *stats)
     {
       stats->nthrottle = 0;
     }
+#endif /* CONFIG_IOB_LOCKFREE */
 }
 
 #endif /* !CONFIG_DISABLE_MOUNTPOINT && CONFIG_FS_PROCFS &&
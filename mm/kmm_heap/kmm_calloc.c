@@ -28,6 +28,8 @@
 
 #include <nuttx/mm/mm.h>
 
+#include "kmm_heap/kmm_heap.h"
+
 #ifdef CONFIG_MM_KERNEL_HEAP
 
 /****************************************************************************
@@ -44,7 +46,7 @@
 
 FAR void *kmm_calloc(size_t n, size_t elem_size)
 {
-  return mm_calloc(g_kmmheap, n, elem_size);
+  return mm_calloc(kmm_arena(), n, elem_size);
 }
 
 #endif /* CONFIG_MM_KERNEL_HEAP */
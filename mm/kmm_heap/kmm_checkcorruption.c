@@ -28,6 +28,8 @@
 
 #include <nuttx/mm/mm.h>
 
+#include "kmm_heap/kmm_heap.h"
+
 #ifdef CONFIG_MM_KERNEL_HEAP
 
 /****************************************************************************
@@ -44,7 +46,16 @@
 
 void kmm_checkcorruption(void)
 {
+  #ifdef CONFIG_MM_KERNEL_HEAP_ARENAS
+  int i;
+
+  for (i = 0; i < KMM_NARENAS; i++)
+    {
+      mm_checkcorruption(g_kmmarena[i]);
+    }
+#else
   mm_checkcorruption(g_kmmheap);
+#endif
 }
 
 #endif /* CONFIG_MM_KERNEL_HEAP */
@@ -31,6 +31,8 @@
 
 #include <nuttx/mm/mm.h>
 
+#include "kmm_heap/kmm_heap.h"
+
 #ifdef CONFIG_MM_KERNEL_HEAP
 
 /****************************************************************************
@@ -54,8 +56,26 @@
 
 void kmm_free(FAR void *mem)
 {
+#ifdef CONFIG_MM_KERNEL_HEAP_ARENAS
+  FAR struct mm_heap_s *heap;
+
+  if (mem == NULL)
+    {
+      return;
+    }
+
+  /* Route the free back to the arena that owns the memory.  If the
+   * owning arena is busy on another CPU, mm_free() parks the memory on
+   * that arena's delay list rather than blocking here.
+   */
+
+  heap = kmm_owner(mem);
+  DEBUGASSERT(heap != NULL);
+  mm_free(heap, mem);
+#else
   DEBUGASSERT((mem == NULL) || kmm_heapmember(mem));
   mm_free(g_kmmheap, mem);
+#endif
 }
 
 #endif /* CONFIG_MM_KERNEL_HEAP */
@@ -0,0 +1,108 @@
+/****************************************************************************
+ * mm/kmm_heap/kmm_heap.h
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __MM_KMM_HEAP_KMM_HEAP_H
+#define __MM_KMM_HEAP_KMM_HEAP_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <nuttx/mm/mm.h>
+#include <nuttx/sched.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifdef CONFIG_MM_KERNEL_HEAP_ARENAS
+#  define KMM_NARENAS    CONFIG_SMP_NCPUS
+#else
+#  define KMM_NARENAS    1
+#endif
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+#ifdef CONFIG_MM_KERNEL_HEAP_ARENAS
+/* The kernel heap is split into one independent arena per CPU.  The
+ * legacy g_kmmheap pointer aliases arena 0 so that region oriented
+ * interfaces (kmm_brkaddr, kmm_extend) keep their meaning.
+ */
+
+extern FAR struct mm_heap_s *g_kmmarena[KMM_NARENAS];
+#endif
+
+/****************************************************************************
+ * Inline Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: kmm_arena
+ *
+ * Description:
+ *   Return the kernel heap arena that allocations from this CPU should
+ *   be served from.
+ *
+ ****************************************************************************/
+
+static inline FAR struct mm_heap_s *kmm_arena(void)
+{
+#ifdef CONFIG_MM_KERNEL_HEAP_ARENAS
+  return g_kmmarena[this_cpu()];
+#else
+  return g_kmmheap;
+#endif
+}
+
+/****************************************************************************
+ * Name: kmm_owner
+ *
+ * Description:
+ *   Return the kernel heap arena that owns the given memory, or NULL if
+ *   the memory is not from the kernel heap.
+ *
+ ****************************************************************************/
+
+static inline FAR struct mm_heap_s *kmm_owner(FAR const void *mem)
+{
+#ifdef CONFIG_MM_KERNEL_HEAP_ARENAS
+  int i;
+
+  for (i = 0; i < KMM_NARENAS; i++)
+    {
+      if (mm_heapmember(g_kmmarena[i], (FAR void *)mem))
+        {
+          return g_kmmarena[i];
+        }
+    }
+
+  return NULL;
+#else
+  return g_kmmheap;
+#endif
+}
+
+#endif /* __MM_KMM_HEAP_KMM_HEAP_H */
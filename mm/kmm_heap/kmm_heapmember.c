@@ -30,6 +30,8 @@
 
 #include <nuttx/mm/mm.h>
 
+#include "kmm_heap/kmm_heap.h"
+
 #ifdef CONFIG_MM_KERNEL_HEAP
 
 /****************************************************************************
@@ -54,7 +56,11 @@
 
 bool kmm_heapmember(FAR void *mem)
 {
+  #ifdef CONFIG_MM_KERNEL_HEAP_ARENAS
+  return kmm_owner(mem) != NULL;
+#else
   return mm_heapmember(g_kmmheap, mem);
+#endif
 }
 
 #endif /* CONFIG_MM_KERNEL_HEAP */
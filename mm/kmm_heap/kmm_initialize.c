@@ -26,14 +26,26 @@
 
 #include <nuttx/config.h>
 
+#include <stdio.h>
+
 #include <nuttx/mm/mm.h>
 
+#include "kmm_heap/kmm_heap.h"
+
 #ifdef CONFIG_MM_KERNEL_HEAP
 
 /****************************************************************************
  * Public Data
  ****************************************************************************/
 
+#ifdef CONFIG_MM_KERNEL_HEAP_ARENAS
+/* The per-CPU kernel heap arenas and their procfs names */
+
+FAR struct mm_heap_s *g_kmmarena[KMM_NARENAS];
+
+static char g_kmmname[KMM_NARENAS][8];
+#endif
+
 /* This is the kernel heap */
 
 FAR struct mm_heap_s *g_kmmheap;
@@ -60,7 +72,29 @@ FAR struct mm_heap_s *g_kmmheap;
 
 void kmm_initialize(FAR void *heap_start, size_t heap_size)
 {
+#ifdef CONFIG_MM_KERNEL_HEAP_ARENAS
+  FAR char *start = heap_start;
+  size_t share = heap_size / KMM_NARENAS;
+  int i;
+
+  /* Carve the kernel heap into one independent arena per CPU so that
+   * allocations on different CPUs do not contend on a single heap lock.
+   * Any remainder from the division goes to the last arena.
+   */
+
+  for (i = 0; i < KMM_NARENAS; i++)
+    {
+      size_t size = (i == KMM_NARENAS - 1) ? heap_size - share * i : share;
+
+      snprintf(g_kmmname[i], sizeof(g_kmmname[i]), "Kmem%d", i);
+      g_kmmarena[i] = mm_initialize_pool(g_kmmname[i], start, size, NULL);
+      start += size;
+    }
+
+  g_kmmheap = g_kmmarena[0];
+#else
   g_kmmheap = mm_initialize_pool("Kmem", heap_start, heap_size, NULL);
+#endif
 }
 
 #endif /* CONFIG_MM_KERNEL_HEAP */
@@ -28,6 +28,8 @@
 
 #include <nuttx/mm/mm.h>
 
+#include "kmm_heap/kmm_heap.h"
+
 #ifdef CONFIG_MM_KERNEL_HEAP
 
 /****************************************************************************
@@ -45,7 +47,35 @@
 
 struct mallinfo kmm_mallinfo(void)
 {
+#ifdef CONFIG_MM_KERNEL_HEAP_ARENAS
+  struct mallinfo total;
+  struct mallinfo info;
+  int i;
+
+  /* Sum the per-arena statistics; the largest free chunk is the largest
+   * of any single arena since allocations never span arenas.
+   */
+
+  total = mm_mallinfo(g_kmmarena[0]);
+  for (i = 1; i < KMM_NARENAS; i++)
+    {
+      info            = mm_mallinfo(g_kmmarena[i]);
+      total.arena    += info.arena;
+      total.ordblks  += info.ordblks;
+      total.aordblks += info.aordblks;
+      total.uordblks += info.uordblks;
+      total.fordblks += info.fordblks;
+      total.usmblks  += info.usmblks;
+      if (info.mxordblk > total.mxordblk)
+        {
+          total.mxordblk = info.mxordblk;
+        }
+    }
+
+  return total;
+#else
   return mm_mallinfo(g_kmmheap);
+#endif
 }
 
 /****************************************************************************
@@ -59,6 +89,22 @@ struct mallinfo kmm_mallinfo(void)
 
 struct mallinfo_task kmm_mallinfo_task(FAR const struct malltask *task)
 {
+#ifdef CONFIG_MM_KERNEL_HEAP_ARENAS
+  struct mallinfo_task total;
+  struct mallinfo_task info;
+  int i;
+
+  total = mm_mallinfo_task(g_kmmarena[0], task);
+  for (i = 1; i < KMM_NARENAS; i++)
+    {
+      info            = mm_mallinfo_task(g_kmmarena[i], task);
+      total.aordblks += info.aordblks;
+      total.uordblks += info.uordblks;
+    }
+
+  return total;
+#else
   return mm_mallinfo_task(g_kmmheap, task);
+#endif
 }
 #endif /* CONFIG_MM_KERNEL_HEAP */
@@ -28,6 +28,8 @@
 
 #include <nuttx/mm/mm.h>
 
+#include "kmm_heap/kmm_heap.h"
+
 #ifdef CONFIG_MM_KERNEL_HEAP
 
 /****************************************************************************
@@ -50,7 +52,7 @@
 
 FAR void *kmm_malloc(size_t size)
 {
-  return mm_malloc(g_kmmheap, size);
+  return mm_malloc(kmm_arena(), size);
 }
 
 #endif /* CONFIG_MM_KERNEL_HEAP */
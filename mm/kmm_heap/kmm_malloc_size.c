@@ -28,6 +28,8 @@
 
 #include <nuttx/mm/mm.h>
 
+#include "kmm_heap/kmm_heap.h"
+
 #ifdef CONFIG_MM_KERNEL_HEAP
 
 /****************************************************************************
@@ -36,7 +38,7 @@
 
 size_t kmm_malloc_size(FAR void *mem)
 {
-  return mm_malloc_size(g_kmmheap, mem);
+  return mm_malloc_size(kmm_owner(mem), mem);
 }
 
 #endif /* CONFIG_MM_KERNEL_HEAP */
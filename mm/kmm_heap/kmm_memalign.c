@@ -30,6 +30,8 @@
 
 #include <nuttx/mm/mm.h>
 
+#include "kmm_heap/kmm_heap.h"
+
 #ifdef CONFIG_MM_KERNEL_HEAP
 
 /****************************************************************************
@@ -53,7 +55,7 @@
 
 FAR void *kmm_memalign(size_t alignment, size_t size)
 {
-  return mm_memalign(g_kmmheap, alignment, size);
+  return mm_memalign(kmm_arena(), alignment, size);
 }
 
 #endif /* CONFIG_MM_KERNEL_HEAP */
@@ -27,6 +27,8 @@
 #include <nuttx/config.h>
 #include <nuttx/mm/mm.h>
 
+#include "kmm_heap/kmm_heap.h"
+
 #ifdef CONFIG_MM_KERNEL_HEAP
 
 /****************************************************************************
@@ -43,7 +45,16 @@
 
 void kmm_memdump(FAR const struct mm_memdump_s *dump)
 {
+  #ifdef CONFIG_MM_KERNEL_HEAP_ARENAS
+  int i;
+
+  for (i = 0; i < KMM_NARENAS; i++)
+    {
+      mm_memdump(g_kmmarena[i], dump);
+    }
+#else
   mm_memdump(g_kmmheap, dump);
+#endif
 }
 
 #endif /* CONFIG_MM_KERNEL_HEAP */
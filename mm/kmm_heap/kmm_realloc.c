@@ -28,6 +28,8 @@
 
 #include <nuttx/mm/mm.h>
 
+#include "kmm_heap/kmm_heap.h"
+
 #ifdef CONFIG_MM_KERNEL_HEAP
 
 /****************************************************************************
@@ -51,7 +53,17 @@
 
 FAR void *kmm_realloc(FAR void *oldmem, size_t newsize)
 {
+  #ifdef CONFIG_MM_KERNEL_HEAP_ARENAS
+  /* Grow in place (or move) within the arena that owns the old memory */
+
+  FAR struct mm_heap_s *heap = oldmem != NULL ? kmm_owner(oldmem)
+                                              : kmm_arena();
+
+  DEBUGASSERT(heap != NULL);
+  return mm_realloc(heap, oldmem, newsize);
+#else
   return mm_realloc(g_kmmheap, oldmem, newsize);
+#endif
 }
 
 #endif /* CONFIG_MM_KERNEL_HEAP */
@@ -28,6 +28,7 @@
 #include <execinfo.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
 #include <syslog.h>
 
 #include <nuttx/kmalloc.h>
@@ -238,6 +239,188 @@ mempool_memdump_free_callback(FAR struct mempool_s *pool,
 }
 #endif
 
+#ifdef CONFIG_MM_MEMPOOL_MAGAZINE
+/****************************************************************************
+ * Name: mempool_magazine_allocate
+ *
+ * Description:
+ *   Try to allocate a block from this CPU's magazine, refilling the
+ *   magazine in a batch from the shared free queue if it is empty.  Only
+ *   local interrupts are disabled on a magazine hit; the pool spinlock is
+ *   taken once per refill rather than once per block.
+ *
+ * Returned Value:
+ *   The pointer to the allocated block on success; NULL to fall back to
+ *   the shared-queue slow path.
+ *
+ ****************************************************************************/
+
+static FAR void *mempool_magazine_allocate(FAR struct mempool_s *pool)
+{
+  FAR struct mempool_magazine_s *mag;
+  FAR void *blk = NULL;
+  irqstate_t flags;
+
+  /* Interrupt context must keep using the reserved interrupt queue, and
+   * pools that waiters may block on must not hide free blocks in the
+   * magazines.
+   */
+
+  if (up_interrupt_context() || (pool->wait && pool->expandsize == 0))
+    {
+      return NULL;
+    }
+
+  flags = up_irq_save();
+  mag   = &pool->magazine[this_cpu()];
+  if (mag->count == 0)
+    {
+      /* The magazine is empty.  Exchange with the shared free queue in
+       * one lock acquisition.
+       */
+
+      spin_lock(&pool->lock);
+      do
+        {
+          FAR sq_entry_t *entry = mempool_remove_queue(pool, &pool->queue);
+
+          if (entry == NULL)
+            {
+              break;
+            }
+
+          mag->blks[mag->count++] = entry;
+          pool->nalloc++;
+        }
+      while (mag->count < CONFIG_MM_MEMPOOL_MAGAZINE_SIZE / 2);
+      spin_unlock(&pool->lock);
+    }
+
+  if (mag->count > 0)
+    {
+      blk = mag->blks[--mag->count];
+    }
+
+  up_irq_restore(flags);
+
+  if (blk != NULL)
+    {
+      blk = kasan_unpoison(blk, pool->blocksize);
+#ifdef CONFIG_MM_FILL_ALLOCATIONS
+      memset(blk, MM_ALLOC_MAGIC, pool->blocksize);
+#endif
+#if CONFIG_MM_BACKTRACE >= 0
+      mempool_add_backtrace(pool, (FAR struct mempool_backtrace_s *)
+                                  ((FAR char *)blk + pool->blocksize));
+#endif
+    }
+
+  return blk;
+}
+
+/****************************************************************************
+ * Name: mempool_magazine_release
+ *
+ * Description:
+ *   Try to release a block into this CPU's magazine, spilling half of the
+ *   magazine back to the shared free queue in a batch if it is full.
+ *
+ * Returned Value:
+ *   True if the block was taken by the magazine layer; false to fall back
+ *   to the shared-queue slow path.
+ *
+ ****************************************************************************/
+
+static bool mempool_magazine_release(FAR struct mempool_s *pool,
+                                     FAR void *blk)
+{
+  size_t blocksize = MEMPOOL_REALBLOCKSIZE(pool);
+  FAR struct mempool_magazine_s *mag;
+  irqstate_t flags;
+#if CONFIG_MM_BACKTRACE >= 0
+  FAR struct mempool_backtrace_s *buf =
+    (FAR struct mempool_backtrace_s *)((FAR char *)blk + pool->blocksize);
+#endif
+
+  /* Blocks from the reserved interrupt pool must go back to the
+   * interrupt queue, and pools that waiters may block on must post
+   * every released block.
+   */
+
+  if ((pool->wait && pool->expandsize == 0) ||
+      (pool->interruptsize > blocksize &&
+       (FAR char *)blk >= pool->ibase &&
+       (FAR char *)blk < pool->ibase + pool->interruptsize - blocksize))
+    {
+      return false;
+    }
+
+#if CONFIG_MM_BACKTRACE >= 0
+  /* Check double free or out of out of bounds */
+
+  DEBUGASSERT(buf->magic == MEMPOOL_MAGIC_ALLOC);
+  buf->magic = MEMPOOL_MAGIC_FREE;
+#endif
+
+#ifdef CONFIG_MM_FILL_ALLOCATIONS
+  memset(blk, MM_FREE_MAGIC, pool->blocksize);
+#endif
+
+  kasan_poison(blk, pool->blocksize);
+
+  flags = up_irq_save();
+  mag   = &pool->magazine[this_cpu()];
+  if (mag->count == CONFIG_MM_MEMPOOL_MAGAZINE_SIZE)
+    {
+      /* The magazine is full.  Exchange with the shared free queue in
+       * one lock acquisition.
+       */
+
+      spin_lock(&pool->lock);
+      do
+        {
+          sq_addlast(mag->blks[--mag->count], &pool->queue);
+          pool->nalloc--;
+        }
+      while (mag->count > CONFIG_MM_MEMPOOL_MAGAZINE_SIZE / 2);
+      spin_unlock(&pool->lock);
+    }
+
+  mag->blks[mag->count++] = blk;
+  up_irq_restore(flags);
+  return true;
+}
+
+/****************************************************************************
+ * Name: mempool_magazine_flush
+ *
+ * Description:
+ *   Return every block held in the per-CPU magazines to the shared free
+ *   queue.  Used when the pool is being torn down.
+ *
+ ****************************************************************************/
+
+static void mempool_magazine_flush(FAR struct mempool_s *pool)
+{
+  FAR struct mempool_magazine_s *mag;
+  irqstate_t flags;
+  int cpu;
+
+  for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++)
+    {
+      flags = spin_lock_irqsave(&pool->lock);
+      mag = &pool->magazine[cpu];
+      while (mag->count > 0)
+        {
+          sq_addlast(mag->blks[--mag->count], &pool->queue);
+          pool->nalloc--;
+        }
+
+      spin_unlock_irqrestore(&pool->lock, flags);
+    }
+}
+#endif /* CONFIG_MM_MEMPOOL_MAGAZINE */
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -267,6 +450,9 @@ int mempool_init(FAR struct mempool_s *pool, FAR const char *name)
   sq_init(&pool->iqueue);
   sq_init(&pool->equeue);
   pool->nalloc = 0;
+#ifdef CONFIG_MM_MEMPOOL_MAGAZINE
+  memset(pool->magazine, 0, sizeof(pool->magazine));
+#endif
   if (pool->interruptsize >= blocksize)
     {
       size_t ninterrupt = pool->interruptsize / blocksize;
@@ -349,6 +535,14 @@ FAR void *mempool_allocate(FAR struct mempool_s *pool)
   FAR sq_entry_t *blk;
   irqstate_t flags;
 
+#ifdef CONFIG_MM_MEMPOOL_MAGAZINE
+  blk = mempool_magazine_allocate(pool);
+  if (blk != NULL)
+    {
+      return blk;
+    }
+#endif
+
 retry:
   flags = spin_lock_irqsave(&pool->lock);
   blk = mempool_remove_queue(pool, &pool->queue);
@@ -428,17 +622,27 @@ retry:
 
 void mempool_release(FAR struct mempool_s *pool, FAR void *blk)
 {
-  irqstate_t flags = spin_lock_irqsave(&pool->lock);
   size_t blocksize = MEMPOOL_REALBLOCKSIZE(pool);
+  irqstate_t flags;
 #if CONFIG_MM_BACKTRACE >= 0
   FAR struct mempool_backtrace_s *buf =
     (FAR struct mempool_backtrace_s *)((FAR char *)blk + pool->blocksize);
+#endif
+
+#ifdef CONFIG_MM_MEMPOOL_MAGAZINE
+  if (mempool_magazine_release(pool, blk))
+    {
+      return;
+    }
+#endif
 
+  flags = spin_lock_irqsave(&pool->lock);
+
+#if CONFIG_MM_BACKTRACE >= 0
   /* Check double free or out of out of bounds */
 
   DEBUGASSERT(buf->magic == MEMPOOL_MAGIC_ALLOC);
   buf->magic = MEMPOOL_MAGIC_FREE;
-
 #endif
 
   pool->nalloc--;
@@ -618,6 +822,12 @@ int mempool_deinit(FAR struct mempool_s *pool)
   FAR sq_entry_t *blk;
   size_t count = 0;
 
+#ifdef CONFIG_MM_MEMPOOL_MAGAZINE
+  /* Return any blocks still cached in the per-CPU magazines */
+
+  mempool_magazine_flush(pool);
+#endif
+
   if (pool->nalloc != 0)
     {
       return -EBUSY;
@@ -44,8 +44,16 @@
 
 #define SIZEOF_GAT(n) \
   ((n + 31) >> 5)
-#define SIZEOF_GRAN_S(n) \
+#ifdef CONFIG_GRAN_SUMMARY
+#  define SIZEOF_GAT2(n) \
+  ((SIZEOF_GAT(n) + 31) >> 5)
+#  define SIZEOF_GRAN_S(n) \
+  (sizeof(struct gran_s) + \
+   sizeof(uint32_t) * (SIZEOF_GAT(n) + SIZEOF_GAT2(n) - 1))
+#else
+#  define SIZEOF_GRAN_S(n) \
   (sizeof(struct gran_s) + sizeof(uint32_t) * (SIZEOF_GAT(n) - 1))
+#endif
 
 /* Debug */
 
@@ -77,6 +85,10 @@ struct gran_s
   mutex_t    lock;       /* For exclusive access to the GAT */
 #endif
   uintptr_t  heapstart; /* The aligned start of the granule heap */
+#ifdef CONFIG_GRAN_SUMMARY
+  FAR uint32_t *gat2;   /* Summary bitmap with one bit per GAT cell; a
+                         * set bit marks a fully allocated cell */
+#endif
   uint32_t   gat[1];    /* Start of the granule allocation table */
 };
 
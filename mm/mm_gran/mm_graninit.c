@@ -138,6 +138,15 @@ GRAN_HANDLE gran_initialize(FAR void *heapstart, size_t heapsize,
       priv->ngranules = ngranules;
       priv->heapstart = alignedstart;
 
+#ifdef CONFIG_GRAN_SUMMARY
+      /* The summary bitmap lives just past the GAT in the same
+       * allocation.  All cells start out free, so the zeroed bitmap
+       * from kmm_zalloc() is already correct.
+       */
+
+      priv->gat2      = &priv->gat[SIZEOF_GAT(ngranules)];
+#endif
+
       /* Initialize mutual exclusion support */
 
 #ifndef CONFIG_GRAN_INTR
@@ -102,6 +102,19 @@ static void cell_set(gran_t *gran, uint32_t cell, uint32_t mask, bool val)
     {
       gran->gat[cell] &= ~mask;
     }
+
+#ifdef CONFIG_GRAN_SUMMARY
+  /* Mirror the cell state into the summary bitmap */
+
+  if (gran->gat[cell] == GATCFULL)
+    {
+      gran->gat2[cell >> 5] |= BIT(cell & 31);
+    }
+  else
+    {
+      gran->gat2[cell >> 5] &= ~BIT(cell & 31);
+    }
+#endif
 }
 
 /* set or clear a range of GAT bits */
@@ -124,6 +137,50 @@ static void gran_set_(gran_t *gran, gatr_t *rang, bool val)
   return;
 }
 
+#ifdef CONFIG_GRAN_SUMMARY
+/* return n from BIT(n) */
+
+static uint32_t bit_index(uint32_t mask)
+{
+#ifdef CONFIG_HAVE_BUILTIN_CTZ
+  return __builtin_ctz(mask);
+#else
+  return DEBRUJIN_LUT[(uint32_t)(mask * DEBRUJIN_NUM) >> 27];
+#endif
+}
+
+/* return the index of the first GAT cell at or after 'cell' with at least
+ * one free granule, or a negative error if there is none.
+ */
+
+static int gran_notfull(const gran_t *gran, uint32_t cell)
+{
+  uint32_t ncells = SIZEOF_GAT(gran->ngranules);
+  uint32_t widx;
+  uint32_t v;
+
+  if (cell >= ncells)
+    {
+      return -ENOMEM;
+    }
+
+  widx = cell >> 5;
+  v = ~gran->gat2[widx] & ~(BIT(cell & 31) - 1);
+  while (v == 0)
+    {
+      if (++widx >= SIZEOF_GAT2(gran->ngranules))
+        {
+          return -ENOMEM;
+        }
+
+      v = ~gran->gat2[widx];
+    }
+
+  cell = (widx << 5) + bit_index(lsb_mask(v));
+  return cell < ncells ? (int)cell : -ENOMEM;
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -250,6 +307,27 @@ int gran_search(const gran_t *gran, size_t size)
   ret = -ENOMEM;
   for (size_t i = 0; i <= gran->ngranules - size; i++)
     {
+#ifdef CONFIG_GRAN_SUMMARY
+      uint32_t cell = i / GATC_BITS(gran);
+
+      if ((gran->gat2[cell >> 5] & BIT(cell & 31)) != 0)
+        {
+          /* The whole cell is allocated:  hop straight to the next cell
+           * holding a free granule (the loop increment re-adds one).
+           */
+
+          int next = gran_notfull(gran, cell + 1);
+
+          if (next < 0)
+            {
+              break;
+            }
+
+          i = (size_t)next * GATC_BITS(gran) - 1;
+          continue;
+        }
+#endif
+
       if (gran_match(gran, i, size, 0, &i))
         {
           ret = i;
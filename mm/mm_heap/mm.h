@@ -34,6 +34,10 @@
 #include <nuttx/fs/procfs.h>
 #include <nuttx/lib/math32.h>
 #include <nuttx/mm/mempool.h>
+#if defined(CONFIG_MM_FREE_DEFER) && \
+    (defined(CONFIG_BUILD_FLAT) || defined(__KERNEL__))
+#  include <nuttx/wqueue.h>
+#endif
 
 #include <assert.h>
 #include <sys/types.h>
@@ -129,6 +133,21 @@
  * of the physically preceding chunk.
  */
 
+#ifdef CONFIG_MM_FASTBINS
+/* Fast bin definitions.  Chunks no larger than MM_FASTBIN_MAXSIZE are
+ * cached on free in per-size-class LIFO bins and reused directly on the
+ * next allocation of the same size, bypassing the free nodelist.  Each
+ * bin holds at most MM_FASTBIN_DEPTH chunks; when a bin is full the
+ * whole bin is spilled back through the normal free path in one batch.
+ */
+
+#  define MM_FASTBIN_MAXSIZE  CONFIG_MM_FASTBINS_MAXSIZE
+#  define MM_FASTBIN_DEPTH    16
+#  define MM_NFASTBINS        (((MM_FASTBIN_MAXSIZE) - MM_MIN_CHUNK) / \
+                               MM_ALIGN + 1)
+#  define MM_FASTBIN_NDX(s)   (((s) - MM_MIN_CHUNK) / MM_ALIGN)
+#endif
+
 #define MM_ALLOC_BIT     0x1
 #define MM_PREVFREE_BIT  0x2
 #define MM_MASK_BIT      (MM_ALLOC_BIT | MM_PREVFREE_BIT)
@@ -253,6 +272,20 @@ struct mm_heap_s
 
   struct mm_freenode_s mm_nodelist[MM_NNODES];
 
+#ifdef CONFIG_MM_FASTBINS
+  /* LIFO caches of recently freed small chunks, segregated by exact
+   * chunk size.  Cached chunks keep their MM_ALLOC_BIT set so that
+   * their physical neighbors are unaffected; no splitting or merging
+   * is performed on the fast path.  mm_fastbin_bypass routes frees
+   * around the bins while a full bin is being spilled back through
+   * the normal free path.
+   */
+
+  FAR struct mm_freenode_s *mm_fastbins[MM_NFASTBINS];
+  uint8_t mm_fastcount[MM_NFASTBINS];
+  bool mm_fastbin_bypass;
+#endif
+
   /* Free delay list, as sometimes we can't do free immdiately. */
 
   FAR struct mm_delaynode_s *mm_delaylist[CONFIG_SMP_NCPUS];
@@ -261,6 +294,17 @@ struct mm_heap_s
   size_t mm_delaycount[CONFIG_SMP_NCPUS];
 #endif
 
+#if defined(CONFIG_MM_FREE_DEFER) && \
+    (defined(CONFIG_BUILD_FLAT) || defined(__KERNEL__))
+  /* Work queue entry for the deferred-free reclaimer.  Frees from
+   * interrupt context and from high-priority threads are parked on the
+   * per-CPU delay lists and coalesced from the low priority work queue
+   * rather than under the caller's mm_lock() hold.
+   */
+
+  struct work_s mm_defer_work;
+#endif
+
   /* The is a multiple mempool of the heap */
 
 #ifdef CONFIG_MM_HEAP_MEMPOOL
@@ -271,6 +315,12 @@ struct mm_heap_s
 #if defined(CONFIG_FS_PROCFS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_MEMINFO)
   struct procfs_meminfo_entry_s mm_procfs;
 #endif
+
+#ifdef CONFIG_MM_HEAP_STATS
+  /* Per-CPU allocator health counters, see mm_heapstats() */
+
+  struct mm_heapstats_s mm_stats[CONFIG_SMP_NCPUS];
+#endif
 };
 
 /* This describes the callback for mm_foreach */
@@ -278,6 +328,35 @@ struct mm_heap_s
 typedef CODE void (*mm_node_handler_t)(FAR struct mm_allocnode_s *node,
                                        FAR void *arg);
 
+/****************************************************************************
+ * Inline Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_MM_HEAP_STATS
+/****************************************************************************
+ * Name: mm_stats_hist
+ *
+ * Description:
+ *   Count one allocation of the given size in the per-CPU size class
+ *   histogram.  The counters are updated without locking:  the rare
+ *   lost increment on preemption is acceptable for health monitoring.
+ *
+ ****************************************************************************/
+
+static inline_function
+void mm_stats_hist(FAR struct mm_heap_s *heap, size_t size)
+{
+  int ndx = 0;
+
+  while ((size >>= 1) != 0 && ndx < MM_HEAP_STATS_NBUCKETS - 1)
+    {
+      ndx++;
+    }
+
+  heap->mm_stats[this_cpu()].hist[ndx]++;
+}
+#endif
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
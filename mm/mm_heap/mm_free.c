@@ -34,6 +34,11 @@
 #include <nuttx/mm/mm.h>
 #include <nuttx/mm/kasan.h>
 #include <nuttx/sched_note.h>
+#if defined(CONFIG_MM_FREE_DEFER) && \
+    (defined(CONFIG_BUILD_FLAT) || defined(__KERNEL__))
+#  include <nuttx/wqueue.h>
+#  define MM_FREE_DEFER 1
+#endif
 
 #include "mm_heap/mm.h"
 
@@ -41,6 +46,22 @@
  * Private Functions
  ****************************************************************************/
 
+#ifdef MM_FREE_DEFER
+/****************************************************************************
+ * Name: mm_defer_worker
+ *
+ * Description:
+ *   Reclaim the deferred frees from the low priority work queue so that
+ *   chunk consolidation runs below every latency-sensitive thread.
+ *
+ ****************************************************************************/
+
+static void mm_defer_worker(FAR void *arg)
+{
+  mm_free_delaylist(arg);
+}
+#endif
+
 static void add_delaylist(FAR struct mm_heap_s *heap, FAR void *mem)
 {
 #if defined(CONFIG_BUILD_FLAT) || defined(__KERNEL__)
@@ -124,6 +145,57 @@ void mm_delayfree(FAR struct mm_heap_s *heap, FAR void *mem, bool delay)
 
   DEBUGASSERT(MM_NODE_IS_ALLOC(node));
 
+#ifdef CONFIG_MM_FASTBINS
+  if (!heap->mm_fastbin_bypass && nodesize <= MM_FASTBIN_MAXSIZE)
+    {
+      int fndx = MM_FASTBIN_NDX(nodesize);
+
+      if (heap->mm_fastcount[fndx] < MM_FASTBIN_DEPTH)
+        {
+          /* Cache the chunk in its size-class bin.  The chunk keeps its
+           * MM_ALLOC_BIT so its physical neighbors see no change and no
+           * merging is needed.
+           */
+
+          node->flink = heap->mm_fastbins[fndx];
+          heap->mm_fastbins[fndx] = node;
+          heap->mm_fastcount[fndx]++;
+          sched_note_heap(NOTE_HEAP_FREE, heap, mem, nodesize,
+                          heap->mm_curused);
+          mm_unlock(heap);
+          return;
+        }
+      else
+        {
+          FAR struct mm_freenode_s *spill = heap->mm_fastbins[fndx];
+
+          /* The bin is full.  Detach the whole bin and spill it back
+           * through the normal free path in one batch so that the cached
+           * chunks can merge with their neighbors again, then free this
+           * chunk normally as well.
+           */
+
+          heap->mm_fastbins[fndx] = NULL;
+          heap->mm_fastcount[fndx] = 0;
+          heap->mm_fastbin_bypass = true;
+          mm_unlock(heap);
+
+          while (spill != NULL)
+            {
+              FAR struct mm_freenode_s *fnode = spill;
+
+              spill = spill->flink;
+              mm_delayfree(heap,
+                           (FAR char *)fnode + MM_SIZEOF_ALLOCNODE, false);
+            }
+
+          mm_delayfree(heap, mem, false);
+          heap->mm_fastbin_bypass = false;
+          return;
+        }
+    }
+#endif
+
   node->size &= ~MM_ALLOC_BIT;
 
   /* Update heap statistics */
@@ -241,5 +313,27 @@ void mm_free(FAR struct mm_heap_s *heap, FAR void *mem)
     }
 #endif
 
+#ifdef MM_FREE_DEFER
+  /* Frees from interrupt handlers and from threads running at or above
+   * the deferral threshold always go to the per-CPU delay list.  The low
+   * priority reclaimer coalesces them later, so these contexts never
+   * pay for chunk consolidation under mm_lock().
+   */
+
+  if (up_interrupt_context() ||
+      this_task()->sched_priority >= CONFIG_MM_FREE_DEFER_PRIORITY)
+    {
+      add_delaylist(heap, mem);
+
+      if (work_available(&heap->mm_defer_work))
+        {
+          work_queue(LPWORK, &heap->mm_defer_work,
+                     mm_defer_worker, heap, 0);
+        }
+
+      return;
+    }
+#endif
+
   mm_delayfree(heap, mem, CONFIG_MM_FREE_DELAYCOUNT_MAX > 0);
 }
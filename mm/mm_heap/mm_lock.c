@@ -94,6 +94,19 @@ int mm_lock(FAR struct mm_heap_s *heap)
     }
   else
     {
+#ifdef CONFIG_MM_HEAP_STATS
+      /* Count acquisitions that could not be satisfied immediately.
+       * Contention events are a cheap proxy for lock wait time that
+       * does not put a clock read on the hot path.
+       */
+
+      if (nxmutex_trylock(&heap->mm_lock) == OK)
+        {
+          return OK;
+        }
+
+      heap->mm_stats[this_cpu()].contended++;
+#endif
       return nxmutex_lock(&heap->mm_lock);
     }
 }
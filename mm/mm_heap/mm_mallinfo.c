@@ -216,3 +216,36 @@ size_t mm_heapfree_largest(FAR struct mm_heap_s *heap)
 
   return 0;
 }
+
+/****************************************************************************
+ * Name: mm_heapstats
+ *
+ * Description:
+ *   Sum the per-CPU allocator health counters of the heap into the
+ *   caller provided structure.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_MM_HEAP_STATS
+void mm_heapstats(FAR struct mm_heap_s *heap,
+                  FAR struct mm_heapstats_s *stats)
+{
+  int cpu;
+  int i;
+
+  memset(stats, 0, sizeof(*stats));
+
+  for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++)
+    {
+      FAR struct mm_heapstats_s *src = &heap->mm_stats[cpu];
+
+      for (i = 0; i < MM_HEAP_STATS_NBUCKETS; i++)
+        {
+          stats->hist[i] += src->hist[i];
+        }
+
+      stats->contended += src->contended;
+      stats->failures  += src->failures;
+    }
+}
+#endif
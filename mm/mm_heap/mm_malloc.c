@@ -210,10 +210,50 @@ FAR void *mm_malloc(FAR struct mm_heap_s *heap, size_t size)
 
   DEBUGASSERT(alignsize >= MM_ALIGN);
 
+#ifdef CONFIG_MM_HEAP_STATS
+  mm_stats_hist(heap, alignsize);
+#endif
+
   /* We need to hold the MM mutex while we muck with the nodelist. */
 
   DEBUGVERIFY(mm_lock(heap));
 
+#ifdef CONFIG_MM_FASTBINS
+  /* Check the fast bin for this size class first.  A cached chunk is
+   * already carved to exactly this size and still marked allocated, so
+   * reusing it is just a pointer pop.
+   */
+
+  if (alignsize <= MM_FASTBIN_MAXSIZE)
+    {
+      int fndx = MM_FASTBIN_NDX(alignsize);
+
+      node = heap->mm_fastbins[fndx];
+      if (node != NULL)
+        {
+          heap->mm_fastbins[fndx] = node->flink;
+          heap->mm_fastcount[fndx]--;
+          mm_unlock(heap);
+
+          DEBUGASSERT(MM_NODE_IS_ALLOC(node) &&
+                      MM_SIZEOF_NODE(node) == alignsize);
+
+          MM_ADD_BACKTRACE(heap, node);
+          ret = (FAR void *)((FAR char *)node + MM_SIZEOF_ALLOCNODE);
+          ret = kasan_unpoison(ret, alignsize - MM_ALLOCNODE_OVERHEAD);
+          sched_note_heap(NOTE_HEAP_ALLOC, heap, ret, alignsize,
+                          heap->mm_curused);
+#ifdef CONFIG_MM_FILL_ALLOCATIONS
+          memset(ret, MM_ALLOC_MAGIC, alignsize - MM_ALLOCNODE_OVERHEAD);
+#endif
+#ifdef CONFIG_DEBUG_MM
+          minfo("Allocated %p, size %zu\n", ret, alignsize);
+#endif
+          return ret;
+        }
+    }
+#endif
+
   /* Convert the request size into a nodelist index */
 
   ndx = mm_size2ndx(alignsize);
@@ -386,6 +426,13 @@ FAR void *mm_malloc(FAR struct mm_heap_s *heap, size_t size)
     }
 #endif
 
+#ifdef CONFIG_MM_HEAP_STATS
+  if (ret == NULL)
+    {
+      heap->mm_stats[this_cpu()].failures++;
+    }
+#endif
+
   DEBUGASSERT(ret == NULL || ((uintptr_t)ret) % MM_ALIGN == 0);
   return ret;
 }
@@ -141,4 +141,21 @@ extern struct shm_info_s g_shminfo;
 
 void shm_destroy(int shmid);
 
+#ifdef CONFIG_MM_SHM_ZERO_POOL
+/****************************************************************************
+ * Name: shm_zeropage_alloc
+ *
+ * Description:
+ *   Return one zeroed physical page, preferably from the background
+ *   pre-zeroed page pool.
+ *
+ * Returned Value:
+ *   The physical address of the zeroed page, or zero on allocation
+ *   failure.
+ *
+ ****************************************************************************/
+
+uintptr_t shm_zeropage_alloc(void);
+#endif
+
 #endif /* __MM_SHM_SHM_H */
@@ -0,0 +1,163 @@
+/****************************************************************************
+ * mm/shm/shm_zeropool.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <string.h>
+
+#include <nuttx/pgalloc.h>
+#include <nuttx/spinlock.h>
+#include <nuttx/wqueue.h>
+
+#include "shm/shm.h"
+
+#ifdef CONFIG_MM_SHM_ZERO_POOL
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* A small stack of physical pages that have already been zeroed by the
+ * low priority work queue, so that shm_extend() can hand out pages
+ * without paying for the memset on the caller's clock.
+ */
+
+static uintptr_t g_zeropool[CONFIG_MM_SHM_ZERO_POOL_NPAGES];
+static unsigned int g_zerocount;
+static spinlock_t g_zerolock = SP_UNLOCKED;
+static struct work_s g_zerowork;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: shm_zeropool_worker
+ *
+ * Description:
+ *   Refill the pre-zeroed page pool.  Runs on the low priority work queue
+ *   so the zeroing happens at close to idle priority.
+ *
+ ****************************************************************************/
+
+static void shm_zeropool_worker(FAR void *arg)
+{
+  irqstate_t flags;
+  uintptr_t page;
+
+  for (; ; )
+    {
+      flags = spin_lock_irqsave(&g_zerolock);
+      if (g_zerocount >= CONFIG_MM_SHM_ZERO_POOL_NPAGES)
+        {
+          spin_unlock_irqrestore(&g_zerolock, flags);
+          return;
+        }
+
+      spin_unlock_irqrestore(&g_zerolock, flags);
+
+      /* Allocate and zero the page outside of the lock */
+
+      page = mm_pgalloc(1);
+      if (page == 0)
+        {
+          return;
+        }
+
+      memset((FAR void *)page, 0, MM_PGSIZE);
+
+      flags = spin_lock_irqsave(&g_zerolock);
+      if (g_zerocount < CONFIG_MM_SHM_ZERO_POOL_NPAGES)
+        {
+          g_zeropool[g_zerocount++] = page;
+          spin_unlock_irqrestore(&g_zerolock, flags);
+        }
+      else
+        {
+          /* The pool filled up behind our back */
+
+          spin_unlock_irqrestore(&g_zerolock, flags);
+          mm_pgfree(page, 1);
+          return;
+        }
+    }
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: shm_zeropage_alloc
+ *
+ * Description:
+ *   Return one zeroed physical page.  The page comes from the pre-zeroed
+ *   pool when one is available; otherwise it is allocated and zeroed
+ *   inline.  In either case a refill of the pool is scheduled.
+ *
+ * Returned Value:
+ *   The physical address of the zeroed page, or zero on allocation
+ *   failure.
+ *
+ ****************************************************************************/
+
+uintptr_t shm_zeropage_alloc(void)
+{
+  irqstate_t flags;
+  uintptr_t page = 0;
+
+  flags = spin_lock_irqsave(&g_zerolock);
+  if (g_zerocount > 0)
+    {
+      page = g_zeropool[--g_zerocount];
+    }
+
+  spin_unlock_irqrestore(&g_zerolock, flags);
+
+  /* Kick the worker to replace whatever was (or will be) taken */
+
+  if (work_available(&g_zerowork))
+    {
+      work_queue(LPWORK, &g_zerowork, shm_zeropool_worker, NULL, 0);
+    }
+
+  if (page != 0)
+    {
+      return page;
+    }
+
+  /* Pool miss:  allocate and zero on the caller's clock */
+
+  page = mm_pgalloc(1);
+  if (page != 0)
+    {
+      memset((FAR void *)page, 0, MM_PGSIZE);
+    }
+
+  return page;
+}
+
+#endif /* CONFIG_MM_SHM_ZERO_POOL */
@@ -179,6 +179,18 @@ static int shm_extend(int shmid, size_t size)
 
   while (pgalloc < pgneeded && pgalloc < CONFIG_ARCH_SHM_NPAGES)
     {
+#ifdef CONFIG_MM_SHM_ZERO_POOL
+      /* Take an already-zeroed page, preferably from the background
+       * pre-zeroed page pool.
+       */
+
+      region->sr_pages[pgalloc] = shm_zeropage_alloc();
+      if (region->sr_pages[pgalloc] == 0)
+        {
+          shmerr("ERROR: shm_zeropage_alloc() failed\n");
+          break;
+        }
+#else
       /* Allocate one more physical page */
 
       region->sr_pages[pgalloc] = mm_pgalloc(1);
@@ -191,6 +203,7 @@ static int shm_extend(int shmid, size_t size)
       /* Zero the allocated page. */
 
       memset((FAR void *)region->sr_pages[pgalloc], 0, MM_PGSIZE);
+#endif
 
       /* Increment the number of pages successfully allocated */
 
@@ -165,6 +165,9 @@ struct arp_entry_s
   struct ether_addr        at_ethaddr;  /* Hardware address */
   clock_t                  at_time;     /* Time of last usage */
   FAR struct net_driver_s *at_dev;      /* The device driver structure */
+#ifdef CONFIG_NET_ARP_HASH
+  FAR struct arp_entry_s  *at_hashnext; /* Bucket chain for hashed lookup */
+#endif
 };
 
 /****************************************************************************
@@ -91,6 +91,12 @@ struct arp_table_info_s
 
 static struct arp_entry_s g_arptable[CONFIG_NET_ARPTAB_SIZE];
 
+#ifdef CONFIG_NET_ARP_HASH
+/* Chained hash index over g_arptable, keyed by the entry IP address */
+
+static FAR struct arp_entry_s *g_arp_hashtab[CONFIG_NET_ARP_HASH_SIZE];
+#endif
+
 static const struct ether_addr g_zero_ethaddr =
 {
   {
@@ -148,6 +154,67 @@ static int arp_match(FAR struct net_driver_s *dev, FAR void *arg)
   return 1;
 }
 
+#ifdef CONFIG_NET_ARP_HASH
+/****************************************************************************
+ * Name: arp_hashndx
+ *
+ * Description:
+ *   Compute the hash bucket index for the given IP address.
+ *
+ ****************************************************************************/
+
+static int arp_hashndx(in_addr_t ipaddr)
+{
+  uint32_t key = NTOHL(ipaddr);
+
+  key ^= key >> 16;
+  return key % CONFIG_NET_ARP_HASH_SIZE;
+}
+
+/****************************************************************************
+ * Name: arp_hash_insert
+ *
+ * Description:
+ *   Insert the table entry into the hash index, keyed by its current IP
+ *   address.
+ *
+ ****************************************************************************/
+
+static void arp_hash_insert(FAR struct arp_entry_s *entry)
+{
+  int ndx = arp_hashndx(entry->at_ipaddr);
+
+  entry->at_hashnext = g_arp_hashtab[ndx];
+  g_arp_hashtab[ndx] = entry;
+}
+
+/****************************************************************************
+ * Name: arp_hash_remove
+ *
+ * Description:
+ *   Remove the table entry from the hash index.  Harmless if the entry is
+ *   not currently indexed.
+ *
+ ****************************************************************************/
+
+static void arp_hash_remove(FAR struct arp_entry_s *entry)
+{
+  FAR struct arp_entry_s **prev;
+
+  for (prev = &g_arp_hashtab[arp_hashndx(entry->at_ipaddr)];
+       *prev != NULL;
+       prev = &(*prev)->at_hashnext)
+    {
+      if (*prev == entry)
+        {
+          *prev = entry->at_hashnext;
+          entry->at_hashnext = NULL;
+          return;
+        }
+    }
+}
+#endif /* CONFIG_NET_ARP_HASH */
+
 /****************************************************************************
  * Name: arp_return_old_entry
  *
@@ -197,10 +264,27 @@ static FAR struct arp_entry_s *arp_lookup(in_addr_t ipaddr,
                                           FAR struct net_driver_s *dev)
 {
   FAR struct arp_entry_s *tabptr;
+#ifndef CONFIG_NET_ARP_HASH
   int i;
+#endif
 
   /* Check if the IPv4 address is already in the ARP table. */
 
+#ifdef CONFIG_NET_ARP_HASH
+  /* Only the entries in the bucket of this IP address can match. */
+
+  for (tabptr = g_arp_hashtab[arp_hashndx(ipaddr)];
+       tabptr != NULL;
+       tabptr = tabptr->at_hashnext)
+    {
+      if (tabptr->at_dev == dev &&
+          net_ipv4addr_cmp(ipaddr, tabptr->at_ipaddr) &&
+          clock_systime_ticks() - tabptr->at_time <= ARP_MAXAGE_TICK)
+        {
+          return tabptr;
+        }
+    }
+#else
   for (i = 0; i < CONFIG_NET_ARPTAB_SIZE; ++i)
     {
       tabptr = &g_arptable[i];
@@ -211,6 +295,7 @@ static FAR struct arp_entry_s *arp_lookup(in_addr_t ipaddr,
           return tabptr;
         }
     }
+#endif
 
   /* Not found */
 
@@ -339,11 +424,24 @@ int arp_update(FAR struct net_driver_s *dev, in_addr_t ipaddr,
    * information.
    */
 
+#ifdef CONFIG_NET_ARP_HASH
+  /* Unhash the entry before rewriting it; its key may change */
+
+  if (tabptr->at_ipaddr != 0)
+    {
+      arp_hash_remove(tabptr);
+    }
+#endif
+
   tabptr->at_ipaddr = ipaddr;
   memcpy(tabptr->at_ethaddr.ether_addr_octet, ethaddr, ETHER_ADDR_LEN);
   tabptr->at_dev = dev;
   tabptr->at_time = clock_systime_ticks();
 
+#ifdef CONFIG_NET_ARP_HASH
+  arp_hash_insert(tabptr);
+#endif
+
   /* Notify the new entry */
 
 #ifdef CONFIG_NETLINK_ROUTE
@@ -498,6 +596,9 @@ int arp_delete(in_addr_t ipaddr, FAR struct net_driver_s *dev)
 
       /* Yes.. Set the IP address to zero to "delete" it */
 
+#ifdef CONFIG_NET_ARP_HASH
+      arp_hash_remove(tabptr);
+#endif
       tabptr->at_ipaddr = 0;
       return OK;
     }
@@ -527,6 +628,9 @@ void arp_cleanup(FAR struct net_driver_s *dev)
     {
       if (dev == g_arptable[i].at_dev)
         {
+#ifdef CONFIG_NET_ARP_HASH
+          arp_hash_remove(&g_arptable[i]);
+#endif
           memset(&g_arptable[i], 0, sizeof(g_arptable[i]));
         }
     }
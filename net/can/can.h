@@ -208,6 +208,28 @@ FAR struct can_conn_s *can_nextconn(FAR struct can_conn_s *conn);
 FAR struct can_conn_s *can_active(FAR struct net_driver_s *dev,
                                   FAR struct can_conn_s *conn);
 
+/****************************************************************************
+ * Name: can_recv_filter()
+ *
+ * Description:
+ *   Evaluate the receive filter table of a connection against a CAN ID.
+ *
+ * Input Parameters:
+ *   conn - The CAN connection whose filters are evaluated
+ *   id   - The CAN ID of the frame, including the flag bits
+ *
+ * Returned Value:
+ *   1 if the connection accepts the frame, 0 if it is filtered out.
+ *
+ * Assumptions:
+ *   This function is called from network logic with the network locked.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_CANPROTO_OPTIONS
+int can_recv_filter(FAR struct can_conn_s *conn, canid_t id);
+#endif
+
 /****************************************************************************
  * Name: can_callback
  *
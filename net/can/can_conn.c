@@ -257,4 +257,61 @@ FAR struct can_conn_s *can_active(FAR struct net_driver_s *dev,
   return conn;
 }
 
+/****************************************************************************
+ * Name: can_recv_filter()
+ *
+ * Description:
+ *   Evaluate the receive filter table of a connection against a CAN ID.
+ *
+ * Input Parameters:
+ *   conn - The CAN connection whose filters are evaluated
+ *   id   - The CAN ID of the frame, including the flag bits
+ *
+ * Returned Value:
+ *   1 if the connection accepts the frame, 0 if it is filtered out.
+ *
+ * Assumptions:
+ *   This function is called from network logic with the network locked.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_CANPROTO_OPTIONS
+int can_recv_filter(FAR struct can_conn_s *conn, canid_t id)
+{
+  uint32_t i;
+
+#ifdef CONFIG_NET_CAN_ERRORS
+  /* error message frame */
+
+  if ((id & CAN_ERR_FLAG) != 0)
+    {
+      return id & conn->err_mask ? 1 : 0;
+    }
+#endif
+
+  for (i = 0; i < conn->filter_count; i++)
+    {
+      if (conn->filters[i].can_id & CAN_INV_FILTER)
+        {
+          if ((id & conn->filters[i].can_mask) !=
+                ((conn->filters[i].can_id & ~CAN_INV_FILTER) &
+                 conn->filters[i].can_mask))
+            {
+              return 1;
+            }
+        }
+      else
+        {
+          if ((id & conn->filters[i].can_mask) ==
+                (conn->filters[i].can_id & conn->filters[i].can_mask))
+            {
+              return 1;
+            }
+        }
+    }
+
+  return 0;
+}
+#endif
+
 #endif /* CONFIG_NET_CAN */
@@ -29,6 +29,7 @@
 
 #include <errno.h>
 #include <debug.h>
+#include <string.h>
 
 #include <nuttx/net/netdev.h>
 #include <nuttx/net/can.h>
@@ -193,6 +194,46 @@ static int can_input_conn(FAR struct net_driver_s *dev,
  * Public Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: can_in_match
+ *
+ * Description:
+ *   Traverse the list of CAN connections bound to dev, returning only
+ *   those whose receive filter table accepts the given CAN ID.  Frames
+ *   are matched against the filters here, on the input path, so that no
+ *   clone is made and no read-ahead buffer is consumed for a socket that
+ *   would only discard the frame at receive time.
+ *
+ * Input Parameters:
+ *   dev    - The device to search for.
+ *   conn   - The current connection; may be NULL to start the search at
+ *            the beginning
+ *   can_id - The CAN ID of the received frame, including the flag bits
+ *
+ * Assumptions:
+ *   This function can be called from an interrupt.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_CANPROTO_OPTIONS
+static FAR struct can_conn_s *can_in_match(FAR struct net_driver_s *dev,
+                                           FAR struct can_conn_s *conn,
+                                           canid_t can_id)
+{
+  while ((conn = can_active(dev, conn)) != NULL)
+    {
+      if (can_recv_filter(conn, can_id) != 0)
+        {
+          break;
+        }
+    }
+
+  return conn;
+}
+#else
+#  define can_in_match(dev,conn,can_id) can_active(dev, conn)
+#endif
+
 /****************************************************************************
  * Name: can_in
  *
@@ -215,12 +256,33 @@ static int can_input_conn(FAR struct net_driver_s *dev,
 
 static int can_in(FAR struct net_driver_s *dev)
 {
-  FAR struct can_conn_s *conn = can_active(dev, NULL);
+  FAR struct can_conn_s *conn;
   FAR struct can_conn_s *nextconn;
+#ifdef CONFIG_NET_CANPROTO_OPTIONS
+  canid_t can_id;
+
+  memcpy(&can_id, dev->d_buf, sizeof(canid_t));
+
+  /* Find the first connection whose receive filters accept this frame */
+
+  conn = can_in_match(dev, NULL, can_id);
+  if (conn == NULL && can_active(dev, NULL) != NULL)
+    {
+      /* There are sockets bound to this device but all of them filter
+       * the frame out; drop it here without cloning or queueing it.
+       */
+
+      netdev_iob_release(dev);
+      dev->d_len = 0;
+      return OK;
+    }
+#else
+  conn = can_active(dev, NULL);
+#endif
 
   /* Do we have second connection that can hold this packet? */
 
-  while ((nextconn = can_active(dev, conn)) != NULL)
+  while ((nextconn = can_in_match(dev, conn, can_id)) != NULL)
     {
       /* Yes... There are multiple listeners on the same dev.
        * We need to clone the packet and deliver it to each listener.
@@ -74,10 +74,6 @@ struct can_recvfrom_s
  * Private Functions
  ****************************************************************************/
 
-#ifdef CONFIG_NET_CANPROTO_OPTIONS
-static int can_recv_filter(FAR struct can_conn_s *conn, canid_t id);
-#endif
-
 /****************************************************************************
  * Name: can_add_recvlen
  *
@@ -230,13 +226,15 @@ static inline int can_readahead(struct can_recvfrom_s *pstate)
   int recvlen;
 
   /* Check there is any CAN data already buffered in a read-ahead
-   * buffer.
+   * buffer.  Frames rejected by the receive filters are drained in one
+   * pass so that a buffered matching frame behind them is still
+   * delivered without another wakeup.
    */
 
   pstate->pr_recvlen = -1;
 
-  if ((iob = iob_peek_queue(&conn->readahead)) != NULL &&
-      pstate->pr_buflen > 0)
+  while ((iob = iob_peek_queue(&conn->readahead)) != NULL &&
+         pstate->pr_buflen > 0)
     {
       DEBUGASSERT(iob->io_pktlen > 0);
 
@@ -258,10 +256,10 @@ static inline int can_readahead(struct can_recvfrom_s *pstate)
           DEBUGASSERT(tmp == iob);
           UNUSED(tmp);
 
-          /* And free the I/O buffer chain */
+          /* Free the I/O buffer chain and try the next buffered frame */
 
           iob_free_chain(iob);
-          return 0;
+          continue;
         }
 #endif
 
@@ -328,45 +326,6 @@ static inline int can_readahead(struct can_recvfrom_s *pstate)
   return 0;
 }
 
-#ifdef CONFIG_NET_CANPROTO_OPTIONS
-static int can_recv_filter(FAR struct can_conn_s *conn, canid_t id)
-{
-  uint32_t i;
-
-#ifdef CONFIG_NET_CAN_ERRORS
-  /* error message frame */
-
-  if ((id & CAN_ERR_FLAG) != 0)
-    {
-      return id & conn->err_mask ? 1 : 0;
-    }
-#endif
-
-  for (i = 0; i < conn->filter_count; i++)
-    {
-      if (conn->filters[i].can_id & CAN_INV_FILTER)
-        {
-          if ((id & conn->filters[i].can_mask) !=
-                ((conn->filters[i].can_id & ~CAN_INV_FILTER) &
-                 conn->filters[i].can_mask))
-            {
-              return 1;
-            }
-        }
-      else
-        {
-          if ((id & conn->filters[i].can_mask) ==
-                (conn->filters[i].can_id & conn->filters[i].can_mask))
-            {
-              return 1;
-            }
-        }
-    }
-
-  return 0;
-}
-#endif
-
 static uint16_t can_recvfrom_eventhandler(FAR struct net_driver_s *dev,
                                           FAR void *pvpriv, uint16_t flags)
 {
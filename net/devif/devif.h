@@ -608,6 +608,39 @@ int devif_loopback(FAR struct net_driver_s *dev);
 int netdev_input(FAR struct net_driver_s *dev,
                  devif_poll_callback_t callback, bool reply);
 
+/****************************************************************************
+ * Name: devif_input_queue
+ *
+ * Description:
+ *   Feed a whole queue of received packets into the network stack under a
+ *   single acquisition of the network lock.  Each entry of 'inq' is one
+ *   packet (an IOB chain prepared with the L2 guard as offset, as for
+ *   netdev_iob_replace()).  Responses generated by the stack are appended
+ *   to 'replyq' instead of being transmitted from within the loop; the
+ *   caller must transmit and free them after this function returns.
+ *
+ * Input Parameters:
+ *   dev      - The device on which the packets were received
+ *   inq      - Queue of received packets; consumed by this function
+ *   callback - Input callback of the L3/L2 stack, e.g. ipv4_input
+ *   replyq   - Queue that receives the response packets
+ *
+ * Returned Value:
+ *   The number of packets processed.
+ *
+ * Assumptions:
+ *   Called from the driver's work queue or dedicated thread with the
+ *   network unlocked.
+ *
+ ****************************************************************************/
+
+#if CONFIG_IOB_NCHAINS > 0
+int devif_input_queue(FAR struct net_driver_s *dev,
+                      FAR struct iob_queue_s *inq,
+                      devif_poll_callback_t callback,
+                      FAR struct iob_queue_s *replyq);
+#endif
+
 /****************************************************************************
  * Name: devif_get_mtu
  *
@@ -32,11 +32,32 @@
 #include <errno.h>
 
 #include <nuttx/fs/fs.h>
+#include <nuttx/fs/ioctl.h>
 #include <nuttx/mm/iob.h>
 #include <nuttx/net/netdev.h>
 
 #ifdef CONFIG_MM_IOB
 
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_SENDFILE_ZEROCOPY
+/****************************************************************************
+ * Name: devif_extent_free
+ *
+ * Description:
+ *   Free callback for I/O buffers that reference file extents in
+ *   directly addressable storage.  The storage is owned by the file
+ *   system, so there is nothing to release here.
+ *
+ ****************************************************************************/
+
+static void devif_extent_free(FAR void *data)
+{
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -61,6 +82,9 @@ int devif_file_send(FAR struct net_driver_s *dev, FAR struct file *file,
                     unsigned int target_offset)
 {
   FAR struct iob_s *iob;
+#ifdef CONFIG_NET_SENDFILE_ZEROCOPY
+  uintptr_t xipbase;
+#endif
   unsigned int copyin;
   unsigned int remain;
   int ret;
@@ -96,6 +120,32 @@ int devif_file_send(FAR struct net_driver_s *dev, FAR struct file *file,
 
   iob_update_pktlen(dev->d_iob, target_offset, false);
 
+#ifdef CONFIG_NET_SENDFILE_ZEROCOPY
+  /* Zero-copy path:  if the file contents are directly addressable in
+   * memory (execute-in-place storage such as ROMFS on memory-mapped
+   * flash), link the extent into the TX chain instead of copying it
+   * segment by segment.  File systems whose buffers are not stable
+   * fail the ioctl and take the copying path below.
+   */
+
+  if (file_ioctl(file, FIOC_XIPBASE, &xipbase) == OK)
+    {
+      FAR struct iob_s *ext;
+
+      ext = iob_alloc_with_data((FAR uint8_t *)xipbase + offset, len,
+                                devif_extent_free);
+      if (ext != NULL)
+        {
+          ext->io_len    = len;
+          ext->io_pktlen = len;
+          iob_concat(dev->d_iob, ext);
+
+          dev->d_sndlen = len;
+          return len;
+        }
+    }
+#endif
+
   ret = file_seek(file, offset, SEEK_SET);
   if (ret < 0)
     {
@@ -0,0 +1,119 @@
+/****************************************************************************
+ * net/devif/devif_input.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <debug.h>
+
+#include <nuttx/mm/iob.h>
+#include <nuttx/net/net.h>
+#include <nuttx/net/netdev.h>
+
+#include "devif/devif.h"
+
+#if CONFIG_IOB_NCHAINS > 0
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: devif_input_queue
+ *
+ * Description:
+ *   Feed a whole queue of received packets into the network stack under a
+ *   single acquisition of the network lock.  Each entry of 'inq' is one
+ *   packet (an IOB chain prepared with the L2 guard as offset, as for
+ *   netdev_iob_replace()).  Responses generated by the stack (ACKs, ARP
+ *   replies, etc.) are not transmitted from within the loop; they are
+ *   appended to 'replyq' and transmission is left to the caller after
+ *   this function returns, so no packet pays the locking overhead of its
+ *   predecessor's reply.
+ *
+ * Input Parameters:
+ *   dev      - The device on which the packets were received
+ *   inq      - Queue of received packets; consumed by this function
+ *   callback - Input callback of the L3/L2 stack, e.g. ipv4_input
+ *   replyq   - Queue that receives the response packets.  The caller
+ *              must transmit and free these after the call.
+ *
+ * Returned Value:
+ *   The number of packets processed.
+ *
+ * Assumptions:
+ *   Called from the driver's work queue or dedicated thread with the
+ *   network unlocked.
+ *
+ ****************************************************************************/
+
+int devif_input_queue(FAR struct net_driver_s *dev,
+                      FAR struct iob_queue_s *inq,
+                      devif_poll_callback_t callback,
+                      FAR struct iob_queue_s *replyq)
+{
+  FAR struct iob_s *pkt;
+  int npackets = 0;
+
+  net_lock();
+
+  while ((pkt = iob_remove_queue(inq)) != NULL)
+    {
+      /* Hand the packet to the stack through the d_iob interface.  Any
+       * buffer left over from the previous iteration is released here.
+       */
+
+      netdev_iob_replace(dev, pkt);
+
+      callback(dev);
+      npackets++;
+
+      /* If the input resulted in data that should be sent out on the
+       * network, the field d_len is set to a value > 0.  Defer the
+       * transmission by moving the buffer to the reply queue.
+       */
+
+      if (dev->d_iob != NULL && dev->d_len > 0)
+        {
+          if (iob_tryadd_queue(dev->d_iob, replyq) >= 0)
+            {
+              netdev_iob_clear(dev);
+            }
+          else
+            {
+              nwarn("WARNING: Failed to queue reply packet, dropping\n");
+            }
+        }
+    }
+
+  /* Release the buffer of the last packet (if it produced no reply) */
+
+  netdev_iob_release(dev);
+
+  net_unlock();
+  return npackets;
+}
+
+#endif /* CONFIG_IOB_NCHAINS > 0 */
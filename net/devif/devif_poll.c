@@ -30,6 +30,7 @@
 #include <debug.h>
 
 #include <nuttx/clock.h>
+#include <nuttx/nuttx.h>
 #include <nuttx/net/netconfig.h>
 #include <nuttx/net/netdev.h>
 #include <nuttx/net/net.h>
@@ -631,6 +632,82 @@ static int devif_poll_udp_connections(FAR struct net_driver_s *dev,
  ****************************************************************************/
 
 #ifdef NET_TCP_HAVE_STACK
+#ifdef CONFIG_NET_TCP_TXREADYQ
+static inline int devif_poll_tcp_connections(FAR struct net_driver_s *dev,
+                                             devif_poll_callback_t callback)
+{
+  FAR struct tcp_conn_s *conn;
+  FAR sq_entry_t *node;
+  sq_queue_t pending;
+#if CONFIG_NET_TCP_TXREADYQ_BUDGET > 0
+  int budget = CONFIG_NET_TCP_TXREADYQ_BUDGET;
+#endif
+  int bstop = 0;
+
+  /* Detach the device's TX-ready queue.  Connections that become ready
+   * while we are draining (or that still have more to send afterward) are
+   * added back to dev->d_txready and serviced on the next poll pass.
+   */
+
+  sq_move(&dev->d_txready, &pending);
+
+  while (!bstop && (node = sq_remfirst(&pending)) != NULL)
+    {
+      conn = container_of(node, struct tcp_conn_s, tx_node);
+      conn->tx_ready = false;
+
+      /* Skip TCP connections that were rebound to another device */
+
+      if (dev == conn->dev)
+        {
+          /* Perform the TCP TX poll */
+
+          tcp_poll(dev, conn);
+
+#if CONFIG_NET_TCP_TXREADYQ_BUDGET > 0
+          /* Charge any outgoing packet against the drain budget */
+
+          budget -= dev->d_len;
+#endif
+
+          /* Perform any necessary conversions on outgoing packets */
+
+          devif_packet_conversion(dev, DEVIF_TCP);
+
+          /* Call back into the driver */
+
+          bstop = devif_poll_local_out(dev, callback);
+        }
+
+      /* Keep the connection queued while it still has TX work pending */
+
+      if (tcp_txready_pending(conn))
+        {
+          tcp_txready(conn);
+        }
+
+#if CONFIG_NET_TCP_TXREADYQ_BUDGET > 0
+      if (budget <= 0)
+        {
+          break;
+        }
+#endif
+    }
+
+  /* Return any connections that we did not get to back to the device
+   * queue, preserving their order.
+   */
+
+  while ((node = sq_remfirst(&pending)) != NULL)
+    {
+      conn = container_of(node, struct tcp_conn_s, tx_node);
+      conn->tx_ready = false;
+      tcp_txready(conn);
+    }
+
+  return bstop;
+}
+#else
 static inline int devif_poll_tcp_connections(FAR struct net_driver_s *dev,
                                              devif_poll_callback_t callback)
 {
@@ -661,6 +738,7 @@ static inline int devif_poll_tcp_connections(FAR struct net_driver_s *dev,
 
   return bstop;
 }
+#endif /* CONFIG_NET_TCP_TXREADYQ */
 #else
 #  define devif_poll_tcp_connections(dev, callback) (0)
 #endif
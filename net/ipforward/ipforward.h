@@ -326,6 +326,87 @@ int ipv4_forward(FAR struct net_driver_s *dev, FAR struct ipv4_hdr_s *ipv4);
 int ipv6_forward(FAR struct net_driver_s *dev, FAR struct ipv6_hdr_s *ipv6);
 #endif
 
+/****************************************************************************
+ * Name: ipv4_flowcache_lookup
+ *
+ * Description:
+ *   Look up the device that packets of the given flow are forwarded on.
+ *
+ * Input Parameters:
+ *   srcipaddr  - Source IP address of the flow
+ *   destipaddr - Destination IP address of the flow
+ *   proto      - L4 protocol number
+ *   srcport    - Source port in network byte order (zero if none)
+ *   destport   - Destination port in network byte order (zero if none)
+ *
+ * Returned Value:
+ *   The cached forwarding device, or NULL if there is no valid entry for
+ *   this flow.
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_IPFORWARD_FLOWCACHE
+FAR struct net_driver_s *
+ipv4_flowcache_lookup(in_addr_t srcipaddr, in_addr_t destipaddr,
+                      uint8_t proto, uint16_t srcport, uint16_t destport);
+#endif
+
+/****************************************************************************
+ * Name: ipv4_flowcache_add
+ *
+ * Description:
+ *   Remember the forwarding device selected for the given flow.
+ *
+ * Input Parameters:
+ *   srcipaddr  - Source IP address of the flow
+ *   destipaddr - Destination IP address of the flow
+ *   proto      - L4 protocol number
+ *   srcport    - Source port in network byte order (zero if none)
+ *   destport   - Destination port in network byte order (zero if none)
+ *   fwddev     - The device that this flow is forwarded on
+ *
+ * Returned Value:
+ *   None
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_IPFORWARD_FLOWCACHE
+void ipv4_flowcache_add(in_addr_t srcipaddr, in_addr_t destipaddr,
+                        uint8_t proto, uint16_t srcport, uint16_t destport,
+                        FAR struct net_driver_s *fwddev);
+#endif
+
+/****************************************************************************
+ * Name: ipfwd_flowcache_flush
+ *
+ * Description:
+ *   Remove all flow cache entries that forward on the given device, or
+ *   all entries if dev is NULL.  Called when a device goes down so that
+ *   no forwarding decision outlives its output device.
+ *
+ * Input Parameters:
+ *   dev - The device whose entries are removed, or NULL for all devices
+ *
+ * Returned Value:
+ *   None
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_IPFORWARD_FLOWCACHE
+void ipfwd_flowcache_flush(FAR struct net_driver_s *dev);
+#else
+#  define ipfwd_flowcache_flush(dev)
+#endif
+
 /****************************************************************************
  * Name: ipv6_dropstats
  *
@@ -0,0 +1,244 @@
+/****************************************************************************
+ * net/ipforward/ipfwd_flowcache.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <string.h>
+#include <debug.h>
+
+#include <net/if.h>
+
+#include <nuttx/clock.h>
+#include <nuttx/net/net.h>
+#include <nuttx/net/netdev.h>
+
+#include "ipforward/ipforward.h"
+
+#ifdef CONFIG_NET_IPFORWARD_FLOWCACHE
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* An entry becomes stale this long after its last use.  Expiry bounds how
+ * long a forwarding decision may outlive a routing table change.
+ */
+
+#define FLOWCACHE_LIFETIME_TICKS \
+  SEC2TICK(CONFIG_NET_IPFORWARD_FLOWCACHE_EXPIRE)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* One cached forwarding decision:  The 5-tuple identifying the flow and
+ * the device that packets of this flow are forwarded on.  An entry with a
+ * NULL device pointer is free.
+ */
+
+struct ipfwd_flowcache_entry_s
+{
+  FAR struct net_driver_s *fe_dev;        /* Forwarding device */
+  in_addr_t                fe_srcipaddr;  /* Source IP address */
+  in_addr_t                fe_destipaddr; /* Destination IP address */
+  uint16_t                 fe_srcport;    /* Source port (network order) */
+  uint16_t                 fe_destport;   /* Destination port (network order) */
+  uint8_t                  fe_proto;      /* L4 protocol number */
+  clock_t                  fe_tick;       /* Tick count of the last use */
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* The flow cache table.  Mutually exclusive access is assured by the
+ * network lock held by all callers.
+ */
+
+static struct ipfwd_flowcache_entry_s
+  g_flowcache[CONFIG_NET_IPFORWARD_FLOWCACHE_ENTRIES];
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: ipv4_flowcache_lookup
+ *
+ * Description:
+ *   Look up the device that packets of the given flow are forwarded on.
+ *   Expired entries and entries whose device has gone down are
+ *   invalidated on the way.
+ *
+ * Input Parameters:
+ *   srcipaddr  - Source IP address of the flow
+ *   destipaddr - Destination IP address of the flow
+ *   proto      - L4 protocol number
+ *   srcport    - Source port in network byte order (zero if none)
+ *   destport   - Destination port in network byte order (zero if none)
+ *
+ * Returned Value:
+ *   The cached forwarding device, or NULL if there is no valid entry for
+ *   this flow.
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+FAR struct net_driver_s *
+ipv4_flowcache_lookup(in_addr_t srcipaddr, in_addr_t destipaddr,
+                      uint8_t proto, uint16_t srcport, uint16_t destport)
+{
+  FAR struct ipfwd_flowcache_entry_s *entry;
+  clock_t now = clock_systime_ticks();
+  int i;
+
+  for (i = 0; i < CONFIG_NET_IPFORWARD_FLOWCACHE_ENTRIES; i++)
+    {
+      entry = &g_flowcache[i];
+
+      if (entry->fe_dev != NULL &&
+          entry->fe_srcipaddr == srcipaddr &&
+          entry->fe_destipaddr == destipaddr &&
+          entry->fe_proto == proto &&
+          entry->fe_srcport == srcport &&
+          entry->fe_destport == destport)
+        {
+          /* Drop the entry if it has not been used for too long or if
+           * its device is no longer usable.
+           */
+
+          if (now - entry->fe_tick >= FLOWCACHE_LIFETIME_TICKS ||
+              !IFF_IS_UP(entry->fe_dev->d_flags))
+            {
+              entry->fe_dev = NULL;
+              return NULL;
+            }
+
+          /* Refresh the entry and report the hit */
+
+          entry->fe_tick = now;
+          return entry->fe_dev;
+        }
+    }
+
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: ipv4_flowcache_add
+ *
+ * Description:
+ *   Remember the forwarding device selected for the given flow.  A free
+ *   entry is used if there is one, otherwise the least recently used
+ *   entry is evicted.
+ *
+ * Input Parameters:
+ *   srcipaddr  - Source IP address of the flow
+ *   destipaddr - Destination IP address of the flow
+ *   proto      - L4 protocol number
+ *   srcport    - Source port in network byte order (zero if none)
+ *   destport   - Destination port in network byte order (zero if none)
+ *   fwddev     - The device that this flow is forwarded on
+ *
+ * Returned Value:
+ *   None
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+void ipv4_flowcache_add(in_addr_t srcipaddr, in_addr_t destipaddr,
+                        uint8_t proto, uint16_t srcport, uint16_t destport,
+                        FAR struct net_driver_s *fwddev)
+{
+  FAR struct ipfwd_flowcache_entry_s *victim = &g_flowcache[0];
+  FAR struct ipfwd_flowcache_entry_s *entry;
+  int i;
+
+  for (i = 0; i < CONFIG_NET_IPFORWARD_FLOWCACHE_ENTRIES; i++)
+    {
+      entry = &g_flowcache[i];
+
+      if (entry->fe_dev == NULL)
+        {
+          /* A free entry beats any eviction candidate */
+
+          victim = entry;
+          break;
+        }
+
+      if (entry->fe_tick < victim->fe_tick)
+        {
+          victim = entry;
+        }
+    }
+
+  victim->fe_dev        = fwddev;
+  victim->fe_srcipaddr  = srcipaddr;
+  victim->fe_destipaddr = destipaddr;
+  victim->fe_srcport    = srcport;
+  victim->fe_destport   = destport;
+  victim->fe_proto      = proto;
+  victim->fe_tick       = clock_systime_ticks();
+}
+
+/****************************************************************************
+ * Name: ipfwd_flowcache_flush
+ *
+ * Description:
+ *   Remove all flow cache entries that forward on the given device, or
+ *   all entries if dev is NULL.  Called when a device goes down so that
+ *   no forwarding decision outlives its output device.
+ *
+ * Input Parameters:
+ *   dev - The device whose entries are removed, or NULL for all devices
+ *
+ * Returned Value:
+ *   None
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+void ipfwd_flowcache_flush(FAR struct net_driver_s *dev)
+{
+  int i;
+
+  for (i = 0; i < CONFIG_NET_IPFORWARD_FLOWCACHE_ENTRIES; i++)
+    {
+      if (dev == NULL || g_flowcache[i].fe_dev == dev)
+        {
+          g_flowcache[i].fe_dev = NULL;
+        }
+    }
+}
+
+#endif /* CONFIG_NET_IPFORWARD_FLOWCACHE */
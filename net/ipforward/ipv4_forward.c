@@ -35,6 +35,7 @@
 #include <nuttx/net/net.h>
 #include <nuttx/net/netdev.h>
 #include <nuttx/net/netstats.h>
+#include <nuttx/net/udp.h>
 
 #include "netdev/netdev.h"
 #include "utils/utils.h"
@@ -117,6 +118,55 @@ static int ipv4_hdrsize(FAR struct ipv4_hdr_s *ipv4)
 }
 #endif
 
+/****************************************************************************
+ * Name: ipv4_flowcache_getports
+ *
+ * Description:
+ *   Extract the L4 port pair used to key the forwarding flow cache.  Only
+ *   TCP and UDP carry ports and only the first fragment of a datagram
+ *   carries the L4 header; in all other cases the ports are left zero so
+ *   that such packets still form valid (if coarser) flow keys.
+ *
+ * Input Parameters:
+ *   ipv4     - A pointer to the IPv4 header in within the IPv4 packet.
+ *   srcport  - Location to return the source port (network byte order)
+ *   destport - Location to return the destination port (network byte order)
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_IPFORWARD_FLOWCACHE
+static void ipv4_flowcache_getports(FAR struct ipv4_hdr_s *ipv4,
+                                    FAR uint16_t *srcport,
+                                    FAR uint16_t *destport)
+{
+  FAR struct udp_hdr_s *l4;
+  uint16_t iphdrlen;
+
+  *srcport  = 0;
+  *destport = 0;
+
+  /* A non-zero fragment offset means that there is no L4 header to read */
+
+  if ((ipv4->ipoffset[0] & 0x1f) != 0 || ipv4->ipoffset[1] != 0)
+    {
+      return;
+    }
+
+  if (ipv4->proto == IP_PROTO_TCP || ipv4->proto == IP_PROTO_UDP)
+    {
+      /* Both the TCP and the UDP header begin with the port pair */
+
+      iphdrlen  = (ipv4->vhl & IPv4_HLMASK) << 2;
+      l4        = (FAR struct udp_hdr_s *)((FAR uint8_t *)ipv4 + iphdrlen);
+      *srcport  = l4->srcport;
+      *destport = l4->destport;
+    }
+}
+#endif
+
 /****************************************************************************
  * Name: ipv4_decr_ttl
  *
@@ -459,6 +509,10 @@ int ipv4_forward(FAR struct net_driver_s *dev, FAR struct ipv4_hdr_s *ipv4)
   in_addr_t srcipaddr;
   FAR struct net_driver_s *fwddev;
   int ret;
+#ifdef CONFIG_NET_IPFORWARD_FLOWCACHE
+  uint16_t srcport;
+  uint16_t destport;
+#endif
 #if defined(CONFIG_NET_ICMP) && !defined(CONFIG_NET_ICMP_NO_STACK)
   int icmp_reply_type;
   int icmp_reply_code;
@@ -469,12 +523,37 @@ int ipv4_forward(FAR struct net_driver_s *dev, FAR struct ipv4_hdr_s *ipv4)
   destipaddr = net_ip4addr_conv32(ipv4->destipaddr);
   srcipaddr  = net_ip4addr_conv32(ipv4->srcipaddr);
 
-  fwddev     = netdev_findby_ripv4addr(srcipaddr, destipaddr);
+#ifdef CONFIG_NET_IPFORWARD_FLOWCACHE
+  /* Consult the forwarding flow cache before performing the full routing
+   * lookup; packets of established flows hit here.
+   */
+
+  ipv4_flowcache_getports(ipv4, &srcport, &destport);
+
+  fwddev = ipv4_flowcache_lookup(srcipaddr, destipaddr, ipv4->proto,
+                                 srcport, destport);
   if (fwddev == NULL)
+#endif
     {
-      nwarn("WARNING: Not routable\n");
-      ret = -ENETUNREACH;
-      goto drop;
+      fwddev = netdev_findby_ripv4addr(srcipaddr, destipaddr);
+      if (fwddev == NULL)
+        {
+          nwarn("WARNING: Not routable\n");
+          ret = -ENETUNREACH;
+          goto drop;
+        }
+
+#ifdef CONFIG_NET_IPFORWARD_FLOWCACHE
+      /* Remember the routing decision for the following packets of this
+       * flow.
+       */
+
+      if (fwddev != dev)
+        {
+          ipv4_flowcache_add(srcipaddr, destipaddr, ipv4->proto,
+                             srcport, destport, fwddev);
+        }
+#endif
     }
 
   /* Check if we are forwarding on the same device that we received the
@@ -96,6 +96,20 @@ do  \
 
 #define REASSEMBLY_MAXOCCUPYIOB        CONFIG_IOB_NBUFFERS / 5
 
+/* Number of hash buckets indexing the reassembly nodes, must be a power
+ * of two.  Each incoming fragment only needs to scan the bucket selected
+ * by its NIC and IP ID instead of all unfinished reassemblies.
+ */
+
+#define REASSEMBLY_NBUCKETS            8
+
+/* Map a NIC device and an IP ID value to a hash bucket.  The low bits of
+ * the device pointer are dropped since they carry no entropy.
+ */
+
+#define REASSEMBLY_HASH(dev, ipid) \
+  ((((uintptr_t)(dev) >> 4) ^ (uintptr_t)(ipid)) & (REASSEMBLY_NBUCKETS - 1))
+
 /* Deciding whether to fragment outgoing packets which target is to ourself */
 
 #define LOOPBACK_IPFRAME_NOFRAGMENT    0
@@ -119,11 +133,11 @@ static struct work_s g_wkfragtimeout;
 
 static uint8_t       g_bufoccupy;
 
-/* Queue header definition, it links all fragments of all NICs by ascending
- * ipid.
+/* Hash table of queue headers, each bucket links the reassembly nodes of
+ * all NICs whose (dev, ipid) pair hashes to that bucket.
  */
 
-static sq_queue_t    g_assemblyhead_ipid;
+static sq_queue_t    g_assemblyhash[REASSEMBLY_NBUCKETS];
 
 /* Queue header definition, which connects all fragments of all NICs in order
  * of addition time.
@@ -135,7 +149,7 @@ static sq_queue_t    g_assemblyhead_time;
  * Public Data
  ****************************************************************************/
 
-/* Only one thread can access g_assemblyhead_ipid and g_assemblyhead_time
+/* Only one thread can access g_assemblyhash and g_assemblyhead_time
  * at a time.
  */
 
@@ -530,7 +544,8 @@ uint32_t ip_frag_remnode(FAR struct ip_fragsnode_s *node)
   g_bufoccupy -= node->bufcnt;
   ASSERT(g_bufoccupy < CONFIG_IOB_NBUFFERS);
 
-  sq_rem((FAR sq_entry_t *)node, &g_assemblyhead_ipid);
+  sq_rem((FAR sq_entry_t *)node,
+         &g_assemblyhash[REASSEMBLY_HASH(node->dev, node->ipid)]);
   sq_rem((FAR sq_entry_t *)&node->flinkat, &g_assemblyhead_time);
 
   return node->bufcnt;
@@ -543,7 +558,7 @@ uint32_t ip_frag_remnode(FAR struct ip_fragsnode_s *node)
  *   Enqueue one fragment.
  *   All fragments belonging to one IP frame are organized in a linked list
  *   form, that is a ip_fragsnode_s node. All ip_fragsnode_s nodes are also
- *   organized in an upper-level linked list.
+ *   organized in an upper-level hash table keyed by NIC and IP ID.
  *
  * Input Parameters:
  *   dev         - NIC Device instance
@@ -560,33 +575,38 @@ bool ip_fragin_enqueue(FAR struct net_driver_s *dev,
 {
   FAR struct ip_fragsnode_s *node;
   FAR sq_entry_t            *entry;
-  FAR sq_entry_t            *entrylast = NULL;
+  uint32_t                   bucket;
   bool                       empty;
 
-  /* The linked list is ordered by IP ID value, walk through it and try to
-   * find a node that has the same IP ID value, otherwise need to create a
-   * new node and insert it into the linked list.
+  /* Both lists carry the same set of nodes, so the time-ordered list
+   * tells whether any reassembly at all is in progress.
    */
 
-  entry = sq_peek(&g_assemblyhead_ipid);
-  empty = (entry == NULL) ? true : false;
+  empty = (sq_peek(&g_assemblyhead_time) == NULL) ? true : false;
+
+  /* Walk through the hash bucket selected by the NIC and the IP ID value
+   * and try to find a node that has the same IP ID value, otherwise need
+   * to create a new node and insert it into that bucket.
+   */
+
+  bucket = REASSEMBLY_HASH(dev, curfraglink->ipid);
+  entry  = sq_peek(&g_assemblyhash[bucket]);
 
   while (entry != NULL)
     {
       node = (struct ip_fragsnode_s *)entry;
 
-      if (dev == node->dev && curfraglink->ipid <= node->ipid)
+      if (dev == node->dev && curfraglink->ipid == node->ipid)
         {
           break;
         }
 
-      entrylast = entry;
       entry = sq_next(entry);
     }
 
   node = (FAR struct ip_fragsnode_s *)entry;
 
-  if (node != NULL && curfraglink->ipid == node->ipid)
+  if (node != NULL)
     {
       FAR struct ip_fraglink_s *fraglink;
       FAR struct ip_fraglink_s *lastlink = NULL;
@@ -696,19 +716,11 @@ bool ip_fragin_enqueue(FAR struct net_driver_s *dev,
       node->verifyflag = 0;
       node->outgoframe = NULL;
 
-      /* Insert this new node into linked list identified by
-       * g_assemblyhead_ipid with correct position
+      /* Insert this new node into its hash bucket, the nodes within one
+       * bucket are in no particular order
        */
 
-      if (sq_peek(&g_assemblyhead_ipid) == NULL || entrylast == NULL)
-        {
-          sq_addfirst((FAR sq_entry_t *)node, &g_assemblyhead_ipid);
-        }
-      else
-        {
-          sq_addafter(entrylast, (FAR sq_entry_t *)node,
-                      &g_assemblyhead_ipid);
-        }
+      sq_addfirst((FAR sq_entry_t *)node, &g_assemblyhash[bucket]);
 
       /* Add this new node to the tail of linked list identified by
        * g_assemblyhead_time
@@ -1117,13 +1129,14 @@ void ip_frag_stop(FAR struct net_driver_s *dev)
 
   nxmutex_lock(&g_ipfrag_lock);
 
-  entry = sq_peek(&g_assemblyhead_ipid);
+  entry = sq_peek(&g_assemblyhead_time);
 
   /* Drop those unassembled incoming fragments belonging to this NIC */
 
   while (entry != NULL)
     {
-      FAR struct ip_fragsnode_s *node = (FAR struct ip_fragsnode_s *)entry;
+      FAR struct ip_fragsnode_s *node = (FAR struct ip_fragsnode_s *)
+                container_of(entry, FAR struct ip_fragsnode_s, flinkat);
       entrynext = sq_next(entry);
 
       if (dev == node->dev)
@@ -1139,7 +1152,7 @@ void ip_frag_stop(FAR struct net_driver_s *dev)
             }
 
           ip_frag_remnode(node);
-          kmm_free(entry);
+          kmm_free(node);
         }
 
       entry = entrynext;
@@ -1169,16 +1182,18 @@ void ip_frag_remallfrags(void)
   FAR sq_entry_t *entry = NULL;
   FAR sq_entry_t *entrynext;
   FAR struct net_driver_s *dev;
+  int i;
 
   nxmutex_lock(&g_ipfrag_lock);
 
-  entry = sq_peek(&g_assemblyhead_ipid);
+  entry = sq_peek(&g_assemblyhead_time);
 
   /* Drop all unassembled incoming fragments */
 
   while (entry != NULL)
     {
-      FAR struct ip_fragsnode_s *node = (FAR struct ip_fragsnode_s *)entry;
+      FAR struct ip_fragsnode_s *node = (FAR struct ip_fragsnode_s *)
+                container_of(entry, FAR struct ip_fragsnode_s, flinkat);
       entrynext = sq_next(entry);
 
       if (node->frags != NULL)
@@ -1191,17 +1206,21 @@ void ip_frag_remallfrags(void)
             }
         }
 
-      /* Because nodes managed by the two queues are the same,
-       * and g_assemblyhead_ipid will be cleared after this loop ends,
-       * so only reset g_assemblyhead_time is needed after this loop ends
+      /* The hash buckets and the time-ordered queue manage the same set of
+       * nodes and all of them are dropped here, so resetting every queue
+       * head after this loop ends is all the unlinking that is needed
        */
 
-      sq_rem(entry, &g_assemblyhead_ipid);
-      kmm_free(entry);
+      kmm_free(node);
 
       entry = entrynext;
     }
 
+  for (i = 0; i < REASSEMBLY_NBUCKETS; i++)
+    {
+      sq_init(&g_assemblyhash[i]);
+    }
+
   sq_init(&g_assemblyhead_time);
   g_bufoccupy = 0;
 
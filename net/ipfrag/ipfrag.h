@@ -94,8 +94,9 @@ struct ip_fraglink_s
 
 struct ip_fragsnode_s
 {
-  /* This link is used to maintain a single-linked list of ip_fragsnode_s.
-   * Must be the first field in the structure due to flink type casting.
+  /* This link is used to maintain a single-linked list of ip_fragsnode_s
+   * within one reassembly hash bucket.  Must be the first field in the
+   * structure due to flink type casting.
    */
 
   FAR struct ip_fragsnode_s *flink;
@@ -149,7 +150,7 @@ extern "C"
 #  define EXTERN extern
 #endif
 
-/* Only one thread can access g_assemblyhead_ipid and g_assemblyhead_time
+/* Only one thread can access g_assemblyhash and g_assemblyhead_time
  * at a time
  */
 
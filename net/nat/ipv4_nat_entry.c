@@ -46,6 +46,14 @@
 static DECLARE_HASHTABLE(g_nat44_inbound, CONFIG_NET_NAT_HASH_BITS);
 static DECLARE_HASHTABLE(g_nat44_outbound, CONFIG_NET_NAT_HASH_BITS);
 
+/* Last-hit cache, one entry per direction.  Most packets belong to the
+ * same flow as the previous packet in that direction, so a single compare
+ * against the last matched entry avoids the bucket walk entirely.
+ */
+
+static FAR ipv4_nat_entry_t *g_nat44_inbound_last;
+static FAR ipv4_nat_entry_t *g_nat44_outbound_last;
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -173,6 +181,16 @@ static void ipv4_nat_entry_delete(FAR ipv4_nat_entry_t *entry)
         entry->protocol, entry->local_ip, entry->local_port,
         entry->external_port);
 
+  if (g_nat44_inbound_last == entry)
+    {
+      g_nat44_inbound_last = NULL;
+    }
+
+  if (g_nat44_outbound_last == entry)
+    {
+      g_nat44_outbound_last = NULL;
+    }
+
   hashtable_delete(g_nat44_inbound, &entry->hash_inbound,
                    ipv4_nat_inbound_key(entry->external_ip,
                                         entry->external_port,
@@ -330,6 +348,7 @@ ipv4_nat_inbound_entry_find(uint8_t protocol, in_addr_t external_ip,
 {
   FAR hash_node_t *p;
   FAR hash_node_t *tmp;
+  FAR ipv4_nat_entry_t *last = g_nat44_inbound_last;
   bool skip_ip = net_ipv4addr_cmp(external_ip, INADDR_ANY);
 #ifdef CONFIG_NET_NAT44_SYMMETRIC
   bool skip_peer = net_ipv4addr_cmp(peer_ip, INADDR_ANY);
@@ -338,6 +357,26 @@ ipv4_nat_inbound_entry_find(uint8_t protocol, in_addr_t external_ip,
 
   ipv4_nat_reclaim_entry(current_time);
 
+  /* Fast path:  try the last matched inbound entry first. */
+
+  if (last != NULL && last->expire_time - current_time > 0 &&
+      last->protocol == protocol &&
+      (skip_ip || net_ipv4addr_cmp(last->external_ip, external_ip)) &&
+      last->external_port == external_port
+#ifdef CONFIG_NET_NAT44_SYMMETRIC
+      && (skip_peer || (net_ipv4addr_cmp(last->peer_ip, peer_ip) &&
+                        last->peer_port == peer_port))
+#endif
+      )
+    {
+      if (refresh)
+        {
+          ipv4_nat_entry_refresh(last);
+        }
+
+      return last;
+    }
+
   hashtable_for_every_possible_safe(g_nat44_inbound, p, tmp,
                   ipv4_nat_inbound_key(external_ip, external_port, protocol))
     {
@@ -366,6 +405,7 @@ ipv4_nat_inbound_entry_find(uint8_t protocol, in_addr_t external_ip,
               ipv4_nat_entry_refresh(entry);
             }
 
+          g_nat44_inbound_last = entry;
           return entry;
         }
     }
@@ -409,11 +449,29 @@ ipv4_nat_outbound_entry_find(FAR struct net_driver_s *dev, uint8_t protocol,
 {
   FAR hash_node_t *p;
   FAR hash_node_t *tmp;
+  FAR ipv4_nat_entry_t *last = g_nat44_outbound_last;
   uint16_t external_port;
   int32_t current_time = TICK2SEC(clock_systime_ticks());
 
   ipv4_nat_reclaim_entry(current_time);
 
+  /* Fast path:  try the last matched outbound entry first. */
+
+  if (last != NULL && last->expire_time - current_time > 0 &&
+      last->protocol == protocol &&
+      net_ipv4addr_cmp(last->external_ip, dev->d_ipaddr) &&
+      net_ipv4addr_cmp(last->local_ip, local_ip) &&
+      last->local_port == local_port
+#ifdef CONFIG_NET_NAT44_SYMMETRIC
+      && net_ipv4addr_cmp(last->peer_ip, peer_ip) &&
+      last->peer_port == peer_port
+#endif
+      )
+    {
+      ipv4_nat_entry_refresh(last);
+      return last;
+    }
+
   hashtable_for_every_possible_safe(g_nat44_outbound, p, tmp,
                       ipv4_nat_outbound_key(local_ip, local_port, protocol))
     {
@@ -439,6 +497,7 @@ ipv4_nat_outbound_entry_find(FAR struct net_driver_s *dev, uint8_t protocol,
           )
         {
           ipv4_nat_entry_refresh(entry);
+          g_nat44_outbound_last = entry;
           return entry;
         }
     }
@@ -462,8 +521,14 @@ ipv4_nat_outbound_entry_find(FAR struct net_driver_s *dev, uint8_t protocol,
       return NULL;
     }
 
-  return ipv4_nat_entry_create(protocol, dev->d_ipaddr, external_port,
+  last = ipv4_nat_entry_create(protocol, dev->d_ipaddr, external_port,
                                local_ip, local_port, peer_ip, peer_port);
+  if (last != NULL)
+    {
+      g_nat44_outbound_last = last;
+    }
+
+  return last;
 }
 
 #endif /* CONFIG_NET_NAT44 */
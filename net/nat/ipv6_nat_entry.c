@@ -47,6 +47,14 @@
 static DECLARE_HASHTABLE(g_nat66_inbound, CONFIG_NET_NAT_HASH_BITS);
 static DECLARE_HASHTABLE(g_nat66_outbound, CONFIG_NET_NAT_HASH_BITS);
 
+/* Last-hit cache, one entry per direction.  Most packets belong to the
+ * same flow as the previous packet in that direction, so a single compare
+ * against the last matched entry avoids the bucket walk entirely.
+ */
+
+static FAR ipv6_nat_entry_t *g_nat66_inbound_last;
+static FAR ipv6_nat_entry_t *g_nat66_outbound_last;
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -166,6 +174,16 @@ static void ipv6_nat_entry_delete(FAR ipv6_nat_entry_t *entry)
         entry->local_ip[5], entry->local_ip[6], entry->local_ip[7],
         entry->local_port, entry->external_port);
 
+  if (g_nat66_inbound_last == entry)
+    {
+      g_nat66_inbound_last = NULL;
+    }
+
+  if (g_nat66_outbound_last == entry)
+    {
+      g_nat66_outbound_last = NULL;
+    }
+
   hashtable_delete(g_nat66_inbound, &entry->hash_inbound,
                    ipv6_nat_hash_key(entry->external_ip,
                                      entry->external_port,
@@ -325,6 +343,7 @@ ipv6_nat_inbound_entry_find(uint8_t protocol,
 {
   FAR hash_node_t *p;
   FAR hash_node_t *tmp;
+  FAR ipv6_nat_entry_t *last = g_nat66_inbound_last;
   bool skip_ip = net_ipv6addr_cmp(external_ip, g_ipv6_unspecaddr);
 #ifdef CONFIG_NET_NAT66_SYMMETRIC
   bool skip_peer = net_ipv6addr_cmp(peer_ip, g_ipv6_unspecaddr);
@@ -333,6 +352,26 @@ ipv6_nat_inbound_entry_find(uint8_t protocol,
 
   ipv6_nat_reclaim_entry(current_time);
 
+  /* Fast path:  try the last matched inbound entry first. */
+
+  if (last != NULL && last->expire_time - current_time > 0 &&
+      last->protocol == protocol &&
+      (skip_ip || net_ipv6addr_cmp(last->external_ip, external_ip)) &&
+      last->external_port == external_port
+#ifdef CONFIG_NET_NAT66_SYMMETRIC
+      && (skip_peer || (net_ipv6addr_cmp(last->peer_ip, peer_ip) &&
+                        last->peer_port == peer_port))
+#endif
+      )
+    {
+      if (refresh)
+        {
+          ipv6_nat_entry_refresh(last);
+        }
+
+      return last;
+    }
+
   hashtable_for_every_possible_safe(g_nat66_inbound, p, tmp,
                     ipv6_nat_hash_key(external_ip, external_port, protocol))
     {
@@ -361,6 +400,7 @@ ipv6_nat_inbound_entry_find(uint8_t protocol,
               ipv6_nat_entry_refresh(entry);
             }
 
+          g_nat66_inbound_last = entry;
           return entry;
         }
     }
@@ -408,12 +448,30 @@ ipv6_nat_outbound_entry_find(FAR struct net_driver_s *dev, uint8_t protocol,
 {
   FAR hash_node_t *p;
   FAR hash_node_t *tmp;
+  FAR ipv6_nat_entry_t *last = g_nat66_outbound_last;
   FAR union ip_addr_u *external_ip;
   uint16_t external_port;
   int32_t current_time = TICK2SEC(clock_systime_ticks());
 
   ipv6_nat_reclaim_entry(current_time);
 
+  /* Fast path:  try the last matched outbound entry first. */
+
+  if (last != NULL && last->expire_time - current_time > 0 &&
+      last->protocol == protocol &&
+      NETDEV_IS_MY_V6ADDR(dev, last->external_ip) &&
+      net_ipv6addr_cmp(last->local_ip, local_ip) &&
+      last->local_port == local_port
+#ifdef CONFIG_NET_NAT66_SYMMETRIC
+      && net_ipv6addr_cmp(last->peer_ip, peer_ip) &&
+      last->peer_port == peer_port
+#endif
+      )
+    {
+      ipv6_nat_entry_refresh(last);
+      return last;
+    }
+
   hashtable_for_every_possible_safe(g_nat66_outbound, p, tmp,
                           ipv6_nat_hash_key(local_ip, local_port, protocol))
     {
@@ -439,6 +497,7 @@ ipv6_nat_outbound_entry_find(FAR struct net_driver_s *dev, uint8_t protocol,
           )
         {
           ipv6_nat_entry_refresh(entry);
+          g_nat66_outbound_last = entry;
           return entry;
         }
     }
@@ -466,8 +525,14 @@ ipv6_nat_outbound_entry_find(FAR struct net_driver_s *dev, uint8_t protocol,
       return NULL;
     }
 
-  return ipv6_nat_entry_create(protocol, external_ip->ipv6, external_port,
+  last = ipv6_nat_entry_create(protocol, external_ip->ipv6, external_port,
                                local_ip, local_port, peer_ip, peer_port);
+  if (last != NULL)
+    {
+      g_nat66_outbound_last = last;
+    }
+
+  return last;
 }
 
 #endif /* CONFIG_NET_NAT66 */
@@ -38,6 +38,7 @@
 #include <nuttx/net/netdev.h>
 
 #include "ipfrag/ipfrag.h"
+#include "ipforward/ipforward.h"
 #include "netdev/netdev.h"
 #include "netlink/netlink.h"
 #include "arp/arp.h"
@@ -92,6 +93,12 @@ void netdev_carrier_off(FAR struct net_driver_s *dev)
       ip_frag_stop(dev);
 #endif
 
+#ifdef CONFIG_NET_IPFORWARD_FLOWCACHE
+      /* Drop cached forwarding decisions that use this NIC */
+
+      ipfwd_flowcache_flush(dev);
+#endif
+
       /* Notify clients that the network has been taken down */
 
       devif_dev_event(dev, NETDEV_DOWN);
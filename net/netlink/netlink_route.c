@@ -33,11 +33,14 @@
 #include <debug.h>
 #include <arpa/inet.h>
 
+#include <net/if.h>
 #include <net/route.h>
 #include <netpacket/netlink.h>
 #include <netinet/if_ether.h>
 
+#include <nuttx/clock.h>
 #include <nuttx/kmalloc.h>
+#include <nuttx/wqueue.h>
 #include <nuttx/net/net.h>
 #include <nuttx/net/ip.h>
 #include <nuttx/net/neighbor.h>
@@ -270,6 +273,18 @@ static_assert(sizeof(g_ifa_ipv6_policy) / sizeof(g_ifa_ipv6_policy[0]) ==
 #  define g_ifa_ipv6_policy NULL
 #endif
 
+#if !defined(CONFIG_NETLINK_DISABLE_GETLINK) && \
+    CONFIG_NETLINK_ROUTE_LINK_COALESCE_MSEC > 0
+/* Devices with a pending coalesced link notification and the delayed
+ * work that broadcasts them when the coalescing window closes.  Access
+ * is protected by the network lock.
+ */
+
+static FAR struct net_driver_s *g_link_pending[MAX_IFINDEX];
+static int                      g_link_npending;
+static struct work_s            g_link_notify_work;
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -1330,6 +1345,54 @@ netlink_fill_ipv6prefix(FAR struct net_driver_s *dev, int type,
 }
 #endif
 
+/****************************************************************************
+ * Name: netlink_link_notify_worker
+ *
+ * Description:
+ *   Broadcast one RTM_NEWLINK notification for every device that changed
+ *   state while the coalescing window was open.  Each interested reader
+ *   is awakened once for the whole burst.
+ *
+ ****************************************************************************/
+
+#if !defined(CONFIG_NETLINK_DISABLE_GETLINK) && \
+    CONFIG_NETLINK_ROUTE_LINK_COALESCE_MSEC > 0
+static void netlink_link_notify_worker(FAR void *arg)
+{
+  FAR struct netlink_response_s *resp;
+  FAR struct net_driver_s *dev;
+  int i;
+
+  net_lock();
+
+  for (i = 0; i < g_link_npending; i++)
+    {
+      /* The device may have been unregistered while the notification was
+       * pending; verify that it is still in the list of registered
+       * devices before touching it.
+       */
+
+      for (dev = g_netdevices; dev != NULL; dev = dev->flink)
+        {
+          if (dev == g_link_pending[i])
+            {
+              resp = netlink_get_device(dev, NULL);
+              if (resp != NULL)
+                {
+                  netlink_add_broadcast(RTNLGRP_LINK, resp);
+                  netlink_add_terminator(NULL, NULL, RTNLGRP_LINK);
+                }
+
+              break;
+            }
+        }
+    }
+
+  g_link_npending = 0;
+  net_unlock();
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -1525,9 +1588,52 @@ ssize_t netlink_route_sendto(NETLINK_HANDLE handle,
 void netlink_device_notify(FAR struct net_driver_s *dev)
 {
   FAR struct netlink_response_s *resp;
+#if CONFIG_NETLINK_ROUTE_LINK_COALESCE_MSEC > 0
+  int i;
+#endif
 
   DEBUGASSERT(dev != NULL);
 
+#if CONFIG_NETLINK_ROUTE_LINK_COALESCE_MSEC > 0
+  /* Merge bursts of state changes:  The first change of a burst arms the
+   * coalescing window; all further changes within the window only extend
+   * the pending set and the readers are awakened once when the window
+   * closes.
+   */
+
+  net_lock();
+
+  for (i = 0; i < g_link_npending; i++)
+    {
+      if (g_link_pending[i] == dev)
+        {
+          break;
+        }
+    }
+
+  if (i < g_link_npending || g_link_npending < MAX_IFINDEX)
+    {
+      if (i == g_link_npending)
+        {
+          g_link_pending[g_link_npending++] = dev;
+        }
+
+      if (work_available(&g_link_notify_work))
+        {
+          work_queue(LPWORK, &g_link_notify_work,
+                     netlink_link_notify_worker, NULL,
+                     MSEC2TICK(CONFIG_NETLINK_ROUTE_LINK_COALESCE_MSEC));
+        }
+
+      net_unlock();
+      return;
+    }
+
+  /* The pending table is full; fall back to an immediate notification */
+
+  net_unlock();
+#endif
+
   resp = netlink_get_device(dev, NULL);
   if (resp != NULL)
     {
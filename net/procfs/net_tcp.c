@@ -46,9 +46,17 @@
 #ifdef NET_TCP_HAVE_STACK
 
 #ifdef CONFIG_NET_IPv6
-#  define TCP_LINELEN 180
+#  ifdef CONFIG_NET_TCP_CONN_STATS
+#    define TCP_LINELEN 224
+#  else
+#    define TCP_LINELEN 180
+#  endif
 #else
-#  define TCP_LINELEN 120
+#  ifdef CONFIG_NET_TCP_CONN_STATS
+#    define TCP_LINELEN 164
+#  else
+#    define TCP_LINELEN 120
+#  endif
 #endif
 
 /****************************************************************************
@@ -115,6 +123,21 @@ static ssize_t netprocfs_tcpstats(FAR struct netprocfs_file_s *priv,
 #endif
                       (conn->readahead) ? conn->readahead->io_pktlen : 0);
 
+#ifdef CONFIG_NET_TCP_CONN_STATS
+      /* The smoothed round trip estimate is scaled by 8 and is in the
+       * same half-second units as the retransmission timer.
+       */
+
+      len += snprintf(buffer + len, buflen - len,
+                      " %6" PRIu32 " %6" PRIu32
+                      " %5" PRIu32 " %4" PRIu32 " %4u",
+                      conn->stat_txpkts,
+                      conn->stat_rxpkts,
+                      conn->stat_rexmits,
+                      conn->stat_zerownd,
+                      conn->sa >> 3);
+#endif
+
       len += snprintf(buffer + len, buflen - len,
                       " %*s:%-6" PRIu16 " %*s:%-6" PRIu16 "\n",
                       (domain == PF_INET6) ? addrlen / 2 : addrlen,
@@ -170,6 +193,9 @@ ssize_t netprocfs_read_tcpstats(FAR struct netprocfs_file_s *priv,
                                           "txsz   "
 #endif
                                           "rxsz "
+#ifdef CONFIG_NET_TCP_CONN_STATS
+                                          " txpkt  rxpkt rexmt zwnd srtt "
+#endif
                                           "%-*s "
                                           "%-*s\n"
                                           ,
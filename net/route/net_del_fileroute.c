@@ -189,6 +189,12 @@ int net_delroute_ipv4(in_addr_t target, in_addr_t netmask)
   int index;
   int ret;
 
+  /* Bump the generation counter so that cached routing decisions are
+   * re-evaluated.
+   */
+
+  g_route_ipv4_gen++;
+
   /* We must lock out other accesses to the routing table while we remove
    * entry
    */
@@ -341,6 +347,12 @@ int net_delroute_ipv6(net_ipv6addr_t target, net_ipv6addr_t netmask)
   int index;
   int ret;
 
+  /* Bump the generation counter so that cached routing decisions are
+   * re-evaluated.
+   */
+
+  g_route_ipv6_gen++;
+
   /* We must lock out other accesses to the routing table while we remove
    * entry
    */
@@ -217,8 +217,11 @@ int net_delroute_ipv4(in_addr_t target, in_addr_t netmask)
   net_ipv4addr_copy(match.target, target);
   net_ipv4addr_copy(match.netmask, netmask);
 
-  /* Then remove the entry from the routing table */
+  /* Then remove the entry from the routing table.  Bump the generation
+   * counter so that cached routing decisions are re-evaluated.
+   */
 
+  g_route_ipv4_gen++;
   return net_foreachroute_ipv4(net_del_ipv4route, &match) ? OK : -ENOENT;
 }
 #endif
@@ -234,8 +237,11 @@ int net_delroute_ipv6(net_ipv6addr_t target, net_ipv6addr_t netmask)
   net_ipv6addr_copy(match.target, target);
   net_ipv6addr_copy(match.netmask, netmask);
 
-  /* Then remove the entry from the routing table */
+  /* Then remove the entry from the routing table.  Bump the generation
+   * counter so that cached routing decisions are re-evaluated.
+   */
 
+  g_route_ipv6_gen++;
   return net_foreachroute_ipv6(net_del_ipv6route, &match) ? OK : -ENOENT;
 }
 #endif
@@ -32,6 +32,20 @@
 
 #ifdef CONFIG_NET_ROUTE
 
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+/* Route table generation counters.  See route/route.h. */
+
+#ifdef CONFIG_NET_IPv4
+uint16_t g_route_ipv4_gen;
+#endif
+
+#ifdef CONFIG_NET_IPv6
+uint16_t g_route_ipv6_gen;
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
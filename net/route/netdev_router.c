@@ -26,6 +26,7 @@
 
 #include <nuttx/config.h>
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 #include <errno.h>
@@ -102,6 +103,41 @@ struct route_ipv6_devmatch_s
 };
 #endif
 
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* Last routing decision, one per address family.  Most traffic goes to a
+ * handful of destinations, so remembering the last answer together with
+ * the route table generation reduces repeated lookups to a few compares.
+ */
+
+#ifdef CONFIG_NET_IPv4
+struct route_ipv4_lasthop_s
+{
+  FAR struct net_driver_s *dev;  /* Device the decision was made for */
+  in_addr_t target;              /* Destination address */
+  in_addr_t router;              /* Resolved next-hop router */
+  uint16_t generation;           /* Route table generation at decision */
+  bool valid;                    /* True: the cached decision is usable */
+};
+
+static struct route_ipv4_lasthop_s g_ipv4_lasthop;
+#endif
+
+#ifdef CONFIG_NET_IPv6
+struct route_ipv6_lasthop_s
+{
+  FAR struct net_driver_s *dev;  /* Device the decision was made for */
+  net_ipv6addr_t target;         /* Destination address */
+  net_ipv6addr_t router;         /* Resolved next-hop router */
+  uint16_t generation;           /* Route table generation at decision */
+  bool valid;                    /* True: the cached decision is usable */
+};
+
+static struct route_ipv6_lasthop_s g_ipv6_lasthop;
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -264,6 +300,24 @@ void netdev_ipv4_router(FAR struct net_driver_s *dev, in_addr_t target,
   struct route_ipv4_devmatch_s match;
   int ret;
 
+  /* Check the last routing decision first.  It can be reused if the
+   * route table has not changed, the same device and destination are
+   * being looked up, and the cached router is still on the device's
+   * network (which re-validates the decision after the device has been
+   * reconfigured).
+   */
+
+  if (g_ipv4_lasthop.valid &&
+      g_ipv4_lasthop.generation == g_route_ipv4_gen &&
+      g_ipv4_lasthop.dev == dev &&
+      net_ipv4addr_cmp(g_ipv4_lasthop.target, target) &&
+      net_ipv4addr_maskcmp(g_ipv4_lasthop.router, dev->d_ipaddr,
+                           dev->d_netmask))
+    {
+      net_ipv4addr_copy(*router, g_ipv4_lasthop.router);
+      return;
+    }
+
   /* Set up the comparison structure */
 
   memset(&match, 0, sizeof(struct route_ipv4_devmatch_s));
@@ -309,6 +363,17 @@ void netdev_ipv4_router(FAR struct net_driver_s *dev, in_addr_t target,
       /* We Return the router address. */
 
       net_ipv4addr_copy(*router, match.IPv4_ROUTER);
+
+      /* Remember this decision.  The default-router fallback below is
+       * not cached because d_draddr may change without bumping the
+       * route table generation.
+       */
+
+      g_ipv4_lasthop.dev        = dev;
+      net_ipv4addr_copy(g_ipv4_lasthop.target, target);
+      net_ipv4addr_copy(g_ipv4_lasthop.router, match.IPv4_ROUTER);
+      g_ipv4_lasthop.generation = g_route_ipv4_gen;
+      g_ipv4_lasthop.valid      = true;
     }
   else
     {
@@ -351,6 +416,22 @@ void netdev_ipv6_router(FAR struct net_driver_s *dev,
   struct route_ipv6_devmatch_s match;
   int ret;
 
+  /* Check the last routing decision first.  It can be reused if the
+   * route table has not changed, the same device and destination are
+   * being looked up, and the cached router is still on-link (which
+   * re-validates the decision after the device has been reconfigured).
+   */
+
+  if (g_ipv6_lasthop.valid &&
+      g_ipv6_lasthop.generation == g_route_ipv6_gen &&
+      g_ipv6_lasthop.dev == dev &&
+      net_ipv6addr_cmp(g_ipv6_lasthop.target, target) &&
+      NETDEV_V6ADDR_ONLINK(dev, g_ipv6_lasthop.router))
+    {
+      net_ipv6addr_copy(router, g_ipv6_lasthop.router);
+      return;
+    }
+
   /* Set up the comparison structure */
 
   memset(&match, 0, sizeof(struct route_ipv6_devmatch_s));
@@ -395,6 +476,17 @@ void netdev_ipv6_router(FAR struct net_driver_s *dev,
       /* Return the router address. */
 
       net_ipv6addr_copy(router, match.IPv6_ROUTER);
+
+      /* Remember this decision.  The default-router fallback below is
+       * not cached because d_ipv6draddr may change without bumping the
+       * route table generation.
+       */
+
+      g_ipv6_lasthop.dev        = dev;
+      net_ipv6addr_copy(g_ipv6_lasthop.target, target);
+      net_ipv6addr_copy(g_ipv6_lasthop.router, match.IPv6_ROUTER);
+      g_ipv6_lasthop.generation = g_route_ipv6_gen;
+      g_ipv6_lasthop.valid      = true;
     }
   else
     {
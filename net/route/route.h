@@ -85,6 +85,19 @@ extern "C"
 #define EXTERN extern
 #endif
 
+/* Route table generation counters.  Bumped on every route addition or
+ * deletion so that cached routing decisions can be invalidated with a
+ * single compare.
+ */
+
+#ifdef CONFIG_NET_IPv4
+EXTERN uint16_t g_route_ipv4_gen;
+#endif
+
+#ifdef CONFIG_NET_IPv6
+EXTERN uint16_t g_route_ipv6_gen;
+#endif
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
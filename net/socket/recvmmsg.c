@@ -0,0 +1,206 @@
+/****************************************************************************
+ * net/socket/recvmmsg.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <assert.h>
+#include <errno.h>
+#include <time.h>
+
+#include <nuttx/cancelpt.h>
+#include <nuttx/clock.h>
+#include <nuttx/fs/fs.h>
+#include <nuttx/net/net.h>
+
+#include "socket/socket.h"
+
+#ifdef CONFIG_NET
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: psock_recvmmsg
+ *
+ * Description:
+ *   psock_recvmmsg() receives multiple messages from a socket with a
+ *   single call, and may be used whether or not the socket is connection-
+ *   oriented.  This is an internal OS interface.  It is functionally
+ *   equivalent to recvmmsg() except that:
+ *
+ *   - It is not a cancellation point,
+ *   - It does not modify the errno variable, and
+ *   - It accepts the internal socket structure as an input rather than an
+ *     task-specific socket descriptor.
+ *
+ * Input Parameters:
+ *   psock    A pointer to a NuttX-specific, internal socket structure
+ *   msgvec   Array of message buffers to fill
+ *   vlen     Number of elements in msgvec
+ *   flags    Receive flags, applied to each message.  MSG_WAITFORONE
+ *            makes all but the first receive non-blocking.
+ *   timeout  Receive no more messages after this time has elapsed,
+ *            or NULL for no time limit
+ *
+ * Returned Value:
+ *   On success, returns the number of messages received; the msg_len
+ *   field of each filled element is updated with the number of bytes
+ *   received.  If nothing could be received, a negated errno value is
+ *   returned (see comments with recvmsg() for a list of appropriate errno
+ *   values).  If some messages were received before an error occurred,
+ *   the count of received messages is returned and the error is not
+ *   reported.
+ *
+ ****************************************************************************/
+
+int psock_recvmmsg(FAR struct socket *psock, FAR struct mmsghdr *msgvec,
+                   unsigned int vlen, int flags,
+                   FAR struct timespec *timeout)
+{
+  clock_t deadline = 0;
+  unsigned int i;
+  ssize_t ret = -EINVAL;
+
+  if (msgvec == NULL)
+    {
+      return -EINVAL;
+    }
+
+  if (timeout != NULL)
+    {
+      if (timeout->tv_sec < 0 || timeout->tv_nsec < 0 ||
+          timeout->tv_nsec >= NSEC_PER_SEC)
+        {
+          return -EINVAL;
+        }
+
+      deadline = clock_systime_ticks() + clock_time2ticks(timeout);
+    }
+
+  /* Receive each message in order.  The socket is resolved and referenced
+   * only once by the caller, so the per-message cost is limited to the
+   * protocol receive itself.
+   */
+
+  for (i = 0; i < vlen; i++)
+    {
+      ret = psock_recvmsg(psock, &msgvec[i].msg_hdr, flags);
+      if (ret < 0)
+        {
+          break;
+        }
+
+      msgvec[i].msg_len = ret;
+
+      /* After the first message has been received, do not block waiting
+       * for the following ones.
+       */
+
+      if ((flags & MSG_WAITFORONE) != 0)
+        {
+          flags &= ~MSG_WAITFORONE;
+          flags |= MSG_DONTWAIT;
+        }
+
+      /* The timeout is only checked between messages, as on Linux */
+
+      if (timeout != NULL &&
+          (sclock_t)(clock_systime_ticks() - deadline) >= 0)
+        {
+          i++;
+          break;
+        }
+    }
+
+  /* Like Linux:  If any message was received, return the count of the
+   * received messages and swallow the error; -EAGAIN here is the normal
+   * end of a MSG_WAITFORONE burst.
+   */
+
+  return i > 0 ? (int)i : (int)ret;
+}
+
+/****************************************************************************
+ * Function: recvmmsg
+ *
+ * Description:
+ *   The recvmmsg() call is an extension of recvmsg() that receives an
+ *   array of messages with a single call, reducing the per-message
+ *   descriptor lookup and call overhead for datagram traffic.
+ *
+ * Parameters:
+ *   sockfd   Socket descriptor of socket
+ *   msgvec   Array of message buffers to fill
+ *   vlen     Number of elements in msgvec
+ *   flags    Receive flags, applied to each message.  MSG_WAITFORONE
+ *            makes all but the first receive non-blocking.
+ *   timeout  Receive no more messages after this time has elapsed,
+ *            or NULL for no time limit
+ *
+ * Returned Value:
+ *   On success, returns the number of messages received; the msg_len
+ *   field of each filled element is updated with the number of bytes
+ *   received.  On error, -1 is returned and errno is set appropriately
+ *   (see recvmsg() for the list of errno values).  An error is only
+ *   reported if no message could be received.
+ *
+ ****************************************************************************/
+
+int recvmmsg(int sockfd, FAR struct mmsghdr *msgvec, unsigned int vlen,
+             int flags, FAR struct timespec *timeout)
+{
+  FAR struct socket *psock;
+  FAR struct file *filep;
+  int ret;
+
+  /* recvmmsg() is a cancellation point */
+
+  enter_cancellation_point();
+
+  /* Get the underlying socket structure */
+
+  ret = sockfd_socket(sockfd, &filep, &psock);
+
+  /* Let psock_recvmmsg() do all of the work */
+
+  if (ret == OK)
+    {
+      ret = psock_recvmmsg(psock, msgvec, vlen, flags, timeout);
+      fs_putfilep(filep);
+    }
+
+  if (ret < 0)
+    {
+      set_errno(-ret);
+      ret = ERROR;
+    }
+
+  leave_cancellation_point();
+  return ret;
+}
+
+#endif /* CONFIG_NET */
@@ -0,0 +1,165 @@
+/****************************************************************************
+ * net/socket/sendmmsg.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <assert.h>
+#include <errno.h>
+
+#include <nuttx/cancelpt.h>
+#include <nuttx/fs/fs.h>
+#include <nuttx/net/net.h>
+
+#include "socket/socket.h"
+
+#ifdef CONFIG_NET
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: psock_sendmmsg
+ *
+ * Description:
+ *   psock_sendmmsg() sends multiple messages on a socket with a single
+ *   call, and may be used whether or not the socket is connection-
+ *   oriented.  This is an internal OS interface.  It is functionally
+ *   equivalent to sendmmsg() except that:
+ *
+ *   - It is not a cancellation point,
+ *   - It does not modify the errno variable, and
+ *   - It accepts the internal socket structure as an input rather than an
+ *     task-specific socket descriptor.
+ *
+ * Input Parameters:
+ *   psock    A pointer to a NuttX-specific, internal socket structure
+ *   msgvec   Array of messages to send
+ *   vlen     Number of elements in msgvec
+ *   flags    Send flags, applied to each message
+ *
+ * Returned Value:
+ *   On success, returns the number of messages sent; the msg_len field of
+ *   each sent element is updated with the number of bytes transferred.  If
+ *   nothing could be sent, a negated errno value is returned (see comments
+ *   with sendmsg() for a list of appropriate errno values).  If some
+ *   messages were sent before an error occurred, the count of sent
+ *   messages is returned and the error is not reported.
+ *
+ ****************************************************************************/
+
+int psock_sendmmsg(FAR struct socket *psock, FAR struct mmsghdr *msgvec,
+                   unsigned int vlen, int flags)
+{
+  unsigned int i;
+  ssize_t ret = -EINVAL;
+
+  if (msgvec == NULL)
+    {
+      return -EINVAL;
+    }
+
+  /* Send each message in order.  The socket is resolved and referenced
+   * only once by the caller, so the per-message cost is limited to the
+   * protocol send itself.
+   */
+
+  for (i = 0; i < vlen; i++)
+    {
+      ret = psock_sendmsg(psock, &msgvec[i].msg_hdr, flags);
+      if (ret < 0)
+        {
+          break;
+        }
+
+      msgvec[i].msg_len = ret;
+    }
+
+  /* Like Linux:  If any message was sent, return the count of the sent
+   * messages and swallow the error; it will be rediscovered when the
+   * the remaining messages are re-sent.
+   */
+
+  return i > 0 ? (int)i : (int)ret;
+}
+
+/****************************************************************************
+ * Function: sendmmsg
+ *
+ * Description:
+ *   The sendmmsg() call is an extension of sendmsg() that sends an array
+ *   of messages with a single call, reducing the per-message descriptor
+ *   lookup and call overhead for datagram traffic.
+ *
+ * Parameters:
+ *   sockfd   Socket descriptor of socket
+ *   msgvec   Array of messages to send
+ *   vlen     Number of elements in msgvec
+ *   flags    Send flags, applied to each message
+ *
+ * Returned Value:
+ *   On success, returns the number of messages sent; the msg_len field of
+ *   each sent element is updated with the number of bytes transferred.
+ *   On error, -1 is returned and errno is set appropriately (see sendmsg()
+ *   for the list of errno values).  An error is only reported if no
+ *   message could be sent.
+ *
+ ****************************************************************************/
+
+int sendmmsg(int sockfd, FAR struct mmsghdr *msgvec, unsigned int vlen,
+             int flags)
+{
+  FAR struct socket *psock;
+  FAR struct file *filep;
+  int ret;
+
+  /* sendmmsg() is a cancellation point */
+
+  enter_cancellation_point();
+
+  /* Get the underlying socket structure */
+
+  ret = sockfd_socket(sockfd, &filep, &psock);
+
+  /* Let psock_sendmmsg() do all of the work */
+
+  if (ret == OK)
+    {
+      ret = psock_sendmmsg(psock, msgvec, vlen, flags);
+      fs_putfilep(filep);
+    }
+
+  if (ret < 0)
+    {
+      set_errno(-ret);
+      ret = ERROR;
+    }
+
+  leave_cancellation_point();
+  return ret;
+}
+
+#endif /* CONFIG_NET */
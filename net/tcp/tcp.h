@@ -116,6 +116,48 @@
 #define TCP_INFR              0x08U /* The flag in Fast Recovery */
 #define TCP_INFT              0x10U /* The flag in Fast Transmitted */
 
+#define TCP_IPV4_DEFAULT_MSS  536
+
+/* Initial Window threshold constants */
+
+#define IW_MAX                4380  /* Initial Window maximum */
+#define IW_MAX_HALF           2190
+#define IW_MAX_QUATER         1095
+
+/* Calculate the Initial Window, also used as Restart Window
+ * RFC5681 Section 3.1 specifies the default conservative values.
+ */
+
+#define CC_INIT_CWND(cwnd, mss) \
+ do { \
+  if ((mss) > IW_MAX_HALF) \
+    { \
+      (cwnd) = 2 * (mss); \
+    } \
+  else if ((mss) > IW_MAX_QUATER) \
+    { \
+      (cwnd) = 3 * (mss); \
+    } \
+  else \
+    { \
+      (cwnd) = 4 * (mss); \
+    } \
+ } while(0)
+
+/* Increments a size inc and holds at max value rather than rollover. */
+
+#define CC_CWND_INC(wnd, inc) \
+ do { \
+  if ((uint32_t)((wnd) + (inc)) >= (wnd)) \
+    { \
+      (wnd) = (uint32_t)((wnd) + (inc)); \
+    } \
+  else \
+    { \
+      (wnd) = (uint32_t)-1; \
+    } \
+ } while(0)
+
 #endif
 
 /* The Max Range count of TCP Selective ACKs */
@@ -180,6 +222,40 @@ struct tcp_sack_s
   uint32_t right;   /* Right edge of the SACK */
 };
 
+#ifdef CONFIG_NET_TCP_CC_NEWRENO
+/* Congestion control algorithm operations.  The common machinery in
+ * tcp_cc.c -- duplicate ACK accounting, fast retransmit/recovery and slow
+ * start -- is shared by all algorithms; a module supplies only the pieces
+ * that differ between algorithms.
+ */
+
+struct tcp_conn_s; /* Forward reference */
+
+struct tcp_cc_ops_s
+{
+  FAR const char *name;  /* Name of the algorithm */
+
+  /* Algorithm-private (re)initialization on a new connection (optional) */
+
+  CODE void (*init)(FAR struct tcp_conn_s *conn);
+
+  /* Return the new slow start threshold after a loss event */
+
+  CODE uint32_t (*ssthresh)(FAR struct tcp_conn_s *conn);
+
+  /* Grow cwnd on an ACK for new data during congestion avoidance */
+
+  CODE void (*cong_avoid)(FAR struct tcp_conn_s *conn);
+
+  /* Bound the number of bytes placed on the wire in one send opportunity
+   * so that transmission is paced rather than sent in line-rate bursts
+   * (optional).  A return value of zero means no limit.
+   */
+
+  CODE uint32_t (*pace)(FAR struct tcp_conn_s *conn);
+};
+#endif
+
 struct tcp_conn_s
 {
   /* Common prologue of all connection structures. */
@@ -213,6 +289,9 @@ struct tcp_conn_s
   /* TCP-specific content follows */
 
   union ip_binding_u u;   /* IP address binding */
+#ifdef CONFIG_NET_TCP_CONN_HASH
+  FAR struct tcp_conn_s *hashnext; /* Chain in the demux hash table */
+#endif
   uint8_t  rcvseq[4];     /* The sequence number that we expect to
                            * receive next */
   uint8_t  sndseq[4];     /* The sequence number that was last sent by us */
@@ -238,6 +317,15 @@ struct tcp_conn_s
 #ifdef CONFIG_NET_TCP_DELAYED_ACK
   uint8_t  rx_unackseg;   /* Number of un-ACKed received segments */
   uint8_t  rx_acktimer;   /* Time since last ACK sent (units: half-seconds) */
+  bool     rx_quickack;   /* TCP_QUICKACK: ACK immediately, do not delay */
+#endif
+#ifdef CONFIG_NET_TCP_CORK
+  bool     corked;        /* TCP_CORK: hold back partial segments */
+  uint8_t  cork_timer;    /* Time a partial segment has been withheld
+                           * (units: half-seconds) */
+#endif
+#ifdef CONFIG_NET_TCP_AUTOCORK
+  bool     nodelay;       /* TCP_NODELAY: disable automatic corking */
 #endif
   uint16_t lport;         /* The local TCP port, in network byte order */
   uint16_t rport;         /* The remoteTCP port, in network byte order */
@@ -248,6 +336,12 @@ struct tcp_conn_s
                            * connection */
 #endif
   uint32_t rcv_adv;       /* The right edge of the recv window advertized */
+#ifdef CONFIG_NET_TCP_CONN_STATS
+  uint32_t stat_txpkts;   /* Number of segments sent on this connection */
+  uint32_t stat_rxpkts;   /* Number of segments received */
+  uint32_t stat_rexmits;  /* Number of segments retransmitted */
+  uint32_t stat_zerownd;  /* Number of times the send window closed */
+#endif
 #ifdef CONFIG_NET_TCP_CC_NEWRENO
   uint32_t last_ackno;    /* The ack number at the last receive ack */
   uint32_t dupacks;       /* The number of duplicate ack */
@@ -256,6 +350,15 @@ struct tcp_conn_s
   uint32_t cwnd;          /* The Congestion window */
   uint32_t max_cwnd;      /* The Congestion window maximum value */
   uint32_t ssthresh;      /* The Slow start threshold */
+
+  FAR const struct tcp_cc_ops_s *cc_ops; /* Congestion control algorithm */
+
+#ifdef CONFIG_NET_TCP_CC_CUBIC
+  uint32_t cc_wmax;       /* CUBIC: cwnd (bytes) before the last reduction */
+  uint32_t cc_k;          /* CUBIC: regrowth time K in 1/64 second units */
+  uint32_t cc_epoch;      /* CUBIC: start of the growth epoch in 1/64
+                           * second units (0: epoch not yet started) */
+#endif
 #endif
 #ifdef CONFIG_NET_TCP_WINDOW_SCALE
   uint32_t snd_wnd;       /* Sequence and acknowledgement numbers of last
@@ -271,6 +374,10 @@ struct tcp_conn_s
 #if CONFIG_NET_RECV_BUFSIZE > 0
   int32_t  rcv_bufs;      /* Maximum amount of bytes queued in recv */
 #endif
+#ifdef CONFIG_NET_TCP_RECVBUF_AUTOTUNE
+  uint32_t rcv_rttseq;    /* Sequence number ending the measurement round */
+  uint32_t rcv_copied;    /* Bytes copied to the application this round */
+#endif
 #if CONFIG_NET_SEND_BUFSIZE > 0
   int32_t  snd_bufs;      /* Maximum amount of bytes queued in send */
   sem_t    snd_sem;       /* Semaphore signals send completion */
@@ -365,6 +472,15 @@ struct tcp_conn_s
 #endif
   bool       zero_probe;   /* TCP zero window probe timer */
 
+#ifdef CONFIG_NET_TCP_TXREADYQ
+  /* Entry in the TX-ready queue of the device that the connection is bound
+   * to.  tx_ready is true while the connection is on that queue.
+   */
+
+  sq_entry_t tx_node;
+  bool       tx_ready;
+#endif
+
   /* connevents is a list of callbacks for each socket the uses this
    * connection (there can be more that one in the event that the the socket
    * was dup'ed).  It is used with the network monitor to handle
@@ -452,6 +568,12 @@ extern "C"
 {
 #endif
 
+#ifdef CONFIG_NET_TCP_CC_CUBIC
+/* The CUBIC congestion control algorithm (tcp_cc_cubic.c) */
+
+extern const struct tcp_cc_ops_s g_tcp_cc_cubic;
+#endif
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
@@ -480,6 +602,23 @@ void tcp_initialize(void);
 
 FAR struct tcp_conn_s *tcp_alloc(uint8_t domain);
 
+/****************************************************************************
+ * Name: tcp_conn_reserve
+ *
+ * Description:
+ *   Grow the free connection list until it holds at least 'count' entries,
+ *   so that a following burst of incoming connections can be accepted from
+ *   the free list without allocating under the network lock.  Called from
+ *   the listen() logic with the expected backlog depth.  Best-effort: the
+ *   reservation stops silently at the connection limit or when the heap
+ *   is exhausted.
+ *
+ ****************************************************************************/
+
+#if CONFIG_NET_TCP_ALLOC_CONNS > 0
+void tcp_conn_reserve(int count);
+#endif
+
 /****************************************************************************
  * Name: tcp_free_rx_buffers
  *
@@ -936,6 +1075,54 @@ void tcp_nextsequence(void);
 
 void tcp_poll(FAR struct net_driver_s *dev, FAR struct tcp_conn_s *conn);
 
+#ifdef CONFIG_NET_TCP_TXREADYQ
+/****************************************************************************
+ * Name: tcp_txready
+ *
+ * Description:
+ *   Add a TCP connection to the TX-ready queue of the device that it is
+ *   bound to.  Device polls visit only queued connections, so this must be
+ *   called whenever the connection acquires TX work that will be carried
+ *   out by a subsequent device poll.  The call is a no-op if the
+ *   connection is already queued or is not yet bound to a device.
+ *
+ * Input Parameters:
+ *   conn - The TCP connection with pending TX work
+ *
+ * Returned Value:
+ *   None
+ *
+ * Assumptions:
+ *   Called from network stack logic with the network stack locked
+ *
+ ****************************************************************************/
+
+void tcp_txready(FAR struct tcp_conn_s *conn);
+
+/****************************************************************************
+ * Name: tcp_txready_pending
+ *
+ * Description:
+ *   Check if a TCP connection still has TX work that depends on device
+ *   polls:  a pending timer expiration, buffered write data, or a
+ *   registered callback interested in TCP_POLL events.  Used by the
+ *   device poll logic to decide whether a connection just polled should
+ *   remain on the TX-ready queue.
+ *
+ * Input Parameters:
+ *   conn - The TCP connection to check
+ *
+ * Returned Value:
+ *   True if the connection should remain on the TX-ready queue
+ *
+ * Assumptions:
+ *   Called from network stack logic with the network stack locked
+ *
+ ****************************************************************************/
+
+bool tcp_txready_pending(FAR struct tcp_conn_s *conn);
+#endif
+
 /****************************************************************************
  * Name: tcp_timer
  *
@@ -1047,7 +1234,10 @@ void tcp_stop_timer(FAR struct tcp_conn_s *conn);
  * Name: tcp_findlistener
  *
  * Description:
- *   Return the connection listener for connections on this port (if any)
+ *   Return the connection listener for connections on this port (if any).
+ *   If several listeners share the address/port pair (SO_REUSEPORT), the
+ *   flow identified by the remote address in 'uaddr' and the remote port
+ *   'rport' is assigned to one of them by a hash of the 4-tuple.
  *
  * Assumptions:
  *   The network is locked
@@ -1056,11 +1246,11 @@ void tcp_stop_timer(FAR struct tcp_conn_s *conn);
 
 #if defined(CONFIG_NET_IPv4) && defined(CONFIG_NET_IPv6)
 FAR struct tcp_conn_s *tcp_findlistener(FAR union ip_binding_u *uaddr,
-                                        uint16_t portno,
+                                        uint16_t portno, uint16_t rport,
                                         uint8_t domain);
 #else
 FAR struct tcp_conn_s *tcp_findlistener(FAR union ip_binding_u *uaddr,
-                                        uint16_t portno);
+                                        uint16_t portno, uint16_t rport);
 #endif
 
 /****************************************************************************
@@ -1726,6 +1916,27 @@ uint32_t tcp_get_recvwindow(FAR struct net_driver_s *dev,
 
 bool tcp_should_send_recvwindow(FAR struct tcp_conn_s *conn);
 
+/****************************************************************************
+ * Name: tcp_rcvbuf_autotune
+ *
+ * Description:
+ *   Adjust the connection receive buffer limit to the rate at which the
+ *   application drains the connection.  Called whenever data has been
+ *   copied out to the application.
+ *
+ * Input Parameters:
+ *   conn   - The TCP connection structure holding connection information.
+ *   copied - The number of bytes just copied to the application.
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_TCP_RECVBUF_AUTOTUNE
+void tcp_rcvbuf_autotune(FAR struct tcp_conn_s *conn, uint32_t copied);
+#endif
+
 /****************************************************************************
  * Name: psock_tcp_cansend
  *
@@ -129,7 +129,7 @@ void tcp_appsend(FAR struct net_driver_s *dev, FAR struct tcp_conn_s *conn,
        *    traffic and better performance but seems non-compliant.
        */
 
-      if (conn->rx_unackseg > 0 || dev->d_sndlen > 0 ||
+      if (conn->rx_quickack || conn->rx_unackseg > 0 || dev->d_sndlen > 0 ||
           result != TCP_SNDACK)
         {
           /* Reset the delayed ACK state and send the ACK with this packet. */
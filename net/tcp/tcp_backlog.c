@@ -129,6 +129,19 @@ int tcp_backlogcreate(FAR struct tcp_conn_s *conn, int nblg)
 
   conn->backlog = bls;
   net_unlock();
+
+#if CONFIG_NET_TCP_ALLOC_CONNS > 0
+  /* Make sure that the free connection list can cover the backlog depth
+   * so that an initial burst of incoming connections does not have to
+   * allocate connection structures under the network lock.
+   */
+
+  if (nblg > 0)
+    {
+      tcp_conn_reserve(nblg);
+    }
+#endif
+
   return OK;
 }
 
@@ -29,55 +29,81 @@
 #include "tcp/tcp.h"
 
 /****************************************************************************
- * Pre-processor Definitions
+ * Private Functions
  ****************************************************************************/
 
-#define TCP_IPV4_DEFAULT_MSS 536
-
-/* Initial Window threshold constants */
-
-#define IW_MAX 4380          /* Initial Window maximum */
-#define IW_MAX_HALF 2190
-#define IW_MAX_QUATER 1095
-
-/* Calculate the Initial Window, also used as Restart Window
- * RFC5681 Section 3.1 specifies the default conservative values.
- */
-
-#define CC_INIT_CWND(cwnd, mss) \
- do { \
-  if ((mss) > IW_MAX_HALF) \
-    { \
-      (cwnd) = 2 * (mss); \
-    } \
-  else if ((mss) > IW_MAX_QUATER) \
-    { \
-      (cwnd) = 3 * (mss); \
-    } \
-  else \
-    { \
-      (cwnd) = 4 * (mss); \
-    } \
- } while(0)
-
-/* Increments a size inc and holds at max value rather than rollover. */
-
-#define CC_CWND_INC(wnd, inc) \
- do { \
-  if ((uint32_t)((wnd) + (inc)) >= (wnd)) \
-    { \
-      (wnd) = (uint32_t)((wnd) + (inc)); \
-    } \
-  else \
-    { \
-      (wnd) = (uint32_t)-1; \
-    } \
- } while(0)
+/****************************************************************************
+ * Name: tcp_newreno_ssthresh
+ *
+ * Description:
+ *   Return the new slow start threshold after a loss event.
+ *   ssthresh = max (FlightSize / 2, 2*SMSS) referring to rfc5681
+ *
+ * Input Parameters:
+ *   conn   - The TCP connection of interest
+ *
+ * Returned Value:
+ *   The new slow start threshold in bytes
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+static uint32_t tcp_newreno_ssthresh(FAR struct tcp_conn_s *conn)
+{
+  return MAX(conn->tx_unacked / 2, 2 * conn->mss);
+}
 
 /****************************************************************************
- * Private Functions
+ * Name: tcp_newreno_cong_avoid
+ *
+ * Description:
+ *   Grow the congestion window on an ACK for new data while in the
+ *   congestion avoidance phase.
+ *
+ * Input Parameters:
+ *   conn   - The TCP connection of interest
+ *
+ * Returned Value:
+ *   None
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+static void tcp_newreno_cong_avoid(FAR struct tcp_conn_s *conn)
+{
+  uint32_t increase;
+
+  /* cong avoid (RFC 5681):
+   * Grow cwnd linearly by approximately maxseg per RTT using
+   * maxseg^2 / cwnd per ACK as the increment.
+   * If cwnd > maxseg^2, fix the cwnd increment at 1 byte to
+   * avoid capping cwnd.
+   */
+
+  increase = MAX((conn->mss * conn->mss / conn->cwnd), 1);
+
+  CC_CWND_INC(conn->cwnd, increase);
+  conn->cwnd = MIN(conn->cwnd, conn->max_cwnd);
+  ninfo("update congestion avoidance cwnd to %u\n", conn->cwnd);
+}
+
+/****************************************************************************
+ * Private Data
  ****************************************************************************/
 
+static const struct tcp_cc_ops_s g_tcp_cc_newreno =
+{
+  "newreno",               /* name */
+  NULL,                    /* init */
+  tcp_newreno_ssthresh,    /* ssthresh */
+  tcp_newreno_cong_avoid,  /* cong_avoid */
+  NULL                     /* pace */
+};
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -103,6 +129,14 @@
 
 void tcp_cc_init(FAR struct tcp_conn_s *conn)
 {
+  /* Select the congestion control algorithm for this connection */
+
+#ifdef CONFIG_NET_TCP_CC_CUBIC
+  conn->cc_ops = &g_tcp_cc_cubic;
+#else
+  conn->cc_ops = &g_tcp_cc_newreno;
+#endif
+
   CC_INIT_CWND(conn->cwnd, conn->mss);
 
   /* RFC 5681 recommends setting ssthresh arbitrarily high and
@@ -117,6 +151,11 @@ void tcp_cc_init(FAR struct tcp_conn_s *conn)
 
   conn->ssthresh = 2 * TCP_IPV4_DEFAULT_MSS;
   conn->dupacks = 0;
+
+  if (conn->cc_ops->init != NULL)
+    {
+      conn->cc_ops->init(conn);
+    }
 }
 
 /****************************************************************************
@@ -148,7 +187,7 @@ void tcp_cc_update(FAR struct tcp_conn_s *conn, FAR struct tcp_hdr_s *tcp)
 
   if (conn->flags & TCP_INFT)
     {
-      conn->ssthresh = MAX(conn->tx_unacked / 2, 2 * conn->mss);
+      conn->ssthresh = conn->cc_ops->ssthresh(conn);
       conn->cwnd = conn->ssthresh + 3 * conn->mss;
 
       conn->flags &= ~TCP_INFT;
@@ -284,18 +323,11 @@ void tcp_cc_recv_ack(FAR struct tcp_conn_s *conn, FAR struct tcp_hdr_s *tcp)
             }
           else
             {
-              /* cong avoid (RFC 5681):
-               * Grow cwnd linearly by approximately maxseg per RTT using
-               * maxseg^2 / cwnd per ACK as the increment.
-               * If cwnd > maxseg^2, fix the cwnd increment at 1 byte to
-               * avoid capping cwnd.
+              /* Congestion avoidance is where the algorithms differ;
+               * delegate the window growth to the selected module.
                */
 
-              increase = MAX((conn->mss * conn->mss / conn->cwnd), 1);
-
-              CC_CWND_INC(conn->cwnd, increase);
-              conn->cwnd = MIN(conn->cwnd, conn->max_cwnd);
-              ninfo("update congestion avoidance cwnd to %u\n", conn->cwnd);
+              conn->cc_ops->cong_avoid(conn);
             }
         }
     }
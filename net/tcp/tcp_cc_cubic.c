@@ -0,0 +1,307 @@
+/****************************************************************************
+ * net/tcp/tcp_cc_cubic.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <debug.h>
+
+#include <nuttx/clock.h>
+
+#include "tcp/tcp.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* The CUBIC window growth function (RFC 8312):
+ *
+ *   W(t) = C * (t - K)^3 + Wmax
+ *
+ * where Wmax is the window size just before the last reduction, t is the
+ * time since that reduction and K is the time at which the curve crosses
+ * Wmax again.  The constants C = 0.4 and beta = 0.7 are kept scaled by
+ * 1024 for integer arithmetic, and time is kept in 1/64 second units so
+ * that the cube of a multi-second epoch still fits in 64 bits.
+ */
+
+#define CUBIC_SHIFT       10
+#define CUBIC_C_SCALED    410   /* C = 0.4, scaled by 1024 */
+#define CUBIC_BETA_SCALED 717   /* beta = 0.7, scaled by 1024 */
+#define CUBIC_HZ          64    /* Time units per second */
+
+/* K = cbrt(Wmax * (1 - beta) / C) seconds.  With the window difference in
+ * segments and K in 1/64 second units:
+ *
+ *   K = cbrt(dseg / 0.4 * 64^3) = cbrt(dseg * 655360)
+ */
+
+#define CUBIC_K_FACTOR    655360
+
+/* C * d^3, with d in 1/64 second units, yields segments scaled by
+ * 1024 * 64^3 = 2^28.
+ */
+
+#define CUBIC_CUBE_SHIFT  28
+
+/* Bound the epoch time difference so that CUBIC_C_SCALED * d^3 cannot
+ * overflow 64 bits (2^18 units is more than an hour).
+ */
+
+#define CUBIC_TIME_MAX    (1 << 18)
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: tcp_cubic_time
+ *
+ * Description:
+ *   Return the current time in 1/64 second units.
+ *
+ ****************************************************************************/
+
+static uint32_t tcp_cubic_time(void)
+{
+  return (uint32_t)((uint64_t)TICK2MSEC(clock_systime_ticks()) *
+                    CUBIC_HZ / MSEC_PER_SEC);
+}
+
+/****************************************************************************
+ * Name: tcp_cubic_cbrt
+ *
+ * Description:
+ *   Compute the integer cube root of 'a' using a shift-and-subtract
+ *   algorithm, two bits of result per iteration.
+ *
+ ****************************************************************************/
+
+static uint32_t tcp_cubic_cbrt(uint64_t a)
+{
+  uint64_t b;
+  uint64_t x = 0;
+  int s;
+
+  for (s = 63; s >= 0; s -= 3)
+    {
+      x <<= 1;
+      b = 3 * x * (x + 1) + 1;
+      if ((a >> s) >= b)
+        {
+          a -= b << s;
+          x++;
+        }
+    }
+
+  return (uint32_t)x;
+}
+
+/****************************************************************************
+ * Name: tcp_cubic_init
+ *
+ * Description:
+ *   Reset the CUBIC state when a new connection is started.
+ *
+ * Input Parameters:
+ *   conn   - The TCP connection of interest
+ *
+ * Returned Value:
+ *   None
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+static void tcp_cubic_init(FAR struct tcp_conn_s *conn)
+{
+  conn->cc_wmax  = 0;
+  conn->cc_k     = 0;
+  conn->cc_epoch = 0;
+}
+
+/****************************************************************************
+ * Name: tcp_cubic_ssthresh
+ *
+ * Description:
+ *   Return the new slow start threshold after a loss event.  CUBIC
+ *   reduces by beta = 0.7 rather than halving, records the window at
+ *   which the loss occurred and starts a new growth epoch.
+ *
+ * Input Parameters:
+ *   conn   - The TCP connection of interest
+ *
+ * Returned Value:
+ *   The new slow start threshold in bytes
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+static uint32_t tcp_cubic_ssthresh(FAR struct tcp_conn_s *conn)
+{
+  uint32_t cwnd = conn->cwnd;
+
+  /* Fast convergence (RFC 8312 4.6):  If the loss happened before the
+   * window regrew to the previous Wmax, there is probably a new flow
+   * competing for the path; release bandwidth to it by remembering an
+   * even smaller Wmax.
+   */
+
+  if (cwnd < conn->cc_wmax)
+    {
+      conn->cc_wmax = (uint32_t)((uint64_t)cwnd *
+                                 (1024 + CUBIC_BETA_SCALED) / 2048);
+    }
+  else
+    {
+      conn->cc_wmax = cwnd;
+    }
+
+  /* The growth epoch restarts on the first congestion avoidance ACK */
+
+  conn->cc_epoch = 0;
+
+  return MAX((uint32_t)(((uint64_t)cwnd * CUBIC_BETA_SCALED) >>
+                        CUBIC_SHIFT),
+             2 * conn->mss);
+}
+
+/****************************************************************************
+ * Name: tcp_cubic_cong_avoid
+ *
+ * Description:
+ *   Grow the congestion window on an ACK for new data while in the
+ *   congestion avoidance phase.  The window is steered toward the value
+ *   of the cubic function at the current epoch time:  Concave regrowth
+ *   to Wmax, a plateau around it and convex probing beyond it.
+ *
+ * Input Parameters:
+ *   conn   - The TCP connection of interest
+ *
+ * Returned Value:
+ *   None
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+static void tcp_cubic_cong_avoid(FAR struct tcp_conn_s *conn)
+{
+  uint32_t now = tcp_cubic_time();
+  uint32_t increase = 1;
+  uint32_t cwnd_seg;
+  uint32_t wmax_seg;
+  uint32_t target_seg;
+  uint32_t offs_seg;
+  uint64_t d;
+
+  if (conn->mss == 0 || conn->cwnd == 0)
+    {
+      return;
+    }
+
+  /* On the first congestion avoidance ACK after a loss (or after slow
+   * start first exceeds ssthresh), start a new growth epoch and compute
+   * the time K at which the cubic reaches the old Wmax again.
+   */
+
+  if (conn->cc_epoch == 0)
+    {
+      conn->cc_epoch = now != 0 ? now : 1;
+
+      if (conn->cwnd < conn->cc_wmax)
+        {
+          conn->cc_k =
+            tcp_cubic_cbrt((uint64_t)((conn->cc_wmax - conn->cwnd) /
+                                      conn->mss) * CUBIC_K_FACTOR);
+        }
+      else
+        {
+          /* Already at or above the old Wmax; the origin of the cubic
+           * is the current window and growth is convex immediately.
+           */
+
+          conn->cc_k    = 0;
+          conn->cc_wmax = conn->cwnd;
+        }
+    }
+
+  cwnd_seg = conn->cwnd / conn->mss;
+  wmax_seg = conn->cc_wmax / conn->mss;
+
+  /* Evaluate the cubic at the current epoch time.  The distance from K
+   * is cubed, so compute its magnitude and apply the sign afterward.
+   */
+
+  d = now - conn->cc_epoch;
+  d = d > CUBIC_TIME_MAX ? CUBIC_TIME_MAX : d;
+
+  if (d >= conn->cc_k)
+    {
+      d = d - conn->cc_k;
+      offs_seg = (uint32_t)((CUBIC_C_SCALED * d * d * d) >>
+                            CUBIC_CUBE_SHIFT);
+      target_seg = wmax_seg + offs_seg;
+    }
+  else
+    {
+      d = conn->cc_k - d;
+      offs_seg = (uint32_t)((CUBIC_C_SCALED * d * d * d) >>
+                            CUBIC_CUBE_SHIFT);
+      target_seg = wmax_seg > offs_seg ? wmax_seg - offs_seg : 0;
+    }
+
+  /* Steer cwnd toward the target over roughly one RTT of ACKs.  When at
+   * or beyond the target (the plateau around Wmax), creep forward by one
+   * byte per ACK so that the plateau is eventually left even if the
+   * clock resolution is poor.
+   */
+
+  if (target_seg > cwnd_seg)
+    {
+      increase = MAX((uint32_t)((uint64_t)(target_seg - cwnd_seg) *
+                                conn->mss * conn->mss / conn->cwnd), 1);
+    }
+
+  CC_CWND_INC(conn->cwnd, increase);
+  conn->cwnd = MIN(conn->cwnd, conn->max_cwnd);
+  ninfo("update cubic cwnd to %u (target %u segs)\n",
+        conn->cwnd, target_seg);
+}
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+const struct tcp_cc_ops_s g_tcp_cc_cubic =
+{
+  "cubic",               /* name */
+  tcp_cubic_init,        /* init */
+  tcp_cubic_ssthresh,    /* ssthresh */
+  tcp_cubic_cong_avoid,  /* cong_avoid */
+  NULL                   /* pace */
+};
@@ -58,6 +58,7 @@
 
 #include <nuttx/clock.h>
 #include <nuttx/kmalloc.h>
+#include <nuttx/mutex.h>
 #include <nuttx/net/netconfig.h>
 #include <nuttx/net/net.h>
 #include <nuttx/net/netdev.h>
@@ -83,18 +84,148 @@
 static struct tcp_conn_s g_tcp_connections[CONFIG_NET_TCP_PREALLOC_CONNS];
 #endif
 
-/* A list of all free TCP connections */
+/* A list of all free TCP connections.  The free list has its own lock,
+ * like the UDP one, so that connection setup and teardown bookkeeping
+ * does not serialize against packet processing under the network lock.
+ */
 
 static dq_queue_t g_free_tcp_connections;
+static mutex_t g_free_lock = NXMUTEX_INITIALIZER;
 
 /* A list of all connected TCP connections */
 
 static dq_queue_t g_active_tcp_connections;
 
+#ifdef CONFIG_NET_TCP_CONN_HASH
+/* Hash table used to demultiplex inbound segments.  Every connection on
+ * the active list is also chained (via conn->hashnext) into the bucket
+ * selected by its remote address, remote port and local port.  The local
+ * address is deliberately not part of the key since it may be the
+ * unspecified address, which must match any destination.
+ */
+
+static FAR struct tcp_conn_s *
+  g_tcp_conn_hashtab[CONFIG_NET_TCP_CONN_HASH_SIZE];
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
+#ifdef CONFIG_NET_TCP_CONN_HASH
+/****************************************************************************
+ * Name: tcp_conn_hashndx_ipv4/tcp_conn_hashndx_ipv6
+ *
+ * Description:
+ *   Map the demux tuple (remote address, remote port, local port) to a
+ *   bucket of the connection hash table.  Addresses and ports are used
+ *   in network byte order on both the insert and the lookup side, so no
+ *   conversions are needed.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_IPv4
+static int tcp_conn_hashndx_ipv4(in_addr_t raddr, uint16_t rport,
+                                 uint16_t lport)
+{
+  uint32_t key = raddr ^ ((uint32_t)rport << 16) ^ lport;
+
+  key ^= key >> 16;
+  return key % CONFIG_NET_TCP_CONN_HASH_SIZE;
+}
+#endif
+
+#ifdef CONFIG_NET_IPv6
+static int tcp_conn_hashndx_ipv6(const net_ipv6addr_t raddr, uint16_t rport,
+                                 uint16_t lport)
+{
+  uint32_t key = ((uint32_t)rport << 16) ^ lport;
+  int i;
+
+  for (i = 0; i < 8; i++)
+    {
+      key = (key << 5) + key + raddr[i];
+    }
+
+  key ^= key >> 16;
+  return key % CONFIG_NET_TCP_CONN_HASH_SIZE;
+}
+#endif
+
+/****************************************************************************
+ * Name: tcp_conn_hashndx
+ *
+ * Description:
+ *   Return the hash bucket that the given connection belongs in.
+ *
+ ****************************************************************************/
+
+static int tcp_conn_hashndx(FAR struct tcp_conn_s *conn)
+{
+#ifdef CONFIG_NET_IPv4
+#ifdef CONFIG_NET_IPv6
+  if (conn->domain == PF_INET)
+#endif
+    {
+      return tcp_conn_hashndx_ipv4(conn->u.ipv4.raddr, conn->rport,
+                                   conn->lport);
+    }
+#endif /* CONFIG_NET_IPv4 */
+
+#ifdef CONFIG_NET_IPv6
+#ifdef CONFIG_NET_IPv4
+  else
+#endif
+    {
+      return tcp_conn_hashndx_ipv6(conn->u.ipv6.raddr, conn->rport,
+                                   conn->lport);
+    }
+#endif /* CONFIG_NET_IPv6 */
+}
+
+/****************************************************************************
+ * Name: tcp_conn_hash_insert
+ *
+ * Description:
+ *   Chain the connection into the demux hash table.  Must be called
+ *   after the address binding and the port numbers are final, i.e. when
+ *   the connection is added to the active list.
+ *
+ ****************************************************************************/
+
+static void tcp_conn_hash_insert(FAR struct tcp_conn_s *conn)
+{
+  int ndx = tcp_conn_hashndx(conn);
+
+  conn->hashnext          = g_tcp_conn_hashtab[ndx];
+  g_tcp_conn_hashtab[ndx] = conn;
+}
+
+/****************************************************************************
+ * Name: tcp_conn_hash_remove
+ *
+ * Description:
+ *   Unchain the connection from the demux hash table.
+ *
+ ****************************************************************************/
+
+static void tcp_conn_hash_remove(FAR struct tcp_conn_s *conn)
+{
+  FAR struct tcp_conn_s **prev;
+
+  prev = &g_tcp_conn_hashtab[tcp_conn_hashndx(conn)];
+  for (; *prev != NULL; prev = &(*prev)->hashnext)
+    {
+      if (*prev == conn)
+        {
+          *prev          = conn->hashnext;
+          conn->hashnext = NULL;
+          return;
+        }
+    }
+}
+#endif /* CONFIG_NET_TCP_CONN_HASH */
+
 /****************************************************************************
  * Name: tcp_listener
  *
@@ -189,10 +320,21 @@ static inline FAR struct tcp_conn_s *
   in_addr_t srcipaddr;
   in_addr_t destipaddr;
 
-  conn       = (FAR struct tcp_conn_s *)g_active_tcp_connections.head;
   srcipaddr  = net_ip4addr_conv32(ip->srcipaddr);
   destipaddr = net_ip4addr_conv32(ip->destipaddr);
 
+#ifdef CONFIG_NET_TCP_CONN_HASH
+  /* Only connections whose demux tuple equals that of the segment can
+   * match the checks below, and all of those hash to this one bucket.
+   */
+
+  conn       = g_tcp_conn_hashtab[tcp_conn_hashndx_ipv4(srcipaddr,
+                                                        tcp->srcport,
+                                                        tcp->destport)];
+#else
+  conn       = (FAR struct tcp_conn_s *)g_active_tcp_connections.head;
+#endif
+
   while (conn)
     {
       /* Find an open connection matching the TCP input. The following
@@ -226,9 +368,13 @@ static inline FAR struct tcp_conn_s *
           break;
         }
 
-      /* Look at the next active connection */
+      /* Look at the next candidate connection */
 
+#ifdef CONFIG_NET_TCP_CONN_HASH
+      conn = conn->hashnext;
+#else
       conn = (FAR struct tcp_conn_s *)conn->sconn.node.flink;
+#endif
     }
 
   return conn;
@@ -256,10 +402,21 @@ static inline FAR struct tcp_conn_s *
   net_ipv6addr_t *srcipaddr;
   net_ipv6addr_t *destipaddr;
 
-  conn       = (FAR struct tcp_conn_s *)g_active_tcp_connections.head;
   srcipaddr  = (net_ipv6addr_t *)ip->srcipaddr;
   destipaddr = (net_ipv6addr_t *)ip->destipaddr;
 
+#ifdef CONFIG_NET_TCP_CONN_HASH
+  /* Only connections whose demux tuple equals that of the segment can
+   * match the checks below, and all of those hash to this one bucket.
+   */
+
+  conn       = g_tcp_conn_hashtab[tcp_conn_hashndx_ipv6(*srcipaddr,
+                                                        tcp->srcport,
+                                                        tcp->destport)];
+#else
+  conn       = (FAR struct tcp_conn_s *)g_active_tcp_connections.head;
+#endif
+
   while (conn)
     {
       /* Find an open connection matching the TCP input. The following
@@ -293,9 +450,13 @@ static inline FAR struct tcp_conn_s *
           break;
         }
 
-      /* Look at the next active connection */
+      /* Look at the next candidate connection */
 
+#ifdef CONFIG_NET_TCP_CONN_HASH
+      conn = conn->hashnext;
+#else
       conn = (FAR struct tcp_conn_s *)conn->sconn.node.flink;
+#endif
     }
 
   return conn;
@@ -513,12 +674,14 @@ static FAR struct tcp_conn_s *tcp_alloc_conn(void)
 
   /* Return the entry from the head of the free list */
 
+  nxmutex_lock(&g_free_lock);
   if (dq_peek(&g_free_tcp_connections) == NULL)
     {
 #if CONFIG_NET_TCP_MAX_CONNS > 0
       if (dq_count(&g_active_tcp_connections) +
           CONFIG_NET_TCP_ALLOC_CONNS > CONFIG_NET_TCP_MAX_CONNS)
         {
+          nxmutex_unlock(&g_free_lock);
           return NULL;
         }
 #endif
@@ -527,6 +690,7 @@ static FAR struct tcp_conn_s *tcp_alloc_conn(void)
                         CONFIG_NET_TCP_ALLOC_CONNS);
       if (conn == NULL)
         {
+          nxmutex_unlock(&g_free_lock);
           return conn;
         }
 
@@ -541,7 +705,9 @@ static FAR struct tcp_conn_s *tcp_alloc_conn(void)
         }
     }
 
-  return (FAR struct tcp_conn_s *)dq_remfirst(&g_free_tcp_connections);
+  conn = (FAR struct tcp_conn_s *)dq_remfirst(&g_free_tcp_connections);
+  nxmutex_unlock(&g_free_lock);
+  return conn;
 }
 #endif
 
@@ -663,6 +829,61 @@ void tcp_initialize(void)
 #endif
 }
 
+/****************************************************************************
+ * Name: tcp_conn_reserve
+ *
+ * Description:
+ *   Grow the free connection list until it holds at least 'count' entries,
+ *   so that a following burst of incoming connections can be accepted from
+ *   the free list without allocating under the network lock.  Called from
+ *   the listen() logic with the expected backlog depth.  Best-effort: the
+ *   reservation stops silently at the connection limit or when the heap
+ *   is exhausted.
+ *
+ ****************************************************************************/
+
+#if CONFIG_NET_TCP_ALLOC_CONNS > 0
+void tcp_conn_reserve(int count)
+{
+  FAR struct tcp_conn_s *conn;
+  int i;
+
+  nxmutex_lock(&g_free_lock);
+  while (dq_count(&g_free_tcp_connections) < count)
+    {
+#if CONFIG_NET_TCP_MAX_CONNS > 0
+      if (dq_count(&g_active_tcp_connections) +
+          CONFIG_NET_TCP_ALLOC_CONNS > CONFIG_NET_TCP_MAX_CONNS)
+        {
+          break;
+        }
+#endif
+
+      /* Extend the free list in the same batch unit used by
+       * tcp_alloc_conn() so that the free logic in tcp_free() applies
+       * to the reserved connections unchanged.
+       */
+
+      conn = kmm_zalloc(sizeof(struct tcp_conn_s) *
+                        CONFIG_NET_TCP_ALLOC_CONNS);
+      if (conn == NULL)
+        {
+          break;
+        }
+
+      for (i = 0; i < CONFIG_NET_TCP_ALLOC_CONNS; i++)
+        {
+          /* Mark the connection closed and move it to the free list */
+
+          conn[i].tcpstateflags = TCP_CLOSED;
+          dq_addlast(&conn[i].sconn.node, &g_free_tcp_connections);
+        }
+    }
+
+  nxmutex_unlock(&g_free_lock);
+}
+#endif
+
 /****************************************************************************
  * Name: tcp_alloc
  *
@@ -678,16 +899,16 @@ FAR struct tcp_conn_s *tcp_alloc(uint8_t domain)
 {
   FAR struct tcp_conn_s *conn;
 
-  /* Because this routine is called from both event processing (with the
-   * network locked) and and from user level.  Make sure that the network
-   * locked in any cased while accessing g_free_tcp_connections[];
+  /* The free list is protected by its own mutex so that the common case
+   * (an entry is available) does not need the network lock at all.
    */
 
-  net_lock();
+  nxmutex_lock(&g_free_lock);
 
   /* Return the entry from the head of the free list */
 
   conn = (FAR struct tcp_conn_s *)dq_remfirst(&g_free_tcp_connections);
+  nxmutex_unlock(&g_free_lock);
 
 #ifndef CONFIG_NET_SOLINGER
   /* Is the free list empty? */
@@ -697,11 +918,14 @@ FAR struct tcp_conn_s *tcp_alloc(uint8_t domain)
       /* As a fall-back, check for connection structures which can be
        * stalled.
        * Search the active connection list for the oldest connection
-       * that is about to be closed anyway.
+       * that is about to be closed anyway.  This walk must run with
+       * the network locked.
        */
 
-      FAR struct tcp_conn_s *tmp =
-        (FAR struct tcp_conn_s *)g_active_tcp_connections.head;
+      FAR struct tcp_conn_s *tmp;
+
+      net_lock();
+      tmp = (FAR struct tcp_conn_s *)g_active_tcp_connections.head;
 
       while (tmp)
         {
@@ -760,9 +984,13 @@ FAR struct tcp_conn_s *tcp_alloc(uint8_t domain)
            * a new connection.
            */
 
+          nxmutex_lock(&g_free_lock);
           conn = (FAR struct tcp_conn_s *)
             dq_remfirst(&g_free_tcp_connections);
+          nxmutex_unlock(&g_free_lock);
         }
+
+      net_unlock();
     }
 #endif
 
@@ -771,12 +999,17 @@ FAR struct tcp_conn_s *tcp_alloc(uint8_t domain)
 #if CONFIG_NET_TCP_ALLOC_CONNS > 0
   if (conn == NULL)
     {
+      /* The network lock covers the active-connection count check in
+       * tcp_alloc_conn(); the free list manipulation takes the free
+       * list lock inside.
+       */
+
+      net_lock();
       conn = tcp_alloc_conn();
+      net_unlock();
     }
 #endif
 
-  net_unlock();
-
   /* Mark the connection allocated */
 
   if (conn)
@@ -876,9 +1109,9 @@ void tcp_free(FAR struct tcp_conn_s *conn)
   FAR struct tcp_wrbuffer_s *wrbuffer;
 #endif
 
-  /* Because g_free_tcp_connections is accessed from user level and event
-   * processing logic, it is necessary to keep the network locked during this
-   * operation.
+  /* The active list, the timers and the callbacks are all protected by
+   * the network lock.  The free list itself is protected by g_free_lock
+   * and is only touched at the very end.
    */
 
   net_lock();
@@ -904,6 +1137,16 @@ void tcp_free(FAR struct tcp_conn_s *conn)
 
   tcp_stop_monitor(conn, TCP_CLOSE);
 
+#ifdef CONFIG_NET_TCP_TXREADYQ
+  /* Remove the connection from the device TX-ready queue */
+
+  if (conn->tx_ready)
+    {
+      sq_rem(&conn->tx_node, &conn->dev->d_txready);
+      conn->tx_ready = false;
+    }
+#endif
+
   /* Free remaining callbacks, actually there should be only the send
    * callback for CONFIG_NET_TCP_WRITE_BUFFERS is left.
    */
@@ -923,6 +1166,9 @@ void tcp_free(FAR struct tcp_conn_s *conn)
       /* Remove the connection from the active list */
 
       dq_rem(&conn->sconn.node, &g_active_tcp_connections);
+#ifdef CONFIG_NET_TCP_CONN_HASH
+      tcp_conn_hash_remove(conn);
+#endif
     }
 
   tcp_free_rx_buffers(conn);
@@ -985,7 +1231,9 @@ void tcp_free(FAR struct tcp_conn_s *conn)
   else
 #endif
     {
+      nxmutex_lock(&g_free_lock);
       dq_addlast(&conn->sconn.node, &g_free_tcp_connections);
+      nxmutex_unlock(&g_free_lock);
     }
 
   net_unlock();
@@ -1232,6 +1480,9 @@ FAR struct tcp_conn_s *tcp_alloc_accept(FAR struct net_driver_s *dev,
        */
 
       dq_addlast(&conn->sconn.node, &g_active_tcp_connections);
+#ifdef CONFIG_NET_TCP_CONN_HASH
+      tcp_conn_hash_insert(conn);
+#endif
       tcp_update_retrantimer(conn, TCP_RTO);
     }
 
@@ -1543,6 +1794,9 @@ int tcp_connect(FAR struct tcp_conn_s *conn, FAR const struct sockaddr *addr)
   /* And, finally, put the connection structure into the active list. */
 
   dq_addlast(&conn->sconn.node, &g_active_tcp_connections);
+#ifdef CONFIG_NET_TCP_CONN_HASH
+  tcp_conn_hash_insert(conn);
+#endif
   ret = OK;
 
 errout_with_lock:
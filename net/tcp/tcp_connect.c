@@ -344,6 +344,9 @@ int psock_tcp_connect(FAR struct socket *psock,
 
       /* Notify the device driver that new connection is available. */
 
+#ifdef CONFIG_NET_TCP_TXREADYQ
+      tcp_txready(conn);
+#endif
       netdev_txnotify_dev(conn->dev);
 
       /* Non-blocking connection ? set the socket error
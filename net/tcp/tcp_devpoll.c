@@ -128,4 +128,96 @@ void tcp_poll(FAR struct net_driver_s *dev, FAR struct tcp_conn_s *conn)
     }
 }
 
+#ifdef CONFIG_NET_TCP_TXREADYQ
+/****************************************************************************
+ * Name: tcp_txready
+ *
+ * Description:
+ *   Add a TCP connection to the TX-ready queue of the device that it is
+ *   bound to.  Device polls visit only queued connections, so this must be
+ *   called whenever the connection acquires TX work that will be carried
+ *   out by a subsequent device poll.  The call is a no-op if the
+ *   connection is already queued or is not yet bound to a device.
+ *
+ * Input Parameters:
+ *   conn - The TCP connection with pending TX work
+ *
+ * Returned Value:
+ *   None
+ *
+ * Assumptions:
+ *   It is called with the network locked.
+ *
+ ****************************************************************************/
+
+void tcp_txready(FAR struct tcp_conn_s *conn)
+{
+  if (!conn->tx_ready && conn->dev != NULL)
+    {
+      sq_addlast(&conn->tx_node, &conn->dev->d_txready);
+      conn->tx_ready = true;
+    }
+}
+
+/****************************************************************************
+ * Name: tcp_txready_pending
+ *
+ * Description:
+ *   Check if a TCP connection still has TX work that depends on device
+ *   polls:  a pending timer expiration, buffered write data, or a
+ *   registered callback interested in TCP_POLL events.  Used by the
+ *   device poll logic to decide whether a connection just polled should
+ *   remain on the TX-ready queue.
+ *
+ * Input Parameters:
+ *   conn - The TCP connection to check
+ *
+ * Returned Value:
+ *   True if the connection should remain on the TX-ready queue
+ *
+ * Assumptions:
+ *   It is called with the network locked.
+ *
+ ****************************************************************************/
+
+bool tcp_txready_pending(FAR struct tcp_conn_s *conn)
+{
+  FAR struct devif_callback_s *cb;
+
+  /* Timer expirations are carried out by the device poll */
+
+  if (conn->timeout)
+    {
+      return true;
+    }
+
+  for (cb = conn->sconn.list; cb != NULL; cb = cb->nxtconn)
+    {
+#ifdef CONFIG_NET_TCP_WRITE_BUFFERS
+      /* The write buffer callback stays registered for the life of the
+       * connection; it only acts on poll events while write data is
+       * actually buffered for transmission.
+       */
+
+      if (cb == conn->sndcb)
+        {
+          if (!sq_empty(&conn->write_q))
+            {
+              return true;
+            }
+
+          continue;
+        }
+#endif
+
+      if ((cb->flags & TCP_POLL) != 0)
+        {
+          return true;
+        }
+    }
+
+  return false;
+}
+#endif /* CONFIG_NET_TCP_TXREADYQ */
+
 #endif /* CONFIG_NET && CONFIG_NET_TCP */
@@ -212,9 +212,51 @@ int tcp_getsockopt(FAR struct socket *psock, int option,
           {
             FAR int *nodelay   = (FAR int *)value;
 
+#ifdef CONFIG_NET_TCP_AUTOCORK
+            *nodelay           = conn->nodelay;
+#else
             /* Always true here since we do not support Nagle. */
 
             *nodelay           = 1;
+#endif
+            *value_len         = sizeof(int);
+            ret                = OK;
+          }
+        break;
+
+#ifdef CONFIG_NET_TCP_CORK
+      case TCP_CORK:     /* Hold back partial segments until uncorked. */
+        if (*value_len < sizeof(int))
+          {
+            ret                = -EINVAL;
+          }
+        else
+          {
+            FAR int *corked    = (FAR int *)value;
+
+            *corked            = conn->corked;
+            *value_len         = sizeof(int);
+            ret                = OK;
+          }
+        break;
+#endif
+
+      case TCP_QUICKACK: /* Send ACKs immediately, overriding delayed ACK */
+        if (*value_len < sizeof(int))
+          {
+            ret                = -EINVAL;
+          }
+        else
+          {
+            FAR int *quickack  = (FAR int *)value;
+
+#ifdef CONFIG_NET_TCP_DELAYED_ACK
+            *quickack          = conn->rx_quickack;
+#else
+            /* Always true here since ACKs are never delayed. */
+
+            *quickack          = 1;
+#endif
             *value_len         = sizeof(int);
             ret                = OK;
           }
@@ -726,7 +726,8 @@ static void tcp_input(FAR struct net_driver_s *dev, uint8_t domain,
 #ifdef CONFIG_NET_TCP_CHECKSUMS
   /* Start of TCP input header processing code. */
 
-  if (tcp_chksum(dev) != 0xffff)
+  if (!NETDEV_HAS_HWCAP(dev, NETDEV_HWCAP_RX_CSUM) &&
+      tcp_chksum(dev) != 0xffff)
     {
       /* Compute and check the TCP checksum. */
 
@@ -781,6 +782,7 @@ static void tcp_input(FAR struct net_driver_s *dev, uint8_t domain,
 #  endif
         {
           net_ipv6addr_copy(&uaddr.ipv6.laddr, IPv6BUF->destipaddr);
+          net_ipv6addr_copy(&uaddr.ipv6.raddr, IPv6BUF->srcipaddr);
         }
 #endif
 
@@ -791,13 +793,16 @@ static void tcp_input(FAR struct net_driver_s *dev, uint8_t domain,
         {
           net_ipv4addr_copy(uaddr.ipv4.laddr,
                             net_ip4addr_conv32(IPv4BUF->destipaddr));
+          net_ipv4addr_copy(uaddr.ipv4.raddr,
+                            net_ip4addr_conv32(IPv4BUF->srcipaddr));
         }
 #endif
 
 #if defined(CONFIG_NET_IPv4) && defined(CONFIG_NET_IPv6)
-      if ((conn = tcp_findlistener(&uaddr, tmp16, domain)) != NULL)
+      if ((conn = tcp_findlistener(&uaddr, tmp16, tcp->srcport,
+                                   domain)) != NULL)
 #else
-      if ((conn = tcp_findlistener(&uaddr, tmp16)) != NULL)
+      if ((conn = tcp_findlistener(&uaddr, tmp16, tcp->srcport)) != NULL)
 #endif
         {
           if (!tcp_backlogavailable(conn))
@@ -893,6 +898,12 @@ reset:
 found:
   flags = 0;
 
+#ifdef CONFIG_NET_TCP_CONN_STATS
+  /* Bump up the count of segments received on this connection */
+
+  conn->stat_rxpkts++;
+#endif
+
   /* We do a very naive form of TCP reset processing; we just accept
    * any RST and kill our connection. We should in fact check if the
    * sequence number of this reset is within our advertised window
@@ -920,6 +931,7 @@ found:
 #  endif
             {
               net_ipv6addr_copy(&uaddr.ipv6.laddr, IPv6BUF->destipaddr);
+              net_ipv6addr_copy(&uaddr.ipv6.raddr, IPv6BUF->srcipaddr);
             }
 #endif
 
@@ -930,13 +942,16 @@ found:
             {
               net_ipv4addr_copy(uaddr.ipv4.laddr,
                                 net_ip4addr_conv32(IPv4BUF->destipaddr));
+              net_ipv4addr_copy(uaddr.ipv4.raddr,
+                                net_ip4addr_conv32(IPv4BUF->srcipaddr));
             }
 #endif
 
 #if defined(CONFIG_NET_IPv4) && defined(CONFIG_NET_IPv6)
-          listener = tcp_findlistener(&uaddr, conn->lport, domain);
+          listener = tcp_findlistener(&uaddr, conn->lport, conn->rport,
+                                      domain);
 #else
-          listener = tcp_findlistener(&uaddr, conn->lport);
+          listener = tcp_findlistener(&uaddr, conn->lport, conn->rport);
 #endif
 
           /* We must free this TCP connection structure; this connection
@@ -55,6 +55,7 @@
 
 #include "devif/devif.h"
 #include "inet/inet.h"
+#include "socket/socket.h"
 #include "tcp/tcp.h"
 
 /****************************************************************************
@@ -69,11 +70,135 @@ static FAR struct tcp_conn_s *tcp_listenports[CONFIG_NET_MAX_LISTENPORTS];
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: tcp_listener_match
+ *
+ * Description:
+ *   Return true if 'conn' is listening on the local address/port described
+ *   by 'uaddr' and 'portno'.
+ *
+ * Assumptions:
+ *   This function is called from network logic with the network locked.
+ *
+ ****************************************************************************/
+
+#if defined(CONFIG_NET_IPv4) && defined(CONFIG_NET_IPv6)
+static bool tcp_listener_match(FAR struct tcp_conn_s *conn,
+                               FAR union ip_binding_u *uaddr,
+                               uint16_t portno, uint8_t domain)
+#else
+static bool tcp_listener_match(FAR struct tcp_conn_s *conn,
+                               FAR union ip_binding_u *uaddr,
+                               uint16_t portno)
+#endif
+{
+  /* Is this slot assigned?  If so, does the connection have the same
+   * local port number?
+   */
+
+#if defined(CONFIG_NET_IPv4) && defined(CONFIG_NET_IPv6)
+  if (conn && conn->lport == portno && conn->domain == domain)
+#else
+  if (conn && conn->lport == portno)
+#endif
+    {
+#ifdef CONFIG_NET_IPv6
+#  ifdef CONFIG_NET_IPv4
+      if (domain == PF_INET6)
+#  endif
+        {
+          if (net_ipv6addr_cmp(conn->u.ipv6.laddr, uaddr->ipv6.laddr) ||
+              net_ipv6addr_cmp(conn->u.ipv6.laddr, g_ipv6_unspecaddr))
+            {
+              /* Yes.. we found a listener on this port */
+
+              return true;
+            }
+        }
+#endif
+
+#ifdef CONFIG_NET_IPv4
+#  ifdef CONFIG_NET_IPv6
+      if (domain == PF_INET)
+#  endif
+        {
+          if (net_ipv4addr_cmp(conn->u.ipv4.laddr, uaddr->ipv4.laddr) ||
+              net_ipv4addr_cmp(conn->u.ipv4.laddr, INADDR_ANY))
+            {
+              /* Yes.. we found a listener on this port */
+
+              return true;
+            }
+        }
+#endif
+    }
+
+  return false;
+}
+
+/****************************************************************************
+ * Name: tcp_listener_hash
+ *
+ * Description:
+ *   Compute a hash over the flow 4-tuple.  The hash selects which of
+ *   several SO_REUSEPORT listeners on the same address/port receives an
+ *   incoming connection, so the same flow must always yield the same
+ *   value each time a listener is looked up during the handshake.
+ *
+ * Assumptions:
+ *   This function is called from network logic with the network locked.
+ *
+ ****************************************************************************/
+
+#if defined(CONFIG_NET_IPv4) && defined(CONFIG_NET_IPv6)
+static uint32_t tcp_listener_hash(FAR union ip_binding_u *uaddr,
+                                  uint16_t portno, uint16_t rport,
+                                  uint8_t domain)
+#else
+static uint32_t tcp_listener_hash(FAR union ip_binding_u *uaddr,
+                                  uint16_t portno, uint16_t rport)
+#endif
+{
+  uint32_t hash = ((uint32_t)portno << 16) | rport;
+
+#ifdef CONFIG_NET_IPv6
+#  ifdef CONFIG_NET_IPv4
+  if (domain == PF_INET6)
+#  endif
+    {
+      int i;
+
+      for (i = 0; i < 8; i++)
+        {
+          hash ^= uaddr->ipv6.raddr[i];
+        }
+    }
+#endif
+
+#ifdef CONFIG_NET_IPv4
+#  ifdef CONFIG_NET_IPv6
+  if (domain == PF_INET)
+#  endif
+    {
+      hash ^= uaddr->ipv4.raddr;
+    }
+#endif
+
+  /* Mix so that the low-order bits depend on all of the inputs */
+
+  hash ^= hash >> 16;
+  hash ^= hash >> 8;
+  return hash;
+}
+
 /****************************************************************************
  * Name: tcp_findlistener
  *
  * Description:
- *   Return the connection listener for connections on this port (if any)
+ *   Return the connection listener for connections on this port (if any).
+ *   If several listeners share the address/port pair (SO_REUSEPORT), the
+ *   incoming flow is assigned to one of them by a hash of the 4-tuple so
+ *   that accept processing is spread across the listening sockets.
  *
  * Assumptions:
  *   This function is called from network logic with the network locked.
@@ -82,65 +207,70 @@ static FAR struct tcp_conn_s *tcp_listenports[CONFIG_NET_MAX_LISTENPORTS];
 
 #if defined(CONFIG_NET_IPv4) && defined(CONFIG_NET_IPv6)
 FAR struct tcp_conn_s *tcp_findlistener(FAR union ip_binding_u *uaddr,
-                                        uint16_t portno,
+                                        uint16_t portno, uint16_t rport,
                                         uint8_t domain)
 #else
 FAR struct tcp_conn_s *tcp_findlistener(FAR union ip_binding_u *uaddr,
-                                        uint16_t portno)
+                                        uint16_t portno, uint16_t rport)
 #endif
 {
+  FAR struct tcp_conn_s *first = NULL;
+  int nmatches = 0;
   int ndx;
 
   /* Examine each connection structure in each slot of the listener list */
 
   for (ndx = 0; ndx < CONFIG_NET_MAX_LISTENPORTS; ndx++)
     {
-      /* Is this slot assigned?  If so, does the connection have the same
-       * local port number?
-       */
-
       FAR struct tcp_conn_s *conn = tcp_listenports[ndx];
+
 #if defined(CONFIG_NET_IPv4) && defined(CONFIG_NET_IPv6)
-      if (conn && conn->lport == portno && conn->domain == domain)
+      if (tcp_listener_match(conn, uaddr, portno, domain))
 #else
-      if (conn && conn->lport == portno)
+      if (tcp_listener_match(conn, uaddr, portno))
 #endif
         {
-#ifdef CONFIG_NET_IPv6
-#  ifdef CONFIG_NET_IPv4
-          if (domain == PF_INET6)
-#  endif
+          if (first == NULL)
             {
-              if (net_ipv6addr_cmp(conn->u.ipv6.laddr, uaddr->ipv6.laddr) ||
-                  net_ipv6addr_cmp(conn->u.ipv6.laddr, g_ipv6_unspecaddr))
-                {
-                  /* Yes.. we found a listener on this port */
-
-                  return conn;
-                }
+              first = conn;
             }
+
+          nmatches++;
+        }
+    }
+
+  if (nmatches > 1)
+    {
+      /* Multiple SO_REUSEPORT listeners share this address/port.
+       * Distribute incoming connections among them by flow hash.
+       */
+
+#if defined(CONFIG_NET_IPv4) && defined(CONFIG_NET_IPv6)
+      int target = tcp_listener_hash(uaddr, portno, rport, domain) %
+                   nmatches;
+#else
+      int target = tcp_listener_hash(uaddr, portno, rport) % nmatches;
 #endif
 
-#ifdef CONFIG_NET_IPv4
-#  ifdef CONFIG_NET_IPv6
-          if (domain == PF_INET)
-#  endif
-            {
-              if (net_ipv4addr_cmp(conn->u.ipv4.laddr, uaddr->ipv4.laddr) ||
-                  net_ipv4addr_cmp(conn->u.ipv4.laddr, INADDR_ANY))
-                {
-                  /* Yes.. we found a listener on this port */
+      for (ndx = 0; ndx < CONFIG_NET_MAX_LISTENPORTS; ndx++)
+        {
+          FAR struct tcp_conn_s *conn = tcp_listenports[ndx];
 
-                  return conn;
-                }
-            }
+#if defined(CONFIG_NET_IPv4) && defined(CONFIG_NET_IPv6)
+          if (tcp_listener_match(conn, uaddr, portno, domain) &&
+              target-- == 0)
+#else
+          if (tcp_listener_match(conn, uaddr, portno) && target-- == 0)
 #endif
+            {
+              return conn;
+            }
         }
     }
 
-  /* No listener for this port */
+  /* Return the unique match, or NULL if there is no listener */
 
-  return NULL;
+  return first;
 }
 
 /****************************************************************************
@@ -191,6 +321,7 @@ int tcp_unlisten(FAR struct tcp_conn_s *conn)
 
 int tcp_listen(FAR struct tcp_conn_s *conn)
 {
+  FAR struct tcp_conn_s *listener;
   int ndx;
   int ret;
 
@@ -203,12 +334,20 @@ int tcp_listen(FAR struct tcp_conn_s *conn)
   /* First, check if there is already a socket listening on this port */
 
 #if defined(CONFIG_NET_IPv4) && defined(CONFIG_NET_IPv6)
-  if (tcp_islistener(&conn->u, conn->lport, conn->domain))
+  listener = tcp_findlistener(&conn->u, conn->lport, 0, conn->domain);
 #else
-  if (tcp_islistener(&conn->u, conn->lport))
+  listener = tcp_findlistener(&conn->u, conn->lport, 0);
 #endif
+  if (listener != NULL &&
+      (!_SO_GETOPT(conn->sconn.s_options, SO_REUSEPORT) ||
+       !_SO_GETOPT(listener->sconn.s_options, SO_REUSEPORT)))
     {
-      /* Yes, then we must refuse this request */
+      /* Yes, and SO_REUSEPORT is not set on both sockets, so we must
+       * refuse this request.  Note that it is sufficient to check only
+       * the first existing listener:  Several listeners can share the
+       * port only if every one of them was admitted with SO_REUSEPORT
+       * set.
+       */
 
       ret = -EADDRINUSE;
     }
@@ -256,12 +395,12 @@ int tcp_listen(FAR struct tcp_conn_s *conn)
 bool tcp_islistener(FAR union ip_binding_u *uaddr, uint16_t portno,
                     uint8_t domain)
 {
-  return tcp_findlistener(uaddr, portno, domain) != NULL;
+  return tcp_findlistener(uaddr, portno, 0, domain) != NULL;
 }
 #else
 bool tcp_islistener(FAR union ip_binding_u *uaddr, uint16_t portno)
 {
-  return tcp_findlistener(uaddr, portno) != NULL;
+  return tcp_findlistener(uaddr, portno, 0) != NULL;
 }
 #endif
 
@@ -288,9 +427,9 @@ int tcp_accept_connection(FAR struct net_driver_s *dev,
    */
 
 #if defined(CONFIG_NET_IPv4) && defined(CONFIG_NET_IPv6)
-  listener = tcp_findlistener(&conn->u, portno, conn->domain);
+  listener = tcp_findlistener(&conn->u, portno, conn->rport, conn->domain);
 #else
-  listener = tcp_findlistener(&conn->u, portno);
+  listener = tcp_findlistener(&conn->u, portno, conn->rport);
 #endif
   if (listener != NULL)
     {
@@ -282,6 +282,17 @@ int tcp_pollsetup(FAR struct socket *psock, FAR struct pollfd *fds)
       cb->flags |= TCP_NEWDATA | TCP_BACKLOG;
     }
 
+#ifdef CONFIG_NET_TCP_TXREADYQ
+  /* A POLLOUT waiter depends on device polls to re-evaluate writability,
+   * so make sure the connection is visited by them.
+   */
+
+  if ((cb->flags & TCP_POLL) != 0)
+    {
+      tcp_txready(conn);
+    }
+#endif
+
   /* Save the reference in the poll info structure as fds private as well
    * for use during poll teardown as well.
    */
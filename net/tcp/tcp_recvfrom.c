@@ -222,6 +222,45 @@ static inline uint16_t tcp_newdata(FAR struct net_driver_s *dev,
   return flags;
 }
 
+/****************************************************************************
+ * Name: tcp_readahead_donate
+ *
+ * Description:
+ *   Detach the read-ahead I/O buffer chain and donate it to the caller.
+ *   The chain pointer is stored into the (pointer sized) user buffer and
+ *   the accumulated packet length becomes the receive length.  The caller
+ *   returns the buffers to the pool with iob_free_chain().
+ *
+ * Input Parameters:
+ *   pstate   recvfrom state structure
+ *
+ * Returned Value:
+ *   None
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_TCP_RECV_DONATE
+static void tcp_readahead_donate(FAR struct tcp_recvfrom_s *pstate)
+{
+  FAR struct tcp_conn_s *conn = pstate->ir_conn;
+  FAR struct iob_s *iob = conn->readahead;
+
+  if (iob != NULL)
+    {
+      DEBUGASSERT(iob->io_pktlen > 0);
+
+      conn->readahead = NULL;
+      *(FAR struct iob_s **)pstate->ir_buffer = iob;
+
+      pstate->ir_recvlen = iob->io_pktlen;
+      pstate->ir_buflen  = 0;
+    }
+}
+#endif
+
 /****************************************************************************
  * Name: tcp_readahead
  *
@@ -245,6 +284,18 @@ static inline void tcp_readahead(struct tcp_recvfrom_s *pstate)
   FAR struct iob_s *iob;
   int recvlen;
 
+#ifdef CONFIG_NET_TCP_RECV_DONATE
+  /* In donation mode the whole read-ahead I/O buffer chain is handed to
+   * the application instead of being copied out.
+   */
+
+  if ((pstate->ir_flags & MSG_DONATE) != 0)
+    {
+      tcp_readahead_donate(pstate);
+      return;
+    }
+#endif
+
   /* Check there is any TCP data already buffered in a read-ahead
    * buffer.
    */
@@ -403,6 +454,27 @@ static uint16_t tcp_recvhandler(FAR struct net_driver_s *dev,
 
       if ((flags & TCP_NEWDATA) != 0)
         {
+#ifdef CONFIG_NET_TCP_RECV_DONATE
+          if ((pstate->ir_flags & MSG_DONATE) != 0 && dev->d_len > 0)
+            {
+              /* Leave TCP_NEWDATA set so that the data is queued in the
+               * read-ahead buffer (and ACKed) on return, then wake up the
+               * waiting thread which will donate the chain from there.
+               * The waiter cannot run until the network is unlocked, so
+               * the data is buffered before the donation is attempted.
+               */
+
+              tcp_sender(dev, pstate);
+
+              pstate->ir_cb->flags = 0;
+              pstate->ir_cb->priv  = NULL;
+              pstate->ir_cb->event = NULL;
+
+              nxsem_post(&pstate->ir_sem);
+              return flags;
+            }
+#endif
+
           /* Save the sender's address in the caller's 'from' location */
 
           tcp_sender(dev, pstate);
@@ -664,6 +736,19 @@ ssize_t psock_tcp_recvfrom(FAR struct socket *psock, FAR struct msghdr *msg,
   FAR struct tcp_conn_s *conn;
   int                    ret;
 
+#ifdef CONFIG_NET_TCP_RECV_DONATE
+  /* In donation mode the user buffer receives a single I/O buffer chain
+   * pointer; the data itself is never copied.  Donation cannot be
+   * combined with peeking because the chain leaves the connection.
+   */
+
+  if ((flags & MSG_DONATE) != 0 &&
+      (len < sizeof(FAR struct iob_s *) || (flags & MSG_PEEK) != 0))
+    {
+      return -EINVAL;
+    }
+#endif
+
   net_lock();
 
   conn = psock->s_conn;
@@ -784,6 +869,18 @@ ssize_t psock_tcp_recvfrom(FAR struct socket *psock, FAR struct msghdr *msg,
           /* Make sure that no further events are processed */
 
           tcp_callback_free(conn, state.ir_cb);
+
+#ifdef CONFIG_NET_TCP_RECV_DONATE
+          /* In donation mode the event handler left the new data to be
+           * queued in the read-ahead buffer; hand the chain over now.
+           */
+
+          if ((flags & MSG_DONATE) != 0 && ret == OK)
+            {
+              tcp_readahead_donate(&state);
+            }
+#endif
+
           ret = tcp_recvfrom_result(ret, &state);
         }
       else if (ret <= 0)
@@ -792,6 +889,18 @@ ssize_t psock_tcp_recvfrom(FAR struct socket *psock, FAR struct msghdr *msg,
         }
     }
 
+#ifdef CONFIG_NET_TCP_RECVBUF_AUTOTUNE
+  /* Let the receive buffer limit track the application drain rate so
+   * that the window advertised below can grow toward the bandwidth-
+   * delay product of the path.
+   */
+
+  if (ret > 0)
+    {
+      tcp_rcvbuf_autotune(conn, (uint32_t)ret);
+    }
+#endif
+
   /* Receive additional data from read-ahead buffer, send the ACK timely.
    *
    * Revisit: Because IOBs are system-wide resources, consuming the read
@@ -801,6 +910,9 @@ ssize_t psock_tcp_recvfrom(FAR struct socket *psock, FAR struct msghdr *msg,
 
   if (tcp_should_send_recvwindow(conn))
     {
+#ifdef CONFIG_NET_TCP_TXREADYQ
+      tcp_txready(conn);
+#endif
       netdev_txnotify_dev(conn->dev);
     }
 
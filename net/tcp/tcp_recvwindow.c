@@ -267,6 +267,92 @@ uint32_t tcp_get_recvwindow(FAR struct net_driver_s *dev,
   return recvwndo;
 }
 
+/****************************************************************************
+ * Name: tcp_rcvbuf_autotune
+ *
+ * Description:
+ *   Adjust the connection receive buffer limit to the rate at which the
+ *   application drains the connection.  Called whenever data has been
+ *   copied out to the application.
+ *
+ * Input Parameters:
+ *   conn   - The TCP connection structure holding connection information.
+ *   copied - The number of bytes just copied to the application.
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_TCP_RECVBUF_AUTOTUNE
+void tcp_rcvbuf_autotune(FAR struct tcp_conn_s *conn, uint32_t copied)
+{
+  uint32_t rcvseq = tcp_getsequence(conn->rcvseq);
+  uint32_t maxsize;
+  uint32_t newsize;
+
+  conn->rcv_copied += copied;
+
+  /* The first measurement round is started lazily because the receive
+   * sequence number is not known when the connection is allocated.
+   */
+
+  if (conn->rcv_rttseq == 0)
+    {
+      conn->rcv_rttseq = TCP_SEQ_ADD(rcvseq, conn->rcv_bufs);
+      return;
+    }
+
+  /* A round lasts one receiver-side RTT:  it ends when the receive
+   * sequence passes the edge that was one buffer limit ahead when the
+   * round began.  The peer cannot send past that edge before our window
+   * update has made the round trip.
+   */
+
+  if (TCP_SEQ_LT(rcvseq, conn->rcv_rttseq))
+    {
+      return;
+    }
+
+  /* If the application drained more than half of the current limit
+   * within one RTT, then the limit (and not the link or the reader) is
+   * the bottleneck.  Size the limit to twice the measured delivery per
+   * RTT so that data for the next RTT can be buffered while the reader
+   * consumes the previous one.
+   */
+
+  if (2 * conn->rcv_copied >= (uint32_t)conn->rcv_bufs)
+    {
+      maxsize = (CONFIG_IOB_NBUFFERS - CONFIG_IOB_THROTTLE) *
+                CONFIG_IOB_BUFSIZE;
+#if CONFIG_NET_MAX_RECV_BUFSIZE > 0
+      if (maxsize > CONFIG_NET_MAX_RECV_BUFSIZE)
+        {
+          maxsize = CONFIG_NET_MAX_RECV_BUFSIZE;
+        }
+#endif
+
+      newsize = 2 * conn->rcv_copied;
+      if (newsize > maxsize)
+        {
+          newsize = maxsize;
+        }
+
+      if (newsize > (uint32_t)conn->rcv_bufs)
+        {
+          ninfo("rcv_bufs %" PRId32 " -> %" PRIu32 "\n",
+                conn->rcv_bufs, newsize);
+          conn->rcv_bufs = newsize;
+        }
+    }
+
+  /* Begin the next measurement round */
+
+  conn->rcv_copied = 0;
+  conn->rcv_rttseq = TCP_SEQ_ADD(rcvseq, conn->rcv_bufs);
+}
+#endif /* CONFIG_NET_TCP_RECVBUF_AUTOTUNE */
+
 bool tcp_should_send_recvwindow(FAR struct tcp_conn_s *conn)
 {
   FAR struct net_driver_s *dev = conn->dev;
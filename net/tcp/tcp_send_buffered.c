@@ -411,6 +411,69 @@ static int parse_sack(FAR struct tcp_conn_s *conn, FAR struct tcp_hdr_s *tcp,
 }
 #endif /* CONFIG_NET_TCP_SELECTIVE_ACK */
 
+/****************************************************************************
+ * Name: psock_send_holdback
+ *
+ * Description:
+ *   Decide whether transmission of the write buffer at the head of the
+ *   write queue should be withheld so that further small writes may
+ *   coalesce into it.  Only a never-transmitted, partial segment with
+ *   nothing queued behind it is eligible:  it is withheld while the
+ *   socket is corked (until the cork timeout expires) or, with automatic
+ *   corking, while earlier data is still in flight.
+ *
+ * Input Parameters:
+ *   conn   The TCP connection of interest
+ *   wrb    The write buffer at the head of the write queue
+ *
+ * Returned Value:
+ *   True if the write buffer should not be transmitted yet.
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+#if defined(CONFIG_NET_TCP_CORK) || defined(CONFIG_NET_TCP_AUTOCORK)
+static bool psock_send_holdback(FAR struct tcp_conn_s *conn,
+                                FAR struct tcp_wrbuffer_s *wrb)
+{
+  bool hold = false;
+
+  if (TCP_WBSENT(wrb) == 0 && TCP_WBNRTX(wrb) == 0 &&
+      TCP_WBSEQNO(wrb) == (unsigned)-1 &&
+      TCP_WBPKTLEN(wrb) < conn->mss &&
+      sq_next(&wrb->wb_node) == NULL)
+    {
+#ifdef CONFIG_NET_TCP_CORK
+      if (conn->corked &&
+          conn->cork_timer < CONFIG_NET_TCP_CORK_TIMEOUT)
+        {
+          hold = true;
+        }
+#endif
+
+#ifdef CONFIG_NET_TCP_AUTOCORK
+      /* The flush is triggered by the ACK that empties the pipe */
+
+      if (!conn->nodelay && conn->tx_unacked > 0)
+        {
+          hold = true;
+        }
+#endif
+    }
+
+#ifdef CONFIG_NET_TCP_CORK
+  if (!hold)
+    {
+      conn->cork_timer = 0;
+    }
+#endif
+
+  return hold;
+}
+#endif /* CONFIG_NET_TCP_CORK || CONFIG_NET_TCP_AUTOCORK */
+
 /****************************************************************************
  * Name: psock_send_eventhandler
  *
@@ -1003,6 +1066,18 @@ static uint16_t psock_send_eventhandler(FAR struct net_driver_s *dev,
       wrb = (FAR struct tcp_wrbuffer_s *)sq_peek(&conn->write_q);
       DEBUGASSERT(wrb);
 
+#if defined(CONFIG_NET_TCP_CORK) || defined(CONFIG_NET_TCP_AUTOCORK)
+      /* Withhold a partial segment in the hope that more data will be
+       * coalesced into it; the uncork, the cork timeout, or the ACK
+       * that empties the pipe will trigger the flush.
+       */
+
+      if (psock_send_holdback(conn, wrb))
+        {
+          return flags;
+        }
+#endif
+
       /* Set the sequence number for this segment.  If we are
        * retransmitting, then the sequence number will already
        * be set for this write buffer.
@@ -1043,6 +1118,22 @@ static uint16_t psock_send_eventhandler(FAR struct net_driver_s *dev,
               sndlen = remaining_snd_wnd;
             }
 
+#ifdef CONFIG_NET_TCP_CC_NEWRENO
+          /* Give the congestion control algorithm the opportunity to pace
+           * transmission by bounding the size of this burst.
+           */
+
+          if (conn->cc_ops->pace != NULL)
+            {
+              uint32_t pace = conn->cc_ops->pace(conn);
+
+              if (pace > 0 && sndlen > pace)
+                {
+                  sndlen = pace;
+                }
+            }
+#endif
+
           /* Normally CONFIG_IOB_THROTTLE should ensure that we have enough
            * iob space available for copying the data to a packet buffer.
            * If it doesn't, a deadlock could happen where the iobs are used
@@ -224,12 +224,66 @@ int tcp_setsockopt(FAR struct socket *psock, int option,
           {
             int nodelay = *(FAR int *)value;
 
+#ifdef CONFIG_NET_TCP_AUTOCORK
+            conn->nodelay = (nodelay != 0);
+
+            if (conn->nodelay)
+              {
+                /* Flush any partial segment withheld by automatic
+                 * corking.
+                 */
+
+                tcp_send_txnotify(psock, conn);
+              }
+#else
             if (!nodelay)
               {
                 nerr("ERROR: TCP_NODELAY not supported\n");
                 ret = -ENOSYS;
               }
+#endif
+          }
+        break;
+
+#ifdef CONFIG_NET_TCP_CORK
+      case TCP_CORK: /* Hold back partial segments until uncorked */
+        if (value_len != sizeof(int))
+          {
+            ret = -EDOM;
+          }
+        else
+          {
+            bool corked = (*(FAR int *)value != 0);
+
+            if (conn->corked && !corked)
+              {
+                /* Removing the cork flushes any withheld segment */
+
+                conn->cork_timer = 0;
+                tcp_send_txnotify(psock, conn);
+              }
+
+            conn->corked = corked;
+          }
+        break;
+#endif
+
+      case TCP_QUICKACK: /* Send ACKs immediately, overriding delayed ACK */
+        if (value_len != sizeof(int))
+          {
+            ret = -EDOM;
+          }
+#ifdef CONFIG_NET_TCP_DELAYED_ACK
+        else
+          {
+            /* When not set, the connection reverts to the normal delayed
+             * ACK behavior.  Without CONFIG_NET_TCP_DELAYED_ACK every ACK
+             * is already sent immediately and there is nothing to do.
+             */
+
+            conn->rx_quickack = (*(FAR int *)value != 0);
           }
+#endif
         break;
 
       case TCP_MAXSEG: /* The maximum segment size */
@@ -152,6 +152,9 @@ static void tcp_timer_expiry(FAR void *arg)
       if (conn == arg)
         {
           conn->timeout = true;
+#ifdef CONFIG_NET_TCP_TXREADYQ
+          tcp_txready(conn);
+#endif
           netdev_txnotify_dev(conn->dev);
           break;
         }
@@ -372,6 +375,10 @@ void tcp_set_zero_probe(FAR struct tcp_conn_s *conn, uint16_t flags)
     {
       tcp_update_retrantimer(conn, TCP_RTO_MIN);
       conn->zero_probe = true;
+
+#ifdef CONFIG_NET_TCP_CONN_STATS
+      conn->stat_zerownd++;
+#endif
     }
 }
 
@@ -536,9 +543,10 @@ void tcp_timer(FAR struct net_driver_s *dev, FAR struct tcp_conn_s *conn)
 
 #if defined(CONFIG_NET_IPv4) && defined(CONFIG_NET_IPv6)
                   listener = tcp_findlistener(&conn->u, conn->lport,
-                                              conn->domain);
+                                              conn->rport, conn->domain);
 #else
-                  listener = tcp_findlistener(&conn->u, conn->lport);
+                  listener = tcp_findlistener(&conn->u, conn->lport,
+                                              conn->rport);
 #endif
                   if (listener != NULL)
                     {
@@ -612,6 +620,9 @@ void tcp_timer(FAR struct net_driver_s *dev, FAR struct tcp_conn_s *conn)
 
 #ifdef CONFIG_NET_STATISTICS
               g_netstats.tcp.rexmit++;
+#endif
+#ifdef CONFIG_NET_TCP_CONN_STATS
+              conn->stat_rexmits++;
 #endif
               switch (conn->tcpstateflags & TCP_STATE_MASK)
                 {
@@ -665,8 +676,7 @@ void tcp_timer(FAR struct net_driver_s *dev, FAR struct tcp_conn_s *conn)
 
                     /* reset cwnd and ssthresh, refers to RFC5861. */
 
-                    conn->ssthresh =
-                                    MAX(conn->tx_unacked / 2, 2 * conn->mss);
+                    conn->ssthresh = conn->cc_ops->ssthresh(conn);
                     conn->cwnd = conn->mss;
 #endif
                     goto done;
@@ -819,6 +829,26 @@ void tcp_timer(FAR struct net_driver_s *dev, FAR struct tcp_conn_s *conn)
             }
 #endif
 
+#ifdef CONFIG_NET_TCP_CORK
+          /* Advance the cork hold timer so that a corked partial
+           * segment is eventually flushed by the poll below.
+           */
+
+          if (conn->corked && !sq_empty(&conn->write_q))
+            {
+              uint8_t elapsed = hsec < UINT8_MAX ? hsec : UINT8_MAX;
+
+              if (conn->cork_timer < UINT8_MAX - elapsed)
+                {
+                  conn->cork_timer += elapsed;
+                }
+              else
+                {
+                  conn->cork_timer = UINT8_MAX;
+                }
+            }
+#endif
+
           /* There was no need for a retransmission and there was no
            * need to probe the remote peer and there was no need to
            * send a delayed ACK.  We poll the application for new
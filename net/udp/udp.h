@@ -113,6 +113,9 @@ struct udp_conn_s
   /* UDP-specific content follows */
 
   union ip_binding_u u;   /* IP address binding */
+#ifdef CONFIG_NET_UDP_CONN_HASH
+  FAR struct udp_conn_s *hashnext; /* Chain in the demux hash table */
+#endif
   uint16_t lport;         /* Bound local port number (network byte order) */
   uint16_t rport;         /* Remote port number (network byte order) */
   uint8_t  flags;         /* See _UDP_FLAG_* definitions */
@@ -290,6 +293,26 @@ uint16_t udp_select_port(uint8_t domain, FAR union ip_binding_u *u);
 
 int udp_bind(FAR struct udp_conn_s *conn, FAR const struct sockaddr *addr);
 
+/****************************************************************************
+ * Name: udp_conn_update_lport
+ *
+ * Description:
+ *   Assign a new local port number to the connection and, if the demux
+ *   hash table is enabled, rechain the connection into the bucket for
+ *   the new port.  All assignments of conn->lport after allocation must
+ *   go through this function so that the hash table stays consistent.
+ *
+ * Assumptions:
+ *   This function must be called with the network locked.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_UDP_CONN_HASH
+void udp_conn_update_lport(FAR struct udp_conn_s *conn, uint16_t lport);
+#else
+#  define udp_conn_update_lport(conn, port) ((conn)->lport = (port))
+#endif
+
 /****************************************************************************
  * Name: udp_connect
  *
@@ -93,10 +93,80 @@ static mutex_t g_free_lock = NXMUTEX_INITIALIZER;
 
 static dq_queue_t g_active_udp_connections;
 
+#ifdef CONFIG_NET_UDP_CONN_HASH
+/* Hash table used to demultiplex inbound datagrams.  Every connection
+ * with a bound local port is chained (via conn->hashnext) into the
+ * bucket selected by that port.  The local address is not part of the
+ * key:  wildcard binds must receive datagrams for any destination
+ * address and therefore share the bucket with exact binds of the same
+ * port.
+ */
+
+static FAR struct udp_conn_s *
+  g_udp_conn_hashtab[CONFIG_NET_UDP_CONN_HASH_SIZE];
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
+#ifdef CONFIG_NET_UDP_CONN_HASH
+/****************************************************************************
+ * Name: udp_conn_hashndx
+ *
+ * Description:
+ *   Map a local port number (in network byte order) to a bucket of the
+ *   connection hash table.
+ *
+ ****************************************************************************/
+
+static int udp_conn_hashndx(uint16_t lport)
+{
+  return (lport ^ (lport >> 8)) % CONFIG_NET_UDP_CONN_HASH_SIZE;
+}
+
+/****************************************************************************
+ * Name: udp_conn_hash_insert
+ *
+ * Description:
+ *   Chain the connection into the bucket for its bound local port.
+ *
+ ****************************************************************************/
+
+static void udp_conn_hash_insert(FAR struct udp_conn_s *conn)
+{
+  int ndx = udp_conn_hashndx(conn->lport);
+
+  conn->hashnext          = g_udp_conn_hashtab[ndx];
+  g_udp_conn_hashtab[ndx] = conn;
+}
+
+/****************************************************************************
+ * Name: udp_conn_hash_remove
+ *
+ * Description:
+ *   Unchain the connection from the demux hash table.  Harmless if the
+ *   connection was never inserted.
+ *
+ ****************************************************************************/
+
+static void udp_conn_hash_remove(FAR struct udp_conn_s *conn)
+{
+  FAR struct udp_conn_s **prev;
+
+  prev = &g_udp_conn_hashtab[udp_conn_hashndx(conn->lport)];
+  for (; *prev != NULL; prev = &(*prev)->hashnext)
+    {
+      if (*prev == conn)
+        {
+          *prev          = conn->hashnext;
+          conn->hashnext = NULL;
+          return;
+        }
+    }
+}
+#endif /* CONFIG_NET_UDP_CONN_HASH */
+
 /****************************************************************************
  * Name: udp_find_conn()
  *
@@ -199,7 +269,17 @@ udp_ipv4_active(FAR struct net_driver_s *dev, FAR struct udp_conn_s *conn,
 #endif
   FAR struct ipv4_hdr_s *ip = IPv4BUF;
 
+#ifdef CONFIG_NET_UDP_CONN_HASH
+  /* Any connection that can match the checks below has its local port
+   * equal to the destination port of the datagram, so only the one
+   * bucket that port hashes to needs to be searched.
+   */
+
+  conn = conn != NULL ? conn->hashnext :
+         g_udp_conn_hashtab[udp_conn_hashndx(udp->destport)];
+#else
   conn = udp_nextconn(conn);
+#endif
 
   while (conn)
     {
@@ -311,9 +391,13 @@ udp_ipv4_active(FAR struct net_driver_s *dev, FAR struct udp_conn_s *conn,
             }
         }
 
-      /* Look at the next active connection */
+      /* Look at the next candidate connection */
 
+#ifdef CONFIG_NET_UDP_CONN_HASH
+      conn = conn->hashnext;
+#else
       conn = (FAR struct udp_conn_s *)conn->sconn.node.flink;
+#endif
     }
 
   return conn;
@@ -339,7 +423,17 @@ udp_ipv6_active(FAR struct net_driver_s *dev, FAR struct udp_conn_s *conn,
 {
   FAR struct ipv6_hdr_s *ip = IPv6BUF;
 
+#ifdef CONFIG_NET_UDP_CONN_HASH
+  /* Any connection that can match the checks below has its local port
+   * equal to the destination port of the datagram, so only the one
+   * bucket that port hashes to needs to be searched.
+   */
+
+  conn = conn != NULL ? conn->hashnext :
+         g_udp_conn_hashtab[udp_conn_hashndx(udp->destport)];
+#else
   conn = udp_nextconn(conn);
+#endif
 
   while (conn != NULL)
     {
@@ -451,9 +545,13 @@ udp_ipv6_active(FAR struct net_driver_s *dev, FAR struct udp_conn_s *conn,
             }
         }
 
-      /* Look at the next active connection */
+      /* Look at the next candidate connection */
 
+#ifdef CONFIG_NET_UDP_CONN_HASH
+      conn = conn->hashnext;
+#else
       conn = (FAR struct udp_conn_s *)conn->sconn.node.flink;
+#endif
     }
 
   return conn;
@@ -642,6 +740,9 @@ FAR struct udp_conn_s *udp_alloc(uint8_t domain)
       conn->domain      = domain;
 #endif
       conn->lport       = 0;
+#ifdef CONFIG_NET_UDP_CONN_HASH
+      conn->hashnext    = NULL;
+#endif
 #if CONFIG_NET_RECV_BUFSIZE > 0
       conn->rcvbufs     = CONFIG_NET_RECV_BUFSIZE;
 #endif
@@ -685,6 +786,9 @@ void udp_free(FAR struct udp_conn_s *conn)
   DEBUGASSERT(conn->crefs == 0);
 
   nxmutex_lock(&g_free_lock);
+#ifdef CONFIG_NET_UDP_CONN_HASH
+  udp_conn_hash_remove(conn);
+#endif
   conn->lport = 0;
 
   /* Remove the connection from the active list */
@@ -928,8 +1032,8 @@ int udp_bind(FAR struct udp_conn_s *conn, FAR const struct sockaddr *addr)
         }
       else
         {
-          conn->lport = portno;
-          ret         = OK;
+          udp_conn_update_lport(conn, portno);
+          ret = OK;
         }
     }
   else
@@ -953,8 +1057,8 @@ int udp_bind(FAR struct udp_conn_s *conn, FAR const struct sockaddr *addr)
         {
           /* No.. then bind the socket to the port */
 
-          conn->lport = portno;
-          ret         = OK;
+          udp_conn_update_lport(conn, portno);
+          ret = OK;
         }
       else
         {
@@ -966,6 +1070,34 @@ int udp_bind(FAR struct udp_conn_s *conn, FAR const struct sockaddr *addr)
   return ret;
 }
 
+/****************************************************************************
+ * Name: udp_conn_update_lport
+ *
+ * Description:
+ *   Assign a new local port number to the connection and rechain the
+ *   connection into the demux hash bucket for that port.
+ *
+ * Assumptions:
+ *   This function must be called with the network locked.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_UDP_CONN_HASH
+void udp_conn_update_lport(FAR struct udp_conn_s *conn, uint16_t lport)
+{
+  if (conn->lport != 0)
+    {
+      udp_conn_hash_remove(conn);
+    }
+
+  conn->lport = lport;
+  if (lport != 0)
+    {
+      udp_conn_hash_insert(conn);
+    }
+}
+#endif
+
 /****************************************************************************
  * Name: udp_connect
  *
@@ -1005,7 +1137,8 @@ int udp_connect(FAR struct udp_conn_s *conn, FAR const struct sockaddr *addr)
        * connection structure.
        */
 
-      conn->lport = HTONS(udp_select_port(conn->domain, &conn->u));
+      udp_conn_update_lport(conn,
+                            HTONS(udp_select_port(conn->domain, &conn->u)));
       if (!conn->lport)
         {
           nerr("ERROR: Failed to get a local port!\n");
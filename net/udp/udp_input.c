@@ -245,7 +245,19 @@ static int udp_input(FAR struct net_driver_s *dev, unsigned int iplen)
   dev->d_appdata = IPBUF(udpiplen);
 
 #ifdef CONFIG_NET_UDP_CHECKSUMS
-  chksum = udp->udpchksum;
+  if (NETDEV_HAS_HWCAP(dev, NETDEV_HWCAP_RX_CSUM))
+    {
+      /* The hardware has already validated the checksum and dropped
+       * any bad frames.
+       */
+
+      chksum = 0;
+    }
+  else
+    {
+      chksum = udp->udpchksum;
+    }
+
   if (chksum != 0)
     {
 #ifdef CONFIG_NET_IPv6
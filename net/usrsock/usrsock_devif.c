@@ -39,6 +39,7 @@
 
 #include <nuttx/random.h>
 #include <nuttx/mutex.h>
+#include <nuttx/queue.h>
 #include <nuttx/semaphore.h>
 #include <nuttx/net/net.h>
 #include <nuttx/net/usrsock.h>
@@ -62,7 +63,30 @@ struct usrsock_req_s
   /* Connection instance to receive data buffers. */
 
   FAR struct usrsock_conn_s *datain_conn;
+
+#ifdef CONFIG_NET_USRSOCK_PIPELINE
+  /* Requests that have been handed to the daemon but not yet responded
+   * to.  Protected by the network lock.
+   */
+
+  sq_queue_t waiters;
+#endif
+};
+
+#ifdef CONFIG_NET_USRSOCK_PIPELINE
+/* Wait state of one in-flight request.  Instances live on the stack of
+ * the thread blocked in usrsock_do_request().
+ */
+
+struct usrsock_reqwait_s
+{
+  sq_entry_t node;   /* Supports a singly linked list.  Must be the first
+                      * field in the structure. */
+  sem_t      acksem; /* Response arrival notification */
+  uint32_t   xid;    /* Exchange id of the in-flight request */
+  bool       done;   /* True: response (or abort) has been received */
 };
+#endif
 
 /****************************************************************************
  * Private Data
@@ -190,6 +214,40 @@ out:
   return total;
 }
 
+/****************************************************************************
+ * Name: usrsock_wake_waiter
+ *
+ * Description:
+ *   Wake the thread waiting for the response to the given exchange id.
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_USRSOCK_PIPELINE
+static void usrsock_wake_waiter(uint32_t xid)
+{
+  FAR struct usrsock_req_s *req = &g_usrsock_req;
+  FAR sq_entry_t *entry;
+
+  for (entry = sq_peek(&req->waiters); entry != NULL;
+       entry = sq_next(entry))
+    {
+      FAR struct usrsock_reqwait_s *wait =
+        (FAR struct usrsock_reqwait_s *)entry;
+
+      if (wait->xid == xid)
+        {
+          sq_rem(entry, &req->waiters);
+          wait->done = true;
+          nxsem_post(&wait->acksem);
+          break;
+        }
+    }
+}
+#endif
+
 /****************************************************************************
  * Name: usrsock_handle_event
  ****************************************************************************/
@@ -499,6 +557,12 @@ static ssize_t usrsock_handle_req_response(FAR const void *buffer,
       nxsem_post(&req->acksem);
     }
 
+#ifdef CONFIG_NET_USRSOCK_PIPELINE
+  /* Wake the thread waiting for this response. */
+
+  usrsock_wake_waiter(hdr->xid);
+#endif
+
   conn->resp.events = hdr->head.events | USRSOCK_EVENT_REQ_COMPLETE;
   ret = handle_response(conn, buffer, len);
 
@@ -642,6 +706,9 @@ int usrsock_do_request(FAR struct usrsock_conn_s *conn,
 {
   FAR struct usrsock_request_common_s *req_head = NULL;
   FAR struct usrsock_req_s *req = &g_usrsock_req;
+#ifdef CONFIG_NET_USRSOCK_PIPELINE
+  struct usrsock_reqwait_s wait;
+#endif
   int ret;
 
   /* Get exchange id. */
@@ -665,6 +732,15 @@ int usrsock_do_request(FAR struct usrsock_conn_s *conn,
 
   req->ackxid = req_head->xid;
 
+#ifdef CONFIG_NET_USRSOCK_PIPELINE
+  /* Register for the response before the daemon can see the request. */
+
+  nxsem_init(&wait.acksem, 0, 0);
+  wait.xid = req_head->xid;
+  wait.done = false;
+  sq_addlast(&wait.node, &req->waiters); /* net_lock held. */
+#endif
+
   ret = usrsock_request(iov, iovcnt);
   if (ret >= 0)
     {
@@ -682,9 +758,58 @@ int usrsock_do_request(FAR struct usrsock_conn_s *conn,
   /* Free request line for next command. */
 
   nxmutex_unlock(&req->lock);
+
+#ifdef CONFIG_NET_USRSOCK_PIPELINE
+  if (ret >= 0)
+    {
+      /* The request line is free as soon as the daemon has consumed the
+       * request; wait for the response to this exchange id outside the
+       * request lock so that other threads may issue their requests in
+       * the meantime.
+       */
+
+      while (!wait.done)
+        {
+          net_sem_wait_uninterruptible(&wait.acksem);
+        }
+    }
+  else
+    {
+      sq_rem(&wait.node, &req->waiters); /* net_lock held. */
+    }
+
+  nxsem_destroy(&wait.acksem);
+#endif
+
   return ret;
 }
 
+/****************************************************************************
+ * Name: usrsock_request_consumed() - release the pending usrsock request
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_USRSOCK_PIPELINE
+void usrsock_request_consumed(void)
+{
+  FAR struct usrsock_req_s *req = &g_usrsock_req;
+
+  net_lock();
+
+  /* Free the request line for the next command.  The response to the
+   * consumed request is matched by exchange id when it arrives, so the
+   * next request may be handed to the daemon before that.
+   */
+
+  if (req->ackxid != 0)
+    {
+      req->ackxid = 0;
+      nxsem_post(&req->acksem);
+    }
+
+  net_unlock();
+}
+#endif
+
 /****************************************************************************
  * Name: usrsock_abort() - abort all usrsock's operations
  ****************************************************************************/
@@ -693,6 +818,9 @@ void usrsock_abort(void)
 {
   FAR struct usrsock_req_s *req = &g_usrsock_req;
   FAR struct usrsock_conn_s *conn = NULL;
+#ifdef CONFIG_NET_USRSOCK_PIPELINE
+  FAR sq_entry_t *entry;
+#endif
   int ret;
 
   net_lock();
@@ -707,6 +835,19 @@ void usrsock_abort(void)
       usrsock_event(conn);
     }
 
+#ifdef CONFIG_NET_USRSOCK_PIPELINE
+  /* Wake-up threads waiting for responses that will never arrive. */
+
+  while ((entry = sq_remfirst(&req->waiters)) != NULL)
+    {
+      FAR struct usrsock_reqwait_s *wait =
+        (FAR struct usrsock_reqwait_s *)entry;
+
+      wait->done = true;
+      nxsem_post(&wait->acksem);
+    }
+#endif
+
   do
     {
       /* Give other threads short time window to complete recently completed
@@ -104,6 +104,11 @@ static void addrenv_destroy(FAR void *arg)
  *   ready-to-run list).  This function will change the address environment
  *   if the new thread is part of a different task group.
  *
+ *   The currently instantiated address environment is cached per CPU and
+ *   keyed by the address environment that the threads of a process share,
+ *   so a switch between threads of the same process does not reprogram
+ *   the MMU or flush the TLB at all.
+ *
  * Input Parameters:
  *   tcb - The TCB of thread that needs an address environment.  This should
  *         be the TCB at the head of the ready-to-run list, but that is not
@@ -151,6 +156,19 @@ int addrenv_switch(FAR struct tcb_s *tcb)
       return OK;
     }
 
+  /* The common case of a switch between threads of the same process can
+   * be detected without taking the critical section:  The cached current
+   * environment of a CPU is only ever modified by that CPU, and a stale
+   * comparison is harmless here since resuming a migrated thread always
+   * passes through this function again on the target CPU.  A mismatch is
+   * re-checked below with interrupts disabled before any MMU work.
+   */
+
+  if (g_addrenv[this_cpu()] == next)
+    {
+      return OK;
+    }
+
   flags = enter_critical_section();
 
   cpu = this_cpu();
@@ -0,0 +1,217 @@
+/****************************************************************************
+ * sched/addrenv/addrenv_usercopy.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <nuttx/addrenv.h>
+#include <nuttx/arch.h>
+#include <nuttx/compiler.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define WORD_MASK (sizeof(uintptr_t) - 1)
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: usercopy_move
+ *
+ * Description:
+ *   Move 'n' bytes from 'from' to 'to'.  When source and destination
+ *   share the same word alignment the bulk of the transfer is done with
+ *   an unrolled word copy; otherwise fall back on memcpy.
+ *
+ ****************************************************************************/
+
+static void usercopy_move(FAR void *to, FAR const void *from, size_t n)
+{
+  FAR uint8_t *dest = to;
+  FAR const uint8_t *src = from;
+
+  if ((((uintptr_t)dest ^ (uintptr_t)src) & WORD_MASK) == 0)
+    {
+      FAR uintptr_t *wdest;
+      FAR const uintptr_t *wsrc;
+
+      /* Copy leading bytes until both pointers are word aligned */
+
+      while (n > 0 && ((uintptr_t)dest & WORD_MASK) != 0)
+        {
+          *dest++ = *src++;
+          n--;
+        }
+
+      /* Copy the aligned body four words at a time */
+
+      wdest = (FAR uintptr_t *)dest;
+      wsrc  = (FAR const uintptr_t *)src;
+
+      while (n >= 4 * sizeof(uintptr_t))
+        {
+          wdest[0] = wsrc[0];
+          wdest[1] = wsrc[1];
+          wdest[2] = wsrc[2];
+          wdest[3] = wsrc[3];
+          wdest   += 4;
+          wsrc    += 4;
+          n       -= 4 * sizeof(uintptr_t);
+        }
+
+      while (n >= sizeof(uintptr_t))
+        {
+          *wdest++ = *wsrc++;
+          n -= sizeof(uintptr_t);
+        }
+
+      /* And any trailing bytes */
+
+      dest = (FAR uint8_t *)wdest;
+      src  = (FAR const uint8_t *)wsrc;
+
+      while (n > 0)
+        {
+          *dest++ = *src++;
+          n--;
+        }
+    }
+  else
+    {
+      memcpy(dest, src, n);
+    }
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: addrenv_user_range
+ *
+ * Description:
+ *   Check that an entire address range lies in user virtual address
+ *   space.  The user address space is contiguous, so one check of each
+ *   end of the range covers every byte in between.  Note that this only
+ *   verifies that the range is a user range; it does not guarantee that
+ *   the range is mapped.
+ *
+ * Input Parameters:
+ *   addr - The start of the range.
+ *   len  - The length of the range in bytes.
+ *
+ * Returned Value:
+ *   True if the whole range lies in user address space; false if not.
+ *
+ ****************************************************************************/
+
+bool addrenv_user_range(uintptr_t addr, size_t len)
+{
+  if (len > 0)
+    {
+      uintptr_t end = addr + len - 1;
+
+      if (end < addr)
+        {
+          /* The range wraps around the top of the address space */
+
+          return false;
+        }
+
+      return up_addrenv_user_vaddr(addr) && up_addrenv_user_vaddr(end);
+    }
+
+  return up_addrenv_user_vaddr(addr);
+}
+
+/****************************************************************************
+ * Name: copy_from_user
+ *
+ * Description:
+ *   Copy 'n' bytes from the user space buffer 'from' to the kernel
+ *   buffer 'to'.  The entire source range is validated once up front.
+ *   The function is weak so that an architecture may provide an
+ *   optimized replacement.
+ *
+ * Input Parameters:
+ *   to   - Kernel destination buffer.
+ *   from - User source buffer.
+ *   n    - The number of bytes to copy.
+ *
+ * Returned Value:
+ *   Zero (OK) on success; -EFAULT if the source range does not lie in
+ *   user address space.
+ *
+ ****************************************************************************/
+
+int weak_function copy_from_user(FAR void *to, FAR const void *from,
+                                 size_t n)
+{
+  if (!addrenv_user_range((uintptr_t)from, n))
+    {
+      return -EFAULT;
+    }
+
+  usercopy_move(to, from, n);
+  return OK;
+}
+
+/****************************************************************************
+ * Name: copy_to_user
+ *
+ * Description:
+ *   Copy 'n' bytes from the kernel buffer 'from' to the user space
+ *   buffer 'to'.  The entire destination range is validated once up
+ *   front.  The function is weak so that an architecture may provide an
+ *   optimized replacement.
+ *
+ * Input Parameters:
+ *   to   - User destination buffer.
+ *   from - Kernel source buffer.
+ *   n    - The number of bytes to copy.
+ *
+ * Returned Value:
+ *   Zero (OK) on success; -EFAULT if the destination range does not lie
+ *   in user address space.
+ *
+ ****************************************************************************/
+
+int weak_function copy_to_user(FAR void *to, FAR const void *from, size_t n)
+{
+  if (!addrenv_user_range((uintptr_t)to, n))
+    {
+      return -EFAULT;
+    }
+
+  usercopy_move(to, from, n);
+  return OK;
+}
@@ -81,6 +81,14 @@ void clock_timer(void);
 #  define clock_timer()
 #endif
 
+#ifdef CONFIG_CLOCK_USERPAGE
+void clock_userpage_initialize(void);
+void clock_userpage_update(void);
+#else
+#  define clock_userpage_initialize()
+#  define clock_userpage_update()
+#endif
+
 /****************************************************************************
  * perf_init
  ****************************************************************************/
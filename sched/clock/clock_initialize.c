@@ -231,6 +231,10 @@ void clock_initialize(void)
 
   perf_init();
 
+  /* Publish the initial time state to the user-accessible clock page */
+
+  clock_userpage_initialize();
+
   sched_trace_end();
 }
 
@@ -395,5 +399,9 @@ void clock_timer(void)
   /* Increment the per-tick system counter */
 
   g_system_ticks++;
+
+  /* Refresh the user-accessible clock page */
+
+  clock_userpage_update();
 }
 #endif
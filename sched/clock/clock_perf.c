@@ -28,6 +28,7 @@
 
 #include <nuttx/clock.h>
 #include <nuttx/arch.h>
+#include <nuttx/irq.h>
 #include <nuttx/wdog.h>
 
 #if defined(CONFIG_PERF_OVERFLOW_CORRECTION) && ULONG_MAX != UINT64_MAX
@@ -92,7 +93,17 @@ void perf_init(void)
 clock_t perf_gettime(void)
 {
   FAR struct perf_s *perf = &g_perf;
-  unsigned long now = up_perf_gettime();
+  irqstate_t flags;
+  unsigned long now;
+  clock_t result;
+
+  /* The overflow bookkeeping must be updated atomically:  Two concurrent
+   * callers observing the same wrap would otherwise both bump the
+   * overflow count.
+   */
+
+  flags = enter_critical_section();
+  now = up_perf_gettime();
 
   /* Check if overflow */
 
@@ -102,7 +113,9 @@ clock_t perf_gettime(void)
     }
 
   perf->last = now;
-  return (clock_t)now | (clock_t)perf->overflow << 32;
+  result = (clock_t)now | (clock_t)perf->overflow << 32;
+  leave_critical_section(flags);
+  return result;
 }
 
 /****************************************************************************
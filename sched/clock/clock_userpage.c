@@ -0,0 +1,111 @@
+/****************************************************************************
+ * sched/clock/clock_userpage.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <string.h>
+#include <time.h>
+
+#include <nuttx/clock.h>
+
+#include "clock/clock.h"
+
+#ifdef CONFIG_CLOCK_USERPAGE
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: clock_userpage_initialize
+ *
+ * Description:
+ *   Put the clock page into a consistent initial state.  This must be done
+ *   before the first timer tick so that user-space readers never observe
+ *   uninitialized page contents.
+ *
+ * Input Parameters:
+ *   None
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void clock_userpage_initialize(void)
+{
+  FAR struct clock_userpage_s *cp = CLOCK_USERPAGE;
+
+  memset(cp, 0, sizeof(struct clock_userpage_s));
+  clock_userpage_update();
+}
+
+/****************************************************************************
+ * Name: clock_userpage_update
+ *
+ * Description:
+ *   Refresh the clock page from the kernel time state.  This is called
+ *   from the timer interrupt on each tick; because the base time is
+ *   copied as well, changes made by clock_settime() propagate to user
+ *   readers no later than the next tick.
+ *
+ * Input Parameters:
+ *   None
+ *
+ * Returned Value:
+ *   None
+ *
+ * Assumptions:
+ *   Called from within the timer interrupt or with interrupts disabled so
+ *   that updates are not preempted by other updates.
+ *
+ ****************************************************************************/
+
+void clock_userpage_update(void)
+{
+  FAR struct clock_userpage_s *cp = CLOCK_USERPAGE;
+
+  /* Mark the update in progress.  User-space readers will retry while
+   * cp_seq is odd.
+   */
+
+  cp->cp_seq++;
+
+  /* Keep the stores between the sequence increments:  cp_basetime is not
+   * volatile and could otherwise be moved across them.
+   */
+
+  clock_userpage_barrier();
+  cp->cp_ticks    = g_system_ticks;
+  cp->cp_basetime = g_basetime;
+  clock_userpage_barrier();
+
+  /* Mark the update complete */
+
+  cp->cp_seq++;
+}
+
+#endif /* CONFIG_CLOCK_USERPAGE */
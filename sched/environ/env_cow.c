@@ -0,0 +1,141 @@
+/****************************************************************************
+ * sched/environ/env_cow.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#ifdef CONFIG_SCHED_ENVIRON_COW
+
+#include <sys/types.h>
+#include <sched.h>
+#include <string.h>
+#include <assert.h>
+#include <errno.h>
+
+#include <nuttx/kmalloc.h>
+
+#include "sched/sched.h"
+#include "environ/environ.h"
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: env_cow
+ *
+ * Description:
+ *   If the group's environment block is shared with other task groups,
+ *   then replace it with a private deep copy so that the caller may
+ *   safely modify it.  This must be called by any interface that modifies
+ *   the environment before touching tg_envp.  If the environment is
+ *   already private, this function does nothing.
+ *
+ * Input Parameters:
+ *   group - The task group whose environment is about to be modified.
+ *
+ * Returned Value:
+ *   Zero on success.  A negated errno value is returned if the private
+ *   copy could not be allocated; in that case the shared environment is
+ *   left untouched.
+ *
+ * Assumptions:
+ *   - Not called from an interrupt handler.
+ *   - Pre-emption is disabled by the caller.
+ *
+ ****************************************************************************/
+
+int env_cow(FAR struct task_group_s *group)
+{
+  FAR char **oldenvp;
+  FAR char **envp = NULL;
+  size_t envc;
+  size_t size;
+
+  DEBUGASSERT(group != NULL);
+
+  /* If the environment is not shared, then there is nothing to do */
+
+  if (group->tg_envref == NULL)
+    {
+      return OK;
+    }
+
+  /* If we are the only remaining sharer, then simply take ownership of
+   * the block; no copy is needed.
+   */
+
+  if (*group->tg_envref == 1)
+    {
+      kmm_free((FAR void *)group->tg_envref);
+      group->tg_envref = NULL;
+      return OK;
+    }
+
+  /* Deep-copy the shared environment into a private allocation */
+
+  oldenvp = group->tg_envp;
+  if (oldenvp != NULL && group->tg_envc > 0)
+    {
+      envp = group_malloc(group, sizeof(*envp) * group->tg_envpc);
+      if (envp == NULL)
+        {
+          return -ENOMEM;
+        }
+
+      envc = group->tg_envc;
+      envp[envc] = NULL;
+
+      while (envc-- > 0)
+        {
+          size = strlen(oldenvp[envc]) + 1;
+          envp[envc] = group_malloc(group, size);
+          if (envp[envc] == NULL)
+            {
+              while (envp[++envc] != NULL)
+                {
+                  group_free(group, envp[envc]);
+                }
+
+              group_free(group, envp);
+              return -ENOMEM;
+            }
+
+          strlcpy(envp[envc], oldenvp[envc], size);
+        }
+    }
+
+  /* Release our reference to the shared block and install the private
+   * copy.  Other sharers continue to reference the old block.
+   */
+
+  (*group->tg_envref)--;
+  group->tg_envref = NULL;
+  group->tg_envp   = envp;
+
+  return OK;
+}
+
+#endif /* CONFIG_SCHED_ENVIRON_COW */
@@ -65,6 +65,9 @@
 
 int env_dup(FAR struct task_group_s *group, FAR char * const *envcp)
 {
+#ifdef CONFIG_SCHED_ENVIRON_COW
+  FAR struct task_group_s *pgroup;
+#endif
   FAR char **envp = NULL;
   size_t envc = 0;
   size_t size;
@@ -82,6 +85,49 @@ int env_dup(FAR struct task_group_s *group, FAR char * const *envcp)
 
       sched_lock();
 
+#ifdef CONFIG_SCHED_ENVIRON_COW
+      /* If the strings to be copied are the creating group's own
+       * environment, then the block can be shared with the child and the
+       * deep copy deferred until one of the groups modifies it.  Sharing
+       * requires that both groups use the same memory allocator, i.e.,
+       * that they have the same privilege.
+       */
+
+      pgroup = this_task()->group;
+
+      if (pgroup != NULL && envcp == pgroup->tg_envp &&
+          (pgroup->tg_flags & GROUP_FLAG_PRIVILEGED) ==
+          (group->tg_flags & GROUP_FLAG_PRIVILEGED))
+        {
+          /* Set up the share count on first sharing */
+
+          if (pgroup->tg_envref == NULL)
+            {
+              pgroup->tg_envref = kmm_malloc(sizeof(uint16_t));
+              if (pgroup->tg_envref != NULL)
+                {
+                  *pgroup->tg_envref = 1;
+                }
+            }
+
+          if (pgroup->tg_envref != NULL &&
+              *pgroup->tg_envref < UINT16_MAX)
+            {
+              (*pgroup->tg_envref)++;
+
+              group->tg_envref = pgroup->tg_envref;
+              group->tg_envp   = pgroup->tg_envp;
+              group->tg_envc   = pgroup->tg_envc;
+              group->tg_envpc  = pgroup->tg_envpc;
+
+              sched_unlock();
+              return OK;
+            }
+
+          /* Otherwise, fall back to the deep copy below */
+        }
+#endif
+
       /* Count the strings */
 
       while (envcp[envc] != NULL)
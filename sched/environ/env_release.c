@@ -67,6 +67,33 @@ void env_release(FAR struct task_group_s *group)
 
   DEBUGASSERT(group != NULL);
 
+#ifdef CONFIG_SCHED_ENVIRON_COW
+  /* If the environment is shared, then just drop this group's reference.
+   * The block may be freed only when the last sharer is gone.
+   */
+
+  if (group->tg_envref != NULL)
+    {
+      sched_lock();
+      if (--(*group->tg_envref) > 0)
+        {
+          /* Other groups still reference the block; just detach from it */
+
+          group->tg_envref = NULL;
+          group->tg_envp   = NULL;
+          sched_unlock();
+        }
+      else
+        {
+          /* We were the last sharer; free the block below */
+
+          kmm_free((FAR void *)group->tg_envref);
+          group->tg_envref = NULL;
+          sched_unlock();
+        }
+    }
+#endif
+
   if (group->tg_envp)
     {
       /* Free any allocate environment strings */
@@ -115,6 +115,14 @@ int setenv(FAR const char *name, FAR const char *value, int overwrite)
   group = rtcb->group;
   DEBUGASSERT(group);
 
+  /* Make sure that we have a private, modifiable environment */
+
+  if (env_cow(group) < 0)
+    {
+      ret = ENOMEM;
+      goto errout_with_lock;
+    }
+
   /* Check if the variable already exists */
 
   if (group->tg_envp && (ret = env_findvar(group, name)) >= 0)
@@ -80,7 +80,18 @@ int unsetenv(FAR const char *name)
   sched_lock();
   if (group && (idx = env_findvar(group, name)) >= 0)
     {
-      /* It does!  Remove the name=value pair from the environment. */
+      /* It does!  Make sure that we have a private, modifiable
+       * environment, then remove the name=value pair from it.  The
+       * private copy preserves the order of the environment so that the
+       * index remains valid.
+       */
+
+      if (env_cow(group) < 0)
+        {
+          sched_unlock();
+          set_errno(ENOMEM);
+          return ERROR;
+        }
 
       env_removevar(group, idx);
     }
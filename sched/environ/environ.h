@@ -149,6 +149,33 @@ ssize_t env_findvar(FAR struct task_group_s *group, FAR const char *pname);
 
 void env_removevar(FAR struct task_group_s *group, ssize_t index);
 
+/****************************************************************************
+ * Name: env_cow
+ *
+ * Description:
+ *   If the group's environment block is shared with other task groups,
+ *   then replace it with a private deep copy so that the caller may
+ *   safely modify it.
+ *
+ * Input Parameters:
+ *   group - The task group whose environment is about to be modified.
+ *
+ * Returned Value:
+ *   Zero on success.  A negated errno value is returned if the private
+ *   copy could not be allocated.
+ *
+ * Assumptions:
+ *   - Not called from an interrupt handler
+ *   - Caller has pre-emption disabled
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SCHED_ENVIRON_COW
+int env_cow(FAR struct task_group_s *group);
+#else
+#  define env_cow(group) (0)
+#endif
+
 #undef EXTERN
 #ifdef __cplusplus
 }
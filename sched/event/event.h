@@ -49,4 +49,31 @@ struct nxevent_wait_s
   sem_t                   sem;     /* Wait sem of current task */
 };
 
+/****************************************************************************
+ * Inline Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxevent_waitmask_update
+ *
+ * Description:
+ *   Recompute the summary mask of the events expected by the remaining
+ *   waiters.  Must be called with the critical section held whenever
+ *   waiters have been removed from the waiting list.
+ *
+ ****************************************************************************/
+
+static inline_function void nxevent_waitmask_update(FAR nxevent_t *event)
+{
+  FAR nxevent_wait_t *wait;
+  nxevent_mask_t mask = 0;
+
+  list_for_every_entry(&event->list, wait, nxevent_wait_t, node)
+    {
+      mask |= wait->expect;
+    }
+
+  event->waitmask = mask;
+}
+
 #endif /* __SCHED_EVENT_EVENT_H */
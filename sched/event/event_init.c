@@ -48,6 +48,7 @@
 
 void nxevent_init(FAR nxevent_t *event, nxevent_mask_t events)
 {
-  event->events = events;
+  event->events   = events;
+  event->waitmask = 0;
   list_initialize(&event->list);
 }
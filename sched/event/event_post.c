@@ -109,7 +109,13 @@ int nxevent_post(FAR nxevent_t *event, nxevent_mask_t events,
       event->events |= events ? events : ~0;
     }
 
-  if (!list_is_empty(&event->list))
+  /* Scan the waiting list only if the posted events intersect some
+   * waiter's expected set.  A non-empty intersection is necessary for
+   * any wait condition (ANY or ALL) to be satisfiable, so posts of
+   * bits nobody is interested in return without touching the waiters.
+   */
+
+  if ((event->events & event->waitmask) != 0)
     {
       postall = ((eflags & NXEVENT_POST_ALL) != 0);
 
@@ -157,6 +163,10 @@ int nxevent_post(FAR nxevent_t *event, nxevent_mask_t events,
           event->events &= ~clear;
         }
 
+      /* Drop the woken waiters' bits from the summary mask */
+
+      nxevent_waitmask_update(event);
+
       sched_unlock();
     }
 
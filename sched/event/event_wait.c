@@ -122,6 +122,7 @@ nxevent_mask_t nxevent_tickwait(FAR nxevent_t *event, nxevent_mask_t events,
       wait.eflags = eflags;
 
       list_add_tail(&event->list, &wait.node);
+      event->waitmask |= events;
 
       /* Wait for the event */
 
@@ -145,6 +146,7 @@ nxevent_mask_t nxevent_tickwait(FAR nxevent_t *event, nxevent_mask_t events,
       else
         {
           list_delete(&wait.node);
+          nxevent_waitmask_update(event);
           events = 0;
         }
     }
@@ -27,6 +27,7 @@
 #include <nuttx/config.h>
 
 #include <sched.h>
+#include <string.h>
 #include <assert.h>
 #include <errno.h>
 #include <debug.h>
@@ -49,6 +50,13 @@
 #  undef CONFIG_DEBUG_CHILDSTATUS
 #endif
 
+/* Map a child PID to a hash bucket of the per-group child status table */
+
+#ifdef CONFIG_SCHED_CHILD_STATUS_HASH
+#  define child_hash(pid) \
+     ((unsigned int)(pid) % CONFIG_SCHED_CHILD_STATUS_HASH_BUCKETS)
+#endif
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -240,8 +248,22 @@ void group_add_child(FAR struct task_group_s *group,
   /* Add the entry into the TCB list of children */
 
   child->flink  = group->tg_children;
+#ifdef CONFIG_SCHED_CHILD_STATUS_HASH
+  child->blink  = NULL;
+  if (child->flink != NULL)
+    {
+      child->flink->blink = child;
+    }
+#endif
   group->tg_children = child;
 
+#ifdef CONFIG_SCHED_CHILD_STATUS_HASH
+  /* Add the entry into the PID hash table as well */
+
+  child->hlink = group->tg_chashtbl[child_hash(child->ch_pid)];
+  group->tg_chashtbl[child_hash(child->ch_pid)] = child;
+#endif
+
   group_dump_children(group, "group_add_child");
 }
 
@@ -276,7 +298,13 @@ FAR struct child_status_s *group_find_child(FAR struct task_group_s *group,
 
   /* Find the status structure with the matching PID  */
 
+#ifdef CONFIG_SCHED_CHILD_STATUS_HASH
+  for (child = group->tg_chashtbl[child_hash(pid)];
+       child;
+       child = child->hlink)
+#else
   for (child = group->tg_children; child; child = child->flink)
+#endif
     {
       if (child->ch_pid == pid)
         {
@@ -353,6 +381,54 @@ FAR struct child_status_s *group_remove_child(FAR struct task_group_s *group,
 
   DEBUGASSERT(group);
 
+#ifdef CONFIG_SCHED_CHILD_STATUS_HASH
+  /* Find the status structure in its hash bucket */
+
+  for (prev = NULL, curr = group->tg_chashtbl[child_hash(pid)];
+       curr;
+       prev = curr, curr = curr->hlink)
+    {
+      if (curr->ch_pid == pid)
+        {
+          break;
+        }
+    }
+
+  /* Did we find it?  If so, remove it from the hash bucket and from the
+   * sibling list.
+   */
+
+  if (curr)
+    {
+      if (prev)
+        {
+          prev->hlink = curr->hlink;
+        }
+      else
+        {
+          group->tg_chashtbl[child_hash(pid)] = curr->hlink;
+        }
+
+      if (curr->blink)
+        {
+          curr->blink->flink = curr->flink;
+        }
+      else
+        {
+          group->tg_children = curr->flink;
+        }
+
+      if (curr->flink)
+        {
+          curr->flink->blink = curr->blink;
+        }
+
+      curr->flink = NULL;
+      curr->blink = NULL;
+      curr->hlink = NULL;
+      group_dump_children(group, "group_remove_child");
+    }
+#else
   /* Find the status structure with the matching PID */
 
   for (prev = NULL, curr = group->tg_children;
@@ -383,6 +459,7 @@ FAR struct child_status_s *group_remove_child(FAR struct task_group_s *group,
       curr->flink = NULL;
       group_dump_children(group, "group_remove_child");
     }
+#endif
 
   return curr;
 }
@@ -421,6 +498,9 @@ void group_remove_children(FAR struct task_group_s *group)
     }
 
   group->tg_children = NULL;
+#ifdef CONFIG_SCHED_CHILD_STATUS_HASH
+  memset(group->tg_chashtbl, 0, sizeof(group->tg_chashtbl));
+#endif
   group_dump_children(group, "group_remove_children");
 }
 
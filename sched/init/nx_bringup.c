@@ -50,6 +50,7 @@
 #endif
 
 #include "sched/sched.h"
+#include "task/task.h"
 #include "wqueue/wqueue.h"
 #include "init/init.h"
 
@@ -174,6 +175,34 @@ static inline void nx_pgworker(void)
 
 #endif /* CONFIG_LEGACY_PAGING */
 
+/****************************************************************************
+ * Name: nx_reaper
+ *
+ * Description:
+ *   Start the reaper kernel thread that performs the deferred teardown of
+ *   exited tasks.
+ *
+ * Input Parameters:
+ *   None
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SCHED_REAPER
+static inline void nx_reaper(void)
+{
+  sinfo("Starting reaper thread\n");
+
+  nxtask_reaper_start();
+}
+
+#else /* CONFIG_SCHED_REAPER */
+#  define nx_reaper()
+
+#endif /* CONFIG_SCHED_REAPER */
+
 /****************************************************************************
  * Name: nx_workqueues
  *
@@ -211,6 +240,12 @@ static inline void nx_workqueues(void)
 
   work_start_lowpri();
 
+#ifdef CONFIG_SCHED_STACKMONITOR
+  /* Start the periodic stack usage sampler on the low-priority queue */
+
+  nxsched_stackmonitor_start();
+#endif
+
 #endif /* CONFIG_SCHED_LPWORK */
 
 #ifdef CONFIG_LIBC_USRWORK
@@ -516,6 +551,12 @@ int nx_bringup(void)
 
   nx_pgworker();
 
+  /* Start the reaper thread that will perform the deferred teardown of
+   * exited tasks.
+   */
+
+  nx_reaper();
+
   /* Start the worker thread that will serve as the device driver "bottom-
    * half" and will perform misc garbage clean-up.
    */
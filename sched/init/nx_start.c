@@ -426,6 +426,12 @@ static void idle_task_initialize(void)
 #endif
       dq_addfirst((FAR dq_entry_t *)tcb, tasklist);
 
+#ifdef CONFIG_SCHED_PRIO_BITMAP
+      /* Account for the IDLE task in the priority bitmap index */
+
+      nxsched_prioq_register(tcb);
+#endif
+
       /* Mark the idle task as the running task */
 
       g_running_tasks[i] = tcb;
@@ -65,21 +65,56 @@
  * interrupt.
  */
 
+#ifdef CONFIG_SCHED_IRQMONITOR
+#  ifdef CONFIG_SMP
+#    define IRQMON_NCPUS CONFIG_SMP_NCPUS
+#  else
+#    define IRQMON_NCPUS 1
+#  endif
+
+#ifdef CONFIG_SCHED_IRQMONITOR_HISTOGRAM
+/* Number of log2 bins of handler execution time, in perf ticks.  The
+ * last bin collects everything at or above 2^(IRQHIST_NBINS-2) ticks.
+ */
+
+#  define IRQHIST_NBINS 16
+#endif
+#endif
+
+/* This entry holds only what irq_dispatch needs to transfer control to
+ * the interrupt handler.  Monitor statistics are kept out of line in
+ * struct irq_stats_s so that the write traffic they generate does not
+ * dirty the cache lines that the dispatch fast path reads.
+ */
+
 struct irq_info_s
 {
   xcpt_t handler;    /* Address of the interrupt handler */
   FAR void *arg;     /* The argument provided to the interrupt handler. */
+};
+
 #ifdef CONFIG_SCHED_IRQMONITOR
-  clock_t start;     /* Time interrupt attached */
-  clock_t time;      /* Maximum execution time on this IRQ */
-  uint32_t count;    /* Number of interrupts on this IRQ */
+/* Interrupt statistics, one entry for each IRQ.  The counters are kept
+ * per CPU so that they can be updated from the dispatch path without
+ * locks or atomic operations; readers sum (or take the maximum) over
+ * the CPUs.
+ */
+
+struct irq_stats_s
+{
+  clock_t start;                  /* Time interrupt attached */
+  clock_t time[IRQMON_NCPUS];     /* Maximum execution time, per CPU */
+  uint32_t count[IRQMON_NCPUS];   /* Number of interrupts, per CPU */
+#ifdef CONFIG_SCHED_IRQMONITOR_HISTOGRAM
+  uint32_t hist[IRQMON_NCPUS][IRQHIST_NBINS];
+                                  /* log2 histogram of execution time */
 #endif
 };
 
-#ifdef CONFIG_SCHED_IRQMONITOR
 /* This is the type of the callback from irq_foreach(). */
 
 typedef CODE int (*irq_foreach_t)(int irq, FAR struct irq_info_s *info,
+                                  FAR struct irq_stats_s *stats,
                                   FAR void *arg);
 #endif
 
@@ -98,6 +133,16 @@ extern struct irq_info_s g_irqvector[CONFIG_ARCH_NUSER_INTERRUPTS];
 extern struct irq_info_s g_irqvector[NR_IRQS];
 #endif
 
+/* Interrupt monitor statistics, parallel to g_irqvector */
+
+#ifdef CONFIG_SCHED_IRQMONITOR
+#ifdef CONFIG_ARCH_MINIMAL_VECTORTABLE
+extern struct irq_stats_s g_irqstats[CONFIG_ARCH_NUSER_INTERRUPTS];
+#else
+extern struct irq_stats_s g_irqstats[NR_IRQS];
+#endif
+#endif
+
 /* This is the interrupt vector mapping table.  This must be provided by
  * architecture specific logic if CONFIG_ARCH_MINIMAL_VECTORTABLE is define
  * in the configuration.
@@ -119,7 +164,12 @@ extern const irq_mapped_t g_irqmap[NR_IRQS];
  * disabled.
  */
 
+#ifdef CONFIG_MCS_SPINLOCK
+extern struct mcs_lock_s g_cpu_irqlock;
+extern struct mcs_node_s g_cpu_irqlock_node[CONFIG_SMP_NCPUS];
+#else
 extern volatile spinlock_t g_cpu_irqlock;
+#endif
 
 /* Used to keep track of which CPU(s) hold the IRQ lock. */
 
@@ -178,6 +228,7 @@ int irq_unexpected_isr(int irq, FAR void *context, FAR void *arg);
  * Input Parameters:
  *   callback - This function will be called for each attached interrupt
  *              along with the IRQ number, an instance of struct irq_info_s,
+ *              the associated struct irq_stats_s,
  *              and the caller provided argument
  *   args     - This is an opaque argument provided with each call to the
  *              callback function.
@@ -27,6 +27,7 @@
 #include <nuttx/config.h>
 
 #include <errno.h>
+#include <string.h>
 
 #include <nuttx/irq.h>
 
@@ -151,9 +152,8 @@ int irq_attach(int irq, xcpt_t isr, FAR void *arg)
       g_irqvector[ndx].handler = isr;
       g_irqvector[ndx].arg     = arg;
 #ifdef CONFIG_SCHED_IRQMONITOR
-      g_irqvector[ndx].start   = clock_systime_ticks();
-      g_irqvector[ndx].time    = 0;
-      g_irqvector[ndx].count   = 0;
+      memset(&g_irqstats[ndx], 0, sizeof(struct irq_stats_s));
+      g_irqstats[ndx].start    = clock_systime_ticks();
 #endif
 
       spin_unlock_irqrestore(NULL, flags);
@@ -82,16 +82,14 @@ static int irqchain_dispatch(int irq, FAR void *context, FAR void *arg)
 {
   FAR struct irqchain_s *curr;
   FAR struct irqchain_s *prev;
-  int ndx;
   int ret = 0;
 
-#ifdef CONFIG_ARCH_MINIMAL_VECTORTABLE
-  ndx = g_irqmap[irq];
-#else
-  ndx = irq;
-#endif
+  /* irq_dispatch has already looked up this IRQ in the vector table and
+   * passes the chain head as the handler argument, so there is no need
+   * to repeat the g_irqmap/g_irqvector lookups here.
+   */
 
-  curr = g_irqvector[ndx].arg;
+  curr = (FAR struct irqchain_s *)arg;
   while (curr != NULL)
     {
       prev = curr;
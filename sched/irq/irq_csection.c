@@ -57,10 +57,21 @@
 
 #ifdef CONFIG_SMP
 /* This is the spinlock that enforces critical sections when interrupts are
- * disabled.
+ * disabled.  With CONFIG_MCS_SPINLOCK it is a queued (MCS) lock so that
+ * the CPUs contending for the critical section spin on their own queue
+ * node instead of ping-ponging the shared lock cache line; the per-CPU
+ * queue nodes live in g_cpu_irqlock_node[].  This is safe because the
+ * lock is always released by the CPU that acquired it and each CPU waits
+ * for at most one acquisition at a time (local interrupts are disabled
+ * at every locking site).
  */
 
+#ifdef CONFIG_MCS_SPINLOCK
+struct mcs_lock_s g_cpu_irqlock = MCS_LOCK_INITIALIZER;
+struct mcs_node_s g_cpu_irqlock_node[CONFIG_SMP_NCPUS];
+#else
 volatile spinlock_t g_cpu_irqlock = SP_UNLOCKED;
+#endif
 
 /* Used to keep track of which CPU(s) hold the IRQ lock. */
 
@@ -157,7 +168,7 @@ irqstate_t enter_critical_section(void)
       cpu = this_cpu();
       if (g_cpu_nestcount[cpu] > 0)
         {
-          DEBUGASSERT(spin_is_locked(&g_cpu_irqlock) &&
+          DEBUGASSERT(cpu_irqlock_islocked() &&
                       g_cpu_nestcount[cpu] < UINT8_MAX);
           g_cpu_nestcount[cpu]++;
         }
@@ -181,7 +192,7 @@ irqstate_t enter_critical_section(void)
                * no longer blocked by the critical section).
                */
 
-              spin_lock(&g_cpu_irqlock);
+              cpu_irqlock_acquire();
               cpu_irqlock_set(cpu);
             }
 
@@ -189,7 +200,7 @@ irqstate_t enter_critical_section(void)
 
           g_cpu_nestcount[cpu] = 1;
 
-          DEBUGASSERT(spin_is_locked(&g_cpu_irqlock) &&
+          DEBUGASSERT(cpu_irqlock_islocked() &&
                       (g_cpu_irqset & (1 << cpu)) != 0);
         }
     }
@@ -216,7 +227,7 @@ irqstate_t enter_critical_section(void)
            * and (2) this CPU should hold the lock.
            */
 
-          DEBUGASSERT(spin_is_locked(&g_cpu_irqlock) &&
+          DEBUGASSERT(cpu_irqlock_islocked() &&
                       (g_cpu_irqset & (1 << this_cpu())) != 0 &&
                       rtcb->irqcount < INT16_MAX);
           rtcb->irqcount++;
@@ -232,7 +243,7 @@ irqstate_t enter_critical_section(void)
 
           DEBUGASSERT((g_cpu_irqset & (1 << cpu)) == 0);
 
-          spin_lock(&g_cpu_irqlock);
+          cpu_irqlock_acquire();
 
           /* Then set the lock count to 1.
            *
@@ -336,7 +347,7 @@ void leave_critical_section(irqstate_t flags)
         {
           /* Yes.. then just decrement the nesting count */
 
-          DEBUGASSERT(spin_is_locked(&g_cpu_irqlock));
+          DEBUGASSERT(cpu_irqlock_islocked());
           g_cpu_nestcount[cpu]--;
         }
       else
@@ -345,7 +356,7 @@ void leave_critical_section(irqstate_t flags)
            * and release the spinlock (if necessary).
            */
 
-          DEBUGASSERT(spin_is_locked(&g_cpu_irqlock) &&
+          DEBUGASSERT(cpu_irqlock_islocked() &&
                       g_cpu_nestcount[cpu] == 1);
 
           FAR struct tcb_s *rtcb = current_task(cpu);
@@ -383,7 +394,7 @@ void leave_critical_section(irqstate_t flags)
         {
           /* Yes... the spinlock should remain set */
 
-          DEBUGASSERT(spin_is_locked(&g_cpu_irqlock));
+          DEBUGASSERT(cpu_irqlock_islocked());
           rtcb->irqcount--;
         }
       else
@@ -400,7 +411,7 @@ void leave_critical_section(irqstate_t flags)
            * released, then unlock the spinlock.
            */
 
-          DEBUGASSERT(spin_is_locked(&g_cpu_irqlock) &&
+          DEBUGASSERT(cpu_irqlock_islocked() &&
                       (g_cpu_irqset & (1 << cpu)) != 0);
 
           /* Now, possibly on return from a context switch, clear our
@@ -51,6 +51,28 @@
  * interrupt request
  */
 
+/* IRQHIST_ADD - Account one handler execution time in the per-CPU log2
+ * histogram of this IRQ.  The counters are private to this CPU, so no
+ * lock or atomic operation is needed.
+ */
+
+#ifdef CONFIG_SCHED_IRQMONITOR_HISTOGRAM
+#  define IRQHIST_ADD(ndx, cpu, elapsed) \
+     do \
+       { \
+         clock_t value = (elapsed); \
+         unsigned int bin; \
+         for (bin = 0; value > 1 && bin < IRQHIST_NBINS - 1; bin++) \
+           { \
+             value >>= 1; \
+           } \
+         g_irqstats[ndx].hist[cpu][bin]++; \
+       } \
+     while (0)
+#else
+#  define IRQHIST_ADD(ndx, cpu, elapsed)
+#endif
+
 #ifdef CONFIG_SCHED_IRQMONITOR
 #  define CALL_VECTOR(ndx, vector, irq, context, arg) \
      do \
@@ -62,11 +84,13 @@
          elapsed = perf_gettime() - start; \
          if (ndx < NUSER_IRQS) \
            { \
-             g_irqvector[ndx].count++; \
-             if (elapsed > g_irqvector[ndx].time) \
+             int cpu = this_cpu(); \
+             g_irqstats[ndx].count[cpu]++; \
+             if (elapsed > g_irqstats[ndx].time[cpu]) \
                { \
-                 g_irqvector[ndx].time = elapsed; \
+                 g_irqstats[ndx].time[cpu] = elapsed; \
                } \
+             IRQHIST_ADD(ndx, cpu, elapsed); \
            } \
          if (CONFIG_SCHED_CRITMONITOR_MAXTIME_IRQ > 0 && \
              elapsed > CONFIG_SCHED_CRITMONITOR_MAXTIME_IRQ) \
@@ -65,7 +65,8 @@
  * Input Parameters:
  *   callback - This function will be called for each attached interrupt
  *              along with the IRQ number, an instance of struct irq_info_s,
- *              and the caller provided argument
+ *              the associated struct irq_stats_s, and the caller provided
+ *              argument
  *   args     - This is an opaque argument provided with each call to the
  *              callback function.
  *
@@ -91,7 +92,7 @@ int irq_foreach(irq_foreach_t callback, FAR void *arg)
       if (g_irqvector[irq].handler != NULL &&
           g_irqvector[irq].handler != irq_unexpected_isr)
         {
-          ret = callback(irq, &g_irqvector[irq], arg);
+          ret = callback(irq, &g_irqvector[irq], &g_irqstats[irq], arg);
           if (ret != 0)
             {
               return ret;
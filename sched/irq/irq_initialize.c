@@ -55,6 +55,19 @@ struct irq_info_s g_irqvector[CONFIG_ARCH_NUSER_INTERRUPTS];
 struct irq_info_s g_irqvector[NR_IRQS];
 #endif
 
+/* This is the interrupt monitor statistics table.  It is kept separate
+ * from the vector table so that counter updates do not write to the
+ * cache lines read by the dispatch fast path.
+ */
+
+#ifdef CONFIG_SCHED_IRQMONITOR
+#ifdef CONFIG_ARCH_MINIMAL_VECTORTABLE
+struct irq_stats_s g_irqstats[CONFIG_ARCH_NUSER_INTERRUPTS];
+#else
+struct irq_stats_s g_irqstats[NR_IRQS];
+#endif
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
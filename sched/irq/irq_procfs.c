@@ -93,7 +93,7 @@ struct irq_file_s
 /* irq_foreach() callback function */
 
 static int     irq_callback(int irq, FAR struct irq_info_s *info,
-                 FAR void *arg);
+                 FAR struct irq_stats_s *stats, FAR void *arg);
 
 /* File system methods */
 
@@ -142,30 +142,50 @@ const struct procfs_operations g_irq_operations =
  ****************************************************************************/
 
 static int irq_callback(int irq, FAR struct irq_info_s *info,
-                        FAR void *arg)
+                        FAR struct irq_stats_s *stats, FAR void *arg)
 {
   FAR struct irq_file_s *irqfile = (FAR struct irq_file_s *)arg;
   struct irq_info_s copy;
   struct timespec delta;
   irqstate_t flags;
   clock_t elapsed;
+  clock_t start;
+  clock_t time;
   clock_t now;
+  uint64_t total;
   size_t linesize;
   size_t copysize;
   unsigned long intpart;
   unsigned long fracpart;
   unsigned long count;
+  int cpu;
 
   DEBUGASSERT(irqfile != NULL);
 
-  /* Take a snapshot and reset the counts */
+  /* Take a snapshot and reset the counts.  The counters are per CPU;
+   * sum the counts and take the largest of the maximum times.
+   */
 
   flags = enter_critical_section();
   memcpy(&copy, info, sizeof(struct irq_info_s));
-  now         = clock_systime_ticks();
-  info->start = now;
-  info->time  = 0;
-  info->count = 0;
+  start = stats->start;
+  total = 0;
+  time  = 0;
+
+  for (cpu = 0; cpu < IRQMON_NCPUS; cpu++)
+    {
+      total += stats->count[cpu];
+      if (stats->time[cpu] > time)
+        {
+          time = stats->time[cpu];
+        }
+
+      stats->time[cpu]  = 0;
+      stats->count[cpu] = 0;
+    }
+
+  now          = clock_systime_ticks();
+  stats->start = now;
   leave_critical_section(flags);
 
   /* Don't bother if count == 0.
@@ -186,7 +206,7 @@ static int irq_callback(int irq, FAR struct irq_info_s *info,
    * byte offset into the pseudo-file, f_pos.
    */
 
-  if (copy.count == 0)
+  if (total == 0)
     {
       return 0;
     }
@@ -198,8 +218,8 @@ static int irq_callback(int irq, FAR struct irq_info_s *info,
    * then the following will likely overflow.
    */
 
-  elapsed = now - copy.start;
-  perf_convert(copy.time, &delta);
+  elapsed = now - start;
+  perf_convert(time, &delta);
 
 #ifdef CONFIG_HAVE_LONG_LONG
   /* elapsed = <current-time> - <start-time>, units=clock ticks
@@ -207,7 +227,7 @@ static int irq_callback(int irq, FAR struct irq_info_s *info,
    */
 
   elapsed = elapsed ? elapsed : 1;
-  intpart = (unsigned int)((copy.count * TICK_PER_SEC) / elapsed);
+  intpart = (unsigned int)((total * TICK_PER_SEC) / elapsed);
   if (intpart >= 10000)
     {
       intpart  = 9999;
@@ -217,18 +237,18 @@ static int irq_callback(int irq, FAR struct irq_info_s *info,
     {
       uint64_t intcount = ((uint64_t)intpart * elapsed);
       fracpart = (unsigned int)
-        (((copy.count * TICK_PER_SEC - intcount) * 1000) / elapsed);
+        (((total * TICK_PER_SEC - intcount) * 1000) / elapsed);
     }
 
   /* Make sure that the count is representable with snprintf format */
 
-  if (copy.count > ULONG_MAX)
+  if (total > ULONG_MAX)
     {
       count = ULONG_MAX;
     }
   else
     {
-      count = (unsigned long)copy.count;
+      count = (unsigned long)total;
     }
 #else
 #  error Missing logic
@@ -422,6 +442,230 @@ static int irq_stat(const char *relpath, struct stat *buf)
   return OK;
 }
 
+#ifdef CONFIG_SCHED_IRQMONITOR_HISTOGRAM
+
+/****************************************************************************
+ * Name: irqhist_callback
+ *
+ * Description:
+ *   Output one line with the log2 histogram of handler execution times
+ *   for this IRQ, summed over all CPUs.  The per-CPU counters are only
+ *   ever incremented from their own CPU, so they are read without locks;
+ *   a tearing read costs at most one count in one bin.
+ *
+ ****************************************************************************/
+
+static int irqhist_callback(int irq, FAR struct irq_info_s *info,
+                            FAR struct irq_stats_s *stats,
+                            FAR void *arg)
+{
+  FAR struct irq_file_s *irqfile = (FAR struct irq_file_s *)arg;
+  unsigned long total;
+  unsigned long sum;
+  size_t linesize;
+  size_t copysize;
+  int bin;
+  int cpu;
+
+  DEBUGASSERT(irqfile != NULL);
+
+  /* Skip interrupts that have not fired since the last reset */
+
+  total = 0;
+  for (cpu = 0; cpu < IRQMON_NCPUS; cpu++)
+    {
+      for (bin = 0; bin < IRQHIST_NBINS; bin++)
+        {
+          total += stats->hist[cpu][bin];
+        }
+    }
+
+  if (total == 0)
+    {
+      return 0;
+    }
+
+  linesize = snprintf(irqfile->line, IRQ_LINELEN, "%3u", (unsigned int)irq);
+
+  for (bin = 0; bin < IRQHIST_NBINS; bin++)
+    {
+      sum = 0;
+      for (cpu = 0; cpu < IRQMON_NCPUS; cpu++)
+        {
+          sum += stats->hist[cpu][bin];
+        }
+
+      copysize = procfs_memcpy(irqfile->line, linesize, irqfile->buffer,
+                               irqfile->remaining, &irqfile->offset);
+
+      irqfile->ncopied   += copysize;
+      irqfile->buffer    += copysize;
+      irqfile->remaining -= copysize;
+
+      if (irqfile->remaining == 0)
+        {
+          return 1;
+        }
+
+      linesize = snprintf(irqfile->line, IRQ_LINELEN, " %8lu", sum);
+    }
+
+  linesize += snprintf(irqfile->line + linesize,
+                       IRQ_LINELEN - linesize, "\n");
+
+  copysize = procfs_memcpy(irqfile->line, linesize, irqfile->buffer,
+                           irqfile->remaining, &irqfile->offset);
+
+  irqfile->ncopied   += copysize;
+  irqfile->buffer    += copysize;
+  irqfile->remaining -= copysize;
+
+  return irqfile->remaining > 0 ? 0 : 1;
+}
+
+/****************************************************************************
+ * Name: irqhist_reset_callback
+ ****************************************************************************/
+
+static int irqhist_reset_callback(int irq, FAR struct irq_info_s *info,
+                                  FAR struct irq_stats_s *stats,
+                                  FAR void *arg)
+{
+  memset(stats->hist, 0, sizeof(stats->hist));
+  return 0;
+}
+
+/****************************************************************************
+ * Name: irqhist_open
+ ****************************************************************************/
+
+static int irqhist_open(FAR struct file *filep, FAR const char *relpath,
+                        int oflags, mode_t mode)
+{
+  FAR struct irq_file_s *irqfile;
+
+  finfo("Open '%s'\n", relpath);
+
+  /* Allocate a container to hold the file attributes.  Unlike "irqs",
+   * this file may also be opened for writing in order to reset the
+   * histograms.
+   */
+
+  irqfile = kmm_zalloc(sizeof(struct irq_file_s));
+  if (!irqfile)
+    {
+      ferr("ERROR: Failed to allocate file attributes\n");
+      return -ENOMEM;
+    }
+
+  filep->f_priv = (FAR void *)irqfile;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: irqhist_read
+ ****************************************************************************/
+
+static ssize_t irqhist_read(FAR struct file *filep, FAR char *buffer,
+                            size_t buflen)
+{
+  FAR struct irq_file_s *irqfile;
+  size_t linesize;
+  size_t copysize;
+
+  finfo("buffer=%p buflen=%d\n", buffer, (int)buflen);
+
+  irqfile = (FAR struct irq_file_s *)filep->f_priv;
+  DEBUGASSERT(irqfile);
+
+  /* Save the file offset and the user buffer information */
+
+  irqfile->offset    = filep->f_pos;
+  irqfile->buffer    = buffer;
+  irqfile->remaining = buflen;
+
+  /* The first line to output is the header */
+
+  linesize = snprintf(irqfile->line, IRQ_LINELEN,
+                      "IRQ COUNT PER LOG2(TIME) BIN\n");
+
+  copysize = procfs_memcpy(irqfile->line, linesize, irqfile->buffer,
+                           irqfile->remaining, &irqfile->offset);
+
+  irqfile->ncopied    = copysize;
+  irqfile->buffer    += copysize;
+  irqfile->remaining -= copysize;
+
+  /* Now traverse the list of attached interrupts, generating one
+   * histogram line for each.
+   */
+
+  irq_foreach(irqhist_callback, (FAR void *)irqfile);
+
+  /* Update the file position */
+
+  filep->f_pos += irqfile->ncopied;
+  return irqfile->ncopied;
+}
+
+/****************************************************************************
+ * Name: irqhist_write
+ *
+ * Description:
+ *   Writing anything to "irqhist" resets all histograms.
+ *
+ ****************************************************************************/
+
+static ssize_t irqhist_write(FAR struct file *filep,
+                             FAR const char *buffer, size_t buflen)
+{
+  irq_foreach(irqhist_reset_callback, NULL);
+  return buflen;
+}
+
+/****************************************************************************
+ * Name: irqhist_stat
+ ****************************************************************************/
+
+static int irqhist_stat(FAR const char *relpath, FAR struct stat *buf)
+{
+  /* "irqhist" is readable by everyone and writable (for reset) by the
+   * owner.
+   */
+
+  memset(buf, 0, sizeof(struct stat));
+  buf->st_mode = S_IFREG | S_IROTH | S_IRGRP | S_IRUSR | S_IWUSR;
+  return OK;
+}
+
+#endif /* CONFIG_SCHED_IRQMONITOR_HISTOGRAM */
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+#ifdef CONFIG_SCHED_IRQMONITOR_HISTOGRAM
+/* See fs_mount.c -- this structure is explicitly extern'ed there. */
+
+const struct procfs_operations g_irqhist_operations =
+{
+  irqhist_open,   /* open */
+  irq_close,      /* close */
+  irqhist_read,   /* read */
+  irqhist_write,  /* write */
+  NULL,           /* poll */
+
+  irq_dup,        /* dup */
+
+  NULL,           /* opendir */
+  NULL,           /* closedir */
+  NULL,           /* readdir */
+  NULL,           /* rewinddir */
+
+  irqhist_stat    /* stat */
+};
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
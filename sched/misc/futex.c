@@ -0,0 +1,226 @@
+/****************************************************************************
+ * sched/misc/futex.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <errno.h>
+#include <time.h>
+
+#include <nuttx/clock.h>
+#include <nuttx/futex.h>
+#include <nuttx/irq.h>
+#include <nuttx/queue.h>
+#include <nuttx/semaphore.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Map a word address to its hash bucket.  The two low address bits carry
+ * no information for a naturally aligned 32-bit word.
+ */
+
+#define FUTEX_BUCKET(addr) \
+  (((uintptr_t)(addr) >> 2) & (CONFIG_FUTEX_NBUCKETS - 1))
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* One blocked task.  The structure lives on the waiter's stack for the
+ * duration of futex_wait(), so no allocation is needed.
+ */
+
+struct futex_waiter_s
+{
+  dq_entry_t node;     /* Supports the bucket wait queue */
+  uintptr_t  key;      /* Address of the word waited on */
+  bool       queued;   /* True: still on the wait queue */
+  sem_t      sem;      /* The waiter blocks on this semaphore */
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* The table of wait queues, hashed by word address.  The queues are only
+ * manipulated from within a critical section.
+ */
+
+static dq_queue_t g_futex_buckets[CONFIG_FUTEX_NBUCKETS];
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: futex_wait
+ *
+ * Description:
+ *   Atomically verify that the 32-bit word at 'addr' still contains the
+ *   expected value 'val' and, if so, block until another task calls
+ *   futex_wake() on the same address or the timeout expires.
+ *
+ * Input Parameters:
+ *   addr    - Address of the 32-bit word to wait on
+ *   val     - The value 'addr' is expected to still hold
+ *   timeout - Relative time to wait, or NULL to wait forever
+ *
+ * Returned Value:
+ *   Zero (OK) when woken by futex_wake(); a negated errno value on
+ *   failure (see include/nuttx/futex.h).
+ *
+ ****************************************************************************/
+
+int futex_wait(FAR const uint32_t *addr, uint32_t val,
+               FAR const struct timespec *timeout)
+{
+  struct futex_waiter_s waiter;
+  irqstate_t flags;
+  int ret;
+
+  if (addr == NULL)
+    {
+      return -EINVAL;
+    }
+
+  if (timeout != NULL &&
+      (timeout->tv_sec < 0 || timeout->tv_nsec < 0 ||
+       timeout->tv_nsec >= NSEC_PER_SEC))
+    {
+      return -EINVAL;
+    }
+
+  waiter.key    = (uintptr_t)addr;
+  waiter.queued = true;
+  nxsem_init(&waiter.sem, 0, 0);
+
+  /* The value check and the enqueue must be atomic with respect to
+   * futex_wake():  A waker that changes the word and then calls
+   * futex_wake() either sees us on the queue or we see the new value.
+   */
+
+  flags = enter_critical_section();
+  if (*addr != val)
+    {
+      leave_critical_section(flags);
+      nxsem_destroy(&waiter.sem);
+      return -EAGAIN;
+    }
+
+  dq_addlast(&waiter.node, &g_futex_buckets[FUTEX_BUCKET(addr)]);
+  leave_critical_section(flags);
+
+  /* A wake arriving from here on will post the semaphore, so the wait
+   * below returns immediately in that case.
+   */
+
+  if (timeout != NULL)
+    {
+      ret = nxsem_tickwait(&waiter.sem, clock_time2ticks(timeout));
+    }
+  else
+    {
+      ret = nxsem_wait(&waiter.sem);
+    }
+
+  if (ret < 0)
+    {
+      /* Timeout or signal.  If futex_wake() dequeued us concurrently,
+       * the wake wins and the wait is reported as successful.
+       */
+
+      flags = enter_critical_section();
+      if (waiter.queued)
+        {
+          dq_rem(&waiter.node, &g_futex_buckets[FUTEX_BUCKET(addr)]);
+        }
+      else
+        {
+          ret = OK;
+        }
+
+      leave_critical_section(flags);
+    }
+
+  nxsem_destroy(&waiter.sem);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: futex_wake
+ *
+ * Description:
+ *   Wake up to 'count' tasks currently blocked in futex_wait() on the
+ *   32-bit word at 'addr'.  Waiters are woken in FIFO order.
+ *
+ * Input Parameters:
+ *   addr  - Address of the 32-bit word waiters are blocked on
+ *   count - Maximum number of waiters to wake
+ *
+ * Returned Value:
+ *   The number of tasks woken (zero or more) on success; a negated errno
+ *   value on failure (see include/nuttx/futex.h).
+ *
+ ****************************************************************************/
+
+int futex_wake(FAR const uint32_t *addr, int count)
+{
+  FAR struct futex_waiter_s *waiter;
+  FAR dq_entry_t *entry;
+  FAR dq_entry_t *next;
+  FAR dq_queue_t *bucket;
+  irqstate_t flags;
+  int nwoken = 0;
+
+  if (addr == NULL || count < 0)
+    {
+      return -EINVAL;
+    }
+
+  bucket = &g_futex_buckets[FUTEX_BUCKET(addr)];
+
+  flags = enter_critical_section();
+  for (entry = dq_peek(bucket); entry != NULL && nwoken < count;
+       entry = next)
+    {
+      next   = entry->flink;
+      waiter = (FAR struct futex_waiter_s *)entry;
+
+      if (waiter->key == (uintptr_t)addr)
+        {
+          dq_rem(&waiter->node, bucket);
+          waiter->queued = false;
+          nxsem_post(&waiter->sem);
+          nwoken++;
+        }
+    }
+
+  leave_critical_section(flags);
+  return nwoken;
+}
@@ -41,6 +41,10 @@
 #ifndef CONFIG_DISABLE_MQUEUE
 #  define MQ_BLOCK_SIZE \
     ALIGN_UP(MQ_MSG_SIZE(MQ_MAX_BYTES), sizeof(void *))
+#  if CONFIG_MQ_SMALLMSGSIZE > 0
+#    define MQ_SMALL_BLOCK_SIZE \
+      ALIGN_UP(MQ_MSG_SIZE(CONFIG_MQ_SMALLMSGSIZE), sizeof(void *))
+#  endif
 #endif
 
 /****************************************************************************
@@ -53,6 +57,9 @@ struct msgpool_s
   uint8_t mqueue[MQ_BLOCK_SIZE *
                  (CONFIG_PREALLOC_MQ_MSGS +
                   CONFIG_PREALLOC_MQ_IRQ_MSGS)];
+#  if CONFIG_MQ_SMALLMSGSIZE > 0
+  uint8_t mqsmall[MQ_SMALL_BLOCK_SIZE * CONFIG_PREALLOC_MQ_SMALL_MSGS];
+#  endif
 #endif
 #ifndef CONFIG_DISABLE_MQUEUE_SYSV
   struct msgbuf_s msgbuf[CONFIG_PREALLOC_MQ_MSGS];
@@ -78,6 +85,14 @@ struct list_node g_msgfree;
 
 struct list_node g_msgfreeirq;
 
+/* The g_msgfreesmall is a list of small messages that are available for
+ * general use.
+ */
+
+#if CONFIG_MQ_SMALLMSGSIZE > 0
+struct list_node g_msgfreesmall;
+#endif
+
 #endif
 
 /****************************************************************************
@@ -105,7 +120,7 @@ static struct msgpool_s g_msgpool;
 
 #ifndef CONFIG_DISABLE_MQUEUE
 static FAR void * mq_msgblockinit(FAR struct list_node *list,
-                                  FAR uint8_t *block,
+                                  FAR uint8_t *block, uint16_t blocksize,
                                   uint16_t nmsgs, uint8_t alloc_type)
 {
   FAR struct mqueue_msg_s *mqmsgblock;
@@ -117,7 +132,7 @@ static FAR void * mq_msgblockinit(FAR struct list_node *list,
 
       mqmsgblock->type = alloc_type;
       list_add_tail(list, &mqmsgblock->node);
-      block += MQ_BLOCK_SIZE;
+      block += blocksize;
     }
 
   return block;
@@ -174,8 +189,8 @@ void nxmq_initialize(void)
 #ifndef CONFIG_DISABLE_MQUEUE
   list_initialize(&g_msgfree);
 
-  msg = mq_msgblockinit(&g_msgfree, msg, CONFIG_PREALLOC_MQ_MSGS,
-                         MQ_ALLOC_FIXED);
+  msg = mq_msgblockinit(&g_msgfree, msg, MQ_BLOCK_SIZE,
+                         CONFIG_PREALLOC_MQ_MSGS, MQ_ALLOC_FIXED);
 
   /* Initialize a block of messages for use exclusively by
    * interrupt handlers
@@ -183,8 +198,17 @@ void nxmq_initialize(void)
 
   list_initialize(&g_msgfreeirq);
 
-  msg = mq_msgblockinit(&g_msgfreeirq, msg, CONFIG_PREALLOC_MQ_IRQ_MSGS,
-                         MQ_ALLOC_IRQ);
+  msg = mq_msgblockinit(&g_msgfreeirq, msg, MQ_BLOCK_SIZE,
+                         CONFIG_PREALLOC_MQ_IRQ_MSGS, MQ_ALLOC_IRQ);
+
+#if CONFIG_MQ_SMALLMSGSIZE > 0
+  /* Initialize a block of small messages for general use */
+
+  list_initialize(&g_msgfreesmall);
+
+  msg = mq_msgblockinit(&g_msgfreesmall, msg, MQ_SMALL_BLOCK_SIZE,
+                         CONFIG_PREALLOC_MQ_SMALL_MSGS, MQ_ALLOC_SMALL);
+#endif
 #endif
 
 #ifndef CONFIG_DISABLE_MQUEUE_SYSV
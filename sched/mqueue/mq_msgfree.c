@@ -89,6 +89,23 @@ void nxmq_free_msg(FAR struct mqueue_msg_s *mqmsg)
       spin_unlock_irqrestore(NULL, flags);
     }
 
+#if CONFIG_MQ_SMALLMSGSIZE > 0
+  /* If this is a message pre-allocated from the small message
+   * pool, then put it back in the small message free list.
+   */
+
+  else if (mqmsg->type == MQ_ALLOC_SMALL)
+    {
+      /* Make sure we avoid concurrent access to the free
+       * list from interrupt handlers.
+       */
+
+      flags = spin_lock_irqsave(NULL);
+      list_add_tail(&g_msgfreesmall, &mqmsg->node);
+      spin_unlock_irqrestore(NULL, flags);
+    }
+#endif
+
   /* Otherwise, deallocate it.  Note:  interrupt handlers
    * will never deallocate messages because they will not
    * received them.
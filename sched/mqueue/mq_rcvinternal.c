@@ -195,6 +195,17 @@ int nxmq_wait_receive(FAR struct mqueue_inode_s *msgq,
         {
           break;
         }
+
+#ifdef CONFIG_MQ_DIRECT_HANDOFF
+      /* The sender may have copied the message directly into our receive
+       * buffer.  In that case there is nothing to remove from the queue.
+       */
+
+      if (rtcb->rcvbuf != NULL && rtcb->rcvbuf->rcvlen >= 0)
+        {
+          break;
+        }
+#endif
     }
 
   if (abstime || ticks >= 0)
@@ -39,6 +39,7 @@
 #include <nuttx/mqueue.h>
 #include <nuttx/cancelpt.h>
 
+#include "sched/sched.h"
 #include "mqueue/mqueue.h"
 
 /****************************************************************************
@@ -142,6 +143,10 @@ ssize_t file_mq_timedreceive_internal(FAR struct file *mq, FAR char *msg,
 {
   FAR struct mqueue_inode_s *msgq;
   FAR struct mqueue_msg_s *mqmsg;
+#ifdef CONFIG_MQ_DIRECT_HANDOFF
+  struct mqueue_rcvbuf_s rcvbuf;
+  FAR struct tcb_s *rtcb;
+#endif
   irqstate_t flags;
   ssize_t ret = 0;
 
@@ -192,12 +197,50 @@ ssize_t file_mq_timedreceive_internal(FAR struct file *mq, FAR char *msg,
 
       /* Wait & get the message from the message queue */
 
+#ifdef CONFIG_MQ_DIRECT_HANDOFF
+      /* Publish our receive buffer so that a sender can copy the message
+       * directly into it rather than staging the message in the queue.
+       */
+
+      rcvbuf.buf      = msg;
+      rcvbuf.buflen   = msglen;
+      rcvbuf.rcvlen   = -1;
+      rcvbuf.priority = 0;
+
+      rtcb            = this_task();
+      rtcb->rcvbuf    = &rcvbuf;
+#endif
+
       ret = nxmq_wait_receive(msgq, &mqmsg, abstime, ticks);
+
+#ifdef CONFIG_MQ_DIRECT_HANDOFF
+      rtcb->rcvbuf = NULL;
+#endif
+
       if (ret < 0)
         {
           leave_critical_section(flags);
           return ret;
         }
+
+#ifdef CONFIG_MQ_DIRECT_HANDOFF
+      if (mqmsg == NULL && rcvbuf.rcvlen >= 0)
+        {
+          /* The message was handed off directly to our buffer.  It was
+           * never added to the queue, so the message count and the
+           * not-full waiters are unaffected.
+           */
+
+          leave_critical_section(flags);
+
+          if (prio)
+            {
+              *prio = rcvbuf.priority;
+            }
+
+          return rcvbuf.rcvlen;
+        }
+#endif
     }
 
   /* If we got message, then decrement the number of messages in
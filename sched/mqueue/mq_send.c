@@ -134,14 +134,32 @@ static int nxmq_verify_send(FAR FAR struct file *mq, FAR const char *msg,
 
 static FAR struct mqueue_msg_s *nxmq_alloc_msg(uint16_t msgsize)
 {
-  FAR struct mqueue_msg_s *mqmsg;
+  FAR struct mqueue_msg_s *mqmsg = NULL;
   irqstate_t flags;
 
-  /* Try to get the message from the generally available free list. */
+#if CONFIG_MQ_SMALLMSGSIZE > 0
+  /* If the message fits in the small size class, then first try the pool
+   * of small messages so that short messages do not consume full-sized
+   * slots.
+   */
+
+  if (msgsize <= CONFIG_MQ_SMALLMSGSIZE)
+    {
+      flags = spin_lock_irqsave(NULL);
+      mqmsg = (FAR struct mqueue_msg_s *)list_remove_head(&g_msgfreesmall);
+      spin_unlock_irqrestore(NULL, flags);
+    }
+
+  if (mqmsg == NULL)
+#endif
+    {
+      /* Try to get the message from the generally available free list. */
+
+      flags = spin_lock_irqsave(NULL);
+      mqmsg = (FAR struct mqueue_msg_s *)list_remove_head(&g_msgfree);
+      spin_unlock_irqrestore(NULL, flags);
+    }
 
-  flags = spin_lock_irqsave(NULL);
-  mqmsg = (FAR struct mqueue_msg_s *)list_remove_head(&g_msgfree);
-  spin_unlock_irqrestore(NULL, flags);
   if (mqmsg == NULL)
     {
       /* If we were called from an interrupt handler, then try to get the
@@ -306,6 +324,23 @@ int file_mq_timedsend_internal(FAR struct file *mq, FAR const char *msg,
 
   msgq = mq->f_inode->i_private;
 
+#ifdef CONFIG_MQ_DIRECT_HANDOFF
+  /* If a receiver is already blocked waiting on an empty queue, then the
+   * message can be copied directly into the receiver's buffer, avoiding
+   * the message structure allocation and the second copy.
+   */
+
+  flags = enter_critical_section();
+  if (msgq->nmsgs == 0 && msgq->cmn.nwaitnotempty > 0 &&
+      nxmq_handoff_send(msgq, msg, msglen, prio) == OK)
+    {
+      leave_critical_section(flags);
+      return OK;
+    }
+
+  leave_critical_section(flags);
+#endif
+
   /* Pre-allocate a message structure */
 
   mqmsg = nxmq_alloc_msg(msglen);
@@ -307,3 +307,90 @@ void nxmq_notify_send(FAR struct mqueue_inode_s *msgq)
         }
     }
 }
+
+#ifdef CONFIG_MQ_DIRECT_HANDOFF
+/****************************************************************************
+ * Name: nxmq_handoff_send
+ *
+ * Description:
+ *   This function attempts to deliver a message directly to the highest
+ *   priority task that is blocked waiting for the message queue to become
+ *   non-empty.  On success, the message has been copied into the
+ *   receiver's buffer and the receiver has been made ready-to-run; the
+ *   message is never staged in a message structure.
+ *
+ * Input Parameters:
+ *   msgq   - Message queue descriptor
+ *   msg    - Message to send
+ *   msglen - The length of the message in bytes
+ *   prio   - The priority of the message
+ *
+ * Returned Value:
+ *   Zero (OK) if the message was handed off.  A negated errno value is
+ *   returned if no direct handoff is possible and the message must be
+ *   queued normally.
+ *
+ * Assumptions/restrictions:
+ * - Executes within a critical section established by the caller.
+ *
+ ****************************************************************************/
+
+int nxmq_handoff_send(FAR struct mqueue_inode_s *msgq,
+                      FAR const char *msg, size_t msglen,
+                      unsigned int prio)
+{
+  FAR struct tcb_s *rtcb = this_task();
+  FAR struct tcb_s *btcb;
+  FAR struct mqueue_rcvbuf_s *rcvbuf;
+
+  /* Find the highest priority task that is waiting for this queue to be
+   * non-empty in the waitfornotempty list.
+   */
+
+  btcb = (FAR struct tcb_s *)dq_peek(MQ_WNELIST(msgq->cmn));
+  DEBUGASSERT(btcb);
+
+  /* The receiver publishes its buffer in its TCB before blocking.  If no
+   * buffer was published (or the buffer is too small to hold this
+   * message), then the message must be queued normally.
+   */
+
+  rcvbuf = btcb->rcvbuf;
+  if (rcvbuf == NULL || rcvbuf->buflen < msglen)
+    {
+      return -EAGAIN;
+    }
+
+  /* Copy the message directly into the receiver's buffer */
+
+  memcpy(rcvbuf->buf, msg, msglen);
+  rcvbuf->rcvlen   = msglen;
+  rcvbuf->priority = prio;
+
+  /* Remove the receiver from the waitfornotempty list and unblock it */
+
+  dq_remfirst(MQ_WNELIST(msgq->cmn));
+
+  if (WDOG_ISACTIVE(&btcb->waitdog))
+    {
+      wd_cancel(&btcb->waitdog);
+    }
+
+  msgq->cmn.nwaitnotempty--;
+
+  /* Indicate that the wait is over. */
+
+  btcb->waitobj = NULL;
+
+  /* Add the task to ready-to-run task list and
+   * perform the context switch if one is needed
+   */
+
+  if (nxsched_add_readytorun(btcb))
+    {
+      up_switch_context(btcb, rtcb);
+    }
+
+  return OK;
+}
+#endif
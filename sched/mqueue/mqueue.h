@@ -59,7 +59,8 @@ enum mqalloc_e
 {
   MQ_ALLOC_FIXED = 0,  /* Pre-allocated; never freed */
   MQ_ALLOC_DYN,        /* Dynamically allocated; free when unused */
-  MQ_ALLOC_IRQ         /* Preallocated, reserved for interrupt handling */
+  MQ_ALLOC_IRQ,        /* Preallocated, reserved for interrupt handling */
+  MQ_ALLOC_SMALL       /* Pre-allocated from the small message pool */
 };
 
 /* This structure describes one buffered POSIX message. */
@@ -77,6 +78,22 @@ struct mqueue_msg_s
   char mail[1];            /* Message data */
 };
 
+#ifdef CONFIG_MQ_DIRECT_HANDOFF
+/* This structure describes the receive buffer published by a task blocked
+ * in [nx]mq_receive.  A pointer to it is held in the TCB of the waiting
+ * task so that a sender can copy the message directly into the receiver's
+ * buffer, bypassing the message structure staging.
+ */
+
+struct mqueue_rcvbuf_s
+{
+  FAR char *buf;           /* The receiver's buffer */
+  size_t buflen;           /* Size of the receiver's buffer */
+  ssize_t rcvlen;          /* Length of the handed-off message, or -1 */
+  unsigned int priority;   /* Priority of the handed-off message */
+};
+#endif
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -101,6 +118,15 @@ EXTERN struct list_node g_msgfree;
 
 EXTERN struct list_node g_msgfreeirq;
 
+/* The g_msgfreesmall is a list of small messages that are available for
+ * general use.  It is only present if a small message size class is
+ * configured.
+ */
+
+#if CONFIG_MQ_SMALLMSGSIZE > 0
+EXTERN struct list_node g_msgfreesmall;
+#endif
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
@@ -134,6 +160,11 @@ int nxmq_wait_send(FAR struct mqueue_inode_s *msgq,
                    FAR const struct timespec *abstime,
                    sclock_t ticks);
 void nxmq_notify_send(FAR struct mqueue_inode_s *msgq);
+#ifdef CONFIG_MQ_DIRECT_HANDOFF
+int nxmq_handoff_send(FAR struct mqueue_inode_s *msgq,
+                      FAR const char *msg, size_t msglen,
+                      unsigned int prio);
+#endif
 
 /* mq_recover.c *************************************************************/
 
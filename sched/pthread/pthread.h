@@ -55,6 +55,8 @@
 #  define mutex_trylock(m)            nxrmutex_trylock(m)
 #  define mutex_breaklock(m,v)        nxrmutex_breaklock(m,v)
 #  define mutex_restorelock(m,v)      nxrmutex_restorelock(m,v)
+#  define mutex_condrestorelock(m,v)  nxrmutex_condrestorelock(m,v)
+#  define mutex_rawlock(m)            (&(m)->mutex)
 #  define mutex_clocklock(m,t)        nxrmutex_clocklock(m,CLOCK_REALTIME,t)
 #  define mutex_set_protocol(m,p)     nxrmutex_set_protocol(m,p)
 #  define mutex_getprioceiling(m,p)   nxrmutex_getprioceiling(m,p)
@@ -72,6 +74,8 @@
 #  define mutex_trylock(m)            nxmutex_trylock(m)
 #  define mutex_breaklock(m,v)        nxmutex_breaklock(m, v)
 #  define mutex_restorelock(m,v)      nxmutex_restorelock(m, v)
+#  define mutex_condrestorelock(m,v)  nxmutex_condrestorelock(m, v)
+#  define mutex_rawlock(m)            (m)
 #  define mutex_clocklock(m,t)        nxmutex_clocklock(m,CLOCK_REALTIME,t)
 #  define mutex_set_protocol(m,p)     nxmutex_set_protocol(m,p)
 #  define mutex_getprioceiling(m,p)   nxmutex_getprioceiling(m,p)
@@ -129,7 +133,7 @@ void pthread_mutex_inconsistent(FAR struct tcb_s *tcb);
 #  define pthread_mutex_trytake(m)          -mutex_trylock(&(m)->mutex)
 #  define pthread_mutex_give(m)             -mutex_unlock(&(m)->mutex)
 #  define pthread_mutex_breaklock(m,v)      -mutex_breaklock(&(m)->mutex,v)
-#  define pthread_mutex_restorelock(m,v)    -mutex_restorelock(&(m)->mutex,v)
+#  define pthread_mutex_restorelock(m,v)    -mutex_condrestorelock(&(m)->mutex,v)
 #endif
 
 #ifdef CONFIG_PTHREAD_MUTEX_TYPES
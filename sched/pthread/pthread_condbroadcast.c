@@ -31,7 +31,10 @@
 #include <errno.h>
 #include <debug.h>
 
+#include <nuttx/mutex.h>
+
 #include "pthread/pthread.h"
+#include "semaphore/semaphore.h"
 
 /****************************************************************************
  * Public Functions
@@ -81,9 +84,7 @@ int pthread_cond_broadcast(FAR pthread_cond_t *cond)
         }
       else
         {
-          /* Loop until all of the waiting threads have been restarted. */
-
-          while (sval < 0)
+          if (sval < 0)
             {
               /* If the value is less than zero (meaning that one or more
                * thread is waiting), then post the condition semaphore.
@@ -98,6 +99,48 @@ int pthread_cond_broadcast(FAR pthread_cond_t *cond)
 
               sval++;
             }
+
+#ifdef CONFIG_LIBC_MUTEX_FASTPATH
+          if (ret == OK && sval < 0 && cond->mutex != NULL)
+            {
+              /* Instead of making the remaining waiters runnable just to
+               * have them pile onto the associated mutex behind the one
+               * thread woken above, transfer them directly to the mutex
+               * wait queue.  They will then be released one at a time as
+               * the mutex is handed down the queue by successive unlocks.
+               */
+
+              FAR mutex_t *lock = mutex_rawlock(&cond->mutex->mutex);
+
+              nxsem_requeue(&cond->sem, &lock->sem, -sval);
+              sval = 0;
+
+              /* Mark the lock word contended so that the next unlock of
+               * the mutex posts the semaphore and starts draining the
+               * queue.  If the exchange finds the mutex unlocked (POSIX
+               * permits broadcasting without holding it), then no unlock
+               * is coming:  mimic one so that the highest priority
+               * requeued waiter is released to claim the mutex.
+               */
+
+              if (atomic_exchange(&lock->fast, NXMUTEX_FAST_CONTENDED) ==
+                  NXMUTEX_FAST_UNLOCKED)
+                {
+                  atomic_exchange(&lock->fast, NXMUTEX_FAST_UNLOCKED);
+                  nxsem_post(&lock->sem);
+                }
+            }
+#endif
+
+          /* Loop until all of the remaining waiting threads have been
+           * restarted.
+           */
+
+          while (sval < 0)
+            {
+              ret = pthread_sem_give(&cond->sem);
+              sval++;
+            }
         }
 
       /* Now we can let the restarted threads run */
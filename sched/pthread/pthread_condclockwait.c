@@ -123,6 +123,14 @@ int pthread_cond_clockwait(FAR pthread_cond_t *cond,
       sched_lock();
       flags = enter_critical_section();
 
+#ifdef CONFIG_LIBC_MUTEX_FASTPATH
+      /* Remember the associated mutex so that pthread_cond_broadcast()
+       * can requeue waiters onto it.
+       */
+
+      cond->mutex = mutex;
+#endif
+
       /* Give up the mutex */
 
       ret = pthread_mutex_breaklock(mutex, &nlocks);
@@ -91,6 +91,15 @@ int pthread_cond_wait(FAR pthread_cond_t *cond, FAR pthread_mutex_t *mutex)
 
       flags = enter_critical_section();
       sched_lock();
+
+#ifdef CONFIG_LIBC_MUTEX_FASTPATH
+      /* Remember the associated mutex so that pthread_cond_broadcast()
+       * can requeue waiters onto it.
+       */
+
+      cond->mutex = mutex;
+#endif
+
       ret = pthread_mutex_breaklock(mutex, &nlocks);
 
       /* Take the semaphore.  This may be awakened only be a signal (EINTR)
@@ -347,7 +347,13 @@ int pthread_mutex_restorelock(FAR struct pthread_mutex_s *mutex,
   DEBUGASSERT(mutex != NULL);
   if (mutex != NULL)
     {
-      ret = -mutex_restorelock(&mutex->mutex, breakval);
+      /* Re-acquire through the contended path:  pthread_cond_broadcast()
+       * may have requeued other condition waiters directly onto the mutex
+       * wait queue, and an uncontended acquisition here would erase the
+       * contended marker in the lock word and leave them stranded.
+       */
+
+      ret = -mutex_condrestorelock(&mutex->mutex, breakval);
       if (ret == OK)
         {
           /* Add the mutex to the list of mutexes held by this task */
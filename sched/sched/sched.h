@@ -198,6 +198,14 @@ extern dq_queue_t g_assignedtasks[CONFIG_SMP_NCPUS];
 
 extern FAR struct tcb_s *g_delivertasks[CONFIG_SMP_NCPUS];
 
+#ifdef CONFIG_SCHED_CPU_IDLEMASK
+/* Bit n is set while CPU n is running its IDLE task.  Maintained at
+ * context-switch time, consumed by nxsched_select_cpu().
+ */
+
+extern volatile cpu_set_t g_cpu_idlemask;
+#endif
+
 /* g_running_tasks[] holds a references to the running task for each cpu.
  * It is valid only when up_interrupt_context() returns true.
  */
@@ -302,7 +310,12 @@ extern volatile clock_t g_cpuload_total;
  * disabled.
  */
 
+#ifdef CONFIG_MCS_SPINLOCK
+extern struct mcs_lock_s g_cpu_irqlock;
+extern struct mcs_node_s g_cpu_irqlock_node[CONFIG_SMP_NCPUS];
+#else
 extern volatile spinlock_t g_cpu_irqlock;
+#endif
 
 /* Used to keep track of which CPU(s) hold the IRQ lock. */
 
@@ -332,6 +345,16 @@ void nxsched_merge_prioritized(FAR dq_queue_t *list1, FAR dq_queue_t *list2,
                                uint8_t task_state);
 bool nxsched_merge_pending(void);
 void nxsched_add_blocked(FAR struct tcb_s *btcb, tstate_t task_state);
+#ifdef CONFIG_SCHED_PRIO_BITMAP
+bool nxsched_prioq_add(FAR struct tcb_s *tcb);
+void nxsched_prioq_remove(FAR struct tcb_s *tcb);
+void nxsched_prioq_register(FAR struct tcb_s *tcb);
+#endif
+#ifdef CONFIG_SCHED_CPU_MAILBOX
+bool nxsched_mailbox_post(int cpu, FAR struct tcb_s *btcb);
+FAR struct tcb_s *nxsched_mailbox_drain(int cpu);
+bool nxsched_mailbox_discard(FAR struct tcb_s *tcb);
+#endif
 void nxsched_remove_blocked(FAR struct tcb_s *btcb);
 int  nxsched_set_priority(FAR struct tcb_s *tcb, int sched_priority);
 bool nxsched_reprioritize_rtr(FAR struct tcb_s *tcb, int priority);
@@ -417,6 +440,18 @@ void nxsched_process_cpuload_ticks(clock_t ticks);
 #define nxsched_process_cpuload() nxsched_process_cpuload_ticks(1)
 #endif
 
+/* Periodic stack usage monitor */
+
+#ifdef CONFIG_SCHED_STACKMONITOR
+void nxsched_stackmonitor_start(void);
+#endif
+
+/* Sampling CPU profiler */
+
+#ifdef CONFIG_SCHED_CPUPROFILER
+void nxsched_profile_sample(void);
+#endif
+
 /* Critical section monitor */
 
 #ifdef CONFIG_SCHED_CRITMONITOR
@@ -438,6 +473,19 @@ void nxsched_critmon_csection(FAR struct tcb_s *tcb, bool state,
 
 bool nxsched_verify_tcb(FAR struct tcb_s *tcb);
 
+/* Stack allocation, optionally through the per-CPU stack cache */
+
+#ifdef CONFIG_SCHED_STACK_CACHE
+int  nxsched_stack_alloc(FAR struct tcb_s *tcb, size_t stack_size,
+                         uint8_t ttype);
+void nxsched_stack_free(FAR struct tcb_s *tcb, uint8_t ttype);
+#else
+#  define nxsched_stack_alloc(tcb, stack_size, ttype) \
+          up_create_stack(tcb, stack_size, ttype)
+#  define nxsched_stack_free(tcb, ttype) \
+          up_release_stack(tcb, ttype)
+#endif
+
 /* Obtain TLS from kernel */
 
 struct tls_info_s; /* Forward declare */
@@ -75,6 +75,36 @@ bool nxsched_add_prioritized(FAR struct tcb_s *tcb, DSEG dq_queue_t *list)
 
   DEBUGASSERT(sched_priority >= SCHED_PRIORITY_MIN);
 
+#ifdef CONFIG_SCHED_PRIO_BITMAP
+  /* Insertions into the ready-to-run list are indexed by the priority
+   * bitmap and complete in constant time.
+   */
+
+  if (list == list_readytorun())
+    {
+      return nxsched_prioq_add(tcb);
+    }
+#endif
+
+  /* Check the tail of the list first.  Wait queues (e.g. a contended
+   * semaphore's waitlist) are commonly filled by threads of equal or
+   * descending priority, in which case every insertion lands at the end
+   * of the list.  Handling that case here keeps the enqueue cost flat no
+   * matter how many waiters are already queued.
+   */
+
+  prev = (FAR struct tcb_s *)list->tail;
+  if (prev != NULL && sched_priority <= prev->sched_priority)
+    {
+      /* The tcb goes at the end of the non-empty list */
+
+      tcb->flink  = NULL;
+      tcb->blink  = prev;
+      prev->flink = tcb;
+      list->tail  = (FAR dq_entry_t *)tcb;
+      return false;
+    }
+
   /* Search the list to find the location to insert the new Tcb.
    * Each is list is maintained in descending sched_priority order.
    */
@@ -228,6 +228,18 @@ bool nxsched_add_readytorun(FAR struct tcb_s *btcb)
       me = this_cpu();
       if (cpu != me)
         {
+#ifdef CONFIG_SCHED_CPU_MAILBOX
+          /* Post the task to the target CPU's wakeup mailbox.  Any number
+           * of deliveries may be outstanding; only the first needs an IPI.
+           */
+
+          btcb->cpu = cpu;
+          btcb->task_state = TSTATE_TASK_ASSIGNED;
+          if (nxsched_mailbox_post(cpu, btcb))
+            {
+              up_send_smp_sched(cpu);
+            }
+#else
           if (g_delivertasks[cpu] == NULL)
             {
               g_delivertasks[cpu] = btcb;
@@ -252,6 +264,7 @@ bool nxsched_add_readytorun(FAR struct tcb_s *btcb)
                   btcb->task_state = TSTATE_TASK_READYTORUN;
                 }
             }
+#endif /* CONFIG_SCHED_CPU_MAILBOX */
 
           return false;
         }
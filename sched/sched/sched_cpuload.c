@@ -80,6 +80,71 @@
 
 volatile clock_t g_cpuload_total;
 
+#ifdef CONFIG_SCHED_CPULOAD_LAZY
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* Ticks accumulated by each CPU since the last reader merged them into
+ * g_cpuload_total.  The sampling hot path touches only its own entry so
+ * that load accounting never scans g_pidhash from the timer interrupt.
+ */
+
+static volatile clock_t g_cpuload_pending[CONFIG_SMP_NCPUS];
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxsched_cpuload_merge
+ *
+ * Description:
+ *   Fold the per-CPU pending tick counts into g_cpuload_total and, if the
+ *   total has exceeded the time constant, scale back the per-task counts.
+ *   This is the deferred half of the lazy accounting:  it runs in the
+ *   context of the reader (e.g., a /proc/<pid>/loadavg consumer) rather
+ *   than in the timer interrupt.
+ *
+ * Assumptions:
+ *   The caller has established a critical section.
+ *
+ ****************************************************************************/
+
+static void nxsched_cpuload_merge(void)
+{
+  clock_t total = g_cpuload_total;
+  int i;
+
+  for (i = 0; i < CONFIG_SMP_NCPUS; i++)
+    {
+      total += g_cpuload_pending[i];
+      g_cpuload_pending[i] = 0;
+    }
+
+  if (total > CPULOAD_TIMECONSTANT)
+    {
+      /* Divide the tick count for every task by two and recalculate the
+       * total.
+       */
+
+      total = 0;
+      for (i = 0; i < g_npidhash; i++)
+        {
+          if (g_pidhash[i])
+            {
+              g_pidhash[i]->ticks >>= 1;
+              total += g_pidhash[i]->ticks;
+            }
+        }
+    }
+
+  /* Save the new total. */
+
+  g_cpuload_total = total;
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -102,6 +167,15 @@ volatile clock_t g_cpuload_total;
 void nxsched_process_taskload_ticks(FAR struct tcb_s *tcb, clock_t ticks)
 {
   tcb->ticks += ticks;
+
+#ifdef CONFIG_SCHED_CPULOAD_LAZY
+  /* Accumulate into this CPU's buffer only.  The pending counts are merged
+   * into g_cpuload_total, and the per-task counts decayed, when the load
+   * data is next read by clock_cpuload().
+   */
+
+  g_cpuload_pending[this_cpu()] += ticks;
+#else
   g_cpuload_total += ticks;
 
   if (g_cpuload_total > CPULOAD_TIMECONSTANT)
@@ -126,6 +200,7 @@ void nxsched_process_taskload_ticks(FAR struct tcb_s *tcb, clock_t ticks)
 
       g_cpuload_total = total;
     }
+#endif
 }
 
 /****************************************************************************
@@ -196,6 +271,15 @@ int clock_cpuload(int pid, FAR struct cpuload_s *cpuload)
    */
 
   flags = enter_critical_section();
+
+#ifdef CONFIG_SCHED_CPULOAD_LAZY
+  /* Bring g_cpuload_total and the per-task counts up to date before they
+   * are sampled.
+   */
+
+  nxsched_cpuload_merge();
+#endif
+
   hash_index = PIDHASH(pid);
 
   /* Make sure that the entry is valid (TCB field is not NULL) and matches
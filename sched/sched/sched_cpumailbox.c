@@ -0,0 +1,157 @@
+/****************************************************************************
+ * sched/sched/sched_cpumailbox.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <assert.h>
+
+#include <nuttx/atomic.h>
+
+#include "sched/sched.h"
+
+#ifdef CONFIG_SCHED_CPU_MAILBOX
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* One MPSC wakeup mailbox per CPU.  Each mailbox is an intrusive LIFO
+ * stack of TCBs chained through tcb->flink:  A TCB in a mailbox is, by
+ * definition, in no task list so the link field is available.  Producers
+ * push with a CAS loop; the owning CPU drains the whole chain with a
+ * single atomic exchange from interrupt level.
+ */
+
+static atomic_uintptr_t g_cpu_mailbox[CONFIG_SMP_NCPUS];
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxsched_mailbox_post
+ *
+ * Description:
+ *   Queue a ready-to-run TCB for delivery to another CPU.  The TCB will be
+ *   merged into the target CPU's assigned task list when that CPU next
+ *   processes its mailbox (see nxsched_process_delivered()).
+ *
+ * Input Parameters:
+ *   cpu  - The CPU that should run the task
+ *   btcb - The TCB to deliver; must not be in any task list
+ *
+ * Returned Value:
+ *   true if the mailbox was empty so that the caller must IPI the target
+ *   CPU; false if an IPI is already pending.
+ *
+ ****************************************************************************/
+
+bool nxsched_mailbox_post(int cpu, FAR struct tcb_s *btcb)
+{
+  uintptr_t head = atomic_load(&g_cpu_mailbox[cpu]);
+
+  do
+    {
+      btcb->flink = (FAR struct tcb_s *)head;
+    }
+  while (!atomic_compare_exchange_weak(&g_cpu_mailbox[cpu], &head,
+                                       (uintptr_t)btcb));
+
+  return head == 0;
+}
+
+/****************************************************************************
+ * Name: nxsched_mailbox_drain
+ *
+ * Description:
+ *   Atomically claim the entire chain of TCBs posted to this CPU's
+ *   mailbox.  Called from interrupt level on the owning CPU only.
+ *
+ * Returned Value:
+ *   The head of the claimed chain (linked through tcb->flink), or NULL.
+ *
+ ****************************************************************************/
+
+FAR struct tcb_s *nxsched_mailbox_drain(int cpu)
+{
+  return (FAR struct tcb_s *)atomic_exchange(&g_cpu_mailbox[cpu],
+                                             (uintptr_t)0);
+}
+
+/****************************************************************************
+ * Name: nxsched_mailbox_discard
+ *
+ * Description:
+ *   Remove a TCB from whatever CPU mailbox it may be queued in.  This is
+ *   needed when a task is deleted after it was posted for delivery but
+ *   before the target CPU drained its mailbox.
+ *
+ * Returned Value:
+ *   true if the TCB was found (and unlinked) in a mailbox.
+ *
+ * Assumptions:
+ * - The caller holds the critical section so that no new TCBs are being
+ *   posted and no CPU is draining concurrently.
+ *
+ ****************************************************************************/
+
+bool nxsched_mailbox_discard(FAR struct tcb_s *tcb)
+{
+  FAR struct tcb_s *curr;
+  FAR struct tcb_s *prev;
+  uintptr_t head;
+  int cpu;
+
+  for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++)
+    {
+      head = atomic_load(&g_cpu_mailbox[cpu]);
+      for (prev = NULL, curr = (FAR struct tcb_s *)head;
+           curr != NULL;
+           prev = curr, curr = curr->flink)
+        {
+          if (curr == tcb)
+            {
+              if (prev == NULL)
+                {
+                  atomic_store(&g_cpu_mailbox[cpu],
+                               (uintptr_t)tcb->flink);
+                }
+              else
+                {
+                  prev->flink = tcb->flink;
+                }
+
+              return true;
+            }
+        }
+    }
+
+  return false;
+}
+
+#endif /* CONFIG_SCHED_CPU_MAILBOX */
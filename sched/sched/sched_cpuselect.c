@@ -28,6 +28,7 @@
 
 #include <sys/types.h>
 #include <assert.h>
+#include <strings.h>
 
 #include <nuttx/sched.h>
 
@@ -41,6 +42,21 @@
 
 #define IMPOSSIBLE_CPU 0xff
 
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+#ifdef CONFIG_SCHED_CPU_IDLEMASK
+/* One bit per CPU:  The bit is set while the CPU is running its IDLE task.
+ * The mask is maintained at context-switch time by
+ * nxsched_resume_scheduler() and read here to place awakened tasks onto an
+ * idle CPU with a single find-first-set instead of scanning every CPU's
+ * head TCB.  At boot all CPUs are idle.
+ */
+
+volatile cpu_set_t g_cpu_idlemask = (1 << CONFIG_SMP_NCPUS) - 1;
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -69,6 +85,22 @@ int nxsched_select_cpu(cpu_set_t affinity)
   int cpu;
   int i;
 
+#ifdef CONFIG_SCHED_CPU_IDLEMASK
+  cpu_set_t idle;
+
+  /* Fast path:  If any permitted CPU is idle, take the first one.  The
+   * mask may briefly lag the true CPU state around context switches; a
+   * stale hit only leads to a sub-optimal placement, never to an invalid
+   * one, since the caller re-evaluates priorities when assigning.
+   */
+
+  idle = g_cpu_idlemask & affinity;
+  if (idle != 0)
+    {
+      return ffs(idle) - 1;
+    }
+#endif
+
   minprio = SCHED_PRIORITY_MAX;
   cpu     = IMPOSSIBLE_CPU;
 
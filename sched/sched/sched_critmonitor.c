@@ -30,6 +30,7 @@
 #include <sched.h>
 #include <assert.h>
 #include <debug.h>
+#include <string.h>
 #include <time.h>
 
 #include "sched/sched.h"
@@ -90,14 +91,28 @@
  * Public Data
  ****************************************************************************/
 
-/* Maximum time with pre-emption disabled or within critical section. */
+/* Maximum time with pre-emption disabled or within critical section and
+ * the identity of the holder that set each maximum.
+ */
 
 #if CONFIG_SCHED_CRITMONITOR_MAXTIME_PREEMPTION >= 0
 clock_t g_premp_max[CONFIG_SMP_NCPUS];
+FAR void *g_premp_max_caller[CONFIG_SMP_NCPUS];
+pid_t g_premp_max_pid[CONFIG_SMP_NCPUS];
+#if CONFIG_SCHED_CRITMONITOR_BACKTRACE > 0
+FAR void *g_premp_max_backtrace[CONFIG_SMP_NCPUS]
+                               [CONFIG_SCHED_CRITMONITOR_BACKTRACE];
+#endif
 #endif
 
 #if CONFIG_SCHED_CRITMONITOR_MAXTIME_CSECTION >= 0
 clock_t g_crit_max[CONFIG_SMP_NCPUS];
+FAR void *g_crit_max_caller[CONFIG_SMP_NCPUS];
+pid_t g_crit_max_pid[CONFIG_SMP_NCPUS];
+#if CONFIG_SCHED_CRITMONITOR_BACKTRACE > 0
+FAR void *g_crit_max_backtrace[CONFIG_SMP_NCPUS]
+                              [CONFIG_SCHED_CRITMONITOR_BACKTRACE];
+#endif
 #endif
 
 /****************************************************************************
@@ -199,11 +214,20 @@ void nxsched_critmon_preemption(FAR struct tcb_s *tcb, bool state,
           CHECK_PREEMPTION(tcb->pid, elapsed);
         }
 
-      /* Check for the global max elapsed time */
+      /* Check for the global max elapsed time, remembering who held it */
 
       if (elapsed > g_premp_max[cpu])
         {
-          g_premp_max[cpu] = elapsed;
+          g_premp_max[cpu]        = elapsed;
+          g_premp_max_caller[cpu] = tcb->premp_caller;
+          g_premp_max_pid[cpu]    = tcb->pid;
+
+#if CONFIG_SCHED_CRITMONITOR_BACKTRACE > 0
+          memset(g_premp_max_backtrace[cpu], 0,
+                 sizeof(g_premp_max_backtrace[cpu]));
+          sched_backtrace(tcb->pid, g_premp_max_backtrace[cpu],
+                          CONFIG_SCHED_CRITMONITOR_BACKTRACE, 2);
+#endif
         }
     }
 }
@@ -251,11 +275,20 @@ void nxsched_critmon_csection(FAR struct tcb_s *tcb, bool state,
           CHECK_CSECTION(tcb->pid, elapsed);
         }
 
-      /* Check for the global max elapsed time */
+      /* Check for the global max elapsed time, remembering who held it */
 
       if (elapsed > g_crit_max[cpu])
         {
-          g_crit_max[cpu] = elapsed;
+          g_crit_max[cpu]        = elapsed;
+          g_crit_max_caller[cpu] = tcb->crit_caller;
+          g_crit_max_pid[cpu]    = tcb->pid;
+
+#if CONFIG_SCHED_CRITMONITOR_BACKTRACE > 0
+          memset(g_crit_max_backtrace[cpu], 0,
+                 sizeof(g_crit_max_backtrace[cpu]));
+          sched_backtrace(tcb->pid, g_crit_max_backtrace[cpu],
+                          CONFIG_SCHED_CRITMONITOR_BACKTRACE, 2);
+#endif
         }
     }
 }
@@ -0,0 +1,348 @@
+/****************************************************************************
+ * sched/sched/sched_lockmonitor.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <nuttx/clock.h>
+#include <nuttx/fs/procfs.h>
+#include <nuttx/kmalloc.h>
+#include <nuttx/spinlock.h>
+
+#include "sched/sched.h"
+
+#ifdef CONFIG_SCHED_LOCKMONITOR
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define LOCKMON_NSITES  CONFIG_SCHED_LOCKMONITOR_NSITES
+
+/* Large enough for the longest line generated below */
+
+#define LOCKMON_LINELEN 80
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* Counters for one lock caller site */
+
+struct lockmon_site_s
+{
+  FAR void *caller;              /* Return address of the locking call */
+  uint32_t  nacquire;            /* Total acquisitions */
+  uint32_t  ncontend;            /* Acquisitions that had to wait */
+  uint64_t  waitticks;           /* Accumulated wait in perf ticks */
+};
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS)
+/* This structure describes one open "file" */
+
+struct lockmon_file_s
+{
+  struct procfs_file_s base;     /* Base open file structure */
+  char line[LOCKMON_LINELEN];    /* Pre-allocated buffer for formatted lines */
+};
+#endif
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS)
+static int     lockmon_open(FAR struct file *filep, FAR const char *relpath,
+                            int oflags, mode_t mode);
+static int     lockmon_close(FAR struct file *filep);
+static ssize_t lockmon_read(FAR struct file *filep, FAR char *buffer,
+                            size_t buflen);
+static ssize_t lockmon_write(FAR struct file *filep,
+                             FAR const char *buffer, size_t buflen);
+static int     lockmon_dup(FAR const struct file *oldp,
+                           FAR struct file *newp);
+static int     lockmon_stat(FAR const char *relpath, FAR struct stat *buf);
+#endif
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS)
+/* See fs_procfs.c -- this structure is explicitly externed there. */
+
+const struct procfs_operations g_lockmon_operations =
+{
+  lockmon_open,       /* open */
+  lockmon_close,      /* close */
+  lockmon_read,       /* read */
+  lockmon_write,      /* write */
+  NULL,               /* poll */
+
+  lockmon_dup,        /* dup */
+
+  NULL,               /* opendir */
+  NULL,               /* closedir */
+  NULL,               /* readdir */
+  NULL,               /* rewinddir */
+
+  lockmon_stat        /* stat */
+};
+#endif
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* Open-addressed hash table of caller sites, indexed by caller address */
+
+static struct lockmon_site_s g_lockmon_sites[LOCKMON_NSITES];
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS)
+
+/****************************************************************************
+ * Name: lockmon_open
+ ****************************************************************************/
+
+static int lockmon_open(FAR struct file *filep, FAR const char *relpath,
+                        int oflags, mode_t mode)
+{
+  FAR struct lockmon_file_s *priv;
+
+  finfo("Open '%s'\n", relpath);
+
+  /* Allocate the open file structure */
+
+  priv = kmm_zalloc(sizeof(struct lockmon_file_s));
+  if (priv == NULL)
+    {
+      ferr("ERROR: Failed to allocate file attributes\n");
+      return -ENOMEM;
+    }
+
+  filep->f_priv = priv;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: lockmon_close
+ ****************************************************************************/
+
+static int lockmon_close(FAR struct file *filep)
+{
+  kmm_free(filep->f_priv);
+  filep->f_priv = NULL;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: lockmon_read
+ *
+ * Description:
+ *   Emit one "caller,acquisitions,contentions,waitticks" line per active
+ *   caller site.
+ *
+ ****************************************************************************/
+
+static ssize_t lockmon_read(FAR struct file *filep, FAR char *buffer,
+                            size_t buflen)
+{
+  FAR struct lockmon_file_s *priv = filep->f_priv;
+  size_t linesize;
+  size_t copysize;
+  size_t totalsize = 0;
+  off_t  offset    = filep->f_pos;
+  int    i;
+
+  for (i = 0; i < LOCKMON_NSITES && buflen > 0; i++)
+    {
+      FAR struct lockmon_site_s *site = &g_lockmon_sites[i];
+
+      if (site->caller == NULL)
+        {
+          continue;
+        }
+
+      linesize = snprintf(priv->line, LOCKMON_LINELEN,
+                          "%p,%" PRIu32 ",%" PRIu32 ",%" PRIu64 "\n",
+                          site->caller, site->nacquire, site->ncontend,
+                          site->waitticks);
+      copysize = procfs_memcpy(priv->line, linesize, buffer, buflen,
+                               &offset);
+
+      totalsize += copysize;
+      buffer    += copysize;
+      buflen    -= copysize;
+    }
+
+  filep->f_pos += totalsize;
+  return totalsize;
+}
+
+/****************************************************************************
+ * Name: lockmon_write
+ *
+ * Description:
+ *   Writing anything to the file resets all counters.
+ *
+ ****************************************************************************/
+
+static ssize_t lockmon_write(FAR struct file *filep,
+                             FAR const char *buffer, size_t buflen)
+{
+  memset(g_lockmon_sites, 0, sizeof(g_lockmon_sites));
+  return buflen;
+}
+
+/****************************************************************************
+ * Name: lockmon_dup
+ ****************************************************************************/
+
+static int lockmon_dup(FAR const struct file *oldp, FAR struct file *newp)
+{
+  FAR struct lockmon_file_s *newpriv;
+
+  /* Allocate a new container to hold the task and attribute selection */
+
+  newpriv = kmm_zalloc(sizeof(struct lockmon_file_s));
+  if (newpriv == NULL)
+    {
+      ferr("ERROR: Failed to allocate file attributes\n");
+      return -ENOMEM;
+    }
+
+  /* The copy the file attributes from the old attributes to the new */
+
+  memcpy(newpriv, oldp->f_priv, sizeof(struct lockmon_file_s));
+
+  /* Save the new attributes in the new file structure */
+
+  newp->f_priv = newpriv;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: lockmon_stat
+ ****************************************************************************/
+
+static int lockmon_stat(FAR const char *relpath, FAR struct stat *buf)
+{
+  /* "lockmon" is the only acceptable value for the relpath */
+
+  if (strcmp(relpath, "lockmon") != 0)
+    {
+      ferr("ERROR: relpath is '%s'\n", relpath);
+      return -ENOENT;
+    }
+
+  memset(buf, 0, sizeof(struct stat));
+  buf->st_mode = S_IFREG | S_IWOTH | S_IWGRP | S_IWUSR |
+                 S_IROTH | S_IRGRP | S_IRUSR;
+  return OK;
+}
+
+#endif /* !CONFIG_DISABLE_MOUNTPOINT && CONFIG_FS_PROCFS */
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxsched_lockmon_record
+ *
+ * Description:
+ *   Account for one lock acquisition at the given caller site.  This
+ *   runs on the locking hot paths, possibly from interrupt handlers and
+ *   with spinlocks held, so it uses no locks itself:  Two CPUs may race
+ *   to claim the same empty slot, in which case the loser's sample lands
+ *   on the winner's site.  That is tolerable for profiling.
+ *
+ * Input Parameters:
+ *   caller    - Return address identifying the locking call site
+ *   contended - True if the acquisition had to wait
+ *   waitticks - Time spent waiting, in perf ticks (zero if uncontended)
+ *
+ ****************************************************************************/
+
+void nxsched_lockmon_record(FAR void *caller, bool contended,
+                            clock_t waitticks)
+{
+  unsigned int i;
+  unsigned int n;
+
+  if (caller == NULL)
+    {
+      /* return_address() is a stub on this architecture */
+
+      return;
+    }
+
+  i = (unsigned int)((uintptr_t)caller >> 2) % LOCKMON_NSITES;
+
+  for (n = 0; n < LOCKMON_NSITES; n++)
+    {
+      FAR struct lockmon_site_s *site = &g_lockmon_sites[i];
+
+      if (site->caller == NULL)
+        {
+          site->caller = caller;
+        }
+
+      if (site->caller == caller)
+        {
+          site->nacquire++;
+          if (contended)
+            {
+              site->ncontend++;
+              site->waitticks += waitticks;
+            }
+
+          return;
+        }
+
+      if (++i >= LOCKMON_NSITES)
+        {
+          i = 0;
+        }
+    }
+
+  /* The table is full:  Drop the sample */
+}
+
+#endif /* CONFIG_SCHED_LOCKMONITOR */
@@ -0,0 +1,259 @@
+/****************************************************************************
+ * sched/sched/sched_prioqueue.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <strings.h>
+#include <assert.h>
+
+#include <nuttx/queue.h>
+
+#include "sched/sched.h"
+
+#ifdef CONFIG_SCHED_PRIO_BITMAP
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* The bitmap covers every possible sched_priority value (0-255).  Each
+ * 32-bit word maps 32 priority levels.
+ */
+
+#define PRIOQ_NLEVELS  (SCHED_PRIORITY_MAX + 1)
+#define PRIOQ_NWORDS   (PRIOQ_NLEVELS >> 5)
+#define PRIOQ_WORD(p)  ((p) >> 5)
+#define PRIOQ_BIT(p)   ((uint32_t)1 << ((p) & 31))
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* One bit per priority level:  The bit is set if and only if at least one
+ * TCB with that priority resides in the ready-to-run list.
+ */
+
+static uint32_t g_prioq_bitmap[PRIOQ_NWORDS];
+
+/* The last (FIFO-order) TCB at each priority level in the ready-to-run
+ * list, or NULL if there is none at that level.
+ */
+
+static FAR struct tcb_s *g_prioq_tail[PRIOQ_NLEVELS];
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxsched_prioq_ceiling
+ *
+ * Description:
+ *   Find the lowest occupied priority level that is greater than or equal
+ *   to the provided priority.  This identifies the TCB after which a new
+ *   TCB of priority sched_priority must be inserted in order to keep the
+ *   ready-to-run list in descending priority/FIFO order.
+ *
+ * Returned Value:
+ *   The occupied priority level, or -1 if no level at or above
+ *   sched_priority is occupied (i.e., the new TCB becomes the list head).
+ *
+ ****************************************************************************/
+
+static int nxsched_prioq_ceiling(uint8_t sched_priority)
+{
+  uint32_t word;
+  int ndx;
+
+  /* Mask off the levels below sched_priority in the first word, then scan
+   * upward.  This is a bounded scan of at most PRIOQ_NWORDS words.
+   */
+
+  word = g_prioq_bitmap[PRIOQ_WORD(sched_priority)] &
+         ~(PRIOQ_BIT(sched_priority) - 1);
+
+  for (ndx = PRIOQ_WORD(sched_priority); ; word = g_prioq_bitmap[ndx])
+    {
+      if (word != 0)
+        {
+          return (ndx << 5) + ffs(word) - 1;
+        }
+
+      if (++ndx >= PRIOQ_NWORDS)
+        {
+          return -1;
+        }
+    }
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxsched_prioq_add
+ *
+ * Description:
+ *   Add a TCB to the ready-to-run list in O(1) time using the priority
+ *   bitmap index.  This is the CONFIG_SCHED_PRIO_BITMAP replacement for
+ *   the linear search performed by nxsched_add_prioritized() when the
+ *   target list is g_readytorun.
+ *
+ * Input Parameters:
+ *   tcb - Points to the TCB to add to the ready-to-run list
+ *
+ * Returned Value:
+ *   true if the head of the ready-to-run list has changed.
+ *
+ * Assumptions:
+ * - The caller has established a critical section.
+ * - The caller has already removed the input tcb from whatever list it
+ *   was in.
+ *
+ ****************************************************************************/
+
+bool nxsched_prioq_add(FAR struct tcb_s *tcb)
+{
+  FAR dq_queue_t *list = list_readytorun();
+  FAR struct tcb_s *prev;
+  FAR struct tcb_s *next;
+  uint8_t sched_priority = tcb->sched_priority;
+  int ceiling;
+  bool ret = false;
+
+  ceiling = nxsched_prioq_ceiling(sched_priority);
+  if (ceiling < 0)
+    {
+      /* No ready task has priority >= sched_priority:  The new TCB goes at
+       * the head of the list.
+       */
+
+      next        = (FAR struct tcb_s *)list->head;
+      tcb->flink  = next;
+      tcb->blink  = NULL;
+      list->head  = (FAR dq_entry_t *)tcb;
+
+      if (next != NULL)
+        {
+          next->blink = tcb;
+        }
+      else
+        {
+          list->tail = (FAR dq_entry_t *)tcb;
+        }
+
+      ret = true;
+    }
+  else
+    {
+      /* Insert just after the last TCB at the ceiling priority level */
+
+      prev = g_prioq_tail[ceiling];
+      DEBUGASSERT(prev != NULL);
+
+      next       = prev->flink;
+      tcb->flink = next;
+      tcb->blink = prev;
+      prev->flink = tcb;
+
+      if (next != NULL)
+        {
+          next->blink = tcb;
+        }
+      else
+        {
+          list->tail = (FAR dq_entry_t *)tcb;
+        }
+    }
+
+  /* The new TCB is now the FIFO tail of its own priority level */
+
+  g_prioq_tail[sched_priority]           = tcb;
+  g_prioq_bitmap[PRIOQ_WORD(sched_priority)] |= PRIOQ_BIT(sched_priority);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: nxsched_prioq_remove
+ *
+ * Description:
+ *   Update the priority bitmap index before a TCB is removed from the
+ *   ready-to-run list.  The caller performs the actual dq_rem().
+ *
+ * Assumptions:
+ * - The caller has established a critical section.
+ * - tcb->sched_priority still holds the priority the TCB had when it was
+ *   added to the ready-to-run list.
+ *
+ ****************************************************************************/
+
+void nxsched_prioq_remove(FAR struct tcb_s *tcb)
+{
+  uint8_t sched_priority = tcb->sched_priority;
+
+  if (g_prioq_tail[sched_priority] == tcb)
+    {
+      FAR struct tcb_s *prev = tcb->blink;
+
+      if (prev != NULL && prev->sched_priority == sched_priority)
+        {
+          /* Another TCB at this level precedes the one being removed */
+
+          g_prioq_tail[sched_priority] = prev;
+        }
+      else
+        {
+          /* This was the only TCB at this priority level */
+
+          g_prioq_tail[sched_priority] = NULL;
+          g_prioq_bitmap[PRIOQ_WORD(sched_priority)] &=
+            ~PRIOQ_BIT(sched_priority);
+        }
+    }
+}
+
+/****************************************************************************
+ * Name: nxsched_prioq_register
+ *
+ * Description:
+ *   Account for a TCB that was linked into the ready-to-run list directly,
+ *   bypassing nxsched_prioq_add().  This is used only during start-up when
+ *   the IDLE task is added to the empty ready-to-run list.
+ *
+ ****************************************************************************/
+
+void nxsched_prioq_register(FAR struct tcb_s *tcb)
+{
+  uint8_t sched_priority = tcb->sched_priority;
+
+  DEBUGASSERT(g_prioq_tail[sched_priority] == NULL);
+  g_prioq_tail[sched_priority]           = tcb;
+  g_prioq_bitmap[PRIOQ_WORD(sched_priority)] |= PRIOQ_BIT(sched_priority);
+}
+
+#endif /* CONFIG_SCHED_PRIO_BITMAP */
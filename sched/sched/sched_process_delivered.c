@@ -73,13 +73,69 @@ void nxsched_process_delivered(int cpu)
 
   if ((g_cpu_irqset & (1 << cpu)) == 0)
     {
-      spin_lock_wo_note(&g_cpu_irqlock);
+      cpu_irqlock_acquire_wo_note();
 
       g_cpu_irqset |= (1 << cpu);
     }
 
   tcb = current_task(cpu);
 
+#ifdef CONFIG_SCHED_CPU_MAILBOX
+  /* Claim everything posted to this CPU's mailbox and merge each TCB into
+   * the assigned task list in priority order.
+   */
+
+  btcb = nxsched_mailbox_drain(cpu);
+  while (btcb != NULL)
+    {
+      FAR struct tcb_s *bnext = btcb->flink;
+
+      if (nxsched_islocked_tcb(tcb))
+        {
+          nxsched_add_prioritized(btcb, &g_pendingtasks);
+          btcb->task_state = TSTATE_TASK_PENDING;
+        }
+      else
+        {
+          for (next = tcb; btcb->sched_priority <= next->sched_priority;
+               next = next->flink);
+
+          DEBUGASSERT(next);
+
+          prev = next->blink;
+          if (prev == NULL)
+            {
+              /* Special case:  Insert at the head of the list */
+
+              tasklist = &g_assignedtasks[cpu];
+              dq_addfirst_nonempty((FAR dq_entry_t *)btcb, tasklist);
+              btcb->cpu = cpu;
+              btcb->task_state = TSTATE_TASK_RUNNING;
+              next->task_state = TSTATE_TASK_ASSIGNED;
+
+              /* The delivered task is the new current task */
+
+              tcb = btcb;
+            }
+          else
+            {
+              /* Insert in the middle of the list */
+
+              dq_insert_mid(prev, btcb, next);
+              btcb->cpu = cpu;
+              btcb->task_state = TSTATE_TASK_ASSIGNED;
+            }
+        }
+
+      btcb = bnext;
+    }
+
+  if (tcb->irqcount <= 0)
+    {
+      cpu_irqlock_clear();
+    }
+
+#else
   if (g_delivertasks[cpu] == NULL)
     {
       if (tcb->irqcount <= 0)
@@ -141,4 +197,5 @@ void nxsched_process_delivered(int cpu)
     {
       cpu_irqlock_clear();
     }
+#endif /* CONFIG_SCHED_CPU_MAILBOX */
 }
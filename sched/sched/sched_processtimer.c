@@ -190,6 +190,12 @@ void nxsched_process_timer(void)
   nxsched_process_cpuload();
 #endif
 
+#ifdef CONFIG_SCHED_CPUPROFILER
+  /* Take a call-chain sample of the interrupted task */
+
+  nxsched_profile_sample();
+#endif
+
   /* Check if the currently executing task has exceeded its
    * timeslice.
    */
@@ -0,0 +1,391 @@
+/****************************************************************************
+ * sched/sched/sched_profiler.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <nuttx/arch.h>
+#include <nuttx/fs/procfs.h>
+#include <nuttx/kmalloc.h>
+#include <nuttx/sched.h>
+
+#include "sched/sched.h"
+
+#ifdef CONFIG_SCHED_CPUPROFILER
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define PROFILER_DEPTH   CONFIG_SCHED_CPUPROFILER_DEPTH
+#define PROFILER_NSTACKS CONFIG_SCHED_CPUPROFILER_NSTACKS
+
+/* Frames to drop so that samples start at the interrupted code, not at
+ * the profiler or the timer interrupt dispatch.
+ */
+
+#define PROFILER_SKIP    2
+
+/* Large enough for the longest line generated below:  The hit count plus
+ * one "0x..." address and a separator per captured frame.
+ */
+
+#define PROFILER_LINELEN (16 + PROFILER_DEPTH * (2 * sizeof(uintptr_t) + 3))
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* One unique call chain and its hit counter */
+
+struct profstack_s
+{
+  uint32_t  hits;                     /* Samples with this call chain */
+  uint8_t   depth;                    /* Number of valid entries */
+  FAR void *stack[PROFILER_DEPTH];    /* The captured return addresses */
+};
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS)
+/* This structure describes one open "file" */
+
+struct profiler_file_s
+{
+  struct procfs_file_s base;          /* Base open file structure */
+  char line[PROFILER_LINELEN];        /* Pre-allocated line buffer */
+};
+#endif
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS)
+static int     profiler_open(FAR struct file *filep,
+                             FAR const char *relpath,
+                             int oflags, mode_t mode);
+static int     profiler_close(FAR struct file *filep);
+static ssize_t profiler_read(FAR struct file *filep, FAR char *buffer,
+                             size_t buflen);
+static ssize_t profiler_write(FAR struct file *filep,
+                              FAR const char *buffer, size_t buflen);
+static int     profiler_dup(FAR const struct file *oldp,
+                            FAR struct file *newp);
+static int     profiler_stat(FAR const char *relpath, FAR struct stat *buf);
+#endif
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS)
+/* See fs_procfs.c -- this structure is explicitly externed there. */
+
+const struct procfs_operations g_profiler_operations =
+{
+  profiler_open,      /* open */
+  profiler_close,     /* close */
+  profiler_read,      /* read */
+  profiler_write,     /* write */
+  NULL,               /* poll */
+
+  profiler_dup,       /* dup */
+
+  NULL,               /* opendir */
+  NULL,               /* closedir */
+  NULL,               /* readdir */
+  NULL,               /* rewinddir */
+
+  profiler_stat       /* stat */
+};
+#endif
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* Open-addressed hash table of call chains */
+
+static struct profstack_s g_prof_stacks[PROFILER_NSTACKS];
+
+/* Samples that could not be stored because the table was full */
+
+static uint32_t g_prof_overflow;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS)
+
+/****************************************************************************
+ * Name: profiler_open
+ ****************************************************************************/
+
+static int profiler_open(FAR struct file *filep, FAR const char *relpath,
+                         int oflags, mode_t mode)
+{
+  FAR struct profiler_file_s *priv;
+
+  finfo("Open '%s'\n", relpath);
+
+  /* Allocate the open file structure */
+
+  priv = kmm_zalloc(sizeof(struct profiler_file_s));
+  if (priv == NULL)
+    {
+      ferr("ERROR: Failed to allocate file attributes\n");
+      return -ENOMEM;
+    }
+
+  filep->f_priv = priv;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: profiler_close
+ ****************************************************************************/
+
+static int profiler_close(FAR struct file *filep)
+{
+  kmm_free(filep->f_priv);
+  filep->f_priv = NULL;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: profiler_read
+ *
+ * Description:
+ *   Emit one "hits pc;pc;..." line per aggregated call chain, leaf frame
+ *   first, plus a final "overflow" line when samples have been dropped.
+ *
+ ****************************************************************************/
+
+static ssize_t profiler_read(FAR struct file *filep, FAR char *buffer,
+                             size_t buflen)
+{
+  FAR struct profiler_file_s *priv = filep->f_priv;
+  size_t linesize;
+  size_t copysize;
+  size_t totalsize = 0;
+  off_t  offset    = filep->f_pos;
+  int    i;
+  int    j;
+
+  for (i = 0; i < PROFILER_NSTACKS && buflen > 0; i++)
+    {
+      FAR struct profstack_s *ps = &g_prof_stacks[i];
+
+      if (ps->hits == 0)
+        {
+          continue;
+        }
+
+      linesize = snprintf(priv->line, PROFILER_LINELEN, "%" PRIu32,
+                          ps->hits);
+      for (j = 0; j < ps->depth && linesize < PROFILER_LINELEN; j++)
+        {
+          linesize += snprintf(&priv->line[linesize],
+                               PROFILER_LINELEN - linesize, "%c%p",
+                               j == 0 ? ' ' : ';', ps->stack[j]);
+        }
+
+      if (linesize < PROFILER_LINELEN)
+        {
+          priv->line[linesize++] = '\n';
+        }
+
+      copysize = procfs_memcpy(priv->line, linesize, buffer, buflen,
+                               &offset);
+
+      totalsize += copysize;
+      buffer    += copysize;
+      buflen    -= copysize;
+    }
+
+  if (g_prof_overflow > 0 && buflen > 0)
+    {
+      linesize = snprintf(priv->line, PROFILER_LINELEN,
+                          "%" PRIu32 " [overflow]\n", g_prof_overflow);
+      copysize = procfs_memcpy(priv->line, linesize, buffer, buflen,
+                               &offset);
+      totalsize += copysize;
+    }
+
+  filep->f_pos += totalsize;
+  return totalsize;
+}
+
+/****************************************************************************
+ * Name: profiler_write
+ *
+ * Description:
+ *   Writing anything to the file resets the aggregated samples.
+ *
+ ****************************************************************************/
+
+static ssize_t profiler_write(FAR struct file *filep,
+                              FAR const char *buffer, size_t buflen)
+{
+  memset(g_prof_stacks, 0, sizeof(g_prof_stacks));
+  g_prof_overflow = 0;
+  return buflen;
+}
+
+/****************************************************************************
+ * Name: profiler_dup
+ ****************************************************************************/
+
+static int profiler_dup(FAR const struct file *oldp, FAR struct file *newp)
+{
+  FAR struct profiler_file_s *newpriv;
+
+  /* Allocate a new container to hold the task and attribute selection */
+
+  newpriv = kmm_zalloc(sizeof(struct profiler_file_s));
+  if (newpriv == NULL)
+    {
+      ferr("ERROR: Failed to allocate file attributes\n");
+      return -ENOMEM;
+    }
+
+  /* The copy the file attributes from the old attributes to the new */
+
+  memcpy(newpriv, oldp->f_priv, sizeof(struct profiler_file_s));
+
+  /* Save the new attributes in the new file structure */
+
+  newp->f_priv = newpriv;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: profiler_stat
+ ****************************************************************************/
+
+static int profiler_stat(FAR const char *relpath, FAR struct stat *buf)
+{
+  /* "profile" is the only acceptable value for the relpath */
+
+  if (strcmp(relpath, "profile") != 0)
+    {
+      ferr("ERROR: relpath is '%s'\n", relpath);
+      return -ENOENT;
+    }
+
+  memset(buf, 0, sizeof(struct stat));
+  buf->st_mode = S_IFREG | S_IWOTH | S_IWGRP | S_IWUSR |
+                 S_IROTH | S_IRGRP | S_IRUSR;
+  return OK;
+}
+
+#endif /* !CONFIG_DISABLE_MOUNTPOINT && CONFIG_FS_PROCFS */
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxsched_profile_sample
+ *
+ * Description:
+ *   Capture one call-chain sample of the task running on this CPU and
+ *   fold it into the stack hash table.  Called from the system timer tick
+ *   with interrupts disabled, so the table needs no further protection.
+ *
+ * Input Parameters:
+ *   None
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void nxsched_profile_sample(void)
+{
+  FAR void *stack[PROFILER_DEPTH];
+  uintptr_t hash = 0;
+  unsigned int i;
+  unsigned int n;
+  int depth;
+
+  /* Unwind the interrupted context of the running task */
+
+  depth = up_backtrace(this_task(), stack, PROFILER_DEPTH, PROFILER_SKIP);
+  if (depth <= 0)
+    {
+      return;
+    }
+
+  /* Hash the call chain and look it up with linear probing */
+
+  for (i = 0; i < (unsigned int)depth; i++)
+    {
+      hash = hash * 31 + (uintptr_t)stack[i];
+    }
+
+  i = (unsigned int)(hash % PROFILER_NSTACKS);
+
+  for (n = 0; n < PROFILER_NSTACKS; n++)
+    {
+      FAR struct profstack_s *ps = &g_prof_stacks[i];
+
+      if (ps->hits == 0)
+        {
+          /* Claim the empty slot for this call chain */
+
+          memcpy(ps->stack, stack, depth * sizeof(FAR void *));
+          ps->depth = depth;
+        }
+
+      if (ps->depth == depth &&
+          memcmp(ps->stack, stack, depth * sizeof(FAR void *)) == 0)
+        {
+          ps->hits++;
+          return;
+        }
+
+      if (++i >= PROFILER_NSTACKS)
+        {
+          i = 0;
+        }
+    }
+
+  /* The table is full:  Count the sample so that the loss is visible */
+
+  g_prof_overflow++;
+}
+
+#endif /* CONFIG_SCHED_CPUPROFILER */
@@ -132,7 +132,7 @@ int nxsched_release_tcb(FAR struct tcb_s *tcb, uint8_t ttype)
 
       if (tcb->stack_alloc_ptr)
         {
-          up_release_stack(tcb, ttype);
+          nxsched_stack_free(tcb, ttype);
         }
 
 #ifdef CONFIG_PIC
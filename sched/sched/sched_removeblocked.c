@@ -28,7 +28,9 @@
 
 #include <assert.h>
 
+#include <nuttx/clock.h>
 #include <nuttx/queue.h>
+#include <nuttx/sched_note.h>
 
 #include "sched/sched.h"
 
@@ -79,4 +81,16 @@ void nxsched_remove_blocked(FAR struct tcb_s *btcb)
    */
 
   btcb->task_state = TSTATE_TASK_INVALID;
+
+  /* Indicate that the task has been woken, remembering the wake time so
+   * that the wake-to-run latency can be measured when the task actually
+   * starts running.
+   */
+
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SWITCH
+  sched_note_wakeup(btcb);
+#endif
+#ifdef CONFIG_SCHED_WAKEUPMONITOR
+  btcb->wake_start = perf_gettime();
+#endif
 }
@@ -92,6 +92,9 @@ bool nxsched_remove_readytorun(FAR struct tcb_s *rtcb)
    * is always the g_readytorun list.
    */
 
+#ifdef CONFIG_SCHED_PRIO_BITMAP
+  nxsched_prioq_remove(rtcb);
+#endif
   dq_rem((FAR dq_entry_t *)rtcb, tasklist);
 
   /* Since the TCB is not in any list, it is now invalid */
@@ -292,8 +295,19 @@ bool nxsched_remove_readytorun(FAR struct tcb_s *tcb)
   else
     {
       FAR dq_queue_t *tasklist;
+#ifndef CONFIG_SCHED_CPU_MAILBOX
       int i;
+#endif
 
+#ifdef CONFIG_SCHED_CPU_MAILBOX
+      /* The TCB may still be queued in a CPU wakeup mailbox */
+
+      if (nxsched_mailbox_discard(tcb))
+        {
+          tcb->task_state = TSTATE_TASK_INVALID;
+          return false;
+        }
+#else
       /* if tcb == g_delivertasks[i] we set NULL to g_delivertasks[i] */
 
       for (i = 0; i < CONFIG_SMP_NCPUS; i++)
@@ -305,6 +319,7 @@ bool nxsched_remove_readytorun(FAR struct tcb_s *tcb)
               return false;
             }
         }
+#endif
 
       tasklist = TLIST_HEAD(tcb, tcb->cpu);
 
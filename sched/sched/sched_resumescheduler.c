@@ -68,6 +68,37 @@ void nxsched_resume_scheduler(FAR struct tcb_s *tcb)
     }
 #endif
 
+#ifdef CONFIG_SCHED_CPU_IDLEMASK
+  /* Track whether this CPU is entering or leaving its IDLE task */
+
+  if (is_idle_task(tcb))
+    {
+      g_cpu_idlemask |= (1 << this_cpu());
+    }
+  else
+    {
+      g_cpu_idlemask &= ~(1 << this_cpu());
+    }
+#endif
+
+#ifdef CONFIG_SCHED_WAKEUPMONITOR
+  /* Bin the wake-to-run latency if this task was recently woken */
+
+  if (tcb->wake_start != 0)
+    {
+      clock_t elapsed = perf_gettime() - tcb->wake_start;
+      unsigned int bin;
+
+      for (bin = 0; elapsed > 1 && bin < WAKEHIST_NBINS - 1; bin++)
+        {
+          elapsed >>= 1;
+        }
+
+      tcb->wake_hist[bin]++;
+      tcb->wake_start = 0;
+    }
+#endif
+
   /* Indicate the task has been resumed */
 
 #ifdef CONFIG_SCHED_CRITMONITOR
@@ -79,18 +79,26 @@ static spinlock_t g_smp_call_lock;
  *   call_data  - Call data
  *
  * Returned Value:
- *   None
+ *   true if the target cpu must be kicked with an IPI, false if the call
+ *   queue of the target was not empty.  In the latter case an IPI is
+ *   already on its way (or the handler is draining the queue right now)
+ *   and it will pick up this entry as well, so batched requests cost a
+ *   single interrupt.
  *
  ****************************************************************************/
 
-static void nxsched_smp_call_add(int cpu,
+static bool nxsched_smp_call_add(int cpu,
                                  FAR struct smp_call_data_s *call_data)
 {
   irqstate_t flags;
+  bool kick;
 
   flags = spin_lock_irqsave(&g_smp_call_lock);
+  kick = sq_empty(&g_smp_call_queue[cpu]);
   sq_addlast(&call_data->node[cpu], &g_smp_call_queue[cpu]);
   spin_unlock_irqrestore(&g_smp_call_lock, flags);
+
+  return kick;
 }
 
 /****************************************************************************
@@ -219,6 +227,7 @@ int nxsched_smp_call(cpu_set_t cpuset, nxsched_smp_call_t func,
     };
 
   FAR struct smp_call_data_s *call_data;
+  cpu_set_t kickset;
   int remote_cpus;
   int ret = OK;
   int i;
@@ -270,15 +279,27 @@ int nxsched_smp_call(cpu_set_t cpuset, nxsched_smp_call_t func,
   call_data->arg  = arg;
   call_data->refcount = remote_cpus;
 
+  /* Only kick the CPUs whose call queue was empty.  A non-empty queue
+   * means that an earlier IPI has not been handled yet and its handler
+   * will drain this entry as well.
+   */
+
+  CPU_ZERO(&kickset);
   for (i = 0; i < CONFIG_SMP_NCPUS; i++)
     {
       if (CPU_ISSET(i, &cpuset))
         {
-          nxsched_smp_call_add(i, call_data);
+          if (nxsched_smp_call_add(i, call_data))
+            {
+              CPU_SET(i, &kickset);
+            }
         }
     }
 
-  up_send_smp_call(cpuset);
+  if (CPU_COUNT(&kickset) > 0)
+    {
+      up_send_smp_call(kickset);
+    }
 
   if (wait)
     {
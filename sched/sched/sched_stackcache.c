@@ -0,0 +1,198 @@
+/****************************************************************************
+ * sched/sched/sched_stackcache.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+
+#include <nuttx/arch.h>
+#include <nuttx/irq.h>
+#include <nuttx/kmalloc.h>
+#include <nuttx/sched.h>
+
+#include "sched/sched.h"
+
+#ifdef CONFIG_SCHED_STACK_CACHE
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifdef CONFIG_SMP
+#  define STACK_CACHE_NCPUS CONFIG_SMP_NCPUS
+#else
+#  define STACK_CACHE_NCPUS 1
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct stack_cache_entry_s
+{
+  FAR void *ptr;     /* The cached stack allocation, NULL if free */
+  size_t size;       /* The adjusted size of the cached stack */
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* The per-CPU caches of free stacks.  Entries are only manipulated from
+ * within a critical section.
+ */
+
+static struct stack_cache_entry_s
+  g_stack_cache[STACK_CACHE_NCPUS][CONFIG_SCHED_STACK_CACHE_SIZE];
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxsched_stack_alloc
+ *
+ * Description:
+ *   Allocate the stack for a new thread, reusing a cached stack from an
+ *   exited thread when one of a suitable size is available.  A cached
+ *   stack is suitable if it is at least as large as the request but not
+ *   more than twice as large, so that small threads do not pin large
+ *   allocations.  If there is no suitable cached stack, the stack is
+ *   allocated with up_create_stack() as before.
+ *
+ * Input Parameters:
+ *   tcb        - The TCB of the new thread
+ *   stack_size - The requested stack size
+ *   ttype      - The thread type (task, pthread or kernel thread)
+ *
+ * Returned Value:
+ *   Zero (OK) on success; ERROR on failure (like up_create_stack()).
+ *
+ ****************************************************************************/
+
+int nxsched_stack_alloc(FAR struct tcb_s *tcb, size_t stack_size,
+                        uint8_t ttype)
+{
+  FAR struct stack_cache_entry_s *entry;
+  FAR void *ptr = NULL;
+  irqstate_t flags;
+  size_t size = 0;
+  int i;
+
+  flags = enter_critical_section();
+
+  entry = g_stack_cache[this_cpu()];
+  for (i = 0; i < CONFIG_SCHED_STACK_CACHE_SIZE; i++)
+    {
+      if (entry[i].ptr != NULL && entry[i].size >= stack_size &&
+          entry[i].size <= 2 * stack_size)
+        {
+          ptr          = entry[i].ptr;
+          size         = entry[i].size;
+          entry[i].ptr = NULL;
+          break;
+        }
+    }
+
+  leave_critical_section(flags);
+
+  if (ptr != NULL)
+    {
+      /* Adopt the cached stack.  With CONFIG_STACK_COLORATION this
+       * re-colors the stack; otherwise the stale contents are simply
+       * reused without touching the memory.
+       */
+
+      if (up_use_stack(tcb, ptr, size) == OK)
+        {
+          /* The stack was heap-allocated and must be freed (or cached
+           * again) when the thread exits.
+           */
+
+          tcb->flags |= TCB_FLAG_FREE_STACK;
+          return OK;
+        }
+
+      kmm_free(ptr);
+    }
+
+  return up_create_stack(tcb, stack_size, ttype);
+}
+
+/****************************************************************************
+ * Name: nxsched_stack_free
+ *
+ * Description:
+ *   Release the stack of an exiting thread, caching it for reuse if there
+ *   is room in this CPU's cache.  Stacks that were provided by the caller
+ *   (no TCB_FLAG_FREE_STACK) and stacks that do not fit into the cache
+ *   are handed to up_release_stack() as before.
+ *
+ * Input Parameters:
+ *   tcb   - The TCB of the exiting thread
+ *   ttype - The thread type (task, pthread or kernel thread)
+ *
+ * Returned Value:
+ *   None.
+ *
+ ****************************************************************************/
+
+void nxsched_stack_free(FAR struct tcb_s *tcb, uint8_t ttype)
+{
+  FAR struct stack_cache_entry_s *entry;
+  irqstate_t flags;
+  int i;
+
+  if (tcb->stack_alloc_ptr != NULL &&
+      (tcb->flags & TCB_FLAG_FREE_STACK) != 0)
+    {
+      flags = enter_critical_section();
+
+      entry = g_stack_cache[this_cpu()];
+      for (i = 0; i < CONFIG_SCHED_STACK_CACHE_SIZE; i++)
+        {
+          if (entry[i].ptr == NULL)
+            {
+              entry[i].ptr  = tcb->stack_alloc_ptr;
+              entry[i].size = tcb->adj_stack_size;
+
+              tcb->stack_alloc_ptr = NULL;
+              tcb->stack_base_ptr  = NULL;
+              tcb->adj_stack_size  = 0;
+
+              leave_critical_section(flags);
+              return;
+            }
+        }
+
+      leave_critical_section(flags);
+    }
+
+  up_release_stack(tcb, ttype);
+}
+
+#endif /* CONFIG_SCHED_STACK_CACHE */
@@ -0,0 +1,453 @@
+/****************************************************************************
+ * sched/sched/sched_stackmonitor.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <nuttx/arch.h>
+#include <nuttx/clock.h>
+#include <nuttx/fs/procfs.h>
+#include <nuttx/kmalloc.h>
+#include <nuttx/mm/mm.h>
+#include <nuttx/sched.h>
+#include <nuttx/wqueue.h>
+
+#include "sched/sched.h"
+
+#ifdef CONFIG_SCHED_STACKMONITOR
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define STACKMON_DELAY   MSEC2TICK(CONFIG_SCHED_STACKMONITOR_INTERVAL)
+
+/* Large enough for the longest line generated below */
+
+#define STACKMON_LINELEN (32 + CONFIG_TASK_NAME_SIZE)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS)
+/* This structure describes one open "file" */
+
+struct stackmon_file_s
+{
+  struct procfs_file_s base;     /* Base open file structure */
+  char line[STACKMON_LINELEN];   /* Pre-allocated buffer for formatted lines */
+};
+
+/* Carries the caller's buffer through the task traversal */
+
+struct stackmon_copy_s
+{
+  FAR struct stackmon_file_s *priv;
+  FAR char *buffer;              /* Where to copy next */
+  size_t remaining;              /* Available bytes in buffer */
+  size_t copied;                 /* Total bytes copied so far */
+  off_t offset;                  /* File content offset to skip */
+};
+#endif
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+static void    stackmon_sample(FAR struct tcb_s *tcb, FAR void *arg);
+static void    stackmon_worker(FAR void *arg);
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS)
+static int     stackmon_open(FAR struct file *filep, FAR const char *relpath,
+                             int oflags, mode_t mode);
+static int     stackmon_close(FAR struct file *filep);
+static ssize_t stackmon_read(FAR struct file *filep, FAR char *buffer,
+                             size_t buflen);
+static int     stackmon_dup(FAR const struct file *oldp,
+                            FAR struct file *newp);
+static int     stackmon_stat(FAR const char *relpath, FAR struct stat *buf);
+#endif
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS)
+/* See fs_procfs.c -- this structure is explicitly externed there. */
+
+const struct procfs_operations g_stackmon_operations =
+{
+  stackmon_open,      /* open */
+  stackmon_close,     /* close */
+  stackmon_read,      /* read */
+  NULL,               /* write */
+  NULL,               /* poll */
+
+  stackmon_dup,       /* dup */
+
+  NULL,               /* opendir */
+  NULL,               /* closedir */
+  NULL,               /* readdir */
+  NULL,               /* rewinddir */
+
+  stackmon_stat       /* stat */
+};
+#endif
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct work_s g_stackmon_work;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: stackmon_sample
+ *
+ * Description:
+ *   Update the cached stack high watermark of one task.  The stack
+ *   coloration can only be destroyed, never restored, so it is sufficient
+ *   to re-check the stack words between the last known watermark and the
+ *   bottom of the stack.  In steady state that is a single comparison.
+ *
+ *   This handler is called from nxsched_foreach() with the TCB protected
+ *   by a critical section.
+ *
+ ****************************************************************************/
+
+static void stackmon_sample(FAR struct tcb_s *tcb, FAR void *arg)
+{
+  FAR uint32_t *base;
+  uintptr_t start;
+  uintptr_t end;
+  size_t nwords;
+  size_t mark;
+
+  if (tcb->stack_base_ptr == NULL || tcb->adj_stack_size == 0)
+    {
+      return;
+    }
+
+#ifdef CONFIG_ARCH_ADDRENV
+  if (tcb->addrenv_own != NULL)
+    {
+      /* The stack lies in another address environment.  Fall back on the
+       * architecture's full scan which handles the switch.
+       */
+
+      tcb->stackmon_used = up_check_tcbstack(tcb);
+      return;
+    }
+#endif
+
+  /* Work on a 32-bit aligned window within the stack allocation.  The
+   * window may exclude a few words that the architecture's own check
+   * covers, making the result very slightly pessimistic.
+   */
+
+  start  = ((uintptr_t)tcb->stack_base_ptr + 3) & ~(uintptr_t)3;
+  end    = ((uintptr_t)tcb->stack_base_ptr + tcb->adj_stack_size) &
+           ~(uintptr_t)3;
+  if (end <= start)
+    {
+      return;
+    }
+
+  base   = (FAR uint32_t *)start;
+  nwords = (end - start) >> 2;
+  mark   = tcb->stackmon_free;
+
+  if (tcb->stackmon_color == 0)
+    {
+      /* First sample of this task.  The word at the lowest stack address
+       * is still colored unless the stack has been completely used; use
+       * it as the reference color and scan down from the very top.
+       */
+
+      tcb->stackmon_color = base[0];
+      mark = nwords;
+
+      if (tcb->stackmon_color == 0)
+        {
+          /* The coloration has been destroyed all of the way down to the
+           * bottom of the stack:  Report the whole stack as used.
+           */
+
+          tcb->stackmon_free = 0;
+          tcb->stackmon_used = tcb->adj_stack_size;
+          return;
+        }
+    }
+
+  if (mark > nwords)
+    {
+      mark = nwords;
+    }
+
+  /* Walk down from the last known watermark until a still-colored word
+   * is found.
+   */
+
+  while (mark > 0 && base[mark - 1] != tcb->stackmon_color)
+    {
+      mark--;
+    }
+
+  tcb->stackmon_free = mark;
+  tcb->stackmon_used = tcb->adj_stack_size - (mark << 2);
+}
+
+/****************************************************************************
+ * Name: stackmon_worker
+ *
+ * Description:
+ *   Periodic sampler.  Refreshes the cached watermark of every task, then
+ *   re-schedules itself.
+ *
+ ****************************************************************************/
+
+static void stackmon_worker(FAR void *arg)
+{
+  nxsched_foreach(stackmon_sample, NULL);
+  work_queue(LPWORK, &g_stackmon_work, stackmon_worker, NULL,
+             STACKMON_DELAY);
+}
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS)
+
+/****************************************************************************
+ * Name: stackmon_copyline
+ *
+ * Description:
+ *   Format one "pid,used,size,name" line from the cached watermark of one
+ *   task and copy it toward the user buffer.  No stack is scanned here.
+ *
+ ****************************************************************************/
+
+static void stackmon_copyline(FAR struct tcb_s *tcb, FAR void *arg)
+{
+  FAR struct stackmon_copy_s *copy = arg;
+  FAR struct stackmon_file_s *priv = copy->priv;
+  size_t linesize;
+  size_t copysize;
+
+  if (copy->remaining == 0)
+    {
+      return;
+    }
+
+#if CONFIG_TASK_NAME_SIZE > 0
+  linesize = snprintf(priv->line, STACKMON_LINELEN, "%d,%zu,%zu,%s\n",
+                      tcb->pid, tcb->stackmon_used,
+                      (size_t)tcb->adj_stack_size, tcb->name);
+#else
+  linesize = snprintf(priv->line, STACKMON_LINELEN, "%d,%zu,%zu\n",
+                      tcb->pid, tcb->stackmon_used,
+                      (size_t)tcb->adj_stack_size);
+#endif
+
+  copysize = procfs_memcpy(priv->line, linesize, copy->buffer,
+                           copy->remaining, &copy->offset);
+
+  copy->buffer    += copysize;
+  copy->remaining -= copysize;
+  copy->copied    += copysize;
+}
+
+/****************************************************************************
+ * Name: stackmon_open
+ ****************************************************************************/
+
+static int stackmon_open(FAR struct file *filep, FAR const char *relpath,
+                         int oflags, mode_t mode)
+{
+  FAR struct stackmon_file_s *priv;
+
+  finfo("Open '%s'\n", relpath);
+
+  /* This file is read-only */
+
+  if ((oflags & O_WRONLY) != 0 || (oflags & O_RDONLY) == 0)
+    {
+      ferr("ERROR: Only O_RDONLY supported\n");
+      return -EACCES;
+    }
+
+  /* Allocate the open file structure */
+
+  priv = kmm_zalloc(sizeof(struct stackmon_file_s));
+  if (priv == NULL)
+    {
+      ferr("ERROR: Failed to allocate file attributes\n");
+      return -ENOMEM;
+    }
+
+  filep->f_priv = priv;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: stackmon_close
+ ****************************************************************************/
+
+static int stackmon_close(FAR struct file *filep)
+{
+  kmm_free(filep->f_priv);
+  filep->f_priv = NULL;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: stackmon_read
+ ****************************************************************************/
+
+static ssize_t stackmon_read(FAR struct file *filep, FAR char *buffer,
+                             size_t buflen)
+{
+  struct stackmon_copy_s copy;
+#if defined(CONFIG_MM_KERNEL_HEAP) || defined(CONFIG_BUILD_FLAT)
+  size_t linesize;
+#endif
+
+  copy.priv      = filep->f_priv;
+  copy.buffer    = buffer;
+  copy.remaining = buflen;
+  copy.copied    = 0;
+  copy.offset    = filep->f_pos;
+
+#if defined(CONFIG_MM_KERNEL_HEAP) || defined(CONFIG_BUILD_FLAT)
+  /* Lead with the kernel heap headroom, from the heap's own counters */
+
+#  ifdef CONFIG_MM_KERNEL_HEAP
+  linesize = snprintf(copy.priv->line, STACKMON_LINELEN, "heapfree,%zu\n",
+                      mm_heapfree(g_kmmheap));
+#  else
+  linesize = snprintf(copy.priv->line, STACKMON_LINELEN, "heapfree,%zu\n",
+                      mm_heapfree(g_mmheap));
+#  endif
+
+  copy.copied     = procfs_memcpy(copy.priv->line, linesize, copy.buffer,
+                                  copy.remaining, &copy.offset);
+  copy.buffer    += copy.copied;
+  copy.remaining -= copy.copied;
+#endif
+
+  /* Then one line per task from the cached watermarks */
+
+  nxsched_foreach(stackmon_copyline, &copy);
+
+  filep->f_pos += copy.copied;
+  return copy.copied;
+}
+
+/****************************************************************************
+ * Name: stackmon_dup
+ ****************************************************************************/
+
+static int stackmon_dup(FAR const struct file *oldp, FAR struct file *newp)
+{
+  FAR struct stackmon_file_s *newpriv;
+
+  /* Allocate a new container to hold the task and attribute selection */
+
+  newpriv = kmm_zalloc(sizeof(struct stackmon_file_s));
+  if (newpriv == NULL)
+    {
+      ferr("ERROR: Failed to allocate file attributes\n");
+      return -ENOMEM;
+    }
+
+  /* The copy the file attributes from the old attributes to the new */
+
+  memcpy(newpriv, oldp->f_priv, sizeof(struct stackmon_file_s));
+
+  /* Save the new attributes in the new file structure */
+
+  newp->f_priv = newpriv;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: stackmon_stat
+ ****************************************************************************/
+
+static int stackmon_stat(FAR const char *relpath, FAR struct stat *buf)
+{
+  /* "stackmon" is the only acceptable value for the relpath */
+
+  if (strcmp(relpath, "stackmon") != 0)
+    {
+      ferr("ERROR: relpath is '%s'\n", relpath);
+      return -ENOENT;
+    }
+
+  /* "stackmon" is a read-only file */
+
+  memset(buf, 0, sizeof(struct stat));
+  buf->st_mode = S_IFREG | S_IROTH | S_IRGRP | S_IRUSR;
+  return OK;
+}
+
+#endif /* !CONFIG_DISABLE_MOUNTPOINT && CONFIG_FS_PROCFS */
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxsched_stackmonitor_start
+ *
+ * Description:
+ *   Start the periodic stack usage sampler.  Called once during OS bring-up
+ *   after the work queues have been started.
+ *
+ * Input Parameters:
+ *   None
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void nxsched_stackmonitor_start(void)
+{
+  work_queue(LPWORK, &g_stackmon_work, stackmon_worker, NULL,
+             STACKMON_DELAY);
+}
+
+#endif /* CONFIG_SCHED_STACKMONITOR */
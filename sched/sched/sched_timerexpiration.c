@@ -561,6 +561,29 @@ void nxsched_reassess_timer(void)
   clock_t ticks;
   clock_t elapsed;
 
+#if CONFIG_SCHED_TICKLESS_SLACK > 0
+  /* Deadline coalescing:  If the interval timer is already armed and its
+   * programmed deadline lies no more than the configured slack after the
+   * new earliest watchdog expiration, then leave the hardware alone.  An
+   * early expiration is always harmless (the expiration logic simply
+   * re-arms); a late one is bounded by the slack.  This avoids the cancel/
+   * reprogram pair on nearly every wd_start()/wd_cancel() call.
+   */
+
+  if (g_timer_interval > 0 && !list_is_empty(&g_wdactivelist))
+    {
+      FAR struct wdog_s *wdog = list_first_entry(&g_wdactivelist,
+                                                 struct wdog_s, node);
+      clock_t armed = g_timer_tick + g_timer_interval;
+
+      if (clock_compare(armed, wdog->expired) ||
+          armed - wdog->expired <= CONFIG_SCHED_TICKLESS_SLACK)
+        {
+          return;
+        }
+    }
+#endif
+
   /* Cancel the timer and get the current time */
 
 #ifdef CONFIG_SCHED_TICKLESS_ALARM
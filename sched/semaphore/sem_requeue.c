@@ -0,0 +1,118 @@
+/****************************************************************************
+ * sched/semaphore/sem_requeue.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <assert.h>
+
+#include <nuttx/irq.h>
+#include <nuttx/sched.h>
+
+#include "sched/sched.h"
+#include "semaphore/semaphore.h"
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxsem_requeue
+ *
+ * Description:
+ *   Transfer up to 'count' waiting tasks from the wait queue of one
+ *   semaphore to the wait queue of another without awakening them.  Each
+ *   transferred task is treated exactly as if it had blocked on 'to' in
+ *   the first place:  it is released by a later post of 'to' (or by its
+ *   own watchdog timeout or signal via nxsem_wait_irq(), which recovers
+ *   the counts through the TCB waitobj reference).
+ *
+ *   This is the mechanism underlying wake-one/requeue-rest broadcast
+ *   operations:  instead of making every waiter runnable just to have all
+ *   but one block again on a second object, the losers are moved directly
+ *   to the second object's wait queue.
+ *
+ *   No priority inheritance boosting is performed on behalf of the
+ *   transferred tasks.  The caller must therefore only requeue onto
+ *   semaphores that are used as signaling/wake channels (such as the
+ *   mutex fast path semaphore) where holder-based boosting is not
+ *   maintained by the waiters.
+ *
+ * Input Parameters:
+ *   from  - The semaphore whose waiters are to be transferred
+ *   to    - The semaphore that will receive the waiters
+ *   count - The maximum number of waiters to transfer
+ *
+ * Returned Value:
+ *   The number of waiters actually transferred (zero if 'from' had no
+ *   waiters).
+ *
+ * Assumptions:
+ *   The caller must ensure that a wakeup will eventually be posted to
+ *   'to' for each transferred waiter.
+ *
+ ****************************************************************************/
+
+int nxsem_requeue(FAR sem_t *from, FAR sem_t *to, int count)
+{
+  FAR struct tcb_s *wtcb;
+  irqstate_t flags;
+  int moved = 0;
+
+  DEBUGASSERT(from != NULL && to != NULL && from != to);
+
+  /* The wait queues and counts must be modified atomically with respect
+   * to both interrupt handlers and other CPUs.
+   */
+
+  flags = enter_critical_section();
+
+  while (moved < count && from->semcount < 0)
+    {
+      /* Remove the highest priority waiter from the source wait queue */
+
+      wtcb = (FAR struct tcb_s *)dq_remfirst(SEM_WAITLIST(from));
+      if (wtcb == NULL)
+        {
+          break;
+        }
+
+      /* Release the count that the waiter took from 'from' and take one
+       * from 'to' on its behalf, then block it on 'to'.  The task state
+       * remains TSTATE_WAIT_SEM and any watchdog started for a timed wait
+       * remains in effect; only the object being waited upon changes.
+       */
+
+      from->semcount++;
+      to->semcount--;
+
+      wtcb->waitobj = to;
+      nxsched_add_prioritized(wtcb, SEM_WAITLIST(to));
+      moved++;
+    }
+
+  leave_critical_section(flags);
+  return moved;
+}
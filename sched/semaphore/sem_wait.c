@@ -33,6 +33,8 @@
 #include <nuttx/init.h>
 #include <nuttx/irq.h>
 #include <nuttx/arch.h>
+#include <nuttx/clock.h>
+#include <nuttx/spinlock.h>
 
 #include "sched/sched.h"
 #include "semaphore/semaphore.h"
@@ -106,6 +108,10 @@ int nxsem_wait(FAR sem_t *sem)
       nxsem_add_holder(sem);
       rtcb->waitobj = NULL;
       ret = OK;
+
+#ifdef CONFIG_SCHED_LOCKMONITOR
+      nxsched_lockmon_record(return_address(0), false, 0);
+#endif
     }
 
   /* The semaphore is NOT available, We will have to block the
@@ -117,6 +123,9 @@ int nxsem_wait(FAR sem_t *sem)
 #ifdef CONFIG_PRIORITY_INHERITANCE
       uint8_t prioinherit = sem->flags & SEM_PRIO_MASK;
 #endif
+#ifdef CONFIG_SCHED_LOCKMONITOR
+      clock_t start = perf_gettime();
+#endif
 
       /* First, verify that the task is not already waiting on a
        * semaphore
@@ -212,6 +221,11 @@ int nxsem_wait(FAR sem_t *sem)
 
       ret = rtcb->errcode != OK ? -rtcb->errcode : OK;
 
+#ifdef CONFIG_SCHED_LOCKMONITOR
+      nxsched_lockmon_record(return_address(0), true,
+                             perf_gettime() - start);
+#endif
+
 #ifdef CONFIG_PRIORITY_INHERITANCE
       if (prioinherit != 0)
         {
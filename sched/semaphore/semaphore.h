@@ -67,6 +67,12 @@ void nxsem_timeout(wdparm_t arg);
 
 void nxsem_recover(FAR struct tcb_s *tcb);
 
+/* Transfer waiters from one semaphore's wait queue to another's without
+ * awakening them.
+ */
+
+int nxsem_requeue(FAR sem_t *from, FAR sem_t *to, int count);
+
 /* Special logic needed only by priority inheritance to manage collections of
  * holders of semaphores.
  */
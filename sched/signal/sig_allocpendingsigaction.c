@@ -31,6 +31,7 @@
 
 #include <nuttx/irq.h>
 #include <nuttx/arch.h>
+#include <nuttx/sched.h>
 
 #include "signal/signal.h"
 
@@ -75,11 +76,58 @@ FAR sigq_t *nxsig_alloc_pendingsigaction(void)
 
   else
     {
+#ifdef CONFIG_SIG_BATCH_DELIVERY
+      int cpu;
+      int i;
+
+      /* Try this CPU's cache first.  The cache is private to this CPU so
+       * only local interrupts need to be disabled.
+       */
+
+      flags = up_irq_save();
+      cpu   = this_cpu();
+      sigq  = (FAR sigq_t *)sq_remfirst(&g_sigq_cpupool[cpu]);
+      if (sigq != NULL)
+        {
+          g_sigq_cpucount[cpu]--;
+        }
+
+      up_irq_restore(flags);
+
+      if (sigq == NULL)
+        {
+          /* The cache was empty.  Refill it in a batch from the global
+           * free list so that a burst of allocations pays for one
+           * critical section entry rather than one per signal.
+           */
+
+          flags = enter_critical_section();
+          sigq  = (FAR sigq_t *)sq_remfirst(&g_sigpendingaction);
+          if (sigq != NULL)
+            {
+              cpu = this_cpu();
+              for (i = g_sigq_cpucount[cpu]; i < SIG_BATCH_POOL_DEPTH; i++)
+                {
+                  FAR sq_entry_t *entry = sq_remfirst(&g_sigpendingaction);
+                  if (entry == NULL)
+                    {
+                      break;
+                    }
+
+                  sq_addlast(entry, &g_sigq_cpupool[cpu]);
+                  g_sigq_cpucount[cpu]++;
+                }
+            }
+
+          leave_critical_section(flags);
+        }
+#else
       /* Try to get the pending signal action structure from the free list */
 
       flags = enter_critical_section();
       sigq = (FAR sigq_t *)sq_remfirst(&g_sigpendingaction);
       leave_critical_section(flags);
+#endif
 
       /* Check if we got one. */
 
@@ -385,6 +385,112 @@ static void nxsig_add_pendingsignal(FAR struct tcb_s *stcb,
  * Public Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: nxsig_queue_actions
+ *
+ * Description:
+ *   Batched form of nxsig_queue_action().  Queue the signal actions for
+ *   every pending signal on the 'pending' list, appending all of the
+ *   resulting sigq_t structures to the recipient's pending action queue
+ *   and arming delivery within a single critical section entry.  The
+ *   sigq_t structures are drawn from the per-CPU pool maintained by
+ *   nxsig_alloc_pendingsigaction().
+ *
+ *   This function may only be used when 'stcb' is the currently running
+ *   task:  the unblocking and cross-CPU delivery performed by
+ *   nxsig_tcbdispatch() for other recipients is not handled here.
+ *
+ * Returned Value:
+ *   Returns 0 (OK) on success or a negated errno value on failure.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SIG_BATCH_DELIVERY
+int nxsig_queue_actions(FAR struct tcb_s *stcb, FAR sq_queue_t *pending)
+{
+  FAR sigpendq_t *sigpend;
+  FAR sigactq_t  *sigact;
+  FAR sigq_t     *sigq;
+  sq_queue_t      staged;
+  irqstate_t      flags;
+  int             ret = OK;
+
+  sched_lock();
+  DEBUGASSERT(stcb == this_task() && stcb->group != NULL);
+
+  /* Build one queued action per deliverable pending signal before
+   * entering the critical section.
+   */
+
+  sq_init(&staged);
+  for (sigpend = (FAR sigpendq_t *)pending->head;
+       sigpend != NULL;
+       sigpend = sigpend->flink)
+    {
+      /* Find the group sigaction associated with this signal */
+
+      sigact = nxsig_find_action(stcb->group, sigpend->info.si_signo);
+
+      /* Check if a valid signal handler is available.  NOTE: There is
+       * no default action.
+       */
+
+      if (sigact == NULL || sigact->act.sa_u._sa_sigaction == NULL)
+        {
+          continue;
+        }
+
+      /* Allocate a new element for the signal queue */
+
+      sigq = nxsig_alloc_pendingsigaction();
+      if (sigq == NULL)
+        {
+          ret = -ENOMEM;
+          break;
+        }
+
+      /* Populate the new signal queue element */
+
+      sigq->action.sighandler = sigact->act.sa_u._sa_sigaction;
+      sigq->mask = sigact->act.sa_mask;
+      if ((sigact->act.sa_flags & SA_NODEFER) == 0)
+        {
+          sigaddset(&sigq->mask, sigpend->info.si_signo);
+        }
+
+      memcpy(&sigq->info, &sigpend->info, sizeof(siginfo_t));
+      sigq->info.si_user = sigact->act.sa_user;
+
+      sq_addlast((FAR sq_entry_t *)sigq, &staged);
+    }
+
+  if (staged.head != NULL)
+    {
+      /* Append all of the staged actions to the pending signals list and
+       * schedule execution of the signal handling actions in one critical
+       * section entry.
+       */
+
+      flags = enter_critical_section();
+      while ((sigq = (FAR sigq_t *)sq_remfirst(&staged)) != NULL)
+        {
+          sq_addlast((FAR sq_entry_t *)sigq, &stcb->sigpendactionq);
+        }
+
+      if (!stcb->sigdeliver)
+        {
+          stcb->sigdeliver = nxsig_deliver;
+          up_schedule_sigaction(stcb);
+        }
+
+      leave_critical_section(flags);
+    }
+
+  sched_unlock();
+  return ret;
+}
+#endif
+
 /****************************************************************************
  * Name: nxsig_tcbdispatch
  *
@@ -82,6 +82,13 @@ sq_queue_t  g_sigpendingsignal;
 
 sq_queue_t  g_sigpendingirqsignal;
 
+#ifdef CONFIG_SIG_BATCH_DELIVERY
+/* Per-CPU caches of pending signal action structures.  See signal.h */
+
+sq_queue_t  g_sigq_cpupool[CONFIG_SMP_NCPUS];
+uint8_t     g_sigq_cpucount[CONFIG_SMP_NCPUS];
+#endif
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -168,6 +175,17 @@ void nxsig_initialize(void)
   sq_init(&g_sigpendingsignal);
   sq_init(&g_sigpendingirqsignal);
 
+#ifdef CONFIG_SIG_BATCH_DELIVERY
+  {
+    int cpu;
+
+    for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++)
+      {
+        sq_init(&g_sigq_cpupool[cpu]);
+      }
+  }
+#endif
+
   sigpool = nxsig_init_block(&g_sigpendingaction, sigpool,
                              NUM_PENDING_ACTIONS, SIG_ALLOC_FIXED);
   sigpool = nxsig_init_block(&g_sigpendingirqaction, sigpool,
@@ -29,6 +29,7 @@
 #include <sched.h>
 
 #include <nuttx/irq.h>
+#include <nuttx/sched.h>
 
 #include "signal/signal.h"
 
@@ -54,6 +55,27 @@ void nxsig_release_pendingsigaction(FAR sigq_t *sigq)
 
   if (sigq->type == SIG_ALLOC_FIXED)
     {
+#ifdef CONFIG_SIG_BATCH_DELIVERY
+      int cpu;
+
+      /* Prefer this CPU's cache; spill back to the global free list only
+       * when the cache is full.  The cache is private to this CPU so only
+       * local interrupts need to be disabled.
+       */
+
+      flags = up_irq_save();
+      cpu   = this_cpu();
+      if (g_sigq_cpucount[cpu] < SIG_BATCH_POOL_DEPTH)
+        {
+          sq_addlast((FAR sq_entry_t *)sigq, &g_sigq_cpupool[cpu]);
+          g_sigq_cpucount[cpu]++;
+          up_irq_restore(flags);
+          return;
+        }
+
+      up_irq_restore(flags);
+#endif
+
       /* Make sure we avoid concurrent access to the free
        * list from interrupt handlers.
        */
@@ -35,6 +35,7 @@
 
 #include <nuttx/irq.h>
 #include <nuttx/arch.h>
+#include <nuttx/signal.h>
 #include <nuttx/wdog.h>
 #include <nuttx/kmalloc.h>
 
@@ -84,3 +85,59 @@ FAR sigpendq_t *nxsig_remove_pendingsignal(FAR struct tcb_s *stcb, int signo)
 
   return currsig;
 }
+
+/****************************************************************************
+ * Name: nxsig_remove_pendingsignals
+ *
+ * Description:
+ *   Remove every pending signal that is a member of 'set' from the signal
+ *   pending list and append it to 'list', all within a single critical
+ *   section entry.  Signals are removed from the lowest numbered signal
+ *   to the highest, matching the order in which they would have been
+ *   removed one at a time.  The signal set is consumed in the process.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SIG_BATCH_DELIVERY
+void nxsig_remove_pendingsignals(FAR struct tcb_s *stcb,
+                                 FAR sigset_t *set,
+                                 FAR sq_queue_t *list)
+{
+  FAR struct task_group_s *group = stcb->group;
+  FAR sigpendq_t *currsig;
+  FAR sigpendq_t *prevsig;
+  irqstate_t flags;
+  int signo;
+
+  DEBUGASSERT(group);
+
+  flags = enter_critical_section();
+
+  while ((signo = nxsig_lowest(set)) != ERROR)
+    {
+      nxsig_delset(set, signo);
+
+      for (prevsig = NULL,
+           currsig = (FAR sigpendq_t *)group->tg_sigpendingq.head;
+           (currsig && currsig->info.si_signo != signo);
+           prevsig = currsig, currsig = currsig->flink);
+
+      if (currsig)
+        {
+          if (prevsig)
+            {
+              sq_remafter((FAR sq_entry_t *)prevsig,
+                          &group->tg_sigpendingq);
+            }
+          else
+            {
+              sq_remfirst(&group->tg_sigpendingq);
+            }
+
+          sq_addlast((FAR sq_entry_t *)currsig, list);
+        }
+    }
+
+  leave_critical_section(flags);
+}
+#endif
@@ -52,7 +52,9 @@ bool nxsig_unmask_pendingsignal(void)
   FAR struct tcb_s *rtcb = this_task();
   sigset_t unmaskedset;
   FAR sigpendq_t *pendingsig;
+#ifndef CONFIG_SIG_BATCH_DELIVERY
   int signo;
+#endif
 
   /* Prohibit any context switches until we are done with this.
    * We may still be performing signal operations from interrupt
@@ -75,6 +77,35 @@ bool nxsig_unmask_pendingsignal(void)
       return false;
     }
 
+#ifdef CONFIG_SIG_BATCH_DELIVERY
+  /* Drain every newly unmasked pending signal from the group's pending
+   * list in a single critical section entry, then queue all of their
+   * actions and arm delivery in another.  Since the pending signals were
+   * unblocked on this thread, we can skip the normal group signal
+   * dispatching rules; there can be no other recipient for the signals
+   * other than this thread.
+   */
+
+    {
+      sq_queue_t pendings;
+
+      sq_init(&pendings);
+      nxsig_remove_pendingsignals(rtcb, &unmaskedset, &pendings);
+
+      if (pendings.head != NULL)
+        {
+          nxsig_queue_actions(rtcb, &pendings);
+
+          /* Then return the pending signal structures to the free list */
+
+          while ((pendingsig =
+                  (FAR sigpendq_t *)sq_remfirst(&pendings)) != NULL)
+            {
+              nxsig_release_pendingsignal(pendingsig);
+            }
+        }
+    }
+#else
   /* Loop while there are unmasked pending signals to be processed. */
 
   do
@@ -113,6 +144,7 @@ bool nxsig_unmask_pendingsignal(void)
         }
     }
   while (!sigisemptyset(&unmaskedset));
+#endif /* CONFIG_SIG_BATCH_DELIVERY */
 
   sched_unlock();
   return true;
@@ -136,6 +136,22 @@ extern sq_queue_t  g_sigpendingsignal;
 
 extern sq_queue_t  g_sigpendingirqsignal;
 
+#ifdef CONFIG_SIG_BATCH_DELIVERY
+/* Depth of each per-CPU cache of pending signal action structures */
+
+#  define SIG_BATCH_POOL_DEPTH 8
+
+/* Per-CPU caches of pending signal action structures.  Each cache is
+ * accessed only from its own CPU with local interrupts disabled; it is
+ * refilled from (and spilled back to) g_sigpendingaction in batches so
+ * that a burst of queued signals costs one critical section entry, not
+ * one per signal.
+ */
+
+extern sq_queue_t  g_sigq_cpupool[CONFIG_SMP_NCPUS];
+extern uint8_t     g_sigq_cpucount[CONFIG_SMP_NCPUS];
+#endif
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
@@ -170,6 +186,10 @@ int                nxsig_tcbdispatch(FAR struct tcb_s *stcb,
                                      FAR siginfo_t *info);
 int                nxsig_dispatch(pid_t pid, FAR siginfo_t *info,
                                   bool thread);
+#ifdef CONFIG_SIG_BATCH_DELIVERY
+int                nxsig_queue_actions(FAR struct tcb_s *stcb,
+                                       FAR sq_queue_t *pending);
+#endif
 
 /* sig_cleanup.c */
 
@@ -193,6 +213,11 @@ void               nxsig_release_pendingsigaction(FAR sigq_t *sigq);
 void               nxsig_release_pendingsignal(FAR sigpendq_t *sigpend);
 FAR sigpendq_t    *nxsig_remove_pendingsignal(FAR struct tcb_s *stcb,
                                               int signo);
+#ifdef CONFIG_SIG_BATCH_DELIVERY
+void               nxsig_remove_pendingsignals(FAR struct tcb_s *stcb,
+                                               FAR sigset_t *set,
+                                               FAR sq_queue_t *list);
+#endif
 bool               nxsig_unmask_pendingsignal(void);
 
 #endif /* __SCHED_SIGNAL_SIGNAL_H */
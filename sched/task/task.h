@@ -62,6 +62,17 @@ int  nxtask_terminate(pid_t pid);
 void nxtask_exithook(FAR struct tcb_s *tcb, int status);
 void nxtask_recover(FAR struct tcb_s *tcb);
 
+/* Deferred task teardown */
+
+#ifdef CONFIG_SCHED_REAPER
+void nxtask_reaper_start(void);
+bool nxtask_reaper_active(void);
+int  nxtask_reap(FAR struct tcb_s *tcb);
+#else
+#  define nxtask_reaper_start()
+#  define nxtask_reaper_active() false
+#endif
+
 /* Cancellation points */
 
 bool nxnotify_cancellation(FAR struct tcb_s *tcb);
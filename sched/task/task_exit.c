@@ -147,7 +147,17 @@ int nxtask_exit(void)
 #endif
 
   dtcb->task_state = TSTATE_TASK_INACTIVE;
+
+#ifdef CONFIG_SCHED_REAPER
+  /* Hand the TCB to the reaper thread so that the heavyweight teardown
+   * (stack free, closing files, group destruction) is not performed here
+   * with pre-emption disabled.
+   */
+
+  ret = nxtask_reap(dtcb);
+#else
   ret = nxsched_release_tcb(dtcb, dtcb->flags & TCB_FLAG_TTYPE_MASK);
+#endif
 
 #ifdef CONFIG_SMP
   rtcb->irqcount--;
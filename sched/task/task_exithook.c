@@ -459,7 +459,18 @@ void nxtask_exithook(FAR struct tcb_s *tcb, int status)
    * status (no zombies here!)
    */
 
-  group_leave(tcb);
+#ifdef CONFIG_SCHED_REAPER
+  /* When the reaper thread is running, leaving the group is deferred to
+   * nxsched_release_tcb() on the reaper thread:  Closing any remaining
+   * open files and destroying the group is the expensive part of task
+   * teardown and need not delay the exiting context.
+   */
+
+  if (!nxtask_reaper_active())
+#endif
+    {
+      group_leave(tcb);
+    }
 
   /* Deallocate anything left in the TCB's queues */
 
@@ -0,0 +1,185 @@
+/****************************************************************************
+ * sched/task/task_reaper.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <assert.h>
+#include <debug.h>
+
+#include <nuttx/irq.h>
+#include <nuttx/kthread.h>
+#include <nuttx/queue.h>
+#include <nuttx/sched.h>
+#include <nuttx/semaphore.h>
+
+#include "sched/sched.h"
+#include "task/task.h"
+
+#ifdef CONFIG_SCHED_REAPER
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* The list of exited tasks awaiting teardown.  An exited TCB is no longer
+ * on any task list, so its list links may be re-used to queue it here.
+ * The list is only manipulated from within a critical section.
+ */
+
+static dq_queue_t g_reaper_queue;
+
+/* Counts the TCBs queued for the reaper */
+
+static sem_t g_reaper_sem = SEM_INITIALIZER(0);
+
+/* The task ID of the reaper kernel thread; zero before it is started */
+
+static pid_t g_reaper_pid;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxtask_reaper
+ *
+ * Description:
+ *   The reaper kernel thread.  Loops forever, releasing the resources of
+ *   exited tasks that were handed off by nxtask_reap().
+ *
+ ****************************************************************************/
+
+static int nxtask_reaper(int argc, FAR char *argv[])
+{
+  FAR struct tcb_s *tcb;
+  irqstate_t flags;
+
+  for (; ; )
+    {
+      /* Wait for a TCB to be queued for teardown */
+
+      nxsem_wait_uninterruptible(&g_reaper_sem);
+
+      /* Release the TCB with interrupts disabled, just as the previous
+       * in-context callers of nxsched_release_tcb() did.  Any waits made
+       * by driver close methods or the memory manager will release the
+       * critical section while this thread is blocked.
+       */
+
+      flags = enter_critical_section();
+      tcb = (FAR struct tcb_s *)dq_remfirst(&g_reaper_queue);
+      if (tcb != NULL)
+        {
+          nxsched_release_tcb(tcb, tcb->flags & TCB_FLAG_TTYPE_MASK);
+        }
+
+      leave_critical_section(flags);
+    }
+
+  return 0; /* To keep some compilers happy */
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxtask_reaper_start
+ *
+ * Description:
+ *   Start the reaper kernel thread.  Called once during OS bring-up.
+ *   Tasks that exit before the reaper is running are torn down in the
+ *   exiting context as before.
+ *
+ ****************************************************************************/
+
+void nxtask_reaper_start(void)
+{
+  pid_t pid;
+
+  pid = kthread_create("reaper", CONFIG_SCHED_REAPER_PRIORITY,
+                       CONFIG_SCHED_REAPER_STACKSIZE,
+                       nxtask_reaper, NULL);
+  DEBUGASSERT(pid > 0);
+  g_reaper_pid = pid;
+}
+
+/****************************************************************************
+ * Name: nxtask_reaper_active
+ *
+ * Description:
+ *   Return true if the reaper thread is running and exited tasks will be
+ *   handed to it for teardown.
+ *
+ ****************************************************************************/
+
+bool nxtask_reaper_active(void)
+{
+  return g_reaper_pid > 0;
+}
+
+/****************************************************************************
+ * Name: nxtask_reap
+ *
+ * Description:
+ *   Hand an exited task to the reaper thread for teardown.  The caller
+ *   must have removed the TCB from all task lists and marked it with
+ *   TCB_FLAG_EXIT_PROCESSING so that no signals or restarts can reach it
+ *   while it awaits teardown.  The heavyweight work -- freeing the stack,
+ *   closing any remaining open files, destroying the task group and
+ *   freeing the TCB -- then runs on the reaper thread so that the cost is
+ *   not paid in the exiting (or deleting) context.
+ *
+ *   If the reaper thread is not yet running, the TCB is released
+ *   immediately as before.
+ *
+ * Input Parameters:
+ *   tcb - The TCB of the exited task
+ *
+ * Returned Value:
+ *   OK on success; ERROR on failure
+ *
+ * Assumptions:
+ *   Interrupts are disabled.
+ *
+ ****************************************************************************/
+
+int nxtask_reap(FAR struct tcb_s *tcb)
+{
+  if (g_reaper_pid <= 0)
+    {
+      /* Early start-up:  The reaper is not running yet */
+
+      return nxsched_release_tcb(tcb, tcb->flags & TCB_FLAG_TTYPE_MASK);
+    }
+
+  dq_addlast((FAR dq_entry_t *)tcb, &g_reaper_queue);
+  nxsem_post(&g_reaper_sem);
+  return OK;
+}
+
+#endif /* CONFIG_SCHED_REAPER */
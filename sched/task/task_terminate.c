@@ -116,6 +116,9 @@ int nxtask_terminate(pid_t pid)
   FAR struct tcb_s *dtcb;
   uint8_t task_state;
   irqstate_t flags;
+#ifdef CONFIG_SCHED_REAPER
+  int ret;
+#endif
 
   flags = enter_critical_section();
 
@@ -188,5 +191,16 @@ int nxtask_terminate(pid_t pid)
 
   /* Deallocate its TCB */
 
+#ifdef CONFIG_SCHED_REAPER
+  /* Defer the heavyweight teardown to the reaper thread rather than
+   * performing it in the context of the task that called task_delete().
+   */
+
+  flags = enter_critical_section();
+  ret = nxtask_reap(dtcb);
+  leave_critical_section(flags);
+  return ret;
+#else
   return nxsched_release_tcb(dtcb, dtcb->flags & TCB_FLAG_TTYPE_MASK);
+#endif
 }
@@ -26,6 +26,8 @@
 
 #include <nuttx/config.h>
 
+#include <stdbool.h>
+
 #include <nuttx/wdog.h>
 #include <nuttx/irq.h>
 
@@ -65,3 +67,83 @@ sclock_t wd_gettime(FAR struct wdog_s *wdog)
 
   return delay < 0 ? 0 : delay;
 }
+
+/****************************************************************************
+ * Name: wd_gettime_next
+ *
+ * Description:
+ *   This function returns the time remaining before the earliest active
+ *   watchdog timer expires, i.e. the time until the next timer driven
+ *   wakeup of the system.  It may be used by power management logic to
+ *   bound the latency of the idle state it selects.
+ *
+ * Input Parameters:
+ *   None.
+ *
+ * Returned Value:
+ *   The time in system ticks remaining until the earliest watchdog timer
+ *   expires.  Zero means that a watchdog has already expired.  A negative
+ *   value means that there is no active watchdog timer.
+ *
+ ****************************************************************************/
+
+sclock_t wd_gettime_next(void)
+{
+#ifdef CONFIG_WDOG_TIMERWHEEL
+  FAR struct list_node *slot;
+  bool found = false;
+  clock_t earliest = 0;
+  int i;
+#endif
+  FAR struct wdog_s *wdog;
+  irqstate_t flags;
+  sclock_t delay;
+
+  flags = enter_critical_section();
+
+#ifdef CONFIG_WDOG_TIMERWHEEL
+  /* The wheel slots are unsorted, so all of them must be visited to find
+   * the earliest expiration.  A slot head that is still NULL belongs to a
+   * wheel that has never held a watchdog and can be skipped.
+   */
+
+  for (i = 0; i < WDOG_WHEEL_SLOTS; i++)
+    {
+      slot = &g_wdwheel[i];
+      if (slot->next == NULL)
+        {
+          continue;
+        }
+
+      list_for_every_entry(slot, wdog, struct wdog_s, node)
+        {
+          if (!found || clock_compare(wdog->expired, earliest))
+            {
+              earliest = wdog->expired;
+              found = true;
+            }
+        }
+    }
+
+  if (!found)
+    {
+      leave_critical_section(flags);
+      return -1;
+    }
+
+  delay = earliest - clock_systime_ticks();
+#else
+  if (list_is_empty(&g_wdactivelist))
+    {
+      leave_critical_section(flags);
+      return -1;
+    }
+
+  wdog  = list_first_entry(&g_wdactivelist, struct wdog_s, node);
+  delay = wdog->expired - clock_systime_ticks();
+#endif
+
+  leave_critical_section(flags);
+
+  return delay < 0 ? 0 : delay;
+}
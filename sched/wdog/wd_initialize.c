@@ -41,6 +41,15 @@
 
 struct list_node g_wdactivelist = LIST_INITIAL_VALUE(g_wdactivelist);
 
+#ifdef CONFIG_WDOG_TIMERWHEEL
+/* The hashed timer wheel slots.  Each slot holds the unsorted list of
+ * watchdogs whose expiration tick hashes to that slot.  The slot lists are
+ * initialized lazily on the first wd_start()/wd_timer() call.
+ */
+
+struct list_node g_wdwheel[WDOG_WHEEL_SLOTS];
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -90,10 +90,46 @@
 static unsigned int g_wdtimernested;
 #endif
 
+#ifdef CONFIG_WDOG_TIMERWHEEL
+/* The last tick whose wheel slot has been processed, and a flag indicating
+ * that the slot lists have been initialized.
+ */
+
+static clock_t g_wdwheel_tick;
+static bool g_wdwheel_ready;
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
+#ifdef CONFIG_WDOG_TIMERWHEEL
+/****************************************************************************
+ * Name: wd_wheel_init
+ *
+ * Description:
+ *   One-time lazy initialization of the timer wheel slot lists.  Performed
+ *   on the first insertion or expiration, inside the critical section.
+ *
+ ****************************************************************************/
+
+static void wd_wheel_init(clock_t ticks)
+{
+  int i;
+
+  if (!g_wdwheel_ready)
+    {
+      for (i = 0; i < WDOG_WHEEL_SLOTS; i++)
+        {
+          list_initialize(&g_wdwheel[i]);
+        }
+
+      g_wdwheel_tick  = ticks;
+      g_wdwheel_ready = true;
+    }
+}
+#endif
+
 /****************************************************************************
  * Name: wd_expiration
  *
@@ -109,6 +145,75 @@ static unsigned int g_wdtimernested;
  *
  ****************************************************************************/
 
+#ifdef CONFIG_WDOG_TIMERWHEEL
+static inline_function void wd_expiration(clock_t ticks)
+{
+  struct list_node expired = LIST_INITIAL_VALUE(expired);
+  FAR struct list_node *slot;
+  FAR struct wdog_s *wdog;
+  FAR struct wdog_s *next;
+  irqstate_t flags;
+  wdentry_t func;
+  clock_t tick;
+
+  flags = enter_critical_section();
+
+  wd_wheel_init(ticks);
+
+  /* Visit the slot of every tick in (g_wdwheel_tick, ticks].  If more than
+   * a full wheel revolution has elapsed, then one pass over all of the
+   * slots is sufficient.
+   */
+
+  if (ticks - g_wdwheel_tick > WDOG_WHEEL_SLOTS)
+    {
+      g_wdwheel_tick = ticks - WDOG_WHEEL_SLOTS;
+    }
+
+  for (tick = g_wdwheel_tick + 1; clock_compare(tick, ticks); tick++)
+    {
+      slot = &g_wdwheel[WDOG_WHEEL_SLOT(tick)];
+
+      /* Move every expired watchdog in this slot to the local list first
+       * so that callbacks may freely start or cancel other watchdogs
+       * without disturbing the slot iteration.  Entries that hashed here
+       * from a future wheel revolution simply remain in the slot.
+       */
+
+      list_for_every_entry_safe(slot, wdog, next, struct wdog_s, node)
+        {
+          if (clock_compare(wdog->expired, ticks))
+            {
+              list_delete(&wdog->node);
+              list_add_tail(&expired, &wdog->node);
+            }
+        }
+
+      /* Now execute the expired watchdog functions */
+
+      while (!list_is_empty(&expired))
+        {
+          wdog = list_first_entry(&expired, struct wdog_s, node);
+          list_delete(&wdog->node);
+
+          /* Indicate that the watchdog is no longer active. */
+
+          func = wdog->func;
+          wdog->func = NULL;
+
+          /* Execute the watchdog function */
+
+          up_setpicbase(wdog->picbase);
+          CALL_FUNC(func, wdog->arg);
+        }
+    }
+
+  g_wdwheel_tick = ticks;
+  leave_critical_section(flags);
+}
+
+#else /* CONFIG_WDOG_TIMERWHEEL */
+
 static inline_function void wd_expiration(clock_t ticks)
 {
   FAR struct wdog_s *wdog;
@@ -164,6 +269,8 @@ static inline_function void wd_expiration(clock_t ticks)
   leave_critical_section(flags);
 }
 
+#endif /* CONFIG_WDOG_TIMERWHEEL */
+
 /****************************************************************************
  * Name: wd_insert
  *
@@ -185,6 +292,26 @@ static inline_function void wd_expiration(clock_t ticks)
  *
  ****************************************************************************/
 
+#ifdef CONFIG_WDOG_TIMERWHEEL
+static inline_function
+void wd_insert(FAR struct wdog_s *wdog, clock_t expired,
+               wdentry_t wdentry, wdparm_t arg)
+{
+  /* Hash the expiration tick to its wheel slot.  No ordering within the
+   * slot is maintained so insertion is O(1).
+   */
+
+  wd_wheel_init(clock_systime_ticks());
+  list_add_tail(&g_wdwheel[WDOG_WHEEL_SLOT(expired)], &wdog->node);
+
+  wdog->func = wdentry;
+  up_getpicbase(&wdog->picbase);
+  wdog->arg = arg;
+  wdog->expired = expired;
+}
+
+#else /* CONFIG_WDOG_TIMERWHEEL */
+
 static inline_function
 void wd_insert(FAR struct wdog_s *wdog, clock_t expired,
                wdentry_t wdentry, wdparm_t arg)
@@ -218,6 +345,8 @@ void wd_insert(FAR struct wdog_s *wdog, clock_t expired,
   wdog->expired = expired;
 }
 
+#endif /* CONFIG_WDOG_TIMERWHEEL */
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
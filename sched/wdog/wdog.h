@@ -65,6 +65,19 @@ extern "C"
 
 extern struct list_node g_wdactivelist;
 
+#ifdef CONFIG_WDOG_TIMERWHEEL
+/* When the hashed timer wheel is selected, active watchdogs are kept in
+ * unsorted per-slot lists hashed by expiration tick instead of the single
+ * sorted g_wdactivelist.  Insertion and cancellation are then O(1); each
+ * timer tick visits exactly one slot.
+ */
+
+#  define WDOG_WHEEL_SLOTS  CONFIG_WDOG_TIMERWHEEL_SLOTS
+#  define WDOG_WHEEL_SLOT(t) ((t) & (WDOG_WHEEL_SLOTS - 1))
+
+extern struct list_node g_wdwheel[WDOG_WHEEL_SLOTS];
+#endif
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
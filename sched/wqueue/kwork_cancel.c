@@ -71,10 +71,15 @@ static int work_qcancel(FAR struct kwork_wqueue_s *wqueue, bool sync,
         }
       else
         {
+#ifdef CONFIG_SCHED_WORKQUEUE_PERCPU
+          dq_rem((FAR dq_entry_t *)work, &wqueue->cpuq[work->cpu]);
+#else
           dq_rem((FAR dq_entry_t *)work, &wqueue->q);
+#endif
         }
 
       work->worker = NULL;
+      wqueue->nwork--;
       ret = OK;
     }
   else if (!up_interrupt_context() && !sched_idletask() && sync)
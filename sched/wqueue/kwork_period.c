@@ -0,0 +1,349 @@
+/****************************************************************************
+ * sched/wqueue/kwork_period.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <assert.h>
+#include <errno.h>
+
+#include <nuttx/irq.h>
+#include <nuttx/clock.h>
+#include <nuttx/nuttx.h>
+#include <nuttx/queue.h>
+#include <nuttx/wqueue.h>
+
+#include "wqueue/wqueue.h"
+
+#ifdef CONFIG_SCHED_WORKQUEUE_PERIODIC
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+static void work_period_expiry(wdparm_t arg);
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: work_period_insert
+ *
+ * Description:
+ *   Insert a periodic work entry into the work queue's deadline-ordered
+ *   list.  Called with interrupts disabled.
+ *
+ ****************************************************************************/
+
+static void work_period_insert(FAR struct kwork_wqueue_s *wqueue,
+                               FAR struct work_period_s *pwork)
+{
+  FAR dq_entry_t *curr;
+
+  for (curr = dq_peek(&wqueue->pq); curr != NULL; curr = dq_next(curr))
+    {
+      FAR struct work_period_s *other =
+        container_of(curr, struct work_period_s, node);
+
+      if ((sclock_t)(other->deadline - pwork->deadline) > 0)
+        {
+          break;
+        }
+    }
+
+  if (curr != NULL)
+    {
+      dq_addbefore(curr, &pwork->node, &wqueue->pq);
+    }
+  else
+    {
+      dq_addlast(&pwork->node, &wqueue->pq);
+    }
+}
+
+/****************************************************************************
+ * Name: work_period_rearm
+ *
+ * Description:
+ *   Arm the work queue's shared periodic timer for the earliest deadline
+ *   on the list, or stop it if the list is empty.  Called with interrupts
+ *   disabled.
+ *
+ ****************************************************************************/
+
+static void work_period_rearm(FAR struct kwork_wqueue_s *wqueue)
+{
+  FAR dq_entry_t *head = dq_peek(&wqueue->pq);
+
+  if (head != NULL)
+    {
+      FAR struct work_period_s *pwork =
+        container_of(head, struct work_period_s, node);
+
+      /* Let the timer fire up to the coalescing tolerance after the
+       * earliest deadline so that deadlines that fall within the
+       * tolerance of each other are expired by a single wakeup.
+       */
+
+      wd_start_abstick(&wqueue->ptimer,
+                       pwork->deadline +
+                       CONFIG_SCHED_WORKQUEUE_PERIODIC_TOLERANCE,
+                       work_period_expiry, (wdparm_t)wqueue);
+    }
+  else
+    {
+      wd_cancel(&wqueue->ptimer);
+    }
+}
+
+/****************************************************************************
+ * Name: work_period_expiry
+ *
+ * Description:
+ *   The shared periodic timer of one work queue has expired.  Queue every
+ *   item whose deadline has been reached, advance those items to their
+ *   next deadline, and re-arm the timer for the new earliest deadline.
+ *
+ ****************************************************************************/
+
+static void work_period_expiry(wdparm_t arg)
+{
+  FAR struct kwork_wqueue_s *wqueue = (FAR struct kwork_wqueue_s *)arg;
+  FAR struct work_period_s *pwork;
+  FAR dq_entry_t *head;
+  clock_t now = clock_systime_ticks();
+  irqstate_t flags = enter_critical_section();
+
+  /* The timer fires up to the coalescing tolerance after the earliest
+   * deadline, so every item whose deadline fell within the tolerance is
+   * expired here, batched into this single worker wakeup.
+   */
+
+  while ((head = dq_peek(&wqueue->pq)) != NULL)
+    {
+      pwork = container_of(head, struct work_period_s, node);
+      if ((sclock_t)(pwork->deadline - now) > 0)
+        {
+          break;
+        }
+
+      dq_remfirst(&wqueue->pq);
+
+      /* Advance to the next deadline.  Skip any periods that were missed
+       * entirely so that the phase is preserved without queueing a
+       * backlog.
+       */
+
+      do
+        {
+          pwork->deadline += pwork->period;
+        }
+      while ((sclock_t)(pwork->deadline - now) <= 0);
+
+      work_period_insert(wqueue, pwork);
+
+      /* Queue the work for execution.  If the previous period's instance
+       * is still pending it is simply re-queued and will run only once.
+       */
+
+      work_queue_wq(wqueue, &pwork->work, pwork->worker, pwork->arg, 0);
+    }
+
+  work_period_rearm(wqueue);
+  leave_critical_section(flags);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: work_queue_period/work_queue_period_wq
+ *
+ * Description:
+ *   Queue periodic work.  The worker callback is invoked on the worker
+ *   thread of execution every 'period' clock ticks until the work is
+ *   cancelled with work_cancel_period().  All periodic work of one work
+ *   queue is driven by a single watchdog timer and items whose deadlines
+ *   fall within CONFIG_SCHED_WORKQUEUE_PERIODIC_TOLERANCE ticks of each
+ *   other are expired in the same worker wakeup.
+ *
+ * Input Parameters:
+ *   qid    - The work queue ID (must be HPWORK or LPWORK)
+ *   wqueue - The work queue handle
+ *   pwork  - The periodic work structure to queue
+ *   worker - The worker callback to be invoked.  The callback will be
+ *            invoked on the worker thread of execution.
+ *   arg    - The argument that will be passed to the worker callback when
+ *            it is invoked.
+ *   delay  - Delay (in clock ticks) until the first invocation.  Zero
+ *            means to perform the work immediately.
+ *   period - Interval (in clock ticks) between invocations.  Must be
+ *            greater than zero.
+ *
+ * Returned Value:
+ *   Zero on success, a negated errno on failure
+ *
+ ****************************************************************************/
+
+int work_queue_period_wq(FAR struct kwork_wqueue_s *wqueue,
+                         FAR struct work_period_s *pwork, worker_t worker,
+                         FAR void *arg, clock_t delay, clock_t period)
+{
+  irqstate_t flags;
+  clock_t now;
+
+  if (wqueue == NULL || pwork == NULL || worker == NULL || period == 0)
+    {
+      return -EINVAL;
+    }
+
+  /* Interrupts are disabled so that this logic can be called from with
+   * task logic or from interrupt handling logic.
+   */
+
+  flags = enter_critical_section();
+
+  /* Requeueing active periodic work replaces its period and phase */
+
+  if (pwork->wq != NULL)
+    {
+      FAR struct kwork_wqueue_s *oldwq = pwork->wq;
+
+      dq_rem(&pwork->node, &oldwq->pq);
+      if (oldwq != wqueue)
+        {
+          work_period_rearm(oldwq);
+        }
+    }
+
+  pwork->worker = worker;
+  pwork->arg    = arg;
+  pwork->wq     = wqueue;
+  pwork->period = period;
+
+  now = clock_systime_ticks();
+  if (delay == 0)
+    {
+      /* Perform the first invocation immediately */
+
+      pwork->deadline = now + period;
+      work_queue_wq(wqueue, &pwork->work, worker, arg, 0);
+    }
+  else
+    {
+      pwork->deadline = now + delay;
+    }
+
+  work_period_insert(wqueue, pwork);
+
+  /* Re-arm the shared timer if this work is the new earliest deadline */
+
+  if (dq_peek(&wqueue->pq) == &pwork->node)
+    {
+      work_period_rearm(wqueue);
+    }
+
+  leave_critical_section(flags);
+  return OK;
+}
+
+int work_queue_period(int qid, FAR struct work_period_s *pwork,
+                      worker_t worker, FAR void *arg, clock_t delay,
+                      clock_t period)
+{
+  return work_queue_period_wq(work_qid2wq(qid), pwork, worker, arg,
+                              delay, period);
+}
+
+/****************************************************************************
+ * Name: work_cancel_period/work_cancel_period_wq
+ *
+ * Description:
+ *   Cancel previously queued periodic work.  This stops the period and
+ *   removes any instance of the work that is pending on the work queue.
+ *   After the work has been cancelled, it may be requeued by calling
+ *   work_queue_period() again.
+ *
+ * Input Parameters:
+ *   qid    - The work queue ID (must be HPWORK or LPWORK)
+ *   wqueue - The work queue handle
+ *   pwork  - The previously queued periodic work structure to cancel
+ *
+ * Returned Value:
+ *   Zero on success, a negated errno on failure
+ *
+ *   -ENOENT - There is no such work queued.
+ *   -EINVAL - An invalid work queue was specified
+ *
+ ****************************************************************************/
+
+int work_cancel_period_wq(FAR struct kwork_wqueue_s *wqueue,
+                          FAR struct work_period_s *pwork)
+{
+  irqstate_t flags;
+  int ret = -ENOENT;
+
+  if (wqueue == NULL || pwork == NULL)
+    {
+      return -EINVAL;
+    }
+
+  flags = enter_critical_section();
+
+  if (pwork->wq == wqueue)
+    {
+      bool washead = (dq_peek(&wqueue->pq) == &pwork->node);
+
+      dq_rem(&pwork->node, &wqueue->pq);
+      pwork->wq = NULL;
+
+      /* Remove any instance that is already queued for execution */
+
+      if (pwork->work.worker != NULL)
+        {
+          work_cancel_wq(wqueue, &pwork->work);
+        }
+
+      if (washead)
+        {
+          work_period_rearm(wqueue);
+        }
+
+      ret = OK;
+    }
+
+  leave_critical_section(flags);
+  return ret;
+}
+
+int work_cancel_period(int qid, FAR struct work_period_s *pwork)
+{
+  return work_cancel_period_wq(work_qid2wq(qid), pwork);
+}
+
+#endif /* CONFIG_SCHED_WORKQUEUE_PERIODIC */
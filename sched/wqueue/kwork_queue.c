@@ -44,6 +44,25 @@
  * Pre-processor Definitions
  ****************************************************************************/
 
+#ifdef CONFIG_SCHED_WORKQUEUE_PERCPU
+/* Queue the work on the submitting CPU's sub-queue so that concurrent
+ * submitters do not contend for a single queue head.
+ */
+
+#define queue_work(wqueue, work) \
+  do \
+    { \
+      int sem_count; \
+      (work)->cpu = this_cpu(); \
+      dq_addlast((FAR dq_entry_t *)(work), &(wqueue)->cpuq[(work)->cpu]); \
+      nxsem_get_value(&(wqueue)->sem, &sem_count); \
+      if (sem_count < 0) /* There are threads waiting for sem. */ \
+        { \
+          nxsem_post(&(wqueue)->sem); \
+        } \
+    } \
+  while (0)
+#else
 #define queue_work(wqueue, work) \
   do \
     { \
@@ -56,6 +75,7 @@
         } \
     } \
   while (0)
+#endif
 
 /****************************************************************************
  * Private Functions
@@ -159,6 +179,19 @@ int work_queue_wq(FAR struct kwork_wqueue_s *wqueue,
       goto out;
     }
 
+  /* If the work queue is bounded, then refuse new work when the bound
+   * has been reached.  Delayed work counts against the bound from the
+   * time it is submitted, not from the time its delay elapses.
+   */
+
+  if (wqueue->maxwork > 0 && wqueue->nwork >= wqueue->maxwork)
+    {
+      ret = -EBUSY;
+      goto out;
+    }
+
+  wqueue->nwork++;
+
   /* Initialize the work structure. */
 
   work->worker = worker;           /* Work callback. non-NULL means queued */
@@ -108,6 +108,36 @@ struct lp_wqueue_s g_lpwork =
  * Private Functions
  ****************************************************************************/
 
+#ifdef CONFIG_SCHED_WORKQUEUE_PERCPU
+/****************************************************************************
+ * Name: work_remfirst
+ *
+ * Description:
+ *   Remove the next work item to execute.  The calling CPU's sub-queue is
+ *   drained first; when it is empty the worker steals from the sub-queues
+ *   of the other CPUs so that no queued work is stranded.
+ *
+ ****************************************************************************/
+
+static FAR struct work_s *work_remfirst(FAR struct kwork_wqueue_s *wqueue)
+{
+  FAR struct work_s *work;
+  int me = this_cpu();
+  int cpu;
+
+  work = (FAR struct work_s *)dq_remfirst(&wqueue->cpuq[me]);
+  for (cpu = 0; work == NULL && cpu < CONFIG_SMP_NCPUS; cpu++)
+    {
+      if (cpu != me)
+        {
+          work = (FAR struct work_s *)dq_remfirst(&wqueue->cpuq[cpu]);
+        }
+    }
+
+  return work;
+}
+#endif
+
 /****************************************************************************
  * Name: work_thread
  *
@@ -160,8 +190,16 @@ static int work_thread(int argc, FAR char *argv[])
 
       /* Remove the ready-to-execute work from the list */
 
+#ifdef CONFIG_SCHED_WORKQUEUE_PERCPU
+      while ((work = work_remfirst(wqueue)) != NULL)
+#else
       while ((work = (FAR struct work_s *)dq_remfirst(&wqueue->q)) != NULL)
+#endif
         {
+          /* The work is no longer pending against the queue bound */
+
+          wqueue->nwork--;
+
           if (work->worker == NULL)
             {
               continue;
@@ -388,6 +426,10 @@ int work_queue_free(FAR struct kwork_wqueue_s *wqueue)
       nxsem_wait_uninterruptible(&wqueue->exsem);
     }
 
+#ifdef CONFIG_SCHED_WORKQUEUE_PERIODIC
+  wd_cancel(&wqueue->ptimer);
+#endif
+
   nxsem_destroy(&wqueue->sem);
   nxsem_destroy(&wqueue->exsem);
   kmm_free(wqueue);
@@ -435,6 +477,92 @@ int work_queue_priority(int qid)
   return work_queue_priority_wq(work_qid2wq(qid));
 }
 
+/****************************************************************************
+ * Name: work_queue_set_maxwork_wq
+ *
+ * Description:
+ *   Bound the number of works that may be pending on the work queue at
+ *   any time.  When the bound is reached, work_queue() fails with -EBUSY
+ *   rather than queueing further work.  Delayed work counts against the
+ *   bound from the time that it is submitted.
+ *
+ * Input Parameters:
+ *   wqueue  - The work queue handle
+ *   maxwork - The maximum number of pending works, or zero to remove the
+ *             bound.
+ *
+ * Returned Value:
+ *   Zero on success, a negated errno value on failure.
+ *
+ ****************************************************************************/
+
+int work_queue_set_maxwork_wq(FAR struct kwork_wqueue_s *wqueue, int maxwork)
+{
+  irqstate_t flags;
+
+  if (wqueue == NULL || maxwork < 0 || maxwork > INT16_MAX)
+    {
+      return -EINVAL;
+    }
+
+  flags = enter_critical_section();
+  wqueue->maxwork = maxwork;
+  leave_critical_section(flags);
+
+  return OK;
+}
+
+int work_queue_set_maxwork(int qid, int maxwork)
+{
+  return work_queue_set_maxwork_wq(work_qid2wq(qid), maxwork);
+}
+
+#ifdef CONFIG_SMP
+/****************************************************************************
+ * Name: work_queue_set_affinity_wq
+ *
+ * Description:
+ *   Set the CPU affinity mask of every worker thread of the work queue.
+ *
+ * Input Parameters:
+ *   wqueue   - The work queue handle
+ *   affinity - The set of CPUs on which the workers may run
+ *
+ * Returned Value:
+ *   Zero on success, a negated errno value on failure.
+ *
+ ****************************************************************************/
+
+int work_queue_set_affinity_wq(FAR struct kwork_wqueue_s *wqueue,
+                               FAR const cpu_set_t *affinity)
+{
+  int wndx;
+  int ret;
+
+  if (wqueue == NULL || affinity == NULL || *affinity == 0)
+    {
+      return -EINVAL;
+    }
+
+  for (wndx = 0; wndx < wqueue->nthreads; wndx++)
+    {
+      ret = nxsched_set_affinity(wqueue->worker[wndx].pid,
+                                 sizeof(cpu_set_t), affinity);
+      if (ret < 0)
+        {
+          return ret;
+        }
+    }
+
+  return OK;
+}
+
+int work_queue_set_affinity(int qid, FAR const cpu_set_t *affinity)
+{
+  return work_queue_set_affinity_wq(work_qid2wq(qid), affinity);
+}
+#endif /* CONFIG_SMP */
+
 /****************************************************************************
  * Name: work_start_highpri
  *
@@ -69,6 +69,15 @@ struct kwork_wqueue_s
   sem_t             exsem;     /* Sync waiting for thread exit */
   uint8_t           nthreads;  /* Number of worker threads */
   bool              exit;      /* A flag to request the thread to exit */
+  int16_t           nwork;     /* Number of queued (or delayed) works */
+  int16_t           maxwork;   /* Upper bound on nwork, 0 if unbounded */
+#ifdef CONFIG_SCHED_WORKQUEUE_PERCPU
+  struct dq_queue_s cpuq[CONFIG_SMP_NCPUS]; /* Per-CPU submission queues */
+#endif
+#ifdef CONFIG_SCHED_WORKQUEUE_PERIODIC
+  struct dq_queue_s pq;        /* Periodic work ordered by deadline */
+  struct wdog_s     ptimer;    /* Expires at the earliest deadline */
+#endif
   struct kworker_s  worker[0]; /* Describes a worker thread */
 };
 
@@ -84,6 +93,15 @@ struct hp_wqueue_s
   sem_t             exsem;     /* Sync waiting for thread exit */
   uint8_t           nthreads;  /* Number of worker threads */
   bool              exit;      /* A flag to request the thread to exit */
+  int16_t           nwork;     /* Number of queued (or delayed) works */
+  int16_t           maxwork;   /* Upper bound on nwork, 0 if unbounded */
+#ifdef CONFIG_SCHED_WORKQUEUE_PERCPU
+  struct dq_queue_s cpuq[CONFIG_SMP_NCPUS]; /* Per-CPU submission queues */
+#endif
+#ifdef CONFIG_SCHED_WORKQUEUE_PERIODIC
+  struct dq_queue_s pq;        /* Periodic work ordered by deadline */
+  struct wdog_s     ptimer;    /* Expires at the earliest deadline */
+#endif
 
   /* Describes each thread in the high priority queue's thread pool */
 
@@ -103,6 +121,15 @@ struct lp_wqueue_s
   sem_t             exsem;     /* Sync waiting for thread exit */
   uint8_t           nthreads;  /* Number of worker threads */
   bool              exit;      /* A flag to request the thread to exit */
+  int16_t           nwork;     /* Number of queued (or delayed) works */
+  int16_t           maxwork;   /* Upper bound on nwork, 0 if unbounded */
+#ifdef CONFIG_SCHED_WORKQUEUE_PERCPU
+  struct dq_queue_s cpuq[CONFIG_SMP_NCPUS]; /* Per-CPU submission queues */
+#endif
+#ifdef CONFIG_SCHED_WORKQUEUE_PERIODIC
+  struct dq_queue_s pq;        /* Periodic work ordered by deadline */
+  struct wdog_s     ptimer;    /* Expires at the earliest deadline */
+#endif
 
   /* Describes each thread in the low priority queue's thread pool */
 
@@ -25,6 +25,7 @@
  ****************************************************************************/
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -45,6 +46,12 @@
  * Private Types
  ****************************************************************************/
 
+struct csventry_s
+{
+  char *line;
+  uint32_t hash;
+};
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -52,6 +59,9 @@
 static const char *g_hdrfiles[MAX_HEADER_FILES];
 static int nhdrfiles;
 
+static struct csventry_s *g_entries;
+static int g_nentries;
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -61,7 +71,8 @@ static void show_usage(const char *progname)
   fprintf(stderr,
     "USAGE:\n");
   fprintf(stderr,
-    "%s [-d] <cvs-file> <symtab-file> [<symtab-name> [<nsymbols-name>]]\n\n",
+    "%s [-d] [-g] <cvs-file> <symtab-file> "
+    "[<symtab-name> [<nsymbols-name>]]\n\n",
     progname);
   fprintf(stderr,
     "Where:\n\n");
@@ -81,6 +92,10 @@ static void show_usage(const char *progname)
     "                   Default: \"%s\"\n", NSYMBOLS_NAME);
   fprintf(stderr,
     "  -d              : Enable debug output\n");
+  fprintf(stderr,
+    "  -g              : Order the symbol table by the GNU hash of the\n");
+  fprintf(stderr,
+    "                    symbol name (CONFIG_SYMTAB_ORDEREDBYHASH)\n");
   exit(EXIT_FAILURE);
 }
 
@@ -118,6 +133,49 @@ static void add_hdrfile(const char *hdrfile)
     }
 }
 
+/* The same hash used by the GNU dynamic linker (dl_new_hash) and by
+ * symtab_hash() in libs/libc/symtab at runtime.
+ */
+
+static uint32_t hash_name(const char *name)
+{
+  uint32_t hash = 5381;
+
+  while (*name != '\0')
+    {
+      hash = hash * 33 + (unsigned char)*name++;
+    }
+
+  return hash;
+}
+
+static void add_csvline(const char *line, uint32_t hash)
+{
+  if ((g_nentries & 63) == 0)
+    {
+      g_entries = realloc(g_entries,
+                          (g_nentries + 64) * sizeof(struct csventry_s));
+      if (!g_entries)
+        {
+          fprintf(stderr, "ERROR:  Failed to allocate entry memory\n");
+          exit(EXIT_FAILURE);
+        }
+    }
+
+  g_entries[g_nentries].line = strdup(line);
+  g_entries[g_nentries].hash = hash;
+  g_nentries++;
+}
+
+static int compare_hash(const void *arg1, const void *arg2)
+{
+  const struct csventry_s *entry1 = arg1;
+  const struct csventry_s *entry2 = arg2;
+
+  return entry1->hash < entry2->hash ? -1 :
+         entry1->hash > entry2->hash ? 1 : 0;
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -133,6 +191,7 @@ int main(int argc, char **argv, char **envp)
   char *ptr;
   bool cond;
   bool parm1;
+  bool hashorder;
   FILE *instream;
   FILE *outstream;
   int ch;
@@ -140,11 +199,12 @@ int main(int argc, char **argv, char **envp)
 
   /* Parse command line options */
 
-  symtab   = SYMTAB_NAME;
-  nsymbols = NSYMBOLS_NAME;
-  g_debug  = false;
+  symtab    = SYMTAB_NAME;
+  nsymbols  = NSYMBOLS_NAME;
+  g_debug   = false;
+  hashorder = false;
 
-  while ((ch = getopt(argc, argv, ":d")) > 0)
+  while ((ch = getopt(argc, argv, ":dg")) > 0)
     {
       switch (ch)
         {
@@ -152,6 +212,10 @@ int main(int argc, char **argv, char **envp)
             g_debug = true;
             break;
 
+          case 'g' :
+            hashorder = true;
+            break;
+
           case '?' :
             fprintf(stderr, "Unrecognized option: %c\n", optopt);
             show_usage(argv[0]);
@@ -220,7 +284,7 @@ int main(int argc, char **argv, char **envp)
       exit(EXIT_FAILURE);
     }
 
-  /* Get all of the header files that we need to include */
+  /* Collect all of the lines and the header files we need to include */
 
   while ((ptr = read_line(instream)) != NULL)
     {
@@ -236,11 +300,22 @@ int main(int argc, char **argv, char **envp)
       /* Add the header file to the list of header files we need to include */
 
       add_hdrfile(g_parm[HEADER_INDEX]);
+
+      /* Remember the line itself for the second pass */
+
+      add_csvline(ptr, hash_name(g_parm[NAME_INDEX]));
     }
 
-  /* Back to the beginning */
+  /* If hash ordering was requested, sort the entries by the hash of the
+   * symbol name so that symtab_findbyname() can binary search on the hash
+   * at runtime.  The sort order survives entries that are compiled out by
+   * their conditionals, unlike a precomputed bucket index would.
+   */
 
-  rewind(instream);
+  if (hashorder)
+    {
+      qsort(g_entries, g_nentries, sizeof(struct csventry_s), compare_hash);
+    }
 
   /* Output up-front file boilerplate */
 
@@ -267,10 +342,12 @@ int main(int argc, char **argv, char **envp)
   nextterm  = "";
   finalterm = "";
 
-  while ((ptr = read_line(instream)) != NULL)
+  for (i = 0; i < g_nentries; i++)
     {
       /* Parse the line from the CVS file */
 
+      ptr = g_entries[i].line;
+
       g_parm[NAME_INDEX][0] = 0;
       g_parm[HEADER_INDEX][0] = 0;
       g_parm[COND_INDEX][0] = 0;
@@ -197,6 +197,13 @@ static void generate_proxy(int nfixed, int nparms)
 
   fprintf(stream, "/* Auto-generated %s proxy file -- do not edit */\n\n",
           g_parm[NAME_INDEX]);
+
+  /* Let the header files know that they are being included by a proxy so
+   * that any inline trampoline definition of this function is suppressed
+   * (see include/nuttx/syscall_inline.h).
+   */
+
+  fprintf(stream, "#define __SYSCALL_PROXY_BUILD__ 1\n");
   fprintf(stream, "#include <nuttx/config.h>\n");
 
   /* Does this function have a variable number of parameters?  If so then the
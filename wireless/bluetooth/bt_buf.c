@@ -77,6 +77,12 @@
 #  define CONFIG_BLUETOOTH_BUFFER_IRQRESERVE CONFIG_BLUETOOTH_BUFFER_PREALLOC
 #endif
 
+#if !defined(CONFIG_BLUETOOTH_FRAME_PREALLOC) || \
+    CONFIG_BLUETOOTH_FRAME_PREALLOC < 0
+#  undef CONFIG_BLUETOOTH_FRAME_PREALLOC
+#  define CONFIG_BLUETOOTH_FRAME_PREALLOC 0
+#endif
+
 /* Memory Pools */
 
 #define POOL_BUFFER_GENERAL  0
@@ -108,6 +114,20 @@ static struct bt_buf_s *g_buf_free_irq;
 static struct bt_buf_s
 g_buf_pool[CONFIG_BLUETOOTH_BUFFER_PREALLOC];
 
+#if CONFIG_BLUETOOTH_FRAME_PREALLOC > 0
+/* Pool of frame buffers reserved for the exclusive use of the Bluetooth
+ * stack.  While this pool is not empty, frames for internally allocated
+ * buffers are taken from here instead of from the common IOB pool so that
+ * ACL traffic does not compete with the network stack for IOBs.
+ */
+
+static struct iob_s g_frame_pool[CONFIG_BLUETOOTH_FRAME_PREALLOC];
+
+/* g_frame_free is the list of frame buffers available for use */
+
+static FAR struct iob_s *g_frame_free;
+#endif
+
 static bool g_poolinit = false;
 
 /****************************************************************************
@@ -191,6 +211,23 @@ void bt_buf_initialize(void)
       remaining--;
     }
 #endif
+
+#if CONFIG_BLUETOOTH_FRAME_PREALLOC > 0
+  /* Initialize g_frame_free, the list of frame buffers that are available
+   * for use by the Bluetooth stack.
+   */
+
+  g_frame_free = NULL;
+  for (remaining = 0;
+       remaining < CONFIG_BLUETOOTH_FRAME_PREALLOC;
+       remaining++)
+    {
+      FAR struct iob_s *frame = &g_frame_pool[remaining];
+
+      frame->io_flink = g_frame_free;
+      g_frame_free    = frame;
+    }
+#endif
 }
 
 /****************************************************************************
@@ -339,13 +376,35 @@ FAR struct bt_buf_s *bt_buf_alloc(enum bt_buf_type_e type,
     }
   else
     {
-      /* No.. Allocate an IOB to hold the actual frame data.  This call will
-       * normally block in the event that there is no available IOB memory.
-       * It will return NULL is called from an interrupt handler with no
-       * available buffers.
+#if CONFIG_BLUETOOTH_FRAME_PREALLOC > 0
+      /* Try the dedicated frame pool first so that Bluetooth traffic does
+       * not compete with the network stack for IOBs.
        */
 
-      buf->frame = iob_alloc(false);
+      flags = spin_lock_irqsave(NULL);
+      if (g_frame_free != NULL)
+        {
+          buf->frame      = g_frame_free;
+          g_frame_free    = buf->frame->io_flink;
+          buf->fpool      = 1;
+
+          buf->frame->io_flink = NULL;
+        }
+
+      spin_unlock_irqrestore(NULL, flags);
+
+      if (buf->frame == NULL)
+#endif
+        {
+          /* Allocate an IOB to hold the actual frame data.  This call
+           * will normally block in the event that there is no available
+           * IOB memory.  It will return NULL is called from an interrupt
+           * handler with no available buffers.
+           */
+
+          buf->frame = iob_alloc(false);
+        }
+
       if (!buf->frame)
         {
           wlerr("ERROR:  Failed to allocate an IOB\n");
@@ -410,7 +469,22 @@ void bt_buf_release(FAR struct bt_buf_s *buf)
 
   if (buf->frame != NULL)
     {
-      iob_free(buf->frame);
+#if CONFIG_BLUETOOTH_FRAME_PREALLOC > 0
+      if (buf->fpool != 0)
+        {
+          /* The frame came from the dedicated pool; put it back there */
+
+          flags                = spin_lock_irqsave(NULL);
+          buf->frame->io_flink = g_frame_free;
+          g_frame_free         = buf->frame;
+          spin_unlock_irqrestore(NULL, flags);
+        }
+      else
+#endif
+        {
+          iob_free(buf->frame);
+        }
+
       buf->frame = NULL;
     }
 
@@ -489,6 +563,71 @@ void bt_buf_release(FAR struct bt_buf_s *buf)
 #endif
 }
 
+/****************************************************************************
+ * Name: bt_buf_detach_frame
+ *
+ * Description:
+ *   Detach the frame from a buffer structure so that it can be handed to
+ *   logic, such as the network layer, that will eventually dispose of it
+ *   with iob_free().  If the frame came from the dedicated frame pool, the
+ *   data is transferred to a freshly allocated IOB and the pool frame is
+ *   returned to the pool; pool frames themselves must never be passed to
+ *   iob_free().
+ *
+ * Input Parameters:
+ *   buf - Buffer to detach the frame from
+ *
+ * Returned Value:
+ *   A reference to an IOB holding the frame data with io_len, io_pktlen,
+ *   and io_offset matching the buffer state.  On success the buffer no
+ *   longer references a frame.  NULL is returned if no IOB was available
+ *   for the transfer; the buffer is unmodified in that case.
+ *
+ ****************************************************************************/
+
+FAR struct iob_s *bt_buf_detach_frame(FAR struct bt_buf_s *buf)
+{
+  FAR struct iob_s *frame = buf->frame;
+  unsigned int offset;
+
+  DEBUGASSERT(frame != NULL);
+  offset = (unsigned int)((uintptr_t)buf->data -
+                          (uintptr_t)frame->io_data);
+
+#if CONFIG_BLUETOOTH_FRAME_PREALLOC > 0
+  if (buf->fpool != 0)
+    {
+      FAR struct iob_s *iob;
+      irqstate_t flags;
+
+      /* Copy the frame data into a real IOB and return the pool frame */
+
+      iob = iob_tryalloc(false);
+      if (iob == NULL)
+        {
+          return NULL;
+        }
+
+      memcpy(iob->io_data + offset, buf->data, buf->len);
+
+      flags           = spin_lock_irqsave(NULL);
+      frame->io_flink = g_frame_free;
+      g_frame_free    = frame;
+      spin_unlock_irqrestore(NULL, flags);
+
+      buf->fpool = 0;
+      frame      = iob;
+    }
+#endif
+
+  frame->io_len    = buf->len;
+  frame->io_pktlen = buf->len;
+  frame->io_offset = offset;
+
+  buf->frame = NULL;
+  return frame;
+}
+
 /****************************************************************************
  * Name: bt_buf_addref
  *
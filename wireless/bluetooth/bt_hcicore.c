@@ -151,58 +151,52 @@ static void bt_enqueue_bufwork(FAR struct bt_bufferlist_s *list,
 }
 
 /****************************************************************************
- * Name: bt_dequeue_bufwork
+ * Name: bt_drain_bufwork
  *
  * Description:
- *   Remove and return the buffer at the tail of the buffer list specified
- *   by 'list'.
+ *   Atomically remove and return all buffers in the buffer list specified
+ *   by 'list', in the order in which they were added.  Draining the whole
+ *   burst with a single lock operation avoids taking the lock once per
+ *   received packet.
  *
  * Input Parameters:
  *   list - The buffer list to use
  *
  * Returned Value:
- *   A pointer to the buffer that was at the tail of the buffer list.  NULL
- *   is returned if the list was empty.
+ *   A pointer to the chain of buffers, linked through their flink fields
+ *   in FIFO order.  NULL is returned if the list was empty.
  *
  ****************************************************************************/
 
 static FAR struct bt_buf_s *
-  bt_dequeue_bufwork(FAR struct bt_bufferlist_s *list)
+  bt_drain_bufwork(FAR struct bt_bufferlist_s *list)
 {
   FAR struct bt_buf_s *buf;
+  FAR struct bt_buf_s *next;
+  FAR struct bt_buf_s *chain;
   irqstate_t flags;
 
-  flags = spin_lock_irqsave(NULL);
-  buf   = list->tail;
-  if (buf != NULL)
-    {
-      if (list->head == list->tail)
-        {
-          list->head = NULL;
-          list->tail = NULL;
-        }
-      else
-        {
-          FAR struct bt_buf_s *prev;
-
-          for (prev = list->head;
-               prev && prev->flink != buf;
-               prev = prev->flink)
-            {
-            }
+  flags      = spin_lock_irqsave(NULL);
+  buf        = list->head;
+  list->head = NULL;
+  list->tail = NULL;
+  spin_unlock_irqrestore(NULL, flags);
 
-          if (prev != NULL)
-            {
-              prev->flink = NULL;
-              list->tail  = prev;
-            }
-        }
+  /* Buffers are enqueued at the head, so the captured chain is in LIFO
+   * order.  Reverse it so that the caller processes buffers in the order
+   * in which they were received.
+   */
 
-      buf->flink = NULL;
+  chain = NULL;
+  while (buf != NULL)
+    {
+      next       = buf->flink;
+      buf->flink = chain;
+      chain      = buf;
+      buf        = next;
     }
 
-  spin_unlock_irqrestore(NULL, flags);
-  return buf;
+  return chain;
 }
 
 #ifdef CONFIG_WIRELESS_BLUETOOTH_HOST
@@ -1057,13 +1051,28 @@ static int hci_tx_kthread(int argc, FAR char *argv[])
 static void hci_rx_work(FAR void *arg)
 {
   FAR struct bt_bufferlist_s *list = (FAR struct bt_bufferlist_s *)arg;
+  FAR struct bt_buf_s *chain;
   FAR struct bt_buf_s *buf;
 
   wlinfo("list %p\n", list);
   DEBUGASSERT(list != NULL);
 
-  while ((buf = bt_dequeue_bufwork(list)) != NULL)
+  chain = bt_drain_bufwork(list);
+  while (chain != NULL)
     {
+      buf        = chain;
+      chain      = buf->flink;
+      buf->flink = NULL;
+
+      if (chain == NULL)
+        {
+          /* Pick up any buffers that arrived while the burst was
+           * being processed.
+           */
+
+          chain = bt_drain_bufwork(list);
+        }
+
       wlinfo("buf %p type %u len %u\n", buf, buf->type, buf->len);
 
       /* TODO: Hook monitor callback */
@@ -1108,14 +1117,31 @@ static void hci_rx_work(FAR void *arg)
 static void priority_rx_work(FAR void *arg)
 {
   FAR struct bt_bufferlist_s *list = (FAR struct bt_bufferlist_s *)arg;
+  FAR struct bt_buf_s *chain;
   FAR struct bt_buf_s *buf;
 
   wlinfo("list %p\n", list);
   DEBUGASSERT(list != NULL);
 
-  while ((buf = bt_dequeue_bufwork(list)) != NULL)
+  chain = bt_drain_bufwork(list);
+  while (chain != NULL)
     {
-      FAR struct bt_hci_evt_hdr_s *hdr = (FAR void *)buf->data;
+      FAR struct bt_hci_evt_hdr_s *hdr;
+
+      buf        = chain;
+      chain      = buf->flink;
+      buf->flink = NULL;
+
+      if (chain == NULL)
+        {
+          /* Pick up any buffers that arrived while the burst was
+           * being processed.
+           */
+
+          chain = bt_drain_bufwork(list);
+        }
+
+      hdr = (FAR void *)buf->data;
 
       wlinfo("buf %p type %u len %u\n", buf, buf->type, buf->len);
 
@@ -339,30 +339,31 @@ static void btnet_l2cap_receive(FAR struct bt_conn_s *conn,
   DEBUGASSERT(conn != NULL && buf != NULL && buf->frame != NULL &&
               context != NULL && cid < UINT8_MAX);
 
-  /* Detach the IOB frame from the buffer structure */
+  priv = (FAR struct btnet_driver_s *)context;
 
-  frame      = buf->frame;
-  buf->frame = NULL;
+  /* Detach the IOB frame from the buffer structure.  This synchronizes the
+   * IOB size/offset data with the buffer structure data and, if the frame
+   * came from the dedicated Bluetooth frame pool, transfers the data to an
+   * IOB that the network layer may free.
+   */
+
+  frame = bt_buf_detach_frame(buf);
+  if (frame == NULL)
+    {
+      wlwarn("WARNING: Dropped... No IOB available\n");
+      NETDEV_RXDROPPED(&priv->bd_dev.r_dev);
+      bt_buf_release(buf);
+      return;
+    }
 
   /* Ignore the frame if the network is not up */
 
-  priv = (FAR struct btnet_driver_s *)context;
   if (!priv->bd_bifup)
     {
       wlwarn("WARNING: Dropped... Network is down\n");
       goto drop;
     }
 
-  /* Make sure that the size/offset data matches the buffer structure data.
-   * REVISIT:  Wouldn't it be better to just have one copy rather than having
-   * to synchronize?
-   */
-
-  frame->io_len    = buf->len;
-  frame->io_pktlen = buf->len;
-  frame->io_offset = (unsigned int)
-    ((uintptr_t)buf->data - (uintptr_t)frame->io_data);
-
   DEBUGASSERT(frame->io_len <= CONFIG_IOB_BUFSIZE);
   DEBUGASSERT(frame->io_offset < CONFIG_IOB_BUFSIZE);
 